@@ -23,6 +23,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: Inputs: Release the mouse button on AMOTION_EVENT_ACTION_CANCEL.
+//  2026-10-19: Inputs: Added ImGui_ImplAndroid_CaptureInputEvent()/ImGui_ImplAndroid_ProcessInputEvent() to decode events on the input thread and apply them on the render thread.
 //  2022-09-26: Inputs: Renamed ImGuiKey_ModXXX introduced in 1.87 to ImGuiMod_XXX (old names still supported).
 //  2022-01-26: Inputs: replaced short-lived io.AddKeyModsEvent() (added two weeks ago) with io.AddKeyEvent() using ImGuiKey_ModXXX flags. Sorry for the confusion.
 //  2022-01-17: Inputs: calling new io.AddMousePosEvent(), io.AddMouseButtonEvent(), io.AddMouseWheelEvent() API (1.87+).
@@ -33,6 +35,7 @@
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_android.h"
 #include <time.h>
+#include <string.h>
 #include <android/native_window.h>
 #include <android/input.h>
 #include <android/keycodes.h>
@@ -158,23 +161,75 @@ static ImGuiKey ImGui_ImplAndroid_KeyCodeToImGuiKey(int32_t key_code)
 
 int32_t ImGui_ImplAndroid_HandleInputEvent(const AInputEvent* input_event)
 {
-    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplAndroid_InputEvent event;
+    if (!ImGui_ImplAndroid_CaptureInputEvent(input_event, &event))
+        return 0;
+    ImGui_ImplAndroid_ProcessInputEvent(&event);
+    return event.Type == AINPUT_EVENT_TYPE_MOTION ? 1 : 0;
+}
+
+bool ImGui_ImplAndroid_CaptureInputEvent(const AInputEvent* input_event, ImGui_ImplAndroid_InputEvent* out_event)
+{
+    ImGui_ImplAndroid_InputEvent& e = *out_event;
+    memset(&e, 0, sizeof(e));
     int32_t event_type = AInputEvent_getType(input_event);
     switch (event_type)
     {
     case AINPUT_EVENT_TYPE_KEY:
     {
-        int32_t event_key_code = AKeyEvent_getKeyCode(input_event);
-        int32_t event_scan_code = AKeyEvent_getScanCode(input_event);
-        int32_t event_action = AKeyEvent_getAction(input_event);
-        int32_t event_meta_state = AKeyEvent_getMetaState(input_event);
+        e.Type = AINPUT_EVENT_TYPE_KEY;
+        e.Action = (int8_t)AKeyEvent_getAction(input_event);
+        e.State = AKeyEvent_getMetaState(input_event);
+        e.KeyCode = AKeyEvent_getKeyCode(input_event);
+        e.ScanCode = AKeyEvent_getScanCode(input_event);
+        e.EventTime = AKeyEvent_getEventTime(input_event);
+        return true;
+    }
+    case AINPUT_EVENT_TYPE_MOTION:
+    {
+        int32_t event_action = AMotionEvent_getAction(input_event);
+        int32_t event_pointer_index = (event_action & AMOTION_EVENT_ACTION_POINTER_INDEX_MASK) >> AMOTION_EVENT_ACTION_POINTER_INDEX_SHIFT;
+        event_action &= AMOTION_EVENT_ACTION_MASK;
+
+        e.Type = AINPUT_EVENT_TYPE_MOTION;
+        e.Action = (int8_t)event_action;
+        e.ToolType = (int8_t)AMotionEvent_getToolType(input_event, event_pointer_index);
+        e.PointerId = (int8_t)AMotionEvent_getPointerId(input_event, event_pointer_index);
+        e.State = AMotionEvent_getButtonState(input_event);
+        e.EventTime = AMotionEvent_getEventTime(input_event);
+        if (event_action == AMOTION_EVENT_ACTION_SCROLL)
+        {
+            e.X = AMotionEvent_getAxisValue(input_event, AMOTION_EVENT_AXIS_HSCROLL, event_pointer_index);
+            e.Y = AMotionEvent_getAxisValue(input_event, AMOTION_EVENT_AXIS_VSCROLL, event_pointer_index);
+        }
+        else
+        {
+            e.X = AMotionEvent_getX(input_event, event_pointer_index);
+            e.Y = AMotionEvent_getY(input_event, event_pointer_index);
+        }
+        return true;
+    }
+    default:
+        break;
+    }
+
+    return false;
+}
 
-        io.AddKeyEvent(ImGuiMod_Ctrl,  (event_meta_state & AMETA_CTRL_ON)  != 0);
-        io.AddKeyEvent(ImGuiMod_Shift, (event_meta_state & AMETA_SHIFT_ON) != 0);
-        io.AddKeyEvent(ImGuiMod_Alt,   (event_meta_state & AMETA_ALT_ON)   != 0);
-        io.AddKeyEvent(ImGuiMod_Super, (event_meta_state & AMETA_META_ON)  != 0);
+void ImGui_ImplAndroid_ProcessInputEvent(const ImGui_ImplAndroid_InputEvent* event)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    const ImGui_ImplAndroid_InputEvent& e = *event;
+    switch (e.Type)
+    {
+    case AINPUT_EVENT_TYPE_KEY:
+    {
+        io.AddKeyEvent(ImGuiMod_Ctrl,  (e.State & AMETA_CTRL_ON)  != 0);
+        io.AddKeyEvent(ImGuiMod_Shift, (e.State & AMETA_SHIFT_ON) != 0);
+        io.AddKeyEvent(ImGuiMod_Alt,   (e.State & AMETA_ALT_ON)   != 0);
+        io.AddKeyEvent(ImGuiMod_Super, (e.State & AMETA_META_ON)  != 0);
 
-        switch (event_action)
+        switch (e.Action)
         {
         // FIXME: AKEY_EVENT_ACTION_DOWN and AKEY_EVENT_ACTION_UP occur at once as soon as a touch pointer
         // goes up from a key. We use a simple key event queue/ and process one event per key per frame in
@@ -182,11 +237,11 @@ int32_t ImGui_ImplAndroid_HandleInputEvent(const AInputEvent* input_event)
         case AKEY_EVENT_ACTION_DOWN:
         case AKEY_EVENT_ACTION_UP:
         {
-            ImGuiKey key = ImGui_ImplAndroid_KeyCodeToImGuiKey(event_key_code);
+            ImGuiKey key = ImGui_ImplAndroid_KeyCodeToImGuiKey(e.KeyCode);
             if (key != ImGuiKey_None)
             {
-                io.AddKeyEvent(key, event_action == AKEY_EVENT_ACTION_DOWN);
-                io.SetKeyEventNativeData(key, event_key_code, event_scan_code);
+                io.AddKeyEvent(key, e.Action == AKEY_EVENT_ACTION_DOWN);
+                io.SetKeyEventNativeData(key, e.KeyCode, e.ScanCode);
             }
 
             break;
@@ -198,11 +253,7 @@ int32_t ImGui_ImplAndroid_HandleInputEvent(const AInputEvent* input_event)
     }
     case AINPUT_EVENT_TYPE_MOTION:
     {
-        int32_t event_action = AMotionEvent_getAction(input_event);
-        int32_t event_pointer_index = (event_action & AMOTION_EVENT_ACTION_POINTER_INDEX_MASK) >> AMOTION_EVENT_ACTION_POINTER_INDEX_SHIFT;
-        event_action &= AMOTION_EVENT_ACTION_MASK;
-
-        switch (AMotionEvent_getToolType(input_event, event_pointer_index))
+        switch (e.ToolType)
         {
         case AMOTION_EVENT_TOOL_TYPE_MOUSE:
             io.AddMouseSourceEvent(ImGuiMouseSource_Mouse);
@@ -217,48 +268,45 @@ int32_t ImGui_ImplAndroid_HandleInputEvent(const AInputEvent* input_event)
             break;
         }
 
-        switch (event_action)
+        switch (e.Action)
         {
         case AMOTION_EVENT_ACTION_DOWN:
         case AMOTION_EVENT_ACTION_UP:
+        case AMOTION_EVENT_ACTION_CANCEL:
         {
             // Physical mouse buttons (and probably other physical devices) also invoke the actions AMOTION_EVENT_ACTION_DOWN/_UP,
             // but we have to process them separately to identify the actual button pressed. This is done below via
             // AMOTION_EVENT_ACTION_BUTTON_PRESS/_RELEASE. Here, we only process "FINGER" input (and "UNKNOWN", as a fallback).
-            int tool_type = AMotionEvent_getToolType(input_event, event_pointer_index);
-            if (tool_type == AMOTION_EVENT_TOOL_TYPE_FINGER || tool_type == AMOTION_EVENT_TOOL_TYPE_UNKNOWN)
+            if (e.ToolType == AMOTION_EVENT_TOOL_TYPE_FINGER || e.ToolType == AMOTION_EVENT_TOOL_TYPE_UNKNOWN)
             {
-                io.AddMousePosEvent(AMotionEvent_getX(input_event, event_pointer_index), AMotionEvent_getY(input_event, event_pointer_index));
-                io.AddMouseButtonEvent(0, event_action == AMOTION_EVENT_ACTION_DOWN);
+                io.AddMousePosEvent(e.X, e.Y);
+                io.AddMouseButtonEvent(0, e.Action == AMOTION_EVENT_ACTION_DOWN);
             }
             break;
         }
         case AMOTION_EVENT_ACTION_BUTTON_PRESS:
         case AMOTION_EVENT_ACTION_BUTTON_RELEASE:
         {
-            int32_t button_state = AMotionEvent_getButtonState(input_event);
-            io.AddMouseButtonEvent(0, (button_state & AMOTION_EVENT_BUTTON_PRIMARY) != 0);
-            io.AddMouseButtonEvent(1, (button_state & AMOTION_EVENT_BUTTON_SECONDARY) != 0);
-            io.AddMouseButtonEvent(2, (button_state & AMOTION_EVENT_BUTTON_TERTIARY) != 0);
+            io.AddMouseButtonEvent(0, (e.State & AMOTION_EVENT_BUTTON_PRIMARY) != 0);
+            io.AddMouseButtonEvent(1, (e.State & AMOTION_EVENT_BUTTON_SECONDARY) != 0);
+            io.AddMouseButtonEvent(2, (e.State & AMOTION_EVENT_BUTTON_TERTIARY) != 0);
             break;
         }
         case AMOTION_EVENT_ACTION_HOVER_MOVE: // Hovering: Tool moves while NOT pressed (such as a physical mouse)
         case AMOTION_EVENT_ACTION_MOVE:       // Touch pointer moves while DOWN
-            io.AddMousePosEvent(AMotionEvent_getX(input_event, event_pointer_index), AMotionEvent_getY(input_event, event_pointer_index));
+            io.AddMousePosEvent(e.X, e.Y);
             break;
         case AMOTION_EVENT_ACTION_SCROLL:
-            io.AddMouseWheelEvent(AMotionEvent_getAxisValue(input_event, AMOTION_EVENT_AXIS_HSCROLL, event_pointer_index), AMotionEvent_getAxisValue(input_event, AMOTION_EVENT_AXIS_VSCROLL, event_pointer_index));
+            io.AddMouseWheelEvent(e.X, e.Y);
             break;
         default:
             break;
         }
+        break;
     }
-        return 1;
     default:
         break;
     }
-
-    return 0;
 }
 
 bool ImGui_ImplAndroid_Init(ANativeWindow* window)
@@ -34,4 +34,23 @@ IMGUI_IMPL_API int32_t  ImGui_ImplAndroid_HandleInputEvent(const AInputEvent* in
 IMGUI_IMPL_API void     ImGui_ImplAndroid_Shutdown();
 IMGUI_IMPL_API void     ImGui_ImplAndroid_NewFrame();
 
+// Deferred input: a compact copy of the fields ImGui_ImplAndroid_HandleInputEvent() reads from an AInputEvent.
+// CaptureInputEvent() does not touch ImGuiIO and may be called from any thread (e.g. the app's input thread),
+// the captured event can then be handed over to the thread owning the context and applied with ProcessInputEvent().
+struct ImGui_ImplAndroid_InputEvent
+{
+    int8_t      Type;           // AINPUT_EVENT_TYPE_KEY or AINPUT_EVENT_TYPE_MOTION
+    int8_t      Action;         // AKEY_EVENT_ACTION_xxx or AMOTION_EVENT_ACTION_xxx (pointer index stripped)
+    int8_t      ToolType;       // AMOTION_EVENT_TOOL_TYPE_xxx of the acting pointer
+    int8_t      PointerId;      // Motion: id of the acting pointer
+    int32_t     State;          // Key: meta state. Motion: button state.
+    int32_t     KeyCode;        // Key only
+    int32_t     ScanCode;       // Key only
+    float       X, Y;           // Motion: pointer position, or horizontal/vertical wheel for AMOTION_EVENT_ACTION_SCROLL
+    int64_t     EventTime;      // Hardware timestamp in nanoseconds, CLOCK_MONOTONIC time base
+};
+
+IMGUI_IMPL_API bool     ImGui_ImplAndroid_CaptureInputEvent(const AInputEvent* input_event, ImGui_ImplAndroid_InputEvent* out_event);
+IMGUI_IMPL_API void     ImGui_ImplAndroid_ProcessInputEvent(const ImGui_ImplAndroid_InputEvent* event);
+
 #endif // #ifndef IMGUI_DISABLE
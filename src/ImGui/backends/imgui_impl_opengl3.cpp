@@ -7,6 +7,7 @@
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
 //  [x] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset) [Desktop OpenGL only!]
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [x] Renderer: Distance field text for fonts using ImFontFlags_DistanceField (ImGuiBackendFlags_RendererHasDistanceFieldText) [GLSL 130+ and GLSL ES 300+ only!]
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -23,6 +24,10 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: OpenGL: Added '#define IMGUI_IMPL_OPENGL_BATCH_DRAW_CALLS' to render all draw lists with one draw call per texture change, clipping per vertex in the fragment shader.
+//  2026-10-19: OpenGL: Support a compact ImDrawVert layout declaring 'ImDrawVertUV16 uv' (see IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT in imconfig.h), uploaded as normalized 16-bit UVs.
+//  2026-10-19: OpenGL: Coalesce texture update rectangles, uploading fewer and larger blocks.
+//  2026-10-19: OpenGL: Added support for ImGuiBackendFlags_RendererHasDistanceFieldText with GLSL 130+ and GLSL ES 300+ shaders, for fonts using ImFontFlags_DistanceField. Commands with ImDrawCmdFlags_DistanceFieldText use a second program.
 //  2025-09-18: Call platform_io.ClearRendererHandlers() on shutdown.
 //  2025-07-22: OpenGL: Add and call embedded loader shutdown during ImGui_ImplOpenGL3_Shutdown() to facilitate multiple init/shutdown cycles in same process. (#8792)
 //  2025-07-15: OpenGL: Set GL_UNPACK_ALIGNMENT to 1 before updating textures (#8802) + restore non-WebGL/ES update path that doesn't require a CPU-side copy.
@@ -218,6 +223,13 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// Batched draw calls (IMGUI_IMPL_OPENGL_BATCH_DRAW_CALLS) need vertex array objects, and glUniform4fv() which our embedded loader doesn't have.
+// Also needs flat varyings (GLSL 130+ and GLSL ES 300+), checked at runtime.
+#if defined(IMGUI_IMPL_OPENGL_BATCH_DRAW_CALLS) && defined(IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY) && !defined(IMGUI_IMPL_OPENGL_LOADER_IMGL3W)
+#define IMGUI_IMPL_OPENGL_MAY_BATCH_DRAW_CALLS
+#define IMGUI_IMPL_OPENGL_BATCH_MAX_CLIP_RECTS  128     // Size of the ClipRects[] uniform array, a draw call is split when a run of commands uses more
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -227,6 +239,20 @@
 #define GL_CALL(_CALL)      _CALL   // Call without error check
 #endif
 
+// Compact vertex layout (IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT declaring 'ImDrawVertUV16 uv'): UVs are 16-bit normalized integers
+static const bool ImGui_ImplOpenGL3_VtxUVIsUnorm16 = (sizeof(ImDrawVert::uv) == sizeof(ImDrawVertUV16));
+
+// A run of draw commands rendered with a single draw call, or a user callback
+struct ImGui_ImplOpenGL3_Batch
+{
+    GLuint              TexID;
+    ImDrawCmdFlags      Flags;
+    int                 IdxOffset, IdxCount;            // In ImGui_ImplOpenGL3_Data::BatchIdx
+    int                 ClipRectsOffset, ClipRectsCount; // In ImGui_ImplOpenGL3_Data::BatchClipRects
+    const ImDrawList*   CallbackDrawList;
+    const ImDrawCmd*    CallbackCmd;
+};
+
 // OpenGL Data
 struct ImGui_ImplOpenGL3_Data
 {
@@ -243,14 +269,30 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
+    GLuint          AttribLocationVtxClipIndex; // Batched draw calls only
+    GLint           AttribLocationClipRects;
+    GLuint          ShaderHandleSdf;         // Distance field text (ImDrawCmdFlags_DistanceFieldText), same vertex shader and attribute locations
+    GLint           AttribLocationSdfTex;
+    GLint           AttribLocationSdfProjMtx;
+    GLint           AttribLocationSdfClipRects;
     unsigned int    VboHandle, ElementsHandle;
+    unsigned int    ClipIndexVboHandle;
     GLsizeiptr      VertexBufferSize;
     GLsizeiptr      IndexBufferSize;
     bool            HasPolygonMode;
     bool            HasBindSampler;
     bool            HasClipOrigin;
     bool            UseBufferSubData;
+    bool            UseBatching;             // IMGUI_IMPL_OPENGL_BATCH_DRAW_CALLS is defined and supported by the context
     ImVector<char>  TempBuffer;
+    ImVector<ImTextureRect> TempUpdates;
+    ImVector<ImDrawVert> BatchVtx;          // All draw lists merged, see ImGui_ImplOpenGL3_RenderDrawDataBatched()
+    ImVector<unsigned short> BatchVtxClipIndex;
+    ImVector<int>   BatchVtxOwner;
+    ImVector<int>   BatchVtxCopy;
+    ImVector<GLuint> BatchIdx;
+    ImVector<ImVec4> BatchClipRects;
+    ImVector<ImGui_ImplOpenGL3_Batch> Batches;
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -390,6 +432,12 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     strcpy(bd->GlslVersionString, glsl_version);
     strcat(bd->GlslVersionString, "\n");
 
+    // Distance field text needs fwidth(), which the GLSL 1.00 ES / 1.20 shaders don't have.
+    int glsl_version_num = 130;
+    sscanf(bd->GlslVersionString, "#version %d", &glsl_version_num);
+    if (glsl_version_num >= 130)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasDistanceFieldText;
+
     // Make an arbitrary GL call (we don't actually need the result)
     // IF YOU GET A CRASH HERE: it probably means the OpenGL function loader didn't do its job. Let us know!
     GLint current_texture;
@@ -428,7 +476,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
 
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasDistanceFieldText);
     platform_io.ClearRendererHandlers();
     IM_DELETE(bd);
 
@@ -460,7 +508,10 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glDisable(GL_CULL_FACE);
     glDisable(GL_DEPTH_TEST);
     glDisable(GL_STENCIL_TEST);
-    glEnable(GL_SCISSOR_TEST);
+    if (bd->UseBatching)
+        glDisable(GL_SCISSOR_TEST); // Clipping is done in the fragment shader
+    else
+        glEnable(GL_SCISSOR_TEST);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
     if (!bd->GlProfileIsES3 && bd->GlVersion >= 310)
         glDisable(GL_PRIMITIVE_RESTART);
@@ -498,6 +549,12 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
+    if (bd->ShaderHandleSdf)
+    {
+        glUseProgram(bd->ShaderHandleSdf);
+        glUniform1i(bd->AttribLocationSdfTex, 0);
+        glUniformMatrix4fv(bd->AttribLocationSdfProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    }
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
@@ -519,10 +576,174 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
-    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+    if (ImGui_ImplOpenGL3_VtxUVIsUnorm16)
+        GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV, 2, GL_UNSIGNED_SHORT, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+    else
+        GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV, 2, GL_FLOAT,          GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
+#ifdef IMGUI_IMPL_OPENGL_MAY_BATCH_DRAW_CALLS
+    if (bd->UseBatching)
+    {
+        // Per-vertex index into the ClipRects[] uniform array, in a separate buffer (ImDrawVert layout is left untouched)
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->ClipIndexVboHandle));
+        GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxClipIndex));
+        GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxClipIndex, 1, GL_UNSIGNED_SHORT, GL_FALSE, sizeof(unsigned short), (GLvoid*)0));
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
+    }
+#endif
 }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_BATCH_DRAW_CALLS
+// Batched rendering (IMGUI_IMPL_OPENGL_BATCH_DRAW_CALLS): all draw lists are uploaded at once, and consecutive commands sharing a texture
+// are rendered with a single draw call, across clipping rectangles and draw lists.
+// Instead of using glScissor(), each vertex stores the index of its command's clipping rectangle in the ClipRects[] uniform array,
+// and the fragment shader discards fragments outside of it. Rectangles are rounded to the same pixels glScissor() would use.
+static void ImGui_ImplOpenGL3_RenderDrawDataBatched(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // Merge vertices of all draw lists. A vertex takes the clipping rectangle of the first command using it, and is copied if a command with
+    // another rectangle uses it too (ImDrawList never does that, but custom code indexing vertices across AddDrawCmd() calls could).
+    const int vtx_count = draw_data->TotalVtxCount;
+    bd->BatchVtx.resize(vtx_count);
+    bd->BatchVtxClipIndex.resize(vtx_count);
+    bd->BatchVtxOwner.resize(vtx_count);
+    bd->BatchVtxCopy.resize(vtx_count);
+    memset(bd->BatchVtxClipIndex.Data, 0, (size_t)vtx_count * sizeof(unsigned short));
+    memset(bd->BatchVtxOwner.Data, 0xFF, (size_t)vtx_count * sizeof(int)); // -1
+    memset(bd->BatchVtxCopy.Data, 0xFF, (size_t)vtx_count * sizeof(int));  // -1
+    bd->BatchIdx.resize(0);
+    bd->BatchIdx.reserve(draw_data->TotalIdxCount);
+    bd->BatchClipRects.resize(0);
+    bd->Batches.resize(0);
+
+    ImGui_ImplOpenGL3_Batch* batch = nullptr;
+    int vtx_base = 0;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        memcpy(bd->BatchVtx.Data + vtx_base, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            if (cmd.UserCallback != nullptr)
+            {
+                // User callback, called in order between draw calls
+                ImGui_ImplOpenGL3_Batch callback = {};
+                callback.CallbackDrawList = draw_list;
+                callback.CallbackCmd = &cmd;
+                bd->Batches.push_back(callback);
+                batch = nullptr;
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space, rounded like glScissor() (Y is inverted in OpenGL)
+            ImVec2 clip_min((cmd.ClipRect.x - clip_off.x) * clip_scale.x, (cmd.ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((cmd.ClipRect.z - clip_off.x) * clip_scale.x, (cmd.ClipRect.w - clip_off.y) * clip_scale.y);
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                continue;
+            const float clip_x = (float)(int)clip_min.x;
+            const float clip_y = (float)(int)((float)fb_height - clip_max.y);
+            const ImVec4 clip_rect(clip_x, clip_y, clip_x + (float)(int)(clip_max.x - clip_min.x), clip_y + (float)(int)(clip_max.y - clip_min.y));
+
+            // Find or add clipping rectangle. Start a new draw call on texture or program change, or when the uniform array is full.
+            const GLuint tex_id = (GLuint)(intptr_t)cmd.GetTexID();
+            const bool same_state = batch != nullptr && batch->TexID == tex_id && batch->Flags == cmd.Flags;
+            int clip_n = -1;
+            if (same_state)
+                for (int n = batch->ClipRectsCount - 1; n >= 0 && clip_n == -1; n--)
+                    if (memcmp(&bd->BatchClipRects[batch->ClipRectsOffset + n], &clip_rect, sizeof(ImVec4)) == 0)
+                        clip_n = n;
+            if (clip_n == -1)
+            {
+                if (!same_state || batch->ClipRectsCount == IMGUI_IMPL_OPENGL_BATCH_MAX_CLIP_RECTS)
+                {
+                    ImGui_ImplOpenGL3_Batch new_batch = {};
+                    new_batch.TexID = tex_id;
+                    new_batch.Flags = cmd.Flags;
+                    new_batch.IdxOffset = bd->BatchIdx.Size;
+                    new_batch.ClipRectsOffset = bd->BatchClipRects.Size;
+                    bd->Batches.push_back(new_batch);
+                    batch = &bd->Batches.back();
+                }
+                clip_n = batch->ClipRectsCount++;
+                bd->BatchClipRects.push_back(clip_rect);
+            }
+
+            // Rebase indices into the merged vertex buffer (which is why they are always 32-bit here)
+            const int owner = (bd->Batches.Size - 1) * IMGUI_IMPL_OPENGL_BATCH_MAX_CLIP_RECTS + clip_n; // Unique per draw call + clipping rectangle
+            const ImDrawIdx* idx_src = draw_list->IdxBuffer.Data + cmd.IdxOffset;
+            const int idx_offset = bd->BatchIdx.Size;
+            bd->BatchIdx.resize(idx_offset + (int)cmd.ElemCount);
+            GLuint* idx_dst = bd->BatchIdx.Data + idx_offset;
+            for (unsigned int i = 0; i < cmd.ElemCount; i++)
+            {
+                int vtx_i = vtx_base + (int)cmd.VtxOffset + (int)idx_src[i];
+                if (bd->BatchVtxOwner[vtx_i] == -1)
+                {
+                    bd->BatchVtxOwner[vtx_i] = owner;
+                    bd->BatchVtxClipIndex[vtx_i] = (unsigned short)clip_n;
+                }
+                else if (bd->BatchVtxOwner[vtx_i] != owner)
+                {
+                    int copy_i = bd->BatchVtxCopy[vtx_i];
+                    if (copy_i == -1 || bd->BatchVtxOwner[copy_i] != owner)
+                    {
+                        ImDrawVert vtx = bd->BatchVtx[vtx_i]; // push_back() may reallocate
+                        copy_i = bd->BatchVtx.Size;
+                        bd->BatchVtx.push_back(vtx);
+                        bd->BatchVtxClipIndex.push_back((unsigned short)clip_n);
+                        bd->BatchVtxOwner.push_back(owner);
+                        bd->BatchVtxCopy[vtx_i] = copy_i;
+                    }
+                    vtx_i = copy_i;
+                }
+                idx_dst[i] = (GLuint)vtx_i;
+            }
+            batch->IdxCount += (int)cmd.ElemCount;
+        }
+        vtx_base += draw_list->VtxBuffer.Size;
+    }
+
+    // Upload vertex/index buffers (see comments in ImGui_ImplOpenGL3_RenderDrawData() about using glBufferData() only)
+    GL_CALL(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)bd->BatchVtx.Size * (int)sizeof(ImDrawVert), (const GLvoid*)bd->BatchVtx.Data, GL_STREAM_DRAW));
+    GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)bd->BatchIdx.Size * (int)sizeof(GLuint), (const GLvoid*)bd->BatchIdx.Data, GL_STREAM_DRAW));
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->ClipIndexVboHandle));
+    GL_CALL(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)bd->BatchVtxClipIndex.Size * (int)sizeof(unsigned short), (const GLvoid*)bd->BatchVtxClipIndex.Data, GL_STREAM_DRAW));
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
+
+    ImDrawCmdFlags last_cmd_flags = ImDrawCmdFlags_None; // SetupRenderState() left bd->ShaderHandle bound
+    for (const ImGui_ImplOpenGL3_Batch& b : bd->Batches)
+    {
+        if (b.CallbackCmd != nullptr)
+        {
+            // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+            if (b.CallbackCmd->UserCallback == ImDrawCallback_ResetRenderState)
+            {
+                ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                last_cmd_flags = ImDrawCmdFlags_None;
+            }
+            else
+            {
+                b.CallbackCmd->UserCallback(b.CallbackDrawList, b.CallbackCmd);
+            }
+            continue;
+        }
+        const bool sdf = (b.Flags & ImDrawCmdFlags_DistanceFieldText) != 0;
+        if (b.Flags != last_cmd_flags)
+        {
+            GL_CALL(glUseProgram(sdf ? bd->ShaderHandleSdf : bd->ShaderHandle));
+            last_cmd_flags = b.Flags;
+        }
+        GL_CALL(glUniform4fv(sdf ? bd->AttribLocationSdfClipRects : bd->AttribLocationClipRects, b.ClipRectsCount, &bd->BatchClipRects[b.ClipRectsOffset].x));
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, b.TexID));
+        GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)b.IdxCount, GL_UNSIGNED_INT, (void*)(intptr_t)(b.IdxOffset * sizeof(GLuint))));
+    }
+}
+#endif
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -598,6 +819,12 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
     // Render command lists
+    ImDrawCmdFlags last_cmd_flags = ImDrawCmdFlags_None; // SetupRenderState() left bd->ShaderHandle bound
+#ifdef IMGUI_IMPL_OPENGL_MAY_BATCH_DRAW_CALLS
+    if (bd->UseBatching)
+        ImGui_ImplOpenGL3_RenderDrawDataBatched(draw_data, fb_width, fb_height, vertex_array_object);
+    else
+#endif
     for (const ImDrawList* draw_list : draw_data->CmdLists)
     {
         // Upload vertex/index buffers
@@ -639,9 +866,14 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    last_cmd_flags = ImDrawCmdFlags_None;
+                }
                 else
+                {
                     pcmd->UserCallback(draw_list, pcmd);
+                }
             }
             else
             {
@@ -654,6 +886,13 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
                 GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
 
+                // Distance field text uses its own program
+                if (pcmd->Flags != last_cmd_flags)
+                {
+                    GL_CALL(glUseProgram((pcmd->Flags & ImDrawCmdFlags_DistanceFieldText) ? bd->ShaderHandleSdf : bd->ShaderHandle));
+                    last_cmd_flags = pcmd->Flags;
+                }
+
                 // Bind texture, Draw
                 GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
@@ -721,6 +960,42 @@ static void ImGui_ImplOpenGL3_DestroyTexture(ImTextureData* tex)
     tex->SetStatus(ImTextureStatus_Destroyed);
 }
 
+// Merge texture update rectangles into fewer, larger ones. Uploading some unchanged pixels along is harmless (the CPU copy is
+// authoritative) and cheaper than many small uploads: two rectangles are merged when their bounding box is no more than twice
+// the area they cover.
+static void ImGui_ImplOpenGL3_CoalesceTextureUpdates(const ImVector<ImTextureRect>& updates, ImVector<ImTextureRect>& out)
+{
+    ImVector<int> covered; // Area actually updated in each out[] rectangle
+    out.resize(0);
+    for (const ImTextureRect& r : updates)
+    {
+        if (r.w == 0 || r.h == 0)
+            continue;
+        ImTextureRect m = r;
+        int m_covered = r.w * r.h;
+        for (int n = 0; n < out.Size; n++)
+        {
+            const ImTextureRect& o = out[n];
+            const int min_x = (o.x < m.x) ? o.x : m.x;
+            const int min_y = (o.y < m.y) ? o.y : m.y;
+            const int max_x = (o.x + o.w > m.x + m.w) ? o.x + o.w : m.x + m.w;
+            const int max_y = (o.y + o.h > m.y + m.h) ? o.y + o.h : m.y + m.h;
+            if ((max_x - min_x) * (max_y - min_y) > 2 * (covered[n] + m_covered))
+                continue;
+            m.x = (unsigned short)min_x;
+            m.y = (unsigned short)min_y;
+            m.w = (unsigned short)(max_x - min_x);
+            m.h = (unsigned short)(max_y - min_y);
+            m_covered += covered[n];
+            out.erase(out.Data + n);
+            covered.erase(covered.Data + n);
+            n = -1; // The larger rectangle may now merge with ones it couldn't before
+        }
+        out.push_back(m);
+        covered.push_back(m_covered);
+    }
+}
+
 void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
 {
     // FIXME: Consider backing up and restoring
@@ -766,6 +1041,8 @@ void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
     {
         // Update selected blocks. We only ever write to textures regions which have never been used before!
         // This backend choose to use tex->Updates[] but you can use tex->UpdateRect to upload a single region.
+        ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+        ImGui_ImplOpenGL3_CoalesceTextureUpdates(tex->Updates, bd->TempUpdates);
         GLint last_texture;
         GL_CALL(glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture));
 
@@ -773,13 +1050,12 @@ void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
         GL_CALL(glBindTexture(GL_TEXTURE_2D, gl_tex_id));
 #if GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
         GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, tex->Width));
-        for (ImTextureRect& r : tex->Updates)
+        for (ImTextureRect& r : bd->TempUpdates)
             GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.w, r.h, GL_RGBA, GL_UNSIGNED_BYTE, tex->GetPixelsAt(r.x, r.y)));
         GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
 #else
         // GL ES doesn't have GL_UNPACK_ROW_LENGTH, so we need to (A) copy to a contiguous buffer or (B) upload line by line.
-        ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
-        for (ImTextureRect& r : tex->Updates)
+        for (ImTextureRect& r : bd->TempUpdates)
         {
             const int src_pitch = r.w * tex->BytesPerPixel;
             bd->TempBuffer.resize(r.h * src_pitch);
@@ -877,11 +1153,19 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "in vec4 Color;\n"
         "out vec2 Frag_UV;\n"
         "out vec4 Frag_Color;\n"
+        "#ifdef IMGUI_CLIP_RECTS\n" // Batched draw calls: see ImGui_ImplOpenGL3_RenderDrawDataBatched()
+        "uniform vec4 ClipRects[IMGUI_CLIP_RECTS];\n"
+        "in float ClipIndex;\n"
+        "flat out vec4 Frag_Clip;\n"
+        "#endif\n"
         "void main()\n"
         "{\n"
         "    Frag_UV = UV;\n"
         "    Frag_Color = Color;\n"
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
+        "#ifdef IMGUI_CLIP_RECTS\n"
+        "    Frag_Clip = ClipRects[int(ClipIndex)];\n"
+        "#endif\n"
         "}\n";
 
     const GLchar* vertex_shader_glsl_300_es =
@@ -892,11 +1176,19 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "uniform mat4 ProjMtx;\n"
         "out vec2 Frag_UV;\n"
         "out vec4 Frag_Color;\n"
+        "#ifdef IMGUI_CLIP_RECTS\n" // Batched draw calls: see ImGui_ImplOpenGL3_RenderDrawDataBatched()
+        "uniform vec4 ClipRects[IMGUI_CLIP_RECTS];\n"
+        "layout (location = 3) in float ClipIndex;\n"
+        "flat out vec4 Frag_Clip;\n"
+        "#endif\n"
         "void main()\n"
         "{\n"
         "    Frag_UV = UV;\n"
         "    Frag_Color = Color;\n"
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
+        "#ifdef IMGUI_CLIP_RECTS\n"
+        "    Frag_Clip = ClipRects[int(ClipIndex)];\n"
+        "#endif\n"
         "}\n";
 
     const GLchar* vertex_shader_glsl_410_core =
@@ -906,11 +1198,19 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "uniform mat4 ProjMtx;\n"
         "out vec2 Frag_UV;\n"
         "out vec4 Frag_Color;\n"
+        "#ifdef IMGUI_CLIP_RECTS\n" // Batched draw calls: see ImGui_ImplOpenGL3_RenderDrawDataBatched()
+        "uniform vec4 ClipRects[IMGUI_CLIP_RECTS];\n"
+        "layout (location = 3) in float ClipIndex;\n"
+        "flat out vec4 Frag_Clip;\n"
+        "#endif\n"
         "void main()\n"
         "{\n"
         "    Frag_UV = UV;\n"
         "    Frag_Color = Color;\n"
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
+        "#ifdef IMGUI_CLIP_RECTS\n"
+        "    Frag_Clip = ClipRects[int(ClipIndex)];\n"
+        "#endif\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_120 =
@@ -929,10 +1229,17 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "uniform sampler2D Texture;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
+        "#ifdef IMGUI_CLIP_RECTS\n"
+        "flat in vec4 Frag_Clip;\n"
+        "#endif\n"
         "out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
         "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "#ifdef IMGUI_CLIP_RECTS\n" // Batched draw calls: see ImGui_ImplOpenGL3_RenderDrawDataBatched()
+        "    if (any(lessThan(gl_FragCoord.xy, Frag_Clip.xy)) || any(greaterThanEqual(gl_FragCoord.xy, Frag_Clip.zw)))\n"
+        "        discard;\n"
+        "#endif\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_300_es =
@@ -940,25 +1247,99 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "uniform sampler2D Texture;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
+        "#ifdef IMGUI_CLIP_RECTS\n"
+        "flat in highp vec4 Frag_Clip;\n" // Pixel coordinates, beyond mediump's exact integer range
+        "#endif\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
         "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "#ifdef IMGUI_CLIP_RECTS\n" // Batched draw calls: see ImGui_ImplOpenGL3_RenderDrawDataBatched()
+        "    if (any(lessThan(gl_FragCoord.xy, Frag_Clip.xy)) || any(greaterThanEqual(gl_FragCoord.xy, Frag_Clip.zw)))\n"
+        "        discard;\n"
+        "#endif\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_410_core =
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
+        "#ifdef IMGUI_CLIP_RECTS\n"
+        "flat in vec4 Frag_Clip;\n"
+        "#endif\n"
         "uniform sampler2D Texture;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
         "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "#ifdef IMGUI_CLIP_RECTS\n" // Batched draw calls: see ImGui_ImplOpenGL3_RenderDrawDataBatched()
+        "    if (any(lessThan(gl_FragCoord.xy, Frag_Clip.xy)) || any(greaterThanEqual(gl_FragCoord.xy, Frag_Clip.zw)))\n"
+        "        discard;\n"
+        "#endif\n"
+        "}\n";
+
+    // Distance field text (ImDrawCmdFlags_DistanceFieldText) gets its own program, so other draw calls don't pay for the threshold
+    const GLchar* fragment_shader_sdf_glsl_130 =
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "#ifdef IMGUI_CLIP_RECTS\n"
+        "flat in vec4 Frag_Clip;\n"
+        "#endif\n"
+        "out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture(Texture, Frag_UV.st).a;\n"
+        "    float w = fwidth(d);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * smoothstep(0.5 - w, 0.5 + w, d));\n"
+        "#ifdef IMGUI_CLIP_RECTS\n" // After fwidth(), derivatives are undefined after a discard
+        "    if (any(lessThan(gl_FragCoord.xy, Frag_Clip.xy)) || any(greaterThanEqual(gl_FragCoord.xy, Frag_Clip.zw)))\n"
+        "        discard;\n"
+        "#endif\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_300_es =
+        "precision mediump float;\n"
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "#ifdef IMGUI_CLIP_RECTS\n"
+        "flat in highp vec4 Frag_Clip;\n" // Pixel coordinates, beyond mediump's exact integer range
+        "#endif\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture(Texture, Frag_UV.st).a;\n"
+        "    float w = fwidth(d);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * smoothstep(0.5 - w, 0.5 + w, d));\n"
+        "#ifdef IMGUI_CLIP_RECTS\n" // After fwidth(), derivatives are undefined after a discard
+        "    if (any(lessThan(gl_FragCoord.xy, Frag_Clip.xy)) || any(greaterThanEqual(gl_FragCoord.xy, Frag_Clip.zw)))\n"
+        "        discard;\n"
+        "#endif\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_410_core =
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "#ifdef IMGUI_CLIP_RECTS\n"
+        "flat in vec4 Frag_Clip;\n"
+        "#endif\n"
+        "uniform sampler2D Texture;\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = texture(Texture, Frag_UV.st).a;\n"
+        "    float w = fwidth(d);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * smoothstep(0.5 - w, 0.5 + w, d));\n"
+        "#ifdef IMGUI_CLIP_RECTS\n" // After fwidth(), derivatives are undefined after a discard
+        "    if (any(lessThan(gl_FragCoord.xy, Frag_Clip.xy)) || any(greaterThanEqual(gl_FragCoord.xy, Frag_Clip.zw)))\n"
+        "        discard;\n"
+        "#endif\n"
         "}\n";
 
     // Select shaders matching our GLSL versions
     const GLchar* vertex_shader = nullptr;
     const GLchar* fragment_shader = nullptr;
+    const GLchar* fragment_shader_sdf = nullptr;
     if (glsl_version < 130)
     {
         vertex_shader = vertex_shader_glsl_120;
@@ -968,31 +1349,43 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     {
         vertex_shader = vertex_shader_glsl_410_core;
         fragment_shader = fragment_shader_glsl_410_core;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_410_core;
     }
     else if (glsl_version == 300)
     {
         vertex_shader = vertex_shader_glsl_300_es;
         fragment_shader = fragment_shader_glsl_300_es;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_300_es;
     }
     else
     {
         vertex_shader = vertex_shader_glsl_130;
         fragment_shader = fragment_shader_glsl_130;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_130;
     }
 
+    // Batched draw calls need flat varyings
+    bd->UseBatching = false;
+    char shader_defines[64] = "";
+#ifdef IMGUI_IMPL_OPENGL_MAY_BATCH_DRAW_CALLS
+    bd->UseBatching = (glsl_version >= 130);
+    if (bd->UseBatching)
+        snprintf(shader_defines, IM_ARRAYSIZE(shader_defines), "#define IMGUI_CLIP_RECTS %d\n", IMGUI_IMPL_OPENGL_BATCH_MAX_CLIP_RECTS);
+#endif
+
     // Create shaders
-    const GLchar* vertex_shader_with_version[2] = { bd->GlslVersionString, vertex_shader };
+    const GLchar* vertex_shader_with_version[3] = { bd->GlslVersionString, shader_defines, vertex_shader };
     GLuint vert_handle;
     GL_CALL(vert_handle = glCreateShader(GL_VERTEX_SHADER));
-    glShaderSource(vert_handle, 2, vertex_shader_with_version, nullptr);
+    glShaderSource(vert_handle, 3, vertex_shader_with_version, nullptr);
     glCompileShader(vert_handle);
     if (!CheckShader(vert_handle, "vertex shader"))
         return false;
 
-    const GLchar* fragment_shader_with_version[2] = { bd->GlslVersionString, fragment_shader };
+    const GLchar* fragment_shader_with_version[3] = { bd->GlslVersionString, shader_defines, fragment_shader };
     GLuint frag_handle;
     GL_CALL(frag_handle = glCreateShader(GL_FRAGMENT_SHADER));
-    glShaderSource(frag_handle, 2, fragment_shader_with_version, nullptr);
+    glShaderSource(frag_handle, 3, fragment_shader_with_version, nullptr);
     glCompileShader(frag_handle);
     if (!CheckShader(frag_handle, "fragment shader"))
         return false;
@@ -1007,7 +1400,6 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     glDetachShader(bd->ShaderHandle, vert_handle);
     glDetachShader(bd->ShaderHandle, frag_handle);
-    glDeleteShader(vert_handle);
     glDeleteShader(frag_handle);
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
@@ -1015,10 +1407,67 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     bd->AttribLocationVtxPos = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Position");
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
+    if (bd->UseBatching)
+    {
+        bd->AttribLocationVtxClipIndex = (GLuint)glGetAttribLocation(bd->ShaderHandle, "ClipIndex");
+        bd->AttribLocationClipRects = glGetUniformLocation(bd->ShaderHandle, "ClipRects");
+    }
+
+    // Distance field text program, sharing the vertex shader. Attribute locations must match so the vertex setup serves both programs.
+    bd->ShaderHandleSdf = 0;
+    if (fragment_shader_sdf != nullptr)
+    {
+        const GLchar* fragment_shader_sdf_with_version[3] = { bd->GlslVersionString, shader_defines, fragment_shader_sdf };
+        GLuint frag_sdf_handle;
+        GL_CALL(frag_sdf_handle = glCreateShader(GL_FRAGMENT_SHADER));
+        glShaderSource(frag_sdf_handle, 3, fragment_shader_sdf_with_version, nullptr);
+        glCompileShader(frag_sdf_handle);
+        if (!CheckShader(frag_sdf_handle, "distance field fragment shader"))
+            return false;
+
+        bd->ShaderHandleSdf = glCreateProgram();
+        glAttachShader(bd->ShaderHandleSdf, vert_handle);
+        glAttachShader(bd->ShaderHandleSdf, frag_sdf_handle);
+#ifndef IMGUI_IMPL_OPENGL_LOADER_IMGL3W
+        glBindAttribLocation(bd->ShaderHandleSdf, bd->AttribLocationVtxPos, "Position");
+        glBindAttribLocation(bd->ShaderHandleSdf, bd->AttribLocationVtxUV, "UV");
+        glBindAttribLocation(bd->ShaderHandleSdf, bd->AttribLocationVtxColor, "Color");
+        if (bd->UseBatching)
+            glBindAttribLocation(bd->ShaderHandleSdf, bd->AttribLocationVtxClipIndex, "ClipIndex");
+#endif
+        glLinkProgram(bd->ShaderHandleSdf);
+        if (!CheckProgram(bd->ShaderHandleSdf, "distance field shader program"))
+            return false;
+
+        glDetachShader(bd->ShaderHandleSdf, vert_handle);
+        glDetachShader(bd->ShaderHandleSdf, frag_sdf_handle);
+        glDeleteShader(frag_sdf_handle);
+
+        bd->AttribLocationSdfTex = glGetUniformLocation(bd->ShaderHandleSdf, "Texture");
+        bd->AttribLocationSdfProjMtx = glGetUniformLocation(bd->ShaderHandleSdf, "ProjMtx");
+        if (bd->UseBatching)
+            bd->AttribLocationSdfClipRects = glGetUniformLocation(bd->ShaderHandleSdf, "ClipRects");
+        bool same_attrib_locations = (GLuint)glGetAttribLocation(bd->ShaderHandleSdf, "Position") == bd->AttribLocationVtxPos
+            && (GLuint)glGetAttribLocation(bd->ShaderHandleSdf, "UV") == bd->AttribLocationVtxUV
+            && (GLuint)glGetAttribLocation(bd->ShaderHandleSdf, "Color") == bd->AttribLocationVtxColor;
+        if (bd->UseBatching)
+            same_attrib_locations &= (GLuint)glGetAttribLocation(bd->ShaderHandleSdf, "ClipIndex") == bd->AttribLocationVtxClipIndex;
+        if (!same_attrib_locations)
+        {
+            // Only possible with the embedded loader, which has no glBindAttribLocation(): leave distance field text unsupported.
+            fprintf(stderr, "ERROR: ImGui_ImplOpenGL3_CreateDeviceObjects: distance field shader program has different attribute locations! Disabling distance field text.\n");
+            glDeleteProgram(bd->ShaderHandleSdf);
+            bd->ShaderHandleSdf = 0;
+            ImGui::GetIO().BackendFlags &= ~ImGuiBackendFlags_RendererHasDistanceFieldText;
+        }
+    }
+    glDeleteShader(vert_handle);
 
     // Create buffers
     glGenBuffers(1, &bd->VboHandle);
     glGenBuffers(1, &bd->ElementsHandle);
+    if (bd->UseBatching)
+        glGenBuffers(1, &bd->ClipIndexVboHandle);
 
     // Restore modified GL state
     glBindTexture(GL_TEXTURE_2D, last_texture);
@@ -1038,7 +1487,9 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
+    if (bd->ClipIndexVboHandle) { glDeleteBuffers(1, &bd->ClipIndexVboHandle); bd->ClipIndexVboHandle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+    if (bd->ShaderHandleSdf) { glDeleteProgram(bd->ShaderHandleSdf); bd->ShaderHandleSdf = 0; }
 
     // Destroy all textures
     for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
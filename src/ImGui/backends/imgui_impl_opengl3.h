@@ -46,6 +46,7 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex);
 // Configuration flags to add in your imconfig file:
 //#define IMGUI_IMPL_OPENGL_ES2     // Enable ES 2 (Auto-detected on Emscripten)
 //#define IMGUI_IMPL_OPENGL_ES3     // Enable ES 3 (Auto-detected on iOS/Android)
+//#define IMGUI_IMPL_OPENGL_BATCH_DRAW_CALLS  // Merge draw commands sharing a texture into a single draw call, clipping in the fragment shader instead of glScissor() [GLSL 130+ and GLSL ES 300+ only, not with the embedded loader]
 
 // You can explicitly select GLES2 or GLES3 API by using one of the '#define IMGUI_IMPL_OPENGL_LOADER_XXX' in imconfig.h or compiler command-line.
 #if !defined(IMGUI_IMPL_OPENGL_ES2) \
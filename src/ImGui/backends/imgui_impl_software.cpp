@@ -0,0 +1,554 @@
+// dear imgui: Renderer Backend for a CPU rasterizer
+// This needs to be used along with a Platform Backend, or with a host program filling ImGuiIO itself (e.g. tests)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftware_Texture*' as texture identifier, see ImGui_ImplSoftware_CreateTexture(). Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Multi-threaded, by screen tiles.
+// Missing features or Issues:
+//  [ ] Renderer: No distance field text (ImGuiBackendFlags_RendererHasDistanceFieldText).
+//  [ ] Renderer: User callbacks are called while collecting triangles, before anything is drawn: they can't draw.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+// CHANGELOG
+//  2026-10-19: Software: Initial version. Tile binned, multi-threaded rasterizer following the OpenGL3 backend's rendering rules.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_software.h"
+#include <stdint.h>     // intptr_t, int64_t
+#include <string.h>     // memcpy
+#include <math.h>       // floorf
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Tiles are square, a power of two
+#define IMGUI_IMPL_SOFTWARE_TILE_SHIFT  6
+#define IMGUI_IMPL_SOFTWARE_TILE_SIZE   (1 << IMGUI_IMPL_SOFTWARE_TILE_SHIFT)
+
+// Vertex positions are snapped to 1/256th of a pixel, like GPUs do (to 1/16th..1/256th). Positions further than this from the
+// framebuffer are culled, which keeps edge equations within 64-bit integers.
+#define IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS   8
+#define IMGUI_IMPL_SOFTWARE_MAX_COORD       (1 << 22)
+
+// (imgui_internal.h's ImMin/ImMax aren't available to backends)
+static inline int ImGui_ImplSoftware_Min(int a, int b)              { return a < b ? a : b; }
+static inline int ImGui_ImplSoftware_Max(int a, int b)              { return a > b ? a : b; }
+static inline int ImGui_ImplSoftware_Clamp(int v, int lo, int hi)   { return v < lo ? lo : v > hi ? hi : v; }
+
+// A triangle ready to be drawn: counter-clockwise in fixed point, with the pixels it may cover (bounds and scissor)
+struct ImGui_ImplSoftware_Triangle
+{
+    int                                 X[3], Y[3];
+    ImVec2                              UV[3];
+    ImU32                               Col[3];
+    const ImGui_ImplSoftware_Texture*   Tex;
+    int                                 MinX, MinY, MaxX, MaxY;     // Max is exclusive
+};
+
+struct ImGui_ImplSoftware_Data
+{
+    // Frame being drawn
+    ImVector<ImGui_ImplSoftware_Triangle>   Triangles;
+    ImVector<int>                           TileStart;      // Triangles of tile N are TileTriangles[TileStart[N]..TileStart[N + 1]], in submission order
+    ImVector<int>                           TileTriangles;
+    int                                     TilesX, TilesY;
+    ImU32*                                  Target;
+    int                                     TargetStride;
+    int                                     TargetWidth, TargetHeight;
+
+    // Worker threads
+    ImVector<std::thread*>                  Workers;
+    std::mutex                              Mutex;
+    std::condition_variable                 WakeCv;
+    std::condition_variable                 DoneCv;
+    int                                     JobId;
+    int                                     WorkersBusy;
+    bool                                    Quit;
+    std::atomic<int>                        NextTile;
+
+    ImGui_ImplSoftware_Data()               { TilesX = TilesY = 0; Target = nullptr; TargetStride = TargetWidth = TargetHeight = 0; JobId = WorkersBusy = 0; Quit = false; NextTile = 0; }
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+static ImGui_ImplSoftware_Data* ImGui_ImplSoftware_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplSoftware_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+struct ImGui_ImplSoftware_Color
+{
+    float r, g, b, a;
+};
+
+static inline ImGui_ImplSoftware_Color ImGui_ImplSoftware_Unpack(ImU32 c)
+{
+    const float k = 1.0f / 255.0f;
+    ImGui_ImplSoftware_Color out = { ((c >> IM_COL32_R_SHIFT) & 0xFF) * k, ((c >> IM_COL32_G_SHIFT) & 0xFF) * k, ((c >> IM_COL32_B_SHIFT) & 0xFF) * k, ((c >> IM_COL32_A_SHIFT) & 0xFF) * k };
+    return out;
+}
+
+// Bilinear filtering, clamp to edge (GL_LINEAR + GL_CLAMP_TO_EDGE). No texture samples as opaque white.
+static inline ImGui_ImplSoftware_Color ImGui_ImplSoftware_Sample(const ImGui_ImplSoftware_Texture* tex, ImVec2 uv)
+{
+    if (tex == nullptr)
+    {
+        ImGui_ImplSoftware_Color white = { 1.0f, 1.0f, 1.0f, 1.0f };
+        return white;
+    }
+    const float fx = uv.x * tex->Width - 0.5f;
+    const float fy = uv.y * tex->Height - 0.5f;
+    const float flx = floorf(fx);
+    const float fly = floorf(fy);
+    const float ax = fx - flx;
+    const float ay = fy - fly;
+    const int x0 = ImGui_ImplSoftware_Clamp((int)flx, 0, tex->Width - 1);
+    const int y0 = ImGui_ImplSoftware_Clamp((int)fly, 0, tex->Height - 1);
+    const int x1 = ImGui_ImplSoftware_Clamp((int)flx + 1, 0, tex->Width - 1);
+    const int y1 = ImGui_ImplSoftware_Clamp((int)fly + 1, 0, tex->Height - 1);
+    const ImU32* row0 = tex->Pixels + (size_t)y0 * tex->Width;
+    const ImU32* row1 = tex->Pixels + (size_t)y1 * tex->Width;
+    const ImU32 c00 = row0[x0], c10 = row0[x1], c01 = row1[x0], c11 = row1[x1];
+    const float w00 = (1.0f - ax) * (1.0f - ay), w10 = ax * (1.0f - ay), w01 = (1.0f - ax) * ay, w11 = ax * ay;
+    const float k = 1.0f / 255.0f;
+    ImGui_ImplSoftware_Color out;
+#define IMGUI_IMPL_SOFTWARE_BILERP(SHIFT) ((((c00 >> SHIFT) & 0xFF) * w00 + ((c10 >> SHIFT) & 0xFF) * w10 + ((c01 >> SHIFT) & 0xFF) * w01 + ((c11 >> SHIFT) & 0xFF) * w11) * k)
+    out.r = IMGUI_IMPL_SOFTWARE_BILERP(IM_COL32_R_SHIFT);
+    out.g = IMGUI_IMPL_SOFTWARE_BILERP(IM_COL32_G_SHIFT);
+    out.b = IMGUI_IMPL_SOFTWARE_BILERP(IM_COL32_B_SHIFT);
+    out.a = IMGUI_IMPL_SOFTWARE_BILERP(IM_COL32_A_SHIFT);
+#undef IMGUI_IMPL_SOFTWARE_BILERP
+    return out;
+}
+
+// RGB: SRC_ALPHA, ONE_MINUS_SRC_ALPHA. Alpha: ONE, ONE_MINUS_SRC_ALPHA.
+static inline void ImGui_ImplSoftware_Blend(ImU32* dst, const ImGui_ImplSoftware_Color& src)
+{
+    if (src.a <= 0.0f)
+        return;
+    const ImU32 d = *dst;
+    const float inv_a = 1.0f - src.a;
+    const float r = src.r * src.a * 255.0f + ((d >> IM_COL32_R_SHIFT) & 0xFF) * inv_a;
+    const float g = src.g * src.a * 255.0f + ((d >> IM_COL32_G_SHIFT) & 0xFF) * inv_a;
+    const float b = src.b * src.a * 255.0f + ((d >> IM_COL32_B_SHIFT) & 0xFF) * inv_a;
+    const float a = src.a * 255.0f + ((d >> IM_COL32_A_SHIFT) & 0xFF) * inv_a;
+    *dst = ((ImU32)(r + 0.5f) << IM_COL32_R_SHIFT) | ((ImU32)(g + 0.5f) << IM_COL32_G_SHIFT) | ((ImU32)(b + 0.5f) << IM_COL32_B_SHIFT) | ((ImU32)(a + 0.5f) << IM_COL32_A_SHIFT);
+}
+
+// Top-left fill rule: a pixel center exactly on an edge belongs to the triangle only if the edge is a top or a left one.
+// For our winding those go right (horizontal) or up.
+static inline int ImGui_ImplSoftware_EdgeBias(int ax, int ay, int bx, int by)
+{
+    return ((by == ay && bx > ax) || by < ay) ? 0 : -1;
+}
+
+// Draws the part of a triangle within [x0,x1) x [y0,y1)
+static void ImGui_ImplSoftware_DrawTriangle(const ImGui_ImplSoftware_Data* bd, const ImGui_ImplSoftware_Triangle& tri, int x0, int y0, int x1, int y1)
+{
+    // Edge i is opposite to vertex i: E_i(p) = (b - a) x (p - a) with a = v[i + 1], b = v[i + 2].
+    // For a pixel center inside the triangle, all three are >= 0 and E_i / area is the weight of vertex i.
+    const int* X = tri.X;
+    const int* Y = tri.Y;
+    const int64_t area = (int64_t)(X[1] - X[0]) * (Y[2] - Y[0]) - (int64_t)(Y[1] - Y[0]) * (X[2] - X[0]);
+    const int half = 1 << (IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS - 1);
+    const int64_t px = ((int64_t)x0 << IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) + half;
+    const int64_t py = ((int64_t)y0 << IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) + half;
+    int64_t row[3], step_x[3], step_y[3];
+    for (int i = 0; i < 3; i++)
+    {
+        const int a = (i + 1) % 3, b = (i + 2) % 3;
+        const int64_t dx = X[b] - X[a], dy = Y[b] - Y[a];
+        row[i] = dx * (py - Y[a]) - dy * (px - X[a]) + ImGui_ImplSoftware_EdgeBias(X[a], Y[a], X[b], Y[b]);
+        step_x[i] = -dy << IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS;
+        step_y[i] = dx << IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS;
+    }
+
+    // Solid fills and anti-aliasing fringes use a single UV (the atlas' white pixel), and often a single color
+    const bool same_uv = tri.UV[0].x == tri.UV[1].x && tri.UV[0].x == tri.UV[2].x && tri.UV[0].y == tri.UV[1].y && tri.UV[0].y == tri.UV[2].y;
+    const bool same_col = tri.Col[0] == tri.Col[1] && tri.Col[0] == tri.Col[2];
+    const ImGui_ImplSoftware_Color c0 = ImGui_ImplSoftware_Unpack(tri.Col[0]);
+    const ImGui_ImplSoftware_Color c1 = ImGui_ImplSoftware_Unpack(tri.Col[1]);
+    const ImGui_ImplSoftware_Color c2 = ImGui_ImplSoftware_Unpack(tri.Col[2]);
+    const ImGui_ImplSoftware_Color texel0 = ImGui_ImplSoftware_Sample(tri.Tex, tri.UV[0]);
+    const float inv_area = 1.0f / (float)area;
+
+    for (int y = y0; y < y1; y++)
+    {
+        int64_t w0 = row[0], w1 = row[1], w2 = row[2];
+        ImU32* dst = bd->Target + (size_t)y * bd->TargetStride;
+        for (int x = x0; x < x1; x++, w0 += step_x[0], w1 += step_x[1], w2 += step_x[2])
+        {
+            if ((w0 | w1 | w2) < 0)
+                continue;
+            const float l1 = (float)w1 * inv_area;
+            const float l2 = (float)w2 * inv_area;
+            ImGui_ImplSoftware_Color col;
+            if (same_col)
+                col = c0;
+            else
+            {
+                col.r = c0.r + (c1.r - c0.r) * l1 + (c2.r - c0.r) * l2;
+                col.g = c0.g + (c1.g - c0.g) * l1 + (c2.g - c0.g) * l2;
+                col.b = c0.b + (c1.b - c0.b) * l1 + (c2.b - c0.b) * l2;
+                col.a = c0.a + (c1.a - c0.a) * l1 + (c2.a - c0.a) * l2;
+            }
+            ImGui_ImplSoftware_Color texel = texel0;
+            if (!same_uv)
+            {
+                ImVec2 uv(tri.UV[0].x + (tri.UV[1].x - tri.UV[0].x) * l1 + (tri.UV[2].x - tri.UV[0].x) * l2,
+                          tri.UV[0].y + (tri.UV[1].y - tri.UV[0].y) * l1 + (tri.UV[2].y - tri.UV[0].y) * l2);
+                texel = ImGui_ImplSoftware_Sample(tri.Tex, uv);
+            }
+            col.r *= texel.r;
+            col.g *= texel.g;
+            col.b *= texel.b;
+            col.a *= texel.a;
+            ImGui_ImplSoftware_Blend(dst + x, col);
+        }
+        row[0] += step_y[0];
+        row[1] += step_y[1];
+        row[2] += step_y[2];
+    }
+}
+
+static void ImGui_ImplSoftware_DrawTiles(ImGui_ImplSoftware_Data* bd)
+{
+    const int tile_count = bd->TilesX * bd->TilesY;
+    for (int tile = bd->NextTile++; tile < tile_count; tile = bd->NextTile++)
+    {
+        const int tx0 = (tile % bd->TilesX) << IMGUI_IMPL_SOFTWARE_TILE_SHIFT;
+        const int ty0 = (tile / bd->TilesX) << IMGUI_IMPL_SOFTWARE_TILE_SHIFT;
+        const int tx1 = ImGui_ImplSoftware_Min(tx0 + IMGUI_IMPL_SOFTWARE_TILE_SIZE, bd->TargetWidth);
+        const int ty1 = ImGui_ImplSoftware_Min(ty0 + IMGUI_IMPL_SOFTWARE_TILE_SIZE, bd->TargetHeight);
+        for (int n = bd->TileStart[tile]; n < bd->TileStart[tile + 1]; n++)
+        {
+            const ImGui_ImplSoftware_Triangle& tri = bd->Triangles[bd->TileTriangles[n]];
+            ImGui_ImplSoftware_DrawTriangle(bd, tri, ImGui_ImplSoftware_Max(tri.MinX, tx0), ImGui_ImplSoftware_Max(tri.MinY, ty0), ImGui_ImplSoftware_Min(tri.MaxX, tx1), ImGui_ImplSoftware_Min(tri.MaxY, ty1));
+        }
+    }
+}
+
+static void ImGui_ImplSoftware_WorkerThread(ImGui_ImplSoftware_Data* bd)
+{
+    std::unique_lock<std::mutex> lock(bd->Mutex);
+    int last_job = bd->JobId;
+    for (;;)
+    {
+        bd->WakeCv.wait(lock, [&] { return bd->Quit || bd->JobId != last_job; });
+        if (bd->Quit)
+            return;
+        last_job = bd->JobId;
+        lock.unlock();
+        ImGui_ImplSoftware_DrawTiles(bd);
+        lock.lock();
+        if (--bd->WorkersBusy == 0)
+            bd->DoneCv.notify_one();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Triangle setup and binning
+//-----------------------------------------------------------------------------
+
+// Returns false if the triangle covers no pixel of 'clip'
+static bool ImGui_ImplSoftware_SetupTriangle(ImGui_ImplSoftware_Triangle* tri, const ImDrawVert* v0, const ImDrawVert* v1, const ImDrawVert* v2, ImVec2 clip_off, ImVec2 clip_scale, const int clip[4])
+{
+    const ImDrawVert* v[3] = { v0, v1, v2 };
+    const float subpixels = (float)(1 << IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS);
+    for (int i = 0; i < 3; i++)
+    {
+        const float x = (v[i]->pos.x - clip_off.x) * clip_scale.x;
+        const float y = (v[i]->pos.y - clip_off.y) * clip_scale.y;
+        if (!(x > -IMGUI_IMPL_SOFTWARE_MAX_COORD && x < IMGUI_IMPL_SOFTWARE_MAX_COORD && y > -IMGUI_IMPL_SOFTWARE_MAX_COORD && y < IMGUI_IMPL_SOFTWARE_MAX_COORD))
+            return false;
+        tri->X[i] = (int)floorf(x * subpixels + 0.5f);
+        tri->Y[i] = (int)floorf(y * subpixels + 0.5f);
+        tri->UV[i] = v[i]->uv;
+        tri->Col[i] = v[i]->col;
+    }
+    const int64_t area = (int64_t)(tri->X[1] - tri->X[0]) * (tri->Y[2] - tri->Y[0]) - (int64_t)(tri->Y[1] - tri->Y[0]) * (tri->X[2] - tri->X[0]);
+    if (area == 0)
+        return false;
+    if (area < 0)
+    {
+        // Either winding is drawn (no culling), edge equations want one
+        int x = tri->X[1]; tri->X[1] = tri->X[2]; tri->X[2] = x;
+        int y = tri->Y[1]; tri->Y[1] = tri->Y[2]; tri->Y[2] = y;
+        ImVec2 uv = tri->UV[1]; tri->UV[1] = tri->UV[2]; tri->UV[2] = uv;
+        ImU32 col = tri->Col[1]; tri->Col[1] = tri->Col[2]; tri->Col[2] = col;
+    }
+
+    // Pixels whose center is within the bounding box
+    const int half = 1 << (IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS - 1);
+    const int min_x = ImGui_ImplSoftware_Min(ImGui_ImplSoftware_Min(tri->X[0], tri->X[1]), tri->X[2]), max_x = ImGui_ImplSoftware_Max(ImGui_ImplSoftware_Max(tri->X[0], tri->X[1]), tri->X[2]);
+    const int min_y = ImGui_ImplSoftware_Min(ImGui_ImplSoftware_Min(tri->Y[0], tri->Y[1]), tri->Y[2]), max_y = ImGui_ImplSoftware_Max(ImGui_ImplSoftware_Max(tri->Y[0], tri->Y[1]), tri->Y[2]);
+    tri->MinX = ImGui_ImplSoftware_Max((min_x - half + (1 << IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) - 1) >> IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS, clip[0]);
+    tri->MinY = ImGui_ImplSoftware_Max((min_y - half + (1 << IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) - 1) >> IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS, clip[1]);
+    tri->MaxX = ImGui_ImplSoftware_Min(((max_x - half) >> IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) + 1, clip[2]);
+    tri->MaxY = ImGui_ImplSoftware_Min(((max_y - half) >> IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) + 1, clip[3]);
+    return tri->MinX < tri->MaxX && tri->MinY < tri->MaxY;
+}
+
+// Lists the triangles overlapping each tile: count, prefix sum, fill
+static void ImGui_ImplSoftware_BinTriangles(ImGui_ImplSoftware_Data* bd)
+{
+    const int tile_count = bd->TilesX * bd->TilesY;
+    bd->TileStart.resize(tile_count + 1);
+    memset(bd->TileStart.Data, 0, bd->TileStart.size_in_bytes());
+    for (const ImGui_ImplSoftware_Triangle& tri : bd->Triangles)
+        for (int ty = tri.MinY >> IMGUI_IMPL_SOFTWARE_TILE_SHIFT; ty <= (tri.MaxY - 1) >> IMGUI_IMPL_SOFTWARE_TILE_SHIFT; ty++)
+            for (int tx = tri.MinX >> IMGUI_IMPL_SOFTWARE_TILE_SHIFT; tx <= (tri.MaxX - 1) >> IMGUI_IMPL_SOFTWARE_TILE_SHIFT; tx++)
+                bd->TileStart[ty * bd->TilesX + tx + 1]++;
+    for (int tile = 0; tile < tile_count; tile++)
+        bd->TileStart[tile + 1] += bd->TileStart[tile];
+    bd->TileTriangles.resize(bd->TileStart[tile_count]);
+    for (int n = 0; n < bd->Triangles.Size; n++)
+    {
+        const ImGui_ImplSoftware_Triangle& tri = bd->Triangles[n];
+        for (int ty = tri.MinY >> IMGUI_IMPL_SOFTWARE_TILE_SHIFT; ty <= (tri.MaxY - 1) >> IMGUI_IMPL_SOFTWARE_TILE_SHIFT; ty++)
+            for (int tx = tri.MinX >> IMGUI_IMPL_SOFTWARE_TILE_SHIFT; tx <= (tri.MaxX - 1) >> IMGUI_IMPL_SOFTWARE_TILE_SHIFT; tx++)
+                bd->TileTriangles[bd->TileStart[ty * bd->TilesX + tx]++] = n;
+    }
+    // The fill advanced each start to the next tile's
+    for (int tile = tile_count; tile > 0; tile--)
+        bd->TileStart[tile] = bd->TileStart[tile - 1];
+    bd->TileStart[0] = 0;
+}
+
+void ImGui_ImplSoftware_RenderDrawData(ImDrawData* draw_data, ImU32* pixels, int width, int height, int stride)
+{
+    ImGui_ImplSoftware_Data* bd = ImGui_ImplSoftware_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSoftware_Init()?");
+
+    // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
+    const int fb_width = ImGui_ImplSoftware_Min((int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x), width);
+    const int fb_height = ImGui_ImplSoftware_Min((int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y), height);
+    if (fb_width <= 0 || fb_height <= 0)
+        return;
+
+    // Catch up with texture updates. Most of the times, the list will have 1 element with an OK status, aka nothing to do.
+    // (This almost always points to ImGui::GetPlatformIO().Textures[] but is part of ImDrawData to allow overriding or disabling texture updates).
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                ImGui_ImplSoftware_UpdateTexture(tex);
+
+    bd->Target = pixels;
+    bd->TargetStride = stride;
+    bd->TargetWidth = fb_width;
+    bd->TargetHeight = fb_height;
+    bd->TilesX = (fb_width + IMGUI_IMPL_SOFTWARE_TILE_SIZE - 1) >> IMGUI_IMPL_SOFTWARE_TILE_SHIFT;
+    bd->TilesY = (fb_height + IMGUI_IMPL_SOFTWARE_TILE_SIZE - 1) >> IMGUI_IMPL_SOFTWARE_TILE_SHIFT;
+    bd->Triangles.resize(0);
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(draw_list, pcmd);
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space, rounded like glScissor() in the OpenGL3 backend
+            ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                continue;
+            const int gl_x = (int)clip_min.x, gl_y = (int)((float)fb_height - clip_max.y);
+            const int gl_w = (int)(clip_max.x - clip_min.x), gl_h = (int)(clip_max.y - clip_min.y);
+            int clip[4] = { ImGui_ImplSoftware_Max(gl_x, 0), ImGui_ImplSoftware_Max(fb_height - gl_y - gl_h, 0), ImGui_ImplSoftware_Min(gl_x + gl_w, fb_width), ImGui_ImplSoftware_Min(fb_height - gl_y, fb_height) };
+            if (clip[2] <= clip[0] || clip[3] <= clip[1])
+                continue;
+
+            const ImGui_ImplSoftware_Texture* tex = (const ImGui_ImplSoftware_Texture*)(intptr_t)pcmd->GetTexID();
+            const ImDrawVert* vtx = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
+            const ImDrawIdx* idx = draw_list->IdxBuffer.Data + pcmd->IdxOffset;
+            for (unsigned int i = 0; i + 2 < pcmd->ElemCount; i += 3)
+            {
+                ImGui_ImplSoftware_Triangle tri;
+                if (!ImGui_ImplSoftware_SetupTriangle(&tri, &vtx[idx[i]], &vtx[idx[i + 1]], &vtx[idx[i + 2]], clip_off, clip_scale, clip))
+                    continue;
+                tri.Tex = tex;
+                bd->Triangles.push_back(tri);
+            }
+        }
+    }
+    if (bd->Triangles.Size == 0)
+        return;
+    ImGui_ImplSoftware_BinTriangles(bd);
+
+    // Tiles are handed out one at a time, the calling thread works too
+    bd->NextTile = 0;
+    {
+        std::lock_guard<std::mutex> lock(bd->Mutex);
+        bd->JobId++;
+        bd->WorkersBusy = bd->Workers.Size;
+    }
+    bd->WakeCv.notify_all();
+    ImGui_ImplSoftware_DrawTiles(bd);
+    std::unique_lock<std::mutex> lock(bd->Mutex);
+    bd->DoneCv.wait(lock, [bd] { return bd->WorkersBusy == 0; });
+}
+
+//-----------------------------------------------------------------------------
+// Textures
+//-----------------------------------------------------------------------------
+
+ImGui_ImplSoftware_Texture* ImGui_ImplSoftware_CreateTexture(const ImU32* pixels, int width, int height)
+{
+    ImGui_ImplSoftware_Texture* tex = IM_NEW(ImGui_ImplSoftware_Texture)();
+    tex->Width = width;
+    tex->Height = height;
+    tex->Pixels = (ImU32*)IM_ALLOC((size_t)width * height * sizeof(ImU32));
+    if (pixels != nullptr)
+        memcpy(tex->Pixels, pixels, (size_t)width * height * sizeof(ImU32));
+    return tex;
+}
+
+void ImGui_ImplSoftware_DestroyTexture(ImGui_ImplSoftware_Texture* tex)
+{
+    IM_FREE(tex->Pixels);
+    IM_DELETE(tex);
+}
+
+static void ImGui_ImplSoftware_CopyRect(ImTextureData* tex, ImGui_ImplSoftware_Texture* backend_tex, int x, int y, int w, int h)
+{
+    for (int row = y; row < y + h; row++)
+    {
+        ImU32* dst = backend_tex->Pixels + (size_t)row * backend_tex->Width + x;
+        if (tex->Format == ImTextureFormat_RGBA32)
+        {
+            memcpy(dst, tex->GetPixelsAt(x, row), (size_t)w * sizeof(ImU32));
+            continue;
+        }
+        const unsigned char* src = (const unsigned char*)tex->GetPixelsAt(x, row);
+        for (int n = 0; n < w; n++)
+            dst[n] = IM_COL32(255, 255, 255, src[n]);
+    }
+}
+
+static void ImGui_ImplSoftware_DestroyImGuiTexture(ImTextureData* tex)
+{
+    if (ImGui_ImplSoftware_Texture* backend_tex = (ImGui_ImplSoftware_Texture*)(intptr_t)tex->TexID)
+    {
+        ImGui_ImplSoftware_DestroyTexture(backend_tex);
+
+        // Clear identifiers and mark as destroyed (in order to allow e.g. calling InvalidateDeviceObjects while running)
+        tex->SetTexID(ImTextureID_Invalid);
+    }
+    tex->SetStatus(ImTextureStatus_Destroyed);
+}
+
+void ImGui_ImplSoftware_UpdateTexture(ImTextureData* tex)
+{
+    if (tex->Status == ImTextureStatus_WantCreate)
+    {
+        // Create and upload new texture to graphics system
+        //IMGUI_DEBUG_LOG("UpdateTexture #%03d: WantCreate %dx%d\n", tex->UniqueID, tex->Width, tex->Height);
+        IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == nullptr);
+        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32 || tex->Format == ImTextureFormat_Alpha8);
+        ImGui_ImplSoftware_Texture* backend_tex = ImGui_ImplSoftware_CreateTexture(nullptr, tex->Width, tex->Height);
+        ImGui_ImplSoftware_CopyRect(tex, backend_tex, 0, 0, tex->Width, tex->Height);
+        tex->SetTexID((ImTextureID)(intptr_t)backend_tex);
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantUpdates)
+    {
+        ImGui_ImplSoftware_Texture* backend_tex = (ImGui_ImplSoftware_Texture*)(intptr_t)tex->TexID;
+        for (const ImTextureRect& r : tex->Updates)
+            ImGui_ImplSoftware_CopyRect(tex, backend_tex, r.x, r.y, r.w, r.h);
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+        ImGui_ImplSoftware_DestroyImGuiTexture(tex);
+}
+
+//-----------------------------------------------------------------------------
+// Init, Shutdown
+//-----------------------------------------------------------------------------
+
+bool ImGui_ImplSoftware_Init(int thread_count)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
+
+    // Setup backend capabilities flags
+    ImGui_ImplSoftware_Data* bd = IM_NEW(ImGui_ImplSoftware_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_software";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;   // We can honor ImGuiPlatformIO::Textures[] requests during render.
+
+    if (thread_count <= 0)
+        thread_count = ImGui_ImplSoftware_Max((int)std::thread::hardware_concurrency(), 1);
+    for (int n = 1; n < thread_count; n++)
+        bd->Workers.push_back(new std::thread(ImGui_ImplSoftware_WorkerThread, bd));
+    return true;
+}
+
+void ImGui_ImplSoftware_Shutdown()
+{
+    ImGui_ImplSoftware_Data* bd = ImGui_ImplSoftware_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+
+    {
+        std::lock_guard<std::mutex> lock(bd->Mutex);
+        bd->Quit = true;
+    }
+    bd->WakeCv.notify_all();
+    for (std::thread* worker : bd->Workers)
+    {
+        worker->join();
+        delete worker;
+    }
+
+    // Destroy all textures
+    for (ImTextureData* tex : platform_io.Textures)
+        if (tex->RefCount == 1)
+            ImGui_ImplSoftware_DestroyImGuiTexture(tex);
+
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    platform_io.ClearRendererHandlers();
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplSoftware_NewFrame()
+{
+    ImGui_ImplSoftware_Data* bd = ImGui_ImplSoftware_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSoftware_Init()?");
+    IM_UNUSED(bd);
+}
+
+//-----------------------------------------------------------------------------
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,54 @@
+// dear imgui: Renderer Backend for a CPU rasterizer
+// This needs to be used along with a Platform Backend, or with a host program filling ImGuiIO itself (e.g. tests)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftware_Texture*' as texture identifier, see ImGui_ImplSoftware_CreateTexture(). Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Multi-threaded, by screen tiles.
+// Missing features or Issues:
+//  [ ] Renderer: No distance field text (ImGuiBackendFlags_RendererHasDistanceFieldText).
+//  [ ] Renderer: User callbacks are called while collecting triangles, before anything is drawn: they can't draw.
+
+// About this backend:
+// - Renders into a RGBA32 buffer you own (same byte order as ImTextureFormat_RGBA32), blending over its contents.
+// - Follows what the OpenGL3 backend asks of the GPU: pixel centers at .5, top-left fill rule, bilinear filtering with
+//   clamp to edge, straight alpha blending (SRC_ALPHA, ONE_MINUS_SRC_ALPHA; alpha ONE, ONE_MINUS_SRC_ALPHA), integer scissor.
+//   Results are within a few units of a GL implementation, not bit exact.
+// - Triangles are binned into 64x64 pixel tiles, which are drawn in parallel, each in submission order.
+//   The output doesn't depend on the number of threads.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+// A texture in memory, RGBA32
+struct ImGui_ImplSoftware_Texture
+{
+    int             Width;
+    int             Height;
+    ImU32*          Pixels;
+};
+
+// Follow "Getting Started" link and check examples/ folder to learn about using backends!
+IMGUI_IMPL_API bool     ImGui_ImplSoftware_Init(int thread_count = 0);   // 0: one thread per core. The calling thread counts as one.
+IMGUI_IMPL_API void     ImGui_ImplSoftware_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftware_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoftware_RenderDrawData(ImDrawData* draw_data, ImU32* pixels, int width, int height, int stride); // 'stride' in pixels
+
+// (Advanced) Use e.g. if you need to precisely control the timing of texture updates (e.g. for staged rendering), by setting ImDrawData::Textures = NULL to handle this manually.
+IMGUI_IMPL_API void     ImGui_ImplSoftware_UpdateTexture(ImTextureData* tex);
+
+// User textures: pixels are copied, use the returned pointer as ImTextureID
+IMGUI_IMPL_API ImGui_ImplSoftware_Texture* ImGui_ImplSoftware_CreateTexture(const ImU32* pixels, int width, int height);
+IMGUI_IMPL_API void     ImGui_ImplSoftware_DestroyTexture(ImGui_ImplSoftware_Texture* tex);
+
+#endif // #ifndef IMGUI_DISABLE
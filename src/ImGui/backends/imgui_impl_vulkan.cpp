@@ -0,0 +1,970 @@
+// dear imgui: Renderer Backend for Vulkan
+// This needs to be used along with a Platform Backend (e.g. GLFW, SDL, Win32, custom..)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'VkDescriptorSet' as texture identifier. Call ImGui_ImplVulkan_AddTexture() to register one. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+// Missing features or Issues:
+//  [ ] Renderer: Only ImTextureFormat_RGBA32 textures.
+//  [ ] Renderer: No distance field text (ImGuiBackendFlags_RendererHasDistanceFieldText).
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+// CHANGELOG
+//  2026-10-19: Vulkan: Initial version. Draw commands recorded into a caller provided (possibly secondary) command buffer, texture uploads
+//              recorded separately, persistently mapped per-frame buffers. SPIR-V generated from vulkan/*.vert/*.frag by vulkan/generate_spv.sh.
+//              Added InitInfo::SrgbColorAttachment and ImGui_ImplVulkan_SetPreTransform() for sRGB and pre-rotated swapchains.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_vulkan.h"
+#include <math.h>       // powf
+#include <stdio.h>
+#include <string.h>     // memcpy, memset
+
+// Visual Studio warnings
+#ifdef _MSC_VER
+#pragma warning (disable: 4127) // condition expression is constant
+#endif
+
+// Size of the descriptor pool textures are allocated from, including the ones registered by ImGui_ImplVulkan_AddTexture()
+#ifndef IMGUI_IMPL_VULKAN_MAX_TEXTURES
+#define IMGUI_IMPL_VULKAN_MAX_TEXTURES  64
+#endif
+
+// Compact vertex layout (IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT declaring 'ImDrawVertUV16 uv'): UVs are 16-bit normalized integers
+static const bool ImGui_ImplVulkan_VtxUVIsUnorm16 = (sizeof(ImDrawVert::uv) == sizeof(ImDrawVertUV16));
+
+// A host visible and coherent buffer, mapped for its whole lifetime
+struct ImGui_ImplVulkan_Buffer
+{
+    VkBuffer            Buffer;
+    VkDeviceMemory      Memory;
+    VkDeviceSize        Size;
+    void*               Mapped;
+};
+
+// Resources used by one frame in flight, reused ImageCount frames later
+struct ImGui_ImplVulkan_FrameRenderBuffers
+{
+    ImGui_ImplVulkan_Buffer             VertexBuffer;
+    ImGui_ImplVulkan_Buffer             IndexBuffer;
+    ImGui_ImplVulkan_Buffer             StagingBuffer;      // Texture uploads
+    VkDeviceSize                        StagingOffset;
+    ImVector<ImGui_ImplVulkan_Buffer>   RetiredBuffers;     // Staging buffers outgrown during the frame, copies recorded from them may still be pending
+};
+
+// Backend data attached to each ImTextureData
+struct ImGui_ImplVulkan_Texture
+{
+    VkDeviceMemory      Memory;
+    VkImage             Image;
+    VkImageView         ImageView;
+    VkDescriptorSet     DescriptorSet;
+};
+
+// Vulkan Data
+struct ImGui_ImplVulkan_Data
+{
+    ImGui_ImplVulkan_InitInfo           VulkanInitInfo;
+    VkPhysicalDeviceMemoryProperties    MemoryProperties;
+    VkDescriptorSetLayout               DescriptorSetLayout;
+    VkDescriptorPool                    DescriptorPool;
+    VkPipelineLayout                    PipelineLayout;
+    VkPipeline                          Pipeline;
+    VkSampler                           TexSampler;
+    uint32_t                            FrameIndex;
+    ImVector<ImGui_ImplVulkan_FrameRenderBuffers> Frames;
+    VkSurfaceTransformFlagBitsKHR       PreTransform;
+    unsigned char                       LinearColors[256];  // sRGB to linear, for vertex colors when InitInfo::SrgbColorAttachment is set
+
+    ImGui_ImplVulkan_Data() { memset((void*)&VulkanInitInfo, 0, sizeof(VulkanInitInfo)); memset((void*)&MemoryProperties, 0, sizeof(MemoryProperties)); DescriptorSetLayout = VK_NULL_HANDLE; DescriptorPool = VK_NULL_HANDLE; PipelineLayout = VK_NULL_HANDLE; Pipeline = VK_NULL_HANDLE; TexSampler = VK_NULL_HANDLE; FrameIndex = 0; PreTransform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR; memset(LinearColors, 0, sizeof(LinearColors)); }
+};
+
+//-----------------------------------------------------------------------------
+// SHADERS
+//-----------------------------------------------------------------------------
+
+// SPIR-V compiled from vulkan/glsl_shader.vert and vulkan/glsl_shader.frag, as comma separated 32-bit words.
+// Checked in: after changing a shader, regenerate them with vulkan/generate_spv.sh (or the 'spirv' CMake target).
+static uint32_t __glsl_shader_vert_spv[] =
+{
+#include "vulkan/glsl_shader.vert.u32"
+};
+
+static uint32_t __glsl_shader_frag_spv[] =
+{
+#include "vulkan/glsl_shader.frag.u32"
+};
+
+//-----------------------------------------------------------------------------
+// FUNCTIONS
+//-----------------------------------------------------------------------------
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+static ImGui_ImplVulkan_Data* ImGui_ImplVulkan_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplVulkan_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
+}
+
+static void check_vk_result(VkResult err)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    if (!bd)
+        return;
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    if (v->CheckVkResultFn)
+        v->CheckVkResultFn(err);
+}
+
+static uint32_t ImGui_ImplVulkan_MemoryType(VkMemoryPropertyFlags properties, uint32_t type_bits)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    const VkPhysicalDeviceMemoryProperties& prop = bd->MemoryProperties;
+    for (uint32_t i = 0; i < prop.memoryTypeCount; i++)
+        if ((prop.memoryTypes[i].propertyFlags & properties) == properties && (type_bits & (1u << i)))
+            return i;
+    return 0xFFFFFFFF; // Unable to find memoryType
+}
+
+static void ImGui_ImplVulkan_DestroyBuffer(ImGui_ImplVulkan_Buffer* buf)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    if (buf->Buffer)    { vkDestroyBuffer(v->Device, buf->Buffer, v->Allocator); buf->Buffer = VK_NULL_HANDLE; }
+    if (buf->Memory)    { vkFreeMemory(v->Device, buf->Memory, v->Allocator); buf->Memory = VK_NULL_HANDLE; } // Implicitly unmapped
+    buf->Size = 0;
+    buf->Mapped = nullptr;
+}
+
+// (Re)create a buffer in host visible and coherent memory and map it. The previous buffer must not be in use by the GPU anymore.
+static void ImGui_ImplVulkan_CreateBuffer(ImGui_ImplVulkan_Buffer* buf, VkDeviceSize size, VkBufferUsageFlags usage)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    ImGui_ImplVulkan_DestroyBuffer(buf);
+
+    VkResult err;
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = size;
+    buffer_info.usage = usage;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &buf->Buffer);
+    check_vk_result(err);
+
+    VkMemoryRequirements req;
+    vkGetBufferMemoryRequirements(v->Device, buf->Buffer, &req);
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = req.size;
+    alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, req.memoryTypeBits);
+    err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &buf->Memory);
+    check_vk_result(err);
+
+    err = vkBindBufferMemory(v->Device, buf->Buffer, buf->Memory, 0);
+    check_vk_result(err);
+    err = vkMapMemory(v->Device, buf->Memory, 0, VK_WHOLE_SIZE, 0, &buf->Mapped);
+    check_vk_result(err);
+    buf->Size = size;
+}
+
+static bool ImGui_ImplVulkan_TransformSwapsAxes(VkSurfaceTransformFlagBitsKHR transform)
+{
+    return transform == VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR || transform == VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR;
+}
+
+// 'target_width' and 'target_height': size of the image, which is the framebuffer size with width and height swapped for 90/270 degree pre-rotations
+static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkCommandBuffer command_buffer, ImGui_ImplVulkan_FrameRenderBuffers* rb, int target_width, int target_height)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+
+    // Bind pipeline
+    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->Pipeline);
+
+    // Bind Vertex And Index Buffer
+    if (draw_data->TotalVtxCount > 0)
+    {
+        VkDeviceSize vertex_offset = 0;
+        vkCmdBindVertexBuffers(command_buffer, 0, 1, &rb->VertexBuffer.Buffer, &vertex_offset);
+        vkCmdBindIndexBuffer(command_buffer, rb->IndexBuffer.Buffer, 0, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+    }
+
+    // Setup viewport
+    VkViewport viewport;
+    viewport.x = 0;
+    viewport.y = 0;
+    viewport.width = (float)target_width;
+    viewport.height = (float)target_height;
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    vkCmdSetViewport(command_buffer, 0, 1, &viewport);
+
+    // Setup scale and translation
+    // Our visible imgui space lies from draw_data->DisplayPos (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
+    float scale[2];
+    scale[0] = 2.0f / draw_data->DisplaySize.x;
+    scale[1] = 2.0f / draw_data->DisplaySize.y;
+    float translate[2];
+    translate[0] = -1.0f - draw_data->DisplayPos.x * scale[0];
+    translate[1] = -1.0f - draw_data->DisplayPos.y * scale[1];
+
+    // Pre-rotation (clockwise): for 90/270 degrees the vertices were copied with x and y swapped, so the image's x axis is the display's y axis.
+    // The image's x axis is then reversed for 90 and 180 degrees, its y axis for 180 and 270 degrees. The scissor rectangles follow in RenderDrawData().
+    const VkSurfaceTransformFlagBitsKHR transform = bd->PreTransform;
+    if (ImGui_ImplVulkan_TransformSwapsAxes(transform))
+    {
+        float tmp = scale[0]; scale[0] = scale[1]; scale[1] = tmp;
+        tmp = translate[0]; translate[0] = translate[1]; translate[1] = tmp;
+    }
+    if (transform == VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR || transform == VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR)
+    {
+        scale[0] = -scale[0];
+        translate[0] = -translate[0];
+    }
+    if (transform == VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR || transform == VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR)
+    {
+        scale[1] = -scale[1];
+        translate[1] = -translate[1];
+    }
+    vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 0, sizeof(float) * 2, scale);
+    vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 2, sizeof(float) * 2, translate);
+}
+
+// Copy vertices to the vertex buffer, with x and y swapped for 90/270 degree pre-rotations and/or colors converted to linear for an sRGB target.
+// Each vertex is assembled on the stack and written once: the mapped memory may be write-combined, reading it back would be slow.
+static void ImGui_ImplVulkan_CopyVertices(ImDrawVert* dst, const ImDrawVert* src, int count, bool swap_axes, const unsigned char* linear_colors)
+{
+    for (int i = 0; i < count; i++)
+    {
+        ImDrawVert vtx = src[i];
+        if (swap_axes)
+        {
+            const float x = vtx.pos.x;
+            vtx.pos.x = vtx.pos.y;
+            vtx.pos.y = x;
+        }
+        if (linear_colors)
+        {
+            const ImU32 col = vtx.col;
+            vtx.col = (col & IM_COL32_A_MASK) |
+                ((ImU32)linear_colors[(col >> IM_COL32_R_SHIFT) & 0xFF] << IM_COL32_R_SHIFT) |
+                ((ImU32)linear_colors[(col >> IM_COL32_G_SHIFT) & 0xFF] << IM_COL32_G_SHIFT) |
+                ((ImU32)linear_colors[(col >> IM_COL32_B_SHIFT) & 0xFF] << IM_COL32_B_SHIFT);
+        }
+        dst[i] = vtx;
+    }
+}
+
+// Render function
+void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer command_buffer)
+{
+    // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
+    int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    if (fb_width <= 0 || fb_height <= 0)
+        return;
+
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_FrameRenderBuffers* rb = &bd->Frames[bd->FrameIndex];
+    const VkSurfaceTransformFlagBitsKHR transform = bd->PreTransform;
+    const bool swap_axes = ImGui_ImplVulkan_TransformSwapsAxes(transform);
+    const int target_width = swap_axes ? fb_height : fb_width;
+    const int target_height = swap_axes ? fb_width : fb_height;
+
+    // Texture uploads can't be recorded inside a render pass: they must have been done by ImGui_ImplVulkan_UpdateTextures()
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            IM_ASSERT(tex->Status != ImTextureStatus_WantCreate && tex->Status != ImTextureStatus_WantUpdates && "Call ImGui_ImplVulkan_UpdateTextures() before ImGui_ImplVulkan_RenderDrawData()!");
+
+    if (draw_data->TotalVtxCount > 0)
+    {
+        // Grow vertex/index buffers if needed. This frame's buffers are not in use by the GPU anymore (see ImGui_ImplVulkan_NewFrame()).
+        VkDeviceSize vertex_size = (VkDeviceSize)draw_data->TotalVtxCount * sizeof(ImDrawVert);
+        VkDeviceSize index_size = (VkDeviceSize)draw_data->TotalIdxCount * sizeof(ImDrawIdx);
+        if (rb->VertexBuffer.Size < vertex_size)
+            ImGui_ImplVulkan_CreateBuffer(&rb->VertexBuffer, vertex_size + 5000 * sizeof(ImDrawVert), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+        if (rb->IndexBuffer.Size < index_size)
+            ImGui_ImplVulkan_CreateBuffer(&rb->IndexBuffer, index_size + 10000 * sizeof(ImDrawIdx), VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+
+        // Write straight into the mapped memory, coherent so no flush is needed
+        ImDrawVert* vtx_dst = (ImDrawVert*)rb->VertexBuffer.Mapped;
+        ImDrawIdx* idx_dst = (ImDrawIdx*)rb->IndexBuffer.Mapped;
+        const unsigned char* linear_colors = bd->VulkanInitInfo.SrgbColorAttachment ? bd->LinearColors : nullptr;
+        for (const ImDrawList* draw_list : draw_data->CmdLists)
+        {
+            if (swap_axes || linear_colors)
+                ImGui_ImplVulkan_CopyVertices(vtx_dst, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size, swap_axes, linear_colors);
+            else
+                memcpy(vtx_dst, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+            memcpy(idx_dst, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+            vtx_dst += draw_list->VtxBuffer.Size;
+            idx_dst += draw_list->IdxBuffer.Size;
+        }
+    }
+
+    // Setup desired Vulkan state
+    ImGui_ImplVulkan_SetupRenderState(draw_data, command_buffer, rb, target_width, target_height);
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // Render command lists
+    // (Because we merged all buffers into a single one, we maintain our own offset into them)
+    VkDescriptorSet last_desc_set = VK_NULL_HANDLE;
+    int global_vtx_offset = 0;
+    int global_idx_offset = 0;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                    ImGui_ImplVulkan_SetupRenderState(draw_data, command_buffer, rb, target_width, target_height);
+                else
+                    pcmd->UserCallback(draw_list, pcmd);
+                last_desc_set = VK_NULL_HANDLE;
+            }
+            else
+            {
+                // Project scissor/clipping rectangles into framebuffer space
+                ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+                ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+
+                // Clamp to viewport as vkCmdSetScissor() won't accept values that are off bounds
+                if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
+                if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
+                if (clip_max.x > fb_width) { clip_max.x = (float)fb_width; }
+                if (clip_max.y > fb_height) { clip_max.y = (float)fb_height; }
+                if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                    continue;
+
+                // Rotate into the image (see ImGui_ImplVulkan_SetupRenderState())
+                if (transform == VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR)
+                {
+                    const ImVec2 min(fb_height - clip_max.y, clip_min.x), max(fb_height - clip_min.y, clip_max.x);
+                    clip_min = min; clip_max = max;
+                }
+                else if (transform == VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR)
+                {
+                    const ImVec2 min(fb_width - clip_max.x, fb_height - clip_max.y), max(fb_width - clip_min.x, fb_height - clip_min.y);
+                    clip_min = min; clip_max = max;
+                }
+                else if (transform == VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR)
+                {
+                    const ImVec2 min(clip_min.y, fb_width - clip_max.x), max(clip_max.y, fb_width - clip_min.x);
+                    clip_min = min; clip_max = max;
+                }
+
+                // Apply scissor/clipping rectangle
+                VkRect2D scissor;
+                scissor.offset.x = (int32_t)(clip_min.x);
+                scissor.offset.y = (int32_t)(clip_min.y);
+                scissor.extent.width = (uint32_t)(clip_max.x - clip_min.x);
+                scissor.extent.height = (uint32_t)(clip_max.y - clip_min.y);
+                vkCmdSetScissor(command_buffer, 0, 1, &scissor);
+
+                // Bind DescriptorSet with font or user texture
+                VkDescriptorSet desc_set = (VkDescriptorSet)pcmd->GetTexID();
+                if (desc_set != last_desc_set)
+                    vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, &desc_set, 0, nullptr);
+                last_desc_set = desc_set;
+
+                // Draw
+                vkCmdDrawIndexed(command_buffer, pcmd->ElemCount, 1, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset, 0);
+            }
+        }
+        global_idx_offset += draw_list->IdxBuffer.Size;
+        global_vtx_offset += draw_list->VtxBuffer.Size;
+    }
+
+    // Note: at this point both vkCmdSetViewport() and vkCmdSetScissor() have been called.
+    // Our last values will leak into user/application rendering IF:
+    // - Your app uses a pipeline with VK_DYNAMIC_STATE_VIEWPORT or VK_DYNAMIC_STATE_SCISSOR dynamic state
+    // - And you forgot to call vkCmdSetViewport() and vkCmdSetScissor() yourself to explicitly set that state.
+    // If you use VK_DYNAMIC_STATE_VIEWPORT or VK_DYNAMIC_STATE_SCISSOR you are responsible for setting the values before rendering.
+    // In theory we should aim to backup/restore those values but I am not sure this is possible.
+    // We perform a call to vkCmdSetScissor() to set back a full viewport which is likely to fix things for 99% users but technically this is not perfect. (See github #4644)
+    VkRect2D scissor = { { 0, 0 }, { (uint32_t)target_width, (uint32_t)target_height } };
+    vkCmdSetScissor(command_buffer, 0, 1, &scissor);
+}
+
+void ImGui_ImplVulkan_UpdateTextures(ImDrawData* draw_data, VkCommandBuffer command_buffer)
+{
+    // Catch up with texture updates. Most of the times, the list will have 1 element with an OK status, aka nothing to do.
+    // (This almost always points to ImGui::GetPlatformIO().Textures[] but is part of ImDrawData to allow overriding or disabling texture updates).
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                ImGui_ImplVulkan_UpdateTexture(tex, command_buffer);
+}
+
+static void ImGui_ImplVulkan_DestroyTexture(ImTextureData* tex)
+{
+    if (ImGui_ImplVulkan_Texture* backend_tex = (ImGui_ImplVulkan_Texture*)tex->BackendUserData)
+    {
+        IM_ASSERT(backend_tex->DescriptorSet == (VkDescriptorSet)tex->TexID);
+        ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+        ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+        ImGui_ImplVulkan_RemoveTexture(backend_tex->DescriptorSet);
+        vkDestroyImageView(v->Device, backend_tex->ImageView, v->Allocator);
+        vkDestroyImage(v->Device, backend_tex->Image, v->Allocator);
+        vkFreeMemory(v->Device, backend_tex->Memory, v->Allocator);
+        IM_DELETE(backend_tex);
+
+        // Clear identifiers and mark as destroyed (in order to allow e.g. calling InvalidateDeviceObjects while running)
+        tex->SetTexID(ImTextureID_Invalid);
+        tex->BackendUserData = nullptr;
+    }
+    tex->SetStatus(ImTextureStatus_Destroyed);
+}
+
+// Reserve room for an upload in this frame's staging buffer. If it doesn't fit, the buffer is replaced by a bigger one,
+// the old one is kept alive until this frame comes around again since copies recorded from it may still be pending.
+static void* ImGui_ImplVulkan_AllocStaging(VkDeviceSize size, VkBuffer* out_buffer, VkDeviceSize* out_offset)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_FrameRenderBuffers* rb = &bd->Frames[bd->FrameIndex];
+    VkDeviceSize offset = (rb->StagingOffset + 15) & ~(VkDeviceSize)15; // vkCmdCopyBufferToImage() wants a multiple of the texel size
+    if (offset + size > rb->StagingBuffer.Size)
+    {
+        VkDeviceSize new_size = rb->StagingBuffer.Size * 2;
+        if (new_size < size)
+            new_size = size;
+        if (new_size < 64 * 1024)
+            new_size = 64 * 1024;
+        if (rb->StagingBuffer.Buffer != VK_NULL_HANDLE)
+        {
+            rb->RetiredBuffers.push_back(rb->StagingBuffer);
+            memset(&rb->StagingBuffer, 0, sizeof(rb->StagingBuffer));
+        }
+        ImGui_ImplVulkan_CreateBuffer(&rb->StagingBuffer, new_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+        offset = 0;
+    }
+    rb->StagingOffset = offset + size;
+    *out_buffer = rb->StagingBuffer.Buffer;
+    *out_offset = offset;
+    return (char*)rb->StagingBuffer.Mapped + offset;
+}
+
+static void ImGui_ImplVulkan_ImageBarrier(VkCommandBuffer command_buffer, VkImage image, VkImageLayout old_layout, VkImageLayout new_layout, VkAccessFlags src_access, VkAccessFlags dst_access, VkPipelineStageFlags src_stage, VkPipelineStageFlags dst_stage)
+{
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask = src_access;
+    barrier.dstAccessMask = dst_access;
+    barrier.oldLayout = old_layout;
+    barrier.newLayout = new_layout;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.layerCount = 1;
+    vkCmdPipelineBarrier(command_buffer, src_stage, dst_stage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+}
+
+void ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex, VkCommandBuffer command_buffer)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    VkResult err;
+
+    if (tex->Status == ImTextureStatus_WantCreate)
+    {
+        // Create and upload new texture to graphics system
+        //IMGUI_DEBUG_LOG("UpdateTexture #%03d: WantCreate %dx%d\n", tex->UniqueID, tex->Width, tex->Height);
+        IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == nullptr);
+        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32);
+        ImGui_ImplVulkan_Texture* backend_tex = IM_NEW(ImGui_ImplVulkan_Texture)();
+        const VkFormat tex_format = v->SrgbColorAttachment ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM; // Sampled as linear to match the vertex colors
+
+        // Create the Image
+        {
+            VkImageCreateInfo info = {};
+            info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+            info.imageType = VK_IMAGE_TYPE_2D;
+            info.format = tex_format;
+            info.extent.width = tex->Width;
+            info.extent.height = tex->Height;
+            info.extent.depth = 1;
+            info.mipLevels = 1;
+            info.arrayLayers = 1;
+            info.samples = VK_SAMPLE_COUNT_1_BIT;
+            info.tiling = VK_IMAGE_TILING_OPTIMAL;
+            info.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+            info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+            info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            err = vkCreateImage(v->Device, &info, v->Allocator, &backend_tex->Image);
+            check_vk_result(err);
+            VkMemoryRequirements req;
+            vkGetImageMemoryRequirements(v->Device, backend_tex->Image, &req);
+            VkMemoryAllocateInfo alloc_info = {};
+            alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+            alloc_info.allocationSize = req.size;
+            alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, req.memoryTypeBits);
+            if (alloc_info.memoryTypeIndex == 0xFFFFFFFF)
+                alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(0, req.memoryTypeBits);
+            err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &backend_tex->Memory);
+            check_vk_result(err);
+            err = vkBindImageMemory(v->Device, backend_tex->Image, backend_tex->Memory, 0);
+            check_vk_result(err);
+        }
+
+        // Create the Image View
+        {
+            VkImageViewCreateInfo info = {};
+            info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+            info.image = backend_tex->Image;
+            info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+            info.format = tex_format;
+            info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            info.subresourceRange.levelCount = 1;
+            info.subresourceRange.layerCount = 1;
+            err = vkCreateImageView(v->Device, &info, v->Allocator, &backend_tex->ImageView);
+            check_vk_result(err);
+        }
+
+        // Create the Descriptor Set
+        backend_tex->DescriptorSet = ImGui_ImplVulkan_AddTexture(bd->TexSampler, backend_tex->ImageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+        // Upload the whole texture
+        const int upload_pitch = tex->Width * tex->BytesPerPixel;
+        VkBuffer staging_buffer;
+        VkDeviceSize staging_offset;
+        char* staging = (char*)ImGui_ImplVulkan_AllocStaging((VkDeviceSize)upload_pitch * tex->Height, &staging_buffer, &staging_offset);
+        for (int y = 0; y < tex->Height; y++)
+            memcpy(staging + upload_pitch * y, tex->GetPixelsAt(0, y), upload_pitch);
+
+        ImGui_ImplVulkan_ImageBarrier(command_buffer, backend_tex->Image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+        VkBufferImageCopy region = {};
+        region.bufferOffset = staging_offset;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.layerCount = 1;
+        region.imageExtent.width = tex->Width;
+        region.imageExtent.height = tex->Height;
+        region.imageExtent.depth = 1;
+        vkCmdCopyBufferToImage(command_buffer, staging_buffer, backend_tex->Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+        ImGui_ImplVulkan_ImageBarrier(command_buffer, backend_tex->Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+
+        // Store identifiers
+        tex->SetTexID((ImTextureID)backend_tex->DescriptorSet);
+        tex->BackendUserData = backend_tex;
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantUpdates)
+    {
+        // Update selected blocks. We only ever write to textures regions which have never been used before!
+        // All blocks are packed in the staging buffer and copied with a single command.
+        ImGui_ImplVulkan_Texture* backend_tex = (ImGui_ImplVulkan_Texture*)tex->BackendUserData;
+        VkDeviceSize upload_size = 0;
+        for (ImTextureRect& r : tex->Updates)
+            upload_size += (VkDeviceSize)r.w * r.h * tex->BytesPerPixel;
+        VkBuffer staging_buffer;
+        VkDeviceSize staging_offset;
+        char* staging = (char*)ImGui_ImplVulkan_AllocStaging(upload_size, &staging_buffer, &staging_offset);
+
+        ImVector<VkBufferImageCopy> regions;
+        regions.resize(tex->Updates.Size);
+        VkBufferImageCopy* region = regions.Data;
+        for (ImTextureRect& r : tex->Updates)
+        {
+            const int upload_pitch = r.w * tex->BytesPerPixel;
+            memset(region, 0, sizeof(*region));
+            region->bufferOffset = staging_offset;
+            region->imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region->imageSubresource.layerCount = 1;
+            region->imageOffset.x = r.x;
+            region->imageOffset.y = r.y;
+            region->imageExtent.width = r.w;
+            region->imageExtent.height = r.h;
+            region->imageExtent.depth = 1;
+            for (int y = 0; y < r.h; y++, staging += upload_pitch)
+                memcpy(staging, tex->GetPixelsAt(r.x, r.y + y), upload_pitch);
+            staging_offset += (VkDeviceSize)upload_pitch * r.h;
+            region++;
+        }
+
+        // Previous frames may still be sampling the texture: only an execution dependency is needed before overwriting unused regions
+        ImGui_ImplVulkan_ImageBarrier(command_buffer, backend_tex->Image, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+        vkCmdCopyBufferToImage(command_buffer, staging_buffer, backend_tex->Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (uint32_t)regions.Size, regions.Data);
+        ImGui_ImplVulkan_ImageBarrier(command_buffer, backend_tex->Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames >= (int)v->ImageCount)
+    {
+        // Frames still in flight may be using it until then
+        ImGui_ImplVulkan_DestroyTexture(tex);
+    }
+}
+
+VkDescriptorSet ImGui_ImplVulkan_AddTexture(VkSampler sampler, VkImageView image_view, VkImageLayout image_layout)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+
+    // Create Descriptor Set
+    VkDescriptorSet descriptor_set;
+    {
+        VkDescriptorSetAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        alloc_info.descriptorPool = bd->DescriptorPool;
+        alloc_info.descriptorSetCount = 1;
+        alloc_info.pSetLayouts = &bd->DescriptorSetLayout;
+        VkResult err = vkAllocateDescriptorSets(v->Device, &alloc_info, &descriptor_set);
+        check_vk_result(err);
+    }
+
+    // Update the Descriptor Set
+    {
+        VkDescriptorImageInfo desc_image[1] = {};
+        desc_image[0].sampler = sampler;
+        desc_image[0].imageView = image_view;
+        desc_image[0].imageLayout = image_layout;
+        VkWriteDescriptorSet write_desc[1] = {};
+        write_desc[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write_desc[0].dstSet = descriptor_set;
+        write_desc[0].descriptorCount = 1;
+        write_desc[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write_desc[0].pImageInfo = desc_image;
+        vkUpdateDescriptorSets(v->Device, 1, write_desc, 0, nullptr);
+    }
+    return descriptor_set;
+}
+
+void ImGui_ImplVulkan_RemoveTexture(VkDescriptorSet descriptor_set)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    vkFreeDescriptorSets(v->Device, bd->DescriptorPool, 1, &descriptor_set);
+}
+
+static bool ImGui_ImplVulkan_CreateShaderModule(const uint32_t* code, size_t code_size, VkShaderModule* out_module)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    VkShaderModuleCreateInfo info = {};
+    info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    info.codeSize = code_size;
+    info.pCode = code;
+    VkResult err = vkCreateShaderModule(v->Device, &info, v->Allocator, out_module);
+    check_vk_result(err);
+    return err == VK_SUCCESS;
+}
+
+static bool ImGui_ImplVulkan_CreateDeviceObjects()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    VkResult err;
+
+    // Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling.
+    {
+        VkSamplerCreateInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        info.magFilter = VK_FILTER_LINEAR;
+        info.minFilter = VK_FILTER_LINEAR;
+        info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+        info.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        info.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        info.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        info.minLod = -1000;
+        info.maxLod = 1000;
+        info.maxAnisotropy = 1.0f;
+        err = vkCreateSampler(v->Device, &info, v->Allocator, &bd->TexSampler);
+        check_vk_result(err);
+        if (err != VK_SUCCESS)
+            return false;
+    }
+
+    {
+        VkDescriptorSetLayoutBinding binding[1] = {};
+        binding[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        binding[0].descriptorCount = 1;
+        binding[0].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        VkDescriptorSetLayoutCreateInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        info.bindingCount = 1;
+        info.pBindings = binding;
+        err = vkCreateDescriptorSetLayout(v->Device, &info, v->Allocator, &bd->DescriptorSetLayout);
+        check_vk_result(err);
+        if (err != VK_SUCCESS)
+            return false;
+    }
+
+    {
+        VkDescriptorPoolSize pool_size = { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, IMGUI_IMPL_VULKAN_MAX_TEXTURES };
+        VkDescriptorPoolCreateInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+        info.maxSets = IMGUI_IMPL_VULKAN_MAX_TEXTURES;
+        info.poolSizeCount = 1;
+        info.pPoolSizes = &pool_size;
+        err = vkCreateDescriptorPool(v->Device, &info, v->Allocator, &bd->DescriptorPool);
+        check_vk_result(err);
+        if (err != VK_SUCCESS)
+            return false;
+    }
+
+    {
+        // Constants: we are using 'vec2 offset' and 'vec2 scale' instead of a full 3d projection matrix
+        VkPushConstantRange push_constants[1] = {};
+        push_constants[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        push_constants[0].offset = sizeof(float) * 0;
+        push_constants[0].size = sizeof(float) * 4;
+        VkDescriptorSetLayout set_layout[1] = { bd->DescriptorSetLayout };
+        VkPipelineLayoutCreateInfo layout_info = {};
+        layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        layout_info.setLayoutCount = 1;
+        layout_info.pSetLayouts = set_layout;
+        layout_info.pushConstantRangeCount = 1;
+        layout_info.pPushConstantRanges = push_constants;
+        err = vkCreatePipelineLayout(v->Device, &layout_info, v->Allocator, &bd->PipelineLayout);
+        check_vk_result(err);
+        if (err != VK_SUCCESS)
+            return false;
+    }
+
+    // Create the pipeline
+    VkShaderModule vert_module = VK_NULL_HANDLE, frag_module = VK_NULL_HANDLE;
+    if (!ImGui_ImplVulkan_CreateShaderModule(__glsl_shader_vert_spv, sizeof(__glsl_shader_vert_spv), &vert_module) ||
+        !ImGui_ImplVulkan_CreateShaderModule(__glsl_shader_frag_spv, sizeof(__glsl_shader_frag_spv), &frag_module))
+    {
+        if (vert_module) vkDestroyShaderModule(v->Device, vert_module, v->Allocator);
+        return false;
+    }
+
+    VkPipelineShaderStageCreateInfo stage[2] = {};
+    stage[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stage[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stage[0].module = vert_module;
+    stage[0].pName = "main";
+    stage[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stage[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    stage[1].module = frag_module;
+    stage[1].pName = "main";
+
+    VkVertexInputBindingDescription binding_desc[1] = {};
+    binding_desc[0].stride = sizeof(ImDrawVert);
+    binding_desc[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+    VkVertexInputAttributeDescription attribute_desc[3] = {};
+    attribute_desc[0].location = 0;
+    attribute_desc[0].binding = binding_desc[0].binding;
+    attribute_desc[0].format = VK_FORMAT_R32G32_SFLOAT;
+    attribute_desc[0].offset = offsetof(ImDrawVert, pos);
+    attribute_desc[1].location = 1;
+    attribute_desc[1].binding = binding_desc[0].binding;
+    attribute_desc[1].format = ImGui_ImplVulkan_VtxUVIsUnorm16 ? VK_FORMAT_R16G16_UNORM : VK_FORMAT_R32G32_SFLOAT;
+    attribute_desc[1].offset = offsetof(ImDrawVert, uv);
+    attribute_desc[2].location = 2;
+    attribute_desc[2].binding = binding_desc[0].binding;
+    attribute_desc[2].format = VK_FORMAT_R8G8B8A8_UNORM;
+    attribute_desc[2].offset = offsetof(ImDrawVert, col);
+
+    VkPipelineVertexInputStateCreateInfo vertex_info = {};
+    vertex_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertex_info.vertexBindingDescriptionCount = 1;
+    vertex_info.pVertexBindingDescriptions = binding_desc;
+    vertex_info.vertexAttributeDescriptionCount = 3;
+    vertex_info.pVertexAttributeDescriptions = attribute_desc;
+
+    VkPipelineInputAssemblyStateCreateInfo ia_info = {};
+    ia_info.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    ia_info.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    VkPipelineViewportStateCreateInfo viewport_info = {};
+    viewport_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewport_info.viewportCount = 1;
+    viewport_info.scissorCount = 1;
+
+    VkPipelineRasterizationStateCreateInfo raster_info = {};
+    raster_info.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    raster_info.polygonMode = VK_POLYGON_MODE_FILL;
+    raster_info.cullMode = VK_CULL_MODE_NONE;
+    raster_info.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    raster_info.lineWidth = 1.0f;
+
+    VkPipelineMultisampleStateCreateInfo ms_info = {};
+    ms_info.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    ms_info.rasterizationSamples = v->MSAASamples;
+
+    // Same blending as the OpenGL backend
+    VkPipelineColorBlendAttachmentState color_attachment[1] = {};
+    color_attachment[0].blendEnable = VK_TRUE;
+    color_attachment[0].srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+    color_attachment[0].dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    color_attachment[0].colorBlendOp = VK_BLEND_OP_ADD;
+    color_attachment[0].srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+    color_attachment[0].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    color_attachment[0].alphaBlendOp = VK_BLEND_OP_ADD;
+    color_attachment[0].colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+    VkPipelineDepthStencilStateCreateInfo depth_info = {};
+    depth_info.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+
+    VkPipelineColorBlendStateCreateInfo blend_info = {};
+    blend_info.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    blend_info.attachmentCount = 1;
+    blend_info.pAttachments = color_attachment;
+
+    VkDynamicState dynamic_states[2] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+    VkPipelineDynamicStateCreateInfo dynamic_state = {};
+    dynamic_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamic_state.dynamicStateCount = (uint32_t)IM_ARRAYSIZE(dynamic_states);
+    dynamic_state.pDynamicStates = dynamic_states;
+
+    VkGraphicsPipelineCreateInfo info = {};
+    info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    info.stageCount = 2;
+    info.pStages = stage;
+    info.pVertexInputState = &vertex_info;
+    info.pInputAssemblyState = &ia_info;
+    info.pViewportState = &viewport_info;
+    info.pRasterizationState = &raster_info;
+    info.pMultisampleState = &ms_info;
+    info.pDepthStencilState = &depth_info;
+    info.pColorBlendState = &blend_info;
+    info.pDynamicState = &dynamic_state;
+    info.layout = bd->PipelineLayout;
+    info.renderPass = v->RenderPass;
+    info.subpass = 0;
+    err = vkCreateGraphicsPipelines(v->Device, VK_NULL_HANDLE, 1, &info, v->Allocator, &bd->Pipeline);
+    check_vk_result(err);
+    vkDestroyShaderModule(v->Device, vert_module, v->Allocator);
+    vkDestroyShaderModule(v->Device, frag_module, v->Allocator);
+    return err == VK_SUCCESS;
+}
+
+static void ImGui_ImplVulkan_DestroyDeviceObjects()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+
+    // Destroy all textures
+    if (bd->DescriptorPool)
+        for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+            if (tex->RefCount == 1)
+                ImGui_ImplVulkan_DestroyTexture(tex);
+
+    for (ImGui_ImplVulkan_FrameRenderBuffers& rb : bd->Frames)
+    {
+        ImGui_ImplVulkan_DestroyBuffer(&rb.VertexBuffer);
+        ImGui_ImplVulkan_DestroyBuffer(&rb.IndexBuffer);
+        ImGui_ImplVulkan_DestroyBuffer(&rb.StagingBuffer);
+        for (ImGui_ImplVulkan_Buffer& buf : rb.RetiredBuffers)
+            ImGui_ImplVulkan_DestroyBuffer(&buf);
+        rb.RetiredBuffers.clear();
+    }
+
+    if (bd->Pipeline)               { vkDestroyPipeline(v->Device, bd->Pipeline, v->Allocator); bd->Pipeline = VK_NULL_HANDLE; }
+    if (bd->PipelineLayout)         { vkDestroyPipelineLayout(v->Device, bd->PipelineLayout, v->Allocator); bd->PipelineLayout = VK_NULL_HANDLE; }
+    if (bd->DescriptorPool)         { vkDestroyDescriptorPool(v->Device, bd->DescriptorPool, v->Allocator); bd->DescriptorPool = VK_NULL_HANDLE; }
+    if (bd->DescriptorSetLayout)    { vkDestroyDescriptorSetLayout(v->Device, bd->DescriptorSetLayout, v->Allocator); bd->DescriptorSetLayout = VK_NULL_HANDLE; }
+    if (bd->TexSampler)             { vkDestroySampler(v->Device, bd->TexSampler, v->Allocator); bd->TexSampler = VK_NULL_HANDLE; }
+}
+
+bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
+    IM_ASSERT(info->PhysicalDevice != VK_NULL_HANDLE);
+    IM_ASSERT(info->Device != VK_NULL_HANDLE);
+    IM_ASSERT(info->RenderPass != VK_NULL_HANDLE);
+    IM_ASSERT(info->ImageCount >= 1);
+
+    // Setup backend capabilities flags
+    ImGui_ImplVulkan_Data* bd = IM_NEW(ImGui_ImplVulkan_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_vulkan";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;   // We can honor ImGuiPlatformIO::Textures[] requests during render.
+
+    bd->VulkanInitInfo = *info;
+    if (bd->VulkanInitInfo.MSAASamples == 0)
+        bd->VulkanInitInfo.MSAASamples = VK_SAMPLE_COUNT_1_BIT;
+    vkGetPhysicalDeviceMemoryProperties(info->PhysicalDevice, &bd->MemoryProperties);
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(info->PhysicalDevice, &properties);
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    platform_io.Renderer_TextureMaxWidth = platform_io.Renderer_TextureMaxHeight = (int)properties.limits.maxImageDimension2D;
+
+    bd->Frames.resize((int)info->ImageCount);
+    for (ImGui_ImplVulkan_FrameRenderBuffers& rb : bd->Frames)
+        IM_PLACEMENT_NEW(&rb) ImGui_ImplVulkan_FrameRenderBuffers();
+    for (int i = 0; i < 256; i++)
+    {
+        const float c = i / 255.0f;
+        const float linear = (c <= 0.04045f) ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+        bd->LinearColors[i] = (unsigned char)(linear * 255.0f + 0.5f);
+    }
+
+    if (!ImGui_ImplVulkan_CreateDeviceObjects())
+    {
+        ImGui_ImplVulkan_Shutdown();
+        return false;
+    }
+    return true;
+}
+
+void ImGui_ImplVulkan_Shutdown()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+
+    ImGui_ImplVulkan_DestroyDeviceObjects();
+    for (ImGui_ImplVulkan_FrameRenderBuffers& rb : bd->Frames)
+        rb.~ImGui_ImplVulkan_FrameRenderBuffers();
+    bd->Frames.clear();
+
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    platform_io.ClearRendererHandlers();
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplVulkan_NewFrame()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplVulkan_Init()?");
+
+    // The GPU is done with the previous use of this frame's buffers: release staging buffers it may have been copying from
+    bd->FrameIndex = (bd->FrameIndex + 1) % bd->VulkanInitInfo.ImageCount;
+    ImGui_ImplVulkan_FrameRenderBuffers* rb = &bd->Frames[bd->FrameIndex];
+    for (ImGui_ImplVulkan_Buffer& buf : rb->RetiredBuffers)
+        ImGui_ImplVulkan_DestroyBuffer(&buf);
+    rb->RetiredBuffers.clear();
+    rb->StagingOffset = 0;
+}
+
+void ImGui_ImplVulkan_SetPreTransform(VkSurfaceTransformFlagBitsKHR transform)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplVulkan_Init()?");
+    IM_ASSERT((transform == VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR || transform == VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR ||
+               transform == VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR || transform == VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR) && "Only rotations are supported!");
+    bd->PreTransform = transform;
+}
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,79 @@
+// dear imgui: Renderer Backend for Vulkan
+// This needs to be used along with a Platform Backend (e.g. GLFW, SDL, Win32, custom..)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'VkDescriptorSet' as texture identifier. Call ImGui_ImplVulkan_AddTexture() to register one. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+// Missing features or Issues:
+//  [ ] Renderer: Only ImTextureFormat_RGBA32 textures.
+//  [ ] Renderer: No distance field text (ImGuiBackendFlags_RendererHasDistanceFieldText).
+
+// About this backend:
+// - Draw commands are recorded into a command buffer you provide, which may be a secondary command buffer
+//   inheriting the render pass given at init. Nothing is submitted by the backend.
+// - Texture uploads are recorded separately, outside of any render pass, by ImGui_ImplVulkan_UpdateTextures().
+// - Vertex, index and staging buffers are host visible and coherent, mapped once and kept mapped.
+//   There is one set per frame in flight (InitInfo::ImageCount), selected by ImGui_ImplVulkan_NewFrame().
+//   Before calling ImGui_ImplVulkan_NewFrame(), you must have waited for the GPU to finish the command buffers
+//   recorded ImageCount frames ago. The same applies to textures, which are destroyed ImageCount frames after
+//   ImGui stops using them.
+// - sRGB render targets (InitInfo::SrgbColorAttachment): textures are created with an sRGB format and vertex colors are
+//   converted to linear while copied to the vertex buffer, so the UI comes out as on a UNORM target. Blending happens in
+//   linear space though, and the darkest tones lose precision through the 8-bit vertex colors.
+// - Pre-rotated swapchains (ImGui_ImplVulkan_SetPreTransform()): the draw data stays in the display's orientation and is
+//   rotated into the image, by swapping x and y while copying the vertices and flipping the projection's axes.
+// - The shaders are compiled from vulkan/glsl_shader.vert and vulkan/glsl_shader.frag into the checked in vulkan/*.u32,
+//   see vulkan/generate_spv.sh.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+#include <vulkan/vulkan.h>
+
+// Initialization data, for ImGui_ImplVulkan_Init()
+// [Please zero-clear before use!]
+struct ImGui_ImplVulkan_InitInfo
+{
+    VkPhysicalDevice                PhysicalDevice;
+    VkDevice                        Device;
+    VkRenderPass                    RenderPass;         // Render pass RenderDrawData() is called in, subpass 0. Only its attachment formats and sample count matter.
+    uint32_t                        ImageCount;         // >= 1, number of frames in flight
+    VkSampleCountFlagBits           MSAASamples;        // 0 defaults to VK_SAMPLE_COUNT_1_BIT
+
+    // (Optional)
+    bool                            SrgbColorAttachment;    // The render pass's color attachment has an sRGB format, see "About this backend" above
+    const VkAllocationCallbacks*    Allocator;
+    void                            (*CheckVkResultFn)(VkResult err);
+};
+
+// Follow "Getting Started" link and check examples/ folder to learn about using backends!
+IMGUI_IMPL_API bool             ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info);
+IMGUI_IMPL_API void             ImGui_ImplVulkan_Shutdown();     // The GPU must be done with every command buffer recorded by the backend.
+IMGUI_IMPL_API void             ImGui_ImplVulkan_NewFrame();
+IMGUI_IMPL_API void             ImGui_ImplVulkan_UpdateTextures(ImDrawData* draw_data, VkCommandBuffer command_buffer); // Outside of a render pass, before the command buffer RenderDrawData() records into is executed.
+IMGUI_IMPL_API void             ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer command_buffer);
+
+// Swapchain pre-rotation (VkSwapchainCreateInfoKHR::preTransform) of the images RenderDrawData() draws on: the draw data's display
+// and framebuffer sizes are in the display's orientation, i.e. width and height swapped with the image's for 90/270 degrees.
+// Only the identity and the 90/180/270 degree rotations, no mirroring.
+IMGUI_IMPL_API void             ImGui_ImplVulkan_SetPreTransform(VkSurfaceTransformFlagBitsKHR transform);
+
+// (Advanced) Use e.g. if you need to precisely control the timing of texture updates (e.g. for staged rendering), by setting ImDrawData::Textures = NULL to handle this manually.
+IMGUI_IMPL_API void             ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex, VkCommandBuffer command_buffer);
+
+// Register a texture for use as ImTextureID. The image must be in 'image_layout' when the draw commands are executed.
+// (Destroy with ImGui_ImplVulkan_RemoveTexture() once the GPU is done with the draw commands using it)
+IMGUI_IMPL_API VkDescriptorSet  ImGui_ImplVulkan_AddTexture(VkSampler sampler, VkImageView image_view, VkImageLayout image_layout);
+IMGUI_IMPL_API void             ImGui_ImplVulkan_RemoveTexture(VkDescriptorSet descriptor_set);
+
+#endif // #ifndef IMGUI_DISABLE
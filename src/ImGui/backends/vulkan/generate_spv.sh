@@ -0,0 +1,20 @@
+#!/bin/sh
+## Compiles the shaders of imgui_impl_vulkan.cpp to SPIR-V, as text files of comma separated 32-bit words it #includes.
+## The .u32 files are checked in next to this script: run it after changing a shader and commit them with it.
+##   sh src/ImGui/backends/vulkan/generate_spv.sh [out_dir]
+## Uses $GLSLC if set (the CMake 'spirv' target passes the NDK's), else glslc or glslangValidator from the PATH.
+set -e
+dir=$(dirname "$0")
+out=${1:-$dir}
+mkdir -p "$out"
+if [ -z "$GLSLC" ] && command -v glslc >/dev/null 2>&1; then
+    GLSLC=glslc
+fi
+for shader in glsl_shader.vert glsl_shader.frag; do
+    if [ -n "$GLSLC" ]; then
+        "$GLSLC" -mfmt=num -o "$out/$shader.u32" "$dir/$shader"
+    else
+        ## -V: create SPIR-V binary, -x: save it as text-based 32-bit hexadecimal numbers
+        glslangValidator -V -x -o "$out/$shader.u32" "$dir/$shader"
+    fi
+done
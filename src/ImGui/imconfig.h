@@ -66,6 +66,10 @@
 //---- Use legacy CRC32-adler tables (used before 1.91.6), in order to preserve old .ini data that you cannot afford to invalidate.
 //#define IMGUI_USE_LEGACY_CRC32_ADLER
 
+//---- Use an open-addressing hash index for ImGuiStorage (tree node open states, table settings, window state...) instead of a sorted vector.
+// Lookups stay O(1) and insertions become O(1) amortized, at the cost of an extra int per slot. Pairs are then kept in insertion order.
+//#define IMGUI_STORAGE_HASHED
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support Unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
@@ -120,6 +124,11 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 16 bytes ImDrawVert (default is 20 bytes): UVs are stored as 16-bit normalized integers (see ImDrawVertUV16).
+// Positions stay 32-bit floats: sub-pixel precision is needed for anti-aliasing, and shapes may extend far off-screen.
+// Your renderer backend will need to support it (the OpenGL3 and Vulkan backends do). Not compatible with ImFontFlags_DistanceField.
+//#define IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT struct ImDrawVert { ImVec2 pos; ImDrawVertUV16 uv; ImU32 col; }
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -2288,7 +2288,7 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
     }
 }
 
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
+#ifndef IMGUI_ENABLE_HW_CRC32
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -2334,6 +2334,24 @@ static const ImU32 GCrc32LookupTable[256] =
 };
 #endif
 
+#ifdef IMGUI_ENABLE_HW_CRC32
+// Hardware CRC32 steps, byte-for-byte identical to the table version (little-endian words)
+#if defined(IMGUI_ENABLE_ARM_CRC32) && defined(IMGUI_USE_LEGACY_CRC32_ADLER)
+static inline ImU32 ImCrc32U8(ImU32 crc, unsigned char v)   { return __crc32b(crc, v); }
+static inline ImU32 ImCrc32U64(ImU32 crc, ImU64 v)          { return __crc32d(crc, v); }
+#elif defined(IMGUI_ENABLE_ARM_CRC32)
+static inline ImU32 ImCrc32U8(ImU32 crc, unsigned char v)   { return __crc32cb(crc, v); }
+static inline ImU32 ImCrc32U64(ImU32 crc, ImU64 v)          { return __crc32cd(crc, v); }
+#else
+static inline ImU32 ImCrc32U8(ImU32 crc, unsigned char v)   { return _mm_crc32_u8(crc, v); }
+#if defined(__x86_64__) || defined(_M_X64)
+static inline ImU32 ImCrc32U64(ImU32 crc, ImU64 v)          { return (ImU32)_mm_crc32_u64(crc, v); }
+#else
+static inline ImU32 ImCrc32U64(ImU32 crc, ImU64 v)          { return _mm_crc32_u32(_mm_crc32_u32(crc, (ImU32)v), (ImU32)(v >> 32)); }
+#endif
+#endif
+#endif
+
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
 // FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
@@ -2342,19 +2360,21 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
     const unsigned char *data_end = (const unsigned char*)data_p + data_size;
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
+#ifndef IMGUI_ENABLE_HW_CRC32
     const ImU32* crc32_lut = GCrc32LookupTable;
     while (data < data_end)
         crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
     return ~crc;
 #else
-    while (data + 4 <= data_end)
+    while (data + 8 <= data_end)
     {
-        crc = _mm_crc32_u32(crc, *(ImU32*)data);
-        data += 4;
+        ImU64 word;
+        memcpy(&word, data, 8);
+        crc = ImCrc32U64(crc, word);
+        data += 8;
     }
     while (data < data_end)
-        crc = _mm_crc32_u8(crc, *data++);
+        crc = ImCrc32U8(crc, *data++);
     return ~crc;
 #endif
 }
@@ -2370,9 +2390,8 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
+#ifndef IMGUI_ENABLE_HW_CRC32
     const ImU32* crc32_lut = GCrc32LookupTable;
-#endif
     if (data_size != 0)
     {
         while (data_size-- != 0)
@@ -2380,11 +2399,7 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
             unsigned char c = *data++;
             if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
                 crc = seed;
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
             crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
-#else
-            crc = _mm_crc32_u8(crc, c);
-#endif
         }
     }
     else
@@ -2393,13 +2408,42 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
         {
             if (c == '#' && data[0] == '#' && data[1] == '#')
                 crc = seed;
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
             crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
+        }
+    }
 #else
-            crc = _mm_crc32_u8(crc, c);
-#endif
+    // Hash 8 bytes per step. Words containing a '#' go through the byte loop so "###" is still honored.
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    while (data_size >= 8)
+    {
+        ImU64 word;
+        memcpy(&word, data, 8);
+        const ImU64 hashes = word ^ 0x2323232323232323ULL; // Zero byte where word has '#'
+        if (((hashes - 0x0101010101010101ULL) & ~hashes & 0x8080808080808080ULL) == 0)
+        {
+            crc = ImCrc32U64(crc, word);
+            data += 8;
+            data_size -= 8;
+            continue;
         }
+        for (int n = 0; n < 8; n++)
+        {
+            unsigned char c = *data++;
+            data_size--;
+            if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
+                crc = seed;
+            crc = ImCrc32U8(crc, c);
+        }
+    }
+    while (data_size-- != 0)
+    {
+        unsigned char c = *data++;
+        if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
+            crc = seed;
+        crc = ImCrc32U8(crc, c);
     }
+#endif
     return ~crc;
 }
 
@@ -2556,15 +2600,70 @@ int ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char*
     return wanted;
 }
 
+static inline int ImTextFirstSetBit(ImU64 mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(mask);
+#else
+    int n = 0;
+    while ((mask & 1) == 0) { mask >>= 1; n++; }
+    return n;
+#endif
+}
+
+// Return length of the leading run of bytes in the 1..0x7F range, scanning 16 bytes at a time where SIMD is available.
+// Bytes in that range are their own codepoint: callers copy them through and only use ImTextCharFromUtf8() for the rest.
+// Stopping on 0 as well lets ImTextStrFromUtf8()/ImTextCountCharsFromUtf8() keep their zero-terminator semantic.
+int ImTextCountAsciiPrefix(const char* in_text, const char* in_text_end)
+{
+    const char* p = in_text;
+#if defined(IMGUI_ENABLE_SSE)
+    const __m128i zero = _mm_setzero_si128();
+    for (; in_text_end - p >= 16; p += 16)
+    {
+        // Signed compare: 0x01..0x7F are > 0, while 0x00 and 0x80..0xFF are not.
+        const int mask = _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)(const void*)p), zero));
+        if (mask != 0xFFFF)
+            return (int)(p - in_text) + ImTextFirstSetBit((ImU64)(~mask & 0xFFFF));
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    for (; in_text_end - p >= 16; p += 16)
+    {
+        const uint8x16_t ascii = vcgtq_s8(vld1q_s8((const int8_t*)p), vdupq_n_s8(0));
+        if (vminvq_u8(ascii) != 0xFF)
+        {
+            // Narrow the byte mask to 4 bits per byte to locate the first non-ASCII byte.
+            const ImU64 mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(ascii), 4)), 0);
+            return (int)(p - in_text) + ImTextFirstSetBit(~mask) / 4;
+        }
+    }
+#endif
+    while (p < in_text_end && (signed char)*p > 0)
+        p++;
+    return (int)(p - in_text);
+}
+
 int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_text_remaining)
 {
     ImWchar* buf_out = buf;
     ImWchar* buf_end = buf + buf_size;
-    while (buf_out < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
+    if (in_text_end == NULL)
+        in_text_end = in_text + ImStrlen(in_text);
+    while (buf_out < buf_end - 1 && in_text < in_text_end && *in_text)
     {
-        unsigned int c;
-        in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
-        *buf_out++ = (ImWchar)c;
+        // Decode anything else than ASCII one codepoint at a time, copy ASCII runs straight through.
+        if ((unsigned char)*in_text >= 0x80)
+        {
+            unsigned int c;
+            in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
+            *buf_out++ = (ImWchar)c;
+            continue;
+        }
+        const int ascii_len = ImTextCountAsciiPrefix(in_text, ImMin(in_text_end, in_text + (buf_end - 1 - buf_out)));
+        for (int n = 0; n < ascii_len; n++)
+            buf_out[n] = (ImWchar)in_text[n];
+        buf_out += ascii_len;
+        in_text += ascii_len;
     }
     *buf_out = 0;
     if (in_text_remaining)
@@ -2574,12 +2673,21 @@ int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const cha
 
 int ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
 {
+    if (in_text_end == NULL)
+        in_text_end = in_text + ImStrlen(in_text);
     int char_count = 0;
-    while ((!in_text_end || in_text < in_text_end) && *in_text)
+    while (in_text < in_text_end && *in_text)
     {
-        unsigned int c;
-        in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
-        char_count++;
+        if ((unsigned char)*in_text >= 0x80)
+        {
+            unsigned int c;
+            in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
+            char_count++;
+            continue;
+        }
+        const int ascii_len = ImTextCountAsciiPrefix(in_text, in_text_end);
+        char_count += ascii_len;
+        in_text += ascii_len;
     }
     return char_count;
 }
@@ -2836,14 +2944,110 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
 void ImGuiStorage::BuildSortByKey()
 {
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+#ifdef IMGUI_STORAGE_HASHED
+    _IndexedSize = -1;
+#endif
+}
+
+#ifdef IMGUI_STORAGE_HASHED
+// Robin Hood open addressing over indices into Data, load factor <= 0.5.
+// IDs are already hashes but low bits of sequential user IDs are poorly distributed, so mix them once more.
+static inline ImU32 ImGuiStorage_HashKey(ImGuiID key)
+{
+    ImU32 h = key * 0x9E3779B1u;
+    return h ^ (h >> 16);
 }
 
+static void ImGuiStorage_IndexPlace(ImGuiStorage* storage, int data_idx)
+{
+    const ImU32 mask = (ImU32)storage->_Index.Size - 1;
+    ImU32 slot = ImGuiStorage_HashKey(storage->Data[data_idx].key) & mask;
+    ImU32 dist = 0;
+    for (;;)
+    {
+        int occupant = storage->_Index[slot];
+        if (occupant < 0)
+        {
+            storage->_Index[slot] = data_idx;
+            return;
+        }
+        ImU32 occupant_dist = (slot - ImGuiStorage_HashKey(storage->Data[occupant].key)) & mask;
+        if (occupant_dist < dist)
+        {
+            // Steal the slot from the richer entry and carry on placing it
+            storage->_Index[slot] = data_idx;
+            data_idx = occupant;
+            dist = occupant_dist;
+        }
+        slot = (slot + 1) & mask;
+        dist++;
+    }
+}
+
+static void ImGuiStorage_IndexRebuild(ImGuiStorage* storage)
+{
+    int capacity = 16;
+    while (capacity < storage->Data.Size * 2)
+        capacity <<= 1;
+    storage->_Index.resize(capacity);
+    memset(storage->_Index.Data, 0xFF, (size_t)capacity * sizeof(int));
+    for (int n = 0; n < storage->Data.Size; n++)
+        ImGuiStorage_IndexPlace(storage, n);
+    storage->_IndexedData = storage->Data.Data;
+    storage->_IndexedSize = storage->Data.Size;
+}
+
+static ImGuiStoragePair* ImGuiStorage_FindPair(const ImGuiStorage* const_storage, ImGuiID key)
+{
+    ImGuiStorage* storage = const_cast<ImGuiStorage*>(const_storage);
+    if (storage->_IndexedData != storage->Data.Data || storage->_IndexedSize != storage->Data.Size)
+        ImGuiStorage_IndexRebuild(storage);
+    if (storage->_Index.Size == 0)
+        return NULL;
+    const ImU32 mask = (ImU32)storage->_Index.Size - 1;
+    ImU32 slot = ImGuiStorage_HashKey(key) & mask;
+    for (ImU32 dist = 0; ; dist++, slot = (slot + 1) & mask)
+    {
+        int occupant = storage->_Index[slot];
+        if (occupant < 0)
+            return NULL;
+        ImGuiStoragePair* pair = &storage->Data[occupant];
+        if (pair->key == key)
+            return pair;
+        if (((slot - ImGuiStorage_HashKey(pair->key)) & mask) < dist)
+            return NULL; // Would have been placed before this richer entry
+    }
+}
+
+// Only call after ImGuiStorage_FindPair() returned NULL for this key
+static ImGuiStoragePair* ImGuiStorage_AddPair(ImGuiStorage* storage, const ImGuiStoragePair& pair)
+{
+    storage->Data.push_back(pair);
+    if (storage->Data.Size * 2 > storage->_Index.Size)
+    {
+        ImGuiStorage_IndexRebuild(storage);
+    }
+    else
+    {
+        ImGuiStorage_IndexPlace(storage, storage->Data.Size - 1);
+        storage->_IndexedData = storage->Data.Data;
+        storage->_IndexedSize = storage->Data.Size;
+    }
+    return &storage->Data.back();
+}
+#endif // #ifdef IMGUI_STORAGE_HASHED
+
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
+#ifdef IMGUI_STORAGE_HASHED
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    return it ? it->val_i : default_val;
+#else
     ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
     if (it == Data.Data + Data.Size || it->key != key)
         return default_val;
     return it->val_i;
+#endif
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2853,26 +3057,42 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
+#ifdef IMGUI_STORAGE_HASHED
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    return it ? it->val_f : default_val;
+#else
     ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
     if (it == Data.Data + Data.Size || it->key != key)
         return default_val;
     return it->val_f;
+#endif
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
+#ifdef IMGUI_STORAGE_HASHED
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    return it ? it->val_p : NULL;
+#else
     ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
     if (it == Data.Data + Data.Size || it->key != key)
         return NULL;
     return it->val_p;
+#endif
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
+#ifdef IMGUI_STORAGE_HASHED
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    if (it == NULL)
+        it = ImGuiStorage_AddPair(this, ImGuiStoragePair(key, default_val));
+#else
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+#endif
     return &it->val_i;
 }
 
@@ -2883,28 +3103,48 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
+#ifdef IMGUI_STORAGE_HASHED
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    if (it == NULL)
+        it = ImGuiStorage_AddPair(this, ImGuiStoragePair(key, default_val));
+#else
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+#endif
     return &it->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
+#ifdef IMGUI_STORAGE_HASHED
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    if (it == NULL)
+        it = ImGuiStorage_AddPair(this, ImGuiStoragePair(key, default_val));
+#else
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+#endif
     return &it->val_p;
 }
 
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
+#ifdef IMGUI_STORAGE_HASHED
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    if (it == NULL)
+        ImGuiStorage_AddPair(this, ImGuiStoragePair(key, val));
+    else
+        it->val_i = val;
+#else
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
     else
         it->val_i = val;
+#endif
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2914,20 +3154,36 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
+#ifdef IMGUI_STORAGE_HASHED
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    if (it == NULL)
+        ImGuiStorage_AddPair(this, ImGuiStoragePair(key, val));
+    else
+        it->val_f = val;
+#else
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
     else
         it->val_f = val;
+#endif
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
+#ifdef IMGUI_STORAGE_HASHED
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    if (it == NULL)
+        ImGuiStorage_AddPair(this, ImGuiStoragePair(key, val));
+    else
+        it->val_p = val;
+#else
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
     else
         it->val_p = val;
+#endif
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -4420,6 +4676,7 @@ void ImGui::Shutdown()
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
+    g.TextSizeCache.clear();
     g.InputTextState.ClearFreeMemory();
     g.InputTextLineIndex.clear();
     g.InputTextDeactivatedState.ClearFreeMemory();
@@ -6047,6 +6304,85 @@ void ImGui::Render()
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
 
+// 64-bit multiplicative hash, 8 bytes at a time, for g.TextSizeCache keys.
+// Not ImHashData(): a 32-bit CRC collides too often to be trusted without comparing the text.
+static ImU64 TextSizeCacheHash(const void* data, size_t data_size, ImU64 seed)
+{
+    const ImU64 k = 0x9E3779B97F4A7C15ull;
+    const unsigned char* p = (const unsigned char*)data;
+    ImU64 h = seed ^ (data_size * k);
+    for (; data_size >= 8; p += 8, data_size -= 8)
+    {
+        ImU64 w;
+        memcpy(&w, p, 8);
+        h = (h ^ w) * k;
+        h ^= h >> 29;
+    }
+    if (data_size > 0)
+    {
+        ImU64 w = 0;
+        memcpy(&w, p, data_size);
+        h = (h ^ w) * k;
+        h ^= h >> 29;
+    }
+    h *= k;
+    return h ^ (h >> 32);
+}
+
+// Measure through g.TextSizeCache. Most labels are identical from one frame to the next.
+// Short strings are cheaper to measure than to hash, so they bypass the cache.
+static ImVec2 CalcTextSizeCached(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end)
+{
+    ImGuiContext& g = *GImGui;
+    const int text_len = (int)(text_end - text);
+    if (text_len < IMGUI_TEXT_SIZE_CACHE_MIN_LEN)
+        return font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_end, NULL);
+
+    ImGuiTextSizeCache& cache = g.TextSizeCache;
+    if (cache.Entries.Size == 0)
+    {
+        cache.Entries.resize(IMGUI_TEXT_SIZE_CACHE_SETS * IMGUI_TEXT_SIZE_CACHE_WAYS);
+        memset(cache.Entries.Data, 0, (size_t)cache.Entries.size_in_bytes());
+    }
+
+    // The atlas generation changes whenever a font's glyph output is destroyed or a source is merged into it
+    // (rebuild, ImFontAtlasBuildClear(), font loader change...): entries measured before that simply stop matching.
+    ImFontAtlas* atlas = font->OwnerAtlas;
+    struct { ImFontAtlas* Atlas; int Generation; ImGuiID FontId; float FontSize; float Density; float WrapWidth; } key_seed;
+    memset(&key_seed, 0, sizeof(key_seed)); // Clear padding, it is hashed
+    key_seed.Atlas = atlas;
+    key_seed.Generation = atlas ? atlas->FontOutputGeneration : 0;
+    key_seed.FontId = font->FontId;
+    key_seed.FontSize = font_size;
+    key_seed.Density = font->CurrentRasterizerDensity;
+    key_seed.WrapWidth = wrap_width;
+    ImU64 key = TextSizeCacheHash(text, (size_t)text_len, TextSizeCacheHash(&key_seed, sizeof(key_seed), 0));
+    if (key == 0)
+        key = 1;
+
+    ImGuiTextSizeCacheEntry* set = &cache.Entries[(int)(key & (IMGUI_TEXT_SIZE_CACHE_SETS - 1)) * IMGUI_TEXT_SIZE_CACHE_WAYS];
+    ImGuiTextSizeCacheEntry* victim = set;
+    for (int n = 0; n < IMGUI_TEXT_SIZE_CACHE_WAYS; n++)
+    {
+        ImGuiTextSizeCacheEntry* entry = &set[n];
+        if (entry->Key == key && entry->TextLen == text_len)
+        {
+            entry->LastUsedFrame = g.FrameCount;
+            return entry->Size;
+        }
+        if (entry->Key == 0 || entry->LastUsedFrame < victim->LastUsedFrame)
+            victim = entry;
+        if (entry->Key == 0)
+            break;
+    }
+
+    victim->Key = key;
+    victim->TextLen = text_len;
+    victim->LastUsedFrame = g.FrameCount;
+    victim->Size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_end, NULL);
+    return victim->Size;
+}
+
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
 // CalcTextSize("") should return ImVec2(0.0f, g.FontSize)
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
@@ -6063,7 +6399,9 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+    if (text_display_end == NULL)
+        text_display_end = text + ImStrlen(text);
+    ImVec2 text_size = CalcTextSizeCached(font, font_size, wrap_width, text, text_display_end);
 
     // Round
     // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
@@ -9000,6 +9338,7 @@ void ImGui::UpdateCurrentFontSize(float restore_font_size_after_scaling)
     if (g.Font != NULL && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures))
         g.Font->CurrentRasterizerDensity = g.FontRasterizerDensity;
     g.FontSize = final_size;
+    IM_ASSERT((g.Font == NULL || !(g.Font->Flags & ImFontFlags_DistanceField) || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasDistanceFieldText)) && "ImFontFlags_DistanceField requires renderer backend support!");
     g.FontBaked = (g.Font != NULL && window != NULL) ? g.Font->GetFontBaked(final_size) : NULL;
     g.FontBakedScale = (g.Font != NULL && window != NULL) ? (g.FontSize / g.FontBaked->Size) : 0.0f;
     g.DrawListSharedData.FontSize = g.FontSize;
@@ -16256,6 +16595,8 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     const int discarded_surface_sqrt = (int)sqrtf((float)atlas->Builder->RectsDiscardedSurface);
     Text("Packed rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsPackedCount, atlas->Builder->RectsPackedSurface, packed_surface_sqrt, packed_surface_sqrt);
     Text("incl. Discarded rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsDiscardedCount, atlas->Builder->RectsDiscardedSurface, discarded_surface_sqrt, discarded_surface_sqrt);
+    if (atlas->Builder->PackGuillotine)
+        Text("Guillotine packer: %d free rects", atlas->Builder->PackFreeRects.Size);
 
     ImFontAtlasRectId highlight_r_id = ImFontAtlasRectId_Invalid;
     if (TreeNode("Rects Index", "Rects Index (%d)", atlas->Builder->RectsPackedCount)) // <-- Use count of used rectangles
@@ -17067,7 +17408,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                     const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
                     triangle[n] = v.pos;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, (float)v.uv.x, (float)v.uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -175,6 +175,7 @@ struct ImDrawList;                  // A single draw command list (generally one
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
 struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVertUV16;              // Compact 16-bit normalized UV, usable in a custom ImDrawVert layout
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontAtlasBuilder;          // Opaque storage for building a ImFontAtlas
@@ -235,6 +236,7 @@ typedef int ImGuiTableBgTarget;     // -> enum ImGuiTableBgTarget_   // Enum: A
 //   - In Visual Studio: Ctrl+Comma ("Edit.GoToAll") can follow symbols inside comments, whereas Ctrl+F12 ("Edit.GoToImplementation") cannot.
 //   - In Visual Studio w/ Visual Assist installed: Alt+G ("VAssistX.GoToImplementation") can also follow symbols inside comments.
 //   - In VS Code, CLion, etc.: Ctrl+Click can follow symbols inside comments.
+typedef int ImDrawCmdFlags;         // -> enum ImDrawCmdFlags_       // Flags: for ImDrawCmd
 typedef int ImDrawFlags;            // -> enum ImDrawFlags_          // Flags: for ImDrawList functions
 typedef int ImDrawListFlags;        // -> enum ImDrawListFlags_      // Flags: for ImDrawList instance
 typedef int ImDrawTextFlags;        // -> enum ImDrawTextFlags_      // Internal, do not use!
@@ -1720,6 +1722,7 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
     ImGuiBackendFlags_RendererHasTextures   = 1 << 4,   // Backend Renderer supports ImTextureData requests to create/update/destroy textures. This enables incremental texture updates and texture reloads. See https://github.com/ocornut/imgui/blob/master/docs/BACKENDS.md for instructions on how to upgrade your custom backend.
+    ImGuiBackendFlags_RendererHasDistanceFieldText = 1 << 5, // Backend Renderer supports text using ImFontFlags_DistanceField: draw commands with ImDrawCmdFlags_DistanceFieldText use the texture alpha as a signed distance (0.5f on the edge).
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2768,15 +2771,26 @@ struct ImGuiStoragePair
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
 // Types are NOT stored, so it is up to you to make sure your Key don't collide with different types.
+// With IMGUI_STORAGE_HASHED (see imconfig.h), pairs are kept in insertion order and looked up through an open-addressing index,
+// making insertion O(1) amortized instead of O(N). The index is rebuilt lazily if Data is edited directly.
 struct ImGuiStorage
 {
     // [Internal]
     ImVector<ImGuiStoragePair>      Data;
+#ifdef IMGUI_STORAGE_HASHED
+    ImVector<int>                   _Index;         // Robin Hood hash table of indices into Data, -1 = empty slot. Zero-initialized storage is valid.
+    const ImGuiStoragePair*         _IndexedData;   // Data.Data and Data.Size the index was built for
+    int                             _IndexedSize;
+#endif
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
+#ifdef IMGUI_STORAGE_HASHED
+    void                Clear() { Data.clear(); _Index.clear(); _IndexedData = NULL; _IndexedSize = 0; }
+#else
     void                Clear() { Data.clear(); }
+#endif
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -3137,12 +3151,14 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // - VtxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   this fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
 //   Backends made for <1.71. will typically ignore the VtxOffset fields.
-// - The ClipRect/TexRef/VtxOffset fields must be contiguous as we memcmp() them together (this is asserted for).
+// - Flags: ImDrawCmdFlags_DistanceFieldText is set on commands holding ImFontFlags_DistanceField glyphs, for backends with ImGuiBackendFlags_RendererHasDistanceFieldText.
+// - The ClipRect/TexRef/VtxOffset/Flags fields must be contiguous as we memcmp() them together (this is asserted for).
 struct ImDrawCmd
 {
     ImVec4          ClipRect;           // 4*4  // Clipping rectangle (x1, y1, x2, y2). Subtract ImDrawData->DisplayPos to get clipping rectangle in "viewport" coordinates
     ImTextureRef    TexRef;             // 16   // Reference to a font/texture atlas (where backend called ImTextureData::SetTexID()) or to a user-provided texture ID (via e.g. ImGui::Image() calls). Both will lead to a ImTextureID value.
     unsigned int    VtxOffset;          // 4    // Start offset in vertex buffer. ImGuiBackendFlags_RendererHasVtxOffset: always 0, otherwise may be >0 to support meshes larger than 64K vertices with 16-bit indices.
+    ImDrawCmdFlags  Flags;              // 4    // See ImDrawCmdFlags_. Backends that don't set ImGuiBackendFlags_RendererHasDistanceFieldText can ignore it.
     unsigned int    IdxOffset;          // 4    // Start offset in index buffer.
     unsigned int    ElemCount;          // 4    // Number of indices (multiple of 3) to be rendered as triangles. Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
     ImDrawCallback  UserCallback;       // 4-8  // If != NULL, call the function instead of rendering the vertices. clip_rect and texture_id will be set normally.
@@ -3157,6 +3173,29 @@ struct ImDrawCmd
     inline ImTextureID GetTexID() const;    // == (TexRef._TexData ? TexRef._TexData->TexID : TexRef._TexID)
 };
 
+// Flags for ImDrawCmd
+enum ImDrawCmdFlags_
+{
+    ImDrawCmdFlags_None                     = 0,
+    ImDrawCmdFlags_DistanceFieldText        = 1 << 0,  // Texture alpha is a signed distance (0.5f on the edge) to threshold, instead of coverage. Only set with ImGuiBackendFlags_RendererHasDistanceFieldText.
+};
+
+// Compact UV storage, for use with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT (see imconfig.h)
+// Each coordinate is stored as unsigned normalized 16-bit (steps of 1/65535) and converted on access, so code writing 'vtx.uv = ImVec2(...)' or 'vtx.uv.x = ...' works unchanged.
+// Values are clamped to 0.0f..1.0f: texture repeat can't be represented.
+struct ImDrawUnorm16
+{
+    unsigned short  v;
+    ImDrawUnorm16&  operator=(float f)  { v = (unsigned short)((f > 0.0f ? (f < 1.0f ? f : 1.0f) : 0.0f) * 65535.0f + 0.5f); return *this; }
+    operator float() const              { return v * (1.0f / 65535.0f); }
+};
+struct ImDrawVertUV16
+{
+    ImDrawUnorm16   x, y;
+    ImDrawVertUV16& operator=(const ImVec2& uv) { x = uv.x; y = uv.y; return *this; }
+    operator ImVec2() const                     { return ImVec2(x, y); }
+};
+
 // Vertex layout
 #ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
 struct ImDrawVert
@@ -3168,6 +3207,7 @@ struct ImDrawVert
 #else
 // You can override the vertex format layout by defining IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT in imconfig.h
 // The code expect ImVec2 pos (8 bytes), ImVec2 uv (8 bytes), ImU32 col (4 bytes), but you can re-order them or add other fields as needed to simplify integration in your engine.
+// uv may also be declared as ImDrawVertUV16 (4 bytes) for a 16 bytes vertex, if your renderer backend supports it (the OpenGL3 and Vulkan backends do).
 // The type has to be described within the macro (you can either declare the struct or use a typedef). This is because ImVec2/ImU32 are likely not declared at the time you'd want to set your type up.
 // NOTE: IMGUI DOESN'T CLEAR THE STRUCTURE AND DOESN'T CALL A CONSTRUCTOR SO ANY CUSTOM FIELD WILL BE UNINITIALIZED. IF YOU ADD EXTRA FIELDS (SUCH AS A 'Z' COORDINATES) YOU WILL NEED TO CLEAR THEM DURING RENDER OR TO IGNORE THEM.
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
@@ -3179,6 +3219,7 @@ struct ImDrawCmdHeader
     ImVec4          ClipRect;
     ImTextureRef    TexRef;
     unsigned int    VtxOffset;
+    ImDrawCmdFlags  Flags;
 };
 
 // [Internal] For use by ImDrawListSplitter
@@ -3234,6 +3275,7 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_NoFontLoading           = 1 << 4,  // AddText() only uses font sizes and glyphs already baked in the atlas, skipping missing ones. Required to build a draw list outside of the ImGui thread (see ImDrawListSharedData::CopySettingsFrom()).
 };
 
 // Draw command list
@@ -3394,7 +3436,9 @@ struct ImDrawList
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTexture();
     IMGUI_API void  _OnChangedVtxOffset();
+    IMGUI_API void  _OnChangedDrawCmdFlags();
     IMGUI_API void  _SetTexture(ImTextureRef tex_ref);
+    IMGUI_API void  _SetDrawCmdFlags(ImDrawCmdFlags flags);
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
@@ -3606,6 +3650,7 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_PackGuillotine     = 1 << 3,   // Pack with a guillotine free list instead of stb_rect_pack's skyline. Discarded glyphs give their space back immediately instead of waiting for a repack, so atlases with a lot of churn (many sizes coming and going) stay smaller and get re-uploaded in full less often. Applied on next build or repack.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3724,6 +3769,7 @@ struct ImFontAtlas
     int                         TexMaxWidth;        // Maximum desired texture width. Must be a power of two. Default to 8192.
     int                         TexMaxHeight;       // Maximum desired texture height. Must be a power of two. Default to 8192.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
+    void                        (*RunJobs)(void (*job_func)(void* job_data, int job_n), void* job_data, int job_count); // Optional: run job_func(job_data, n) for every n in [0,job_count), in any order and from any threads, and return once they are all done. Used by ImFontBaked::LoadGlyphs() to rasterize on a worker pool. Jobs allocate directly from the SetAllocatorFunctions() allocator, which then needs to be thread-safe.
 
     // Output
     // - Because textures are dynamically created/resized, the current texture identifier may changed at *ANY TIME* during the frame.
@@ -3748,6 +3794,7 @@ struct ImFontAtlas
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
     int                         TexNextUniqueID;    // Next value to be stored in TexData->UniqueID
     int                         FontNextUniqueID;   // Next value to be stored in ImFont->FontID
+    int                         FontOutputGeneration; // Incremented when a font's output is destroyed or a source is added to it (loader change, rebuild...): text size caches are keyed on it
     ImVector<ImDrawListSharedData*> DrawListSharedDatas; // List of users for this atlas. Typically one per Dear ImGui context.
     ImFontAtlasBuilder*         Builder;            // Opaque interface to our data that doesn't need to be public and may be discarded when rebuilding.
     const ImFontLoader*         FontLoader;         // Font loader opaque interface (default to use FreeType when IMGUI_ENABLE_FREETYPE is defined, otherwise default to use stb_truetype). Use SetFontLoader() to change this at runtime.
@@ -3805,8 +3852,10 @@ struct ImFontBaked
     IMGUI_API void              ClearOutputData();
     IMGUI_API ImFontGlyph*      FindGlyph(ImWchar c);               // Return U+FFFD glyph if requested glyph doesn't exists.
     IMGUI_API ImFontGlyph*      FindGlyphNoFallback(ImWchar c);     // Return NULL if glyph doesn't exist
+    IMGUI_API ImFontGlyph*      FindGlyphNoLoad(ImWchar c);         // Return NULL if glyph isn't loaded yet. Never loads, never modifies the atlas.
     IMGUI_API float             GetCharAdvance(ImWchar c);
     IMGUI_API bool              IsGlyphLoaded(ImWchar c);
+    IMGUI_API void              LoadGlyphs(const ImWchar* glyph_ranges); // Load all glyphs in ranges (2 values per range, inclusive, zero-terminated) at once, rasterizing them with ImFontAtlas::RunJobs when set.
 };
 
 // Font flags
@@ -3817,6 +3866,7 @@ enum ImFontFlags_
     ImFontFlags_NoLoadError             = 1 << 1,   // Disable throwing an error/assert when calling AddFontXXX() with missing file/data. Calling code is expected to check AddFontXXX() return value.
     ImFontFlags_NoLoadGlyphs            = 1 << 2,   // [Internal] Disable loading new glyphs.
     ImFontFlags_LockBakedSizes          = 1 << 3,   // [Internal] Disable loading new baked sizes, disable garbage collecting current ones. e.g. if you want to lock a font to a single size. Important: if you use this to preload given sizes, consider the possibility of multiple font density used on Retina display.
+    ImFontFlags_DistanceField           = 1 << 4,   // Bake glyphs once as signed distance fields and scale them to every size, instead of rasterizing each size. Requires ImGuiBackendFlags_RendererHasDistanceFieldText. Set in ImFontConfig::Flags.
 };
 
 // Font runtime data and rendering
@@ -3857,6 +3907,7 @@ struct ImFont
     // 'max_width' stops rendering after a certain width (could be turned into a 2d size). FLT_MAX to disable.
     // 'wrap_width' enable automatic word-wrapping across multiple lines to fit into given width. 0.0f to disable.
     IMGUI_API ImFontBaked*      GetFontBaked(float font_size, float density = -1.0f);  // Get or create baked data for given size
+    IMGUI_API ImFontBaked*      FindFontBaked(float font_size, float density = -1.0f); // Return NULL if given size isn't baked yet. Never creates, never modifies the font or atlas.
     IMGUI_API ImVec2            CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end = NULL, const char** out_remaining = NULL);
     IMGUI_API const char*       CalcWordWrapPosition(float size, const char* text, const char* text_end, float wrap_width);
     IMGUI_API void              RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c, const ImVec4* cpu_fine_clip = NULL);
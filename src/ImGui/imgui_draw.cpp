@@ -137,8 +137,26 @@ namespace IMGUI_STB_NAMESPACE
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+// stbtt_fontinfo::userdata is NULL except for glyphs rasterized by ImFontBaked::LoadGlyphs() jobs, which may run on other threads:
+// those allocate straight from the user allocator, ImGui::MemAlloc() debug hooks are not thread-safe.
+static void* ImGui_ImplStbTrueType_MemAlloc(size_t size, void* user_data)
+{
+    if (user_data == NULL)
+        return IM_ALLOC(size);
+    ImGuiMemAllocFunc alloc_func; ImGuiMemFreeFunc free_func; void* alloc_user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &alloc_user_data);
+    return alloc_func(size, alloc_user_data);
+}
+static void ImGui_ImplStbTrueType_MemFree(void* ptr, void* user_data)
+{
+    if (user_data == NULL)
+        return IM_FREE(ptr);
+    ImGuiMemAllocFunc alloc_func; ImGuiMemFreeFunc free_func; void* alloc_user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &alloc_user_data);
+    free_func(ptr, alloc_user_data);
+}
+#define STBTT_malloc(x,u)   ImGui_ImplStbTrueType_MemAlloc(x,u)
+#define STBTT_free(x,u)     ImGui_ImplStbTrueType_MemFree(x,u)
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -147,6 +165,7 @@ namespace IMGUI_STB_NAMESPACE
 #define STBTT_ifloor(x)     ((int)ImFloor(x))
 #define STBTT_iceil(x)      ((int)ImCeil(x))
 #define STBTT_strlen(x)     ImStrlen(x)
+#define STBTT_RASTERIZER_SIMD
 #define STBTT_STATIC
 #define STB_TRUETYPE_IMPLEMENTATION
 #else
@@ -419,6 +438,26 @@ void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
     ArcFastRadiusCutoff = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC_R(IM_DRAWLIST_ARCFAST_SAMPLE_MAX, CircleSegmentMaxError);
 }
 
+// TempBuffer is scratch memory written by e.g. AddPolyline(), so ImDrawList instances filled concurrently each need their own ImDrawListSharedData.
+// We don't copy Context: this instance isn't registered in the atlas either, so texture changes won't be patched into its draw lists.
+void ImDrawListSharedData::CopySettingsFrom(const ImDrawListSharedData& src)
+{
+    TexUvWhitePixel = src.TexUvWhitePixel;
+    TexUvLines = src.TexUvLines;
+    FontAtlas = src.FontAtlas;
+    Font = src.Font;
+    FontSize = src.FontSize;
+    FontScale = src.FontScale;
+    CurveTessellationTol = src.CurveTessellationTol;
+    CircleSegmentMaxError = src.CircleSegmentMaxError;
+    InitialFringeScale = src.InitialFringeScale;
+    InitialFlags = src.InitialFlags;
+    ClipRectFullscreen = src.ClipRectFullscreen;
+    memcpy(ArcFastVtx, src.ArcFastVtx, sizeof(ArcFastVtx));
+    ArcFastRadiusCutoff = src.ArcFastRadiusCutoff;
+    memcpy(CircleSegmentCounts, src.CircleSegmentCounts, sizeof(CircleSegmentCounts));
+}
+
 ImDrawList::ImDrawList(ImDrawListSharedData* shared_data)
 {
     memset(this, 0, sizeof(*this));
@@ -448,6 +487,7 @@ void ImDrawList::_ResetForNewFrame()
     IM_STATIC_ASSERT(offsetof(ImDrawCmd, ClipRect) == 0);
     IM_STATIC_ASSERT(offsetof(ImDrawCmd, TexRef) == sizeof(ImVec4));
     IM_STATIC_ASSERT(offsetof(ImDrawCmd, VtxOffset) == sizeof(ImVec4) + sizeof(ImTextureRef));
+    IM_STATIC_ASSERT(offsetof(ImDrawCmd, Flags) == offsetof(ImDrawCmd, VtxOffset) + sizeof(unsigned int));
     if (_Splitter._Count > 1)
         _Splitter.Merge(this);
 
@@ -501,6 +541,7 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.ClipRect = _CmdHeader.ClipRect;    // Same as calling ImDrawCmd_HeaderCopy()
     draw_cmd.TexRef = _CmdHeader.TexRef;
     draw_cmd.VtxOffset = _CmdHeader.VtxOffset;
+    draw_cmd.Flags = _CmdHeader.Flags;
     draw_cmd.IdxOffset = IdxBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
@@ -555,10 +596,10 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* userdata, size_t use
     AddDrawCmd(); // Force a new command after us (see comment below)
 }
 
-// Compare ClipRect, TexRef and VtxOffset with a single memcmp()
-#define ImDrawCmd_HeaderSize                            (offsetof(ImDrawCmd, VtxOffset) + sizeof(unsigned int))
-#define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TexRef, VtxOffset
-#define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TexRef, VtxOffset
+// Compare ClipRect, TexRef, VtxOffset and Flags with a single memcmp()
+#define ImDrawCmd_HeaderSize                            (offsetof(ImDrawCmd, Flags) + sizeof(ImDrawCmdFlags))
+#define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TexRef, VtxOffset, Flags
+#define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TexRef, VtxOffset, Flags
 #define ImDrawCmd_AreSequentialIdxOffset(CMD_0, CMD_1)  (CMD_0->IdxOffset + CMD_0->ElemCount == CMD_1->IdxOffset)
 
 // Try to merge two last draw commands
@@ -639,6 +680,28 @@ void ImDrawList::_OnChangedVtxOffset()
     curr_cmd->VtxOffset = _CmdHeader.VtxOffset;
 }
 
+void ImDrawList::_OnChangedDrawCmdFlags()
+{
+    // If current command is used with different settings we need to add a new command
+    IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
+    ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (curr_cmd->ElemCount != 0 && curr_cmd->Flags != _CmdHeader.Flags)
+    {
+        AddDrawCmd();
+        return;
+    }
+    IM_ASSERT(curr_cmd->UserCallback == NULL);
+
+    // Try to merge with previous command if it matches, else use current command
+    ImDrawCmd* prev_cmd = curr_cmd - 1;
+    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    {
+        CmdBuffer.pop_back();
+        return;
+    }
+    curr_cmd->Flags = _CmdHeader.Flags;
+}
+
 int ImDrawList::_CalcCircleAutoSegmentCount(float radius) const
 {
     // Automatic segment count
@@ -707,6 +770,15 @@ void ImDrawList::_SetTexture(ImTextureRef tex_ref)
     _OnChangedTexture();
 }
 
+// This is used by ImFont::RenderText()/RenderChar() around distance field glyphs. There is no stack: callers restore the previous value.
+void ImDrawList::_SetDrawCmdFlags(ImDrawCmdFlags flags)
+{
+    if (_CmdHeader.Flags == flags)
+        return;
+    _CmdHeader.Flags = flags;
+    _OnChangedDrawCmdFlags();
+}
+
 // Reserve space for a number of vertices and indices.
 // You must finish filling your reserved data before calling PrimReserve() again, as it may reallocate or
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
@@ -798,6 +870,118 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Normal kernels shared by AddPolyline() and AddConvexPolyFilled(), processing 4 points per iteration with SSE2 or AArch64 NEON.
+// Lanes perform the same operations as IM_NORMALIZE2F_OVER_ZERO()/IM_FIXNORMAL2F() (rsqrtps matches ImRsqrt's rsqrtss, NEON uses 1/sqrt
+// like the non-SSE ImRsqrt), so they match the scalar tail of the same build, unless a custom ImRsqrt is provided or the compiler fuses
+// the tail's multiply-adds (-ffp-contract, last bit only).
+// Output is NOT identical across builds: rsqrtss/rsqrtps are 12-bit approximations (relative error <= 1.5*2^-12) where a build without SSE
+// uses 1/sqrtf, and IM_FIXNORMAL2F scales miter normals up to 100x. A vertex offset by 'w' pixels along a miter normal can move by up to
+// 100 * 1.5*2^-12 * w ~= 0.037*w pixels (w = thickness/2 + AA fringe, e.g. ~0.08 px for a 3.5 px line), except at joins folding back
+// by ~180 degrees, where the miter is shorter than 0.1*w either way.
+// - ImDrawListComputeEdgeNormals(): out[i] = perpendicular of normalized (points[i+1] - points[i]), for i < count. Last segment may wrap to points[0].
+// - ImDrawListComputeMiterNormals(): out[i] = fixed average of normals[i-1] and normals[i], for 1 <= i < points_count, and for i == 0 if 'wrap'.
+static void ImDrawListComputeEdgeNormals(const ImVec2* points, int points_count, int count, ImVec2* out)
+{
+    int i1 = 0;
+#if defined(IMGUI_ENABLE_SSE)
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    for (; i1 + 4 <= count && i1 + 4 < points_count; i1 += 4)
+    {
+        const __m128 a01 = _mm_loadu_ps(&points[i1 + 0].x), a23 = _mm_loadu_ps(&points[i1 + 2].x);
+        const __m128 b01 = _mm_loadu_ps(&points[i1 + 1].x), b23 = _mm_loadu_ps(&points[i1 + 3].x);
+        __m128 dx = _mm_sub_ps(_mm_shuffle_ps(b01, b23, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(a01, a23, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128 dy = _mm_sub_ps(_mm_shuffle_ps(b01, b23, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(a01, a23, _MM_SHUFFLE(3, 1, 3, 1)));
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        const __m128 inv_len = _mm_rsqrt_ps(d2);
+        const __m128 over_zero = _mm_cmpgt_ps(d2, _mm_setzero_ps());
+        dx = _mm_or_ps(_mm_and_ps(over_zero, _mm_mul_ps(dx, inv_len)), _mm_andnot_ps(over_zero, dx));
+        dy = _mm_or_ps(_mm_and_ps(over_zero, _mm_mul_ps(dy, inv_len)), _mm_andnot_ps(over_zero, dy));
+        const __m128 ndx = _mm_xor_ps(dx, sign_mask);
+        _mm_storeu_ps(&out[i1 + 0].x, _mm_unpacklo_ps(dy, ndx));
+        _mm_storeu_ps(&out[i1 + 2].x, _mm_unpackhi_ps(dy, ndx));
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    for (; i1 + 4 <= count && i1 + 4 < points_count; i1 += 4)
+    {
+        const float32x4x2_t a = vld2q_f32(&points[i1].x);
+        const float32x4x2_t b = vld2q_f32(&points[i1 + 1].x);
+        float32x4_t dx = vsubq_f32(b.val[0], a.val[0]);
+        float32x4_t dy = vsubq_f32(b.val[1], a.val[1]);
+        const float32x4_t d2 = vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy));
+        const float32x4_t inv_len = vdivq_f32(one, vsqrtq_f32(d2));
+        const uint32x4_t over_zero = vcgtq_f32(d2, vdupq_n_f32(0.0f));
+        dx = vbslq_f32(over_zero, vmulq_f32(dx, inv_len), dx);
+        dy = vbslq_f32(over_zero, vmulq_f32(dy, inv_len), dy);
+        float32x4x2_t n;
+        n.val[0] = dy;
+        n.val[1] = vnegq_f32(dx);
+        vst2q_f32(&out[i1].x, n);
+    }
+#endif
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out[i1].x = dy;
+        out[i1].y = -dx;
+    }
+}
+
+static void ImDrawListComputeMiterNormals(const ImVec2* normals, int points_count, bool wrap, ImVec2* out)
+{
+    int i1 = 1;
+#if defined(IMGUI_ENABLE_SSE)
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 min_d2 = _mm_set1_ps(0.000001f);
+    const __m128 max_invlen2 = _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2);
+    for (; i1 + 4 <= points_count; i1 += 4)
+    {
+        const __m128 a01 = _mm_loadu_ps(&normals[i1 - 1].x), a23 = _mm_loadu_ps(&normals[i1 + 1].x);
+        const __m128 b01 = _mm_loadu_ps(&normals[i1 + 0].x), b23 = _mm_loadu_ps(&normals[i1 + 2].x);
+        __m128 dm_x = _mm_mul_ps(_mm_add_ps(_mm_shuffle_ps(a01, a23, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(b01, b23, _MM_SHUFFLE(2, 0, 2, 0))), half);
+        __m128 dm_y = _mm_mul_ps(_mm_add_ps(_mm_shuffle_ps(a01, a23, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(b01, b23, _MM_SHUFFLE(3, 1, 3, 1))), half);
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dm_x, dm_x), _mm_mul_ps(dm_y, dm_y));
+        const __m128 inv_len2 = _mm_min_ps(_mm_div_ps(_mm_set1_ps(1.0f), d2), max_invlen2);
+        const __m128 over_min = _mm_cmpgt_ps(d2, min_d2);
+        dm_x = _mm_or_ps(_mm_and_ps(over_min, _mm_mul_ps(dm_x, inv_len2)), _mm_andnot_ps(over_min, dm_x));
+        dm_y = _mm_or_ps(_mm_and_ps(over_min, _mm_mul_ps(dm_y, inv_len2)), _mm_andnot_ps(over_min, dm_y));
+        _mm_storeu_ps(&out[i1 + 0].x, _mm_unpacklo_ps(dm_x, dm_y));
+        _mm_storeu_ps(&out[i1 + 2].x, _mm_unpackhi_ps(dm_x, dm_y));
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    for (; i1 + 4 <= points_count; i1 += 4)
+    {
+        const float32x4x2_t a = vld2q_f32(&normals[i1 - 1].x);
+        const float32x4x2_t b = vld2q_f32(&normals[i1].x);
+        float32x4x2_t dm;
+        dm.val[0] = vmulq_n_f32(vaddq_f32(a.val[0], b.val[0]), 0.5f);
+        dm.val[1] = vmulq_n_f32(vaddq_f32(a.val[1], b.val[1]), 0.5f);
+        const float32x4_t d2 = vaddq_f32(vmulq_f32(dm.val[0], dm.val[0]), vmulq_f32(dm.val[1], dm.val[1]));
+        const float32x4_t inv_len2 = vminq_f32(vdivq_f32(one, d2), vdupq_n_f32(IM_FIXNORMAL2F_MAX_INVLEN2));
+        const uint32x4_t over_min = vcgtq_f32(d2, vdupq_n_f32(0.000001f));
+        dm.val[0] = vbslq_f32(over_min, vmulq_f32(dm.val[0], inv_len2), dm.val[0]);
+        dm.val[1] = vbslq_f32(over_min, vmulq_f32(dm.val[1], inv_len2), dm.val[1]);
+        vst2q_f32(&out[i1].x, dm);
+    }
+#endif
+    for (; i1 <= points_count; i1++)
+    {
+        if (i1 == points_count && !wrap)
+            break;
+        const int i0 = i1 - 1;
+        const int i = (i1 == points_count) ? 0 : i1;
+        float dm_x = (normals[i0].x + normals[i].x) * 0.5f;
+        float dm_y = (normals[i0].y + normals[i].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out[i].x = dm_x;
+        out[i].y = dm_y;
+    }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -834,23 +1018,21 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         PrimReserve(idx_count, vtx_count);
 
         // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
+        // The first <points_count> items are normals at each line segment, then <points_count> averaged normals at each line point
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        ImVec2* temp_points = temp_normals + points_count;
+        ImVec2* temp_miters = temp_normals + points_count;
 
-        // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
+        // Calculate normals (tangents) for each line segment, then average them at each point
+        ImDrawListComputeEdgeNormals(points, points_count, count, temp_normals);
         if (!closed)
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
+        ImDrawListComputeMiterNormals(temp_normals, points_count, closed, temp_miters);
+
+        // If line is not closed, the first point needs to be generated differently as there are no normals to blend
+        // (the last point uses the average of two identical normals)
+        if (!closed)
+            temp_miters[0] = temp_normals[0];
 
         // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
         if (use_texture || !thick_line)
@@ -865,38 +1047,12 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             //   allow scaling geometry while preserving one-screen-pixel AA fringe).
             const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
-                temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
+            // This takes points n and n+1, with the first point in a closed line being connected to the final one (as n+1 wraps)
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertices for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -913,11 +1069,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                     _IdxWritePtr[9] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
                     _IdxWritePtr += 12;
                 }
-
                 idx1 = idx2;
             }
 
-            // Add vertices for each point on the line
+            // Add vertices for each point on the line, offset by averaged normals to the outer edges of the AA area
             if (use_texture)
             {
                 // If we're using textures we only need to emit the left/right edge vertices
@@ -934,8 +1089,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
+                    const float dm_x = temp_miters[i].x * half_draw_size;
+                    const float dm_y = temp_miters[i].y * half_draw_size;
+                    _VtxWritePtr[0].pos.x = points[i].x + dm_x; _VtxWritePtr[0].pos.y = points[i].y + dm_y; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
+                    _VtxWritePtr[1].pos.x = points[i].x - dm_x; _VtxWritePtr[1].pos.y = points[i].y - dm_y; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
                     _VtxWritePtr += 2;
                 }
             }
@@ -944,9 +1101,11 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 // If we're not using a texture, we need the center vertex as well
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
+                    const float dm_x = temp_miters[i].x * half_draw_size;
+                    const float dm_y = temp_miters[i].y * half_draw_size;
+                    _VtxWritePtr[0].pos = points[i];                                                _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
+                    _VtxWritePtr[1].pos.x = points[i].x + dm_x; _VtxWritePtr[1].pos.y = points[i].y + dm_y; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
+                    _VtxWritePtr[2].pos.x = points[i].x - dm_x; _VtxWritePtr[2].pos.y = points[i].y - dm_y; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
                     _VtxWritePtr += 3;
                 }
             }
@@ -956,50 +1115,12 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
             const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                const int points_last = points_count - 1;
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
+            // This takes points n and n+1, with the first point in a closed line being connected to the final one (as n+1 wraps)
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
-                // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
                 _IdxWritePtr[6]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1 + 0);
@@ -1007,17 +1128,20 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 _IdxWritePtr[12] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[13] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[14] = (ImDrawIdx)(idx1 + 3);
                 _IdxWritePtr[15] = (ImDrawIdx)(idx1 + 3); _IdxWritePtr[16] = (ImDrawIdx)(idx2 + 3); _IdxWritePtr[17] = (ImDrawIdx)(idx2 + 2);
                 _IdxWritePtr += 18;
-
                 idx1 = idx2;
             }
 
-            // Add vertices
+            // Add vertices: outer AA edge, solid core edges, outer AA edge
             for (int i = 0; i < points_count; i++)
             {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
+                const float dm_out_x = temp_miters[i].x * (half_inner_thickness + AA_SIZE);
+                const float dm_out_y = temp_miters[i].y * (half_inner_thickness + AA_SIZE);
+                const float dm_in_x = temp_miters[i].x * half_inner_thickness;
+                const float dm_in_y = temp_miters[i].y * half_inner_thickness;
+                _VtxWritePtr[0].pos.x = points[i].x + dm_out_x; _VtxWritePtr[0].pos.y = points[i].y + dm_out_y; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
+                _VtxWritePtr[1].pos.x = points[i].x + dm_in_x;  _VtxWritePtr[1].pos.y = points[i].y + dm_in_y;  _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+                _VtxWritePtr[2].pos.x = points[i].x - dm_in_x;  _VtxWritePtr[2].pos.y = points[i].y - dm_in_y;  _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+                _VtxWritePtr[3].pos.x = points[i].x - dm_out_x; _VtxWritePtr[3].pos.y = points[i].y - dm_out_y; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
                 _VtxWritePtr += 4;
             }
         }
@@ -1083,30 +1207,18 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             _IdxWritePtr += 3;
         }
 
-        // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
+        // Compute normals, then average them at each point
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
+        ImVec2* temp_miters = temp_normals + points_count;
+        ImDrawListComputeEdgeNormals(points, points_count, points_count, temp_normals);
+        ImDrawListComputeMiterNormals(temp_normals, points_count, true, temp_miters);
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
+            // Averaged normals
+            const float dm_x = temp_miters[i1].x * (AA_SIZE * 0.5f);
+            const float dm_y = temp_miters[i1].y * (AA_SIZE * 0.5f);
 
             // Add vertices
             _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
@@ -2042,30 +2154,18 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
             _IdxWritePtr += 3;
         }
 
-        // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
+        // Compute normals, then average them at each point
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
+        ImVec2* temp_miters = temp_normals + points_count;
+        ImDrawListComputeEdgeNormals(points, points_count, points_count, temp_normals);
+        ImDrawListComputeMiterNormals(temp_normals, points_count, true, temp_miters);
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
+            // Averaged normals
+            const float dm_x = temp_miters[i1].x * (AA_SIZE * 0.5f);
+            const float dm_y = temp_miters[i1].y * (AA_SIZE * 0.5f);
 
             // Add vertices
             _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
@@ -2561,6 +2661,10 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasBuildDestroy()
 //-----------------------------------------------------------------------------
 // - ImFontAtlasPackInit()
+// - ImFontAtlasPackGuillotineAddFree()
+// - ImFontAtlasPackGuillotineRemoveFree()
+// - ImFontAtlasPackGuillotineInsert()
+// - ImFontAtlasPackGuillotineFree()
 // - ImFontAtlasPackAllocRectEntry()
 // - ImFontAtlasPackReuseRectEntry()
 // - ImFontAtlasPackDiscardRect()
@@ -2570,6 +2674,7 @@ void ImTextureData::DestroyPixels()
 // - ImFontBaked_BuildGrowIndex()
 // - ImFontBaked_BuildLoadGlyph()
 // - ImFontBaked_BuildLoadGlyphAdvanceX()
+// - ImFontBaked_BuildLoadGlyphs()
 // - ImFontAtlasDebugLogTextureRequests()
 //-----------------------------------------------------------------------------
 // - ImFontAtlasGetFontLoaderForStbTruetype()
@@ -3601,6 +3706,7 @@ bool ImFontAtlasFontInitOutput(ImFontAtlas* atlas, ImFont* font)
 // Keep source/input FontData
 void ImFontAtlasFontDestroyOutput(ImFontAtlas* atlas, ImFont* font)
 {
+    atlas->FontOutputGeneration++;
     font->ClearOutputData();
     for (ImFontConfig* src : font->Sources)
     {
@@ -3630,6 +3736,7 @@ void ImFontAtlasFontSourceAddToFont(ImFontAtlas* atlas, ImFont* font, ImFontConf
         IM_ASSERT(font->Sources[0] == src);
     }
     atlas->TexIsBuilt = false; // For legacy backends
+    atlas->FontOutputGeneration++;
     ImFontAtlasBuildSetupFontSpecialGlyphs(atlas, font, src);
 }
 
@@ -4123,8 +4230,22 @@ void ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas)
     // Can some baked contents be ditched?
     //IMGUI_DEBUG_LOG_FONT("[font] ImFontAtlasBuildMakeSpace()\n");
     ImFontAtlasBuilder* builder = atlas->Builder;
+    const int packed_surface_before_discard = builder->RectsPackedSurface;
     ImFontAtlasBuildDiscardBakes(atlas, 2);
 
+    // With ImFontAtlasFlags_PackGuillotine, discarded space is already free: try again if anything was discarded,
+    // otherwise repack in place when the texture is less than half used (free space is too fragmented), or grow.
+    if (builder->PackGuillotine)
+    {
+        if (builder->RectsPackedSurface < packed_surface_before_discard)
+            return;
+        if (builder->RectsPackedSurface < atlas->TexData->Width * atlas->TexData->Height / 2)
+            ImFontAtlasTextureRepack(atlas, atlas->TexData->Width, atlas->TexData->Height);
+        else
+            ImFontAtlasTextureGrow(atlas);
+        return;
+    }
+
     // Currently using a heuristic for repack without growing.
     if (builder->RectsDiscardedSurface < builder->RectsPackedSurface * 0.20f)
         ImFontAtlasTextureGrow(atlas);
@@ -4254,21 +4375,176 @@ void ImFontAtlasBuildDestroy(ImFontAtlas* atlas)
     atlas->Builder = NULL;
 }
 
+static void ImFontAtlasPackGuillotineAddFree(ImFontAtlasBuilder* builder, const ImTextureRect& r);
+
 void ImFontAtlasPackInit(ImFontAtlas * atlas)
 {
     ImTextureData* tex = atlas->TexData;
     ImFontAtlasBuilder* builder = atlas->Builder;
 
-    // In theory we could decide to reduce the number of nodes, e.g. halve them, and waste a little texture space, but it doesn't seem worth it.
-    const int pack_node_count = tex->Width / 2;
-    builder->PackNodes.resize(pack_node_count);
-    IM_STATIC_ASSERT(sizeof(stbrp_context) <= sizeof(stbrp_context_opaque));
-    stbrp_init_target((stbrp_context*)(void*)&builder->PackContext, tex->Width, tex->Height, builder->PackNodes.Data, builder->PackNodes.Size);
+    builder->PackGuillotine = (atlas->Flags & ImFontAtlasFlags_PackGuillotine) != 0;
+    builder->PackFreeRects.resize(0);
+    builder->RectsFreeSlots.resize(0);
+    if (builder->PackGuillotine)
+    {
+        builder->PackFreeByWidth.resize(tex->Width + 1);
+        builder->PackFreeByHeight.resize(tex->Height + 1);
+        memset(builder->PackFreeByWidth.Data, -1, (size_t)builder->PackFreeByWidth.size_in_bytes());
+        memset(builder->PackFreeByHeight.Data, -1, (size_t)builder->PackFreeByHeight.size_in_bytes());
+        ImTextureRect r = { 0, 0, (unsigned short)tex->Width, (unsigned short)tex->Height };
+        ImFontAtlasPackGuillotineAddFree(builder, r);
+        builder->PackNodes.clear();
+    }
+    else
+    {
+        // In theory we could decide to reduce the number of nodes, e.g. halve them, and waste a little texture space, but it doesn't seem worth it.
+        const int pack_node_count = tex->Width / 2;
+        builder->PackNodes.resize(pack_node_count);
+        IM_STATIC_ASSERT(sizeof(stbrp_context) <= sizeof(stbrp_context_opaque));
+        stbrp_init_target((stbrp_context*)(void*)&builder->PackContext, tex->Width, tex->Height, builder->PackNodes.Data, builder->PackNodes.Size);
+    }
     builder->RectsPackedSurface = builder->RectsPackedCount = 0;
     builder->MaxRectSize = ImVec2i(0, 0);
     builder->MaxRectBounds = ImVec2i(0, 0);
 }
 
+// Guillotine packer, used with ImFontAtlasFlags_PackGuillotine (see "A Thousand Ways to Pack the Bin", Jukka Jylanki).
+// - Free space is a list of disjoint rectangles. A rectangle is placed in the free one that fits best (Best Short Side Fit),
+//   the remainder is split in two along the shorter leftover axis.
+// - Discarded rectangles go back to the list right away and are merged with free neighbors sharing a full edge.
+//   When the neighbors from the original split are still free, this restores the free rectangle it was cut from.
+// - Free rectangles are also linked by width and by height, so that neither has to go through the whole list:
+//   a neighbor sharing a full edge has the same width or the same height, and a rectangle leaving d pixels of width
+//   or height is in the width list w + d or the height list h + d, visited by increasing d until d exceeds the best fit.
+static void ImFontAtlasPackGuillotineAddFree(ImFontAtlasBuilder* builder, const ImTextureRect& r)
+{
+    IM_ASSERT(r.w < builder->PackFreeByWidth.Size && r.h < builder->PackFreeByHeight.Size);
+    const int n = builder->PackFreeRects.Size;
+    int& head_w = builder->PackFreeByWidth[r.w];
+    int& head_h = builder->PackFreeByHeight[r.h];
+    ImFontAtlasPackFreeRect f = { r, -1, head_w, -1, head_h };
+    if (head_w != -1)
+        builder->PackFreeRects[head_w].PrevSameW = n;
+    if (head_h != -1)
+        builder->PackFreeRects[head_h].PrevSameH = n;
+    head_w = head_h = n;
+    builder->PackFreeRects.push_back(f);
+}
+
+static void ImFontAtlasPackGuillotineRemoveFree(ImFontAtlasBuilder* builder, int n)
+{
+    ImVector<ImFontAtlasPackFreeRect>& free_rects = builder->PackFreeRects;
+    const ImFontAtlasPackFreeRect f = free_rects[n];
+    if (f.PrevSameW != -1) free_rects[f.PrevSameW].NextSameW = f.NextSameW; else builder->PackFreeByWidth[f.Rect.w] = f.NextSameW;
+    if (f.NextSameW != -1) free_rects[f.NextSameW].PrevSameW = f.PrevSameW;
+    if (f.PrevSameH != -1) free_rects[f.PrevSameH].NextSameH = f.NextSameH; else builder->PackFreeByHeight[f.Rect.h] = f.NextSameH;
+    if (f.NextSameH != -1) free_rects[f.NextSameH].PrevSameH = f.PrevSameH;
+
+    // Move the last entry into the hole
+    const int last = free_rects.Size - 1;
+    if (n != last)
+    {
+        const ImFontAtlasPackFreeRect& m = free_rects[n] = free_rects[last];
+        if (m.PrevSameW != -1) free_rects[m.PrevSameW].NextSameW = n; else builder->PackFreeByWidth[m.Rect.w] = n;
+        if (m.NextSameW != -1) free_rects[m.NextSameW].PrevSameW = n;
+        if (m.PrevSameH != -1) free_rects[m.PrevSameH].NextSameH = n; else builder->PackFreeByHeight[m.Rect.h] = n;
+        if (m.NextSameH != -1) free_rects[m.NextSameH].PrevSameH = n;
+    }
+    free_rects.pop_back();
+}
+
+static bool ImFontAtlasPackGuillotineInsert(ImFontAtlasBuilder* builder, int w, int h, unsigned short* out_x, unsigned short* out_y)
+{
+    ImVector<ImFontAtlasPackFreeRect>& free_rects = builder->PackFreeRects;
+    int best_n = -1;
+    int best_short_side = INT_MAX, best_long_side = INT_MAX;
+    for (int d = 0; d <= best_short_side; d++)
+    {
+        const bool in_w = (w + d < builder->PackFreeByWidth.Size);
+        const bool in_h = (h + d < builder->PackFreeByHeight.Size);
+        if (!in_w && !in_h)
+            break;
+        for (int n = in_h ? builder->PackFreeByHeight[h + d] : -1; n != -1; n = free_rects[n].NextSameH)
+        {
+            const ImTextureRect& f = free_rects[n].Rect;
+            if (w > f.w)
+                continue;
+            const int short_side = ImMin(f.w - w, d);
+            const int long_side = ImMax(f.w - w, d);
+            if (short_side < best_short_side || (short_side == best_short_side && long_side < best_long_side))
+            {
+                best_n = n;
+                best_short_side = short_side;
+                best_long_side = long_side;
+            }
+        }
+        for (int n = in_w ? builder->PackFreeByWidth[w + d] : -1; n != -1; n = free_rects[n].NextSameW)
+        {
+            const ImTextureRect& f = free_rects[n].Rect;
+            if (h > f.h)
+                continue;
+            const int short_side = ImMin(d, f.h - h);
+            const int long_side = ImMax(d, f.h - h);
+            if (short_side < best_short_side || (short_side == best_short_side && long_side < best_long_side))
+            {
+                best_n = n;
+                best_short_side = short_side;
+                best_long_side = long_side;
+            }
+        }
+    }
+    if (best_n == -1)
+        return false;
+
+    const ImTextureRect f = free_rects[best_n].Rect;
+    ImFontAtlasPackGuillotineRemoveFree(builder, best_n);
+    const bool split_horizontal = (f.w - w) <= (f.h - h);
+    ImTextureRect right = { (unsigned short)(f.x + w), f.y, (unsigned short)(f.w - w), (unsigned short)(split_horizontal ? h : f.h) };
+    ImTextureRect bottom = { f.x, (unsigned short)(f.y + h), (unsigned short)(split_horizontal ? f.w : w), (unsigned short)(f.h - h) };
+    if (right.w > 0 && right.h > 0)
+        ImFontAtlasPackGuillotineAddFree(builder, right);
+    if (bottom.w > 0 && bottom.h > 0)
+        ImFontAtlasPackGuillotineAddFree(builder, bottom);
+
+    *out_x = f.x;
+    *out_y = f.y;
+    return true;
+}
+
+static void ImFontAtlasPackGuillotineFree(ImFontAtlasBuilder* builder, ImTextureRect r)
+{
+    ImVector<ImFontAtlasPackFreeRect>& free_rects = builder->PackFreeRects;
+    for (;;)
+    {
+        // Neighbors above or below have the same width, neighbors on the left or right the same height
+        int merge_n = -1;
+        for (int n = builder->PackFreeByWidth[r.w]; n != -1 && merge_n == -1; n = free_rects[n].NextSameW)
+        {
+            const ImTextureRect& f = free_rects[n].Rect;
+            if (f.x == r.x && (f.y + f.h == r.y || r.y + r.h == f.y))
+            {
+                r.y = ImMin(r.y, f.y);
+                r.h = (unsigned short)(r.h + f.h);
+                merge_n = n;
+            }
+        }
+        for (int n = builder->PackFreeByHeight[r.h]; n != -1 && merge_n == -1; n = free_rects[n].NextSameH)
+        {
+            const ImTextureRect& f = free_rects[n].Rect;
+            if (f.y == r.y && (f.x + f.w == r.x || r.x + r.w == f.x))
+            {
+                r.x = ImMin(r.x, f.x);
+                r.w = (unsigned short)(r.w + f.w);
+                merge_n = n;
+            }
+        }
+        if (merge_n == -1)
+            break;
+        ImFontAtlasPackGuillotineRemoveFree(builder, merge_n); // Merged: look for neighbors of the larger rectangle
+    }
+    ImFontAtlasPackGuillotineAddFree(builder, r);
+}
+
 // This is essentially a free-list pattern, it may be nice to wrap it into a dedicated type.
 static ImFontAtlasRectId ImFontAtlasPackAllocRectEntry(ImFontAtlas* atlas, int rect_idx)
 {
@@ -4295,15 +4571,15 @@ static ImFontAtlasRectId ImFontAtlasPackAllocRectEntry(ImFontAtlas* atlas, int r
 }
 
 // Overwrite existing entry
-static ImFontAtlasRectId ImFontAtlasPackReuseRectEntry(ImFontAtlas* atlas, ImFontAtlasRectEntry* index_entry)
+static ImFontAtlasRectId ImFontAtlasPackReuseRectEntry(ImFontAtlas* atlas, int rect_idx, ImFontAtlasRectEntry* index_entry)
 {
     IM_ASSERT(index_entry->IsUsed);
-    index_entry->TargetIndex = atlas->Builder->Rects.Size - 1;
+    index_entry->TargetIndex = rect_idx;
     int index_idx = atlas->Builder->RectsIndex.index_from_ptr(index_entry);
     return ImFontAtlasRectId_Make(index_idx, index_entry->Generation);
 }
 
-// This is expected to be called in batches and followed by a repack
+// This is expected to be called in batches and followed by a repack (unless using ImFontAtlasFlags_PackGuillotine)
 void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
 {
     IM_ASSERT(id != ImFontAtlasRectId_Invalid);
@@ -4316,6 +4592,7 @@ void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     int index_idx = ImFontAtlasRectId_GetIndex(id);
     ImFontAtlasRectEntry* index_entry = &builder->RectsIndex[index_idx];
     IM_ASSERT(index_entry->IsUsed && index_entry->TargetIndex >= 0);
+    const int rect_idx = index_entry->TargetIndex;
     index_entry->IsUsed = false;
     index_entry->TargetIndex = builder->RectsIndexFreeListStart;
     index_entry->Generation++;
@@ -4325,7 +4602,23 @@ void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     const int pack_padding = atlas->TexGlyphPadding;
     builder->RectsIndexFreeListStart = index_idx;
     builder->RectsDiscardedCount++;
-    builder->RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
+    if (builder->PackGuillotine)
+    {
+        // Hand the space back to the packer now. Clear the pixels so that padding around the next rectangle packed there is blank
+        // (AddRect() uploads that padding, the renderer's copy is left as is until then).
+        ImTextureData* tex = atlas->TexData;
+        if (tex != NULL && tex->Pixels != NULL)
+            ImFontAtlasTextureBlockFill(tex, rect->x, rect->y, rect->w, rect->h, IM_COL32_BLACK_TRANS);
+        ImTextureRect freed = { rect->x, rect->y, (unsigned short)(rect->w + pack_padding), (unsigned short)(rect->h + pack_padding) };
+        ImFontAtlasPackGuillotineFree(builder, freed);
+        builder->RectsFreeSlots.push_back(rect_idx);
+        builder->RectsPackedCount--;
+        builder->RectsPackedSurface -= freed.w * freed.h;
+    }
+    else
+    {
+        builder->RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
+    }
     rect->w = rect->h = 0; // Clear rectangle so it won't be packed again
 }
 
@@ -4346,13 +4639,22 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
     for (int attempts_remaining = 3; attempts_remaining >= 0; attempts_remaining--)
     {
         // Try packing
-        stbrp_rect pack_r = {};
-        pack_r.w = w + pack_padding;
-        pack_r.h = h + pack_padding;
-        stbrp_pack_rects((stbrp_context*)(void*)&builder->PackContext, &pack_r, 1);
-        r.x = (unsigned short)pack_r.x;
-        r.y = (unsigned short)pack_r.y;
-        if (pack_r.was_packed)
+        bool was_packed;
+        if (builder->PackGuillotine)
+        {
+            was_packed = ImFontAtlasPackGuillotineInsert(builder, w + pack_padding, h + pack_padding, &r.x, &r.y);
+        }
+        else
+        {
+            stbrp_rect pack_r = {};
+            pack_r.w = w + pack_padding;
+            pack_r.h = h + pack_padding;
+            stbrp_pack_rects((stbrp_context*)(void*)&builder->PackContext, &pack_r, 1);
+            r.x = (unsigned short)pack_r.x;
+            r.y = (unsigned short)pack_r.y;
+            was_packed = pack_r.was_packed != 0;
+        }
+        if (was_packed)
             break;
 
         // If we ran out of attempts, return fallback
@@ -4370,12 +4672,30 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
     builder->MaxRectBounds.y = ImMax(builder->MaxRectBounds.y, r.y + r.h + pack_padding);
     builder->RectsPackedCount++;
     builder->RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
+    if (builder->PackGuillotine && pack_padding > 0)
+    {
+        // The space may have held a discarded rectangle: upload the blank padding, the caller uploads the rectangle itself
+        ImFontAtlasTextureBlockQueueUpload(atlas, atlas->TexData, r.x + w, r.y, pack_padding, h + pack_padding);
+        ImFontAtlasTextureBlockQueueUpload(atlas, atlas->TexData, r.x, r.y + h, w, pack_padding);
+    }
 
-    builder->Rects.push_back(r);
+    int rect_idx;
+    if (builder->RectsFreeSlots.Size > 0)
+    {
+        rect_idx = builder->RectsFreeSlots.back();
+        builder->RectsFreeSlots.pop_back();
+        builder->RectsDiscardedCount--;
+        builder->Rects[rect_idx] = r;
+    }
+    else
+    {
+        rect_idx = builder->Rects.Size;
+        builder->Rects.push_back(r);
+    }
     if (overwrite_entry != NULL)
-        return ImFontAtlasPackReuseRectEntry(atlas, overwrite_entry); // Write into an existing entry instead of adding one (used during repack)
+        return ImFontAtlasPackReuseRectEntry(atlas, rect_idx, overwrite_entry); // Write into an existing entry instead of adding one (used during repack)
     else
-        return ImFontAtlasPackAllocRectEntry(atlas, builder->Rects.Size - 1);
+        return ImFontAtlasPackAllocRectEntry(atlas, rect_idx);
 }
 
 // Generally for non-user facing functions: assert on invalid ID.
@@ -4531,6 +4851,119 @@ static float BuildLoadGlyphGetAdvanceOrFallback(ImFontBaked* baked, unsigned int
 }
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
+// Batch loading for ImFontBaked::LoadGlyphs(): prepare and pack on the calling thread, rasterize with ImFontAtlas::RunJobs.
+struct ImFontBaked_GlyphJob
+{
+    const ImFontLoader* Loader;
+    ImFontConfig*       Src;
+    void*               LoaderData;
+    ImWchar             Codepoint;      // After remapping
+    int                 W, H;
+    int                 PixelsOffset;   // Into ImFontBaked_GlyphJobs::Pixels
+    ImFontGlyph         Glyph;
+};
+
+struct ImFontBaked_GlyphJobs
+{
+    ImFontBaked*                    Baked;
+    ImVector<ImFontBaked_GlyphJob>  Jobs;
+    ImVector<unsigned char>         Pixels;
+};
+
+static void ImFontBaked_RasterizeGlyphJob(void* job_data, int job_n)
+{
+    ImFontBaked_GlyphJobs* jobs = (ImFontBaked_GlyphJobs*)job_data;
+    ImFontBaked_GlyphJob& job = jobs->Jobs[job_n];
+    if (job.Glyph.Visible)
+        job.Loader->FontBakedRasterizeGlyph(job.Src, jobs->Baked, job.LoaderData, job.Codepoint, jobs->Pixels.Data + job.PixelsOffset, job.W, job.H);
+}
+
+static void ImFontBaked_BuildLoadGlyphs(ImFontBaked* baked, const ImWchar* glyph_ranges)
+{
+    ImFont* font = baked->OwnerFont;
+    ImFontAtlas* atlas = font->OwnerAtlas;
+    if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs))
+        return;
+
+    // Prepare all glyphs. Anything the loaders can't split (or that isn't found) goes through the regular path afterwards.
+    ImFontBaked_GlyphJobs jobs;
+    jobs.Baked = baked;
+    ImVector<ImWchar> serial_codepoints;
+    int pixels_size = 0;
+    for (const ImWchar* range = glyph_ranges; range[0] && range[1]; range += 2)
+        for (unsigned int src_codepoint = range[0]; src_codepoint <= range[1] && src_codepoint <= IM_UNICODE_CODEPOINT_MAX; src_codepoint++)
+        {
+            if (baked->IsGlyphLoaded((ImWchar)src_codepoint) || (src_codepoint < (unsigned int)baked->IndexLookup.Size && baked->IndexLookup.Data[src_codepoint] == IM_FONTGLYPH_INDEX_NOT_FOUND))
+                continue;
+            ImWchar codepoint = (ImWchar)src_codepoint;
+            ImFontAtlas_FontHookRemapCodepoint(atlas, font, &codepoint);
+            bool prepared = false;
+            if (codepoint != font->EllipsisChar || !font->EllipsisAutoBake)
+            {
+                char* loader_user_data_p = (char*)baked->FontLoaderDatas;
+                int src_n = 0;
+                for (ImFontConfig* src : font->Sources)
+                {
+                    const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+                    if (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
+                    {
+                        if (loader->FontBakedPrepareGlyph == NULL || loader->FontBakedRasterizeGlyph == NULL)
+                            break;
+                        ImFontBaked_GlyphJob job;
+                        if (loader->FontBakedPrepareGlyph(atlas, src, baked, loader_user_data_p, codepoint, &job.Glyph, &job.W, &job.H))
+                        {
+                            job.Glyph.Codepoint = (ImWchar)src_codepoint;
+                            job.Glyph.SourceIdx = src_n;
+                            job.Loader = loader;
+                            job.Src = src;
+                            job.LoaderData = loader_user_data_p;
+                            job.Codepoint = codepoint;
+                            job.PixelsOffset = pixels_size;
+                            pixels_size += job.W * job.H;
+                            jobs.Jobs.push_back(job);
+                            prepared = true;
+                            break;
+                        }
+                    }
+                    loader_user_data_p += loader->FontBakedSrcLoaderDataSize;
+                    src_n++;
+                }
+            }
+            if (!prepared)
+                serial_codepoints.push_back((ImWchar)src_codepoint);
+        }
+
+    // Rasterize
+    jobs.Pixels.resize(pixels_size, 0);
+    if (atlas->RunJobs != NULL && jobs.Jobs.Size > 1)
+        atlas->RunJobs(ImFontBaked_RasterizeGlyphJob, &jobs, jobs.Jobs.Size);
+    else
+        for (int job_n = 0; job_n < jobs.Jobs.Size; job_n++)
+            ImFontBaked_RasterizeGlyphJob(&jobs, job_n);
+
+    // Pack and copy
+    for (ImFontBaked_GlyphJob& job : jobs.Jobs)
+    {
+        if (baked->IsGlyphLoaded(job.Glyph.Codepoint)) // Duplicate in ranges
+            continue;
+        if (job.Glyph.Visible)
+        {
+            ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, job.W, job.H);
+            if (pack_id == ImFontAtlasRectId_Invalid)
+            {
+                IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+                break;
+            }
+            ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+            job.Glyph.PackId = pack_id;
+            ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, job.Src, &job.Glyph, r, jobs.Pixels.Data + job.PixelsOffset, ImTextureFormat_Alpha8, job.W);
+        }
+        ImFontAtlasBakedAddFontGlyph(atlas, baked, job.Src, &job.Glyph);
+    }
+    for (ImWchar codepoint : serial_codepoints)
+        baked->FindGlyphNoFallback(codepoint);
+}
+
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
 void ImFontAtlasDebugLogTextureRequests(ImFontAtlas* atlas)
 {
@@ -4649,8 +5082,13 @@ static bool ImGui_ImplStbTrueType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig
     return true;
 }
 
-static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+// Compute glyph metrics and bitmap size without rendering anything.
+// Glyph positions (X0/Y0/X1/Y1) only depend on bitmap size, so rendering may happen later or on another thread (see ImGui_ImplStbTrueType_RasterizeGlyph()).
+// ImFontFlags_DistanceField: no oversampling, the field is generated at baked->Size (== IMGUI_FONT_SDF_BAKE_SIZE) and scaled when rendering.
+static bool ImGui_ImplStbTrueType_FontBakedPrepareGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, int* out_w, int* out_h)
 {
+    IM_UNUSED(atlas);
+
     // Search for first font which has the glyph
     ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
     IM_ASSERT(bd_font_data);
@@ -4659,10 +5097,12 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         return false;
 
     // Fonts unit to pixels
-    int oversample_h, oversample_v;
-    ImFontAtlasBuildGetOversampleFactors(src, baked, &oversample_h, &oversample_v);
+    const bool is_sdf = (baked->OwnerFont->Flags & ImFontFlags_DistanceField) != 0;
+    int oversample_h = 1, oversample_v = 1;
+    if (!is_sdf)
+        ImFontAtlasBuildGetOversampleFactors(src, baked, &oversample_h, &oversample_v);
     const float scale_for_layout = bd_font_data->ScaleFactor * baked->Size;
-    const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
+    const float rasterizer_density = is_sdf ? 1.0f : src->RasterizerDensity * baked->RasterizerDensity;
     const float scale_for_raster_x = bd_font_data->ScaleFactor * baked->Size * rasterizer_density * oversample_h;
     const float scale_for_raster_y = bd_font_data->ScaleFactor * baked->Size * rasterizer_density * oversample_v;
 
@@ -4672,72 +5112,145 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     stbtt_GetGlyphBitmapBoxSubpixel(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, 0, 0, &x0, &y0, &x1, &y1);
     stbtt_GetGlyphHMetrics(&bd_font_data->FontInfo, glyph_index, &advance, &lsb);
 
+    // Prepare glyph
+    out_glyph->Codepoint = codepoint;
+    out_glyph->AdvanceX = advance * scale_for_layout;
+    *out_w = *out_h = 0;
+    const bool is_visible = (x0 != x1 && y0 != y1);
+    if (!is_visible)
+        return true;
+
+    const float ref_size = baked->OwnerFont->Sources[0]->SizePixels;
+    const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
+    float font_off_x = (src->GlyphOffset.x * offsets_scale);
+    float font_off_y = (src->GlyphOffset.y * offsets_scale);
+    if (is_sdf)
+    {
+        // Same box as stbtt_GetGlyphSDF()
+        const int padding = IMGUI_FONT_SDF_PADDING;
+        x0 -= padding;
+        y0 -= padding;
+        x1 += padding;
+        y1 += padding;
+        *out_w = x1 - x0;
+        *out_h = y1 - y0;
+        font_off_y += IM_ROUND(baked->Ascent);
+        out_glyph->X0 = x0 + font_off_x;
+        out_glyph->Y0 = y0 + font_off_y;
+        out_glyph->X1 = x1 + font_off_x;
+        out_glyph->Y1 = y1 + font_off_y;
+        out_glyph->Visible = true;
+        return true;
+    }
+
+    // (generally based on stbtt_PackFontRangesRenderIntoRects)
+    const int w = (x1 - x0 + oversample_h - 1);
+    const int h = (y1 - y0 + oversample_v - 1);
+    *out_w = w;
+    *out_h = h;
+    stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, &x0, &y0, &x1, &y1);
+    if (src->PixelSnapH) // Snap scaled offset. This is to mitigate backward compatibility issues for GlyphOffset, but a better design would be welcome.
+        font_off_x = IM_ROUND(font_off_x);
+    if (src->PixelSnapV)
+        font_off_y = IM_ROUND(font_off_y);
+    font_off_x += (float)-(oversample_h - 1) / (2.0f * oversample_h); // == sub_x/sub_y outputs of stbtt_MakeGlyphBitmapSubpixelPrefilter()
+    font_off_y += (float)-(oversample_v - 1) / (2.0f * oversample_v) + IM_ROUND(baked->Ascent);
+    float recip_h = 1.0f / (oversample_h * rasterizer_density);
+    float recip_v = 1.0f / (oversample_v * rasterizer_density);
+
+    // glyph.X0, glyph.Y0 are drawing coordinates from base text position, and accounting for oversampling.
+    out_glyph->X0 = x0 * recip_h + font_off_x;
+    out_glyph->Y0 = y0 * recip_v + font_off_y;
+    out_glyph->X1 = (x0 + w) * recip_h + font_off_x;
+    out_glyph->Y1 = (y0 + h) * recip_v + font_off_y;
+    out_glyph->Visible = true;
+    return true;
+}
+
+// Render a glyph prepared by ImGui_ImplStbTrueType_FontBakedPrepareGlyph() into a cleared w*h Alpha8 bitmap.
+// Only reads font data, so may run concurrently for the same font. All allocations go through 'font_info->userdata' (see ImGui_ImplStbTrueType_MemAlloc()).
+static void ImGui_ImplStbTrueType_RasterizeGlyph(const stbtt_fontinfo* font_info, ImFontConfig* src, ImFontBaked* baked, float scale_factor, ImWchar codepoint, unsigned char* pixels, int w, int h)
+{
+    int glyph_index = stbtt_FindGlyphIndex(font_info, (int)codepoint);
+    if (baked->OwnerFont->Flags & ImFontFlags_DistanceField)
+    {
+        // Values are 128 on the edge, +/- 128 over IMGUI_FONT_SDF_PADDING pixels inside/outside.
+        const int padding = IMGUI_FONT_SDF_PADDING;
+        int sdf_w = 0, sdf_h = 0, sdf_x0, sdf_y0;
+        unsigned char* sdf_pixels = stbtt_GetGlyphSDF(font_info, scale_factor * baked->Size, glyph_index, padding, 128, 128.0f / padding, &sdf_w, &sdf_h, &sdf_x0, &sdf_y0);
+        IM_ASSERT(sdf_pixels != NULL && sdf_w == w && sdf_h == h);
+        if (sdf_pixels != NULL)
+            memcpy(pixels, sdf_pixels, (size_t)w * h);
+        stbtt_FreeSDF(sdf_pixels, font_info->userdata);
+        return;
+    }
+
+    int oversample_h, oversample_v;
+    ImFontAtlasBuildGetOversampleFactors(src, baked, &oversample_h, &oversample_v);
+    const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
+    const float scale_for_raster_x = scale_factor * baked->Size * rasterizer_density * oversample_h;
+    const float scale_for_raster_y = scale_factor * baked->Size * rasterizer_density * oversample_v;
+
+    // Render with oversampling
+    // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
+    float sub_x, sub_y;
+    stbtt_MakeGlyphBitmapSubpixelPrefilter(font_info, pixels, w, h, w,
+        scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
+}
+
+static void ImGui_ImplStbTrueType_FontBakedRasterizeGlyph(ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, unsigned char* pixels, int w, int h)
+{
+    ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
+    stbtt_fontinfo font_info = bd_font_data->FontInfo;
+    font_info.userdata = bd_font_data; // Any thread: bypass ImGui::MemAlloc()
+    ImGui_ImplStbTrueType_RasterizeGlyph(&font_info, src, baked, bd_font_data->ScaleFactor, codepoint, pixels, w, h);
+}
+
+static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+{
+    ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
+    IM_ASSERT(bd_font_data);
+
     // Load metrics only mode
     if (out_advance_x != NULL)
     {
         IM_ASSERT(out_glyph == NULL);
-        *out_advance_x = advance * scale_for_layout;
+        int glyph_index = stbtt_FindGlyphIndex(&bd_font_data->FontInfo, (int)codepoint);
+        if (glyph_index == 0)
+            return false;
+        int advance, lsb;
+        stbtt_GetGlyphHMetrics(&bd_font_data->FontInfo, glyph_index, &advance, &lsb);
+        *out_advance_x = advance * bd_font_data->ScaleFactor * baked->Size;
         return true;
     }
 
-    // Prepare glyph
-    out_glyph->Codepoint = codepoint;
-    out_glyph->AdvanceX = advance * scale_for_layout;
+    int w, h;
+    if (!ImGui_ImplStbTrueType_FontBakedPrepareGlyph(atlas, src, baked, loader_data_for_baked_src, codepoint, out_glyph, &w, &h))
+        return false;
+    if (!out_glyph->Visible)
+        return true;
 
     // Pack and retrieve position inside texture atlas
-    // (generally based on stbtt_PackFontRangesRenderIntoRects)
-    const bool is_visible = (x0 != x1 && y0 != y1);
-    if (is_visible)
+    ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
+    if (pack_id == ImFontAtlasRectId_Invalid)
     {
-        const int w = (x1 - x0 + oversample_h - 1);
-        const int h = (y1 - y0 + oversample_v - 1);
-        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
-        if (pack_id == ImFontAtlasRectId_Invalid)
-        {
-            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
-            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
-            return false;
-        }
-        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
-
-        // Render
-        stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, &x0, &y0, &x1, &y1);
-        ImFontAtlasBuilder* builder = atlas->Builder;
-        builder->TempBuffer.resize(w * h * 1);
-        unsigned char* bitmap_pixels = builder->TempBuffer.Data;
-        memset(bitmap_pixels, 0, w * h * 1);
-
-        // Render with oversampling
-        // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
-        float sub_x, sub_y;
-        stbtt_MakeGlyphBitmapSubpixelPrefilter(&bd_font_data->FontInfo, bitmap_pixels, w, h, w,
-            scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
-
-        const float ref_size = baked->OwnerFont->Sources[0]->SizePixels;
-        const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
-        float font_off_x = (src->GlyphOffset.x * offsets_scale);
-        float font_off_y = (src->GlyphOffset.y * offsets_scale);
-        if (src->PixelSnapH) // Snap scaled offset. This is to mitigate backward compatibility issues for GlyphOffset, but a better design would be welcome.
-            font_off_x = IM_ROUND(font_off_x);
-        if (src->PixelSnapV)
-            font_off_y = IM_ROUND(font_off_y);
-        font_off_x += sub_x;
-        font_off_y += sub_y + IM_ROUND(baked->Ascent);
-        float recip_h = 1.0f / (oversample_h * rasterizer_density);
-        float recip_v = 1.0f / (oversample_v * rasterizer_density);
-
-        // Register glyph
-        // r->x r->y are coordinates inside texture (in pixels)
-        // glyph.X0, glyph.Y0 are drawing coordinates from base text position, and accounting for oversampling.
-        out_glyph->X0 = x0 * recip_h + font_off_x;
-        out_glyph->Y0 = y0 * recip_v + font_off_y;
-        out_glyph->X1 = (x0 + (int)r->w) * recip_h + font_off_x;
-        out_glyph->Y1 = (y0 + (int)r->h) * recip_v + font_off_y;
-        out_glyph->Visible = true;
-        out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap_pixels, ImTextureFormat_Alpha8, w);
+        // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+        IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+        return false;
     }
+    ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
 
+    // Render
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    builder->TempBuffer.resize(w * h * 1);
+    unsigned char* bitmap_pixels = builder->TempBuffer.Data;
+    memset(bitmap_pixels, 0, w * h * 1);
+    ImGui_ImplStbTrueType_RasterizeGlyph(&bd_font_data->FontInfo, src, baked, bd_font_data->ScaleFactor, codepoint, bitmap_pixels, w, h);
+
+    // Register glyph
+    // r->x r->y are coordinates inside texture (in pixels)
+    out_glyph->PackId = pack_id;
+    ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap_pixels, ImTextureFormat_Alpha8, w);
     return true;
 }
 
@@ -4751,6 +5264,8 @@ const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
     loader.FontBakedInit = ImGui_ImplStbTrueType_FontBakedInit;
     loader.FontBakedDestroy = NULL;
     loader.FontBakedLoadGlyph = ImGui_ImplStbTrueType_FontBakedLoadGlyph;
+    loader.FontBakedPrepareGlyph = ImGui_ImplStbTrueType_FontBakedPrepareGlyph;
+    loader.FontBakedRasterizeGlyph = ImGui_ImplStbTrueType_FontBakedRasterizeGlyph;
     return &loader;
 }
 
@@ -5257,6 +5772,26 @@ ImFontGlyph* ImFontBaked::FindGlyphNoFallback(ImWchar c)
     return glyph;
 }
 
+// Same as FindGlyph() but return NULL instead of loading. Only reads IndexLookup[]/Glyphs[], so this may be used
+// from another thread as long as nothing is adding glyphs to this ImFontBaked at the same time.
+ImFontGlyph* ImFontBaked::FindGlyphNoLoad(ImWchar c)
+{
+    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    {
+        const int i = (int)IndexLookup.Data[c];
+        if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
+            return &Glyphs.Data[FallbackGlyphIndex];
+        if (i != IM_FONTGLYPH_INDEX_UNUSED)
+            return &Glyphs.Data[i];
+    }
+    return NULL;
+}
+
+void ImFontBaked::LoadGlyphs(const ImWchar* glyph_ranges)
+{
+    ImFontBaked_BuildLoadGlyphs(this, glyph_ranges);
+}
+
 bool ImFontBaked::IsGlyphLoaded(ImWchar c)
 {
     if (c < (size_t)IndexLookup.Size) IM_LIKELY
@@ -5319,6 +5854,12 @@ ImFontBaked* ImFont::GetFontBaked(float size, float density)
 
     if (density < 0.0f)
         density = CurrentRasterizerDensity;
+    if (Flags & ImFontFlags_DistanceField)
+    {
+        // Distance fields are baked once and scaled to every size (callers use size / baked->Size as scale)
+        size = IMGUI_FONT_SDF_BAKE_SIZE;
+        density = 1.0f;
+    }
     if (baked && baked->Size == size && baked->RasterizerDensity == density)
         return baked;
 
@@ -5332,6 +5873,35 @@ ImFontBaked* ImFont::GetFontBaked(float size, float density)
     return baked;
 }
 
+// Read-only counterpart to GetFontBaked(): doesn't create anything nor update LastBaked/LastUsedFrame.
+// We scan BakedPool[] rather than BakedMap, as ImGuiStorage lookups may lazily rebuild their index with IMGUI_STORAGE_HASHED.
+// The caller is responsible for keeping the size alive, e.g. by using it from the main thread every frame.
+ImFontBaked* ImFont::FindFontBaked(float size, float density)
+{
+    size = ImGui::GetRoundedFontSize(size);
+    if (density < 0.0f)
+        density = CurrentRasterizerDensity;
+    if (Flags & ImFontFlags_DistanceField)
+    {
+        size = IMGUI_FONT_SDF_BAKE_SIZE;
+        density = 1.0f;
+    }
+    ImFontBaked* baked = LastBaked;
+    if (baked && baked->Size == size && baked->RasterizerDensity == density)
+        return baked;
+
+    ImFontAtlasBuilder* builder = OwnerAtlas ? OwnerAtlas->Builder : NULL;
+    if (builder == NULL)
+        return NULL;
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        baked = &builder->BakedPool[baked_n];
+        if (baked->OwnerFont == this && baked->Size == size && baked->RasterizerDensity == density && !baked->WantDestroy)
+            return baked;
+    }
+    return NULL;
+}
+
 ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density)
 {
     // FIXME-NEWATLAS: Design for picking a nearest size based on some criteria?
@@ -5620,8 +6190,62 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         if (y1 >= y2)
             return;
     }
+    const ImDrawCmdFlags backup_cmd_flags = draw_list->_CmdHeader.Flags;
+    if (Flags & ImFontFlags_DistanceField)
+        draw_list->_SetDrawCmdFlags(backup_cmd_flags | ImDrawCmdFlags_DistanceFieldText);
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
+    draw_list->_SetDrawCmdFlags(backup_cmd_flags);
+}
+
+// Vectorized glyph emission for ImFont::RenderText(): the four corner coordinates of a glyph are positioned in one SIMD operation
+// (same mul+add per lane as the scalar code, so output is identical) and each vertex pos+uv is written with a single 16-byte store.
+// Indices don't depend on glyph data, so they are written in bulk once all quads are known (see ImFontRenderTextWriteQuadIndices()).
+// Fine CPU clipping (ImDrawTextFlags_CpuFineClip) and custom vertex layouts keep using the scalar path.
+#if (defined(IMGUI_ENABLE_SSE) || defined(IMGUI_ENABLE_NEON)) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+#define IMGUI_ENABLE_SIMD_TEXT_VERTICES
+#endif
+
+// Write indices for 'quad_count' consecutive quads starting at vertex 'vtx_index', using the 0,1,2, 0,2,3 pattern of PrimRectUV().
+static ImDrawIdx* ImFontRenderTextWriteQuadIndices(ImDrawIdx* idx_write, unsigned int vtx_index, int quad_count)
+{
+    int n = 0;
+#if defined(IMGUI_ENABLE_SSE) || defined(IMGUI_ENABLE_NEON)
+    if (sizeof(ImDrawIdx) == 2)
+    {
+        // 4 quads = 24 indices = 3 stores of 8 x 16-bit lanes. 16-bit lanes wrap like the (ImDrawIdx) casts of the scalar loop.
+        static const short pattern[24] = { 0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7, 8, 9, 10, 8, 10, 11, 12, 13, 14, 12, 14, 15 };
+#if defined(IMGUI_ENABLE_SSE)
+        const __m128i p0 = _mm_loadu_si128((const __m128i*)(const void*)(pattern + 0));
+        const __m128i p1 = _mm_loadu_si128((const __m128i*)(const void*)(pattern + 8));
+        const __m128i p2 = _mm_loadu_si128((const __m128i*)(const void*)(pattern + 16));
+        for (; n + 4 <= quad_count; n += 4, vtx_index += 16, idx_write += 24)
+        {
+            const __m128i base = _mm_set1_epi16((short)vtx_index);
+            _mm_storeu_si128((__m128i*)(void*)(idx_write + 0), _mm_add_epi16(base, p0));
+            _mm_storeu_si128((__m128i*)(void*)(idx_write + 8), _mm_add_epi16(base, p1));
+            _mm_storeu_si128((__m128i*)(void*)(idx_write + 16), _mm_add_epi16(base, p2));
+        }
+#else
+        const uint16x8_t p0 = vld1q_u16((const uint16_t*)pattern + 0);
+        const uint16x8_t p1 = vld1q_u16((const uint16_t*)pattern + 8);
+        const uint16x8_t p2 = vld1q_u16((const uint16_t*)pattern + 16);
+        for (; n + 4 <= quad_count; n += 4, vtx_index += 16, idx_write += 24)
+        {
+            const uint16x8_t base = vdupq_n_u16((uint16_t)vtx_index);
+            vst1q_u16((uint16_t*)(void*)(idx_write + 0), vaddq_u16(base, p0));
+            vst1q_u16((uint16_t*)(void*)(idx_write + 8), vaddq_u16(base, p1));
+            vst1q_u16((uint16_t*)(void*)(idx_write + 16), vaddq_u16(base, p2));
+        }
+#endif
+    }
+#endif
+    for (; n < quad_count; n++, vtx_index += 4, idx_write += 6)
+    {
+        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+    }
+    return idx_write;
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
@@ -5638,12 +6262,17 @@ begin:
     if (!text_end)
         text_end = text_begin + ImStrlen(text_begin); // ImGui:: functions generally already provides a valid text_end, so this is merely to handle direct calls.
 
+    // With ImDrawListFlags_NoFontLoading we may be running outside of the ImGui thread: only read what's already baked.
+    const bool no_font_loading = (draw_list->Flags & ImDrawListFlags_NoFontLoading) != 0;
     const float line_height = size;
-    ImFontBaked* baked = GetFontBaked(size);
+    ImFontBaked* baked = no_font_loading ? FindFontBaked(size) : GetFontBaked(size);
+    if (baked == NULL)
+        return;
 
     const float scale = size / baked->Size;
     const float origin_x = x;
     const bool word_wrap_enabled = (wrap_width > 0.0f);
+    IM_ASSERT((!word_wrap_enabled || !no_font_loading) && "Word-wrapping needs to load glyph advances, not supported with ImDrawListFlags_NoFontLoading.");
 
     // Fast-forward to first visible line
     const char* s = text_begin;
@@ -5683,6 +6312,10 @@ begin:
     if (s == text_end)
         return;
 
+    // Distance field glyphs go to their own draw commands, so the backend only thresholds those (see ImDrawCmdFlags_DistanceFieldText)
+    if (Flags & ImFontFlags_DistanceField)
+        draw_list->_SetDrawCmdFlags(draw_list->_CmdHeader.Flags | ImDrawCmdFlags_DistanceFieldText);
+
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
     const int vtx_count_max = (int)(text_end - s) * 4;
     const int idx_count_max = (int)(text_end - s) * 6;
@@ -5691,11 +6324,13 @@ begin:
     ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+    const unsigned int vtx_index_start = vtx_index;
     const int cmd_count = draw_list->CmdBuffer.Size;
     const bool cpu_fine_clip = (flags & ImDrawTextFlags_CpuFineClip) != 0;
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
+    const char* ascii_end = s; // Bytes in [s, ascii_end) are known to be 1..0x7F, see ImTextCountAsciiPrefix()
 
     while (s < text_end)
     {
@@ -5717,9 +6352,11 @@ begin:
             }
         }
 
-        // Decode and advance source
-        unsigned int c = (unsigned int)*s;
-        if (c < 0x80)
+        // Decode and advance source. ASCII runs are located 16 bytes at a time and fed to FindGlyph() directly.
+        unsigned int c = (unsigned char)*s;
+        if (s >= ascii_end && c < 0x80)
+            ascii_end = s + ImTextCountAsciiPrefix(s, text_end);
+        if (s < ascii_end || c < 0x80)
             s += 1;
         else
             s += ImTextCharFromUtf8(&c, s, text_end);
@@ -5738,11 +6375,49 @@ begin:
                 continue;
         }
 
-        const ImFontGlyph* glyph = baked->FindGlyph((ImWchar)c);
-        //if (glyph == NULL)
-        //    continue;
+        const ImFontGlyph* glyph = no_font_loading ? baked->FindGlyphNoLoad((ImWchar)c) : baked->FindGlyph((ImWchar)c);
+        if (glyph == NULL)
+            continue;
 
         float char_width = glyph->AdvanceX * scale;
+#ifdef IMGUI_ENABLE_SIMD_TEXT_VERTICES
+        if (glyph->Visible && !cpu_fine_clip)
+        {
+            // Lanes are x1, y1, x2, y2: (x, y, x, y) + (X0, Y0, X1, Y1) * scale. Vertices are (x1,y1,u1,v1) (x2,y1,u2,v1) (x2,y2,u2,v2) (x1,y2,u1,v2).
+#if defined(IMGUI_ENABLE_SSE)
+            const __m128 xy = _mm_add_ps(_mm_setr_ps(x, y, x, y), _mm_mul_ps(_mm_loadu_ps(&glyph->X0), _mm_set1_ps(scale)));
+            const float x1 = _mm_cvtss_f32(xy);
+            const float x2 = _mm_cvtss_f32(_mm_movehl_ps(xy, xy));
+            if (x1 <= clip_rect.z && x2 >= clip_rect.x)
+            {
+                const __m128 uv = _mm_loadu_ps(&glyph->U0);
+                _mm_storeu_ps(&vtx_write[0].pos.x, _mm_movelh_ps(xy, uv));
+                _mm_storeu_ps(&vtx_write[1].pos.x, _mm_shuffle_ps(xy, uv, _MM_SHUFFLE(1, 2, 1, 2)));
+                _mm_storeu_ps(&vtx_write[2].pos.x, _mm_movehl_ps(uv, xy));
+                _mm_storeu_ps(&vtx_write[3].pos.x, _mm_shuffle_ps(xy, uv, _MM_SHUFFLE(3, 0, 3, 0)));
+#else
+            const float32x2_t pen = vset_lane_f32(y, vdup_n_f32(x), 1);
+            const float32x4_t xy = vaddq_f32(vcombine_f32(pen, pen), vmulq_n_f32(vld1q_f32(&glyph->X0), scale));
+            const float x1 = vgetq_lane_f32(xy, 0);
+            const float x2 = vgetq_lane_f32(xy, 2);
+            if (x1 <= clip_rect.z && x2 >= clip_rect.x)
+            {
+                const float32x4_t uv = vld1q_f32(&glyph->U0);
+                const float32x2_t xy_21 = vrev64_f32(vext_f32(vget_low_f32(xy), vget_high_f32(xy), 1)), uv_21 = vrev64_f32(vext_f32(vget_low_f32(uv), vget_high_f32(uv), 1));
+                const float32x2_t xy_03 = vrev64_f32(vext_f32(vget_high_f32(xy), vget_low_f32(xy), 1)), uv_03 = vrev64_f32(vext_f32(vget_high_f32(uv), vget_low_f32(uv), 1));
+                vst1q_f32(&vtx_write[0].pos.x, vcombine_f32(vget_low_f32(xy), vget_low_f32(uv)));
+                vst1q_f32(&vtx_write[1].pos.x, vcombine_f32(xy_21, uv_21));
+                vst1q_f32(&vtx_write[2].pos.x, vcombine_f32(vget_high_f32(xy), vget_high_f32(uv)));
+                vst1q_f32(&vtx_write[3].pos.x, vcombine_f32(xy_03, uv_03));
+#endif
+                const ImU32 glyph_col = glyph->Colored ? col_untinted : col;
+                vtx_write[0].col = vtx_write[1].col = vtx_write[2].col = vtx_write[3].col = glyph_col;
+                vtx_write += 4;
+                vtx_index += 4;
+            }
+        }
+        else
+#endif
         if (glyph->Visible)
         {
             // We don't do a second finer clipping test on the Y axis as we've already skipped anything before clip_rect.y and exit once we pass clip_rect.w
@@ -5797,16 +6472,14 @@ begin:
                     vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
                     vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
                     vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
-                    idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
-                    idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
                     vtx_write += 4;
                     vtx_index += 4;
-                    idx_write += 6;
                 }
             }
         }
         x += char_width;
     }
+    idx_write = ImFontRenderTextWriteQuadIndices(idx_write, vtx_index_start, (int)(vtx_index - vtx_index_start) / 4);
 
     // Edge case: calling RenderText() with unloaded glyphs triggering texture change. It doesn't happen via ImGui:: calls because CalcTextSize() is always used.
     if (cmd_count != draw_list->CmdBuffer.Size) //-V547
@@ -5829,6 +6502,8 @@ begin:
     draw_list->_VtxWritePtr = vtx_write;
     draw_list->_IdxWritePtr = idx_write;
     draw_list->_VtxCurrentIdx = vtx_index;
+    if (Flags & ImFontFlags_DistanceField)
+        draw_list->_SetDrawCmdFlags(draw_list->_CmdHeader.Flags & ~ImDrawCmdFlags_DistanceFieldText);
 }
 
 //-----------------------------------------------------------------------------
@@ -72,6 +72,19 @@ Index of this file:
 #if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(__EMSCRIPTEN__)
 #define IMGUI_ENABLE_SSE4_2_CRC
 #endif
+// Enable ARMv8 CRC32 instructions if available (e.g. -march=armv8-a+crc). They provide both polynomials: CRC32C for the default table, CRC32 for the legacy one.
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32) && !defined(IMGUI_DISABLE_ARM_CRC32)
+#define IMGUI_ENABLE_ARM_CRC32
+#include <arm_acle.h>
+#endif
+#if defined(IMGUI_ENABLE_SSE4_2_CRC) || defined(IMGUI_ENABLE_ARM_CRC32)
+#define IMGUI_ENABLE_HW_CRC32
+#endif
+// Enable NEON intrinsics if available (always present on AArch64)
+#if defined(__aarch64__) && defined(__ARM_NEON) && !defined(IMGUI_DISABLE_NEON)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -424,6 +437,7 @@ IMGUI_API int           ImTextStrToUtf8(char* out_buf, int out_buf_size, const I
 IMGUI_API int           ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char* in_text_end);               // read one character. return input UTF-8 bytes count
 IMGUI_API int           ImTextStrFromUtf8(ImWchar* out_buf, int out_buf_size, const char* in_text, const char* in_text_end, const char** in_remaining = NULL);   // return input UTF-8 bytes count
 IMGUI_API int           ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end);                                 // return number of UTF-8 code-points (NOT bytes count)
+IMGUI_API int           ImTextCountAsciiPrefix(const char* in_text, const char* in_text_end);                                   // return number of leading 7-bit ASCII bytes. stops at 0 and at first byte >= 0x80. in_text_end is required.
 IMGUI_API int           ImTextCountUtf8BytesFromChar(const char* in_text, const char* in_text_end);                             // return number of bytes to express one char in UTF-8
 IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end);                        // return number of bytes to express string in UTF-8
 IMGUI_API const char*   ImTextFindPreviousUtf8Codepoint(const char* in_text_start, const char* in_p);                           // return previous UTF-8 code-point.
@@ -814,6 +828,30 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+// Helper: ImGuiTextSizeCache
+// Remember CalcTextSize() results so static labels only cost a hash lookup after their first frame.
+// Keyed by a 64-bit hash of the text bytes, font, font size, wrap width and atlas generation.
+// 4-way set associative: the least recently used way of a set is recycled.
+#define IMGUI_TEXT_SIZE_CACHE_SETS      256     // Must be a power of two
+#define IMGUI_TEXT_SIZE_CACHE_WAYS      4
+#ifndef IMGUI_TEXT_SIZE_CACHE_MIN_LEN
+#define IMGUI_TEXT_SIZE_CACHE_MIN_LEN   8       // Shorter strings are measured directly: a lookup costs about as much as measuring 8 characters
+#endif
+struct ImGuiTextSizeCacheEntry
+{
+    ImU64           Key;                                    // 0 = unused
+    int             TextLen;
+    int             LastUsedFrame;
+    ImVec2          Size;                                   // Unrounded, as returned by ImFont::CalcTextSizeA()
+};
+
+struct ImGuiTextSizeCache
+{
+    ImVector<ImGuiTextSizeCacheEntry> Entries;              // SETS * WAYS, allocated on first use
+
+    void            clear()                                 { Entries.clear(); }
+};
+
 // Helper: ImGuiStorage
 IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStoragePair* in_end, ImGuiID key);
 
@@ -875,6 +913,7 @@ struct IMGUI_API ImDrawListSharedData
     ImDrawListSharedData();
     ~ImDrawListSharedData();
     void SetCircleTessellationMaxError(float max_error);
+    void CopySettingsFrom(const ImDrawListSharedData& src); // Copy everything but TempBuffer/DrawLists/Context, e.g. to give each worker thread building ImDrawList its own instance.
 };
 
 struct ImDrawDataBuilder
@@ -2553,6 +2592,7 @@ struct ImGuiContext
     int                     WantTextInputNextFrame;             // Copied in EndFrame() from g.PlatformImeData.WantTextInput. Needs to be set for some backends (SDL3) to emit character inputs.
     ImVector<char>          TempBuffer;                         // Temporary text buffer
     char                    TempKeychordName[64];
+    ImGuiTextSizeCache      TextSizeCache;                      // CalcTextSize() results of recently measured text
 
     ImGuiContext(ImFontAtlas* shared_font_atlas);
     ~ImGuiContext();
@@ -3756,6 +3796,12 @@ struct ImFontLoader
     void            (*FontBakedDestroy)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src);
     bool            (*FontBakedLoadGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x);
 
+    // [Optional] FontBakedLoadGlyph() split in two, used by ImFontBaked::LoadGlyphs() to rasterize glyphs in parallel. Leave NULL to load glyphs one at a time.
+    // - FontBakedPrepareGlyph(): called on the owning thread. Fill glyph metrics and the size of its Alpha8 bitmap, don't pack or render. Return false if source doesn't have the glyph.
+    // - FontBakedRasterizeGlyph(): may be called from any thread, concurrently. Render into 'pixels' (w*h, cleared to zero). Must not modify atlas, font or baked data.
+    bool            (*FontBakedPrepareGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, int* out_w, int* out_h);
+    void            (*FontBakedRasterizeGlyph)(ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, unsigned char* pixels, int w, int h);
+
     // Size of backend data, Per Baked * Per Source. Buffers are managed by core to avoid excessive allocations.
     // FIXME: At this point the two other types of buffers may be managed by core to be consistent?
     size_t          FontBakedSrcLoaderDataSize;
@@ -3777,6 +3823,15 @@ typedef ImFontLoader ImFontBuilderIO; // [renamed/changed in 1.92] The types are
 #define IMGUI_FONT_SIZE_MAX                                     (512.0f)
 #define IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE      (128.0f)
 
+// ImFontFlags_DistanceField: single size all glyphs are baked at, and distance in pixels covered by the field on each side of the edge.
+// Their draw commands are tagged with ImDrawCmdFlags_DistanceFieldText (see ImGuiBackendFlags_RendererHasDistanceFieldText).
+#ifndef IMGUI_FONT_SDF_BAKE_SIZE
+#define IMGUI_FONT_SDF_BAKE_SIZE                                (32.0f)
+#endif
+#ifndef IMGUI_FONT_SDF_PADDING
+#define IMGUI_FONT_SDF_PADDING                                  (4)
+#endif
+
 // Helpers: ImTextureRef ==/!= operators provided as convenience
 // (note that _TexID and _TexData are never set simultaneously)
 inline bool operator==(const ImTextureRef& lhs, const ImTextureRef& rhs)    { return lhs._TexID == rhs._TexID && lhs._TexData == rhs._TexData; }
@@ -3829,14 +3884,26 @@ typedef stbrp_node stbrp_node_im;
 #endif
 struct stbrp_context_opaque { char data[80]; };
 
+// ImFontAtlasFlags_PackGuillotine: a free area of the texture, linked with the other free areas of the same width and of the same height.
+struct ImFontAtlasPackFreeRect
+{
+    ImTextureRect               Rect;
+    int                         PrevSameW, NextSameW;   // Index into PackFreeRects[], -1 at either end of the list
+    int                         PrevSameH, NextSameH;
+};
+
 // Internal storage for incrementally packing and building a ImFontAtlas
 struct ImFontAtlasBuilder
 {
     stbrp_context_opaque        PackContext;            // Actually 'stbrp_context' but we don't want to define this in the header file.
     ImVector<stbrp_node_im>     PackNodes;
+    ImVector<ImFontAtlasPackFreeRect> PackFreeRects;    // ImFontAtlasFlags_PackGuillotine: free areas of the texture (padded), disjoint.
+    ImVector<int>               PackFreeByWidth;        // ImFontAtlasFlags_PackGuillotine: width -> first of PackFreeRects[] with that width, -1 if none
+    ImVector<int>               PackFreeByHeight;       // ImFontAtlasFlags_PackGuillotine: height -> first of PackFreeRects[] with that height, -1 if none
     ImVector<ImTextureRect>     Rects;
     ImVector<ImFontAtlasRectEntry> RectsIndex;          // ImFontAtlasRectId -> index into Rects[]
     ImVector<unsigned char>     TempBuffer;             // Misc scratch buffer
+    ImVector<int>               RectsFreeSlots;         // ImFontAtlasFlags_PackGuillotine: discarded entries of Rects[], reused by the next AddRect()
     int                         RectsIndexFreeListStart;// First unused entry
     int                         RectsPackedCount;       // Number of packed rectangles.
     int                         RectsPackedSurface;     // Number of packed pixels. Used when compacting to heuristically find the ideal texture size.
@@ -3846,6 +3913,7 @@ struct ImFontAtlasBuilder
     ImVec2i                     MaxRectSize;            // Largest rectangle to pack (de-facto used as a "minimum texture size")
     ImVec2i                     MaxRectBounds;          // Bottom-right most used pixels
     bool                        LockDisableResize;      // Disable resizing texture
+    bool                        PackGuillotine;         // ImFontAtlasFlags_PackGuillotine, as of last ImFontAtlasPackInit()
     bool                        PreloadedAllGlyphsRanges; // Set when missing ImGuiBackendFlags_RendererHasTextures features forces atlas to preload everything.
 
     // Cache of all ImFontBaked
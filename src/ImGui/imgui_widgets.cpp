@@ -8431,7 +8431,12 @@ bool ImGuiSelectionBasicStorage::GetNextSelectedItem(void** opaque_it, ImGuiID*
     ImGuiStoragePair* it = (ImGuiStoragePair*)*opaque_it;
     ImGuiStoragePair* it_end = _Storage.Data.Data + _Storage.Data.Size;
     if (PreserveOrder && it == NULL && it_end != NULL)
+    {
         ImQsort(_Storage.Data.Data, (size_t)_Storage.Data.Size, sizeof(ImGuiStoragePair), PairComparerByValueInt); // ~ImGuiStorage::BuildSortByValueInt()
+#ifdef IMGUI_STORAGE_HASHED
+        _Storage._IndexedSize = -1;
+#endif
+    }
     if (it == NULL)
         it = _Storage.Data.Data;
     IM_ASSERT(it >= _Storage.Data.Data && it <= it_end);
@@ -8516,6 +8521,9 @@ void ImGuiSelectionBasicStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
             if (req.Selected)
             {
                 _Storage.Data.reserve(ms_io->ItemsCount);
+#ifdef IMGUI_STORAGE_HASHED
+                _Storage.BuildSortByKey(); // Pairs are kept in insertion order, batch amends below need them sorted
+#endif
                 const int size_before_amends = _Storage.Data.Size;
                 for (int idx = 0; idx < ms_io->ItemsCount; idx++, _SelectionOrder++)
                     ImGuiSelectionBasicStorage_BatchSetItemSelected(this, GetStorageIdFromIndex(idx), req.Selected, size_before_amends, _SelectionOrder);
@@ -8537,6 +8545,9 @@ void ImGuiSelectionBasicStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
             {
                 // Append insertion + single sort likely be faster.
                 // Use req.RangeDirection to set order field so that Shift+Clicking from 1 to 5 is different than Shift+Clicking from 5 to 1
+#ifdef IMGUI_STORAGE_HASHED
+                _Storage.BuildSortByKey(); // Pairs are kept in insertion order, batch amends below need them sorted
+#endif
                 const int size_before_amends = _Storage.Data.Size;
                 int selection_order = _SelectionOrder + ((req.RangeDirection < 0) ? selection_changes - 1 : 0);
                 for (int idx = (int)req.RangeFirstItem; idx <= (int)req.RangeLastItem; idx++, selection_order += req.RangeDirection)
@@ -8705,6 +8716,112 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - others https://github.com/ocornut/imgui/wiki/Useful-Extensions
 //-------------------------------------------------------------------------
 
+// Arrays passed to PlotLines()/PlotHistogram() are read through Plot_ArrayGetter().
+// PlotScanMinMax() recognizes it and reads the (strided) buffer in place instead of calling the getter for each sample.
+struct ImGuiPlotArrayGetterData
+{
+    const float* Values;
+    int Stride;
+
+    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
+};
+
+static float Plot_ArrayGetter(void* data, int idx)
+{
+    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
+    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
+    return v;
+}
+
+static inline float PlotGetValue(float (*values_getter)(void* data, int idx), void* data, const ImGuiPlotArrayGetterData* array_data, int src_idx)
+{
+    return array_data ? *(const float*)(const void*)((const unsigned char*)array_data->Values + (size_t)src_idx * array_data->Stride) : values_getter(data, src_idx);
+}
+
+// Find min/max of values [idx_begin, idx_end), indices being in display order (shifted by values_offset). NaN values are ignored.
+// If 'out_min_first' is provided, also report which of the min or max comes first (found with an early-out search after the scan,
+// which keeps the scan loop free of index tracking). Returns false if there are only NaN values.
+static bool PlotScanMinMax(float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, int idx_begin, int idx_end, float* out_min, float* out_max, bool* out_min_first)
+{
+    const ImGuiPlotArrayGetterData* array_data = (values_getter == &Plot_ArrayGetter) ? (const ImGuiPlotArrayGetterData*)data : NULL;
+    float v_min = FLT_MAX, v_max = -FLT_MAX;
+    for (int idx = idx_begin; idx < idx_end; )
+    {
+        // Split the range where values_offset wraps around, so the inner loops don't need a modulo
+        const int src_idx = (idx + values_offset) % values_count;
+        const int run_count = ImMin(idx_end - idx, values_count - src_idx);
+        if (array_data && array_data->Stride == sizeof(float))
+        {
+            // Contiguous: 4 lanes at a time. Both minps and vminnmq ignore a NaN input, matching the scalar comparisons below.
+            const float* src = array_data->Values + src_idx;
+            int n = 0;
+#if defined(IMGUI_ENABLE_SSE)
+            if (run_count >= 8)
+            {
+                __m128 min4 = _mm_set1_ps(v_min), max4 = _mm_set1_ps(v_max);
+                for (; n + 4 <= run_count; n += 4)
+                {
+                    const __m128 v4 = _mm_loadu_ps(src + n);
+                    min4 = _mm_min_ps(v4, min4);
+                    max4 = _mm_max_ps(v4, max4);
+                }
+                float lanes_min[4], lanes_max[4];
+                _mm_storeu_ps(lanes_min, min4);
+                _mm_storeu_ps(lanes_max, max4);
+                v_min = ImMin(ImMin(lanes_min[0], lanes_min[1]), ImMin(lanes_min[2], lanes_min[3]));
+                v_max = ImMax(ImMax(lanes_max[0], lanes_max[1]), ImMax(lanes_max[2], lanes_max[3]));
+            }
+#elif defined(IMGUI_ENABLE_NEON)
+            if (run_count >= 8)
+            {
+                float32x4_t min4 = vdupq_n_f32(v_min), max4 = vdupq_n_f32(v_max);
+                for (; n + 4 <= run_count; n += 4)
+                {
+                    const float32x4_t v4 = vld1q_f32(src + n);
+                    min4 = vminnmq_f32(v4, min4);
+                    max4 = vmaxnmq_f32(v4, max4);
+                }
+                v_min = vminvq_f32(min4);
+                v_max = vmaxvq_f32(max4);
+            }
+#endif
+            for (; n < run_count; n++)
+            {
+                v_min = (src[n] < v_min) ? src[n] : v_min;
+                v_max = (src[n] > v_max) ? src[n] : v_max;
+            }
+        }
+        else
+        {
+            for (int n = 0; n < run_count; n++)
+            {
+                const float v = PlotGetValue(values_getter, data, array_data, src_idx + n);
+                v_min = (v < v_min) ? v : v_min;
+                v_max = (v > v_max) ? v : v_max;
+            }
+        }
+        idx += run_count;
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+    if (v_min > v_max)
+        return false;
+    if (out_min_first)
+    {
+        *out_min_first = true;
+        for (int idx = idx_begin; idx < idx_end; idx++)
+        {
+            const float v = PlotGetValue(values_getter, data, array_data, (idx + values_offset) % values_count);
+            if (v == v_min || v == v_max)
+            {
+                *out_min_first = (v == v_min);
+                break;
+            }
+        }
+    }
+    return true;
+}
+
 int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
 {
     ImGuiContext& g = *GImGui;
@@ -8730,16 +8847,8 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     // Determine scale from values if not specified
     if (scale_min == FLT_MAX || scale_max == FLT_MAX)
     {
-        float v_min = FLT_MAX;
-        float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
-        {
-            const float v = values_getter(data, i);
-            if (v != v) // Ignore NaN values
-                continue;
-            v_min = ImMin(v_min, v);
-            v_max = ImMax(v_max, v);
-        }
+        float v_min, v_max;
+        PlotScanMinMax(values_getter, data, values_count, 0, 0, values_count, &v_min, &v_max, NULL);
         if (scale_min == FLT_MAX)
             scale_min = v_min;
         if (scale_max == FLT_MAX)
@@ -8782,30 +8891,68 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
         const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
         const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
 
-        for (int n = 0; n < res_w; n++)
+        // More samples than pixels: min/max decimation.
+        // Emit the extremes of each pixel column in sample order as a single polyline, so vertex count is bounded by the widget width
+        // while spikes are preserved (plain sampling would skip them).
+        const int columns = (int)inner_bb.GetWidth();
+        if (plot_type == ImGuiPlotType_Lines && columns >= 1 && values_count > columns * 2)
         {
-            const float t1 = t0 + t_step;
-            const int v1_idx = (int)(t0 * item_count + 0.5f);
-            IM_ASSERT(v1_idx >= 0 && v1_idx < values_count);
-            const float v1 = values_getter(data, (v1_idx + values_offset + 1) % values_count);
-            const ImVec2 tp1 = ImVec2( t1, 1.0f - ImSaturate((v1 - scale_min) * inv_scale) );
-
-            // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
-            ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, tp0);
-            ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, (plot_type == ImGuiPlotType_Lines) ? tp1 : ImVec2(tp1.x, histogram_zero_line_t));
-            if (plot_type == ImGuiPlotType_Lines)
+            const float t_scale = 1.0f / (float)(values_count - 1);
+            ImDrawList* draw_list = window->DrawList;
+            for (int column = 0; column < columns; column++)
             {
-                window->DrawList->AddLine(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                const int idx_begin = (int)((ImS64)column * values_count / columns);
+                const int idx_end = (int)((ImS64)(column + 1) * values_count / columns);
+                float v_min, v_max;
+                bool min_first;
+                if (!PlotScanMinMax(values_getter, data, values_count, values_offset, idx_begin, idx_end, &v_min, &v_max, &min_first))
+                    continue;
+                const float x = ImLerp(inner_bb.Min.x, inner_bb.Max.x, (column + 0.5f) / columns);
+                const float y_min = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_min - scale_min) * inv_scale));
+                const float y_max = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_max - scale_min) * inv_scale));
+                draw_list->PathLineTo(ImVec2(x, min_first ? y_min : y_max));
+                if (y_min != y_max)
+                    draw_list->PathLineTo(ImVec2(x, min_first ? y_max : y_min));
             }
-            else if (plot_type == ImGuiPlotType_Histogram)
+            draw_list->PathStroke(col_base, ImDrawFlags_None, 1.0f);
+
+            // Highlight hovered segment
+            if (idx_hovered >= 0 && idx_hovered + 1 < values_count)
             {
-                if (pos1.x >= pos0.x + 2.0f)
-                    pos1.x -= 1.0f;
-                window->DrawList->AddRectFilled(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                const float hv0 = values_getter(data, (idx_hovered + values_offset) % values_count);
+                const float hv1 = values_getter(data, (idx_hovered + 1 + values_offset) % values_count);
+                const ImVec2 hpos0 = ImLerp(inner_bb.Min, inner_bb.Max, ImVec2(idx_hovered * t_scale, 1.0f - ImSaturate((hv0 - scale_min) * inv_scale)));
+                const ImVec2 hpos1 = ImLerp(inner_bb.Min, inner_bb.Max, ImVec2((idx_hovered + 1) * t_scale, 1.0f - ImSaturate((hv1 - scale_min) * inv_scale)));
+                draw_list->AddLine(hpos0, hpos1, col_hovered);
             }
+        }
+        else
+        {
+            for (int n = 0; n < res_w; n++)
+            {
+                const float t1 = t0 + t_step;
+                const int v1_idx = (int)(t0 * item_count + 0.5f);
+                IM_ASSERT(v1_idx >= 0 && v1_idx < values_count);
+                const float v1 = values_getter(data, (v1_idx + values_offset + 1) % values_count);
+                const ImVec2 tp1 = ImVec2( t1, 1.0f - ImSaturate((v1 - scale_min) * inv_scale) );
+
+                // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
+                ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, tp0);
+                ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, (plot_type == ImGuiPlotType_Lines) ? tp1 : ImVec2(tp1.x, histogram_zero_line_t));
+                if (plot_type == ImGuiPlotType_Lines)
+                {
+                    window->DrawList->AddLine(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                }
+                else if (plot_type == ImGuiPlotType_Histogram)
+                {
+                    if (pos1.x >= pos0.x + 2.0f)
+                        pos1.x -= 1.0f;
+                    window->DrawList->AddRectFilled(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                }
 
-            t0 = t1;
-            tp0 = tp1;
+                t0 = t1;
+                tp0 = tp1;
+            }
         }
     }
 
@@ -8821,21 +8968,6 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     return idx_hovered;
 }
 
-struct ImGuiPlotArrayGetterData
-{
-    const float* Values;
-    int Stride;
-
-    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
-};
-
-static float Plot_ArrayGetter(void* data, int idx)
-{
-    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
-    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
-    return v;
-}
-
 void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
     ImGuiPlotArrayGetterData data(values, stride);
@@ -142,6 +142,11 @@
 //        #define STBTT_RASTERIZER_VERSION 1
 //   which will incur about a 15% speed hit.
 //
+//   [DEAR IMGUI] With the new rasterizer,
+//        #define STBTT_RASTERIZER_SIMD
+//   converts accumulated coverage to pixels 4 at a time with SSE2 or NEON when
+//   available. Output is identical to the scalar code.
+//
 // ADDITIONAL DOCUMENTATION
 //
 //   Immediately after this block comment are a series of sample programs.
@@ -1124,6 +1129,17 @@ typedef int stbtt__test_oversample_pow2[(STBTT_MAX_OVERSAMPLE & (STBTT_MAX_OVERS
 #define STBTT_RASTERIZER_VERSION 2
 #endif
 
+// [DEAR IMGUI] Optional SIMD for the version 2 rasterizer
+#if defined(STBTT_RASTERIZER_SIMD) && STBTT_RASTERIZER_VERSION == 2
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define STBTT__SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define STBTT__SIMD_NEON
+#endif
+#endif
+
 #ifdef _MSC_VER
 #define STBTT__NOTUSED(v)  (void)(v)
 #else
@@ -3301,12 +3317,104 @@ static void stbtt__fill_active_edges_new(float *scanline, float *scanline_fill,
    }
 }
 
+#if defined(STBTT__SIMD_SSE2) || defined(STBTT__SIMD_NEON)
+// [DEAR IMGUI] Accumulate-and-quantize pass of stbtt__rasterize_sorted_edges(), 4 pixels at a time.
+// To match the scalar loop bit for bit, the running sum of scanline_fill[] must be added up in the same order.
+// A parallel prefix sum only guarantees that when at most one of the 4 values is non-zero, which is the common
+// case as scanline_fill[] gets one value per edge crossing. Other groups are summed one value at a time.
+static void stbtt__resolve_scanline(unsigned char *pixels, const float *scanline, const float *scanline_fill, int len)
+{
+   float sum;
+   int i = 0;
+#if defined(STBTT__SIMD_SSE2)
+   const __m128 zero = _mm_setzero_ps();
+   const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+   __m128 sums = zero; // running sum in all lanes
+   for (; i + 4 <= len; i += 4) {
+      __m128 fill = _mm_loadu_ps(scanline_fill + i);
+      __m128 k;
+      __m128i m;
+      int v, nonzero = _mm_movemask_ps(_mm_cmpneq_ps(fill, zero));
+      if ((nonzero & (nonzero - 1)) == 0) {
+         fill = _mm_add_ps(fill, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(fill), 4)));
+         fill = _mm_add_ps(fill, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(fill), 8)));
+         fill = _mm_add_ps(sums, fill);
+      } else {
+         float s0 = _mm_cvtss_f32(sums) + scanline_fill[i];
+         float s1 = s0 + scanline_fill[i+1];
+         float s2 = s1 + scanline_fill[i+2];
+         float s3 = s2 + scanline_fill[i+3];
+         fill = _mm_setr_ps(s0, s1, s2, s3);
+      }
+      sums = _mm_shuffle_ps(fill, fill, _MM_SHUFFLE(3,3,3,3));
+      k = _mm_add_ps(_mm_loadu_ps(scanline + i), fill);
+      k = _mm_and_ps(k, abs_mask);
+      k = _mm_add_ps(_mm_mul_ps(k, _mm_set1_ps(255)), _mm_set1_ps(0.5f));
+      m = _mm_cvttps_epi32(k);
+      m = _mm_packs_epi32(m, m);
+      m = _mm_packus_epi16(m, m); // clamps to 255 like the scalar code (negative values can't happen)
+      v = _mm_cvtsi128_si32(m);
+      STBTT_memcpy(pixels + i, &v, 4);
+   }
+   sum = _mm_cvtss_f32(sums);
+#else
+   const float32x4_t zero = vdupq_n_f32(0);
+   float32x4_t sums = zero; // running sum in all lanes
+   for (; i + 4 <= len; i += 4) {
+      float32x4_t fill = vld1q_f32(scanline_fill + i);
+      float32x4_t k;
+      uint32x4_t nonzero = vshrq_n_u32(vmvnq_u32(vceqq_f32(fill, zero)), 31);
+      uint32x2_t count = vadd_u32(vget_low_u32(nonzero), vget_high_u32(nonzero));
+      uint16x4_t m16;
+      uint8x8_t m8;
+      unsigned int v;
+      count = vpadd_u32(count, count);
+      if (vget_lane_u32(count, 0) <= 1) {
+         fill = vaddq_f32(fill, vextq_f32(zero, fill, 3));
+         fill = vaddq_f32(fill, vextq_f32(zero, fill, 2));
+         fill = vaddq_f32(sums, fill);
+      } else {
+         float s[4];
+         s[0] = vgetq_lane_f32(sums, 0) + scanline_fill[i];
+         s[1] = s[0] + scanline_fill[i+1];
+         s[2] = s[1] + scanline_fill[i+2];
+         s[3] = s[2] + scanline_fill[i+3];
+         fill = vld1q_f32(s);
+      }
+      sums = vdupq_n_f32(vgetq_lane_f32(fill, 3));
+      k = vaddq_f32(vld1q_f32(scanline + i), fill);
+      k = vabsq_f32(k);
+#if defined(__aarch64__) || defined(_M_ARM64)
+      k = vfmaq_f32(vdupq_n_f32(0.5f), k, vdupq_n_f32(255)); // compilers contract the scalar expression to a fused multiply-add here
+#else
+      k = vaddq_f32(vmulq_f32(k, vdupq_n_f32(255)), vdupq_n_f32(0.5f));
+#endif
+      m16 = vqmovun_s32(vcvtq_s32_f32(k));
+      m8 = vqmovn_u16(vcombine_u16(m16, m16));
+      v = vget_lane_u32(vreinterpret_u32_u8(m8), 0);
+      STBTT_memcpy(pixels + i, &v, 4);
+   }
+   sum = vgetq_lane_f32(sums, 0);
+#endif
+   for (; i < len; ++i) {
+      float k;
+      int m;
+      sum += scanline_fill[i];
+      k = scanline[i] + sum;
+      k = (float) STBTT_fabs(k)*255 + 0.5f;
+      m = (int) k;
+      if (m > 255) m = 255;
+      pixels[i] = (unsigned char) m;
+   }
+}
+#endif
+
 // directly AA rasterize edges w/o supersampling
 static void stbtt__rasterize_sorted_edges(stbtt__bitmap *result, stbtt__edge *e, int n, int vsubsample, int off_x, int off_y, void *userdata)
 {
    stbtt__hheap hh = { 0, 0, 0 };
    stbtt__active_edge *active = NULL;
-   int y,j=0, i;
+   int y,j=0;
    float scanline_data[129], *scanline, *scanline2;
 
    STBTT__NOTUSED(vsubsample);
@@ -3368,8 +3476,12 @@ static void stbtt__rasterize_sorted_edges(stbtt__bitmap *result, stbtt__edge *e,
       if (active)
          stbtt__fill_active_edges_new(scanline, scanline2+1, result->w, active, scan_y_top);
 
+#if defined(STBTT__SIMD_SSE2) || defined(STBTT__SIMD_NEON)
+      stbtt__resolve_scanline(result->pixels + j*result->stride, scanline, scanline2, result->w);
+#else
       {
          float sum = 0;
+         int i; // [DEAR IMGUI] moved from function scope (unused with STBTT_RASTERIZER_SIMD)
          for (i=0; i < result->w; ++i) {
             float k;
             int m;
@@ -3381,6 +3493,7 @@ static void stbtt__rasterize_sorted_edges(stbtt__bitmap *result, stbtt__edge *e,
             result->pixels[j*result->stride + i] = (unsigned char) m;
          }
       }
+#endif
       // advance all the edges
       step = &active;
       while (*step) {
@@ -0,0 +1,418 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#include "ImGui/imgui.h"
+#include "draw_trace.h"
+
+// File: header, then per frame a uint32 size followed by the frame. Little endian, no padding.
+// Frame: display pos/size/framebuffer scale, texture requests, draw lists.
+static const char kMagic[4] = { 'I', 'M', 'D', 'T' };
+static constexpr uint32_t kVersion = 2;    // 2: distance field glyphs tagged per command instead of offset in U
+static constexpr int kUserTexture = -1;     // command texture: not one of ImGui's
+static constexpr uint32_t kCmdResetRenderState = 1;
+static constexpr uint32_t kCmdDistanceFieldText = 2; // ImDrawCmdFlags_DistanceFieldText
+
+struct TraceHeader {
+    char magic[4];
+    uint32_t version;
+    uint16_t vertexSize;
+    uint8_t indexSize, posOffset, uvOffset, colOffset;
+    uint16_t reserved;
+};
+
+struct TraceTexture {
+    int32_t id;
+    uint8_t status, format;
+    uint16_t reserved;
+    int32_t width, height, unusedFrames;
+};
+
+struct TraceCmd {
+    float clipRect[4];
+    int32_t texture;
+    uint32_t vtxOffset, idxOffset, elemCount, flags;
+};
+
+static TraceHeader CurrentHeader() {
+    TraceHeader h = {};
+    memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.version = kVersion;
+    h.vertexSize = sizeof(ImDrawVert);
+    h.indexSize = sizeof(ImDrawIdx);
+    h.posOffset = offsetof(ImDrawVert, pos);
+    h.uvOffset = offsetof(ImDrawVert, uv);
+    h.colOffset = offsetof(ImDrawVert, col);
+    return h;
+}
+
+static void PutBytes(std::vector<uint8_t>& out, const void* data, size_t size) {
+    out.insert(out.end(), (const uint8_t*)data, (const uint8_t*)data + size);
+}
+
+template <typename T>
+static void Put(std::vector<uint8_t>& out, const T& v) {
+    PutBytes(out, &v, sizeof(T));
+}
+
+static void PutRect(std::vector<uint8_t>& out, const ImTextureData* tex, const ImTextureRect& r) {
+    Put(out, r);
+    const int rowBytes = r.w * tex->BytesPerPixel;
+    for (int y = r.y; y < r.y + r.h; y++)
+        PutBytes(out, tex->Pixels + ((size_t)y * tex->Width + r.x) * tex->BytesPerPixel, rowBytes);
+}
+
+bool DrawTraceOpen(DrawTraceWriter& w, const char* path) {
+    w = DrawTraceWriter();
+    w.file = fopen(path, "wb");
+    if (!w.file) return false;
+    TraceHeader h = CurrentHeader();
+    w.bytes = fwrite(&h, 1, sizeof(h), w.file);
+    return w.bytes == sizeof(h);
+}
+
+static void WriteTextures(DrawTraceWriter& w, const ImVector<ImTextureData*>* textures) {
+    const size_t countAt = w.frame.size();
+    uint32_t count = 0;
+    Put(w.frame, count);
+    if (!textures) return;
+    for (ImTextureData* tex : *textures) {
+        std::vector<int>& live = w.liveTextures;
+        auto it = std::find(live.begin(), live.end(), tex->UniqueID);
+        if (tex->Status == ImTextureStatus_Destroyed) {
+            if (it != live.end()) live.erase(it);
+            continue;
+        }
+        const bool known = it != live.end();
+        if ((tex->Status == ImTextureStatus_WantDestroy && !known) || (tex->Status == ImTextureStatus_OK && known))
+            continue;
+        // Unknown to the reader: created, with whatever it holds by now
+        const ImTextureStatus status = known ? tex->Status : ImTextureStatus_WantCreate;
+        TraceTexture t = { tex->UniqueID, (uint8_t)status, (uint8_t)tex->Format, 0, tex->Width, tex->Height, tex->UnusedFrames };
+        Put(w.frame, t);
+        count++;
+        if (status == ImTextureStatus_WantCreate) {
+            PutBytes(w.frame, tex->Pixels, (size_t)tex->GetSizeInBytes());
+            if (!known) live.push_back(tex->UniqueID);
+        } else if (status == ImTextureStatus_WantUpdates) {
+            const uint32_t rects = tex->Updates.Size > 0 ? (uint32_t)tex->Updates.Size : 1;
+            Put(w.frame, rects);
+            if (tex->Updates.Size > 0) {
+                for (const ImTextureRect& r : tex->Updates) PutRect(w.frame, tex, r);
+            } else {
+                PutRect(w.frame, tex, tex->UpdateRect);
+            }
+        }
+    }
+    memcpy(w.frame.data() + countAt, &count, sizeof(count));
+}
+
+static void SerializeList(std::vector<uint8_t>& out, const ImDrawList* list) {
+    out.clear();
+    uint32_t cmds = 0;
+    for (const ImDrawCmd& cmd : list->CmdBuffer)
+        cmds += cmd.UserCallback == nullptr || cmd.UserCallback == ImDrawCallback_ResetRenderState;
+    const uint32_t counts[3] = { (uint32_t)list->VtxBuffer.Size, (uint32_t)list->IdxBuffer.Size, cmds };
+    Put(out, counts);
+    PutBytes(out, list->VtxBuffer.Data, (size_t)list->VtxBuffer.size_in_bytes());
+    PutBytes(out, list->IdxBuffer.Data, (size_t)list->IdxBuffer.size_in_bytes());
+    for (const ImDrawCmd& cmd : list->CmdBuffer) {
+        if (cmd.UserCallback != nullptr && cmd.UserCallback != ImDrawCallback_ResetRenderState) continue;
+        TraceCmd c = {};
+        memcpy(c.clipRect, &cmd.ClipRect, sizeof(c.clipRect));
+        c.texture = cmd.TexRef._TexData ? cmd.TexRef._TexData->UniqueID : kUserTexture;
+        c.vtxOffset = cmd.VtxOffset;
+        c.idxOffset = cmd.IdxOffset;
+        c.elemCount = cmd.ElemCount;
+        c.flags = cmd.UserCallback == ImDrawCallback_ResetRenderState ? kCmdResetRenderState : 0;
+        if (cmd.Flags & ImDrawCmdFlags_DistanceFieldText) c.flags |= kCmdDistanceFieldText;
+        Put(out, c);
+    }
+}
+
+void DrawTraceWrite(DrawTraceWriter& w, const ImDrawData* drawData) {
+    if (!w.file) return;
+    w.frame.clear();
+    const ImVec2 view[3] = { drawData->DisplayPos, drawData->DisplaySize, drawData->FramebufferScale };
+    Put(w.frame, view);
+    WriteTextures(w, drawData->Textures);
+
+    Put(w.frame, (uint32_t)drawData->CmdLists.Size);
+    w.lastLists.resize(drawData->CmdLists.Size);
+    for (int i = 0; i < drawData->CmdLists.Size; i++) {
+        SerializeList(w.list, drawData->CmdLists[i]);
+        const bool repeat = w.list == w.lastLists[i];
+        Put(w.frame, (uint8_t)repeat);
+        if (repeat) continue;
+        PutBytes(w.frame, w.list.data(), w.list.size());
+        w.lastLists[i].swap(w.list);
+    }
+
+    const uint32_t size = (uint32_t)w.frame.size();
+    w.bytes += fwrite(&size, 1, sizeof(size), w.file);
+    w.bytes += fwrite(w.frame.data(), 1, w.frame.size(), w.file);
+    w.frames++;
+}
+
+void DrawTraceClose(DrawTraceWriter& w) {
+    if (w.file) fclose(w.file);
+    w.file = nullptr;
+}
+
+// Reads from a frame, any overrun clears 'ok'
+struct TraceCursor {
+    const uint8_t* p;
+    const uint8_t* end;
+    bool ok = true;
+
+    const uint8_t* Bytes(size_t size) {
+        if (!ok || (size_t)(end - p) < size) {
+            ok = false;
+            return nullptr;
+        }
+        const uint8_t* r = p;
+        p += size;
+        return r;
+    }
+    template <typename T>
+    T Get() {
+        T v = {};
+        if (const uint8_t* b = Bytes(sizeof(T))) memcpy(&v, b, sizeof(T));
+        return v;
+    }
+};
+
+bool DrawTraceLoad(DrawTraceReader& r, const char* path) {
+    DrawTraceUnload(r);
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    fseek(f, 0, SEEK_END);
+    const long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    r.data.resize(size > 0 ? (size_t)size : 0);
+    const bool read = fread(r.data.data(), 1, r.data.size(), f) == r.data.size();
+    fclose(f);
+    TraceHeader expected = CurrentHeader();
+    if (!read || r.data.size() < sizeof(TraceHeader) || memcmp(r.data.data(), &expected, sizeof(expected)) != 0) {
+        r.data.clear();
+        return false;
+    }
+    size_t at = sizeof(TraceHeader);
+    uint32_t frameSize = 0;
+    while (r.data.size() - at >= sizeof(frameSize)) {
+        memcpy(&frameSize, r.data.data() + at, sizeof(frameSize));
+        if (r.data.size() - at - sizeof(frameSize) < frameSize) break;
+        r.frameOffsets.push_back(at);
+        at += sizeof(frameSize) + frameSize;
+    }
+    return true;
+}
+
+static ImTextureData* FindTexture(DrawTraceReader& r, int id) {
+    for (const auto& t : r.textureIds)
+        if (t.first == id) return t.second;
+    return nullptr;
+}
+
+// The renderer has honored the previous frame's requests: drop what it destroyed, age what it hasn't yet
+static void SettleTextures(DrawTraceReader& r) {
+    for (int i = r.textures.Size - 1; i >= 0; i--) {
+        ImTextureData* tex = r.textures[i];
+        if (tex->Status == ImTextureStatus_Destroyed) {
+            for (size_t n = 0; n < r.textureIds.size(); n++)
+                if (r.textureIds[n].second == tex) {
+                    r.textureIds.erase(r.textureIds.begin() + n);
+                    break;
+                }
+            r.textures.erase(r.textures.Data + i);
+            IM_DELETE(tex);
+            continue;
+        }
+        if (tex->Status == ImTextureStatus_WantDestroy) tex->UnusedFrames++;
+        if (tex->Status == ImTextureStatus_OK) {
+            tex->Updates.resize(0);
+            tex->UpdateRect.x = tex->UpdateRect.y = (unsigned short)~0;
+            tex->UpdateRect.w = tex->UpdateRect.h = 0;
+        }
+    }
+}
+
+static void RequestDestroy(ImTextureData* tex, int unusedFrames) {
+    tex->WantDestroyNextFrame = true; // so the backend's SetStatus(Destroyed) sticks
+    tex->Status = ImTextureStatus_WantDestroy;
+    tex->UnusedFrames = unusedFrames;
+}
+
+static bool ReadTextures(DrawTraceReader& r, TraceCursor& c) {
+    const uint32_t count = c.Get<uint32_t>();
+    for (uint32_t n = 0; n < count && c.ok; n++) {
+        const TraceTexture t = c.Get<TraceTexture>();
+        ImTextureData* tex = FindTexture(r, t.id);
+        if (t.status == ImTextureStatus_WantCreate) {
+            if (t.format != ImTextureFormat_RGBA32 && t.format != ImTextureFormat_Alpha8) return false;
+            if (t.width <= 0 || t.height <= 0 || t.width > 0x8000 || t.height > 0x8000) return false;
+            const int bpp = t.format == ImTextureFormat_RGBA32 ? 4 : 1;
+            const uint8_t* pixels = c.Bytes((size_t)t.width * t.height * bpp);
+            if (!pixels) return false;
+            if (tex) RequestDestroy(tex, 1); // recreated: the old one goes away like any unused texture
+            tex = IM_NEW(ImTextureData)();
+            tex->Create((ImTextureFormat)t.format, t.width, t.height);
+            tex->UniqueID = t.id;
+            memcpy(tex->Pixels, pixels, (size_t)tex->GetSizeInBytes());
+            tex->UsedRect.x = tex->UsedRect.y = 0;
+            tex->UsedRect.w = (unsigned short)t.width;
+            tex->UsedRect.h = (unsigned short)t.height;
+            r.textures.push_back(tex);
+            bool replaced = false;
+            for (auto& id : r.textureIds)
+                if (id.first == t.id) {
+                    id.second = tex;
+                    replaced = true;
+                }
+            if (!replaced) r.textureIds.emplace_back(t.id, tex);
+        } else if (t.status == ImTextureStatus_WantUpdates) {
+            if (!tex) return false;
+            const uint32_t rects = c.Get<uint32_t>();
+            for (uint32_t i = 0; i < rects && c.ok; i++) {
+                const ImTextureRect rect = c.Get<ImTextureRect>();
+                if (rect.x + rect.w > tex->Width || rect.y + rect.h > tex->Height) return false;
+                const int rowBytes = rect.w * tex->BytesPerPixel;
+                const uint8_t* pixels = c.Bytes((size_t)rowBytes * rect.h);
+                if (!pixels) return false;
+                for (int y = 0; y < rect.h; y++)
+                    memcpy(tex->GetPixelsAt(rect.x, rect.y + y), pixels + (size_t)y * rowBytes, rowBytes);
+                tex->Updates.push_back(rect);
+                const int x0 = rect.x < tex->UpdateRect.x ? rect.x : tex->UpdateRect.x;
+                const int y0 = rect.y < tex->UpdateRect.y ? rect.y : tex->UpdateRect.y;
+                const int x1 = tex->UpdateRect.w == 0 || rect.x + rect.w > tex->UpdateRect.x + tex->UpdateRect.w ? rect.x + rect.w : tex->UpdateRect.x + tex->UpdateRect.w;
+                const int y1 = tex->UpdateRect.h == 0 || rect.y + rect.h > tex->UpdateRect.y + tex->UpdateRect.h ? rect.y + rect.h : tex->UpdateRect.y + tex->UpdateRect.h;
+                tex->UpdateRect.x = (unsigned short)x0;
+                tex->UpdateRect.y = (unsigned short)y0;
+                tex->UpdateRect.w = (unsigned short)(x1 - x0);
+                tex->UpdateRect.h = (unsigned short)(y1 - y0);
+            }
+            if (tex->Status == ImTextureStatus_OK) tex->Status = ImTextureStatus_WantUpdates;
+        } else if (t.status == ImTextureStatus_WantDestroy) {
+            if (tex) RequestDestroy(tex, t.unusedFrames > 0 ? t.unusedFrames : 1);
+        } else {
+            return false;
+        }
+    }
+    return c.ok;
+}
+
+static bool ReadList(TraceCursor& c, ImDrawList* list) {
+    const uint32_t vtxCount = c.Get<uint32_t>(), idxCount = c.Get<uint32_t>(), cmdCount = c.Get<uint32_t>();
+    const uint8_t* vtx = c.Bytes((size_t)vtxCount * sizeof(ImDrawVert));
+    const uint8_t* idx = c.Bytes((size_t)idxCount * sizeof(ImDrawIdx));
+    if (!c.ok || cmdCount > (size_t)(c.end - c.p) / sizeof(TraceCmd)) return false;
+    list->VtxBuffer.resize((int)vtxCount);
+    list->IdxBuffer.resize((int)idxCount);
+    list->CmdBuffer.resize((int)cmdCount);
+    memcpy(list->VtxBuffer.Data, vtx, (size_t)list->VtxBuffer.size_in_bytes());
+    memcpy(list->IdxBuffer.Data, idx, (size_t)list->IdxBuffer.size_in_bytes());
+    for (ImDrawCmd& cmd : list->CmdBuffer) {
+        const TraceCmd t = c.Get<TraceCmd>();
+        bool valid = (size_t)t.idxOffset + t.elemCount <= idxCount && (t.vtxOffset == 0 || t.vtxOffset < vtxCount);
+        // The renderer reads VtxBuffer[VtxOffset + index] for each of the command's indices
+        if (valid && t.elemCount > 0) {
+            const ImDrawIdx* cmdIdx = list->IdxBuffer.Data + t.idxOffset;
+            ImDrawIdx maxIdx = 0;
+            for (uint32_t n = 0; n < t.elemCount; n++) maxIdx = cmdIdx[n] > maxIdx ? cmdIdx[n] : maxIdx;
+            valid = (size_t)t.vtxOffset + maxIdx < vtxCount;
+        }
+        if (!valid) {
+            list->CmdBuffer.resize(0); // nothing left to draw should a later frame repeat this list
+            return false;
+        }
+        cmd = ImDrawCmd();
+        memcpy(&cmd.ClipRect, t.clipRect, sizeof(t.clipRect));
+        cmd.VtxOffset = t.vtxOffset;
+        cmd.IdxOffset = t.idxOffset;
+        cmd.ElemCount = t.elemCount;
+        if (t.flags & kCmdResetRenderState) cmd.UserCallback = ImDrawCallback_ResetRenderState;
+        if (t.flags & kCmdDistanceFieldText) cmd.Flags = ImDrawCmdFlags_DistanceFieldText;
+        // Resolved once the frame's textures are known, the id waits in the _TexID field
+        cmd.TexRef._TexID = (ImTextureID)(intptr_t)t.texture;
+    }
+    return c.ok;
+}
+
+ImDrawData* DrawTraceNextFrame(DrawTraceReader& r) {
+    if (r.nextFrame >= r.frameOffsets.size()) return nullptr;
+    const size_t at = r.frameOffsets[r.nextFrame++];
+    uint32_t size = 0;
+    memcpy(&size, r.data.data() + at, sizeof(size));
+    TraceCursor c = { r.data.data() + at + sizeof(size), r.data.data() + at + sizeof(size) + size };
+
+    SettleTextures(r);
+    const ImVec2 pos = c.Get<ImVec2>(), displaySize = c.Get<ImVec2>(), scale = c.Get<ImVec2>();
+    if (!ReadTextures(r, c)) return nullptr;
+    const uint32_t listCount = c.Get<uint32_t>();
+    if (!c.ok || listCount > size) return nullptr;
+    while (r.lists.size() < listCount) {
+        r.lists.push_back(IM_NEW(ImDrawList)(nullptr));
+        r.listTextureIds.emplace_back();
+    }
+    ImDrawData& dd = r.drawData;
+    dd.Clear();
+    for (uint32_t i = 0; i < listCount; i++) {
+        ImDrawList* list = r.lists[i];
+        std::vector<int>& ids = r.listTextureIds[i];
+        const bool repeat = c.Get<uint8_t>() != 0;
+        if (!repeat) {
+            if (!ReadList(c, list)) return nullptr;
+            ids.resize(list->CmdBuffer.Size);
+            for (int n = 0; n < list->CmdBuffer.Size; n++) ids[n] = (int)(intptr_t)list->CmdBuffer[n].TexRef._TexID;
+        }
+        // Every frame: a repeated list may refer to a texture that was recreated since
+        for (int n = 0; n < list->CmdBuffer.Size; n++) {
+            ImTextureRef& ref = list->CmdBuffer[n].TexRef;
+            if (ids[n] == kUserTexture) {
+                ref = ImTextureRef(r.userTexture);
+                continue;
+            }
+            ref._TexData = FindTexture(r, ids[n]);
+            ref._TexID = ImTextureID_Invalid;
+            if (!ref._TexData) return nullptr;
+        }
+        dd.CmdLists.push_back(list);
+        dd.TotalVtxCount += list->VtxBuffer.Size;
+        dd.TotalIdxCount += list->IdxBuffer.Size;
+    }
+    if (!c.ok) return nullptr;
+    dd.Valid = true;
+    dd.CmdListsCount = dd.CmdLists.Size;
+    dd.DisplayPos = pos;
+    dd.DisplaySize = displaySize;
+    dd.FramebufferScale = scale;
+    dd.Textures = &r.textures;
+    return &dd;
+}
+
+void DrawTraceRewind(DrawTraceReader& r, void (*updateTexture)(ImTextureData*)) {
+    for (ImTextureData* tex : r.textures) {
+        if (tex->TexID != ImTextureID_Invalid) {
+            RequestDestroy(tex, 1 << 16); // past any backend's frames in flight: the caller waited for the GPU
+            updateTexture(tex);
+        }
+        IM_DELETE(tex);
+    }
+    r.textures.clear();
+    r.textureIds.clear();
+    r.drawData.Clear();
+    r.nextFrame = 0;
+}
+
+void DrawTraceUnload(DrawTraceReader& r) {
+    for (ImTextureData* tex : r.textures) IM_DELETE(tex);
+    for (ImDrawList* list : r.lists) IM_DELETE(list);
+    r.textures.clear();
+    r.textureIds.clear();
+    r.lists.clear();
+    r.listTextureIds.clear();
+    r.drawData.Clear();
+    r.data.clear();
+    r.frameOffsets.clear();
+    r.nextFrame = 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+#include "ImGui/imgui.h"
+
+// Binary trace of the ImDrawData of consecutive frames: draw lists (vertices, indices, commands with clip
+// rects), display size, and the texture requests the renderer had to honor. Replaying a trace gives any
+// renderer backend the exact frames the overlay produced (tools/draw_replay.cpp).
+// - Textures are identified by ImTextureData::UniqueID. The first frame creates every live texture, later
+//   frames carry the requests: full pixels on create, only the updated rects on update.
+// - A draw list identical to the one at the same index in the previous frame is stored as a one byte repeat.
+// - Vertices are stored as-is: the reader must be built with the same ImDrawVert layout and ImDrawIdx.
+// - User callbacks can't be replayed and are dropped, ImDrawCallback_ResetRenderState is kept.
+
+struct DrawTraceWriter {
+    FILE* file = nullptr;
+    int frames = 0;
+    size_t bytes = 0;
+    std::vector<int> liveTextures;                // UniqueIDs created in the trace
+    std::vector<std::vector<uint8_t>> lastLists;  // previous frame's lists, serialized
+    std::vector<uint8_t> frame, list;             // scratch
+};
+
+bool DrawTraceOpen(DrawTraceWriter& w, const char* path);
+// After ImGui::Render(), before the renderer honors the texture requests (which resets them)
+void DrawTraceWrite(DrawTraceWriter& w, const ImDrawData* drawData);
+void DrawTraceClose(DrawTraceWriter& w);
+
+struct DrawTraceReader {
+    std::vector<uint8_t> data;
+    std::vector<size_t> frameOffsets;
+    size_t nextFrame = 0;
+    ImTextureID userTexture = ImTextureID_Invalid; // bound instead of the user textures of the recording
+    ImDrawData drawData;
+    ImVector<ImTextureData*> textures;             // drawData.Textures
+    std::vector<std::pair<int, ImTextureData*>> textureIds;
+    std::vector<ImDrawList*> lists;
+    std::vector<std::vector<int>> listTextureIds;  // per list, per command
+};
+
+// Loads the whole file, a truncated last frame (recording interrupted) is ignored
+bool DrawTraceLoad(DrawTraceReader& r, const char* path);
+// Rebuilds the next frame, with its texture requests pending. nullptr at the end of the trace or on corrupt data.
+ImDrawData* DrawTraceNextFrame(DrawTraceReader& r);
+// Back to the first frame. The textures are destroyed through 'updateTexture' (the backend's UpdateTexture
+// function), the first frame creates them again.
+void DrawTraceRewind(DrawTraceReader& r, void (*updateTexture)(ImTextureData*));
+void DrawTraceUnload(DrawTraceReader& r);
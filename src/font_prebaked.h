@@ -0,0 +1,5447 @@
+// Generated by tools/font_prebake.cpp, do not edit.
+// Default font (ProggyClean) glyphs U+0020..U+007E at Setup()'s font scale buckets 1.50x..4.00x.
+// 711966 bytes of Alpha8 bitmaps, 139520 bytes compressed.
+#pragma once
+
+#include <cstdint>
+
+struct PrebakedGlyph {
+    float x0, y0, x1, y1; // as returned by the stb_truetype loader
+    float advanceX;
+    uint16_t w, h;        // bitmap size, 0 if not visible
+    uint32_t offset;      // into kPrebakedPixels, see tools/font_prebake.cpp Compress()
+};
+
+struct PrebakedFont {
+    float sizePixels;     // ImFontConfig::SizePixels
+    float bakedSize;      // ImFontBaked::Size
+    const PrebakedGlyph* glyphs;
+};
+
+static constexpr int kPrebakedFirstChar = 32;
+static constexpr int kPrebakedLastChar = 126;
+
+static const PrebakedGlyph kPrebakedGlyphs[] = {
+    { 0.0f, 0.0f, 0.0f, 0.0f, 14.5384617f, 0, 0, 0 },
+    { 5.75f, 5.0f, 8.75f, 22.0f, 14.5384617f, 6, 17, 643 },
+    { 3.75f, 3.0f, 10.75f, 10.0f, 14.5384617f, 14, 7, 691 },
+    { -0.25f, 5.0f, 15.25f, 22.0f, 14.5384617f, 31, 17, 740 },
+    { 1.75f, 5.0f, 12.75f, 25.0f, 14.5384617f, 22, 20, 946 },
+    { -0.25f, 5.0f, 15.25f, 22.0f, 14.5384617f, 31, 17, 1162 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 1453 },
+    { 5.75f, 3.0f, 8.75f, 10.0f, 14.5384617f, 6, 7, 1696 },
+    { 3.75f, 3.0f, 10.75f, 27.0f, 14.5384617f, 14, 24, 1721 },
+    { 3.75f, 3.0f, 10.75f, 27.0f, 14.5384617f, 14, 24, 1853 },
+    { 1.75f, 9.0f, 12.75f, 20.0f, 14.5384617f, 22, 11, 1985 },
+    { 1.75f, 9.0f, 12.75f, 20.0f, 14.5384617f, 22, 11, 2179 },
+    { 1.75f, 17.0f, 6.75f, 27.0f, 14.5384617f, 10, 10, 2269 },
+    { 1.75f, 13.0f, 12.75f, 16.0f, 14.5384617f, 22, 3, 2321 },
+    { 3.75f, 17.0f, 6.75f, 22.0f, 14.5384617f, 6, 5, 2345 },
+    { 1.75f, 3.0f, 12.75f, 25.0f, 14.5384617f, 22, 22, 2362 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 2498 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 2674 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 2817 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 3017 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 3210 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 3440 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 3587 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 3749 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 3869 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 4020 },
+    { 5.75f, 9.0f, 8.75f, 22.0f, 14.5384617f, 6, 13, 4182 },
+    { 1.75f, 9.0f, 6.75f, 27.0f, 14.5384617f, 10, 18, 4226 },
+    { -0.25f, 9.0f, 12.75f, 20.0f, 14.5384617f, 26, 11, 4311 },
+    { 1.75f, 11.0f, 15.25f, 18.0f, 14.5384617f, 27, 7, 4442 },
+    { 1.75f, 9.0f, 15.25f, 20.0f, 14.5384617f, 27, 11, 4492 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 4626 },
+    { -0.25f, 5.0f, 15.25f, 22.0f, 14.5384617f, 31, 17, 4795 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 5093 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 5232 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 5384 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 0 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 5553 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 5664 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 5757 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 5995 },
+    { 3.75f, 5.0f, 10.75f, 22.0f, 14.5384617f, 14, 17, 6099 },
+    { 1.75f, 5.0f, 10.75f, 22.0f, 14.5384617f, 18, 17, 6175 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 6251 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 6544 },
+    { -0.25f, 5.0f, 15.25f, 22.0f, 14.5384617f, 31, 17, 6595 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 6803 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 6993 },
+    { 1.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 22, 17, 7183 },
+    { 1.75f, 5.0f, 15.25f, 25.0f, 14.5384617f, 27, 20, 7293 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 7514 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 7717 },
+    { -0.25f, 5.0f, 15.25f, 22.0f, 14.5384617f, 31, 17, 7944 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 7998 },
+    { -0.25f, 5.0f, 15.25f, 22.0f, 14.5384617f, 31, 17, 8074 },
+    { -0.25f, 5.0f, 15.25f, 22.0f, 14.5384617f, 31, 17, 8238 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 8495 },
+    { -0.25f, 5.0f, 15.25f, 22.0f, 14.5384617f, 31, 17, 8695 },
+    { 1.75f, 5.0f, 15.25f, 22.0f, 14.5384617f, 27, 17, 8859 },
+    { 3.75f, 3.0f, 10.75f, 27.0f, 14.5384617f, 14, 24, 9044 },
+    { 1.75f, 3.0f, 12.75f, 25.0f, 14.5384617f, 22, 22, 9126 },
+    { 3.75f, 3.0f, 10.75f, 27.0f, 14.5384617f, 14, 24, 9262 },
+    { 1.75f, 3.0f, 12.75f, 16.0f, 14.5384617f, 22, 13, 9344 },
+    { -0.25f, 22.0f, 15.25f, 25.0f, 14.5384617f, 31, 3, 9465 },
+    { 3.75f, 3.0f, 8.75f, 8.0f, 14.5384617f, 10, 5, 9480 },
+    { 1.75f, 9.0f, 12.75f, 22.0f, 14.5384617f, 22, 13, 9527 },
+    { 1.75f, 3.0f, 12.75f, 22.0f, 14.5384617f, 22, 19, 330 },
+    { 1.75f, 9.0f, 12.75f, 22.0f, 14.5384617f, 22, 13, 9659 },
+    { 1.75f, 3.0f, 12.75f, 22.0f, 14.5384617f, 22, 19, 9803 },
+    { 1.75f, 9.0f, 12.75f, 22.0f, 14.5384617f, 22, 13, 168 },
+    { 1.75f, 3.0f, 12.75f, 22.0f, 14.5384617f, 22, 19, 9914 },
+    { 1.75f, 9.0f, 12.75f, 29.0f, 14.5384617f, 22, 20, 508 },
+    { 1.75f, 3.0f, 12.75f, 22.0f, 14.5384617f, 22, 19, 10027 },
+    { 3.75f, 3.0f, 8.75f, 22.0f, 14.5384617f, 10, 19, 10114 },
+    { 1.75f, 3.0f, 10.75f, 27.0f, 14.5384617f, 18, 24, 10190 },
+    { 1.75f, 3.0f, 12.75f, 22.0f, 14.5384617f, 22, 19, 10306 },
+    { 3.75f, 3.0f, 8.75f, 22.0f, 14.5384617f, 10, 19, 10536 },
+    { -0.25f, 9.0f, 15.25f, 22.0f, 14.5384617f, 31, 13, 10587 },
+    { 1.75f, 9.0f, 12.75f, 22.0f, 14.5384617f, 22, 13, 10684 },
+    { 1.75f, 9.0f, 12.75f, 22.0f, 14.5384617f, 22, 13, 10745 },
+    { 1.75f, 9.0f, 12.75f, 29.0f, 14.5384617f, 22, 20, 10836 },
+    { 1.75f, 9.0f, 12.75f, 29.0f, 14.5384617f, 22, 20, 10944 },
+    { 1.75f, 9.0f, 12.75f, 22.0f, 14.5384617f, 22, 13, 11052 },
+    { 1.75f, 9.0f, 12.75f, 22.0f, 14.5384617f, 22, 13, 11161 },
+    { 3.75f, 5.0f, 12.75f, 22.0f, 14.5384617f, 18, 17, 11300 },
+    { 1.75f, 9.0f, 12.75f, 22.0f, 14.5384617f, 22, 13, 441 },
+    { 1.75f, 9.0f, 12.75f, 22.0f, 14.5384617f, 22, 13, 11390 },
+    { -0.25f, 9.0f, 15.25f, 22.0f, 14.5384617f, 31, 13, 11501 },
+    { 1.75f, 9.0f, 12.75f, 22.0f, 14.5384617f, 22, 13, 11754 },
+    { 1.75f, 9.0f, 12.75f, 29.0f, 14.5384617f, 22, 20, 11938 },
+    { 1.75f, 9.0f, 12.75f, 22.0f, 14.5384617f, 22, 13, 12055 },
+    { 1.75f, 3.0f, 12.75f, 27.0f, 14.5384617f, 22, 24, 12193 },
+    { 5.75f, 3.0f, 8.75f, 27.0f, 14.5384617f, 6, 24, 12334 },
+    { 1.75f, 3.0f, 12.75f, 27.0f, 14.5384617f, 22, 24, 12376 },
+    { -0.25f, 11.0f, 15.25f, 16.0f, 14.5384617f, 31, 5, 12517 },
+    { 0.0f, 0.0f, 0.0f, 0.0f, 17.2307701f, 0, 0, 0 },
+    { 6.75f, 6.03174591f, 10.25f, 26.0317459f, 17.2307701f, 7, 20, 13328 },
+    { 4.25f, 3.03174591f, 12.75f, 12.0317459f, 17.2307701f, 17, 9, 13384 },
+    { -0.25f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 36, 20, 13444 },
+    { 1.75f, 6.03174591f, 15.25f, 29.0317459f, 17.2307701f, 27, 23, 13679 },
+    { -0.25f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 36, 20, 13924 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 14261 },
+    { 6.75f, 3.03174591f, 10.25f, 12.0317459f, 17.2307701f, 7, 9, 14528 },
+    { 4.25f, 3.03174591f, 12.75f, 31.0317459f, 17.2307701f, 17, 28, 14558 },
+    { 4.25f, 3.03174591f, 12.75f, 31.0317459f, 17.2307701f, 17, 28, 14709 },
+    { 1.75f, 11.0317459f, 15.25f, 24.0317459f, 17.2307701f, 27, 13, 14860 },
+    { 1.75f, 11.0317459f, 15.25f, 24.0317459f, 17.2307701f, 27, 13, 15090 },
+    { 1.75f, 21.0317459f, 7.75f, 31.0317459f, 17.2307701f, 12, 10, 15188 },
+    { 1.75f, 16.0317459f, 15.25f, 19.0317459f, 17.2307701f, 27, 3, 15246 },
+    { 4.25f, 21.0317459f, 7.75f, 26.0317459f, 17.2307701f, 7, 5, 15270 },
+    { 1.75f, 3.03174591f, 15.25f, 29.0317459f, 17.2307701f, 27, 26, 15289 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 15444 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 15646 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 15807 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 16030 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 16242 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 16500 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 16661 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 16838 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 16972 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 17138 },
+    { 6.75f, 11.0317459f, 10.25f, 26.0317459f, 17.2307701f, 7, 15, 17315 },
+    { 1.75f, 11.0317459f, 7.75f, 31.0317459f, 17.2307701f, 12, 20, 17366 },
+    { -0.25f, 11.0317459f, 15.25f, 24.0317459f, 17.2307701f, 31, 13, 17462 },
+    { 1.75f, 13.0317459f, 17.75f, 22.0317459f, 17.2307701f, 32, 9, 17595 },
+    { 1.75f, 11.0317459f, 17.75f, 24.0317459f, 17.2307701f, 32, 13, 17647 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 17783 },
+    { -0.25f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 36, 20, 17971 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 18299 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 18449 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 18613 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 12621 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 18795 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 18915 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 19016 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 19271 },
+    { 4.25f, 6.03174591f, 12.75f, 26.0317459f, 17.2307701f, 17, 20, 19383 },
+    { 1.75f, 6.03174591f, 12.75f, 26.0317459f, 17.2307701f, 22, 20, 19469 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 19551 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 19880 },
+    { -0.25f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 36, 20, 19937 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 20165 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 20376 },
+    { 1.75f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 20, 20584 },
+    { 1.75f, 6.03174591f, 17.75f, 29.0317459f, 17.2307701f, 32, 23, 20705 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 20945 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 21169 },
+    { -0.25f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 36, 20, 21408 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 21467 },
+    { -0.25f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 36, 20, 21549 },
+    { -0.25f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 36, 20, 21732 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 22017 },
+    { -0.25f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 36, 20, 22237 },
+    { 1.75f, 6.03174591f, 17.75f, 26.0317459f, 17.2307701f, 32, 20, 22420 },
+    { 4.25f, 3.03174591f, 12.75f, 31.0317459f, 17.2307701f, 17, 28, 22623 },
+    { 1.75f, 3.03174591f, 15.25f, 29.0317459f, 17.2307701f, 27, 26, 22712 },
+    { 4.25f, 3.03174591f, 12.75f, 31.0317459f, 17.2307701f, 17, 28, 22867 },
+    { 1.75f, 3.03174591f, 15.25f, 19.0317459f, 17.2307701f, 27, 16, 22956 },
+    { -0.25f, 26.0317459f, 17.75f, 29.0317459f, 17.2307701f, 36, 3, 23097 },
+    { 4.25f, 3.03174591f, 10.25f, 9.03174591f, 17.2307701f, 12, 6, 23112 },
+    { 1.75f, 11.0317459f, 15.25f, 26.0317459f, 17.2307701f, 27, 15, 23166 },
+    { 1.75f, 3.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 23, 12983 },
+    { 1.75f, 11.0317459f, 15.25f, 26.0317459f, 17.2307701f, 27, 15, 23309 },
+    { 1.75f, 3.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 23, 23468 },
+    { 1.75f, 11.0317459f, 15.25f, 26.0317459f, 17.2307701f, 27, 15, 12805 },
+    { 1.75f, 3.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 23, 23592 },
+    { 1.75f, 11.0317459f, 15.25f, 34.0317459f, 17.2307701f, 27, 23, 13182 },
+    { 1.75f, 3.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 23, 23716 },
+    { 4.25f, 3.03174591f, 10.25f, 26.0317459f, 17.2307701f, 12, 23, 23814 },
+    { 1.75f, 3.03174591f, 12.75f, 31.0317459f, 17.2307701f, 22, 28, 23900 },
+    { 1.75f, 3.03174591f, 15.25f, 26.0317459f, 17.2307701f, 27, 23, 24027 },
+    { 4.25f, 3.03174591f, 10.25f, 26.0317459f, 17.2307701f, 12, 23, 24291 },
+    { -0.25f, 11.0317459f, 17.75f, 26.0317459f, 17.2307701f, 36, 15, 24349 },
+    { 1.75f, 11.0317459f, 15.25f, 26.0317459f, 17.2307701f, 27, 15, 24452 },
+    { 1.75f, 11.0317459f, 15.25f, 26.0317459f, 17.2307701f, 27, 15, 24519 },
+    { 1.75f, 11.0317459f, 15.25f, 34.0317459f, 17.2307701f, 27, 23, 24618 },
+    { 1.75f, 11.0317459f, 15.25f, 34.0317459f, 17.2307701f, 27, 23, 24737 },
+    { 1.75f, 11.0317459f, 15.25f, 26.0317459f, 17.2307701f, 27, 15, 24856 },
+    { 1.75f, 11.0317459f, 15.25f, 26.0317459f, 17.2307701f, 27, 15, 24979 },
+    { 4.25f, 6.03174591f, 15.25f, 26.0317459f, 17.2307701f, 22, 20, 25129 },
+    { 1.75f, 11.0317459f, 15.25f, 26.0317459f, 17.2307701f, 27, 15, 13107 },
+    { 1.75f, 11.0317459f, 15.25f, 26.0317459f, 17.2307701f, 27, 15, 25228 },
+    { -0.25f, 11.0317459f, 17.75f, 26.0317459f, 17.2307701f, 36, 15, 25357 },
+    { 1.75f, 11.0317459f, 15.25f, 26.0317459f, 17.2307701f, 27, 15, 25637 },
+    { 1.75f, 11.0317459f, 15.25f, 34.0317459f, 17.2307701f, 27, 23, 25852 },
+    { 1.75f, 11.0317459f, 15.25f, 26.0317459f, 17.2307701f, 27, 15, 25980 },
+    { 1.75f, 3.03174591f, 15.25f, 31.0317459f, 17.2307701f, 27, 28, 26133 },
+    { 6.75f, 3.03174591f, 10.25f, 31.0317459f, 17.2307701f, 7, 28, 26284 },
+    { 1.75f, 3.03174591f, 15.25f, 31.0317459f, 17.2307701f, 27, 28, 26333 },
+    { -0.25f, 13.0317459f, 17.75f, 19.0317459f, 17.2307701f, 36, 6, 26484 },
+    { 0.0f, 0.0f, 0.0f, 0.0f, 19.3846169f, 0, 0, 0 },
+    { 7.75f, 6.0f, 11.75f, 29.0f, 19.3846169f, 8, 23, 27309 },
+    { 5.25f, 4.0f, 14.25f, 13.0f, 19.3846169f, 18, 9, 27368 },
+    { -0.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 40, 23, 27428 },
+    { 2.25f, 6.0f, 17.25f, 32.0f, 19.3846169f, 30, 26, 27666 },
+    { -0.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 40, 23, 27914 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 28254 },
+    { 7.75f, 4.0f, 11.75f, 13.0f, 19.3846169f, 8, 9, 28524 },
+    { 5.25f, 4.0f, 14.25f, 35.0f, 19.3846169f, 18, 31, 28554 },
+    { 5.25f, 4.0f, 14.25f, 35.0f, 19.3846169f, 18, 31, 28708 },
+    { 2.25f, 12.0f, 17.25f, 27.0f, 19.3846169f, 30, 15, 28862 },
+    { 2.25f, 12.0f, 17.25f, 27.0f, 19.3846169f, 30, 15, 29094 },
+    { 2.25f, 23.0f, 8.75f, 35.0f, 19.3846169f, 13, 12, 29194 },
+    { 2.25f, 17.0f, 17.25f, 21.0f, 19.3846169f, 30, 4, 29254 },
+    { 5.25f, 23.0f, 8.75f, 29.0f, 19.3846169f, 7, 6, 29279 },
+    { 2.25f, 4.0f, 17.25f, 32.0f, 19.3846169f, 30, 28, 29299 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 29456 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 29661 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 29825 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 30050 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 30265 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 30526 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 30690 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 30870 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 31007 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 31176 },
+    { 7.75f, 12.0f, 11.75f, 29.0f, 19.3846169f, 8, 17, 31356 },
+    { 2.25f, 12.0f, 8.75f, 35.0f, 19.3846169f, 13, 23, 31409 },
+    { -0.25f, 12.0f, 17.25f, 27.0f, 19.3846169f, 35, 15, 31508 },
+    { 2.25f, 15.0f, 19.75f, 24.0f, 19.3846169f, 35, 9, 31643 },
+    { 2.25f, 12.0f, 19.75f, 27.0f, 19.3846169f, 35, 15, 31695 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 31833 },
+    { -0.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 40, 23, 32024 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 32355 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 32508 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 32675 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 26590 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 32860 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 32983 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 33087 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 33345 },
+    { 5.25f, 6.0f, 14.25f, 29.0f, 19.3846169f, 18, 23, 33460 },
+    { 2.25f, 6.0f, 14.25f, 29.0f, 19.3846169f, 24, 23, 33549 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 33634 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 33966 },
+    { -0.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 40, 23, 34026 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 34257 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 34471 },
+    { 2.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 30, 23, 34682 },
+    { 2.25f, 6.0f, 19.75f, 32.0f, 19.3846169f, 35, 26, 34806 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 35049 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 35276 },
+    { -0.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 40, 23, 35518 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 35580 },
+    { -0.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 40, 23, 35665 },
+    { -0.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 40, 23, 35851 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 36139 },
+    { -0.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 40, 23, 36361 },
+    { 2.25f, 6.0f, 19.75f, 29.0f, 19.3846169f, 35, 23, 36547 },
+    { 5.25f, 4.0f, 14.25f, 35.0f, 19.3846169f, 18, 31, 36752 },
+    { 2.25f, 4.0f, 17.25f, 32.0f, 19.3846169f, 30, 28, 36844 },
+    { 5.25f, 4.0f, 14.25f, 35.0f, 19.3846169f, 18, 31, 37001 },
+    { 2.25f, 4.0f, 17.25f, 21.0f, 19.3846169f, 30, 17, 37093 },
+    { -0.25f, 29.0f, 19.75f, 32.0f, 19.3846169f, 40, 3, 37235 },
+    { 5.25f, 4.0f, 11.75f, 10.0f, 19.3846169f, 13, 6, 37250 },
+    { 2.25f, 12.0f, 17.25f, 29.0f, 19.3846169f, 30, 17, 37304 },
+    { 2.25f, 4.0f, 17.25f, 29.0f, 19.3846169f, 30, 25, 26957 },
+    { 2.25f, 12.0f, 17.25f, 29.0f, 19.3846169f, 30, 17, 37449 },
+    { 2.25f, 4.0f, 17.25f, 29.0f, 19.3846169f, 30, 25, 37610 },
+    { 2.25f, 12.0f, 17.25f, 29.0f, 19.3846169f, 30, 17, 26777 },
+    { 2.25f, 4.0f, 17.25f, 29.0f, 19.3846169f, 30, 25, 37736 },
+    { 2.25f, 12.0f, 17.25f, 38.0f, 19.3846169f, 30, 26, 27160 },
+    { 2.25f, 4.0f, 17.25f, 29.0f, 19.3846169f, 30, 25, 37862 },
+    { 5.25f, 4.0f, 11.75f, 29.0f, 19.3846169f, 13, 25, 37962 },
+    { 2.25f, 4.0f, 14.25f, 35.0f, 19.3846169f, 24, 31, 38050 },
+    { 2.25f, 4.0f, 17.25f, 29.0f, 19.3846169f, 30, 25, 38180 },
+    { 5.25f, 4.0f, 11.75f, 29.0f, 19.3846169f, 13, 25, 38446 },
+    { -0.25f, 12.0f, 19.75f, 29.0f, 19.3846169f, 40, 17, 38506 },
+    { 2.25f, 12.0f, 17.25f, 29.0f, 19.3846169f, 30, 17, 38611 },
+    { 2.25f, 12.0f, 17.25f, 29.0f, 19.3846169f, 30, 17, 38680 },
+    { 2.25f, 12.0f, 17.25f, 38.0f, 19.3846169f, 30, 26, 38781 },
+    { 2.25f, 12.0f, 17.25f, 38.0f, 19.3846169f, 30, 26, 38903 },
+    { 2.25f, 12.0f, 17.25f, 29.0f, 19.3846169f, 30, 17, 39025 },
+    { 2.25f, 12.0f, 17.25f, 29.0f, 19.3846169f, 30, 17, 39150 },
+    { 5.25f, 6.0f, 17.25f, 29.0f, 19.3846169f, 24, 23, 39302 },
+    { 2.25f, 12.0f, 17.25f, 29.0f, 19.3846169f, 30, 17, 27083 },
+    { 2.25f, 12.0f, 17.25f, 29.0f, 19.3846169f, 30, 17, 39404 },
+    { -0.25f, 12.0f, 19.75f, 29.0f, 19.3846169f, 40, 17, 39535 },
+    { 2.25f, 12.0f, 17.25f, 29.0f, 19.3846169f, 30, 17, 39817 },
+    { 2.25f, 12.0f, 17.25f, 38.0f, 19.3846169f, 30, 26, 40034 },
+    { 2.25f, 12.0f, 17.25f, 29.0f, 19.3846169f, 30, 17, 40165 },
+    { 2.25f, 4.0f, 17.25f, 35.0f, 19.3846169f, 30, 31, 40320 },
+    { 7.75f, 4.0f, 11.75f, 35.0f, 19.3846169f, 8, 31, 40474 },
+    { 2.25f, 4.0f, 17.25f, 35.0f, 19.3846169f, 30, 31, 40526 },
+    { -0.25f, 15.0f, 19.75f, 21.0f, 19.3846169f, 40, 6, 40680 },
+    { 0.0f, 0.0f, 0.0f, 0.0f, 22.0769234f, 0, 0, 0 },
+    { 9.0f, 7.0370369f, 13.0f, 33.0370369f, 22.0769234f, 4, 26, 41332 },
+    { 6.0f, 4.0370369f, 16.0f, 15.0370369f, 22.0769234f, 10, 11, 41379 },
+    { 0.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 23, 26, 41420 },
+    { 3.0f, 7.0370369f, 19.0f, 37.0370369f, 22.0769234f, 16, 30, 41588 },
+    { 0.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 23, 26, 41768 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 42001 },
+    { 9.0f, 4.0370369f, 13.0f, 15.0370369f, 22.0769234f, 4, 11, 42200 },
+    { 6.0f, 4.0370369f, 16.0f, 40.0370369f, 22.0769234f, 10, 36, 42223 },
+    { 6.0f, 4.0370369f, 16.0f, 40.0370369f, 22.0769234f, 10, 36, 42341 },
+    { 3.0f, 14.0370369f, 19.0f, 30.0370369f, 22.0769234f, 16, 16, 42459 },
+    { 3.0f, 14.0370369f, 19.0f, 30.0370369f, 22.0769234f, 16, 16, 42612 },
+    { 3.0f, 26.0370369f, 10.0f, 40.0370369f, 22.0769234f, 7, 14, 42689 },
+    { 3.0f, 20.0370369f, 19.0f, 24.0370369f, 22.0769234f, 16, 4, 42734 },
+    { 6.0f, 26.0370369f, 10.0f, 33.0370369f, 22.0769234f, 4, 7, 42753 },
+    { 3.0f, 4.0370369f, 19.0f, 37.0370369f, 22.0769234f, 16, 33, 42768 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 42889 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 43034 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 43157 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 43323 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 43483 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 43674 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 43797 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 43935 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 44040 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 44168 },
+    { 9.0f, 14.0370369f, 13.0f, 33.0370369f, 22.0769234f, 4, 19, 44306 },
+    { 3.0f, 14.0370369f, 10.0f, 40.0370369f, 22.0769234f, 7, 26, 44346 },
+    { 0.0f, 14.0370369f, 19.0f, 30.0370369f, 22.0769234f, 19, 16, 44422 },
+    { 3.0f, 17.0370369f, 23.0f, 27.0370369f, 22.0769234f, 20, 10, 44529 },
+    { 3.0f, 14.0370369f, 23.0f, 30.0370369f, 22.0769234f, 20, 16, 44570 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 44683 },
+    { 0.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 23, 26, 44827 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 45062 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 45184 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 45313 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 40786 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 45458 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 45554 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 45637 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 45834 },
+    { 6.0f, 7.0370369f, 16.0f, 33.0370369f, 22.0769234f, 10, 26, 45925 },
+    { 3.0f, 7.0370369f, 16.0f, 33.0370369f, 22.0769234f, 13, 26, 45994 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 46065 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 46300 },
+    { 0.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 23, 26, 46351 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 46512 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 46668 },
+    { 3.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 26, 46829 },
+    { 3.0f, 7.0370369f, 23.0f, 37.0370369f, 22.0769234f, 20, 30, 46925 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 47111 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 47279 },
+    { 0.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 23, 26, 47469 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 47519 },
+    { 0.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 23, 26, 47590 },
+    { 0.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 23, 26, 47726 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 47927 },
+    { 0.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 23, 26, 48094 },
+    { 3.0f, 7.0370369f, 23.0f, 33.0370369f, 22.0769234f, 20, 26, 48230 },
+    { 6.0f, 4.0370369f, 16.0f, 40.0370369f, 22.0769234f, 10, 36, 48385 },
+    { 3.0f, 4.0370369f, 19.0f, 37.0370369f, 22.0769234f, 16, 33, 48463 },
+    { 6.0f, 4.0370369f, 16.0f, 40.0370369f, 22.0769234f, 10, 36, 48584 },
+    { 3.0f, 4.0370369f, 19.0f, 24.0370369f, 22.0769234f, 16, 20, 48662 },
+    { 0.0f, 33.0370369f, 23.0f, 37.0370369f, 22.0769234f, 23, 4, 48764 },
+    { 6.0f, 4.0370369f, 13.0f, 11.0370369f, 22.0769234f, 7, 7, 48774 },
+    { 3.0f, 14.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 19, 48812 },
+    { 3.0f, 4.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 29, 41058 },
+    { 3.0f, 14.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 19, 48922 },
+    { 3.0f, 4.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 29, 49040 },
+    { 3.0f, 14.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 19, 40927 },
+    { 3.0f, 4.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 29, 49138 },
+    { 3.0f, 14.0370369f, 19.0f, 43.0370369f, 22.0769234f, 16, 29, 41215 },
+    { 3.0f, 4.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 29, 49240 },
+    { 6.0f, 4.0370369f, 13.0f, 33.0370369f, 22.0769234f, 7, 29, 49320 },
+    { 3.0f, 4.0370369f, 16.0f, 40.0370369f, 22.0769234f, 13, 36, 49391 },
+    { 3.0f, 4.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 29, 49497 },
+    { 6.0f, 4.0370369f, 13.0f, 33.0370369f, 22.0769234f, 7, 29, 49684 },
+    { 0.0f, 14.0370369f, 23.0f, 33.0370369f, 22.0769234f, 23, 19, 49736 },
+    { 3.0f, 14.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 19, 49815 },
+    { 3.0f, 14.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 19, 49870 },
+    { 3.0f, 14.0370369f, 19.0f, 43.0370369f, 22.0769234f, 16, 29, 49949 },
+    { 3.0f, 14.0370369f, 19.0f, 43.0370369f, 22.0769234f, 16, 29, 50044 },
+    { 3.0f, 14.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 19, 50139 },
+    { 3.0f, 14.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 19, 50230 },
+    { 6.0f, 7.0370369f, 19.0f, 33.0370369f, 22.0769234f, 13, 26, 50346 },
+    { 3.0f, 14.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 19, 41156 },
+    { 3.0f, 14.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 19, 50426 },
+    { 0.0f, 14.0370369f, 23.0f, 33.0370369f, 22.0769234f, 23, 19, 50519 },
+    { 3.0f, 14.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 19, 50713 },
+    { 3.0f, 14.0370369f, 19.0f, 43.0370369f, 22.0769234f, 16, 29, 50861 },
+    { 3.0f, 14.0370369f, 19.0f, 33.0370369f, 22.0769234f, 16, 19, 50964 },
+    { 3.0f, 4.0370369f, 19.0f, 40.0370369f, 22.0769234f, 16, 36, 51078 },
+    { 9.0f, 4.0370369f, 13.0f, 40.0370369f, 22.0769234f, 4, 36, 51205 },
+    { 3.0f, 4.0370369f, 19.0f, 40.0370369f, 22.0769234f, 16, 36, 51253 },
+    { 0.0f, 17.0370369f, 23.0f, 24.0370369f, 22.0769234f, 23, 7, 51380 },
+    { 0.0f, 0.0f, 0.0f, 0.0f, 24.2307701f, 0, 0, 0 },
+    { 10.0f, 8.0f, 14.0f, 36.0f, 24.2307701f, 4, 28, 52019 },
+    { 6.0f, 4.0f, 18.0f, 16.0f, 24.2307701f, 12, 12, 52068 },
+    { 0.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 25, 28, 52116 },
+    { 3.0f, 8.0f, 21.0f, 40.0f, 24.2307701f, 18, 32, 52297 },
+    { 0.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 25, 28, 52488 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 52739 },
+    { 10.0f, 4.0f, 14.0f, 16.0f, 24.2307701f, 4, 12, 52946 },
+    { 6.0f, 4.0f, 18.0f, 43.0f, 24.2307701f, 12, 39, 52970 },
+    { 6.0f, 4.0f, 18.0f, 43.0f, 24.2307701f, 12, 39, 53100 },
+    { 3.0f, 15.0f, 21.0f, 33.0f, 24.2307701f, 18, 18, 53230 },
+    { 3.0f, 15.0f, 21.0f, 33.0f, 24.2307701f, 18, 18, 53397 },
+    { 3.0f, 29.0f, 11.0f, 43.0f, 24.2307701f, 8, 14, 53476 },
+    { 3.0f, 22.0f, 21.0f, 26.0f, 24.2307701f, 18, 4, 53524 },
+    { 6.0f, 29.0f, 11.0f, 36.0f, 24.2307701f, 5, 7, 53543 },
+    { 3.0f, 4.0f, 21.0f, 40.0f, 24.2307701f, 18, 36, 53560 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 53690 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 53843 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 53972 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 54146 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 54308 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 54508 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 54633 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 54776 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 54888 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 55018 },
+    { 10.0f, 15.0f, 14.0f, 36.0f, 24.2307701f, 4, 21, 55161 },
+    { 3.0f, 15.0f, 11.0f, 43.0f, 24.2307701f, 8, 28, 55203 },
+    { 0.0f, 15.0f, 21.0f, 33.0f, 24.2307701f, 21, 18, 55287 },
+    { 3.0f, 18.0f, 25.0f, 30.0f, 24.2307701f, 22, 12, 55396 },
+    { 3.0f, 15.0f, 25.0f, 33.0f, 24.2307701f, 22, 18, 55439 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 55554 },
+    { 0.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 25, 28, 55703 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 55948 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 56075 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 56206 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 51461 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 56359 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 56457 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 56542 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 56747 },
+    { 6.0f, 8.0f, 18.0f, 36.0f, 24.2307701f, 12, 28, 56840 },
+    { 3.0f, 8.0f, 18.0f, 36.0f, 24.2307701f, 15, 28, 56915 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 56991 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 57237 },
+    { 0.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 25, 28, 57290 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 57459 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 57623 },
+    { 3.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 18, 28, 57792 },
+    { 3.0f, 8.0f, 25.0f, 40.0f, 24.2307701f, 22, 32, 57890 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 58084 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 58257 },
+    { 0.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 25, 28, 58449 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 58501 },
+    { 0.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 25, 28, 58574 },
+    { 0.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 25, 28, 58718 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 58929 },
+    { 0.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 25, 28, 59104 },
+    { 3.0f, 8.0f, 25.0f, 36.0f, 24.2307701f, 22, 28, 59248 },
+    { 6.0f, 4.0f, 18.0f, 43.0f, 24.2307701f, 12, 39, 59411 },
+    { 3.0f, 4.0f, 21.0f, 40.0f, 24.2307701f, 18, 36, 59495 },
+    { 6.0f, 4.0f, 18.0f, 43.0f, 24.2307701f, 12, 39, 59625 },
+    { 3.0f, 4.0f, 21.0f, 26.0f, 24.2307701f, 18, 22, 59709 },
+    { 0.0f, 36.0f, 25.0f, 40.0f, 24.2307701f, 25, 4, 59819 },
+    { 6.0f, 4.0f, 14.0f, 12.0f, 24.2307701f, 8, 8, 59829 },
+    { 3.0f, 15.0f, 21.0f, 36.0f, 24.2307701f, 18, 21, 59871 },
+    { 3.0f, 4.0f, 21.0f, 36.0f, 24.2307701f, 18, 32, 51737 },
+    { 3.0f, 15.0f, 21.0f, 36.0f, 24.2307701f, 18, 21, 59983 },
+    { 3.0f, 4.0f, 21.0f, 36.0f, 24.2307701f, 18, 32, 60103 },
+    { 3.0f, 15.0f, 21.0f, 36.0f, 24.2307701f, 18, 21, 51604 },
+    { 3.0f, 4.0f, 21.0f, 36.0f, 24.2307701f, 18, 32, 60204 },
+    { 3.0f, 15.0f, 21.0f, 47.0f, 24.2307701f, 18, 32, 51899 },
+    { 3.0f, 4.0f, 21.0f, 36.0f, 24.2307701f, 18, 32, 60314 },
+    { 6.0f, 4.0f, 14.0f, 36.0f, 24.2307701f, 8, 32, 60397 },
+    { 3.0f, 4.0f, 18.0f, 43.0f, 24.2307701f, 15, 39, 60472 },
+    { 3.0f, 4.0f, 21.0f, 36.0f, 24.2307701f, 18, 32, 60587 },
+    { 6.0f, 4.0f, 14.0f, 36.0f, 24.2307701f, 8, 32, 60786 },
+    { 0.0f, 15.0f, 25.0f, 36.0f, 24.2307701f, 25, 21, 60842 },
+    { 3.0f, 15.0f, 21.0f, 36.0f, 24.2307701f, 18, 21, 60923 },
+    { 3.0f, 15.0f, 21.0f, 36.0f, 24.2307701f, 18, 21, 60980 },
+    { 3.0f, 15.0f, 21.0f, 47.0f, 24.2307701f, 18, 32, 61061 },
+    { 3.0f, 15.0f, 21.0f, 47.0f, 24.2307701f, 18, 32, 61159 },
+    { 3.0f, 15.0f, 21.0f, 36.0f, 24.2307701f, 18, 21, 61257 },
+    { 3.0f, 15.0f, 21.0f, 36.0f, 24.2307701f, 18, 21, 61354 },
+    { 6.0f, 8.0f, 21.0f, 36.0f, 24.2307701f, 15, 28, 61475 },
+    { 3.0f, 15.0f, 21.0f, 36.0f, 24.2307701f, 18, 21, 51838 },
+    { 3.0f, 15.0f, 21.0f, 36.0f, 24.2307701f, 18, 21, 61563 },
+    { 0.0f, 15.0f, 25.0f, 36.0f, 24.2307701f, 25, 21, 61664 },
+    { 3.0f, 15.0f, 21.0f, 36.0f, 24.2307701f, 18, 21, 61868 },
+    { 3.0f, 15.0f, 21.0f, 47.0f, 24.2307701f, 18, 32, 62030 },
+    { 3.0f, 15.0f, 21.0f, 36.0f, 24.2307701f, 18, 21, 62136 },
+    { 3.0f, 4.0f, 21.0f, 43.0f, 24.2307701f, 18, 39, 62258 },
+    { 10.0f, 4.0f, 14.0f, 43.0f, 24.2307701f, 4, 39, 62388 },
+    { 3.0f, 4.0f, 21.0f, 43.0f, 24.2307701f, 18, 39, 62439 },
+    { 0.0f, 18.0f, 25.0f, 26.0f, 24.2307701f, 25, 8, 62569 },
+    { 0.0f, 0.0f, 0.0f, 0.0f, 26.9230785f, 0, 0, 0 },
+    { 11.0f, 9.03030396f, 16.0f, 40.030304f, 26.9230785f, 5, 31, 63272 },
+    { 7.0f, 5.03030396f, 20.0f, 17.030304f, 26.9230785f, 13, 12, 63329 },
+    { 0.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 27, 31, 63380 },
+    { 3.0f, 9.03030396f, 24.0f, 44.030304f, 26.9230785f, 21, 35, 63578 },
+    { 0.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 27, 31, 63789 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 64067 },
+    { 11.0f, 5.03030396f, 16.0f, 17.030304f, 26.9230785f, 5, 12, 64285 },
+    { 7.0f, 5.03030396f, 20.0f, 48.030304f, 26.9230785f, 13, 43, 64312 },
+    { 7.0f, 5.03030396f, 20.0f, 48.030304f, 26.9230785f, 13, 43, 64452 },
+    { 3.0f, 16.030304f, 24.0f, 37.030304f, 26.9230785f, 21, 21, 64592 },
+    { 3.0f, 16.030304f, 24.0f, 37.030304f, 26.9230785f, 21, 21, 64784 },
+    { 3.0f, 32.030304f, 12.0f, 48.030304f, 26.9230785f, 9, 16, 64872 },
+    { 3.0f, 24.030304f, 24.0f, 29.030304f, 26.9230785f, 21, 5, 64925 },
+    { 7.0f, 32.030304f, 12.0f, 40.030304f, 26.9230785f, 5, 8, 64945 },
+    { 3.0f, 5.03030396f, 24.0f, 44.030304f, 26.9230785f, 21, 39, 64963 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 65105 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 65278 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 65421 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 65612 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 65793 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 66012 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 66151 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 66306 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 66427 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 66572 },
+    { 11.0f, 16.030304f, 16.0f, 40.030304f, 26.9230785f, 5, 24, 66727 },
+    { 3.0f, 16.030304f, 12.0f, 48.030304f, 26.9230785f, 9, 32, 66777 },
+    { 0.0f, 16.030304f, 24.0f, 37.030304f, 26.9230785f, 24, 21, 66868 },
+    { 3.0f, 20.030304f, 27.0f, 33.030304f, 26.9230785f, 24, 13, 66980 },
+    { 3.0f, 16.030304f, 27.0f, 37.030304f, 26.9230785f, 24, 21, 67024 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 67142 },
+    { 0.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 27, 31, 67307 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 67569 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 67702 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 67842 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 62651 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 67995 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 68102 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 68195 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 68402 },
+    { 7.0f, 9.03030396f, 20.0f, 40.030304f, 26.9230785f, 13, 31, 68498 },
+    { 3.0f, 9.03030396f, 20.0f, 40.030304f, 26.9230785f, 17, 31, 68579 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 68658 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 68926 },
+    { 0.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 27, 31, 68985 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 69162 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 69334 },
+    { 3.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 31, 69512 },
+    { 3.0f, 9.03030396f, 27.0f, 44.030304f, 26.9230785f, 24, 35, 69621 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 69821 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 70010 },
+    { 0.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 27, 31, 70205 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 70262 },
+    { 0.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 27, 31, 70338 },
+    { 0.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 27, 31, 70492 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 70716 },
+    { 0.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 27, 31, 70900 },
+    { 3.0f, 9.03030396f, 27.0f, 40.030304f, 26.9230785f, 24, 31, 71054 },
+    { 7.0f, 5.03030396f, 20.0f, 48.030304f, 26.9230785f, 13, 43, 71226 },
+    { 3.0f, 5.03030396f, 24.0f, 44.030304f, 26.9230785f, 21, 39, 71314 },
+    { 7.0f, 5.03030396f, 20.0f, 48.030304f, 26.9230785f, 13, 43, 71456 },
+    { 3.0f, 5.03030396f, 24.0f, 29.030304f, 26.9230785f, 21, 24, 71544 },
+    { 0.0f, 40.030304f, 27.0f, 44.030304f, 26.9230785f, 27, 4, 71667 },
+    { 7.0f, 5.03030396f, 16.0f, 14.030304f, 26.9230785f, 9, 9, 71677 },
+    { 3.0f, 16.030304f, 24.0f, 40.030304f, 26.9230785f, 21, 24, 71723 },
+    { 3.0f, 5.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 35, 62957 },
+    { 3.0f, 16.030304f, 24.0f, 40.030304f, 26.9230785f, 21, 24, 71847 },
+    { 3.0f, 5.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 35, 71983 },
+    { 3.0f, 16.030304f, 24.0f, 40.030304f, 26.9230785f, 21, 24, 62807 },
+    { 3.0f, 5.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 35, 72096 },
+    { 3.0f, 16.030304f, 24.0f, 52.030304f, 26.9230785f, 21, 36, 63140 },
+    { 3.0f, 5.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 35, 72211 },
+    { 7.0f, 5.03030396f, 16.0f, 40.030304f, 26.9230785f, 9, 35, 72304 },
+    { 3.0f, 5.03030396f, 20.0f, 48.030304f, 26.9230785f, 17, 43, 72387 },
+    { 3.0f, 5.03030396f, 24.0f, 40.030304f, 26.9230785f, 21, 35, 72507 },
+    { 7.0f, 5.03030396f, 16.0f, 40.030304f, 26.9230785f, 9, 35, 72730 },
+    { 0.0f, 16.030304f, 27.0f, 40.030304f, 26.9230785f, 27, 24, 72791 },
+    { 3.0f, 16.030304f, 24.0f, 40.030304f, 26.9230785f, 21, 24, 72877 },
+    { 3.0f, 16.030304f, 24.0f, 40.030304f, 26.9230785f, 21, 24, 72941 },
+    { 3.0f, 16.030304f, 24.0f, 52.030304f, 26.9230785f, 21, 36, 73031 },
+    { 3.0f, 16.030304f, 24.0f, 52.030304f, 26.9230785f, 21, 36, 73141 },
+    { 3.0f, 16.030304f, 24.0f, 40.030304f, 26.9230785f, 21, 24, 73251 },
+    { 3.0f, 16.030304f, 24.0f, 40.030304f, 26.9230785f, 21, 24, 73359 },
+    { 7.0f, 9.03030396f, 24.0f, 40.030304f, 26.9230785f, 17, 31, 73489 },
+    { 3.0f, 16.030304f, 24.0f, 40.030304f, 26.9230785f, 21, 24, 63070 },
+    { 3.0f, 16.030304f, 24.0f, 40.030304f, 26.9230785f, 21, 24, 73580 },
+    { 0.0f, 16.030304f, 27.0f, 40.030304f, 26.9230785f, 27, 24, 73694 },
+    { 3.0f, 16.030304f, 24.0f, 40.030304f, 26.9230785f, 21, 24, 73911 },
+    { 3.0f, 16.030304f, 24.0f, 52.030304f, 26.9230785f, 21, 36, 74093 },
+    { 3.0f, 16.030304f, 24.0f, 40.030304f, 26.9230785f, 21, 24, 74211 },
+    { 3.0f, 5.03030396f, 24.0f, 48.030304f, 26.9230785f, 21, 43, 74343 },
+    { 11.0f, 5.03030396f, 16.0f, 48.030304f, 26.9230785f, 5, 43, 74483 },
+    { 3.0f, 5.03030396f, 24.0f, 48.030304f, 26.9230785f, 21, 43, 74541 },
+    { 0.0f, 20.030304f, 27.0f, 29.030304f, 26.9230785f, 27, 9, 74681 },
+    { 0.0f, 0.0f, 0.0f, 0.0f, 29.0769234f, 0, 0, 0 },
+    { 12.0f, 10.0f, 17.0f, 44.0f, 29.0769234f, 5, 34, 75396 },
+    { 8.0f, 6.0f, 21.0f, 20.0f, 29.0769234f, 13, 14, 75456 },
+    { 0.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 30, 34, 75509 },
+    { 4.0f, 10.0f, 25.0f, 49.0f, 29.0769234f, 21, 39, 75711 },
+    { 0.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 30, 34, 75926 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 76210 },
+    { 12.0f, 6.0f, 17.0f, 20.0f, 29.0769234f, 5, 14, 76438 },
+    { 8.0f, 6.0f, 21.0f, 53.0f, 29.0769234f, 13, 47, 76467 },
+    { 8.0f, 6.0f, 21.0f, 53.0f, 29.0769234f, 13, 47, 76611 },
+    { 4.0f, 19.0f, 25.0f, 40.0f, 29.0769234f, 21, 21, 76755 },
+    { 4.0f, 19.0f, 25.0f, 40.0f, 29.0769234f, 21, 21, 76947 },
+    { 4.0f, 35.0f, 13.0f, 53.0f, 29.0769234f, 9, 18, 77035 },
+    { 4.0f, 27.0f, 25.0f, 32.0f, 29.0769234f, 21, 5, 77090 },
+    { 8.0f, 35.0f, 13.0f, 44.0f, 29.0769234f, 5, 9, 77110 },
+    { 4.0f, 6.0f, 25.0f, 49.0f, 29.0769234f, 21, 43, 77129 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 77275 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 77451 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 77597 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 77791 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 77975 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 78199 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 78341 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 78499 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 78623 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 78771 },
+    { 12.0f, 19.0f, 17.0f, 44.0f, 29.0769234f, 5, 25, 78929 },
+    { 4.0f, 19.0f, 13.0f, 53.0f, 29.0769234f, 9, 34, 78980 },
+    { 0.0f, 19.0f, 25.0f, 40.0f, 29.0769234f, 25, 21, 79073 },
+    { 4.0f, 23.0f, 30.0f, 36.0f, 29.0769234f, 26, 13, 79185 },
+    { 4.0f, 19.0f, 30.0f, 40.0f, 29.0769234f, 26, 21, 79229 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 79347 },
+    { 0.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 30, 34, 79515 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 79785 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 79923 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 80069 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 74762 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 80231 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 80341 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 80437 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 80655 },
+    { 8.0f, 10.0f, 21.0f, 44.0f, 29.0769234f, 13, 34, 80759 },
+    { 4.0f, 10.0f, 21.0f, 44.0f, 29.0769234f, 17, 34, 80843 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 80925 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 81201 },
+    { 0.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 30, 34, 81263 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 81449 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 81631 },
+    { 4.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 21, 34, 81815 },
+    { 4.0f, 10.0f, 30.0f, 49.0f, 29.0769234f, 26, 39, 81927 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 82138 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 82332 },
+    { 0.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 30, 34, 82538 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 82598 },
+    { 0.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 30, 34, 82680 },
+    { 0.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 30, 34, 82840 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 83074 },
+    { 0.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 30, 34, 83266 },
+    { 4.0f, 10.0f, 30.0f, 44.0f, 29.0769234f, 26, 34, 83426 },
+    { 8.0f, 6.0f, 21.0f, 53.0f, 29.0769234f, 13, 47, 83604 },
+    { 4.0f, 6.0f, 25.0f, 49.0f, 29.0769234f, 21, 43, 83696 },
+    { 8.0f, 6.0f, 21.0f, 53.0f, 29.0769234f, 13, 47, 83842 },
+    { 4.0f, 6.0f, 25.0f, 32.0f, 29.0769234f, 21, 26, 83934 },
+    { 0.0f, 44.0f, 30.0f, 49.0f, 29.0769234f, 30, 5, 84059 },
+    { 8.0f, 6.0f, 17.0f, 15.0f, 29.0769234f, 9, 9, 84070 },
+    { 4.0f, 19.0f, 25.0f, 44.0f, 29.0769234f, 21, 25, 84116 },
+    { 4.0f, 6.0f, 25.0f, 44.0f, 29.0769234f, 21, 38, 75075 },
+    { 4.0f, 19.0f, 25.0f, 44.0f, 29.0769234f, 21, 25, 84241 },
+    { 4.0f, 6.0f, 25.0f, 44.0f, 29.0769234f, 21, 38, 84378 },
+    { 4.0f, 19.0f, 25.0f, 44.0f, 29.0769234f, 21, 25, 74924 },
+    { 4.0f, 6.0f, 25.0f, 44.0f, 29.0769234f, 21, 38, 84494 },
+    { 4.0f, 19.0f, 25.0f, 57.0f, 29.0769234f, 21, 38, 75262 },
+    { 4.0f, 6.0f, 25.0f, 44.0f, 29.0769234f, 21, 38, 84612 },
+    { 8.0f, 6.0f, 17.0f, 44.0f, 29.0769234f, 9, 38, 84708 },
+    { 4.0f, 6.0f, 21.0f, 53.0f, 29.0769234f, 17, 47, 84794 },
+    { 4.0f, 6.0f, 25.0f, 44.0f, 29.0769234f, 21, 38, 84918 },
+    { 8.0f, 6.0f, 17.0f, 44.0f, 29.0769234f, 9, 38, 85144 },
+    { 0.0f, 19.0f, 30.0f, 44.0f, 29.0769234f, 30, 25, 85208 },
+    { 4.0f, 19.0f, 25.0f, 44.0f, 29.0769234f, 21, 25, 85297 },
+    { 4.0f, 19.0f, 25.0f, 44.0f, 29.0769234f, 21, 25, 85362 },
+    { 4.0f, 19.0f, 25.0f, 57.0f, 29.0769234f, 21, 38, 85453 },
+    { 4.0f, 19.0f, 25.0f, 57.0f, 29.0769234f, 21, 38, 85565 },
+    { 4.0f, 19.0f, 25.0f, 44.0f, 29.0769234f, 21, 25, 85677 },
+    { 4.0f, 19.0f, 25.0f, 44.0f, 29.0769234f, 21, 25, 85786 },
+    { 8.0f, 10.0f, 25.0f, 44.0f, 29.0769234f, 17, 34, 85917 },
+    { 4.0f, 19.0f, 25.0f, 44.0f, 29.0769234f, 21, 25, 75191 },
+    { 4.0f, 19.0f, 25.0f, 44.0f, 29.0769234f, 21, 25, 86011 },
+    { 0.0f, 19.0f, 30.0f, 44.0f, 29.0769234f, 30, 25, 86126 },
+    { 4.0f, 19.0f, 25.0f, 44.0f, 29.0769234f, 21, 25, 86351 },
+    { 4.0f, 19.0f, 25.0f, 57.0f, 29.0769234f, 21, 38, 86534 },
+    { 4.0f, 19.0f, 25.0f, 44.0f, 29.0769234f, 21, 25, 86654 },
+    { 4.0f, 6.0f, 25.0f, 53.0f, 29.0769234f, 21, 47, 86787 },
+    { 12.0f, 6.0f, 17.0f, 53.0f, 29.0769234f, 5, 47, 86931 },
+    { 4.0f, 6.0f, 25.0f, 53.0f, 29.0769234f, 21, 47, 86993 },
+    { 0.0f, 23.0f, 30.0f, 32.0f, 29.0769234f, 30, 9, 87137 },
+    { 0.0f, 0.0f, 0.0f, 0.0f, 31.7692318f, 0, 0, 0 },
+    { 13.0f, 11.0341873f, 19.0f, 48.0341873f, 31.7692318f, 6, 37, 87871 },
+    { 9.0f, 7.03418732f, 23.0f, 21.0341873f, 31.7692318f, 14, 14, 87934 },
+    { 0.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 32, 37, 87987 },
+    { 4.0f, 11.0341873f, 28.0f, 53.0341873f, 31.7692318f, 24, 42, 88192 },
+    { 0.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 32, 37, 88410 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 88697 },
+    { 13.0f, 7.03418732f, 19.0f, 21.0341873f, 31.7692318f, 6, 14, 88928 },
+    { 9.0f, 7.03418732f, 23.0f, 58.0341873f, 31.7692318f, 14, 51, 88957 },
+    { 9.0f, 7.03418732f, 23.0f, 58.0341873f, 31.7692318f, 14, 51, 89105 },
+    { 4.0f, 20.0341873f, 28.0f, 44.0341873f, 31.7692318f, 24, 24, 89253 },
+    { 4.0f, 20.0341873f, 28.0f, 44.0341873f, 31.7692318f, 24, 24, 89448 },
+    { 4.0f, 38.0341873f, 14.0f, 58.0341873f, 31.7692318f, 10, 20, 89539 },
+    { 4.0f, 29.0341873f, 28.0f, 35.0341873f, 31.7692318f, 24, 6, 89596 },
+    { 9.0f, 38.0341873f, 14.0f, 48.0341873f, 31.7692318f, 5, 10, 89617 },
+    { 4.0f, 7.03418732f, 28.0f, 53.0341873f, 31.7692318f, 24, 46, 89637 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 89786 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 89965 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 90114 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 90311 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 90498 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 90725 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 90870 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 91031 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 91158 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 91309 },
+    { 13.0f, 20.0341873f, 19.0f, 48.0341873f, 31.7692318f, 6, 28, 91470 },
+    { 4.0f, 20.0341873f, 14.0f, 58.0341873f, 31.7692318f, 10, 38, 91524 },
+    { 0.0f, 20.0341873f, 28.0f, 44.0341873f, 31.7692318f, 28, 24, 91621 },
+    { 4.0f, 25.0341873f, 32.0f, 39.0341873f, 31.7692318f, 28, 14, 91736 },
+    { 4.0f, 20.0341873f, 32.0f, 44.0341873f, 31.7692318f, 28, 24, 91781 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 91902 },
+    { 0.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 32, 37, 92073 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 92346 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 92487 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 92636 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 87221 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 92801 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 92914 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 93013 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 93234 },
+    { 9.0f, 11.0341873f, 23.0f, 48.0341873f, 31.7692318f, 14, 37, 93341 },
+    { 4.0f, 11.0341873f, 23.0f, 48.0341873f, 31.7692318f, 19, 37, 93428 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 93513 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 93792 },
+    { 0.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 32, 37, 93857 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 94046 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 94231 },
+    { 4.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 37, 94418 },
+    { 4.0f, 11.0341873f, 32.0f, 53.0341873f, 31.7692318f, 28, 42, 94533 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 94747 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 94944 },
+    { 0.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 32, 37, 95153 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 95216 },
+    { 0.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 32, 37, 95301 },
+    { 0.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 32, 37, 95464 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 95701 },
+    { 0.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 32, 37, 95896 },
+    { 4.0f, 11.0341873f, 32.0f, 48.0341873f, 31.7692318f, 28, 37, 96059 },
+    { 9.0f, 7.03418732f, 23.0f, 58.0341873f, 31.7692318f, 14, 51, 96240 },
+    { 4.0f, 7.03418732f, 28.0f, 53.0341873f, 31.7692318f, 24, 46, 96336 },
+    { 9.0f, 7.03418732f, 23.0f, 58.0341873f, 31.7692318f, 14, 51, 96485 },
+    { 4.0f, 7.03418732f, 28.0f, 35.0341873f, 31.7692318f, 24, 28, 96581 },
+    { 0.0f, 48.0341873f, 32.0f, 53.0341873f, 31.7692318f, 32, 5, 96708 },
+    { 9.0f, 7.03418732f, 19.0f, 17.0341873f, 31.7692318f, 10, 10, 96719 },
+    { 4.0f, 20.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 28, 96766 },
+    { 4.0f, 7.03418732f, 28.0f, 48.0341873f, 31.7692318f, 24, 41, 87540 },
+    { 4.0f, 20.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 28, 96894 },
+    { 4.0f, 7.03418732f, 28.0f, 48.0341873f, 31.7692318f, 24, 41, 97034 },
+    { 4.0f, 20.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 28, 87386 },
+    { 4.0f, 7.03418732f, 28.0f, 48.0341873f, 31.7692318f, 24, 41, 97153 },
+    { 4.0f, 20.0341873f, 28.0f, 62.0341873f, 31.7692318f, 24, 42, 87733 },
+    { 4.0f, 7.03418732f, 28.0f, 48.0341873f, 31.7692318f, 24, 41, 97274 },
+    { 9.0f, 7.03418732f, 19.0f, 48.0341873f, 31.7692318f, 10, 41, 97373 },
+    { 4.0f, 7.03418732f, 23.0f, 58.0341873f, 31.7692318f, 19, 51, 97462 },
+    { 4.0f, 7.03418732f, 28.0f, 48.0341873f, 31.7692318f, 24, 41, 97590 },
+    { 9.0f, 7.03418732f, 19.0f, 48.0341873f, 31.7692318f, 10, 41, 97819 },
+    { 0.0f, 20.0341873f, 32.0f, 48.0341873f, 31.7692318f, 32, 28, 97886 },
+    { 4.0f, 20.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 28, 97978 },
+    { 4.0f, 20.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 28, 98046 },
+    { 4.0f, 20.0341873f, 28.0f, 62.0341873f, 31.7692318f, 24, 42, 98140 },
+    { 4.0f, 20.0341873f, 28.0f, 62.0341873f, 31.7692318f, 24, 42, 98256 },
+    { 4.0f, 20.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 28, 98372 },
+    { 4.0f, 20.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 28, 98484 },
+    { 9.0f, 11.0341873f, 28.0f, 48.0341873f, 31.7692318f, 19, 37, 98618 },
+    { 4.0f, 20.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 28, 87659 },
+    { 4.0f, 20.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 28, 98715 },
+    { 0.0f, 20.0341873f, 32.0f, 48.0341873f, 31.7692318f, 32, 28, 98833 },
+    { 4.0f, 20.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 28, 99061 },
+    { 4.0f, 20.0341873f, 28.0f, 62.0341873f, 31.7692318f, 24, 42, 99247 },
+    { 4.0f, 20.0341873f, 28.0f, 48.0341873f, 31.7692318f, 24, 28, 99371 },
+    { 4.0f, 7.03418732f, 28.0f, 58.0341873f, 31.7692318f, 24, 51, 99507 },
+    { 13.0f, 7.03418732f, 19.0f, 58.0341873f, 31.7692318f, 6, 51, 99655 },
+    { 4.0f, 7.03418732f, 28.0f, 58.0341873f, 31.7692318f, 24, 51, 99721 },
+    { 0.0f, 25.0341873f, 32.0f, 35.0341873f, 31.7692318f, 32, 10, 99869 },
+    { 0.0f, 0.0f, 0.0f, 0.0f, 33.9230804f, 0, 0, 0 },
+    { 14.0f, 12.0f, 20.0f, 51.0f, 33.9230804f, 6, 39, 100616 },
+    { 9.0f, 7.0f, 25.0f, 22.0f, 33.9230804f, 16, 15, 100681 },
+    { 0.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 34, 39, 100735 },
+    { 4.0f, 12.0f, 30.0f, 56.0f, 33.9230804f, 26, 44, 100942 },
+    { 0.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 34, 39, 101162 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 101451 },
+    { 14.0f, 7.0f, 20.0f, 22.0f, 33.9230804f, 6, 15, 101684 },
+    { 9.0f, 7.0f, 25.0f, 61.0f, 33.9230804f, 16, 54, 101714 },
+    { 9.0f, 7.0f, 25.0f, 61.0f, 33.9230804f, 16, 54, 101865 },
+    { 4.0f, 21.0f, 30.0f, 47.0f, 33.9230804f, 26, 26, 102016 },
+    { 4.0f, 21.0f, 30.0f, 47.0f, 33.9230804f, 26, 26, 102213 },
+    { 4.0f, 41.0f, 15.0f, 61.0f, 33.9230804f, 11, 20, 102306 },
+    { 4.0f, 31.0f, 30.0f, 37.0f, 33.9230804f, 26, 6, 102363 },
+    { 9.0f, 41.0f, 15.0f, 51.0f, 33.9230804f, 6, 10, 102384 },
+    { 4.0f, 7.0f, 30.0f, 56.0f, 33.9230804f, 26, 49, 102404 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 102556 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 102737 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 102888 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 103087 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 103276 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 103505 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 103652 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 103815 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 103944 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 104097 },
+    { 14.0f, 21.0f, 20.0f, 51.0f, 33.9230804f, 6, 30, 104260 },
+    { 4.0f, 21.0f, 15.0f, 61.0f, 33.9230804f, 11, 40, 104316 },
+    { 0.0f, 21.0f, 30.0f, 47.0f, 33.9230804f, 30, 26, 104415 },
+    { 4.0f, 26.0f, 34.0f, 42.0f, 33.9230804f, 30, 16, 104532 },
+    { 4.0f, 21.0f, 34.0f, 47.0f, 33.9230804f, 30, 26, 104579 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 104702 },
+    { 0.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 34, 39, 104875 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 105150 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 105293 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 105444 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 99954 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 105611 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 105726 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 105827 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 106050 },
+    { 9.0f, 12.0f, 25.0f, 51.0f, 33.9230804f, 16, 39, 106159 },
+    { 4.0f, 12.0f, 25.0f, 51.0f, 33.9230804f, 21, 39, 106248 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 106335 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 106616 },
+    { 0.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 34, 39, 106683 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 106874 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 107061 },
+    { 4.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 26, 39, 107250 },
+    { 4.0f, 12.0f, 34.0f, 56.0f, 33.9230804f, 30, 44, 107367 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 107583 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 107782 },
+    { 0.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 34, 39, 107993 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 108058 },
+    { 0.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 34, 39, 108145 },
+    { 0.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 34, 39, 108310 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 108549 },
+    { 0.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 34, 39, 108746 },
+    { 4.0f, 12.0f, 34.0f, 51.0f, 33.9230804f, 30, 39, 108911 },
+    { 9.0f, 7.0f, 25.0f, 61.0f, 33.9230804f, 16, 54, 109094 },
+    { 4.0f, 7.0f, 30.0f, 56.0f, 33.9230804f, 26, 49, 109193 },
+    { 9.0f, 7.0f, 25.0f, 61.0f, 33.9230804f, 16, 54, 109345 },
+    { 4.0f, 7.0f, 30.0f, 37.0f, 33.9230804f, 26, 30, 109444 },
+    { 0.0f, 51.0f, 34.0f, 56.0f, 33.9230804f, 34, 5, 109573 },
+    { 9.0f, 7.0f, 20.0f, 18.0f, 33.9230804f, 11, 11, 109584 },
+    { 4.0f, 21.0f, 30.0f, 51.0f, 33.9230804f, 26, 30, 109632 },
+    { 4.0f, 7.0f, 30.0f, 51.0f, 33.9230804f, 26, 44, 100277 },
+    { 4.0f, 21.0f, 30.0f, 51.0f, 33.9230804f, 26, 30, 109762 },
+    { 4.0f, 7.0f, 30.0f, 51.0f, 33.9230804f, 26, 44, 109904 },
+    { 4.0f, 21.0f, 30.0f, 51.0f, 33.9230804f, 26, 30, 100121 },
+    { 4.0f, 7.0f, 30.0f, 51.0f, 33.9230804f, 26, 44, 110026 },
+    { 4.0f, 21.0f, 30.0f, 66.0f, 33.9230804f, 26, 45, 100475 },
+    { 4.0f, 7.0f, 30.0f, 51.0f, 33.9230804f, 26, 44, 110150 },
+    { 9.0f, 7.0f, 20.0f, 51.0f, 33.9230804f, 11, 44, 110252 },
+    { 4.0f, 7.0f, 25.0f, 61.0f, 33.9230804f, 21, 54, 110344 },
+    { 4.0f, 7.0f, 30.0f, 51.0f, 33.9230804f, 26, 44, 110475 },
+    { 9.0f, 7.0f, 20.0f, 51.0f, 33.9230804f, 11, 44, 110707 },
+    { 0.0f, 21.0f, 34.0f, 51.0f, 33.9230804f, 34, 30, 110777 },
+    { 4.0f, 21.0f, 30.0f, 51.0f, 33.9230804f, 26, 30, 110871 },
+    { 4.0f, 21.0f, 30.0f, 51.0f, 33.9230804f, 26, 30, 110941 },
+    { 4.0f, 21.0f, 30.0f, 66.0f, 33.9230804f, 26, 45, 111037 },
+    { 4.0f, 21.0f, 30.0f, 66.0f, 33.9230804f, 26, 45, 111156 },
+    { 4.0f, 21.0f, 30.0f, 51.0f, 33.9230804f, 26, 30, 111275 },
+    { 4.0f, 21.0f, 30.0f, 51.0f, 33.9230804f, 26, 30, 111389 },
+    { 9.0f, 12.0f, 30.0f, 51.0f, 33.9230804f, 21, 39, 111525 },
+    { 4.0f, 21.0f, 30.0f, 51.0f, 33.9230804f, 26, 30, 100399 },
+    { 4.0f, 21.0f, 30.0f, 51.0f, 33.9230804f, 26, 30, 111624 },
+    { 0.0f, 21.0f, 34.0f, 51.0f, 33.9230804f, 34, 30, 111744 },
+    { 4.0f, 21.0f, 30.0f, 51.0f, 33.9230804f, 26, 30, 111974 },
+    { 4.0f, 21.0f, 30.0f, 66.0f, 33.9230804f, 26, 45, 112162 },
+    { 4.0f, 21.0f, 30.0f, 51.0f, 33.9230804f, 26, 30, 112289 },
+    { 4.0f, 7.0f, 30.0f, 61.0f, 33.9230804f, 26, 54, 112427 },
+    { 14.0f, 7.0f, 20.0f, 61.0f, 33.9230804f, 6, 54, 112578 },
+    { 4.0f, 7.0f, 30.0f, 61.0f, 33.9230804f, 26, 54, 112647 },
+    { 0.0f, 26.0f, 34.0f, 37.0f, 33.9230804f, 34, 11, 112798 },
+    { 0.0f, 0.0f, 0.0f, 0.0f, 36.615387f, 0, 0, 0 },
+    { 15.0f, 13.0370369f, 21.0f, 55.0370369f, 36.615387f, 6, 42, 113560 },
+    { 10.0f, 7.0370369f, 27.0f, 24.0370369f, 36.615387f, 17, 17, 113628 },
+    { 0.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 37, 42, 113684 },
+    { 5.0f, 13.0370369f, 32.0f, 61.0370369f, 36.615387f, 27, 48, 113894 },
+    { 0.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 37, 42, 114118 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 114410 },
+    { 15.0f, 7.0370369f, 21.0f, 24.0370369f, 36.615387f, 6, 17, 114646 },
+    { 10.0f, 7.0370369f, 27.0f, 66.0370331f, 36.615387f, 17, 59, 114678 },
+    { 10.0f, 7.0370369f, 27.0f, 66.0370331f, 36.615387f, 17, 59, 114834 },
+    { 5.0f, 23.0370369f, 32.0f, 50.0370369f, 36.615387f, 27, 27, 114990 },
+    { 5.0f, 23.0370369f, 32.0f, 50.0370369f, 36.615387f, 27, 27, 115188 },
+    { 5.0f, 44.0370369f, 16.0f, 66.0370331f, 36.615387f, 11, 22, 115282 },
+    { 5.0f, 34.0370369f, 32.0f, 40.0370369f, 36.615387f, 27, 6, 115341 },
+    { 10.0f, 44.0370369f, 16.0f, 55.0370369f, 36.615387f, 6, 11, 115362 },
+    { 5.0f, 7.0370369f, 32.0f, 61.0370369f, 36.615387f, 27, 54, 115383 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 115540 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 115724 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 115878 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 116080 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 116272 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 116504 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 116654 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 116820 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 116952 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 117108 },
+    { 15.0f, 23.0370369f, 21.0f, 55.0370369f, 36.615387f, 6, 32, 117274 },
+    { 5.0f, 23.0370369f, 16.0f, 66.0370331f, 36.615387f, 11, 43, 117332 },
+    { 0.0f, 23.0370369f, 32.0f, 50.0370369f, 36.615387f, 32, 27, 117434 },
+    { 5.0f, 28.0370369f, 37.0f, 45.0370369f, 36.615387f, 32, 17, 117552 },
+    { 5.0f, 23.0370369f, 37.0f, 50.0370369f, 36.615387f, 32, 27, 117600 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 117724 },
+    { 0.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 37, 42, 117900 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 118178 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 118324 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 118478 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 112884 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 118648 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 118766 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 118870 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 119096 },
+    { 10.0f, 13.0370369f, 27.0f, 55.0370369f, 36.615387f, 17, 42, 119208 },
+    { 5.0f, 13.0370369f, 27.0f, 55.0370369f, 36.615387f, 22, 42, 119300 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 119390 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 119674 },
+    { 0.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 37, 42, 119744 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 119938 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 120128 },
+    { 5.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 42, 120320 },
+    { 5.0f, 13.0370369f, 37.0f, 61.0370369f, 36.615387f, 32, 48, 120440 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 120660 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 120862 },
+    { 0.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 37, 42, 121076 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 121144 },
+    { 0.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 37, 42, 121234 },
+    { 0.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 37, 42, 121402 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 121644 },
+    { 0.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 37, 42, 121844 },
+    { 5.0f, 13.0370369f, 37.0f, 55.0370369f, 36.615387f, 32, 42, 122012 },
+    { 10.0f, 7.0370369f, 27.0f, 66.0370331f, 36.615387f, 17, 59, 122198 },
+    { 5.0f, 7.0370369f, 32.0f, 61.0370369f, 36.615387f, 27, 54, 122302 },
+    { 10.0f, 7.0370369f, 27.0f, 66.0370331f, 36.615387f, 17, 59, 122459 },
+    { 5.0f, 7.0370369f, 32.0f, 40.0370369f, 36.615387f, 27, 33, 122563 },
+    { 0.0f, 55.0370369f, 37.0f, 61.0370369f, 36.615387f, 37, 6, 122695 },
+    { 10.0f, 7.0370369f, 21.0f, 19.0370369f, 36.615387f, 11, 12, 122707 },
+    { 5.0f, 23.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 32, 122756 },
+    { 5.0f, 7.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 48, 113212 },
+    { 5.0f, 23.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 32, 122888 },
+    { 5.0f, 7.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 48, 123032 },
+    { 5.0f, 23.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 32, 113054 },
+    { 5.0f, 7.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 48, 123158 },
+    { 5.0f, 23.0370369f, 32.0f, 71.0370331f, 36.615387f, 27, 48, 113416 },
+    { 5.0f, 7.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 48, 123286 },
+    { 10.0f, 7.0370369f, 21.0f, 55.0370369f, 36.615387f, 11, 48, 123392 },
+    { 5.0f, 7.0370369f, 27.0f, 66.0370331f, 36.615387f, 22, 59, 123488 },
+    { 5.0f, 7.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 48, 123624 },
+    { 10.0f, 7.0370369f, 21.0f, 55.0370369f, 36.615387f, 11, 48, 123860 },
+    { 0.0f, 23.0370369f, 37.0f, 55.0370369f, 36.615387f, 37, 32, 123934 },
+    { 5.0f, 23.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 32, 124030 },
+    { 5.0f, 23.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 32, 124102 },
+    { 5.0f, 23.0370369f, 32.0f, 71.0370331f, 36.615387f, 27, 48, 124200 },
+    { 5.0f, 23.0370369f, 32.0f, 71.0370331f, 36.615387f, 27, 48, 124322 },
+    { 5.0f, 23.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 32, 124444 },
+    { 5.0f, 23.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 32, 124560 },
+    { 10.0f, 13.0370369f, 32.0f, 55.0370369f, 36.615387f, 22, 42, 124698 },
+    { 5.0f, 23.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 32, 113338 },
+    { 5.0f, 23.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 32, 124800 },
+    { 0.0f, 23.0370369f, 37.0f, 55.0370369f, 36.615387f, 37, 32, 124922 },
+    { 5.0f, 23.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 32, 125154 },
+    { 5.0f, 23.0370369f, 32.0f, 71.0370331f, 36.615387f, 27, 48, 125344 },
+    { 5.0f, 23.0370369f, 32.0f, 55.0370369f, 36.615387f, 27, 32, 125474 },
+    { 5.0f, 7.0370369f, 32.0f, 66.0370331f, 36.615387f, 27, 59, 125614 },
+    { 15.0f, 7.0370369f, 21.0f, 66.0370331f, 36.615387f, 6, 59, 125770 },
+    { 5.0f, 7.0370369f, 32.0f, 66.0370331f, 36.615387f, 27, 59, 125844 },
+    { 0.0f, 28.0370369f, 37.0f, 40.0370369f, 36.615387f, 37, 12, 126000 },
+    { 0.0f, 0.0f, 0.0f, 0.0f, 38.7692337f, 0, 0, 0 },
+    { 16.0f, 13.0f, 23.0f, 58.0f, 38.7692337f, 7, 45, 126775 },
+    { 11.0f, 8.0f, 28.0f, 25.0f, 38.7692337f, 17, 17, 126846 },
+    { 0.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 39, 45, 126902 },
+    { 5.0f, 13.0f, 34.0f, 64.0f, 38.7692337f, 29, 51, 127115 },
+    { 0.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 39, 45, 127342 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 127637 },
+    { 16.0f, 8.0f, 23.0f, 25.0f, 38.7692337f, 7, 17, 127876 },
+    { 11.0f, 8.0f, 28.0f, 70.0f, 38.7692337f, 17, 62, 127908 },
+    { 11.0f, 8.0f, 28.0f, 70.0f, 38.7692337f, 17, 62, 128067 },
+    { 5.0f, 24.0f, 34.0f, 53.0f, 38.7692337f, 29, 29, 128226 },
+    { 5.0f, 24.0f, 34.0f, 53.0f, 38.7692337f, 29, 29, 128426 },
+    { 5.0f, 46.0f, 17.0f, 70.0f, 38.7692337f, 12, 24, 128522 },
+    { 5.0f, 35.0f, 34.0f, 42.0f, 38.7692337f, 29, 7, 128583 },
+    { 11.0f, 46.0f, 17.0f, 58.0f, 38.7692337f, 6, 12, 128605 },
+    { 5.0f, 8.0f, 34.0f, 64.0f, 38.7692337f, 29, 56, 128627 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 128786 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 128973 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 129130 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 129335 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 129530 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 129765 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 129918 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 130087 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 130222 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 130381 },
+    { 16.0f, 24.0f, 23.0f, 58.0f, 38.7692337f, 7, 34, 130550 },
+    { 5.0f, 24.0f, 17.0f, 70.0f, 38.7692337f, 12, 46, 130610 },
+    { 0.0f, 24.0f, 34.0f, 53.0f, 38.7692337f, 34, 29, 130715 },
+    { 5.0f, 30.0f, 39.0f, 47.0f, 38.7692337f, 34, 17, 130835 },
+    { 5.0f, 24.0f, 39.0f, 53.0f, 38.7692337f, 34, 29, 130883 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 131009 },
+    { 0.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 39, 45, 131188 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 131469 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 131618 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 131775 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 126087 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 131948 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 132069 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 132176 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 132405 },
+    { 11.0f, 13.0f, 28.0f, 58.0f, 38.7692337f, 17, 45, 132520 },
+    { 5.0f, 13.0f, 28.0f, 58.0f, 38.7692337f, 23, 45, 132615 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 132708 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 132995 },
+    { 0.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 39, 45, 133068 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 133265 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 133458 },
+    { 5.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 29, 45, 133653 },
+    { 5.0f, 13.0f, 39.0f, 64.0f, 38.7692337f, 34, 51, 133776 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 133999 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 134204 },
+    { 0.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 39, 45, 134421 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 134492 },
+    { 0.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 39, 45, 134585 },
+    { 0.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 39, 45, 134756 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 135001 },
+    { 0.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 39, 45, 135204 },
+    { 5.0f, 13.0f, 39.0f, 58.0f, 38.7692337f, 34, 45, 135375 },
+    { 11.0f, 8.0f, 28.0f, 70.0f, 38.7692337f, 17, 62, 135564 },
+    { 5.0f, 8.0f, 34.0f, 64.0f, 38.7692337f, 29, 56, 135671 },
+    { 11.0f, 8.0f, 28.0f, 70.0f, 38.7692337f, 17, 62, 135830 },
+    { 5.0f, 8.0f, 34.0f, 42.0f, 38.7692337f, 29, 34, 135937 },
+    { 0.0f, 58.0f, 39.0f, 64.0f, 38.7692337f, 39, 6, 136070 },
+    { 11.0f, 8.0f, 23.0f, 20.0f, 38.7692337f, 12, 12, 136082 },
+    { 5.0f, 24.0f, 34.0f, 58.0f, 38.7692337f, 29, 34, 136131 },
+    { 5.0f, 8.0f, 34.0f, 58.0f, 38.7692337f, 29, 50, 126420 },
+    { 5.0f, 24.0f, 34.0f, 58.0f, 38.7692337f, 29, 34, 136265 },
+    { 5.0f, 8.0f, 34.0f, 58.0f, 38.7692337f, 29, 50, 136411 },
+    { 5.0f, 24.0f, 34.0f, 58.0f, 38.7692337f, 29, 34, 126260 },
+    { 5.0f, 8.0f, 34.0f, 58.0f, 38.7692337f, 29, 50, 136539 },
+    { 5.0f, 24.0f, 34.0f, 75.0f, 38.7692337f, 29, 51, 126628 },
+    { 5.0f, 8.0f, 34.0f, 58.0f, 38.7692337f, 29, 50, 136669 },
+    { 11.0f, 8.0f, 23.0f, 58.0f, 38.7692337f, 12, 50, 136777 },
+    { 5.0f, 8.0f, 28.0f, 70.0f, 38.7692337f, 23, 62, 136875 },
+    { 5.0f, 8.0f, 34.0f, 58.0f, 38.7692337f, 29, 50, 137014 },
+    { 11.0f, 8.0f, 23.0f, 58.0f, 38.7692337f, 12, 50, 137252 },
+    { 0.0f, 24.0f, 39.0f, 58.0f, 38.7692337f, 39, 34, 137328 },
+    { 5.0f, 24.0f, 34.0f, 58.0f, 38.7692337f, 29, 34, 137426 },
+    { 5.0f, 24.0f, 34.0f, 58.0f, 38.7692337f, 29, 34, 137500 },
+    { 5.0f, 24.0f, 34.0f, 75.0f, 38.7692337f, 29, 51, 137600 },
+    { 5.0f, 24.0f, 34.0f, 75.0f, 38.7692337f, 29, 51, 137725 },
+    { 5.0f, 24.0f, 34.0f, 58.0f, 38.7692337f, 29, 34, 137850 },
+    { 5.0f, 24.0f, 34.0f, 58.0f, 38.7692337f, 29, 34, 137968 },
+    { 11.0f, 13.0f, 34.0f, 58.0f, 38.7692337f, 23, 45, 138108 },
+    { 5.0f, 24.0f, 34.0f, 58.0f, 38.7692337f, 29, 34, 126548 },
+    { 5.0f, 24.0f, 34.0f, 58.0f, 38.7692337f, 29, 34, 138213 },
+    { 0.0f, 24.0f, 39.0f, 58.0f, 38.7692337f, 39, 34, 138337 },
+    { 5.0f, 24.0f, 34.0f, 58.0f, 38.7692337f, 29, 34, 138571 },
+    { 5.0f, 24.0f, 34.0f, 75.0f, 38.7692337f, 29, 51, 138763 },
+    { 5.0f, 24.0f, 34.0f, 58.0f, 38.7692337f, 29, 34, 138896 },
+    { 5.0f, 8.0f, 34.0f, 70.0f, 38.7692337f, 29, 62, 139038 },
+    { 16.0f, 8.0f, 23.0f, 70.0f, 38.7692337f, 7, 62, 139197 },
+    { 5.0f, 8.0f, 34.0f, 70.0f, 38.7692337f, 29, 62, 139274 },
+    { 0.0f, 30.0f, 39.0f, 42.0f, 38.7692337f, 39, 12, 139433 },
+};
+
+static const PrebakedFont kPrebakedFonts[] = {
+    { 27.0f, 27.0f, kPrebakedGlyphs + 0 },
+    { 31.5f, 32.0f, kPrebakedGlyphs + 95 },
+    { 36.0f, 36.0f, kPrebakedGlyphs + 190 },
+    { 40.5f, 41.0f, kPrebakedGlyphs + 285 },
+    { 45.0f, 45.0f, kPrebakedGlyphs + 380 },
+    { 49.5f, 50.0f, kPrebakedGlyphs + 475 },
+    { 54.0f, 54.0f, kPrebakedGlyphs + 570 },
+    { 58.5f, 59.0f, kPrebakedGlyphs + 665 },
+    { 63.0f, 63.0f, kPrebakedGlyphs + 760 },
+    { 67.5f, 68.0f, kPrebakedGlyphs + 855 },
+    { 72.0f, 72.0f, kPrebakedGlyphs + 950 },
+};
+
+static const uint8_t kPrebakedPixels[139520] = {
+    1,66,145,243,157,1,139,60,248,0,1,108,235,243,255,1,225,98,248,0,5,108,235,255,255,207,139,247,118,5,120,129,
+    137,137,132,63,252,0,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,252,0,5,108,235,255,255,166,39,247,
+    0,5,16,84,137,137,136,127,254,118,1,63,4,5,108,235,255,255,166,39,243,0,1,10,137,254,255,1,137,10,128,128,
+    128,128,128,128,5,108,235,255,255,166,39,247,0,5,4,24,39,39,46,134,254,216,1,116,8,5,108,235,255,255,166,39,
+    247,0,5,29,157,255,255,245,117,252,0,5,108,235,255,255,173,56,247,20,5,44,152,235,235,226,108,252,0,1,108,235,
+    243,255,1,225,98,248,0,128,253,0,1,40,99,247,118,1,104,45,253,0,253,0,1,88,216,247,255,1,225,98,253,0,
+    5,41,90,98,98,118,148,247,157,5,150,120,98,98,94,45,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,
+    5,108,235,255,255,194,105,247,78,5,98,187,255,255,245,117,1,108,235,239,255,1,245,117,5,108,235,255,255,234,205,243,
+    196,1,188,90,5,108,235,255,255,166,39,241,0,5,108,235,255,255,166,39,247,0,5,4,24,39,39,37,18,5,108,235,
+    255,255,166,39,247,0,5,29,157,255,255,245,117,5,99,217,235,235,160,53,247,20,5,44,152,235,235,226,108,253,0,1,
+    88,216,247,255,1,225,98,253,0,128,5,74,163,177,177,115,27,241,0,5,108,235,255,255,166,39,241,0,128,128,128,128,
+    5,108,235,255,255,207,139,247,118,1,104,45,253,0,1,108,235,243,255,1,225,98,253,0,5,108,235,255,255,221,172,247,
+    157,5,150,120,98,98,94,45,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,128,128,128,128,5,108,
+    235,255,255,173,56,247,20,5,44,152,235,235,226,108,1,108,235,243,255,1,225,98,253,0,128,5,50,109,118,118,77,18,
+    247,0,5,13,72,118,118,113,54,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,128,128,128,128,128,
+    128,5,99,217,235,235,160,53,247,20,5,47,164,255,255,245,117,253,0,1,88,216,243,255,1,245,117,128,253,0,1,40,
+    99,243,118,1,113,54,253,0,1,88,216,243,255,1,245,117,5,41,90,98,98,118,148,247,157,5,168,217,255,255,245,117,
+    5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,128,128,128,128,5,99,217,235,235,160,53,247,20,5,
+    47,164,255,255,245,117,253,0,1,88,216,243,255,1,245,117,128,241,0,5,29,157,255,255,245,117,128,128,128,253,0,1,
+    74,182,247,216,5,195,107,39,39,37,18,253,0,1,88,216,247,255,1,225,98,253,0,253,0,1,20,50,247,59,1,52,
+    22,253,0,5,42,120,157,157,127,48,5,68,196,255,255,206,78,128,128,128,128,128,128,128,128,128,128,5,58,166,216,216,
+    174,66,251,0,5,5,15,20,20,16,6,5,68,196,255,255,206,78,128,13,61,149,177,177,129,40,0,0,34,122,177,177,
+    156,68,13,88,216,255,255,186,59,0,0,49,176,255,255,225,98,128,128,128,128,13,47,116,137,137,100,31,0,0,26,95,
+    137,137,121,53,245,0,13,42,120,157,157,127,48,0,0,18,96,157,157,151,72,252,0,245,0,13,68,196,255,255,206,78,
+    0,0,29,157,255,255,245,117,252,0,128,128,253,0,1,50,109,251,118,13,155,223,255,255,228,160,118,118,133,202,255,255,
+    249,181,254,118,1,63,4,253,0,1,108,235,234,255,1,137,10,253,0,17,66,145,157,157,191,240,255,255,228,179,157,157,
+    176,225,255,255,243,194,250,157,1,84,6,249,0,13,88,216,255,255,186,59,0,0,49,176,255,255,225,98,248,0,128,128,
+    0,29,250,59,17,127,225,255,255,202,104,59,59,96,194,255,255,232,134,59,59,56,27,252,0,0,127,234,255,1,245,117,
+    252,0,0,108,254,216,13,232,252,255,255,241,222,216,216,226,246,255,255,247,228,251,216,1,207,99,252,0,253,0,13,108,
+    235,255,255,166,39,0,0,68,196,255,255,206,78,244,0,128,128,128,249,0,5,42,120,157,157,127,48,249,0,249,0,5,
+    68,196,255,255,206,78,249,0,253,0,9,47,116,137,137,169,228,255,255,232,173,251,137,1,132,63,253,0,1,88,216,243,
+    255,1,245,117,13,50,109,118,118,124,134,137,137,169,228,255,255,232,173,251,137,1,132,63,13,108,235,255,255,166,39,0,
+    0,68,196,255,255,206,78,249,0,128,128,17,74,163,177,177,143,93,78,78,126,214,255,255,221,132,78,78,69,30,253,0,
+    253,0,1,88,216,247,255,1,225,98,253,0,253,0,17,68,166,196,196,212,241,255,255,243,214,196,196,180,111,59,59,56,
+    27,249,0,13,68,196,255,255,206,78,0,0,29,157,255,255,245,117,128,128,1,8,18,251,20,13,83,200,255,255,209,92,
+    20,20,44,152,235,235,226,108,1,108,235,243,255,1,225,98,253,0,128,249,0,5,68,196,255,255,206,78,249,0,128,249,
+    0,5,5,15,20,20,16,6,249,0,253,0,5,66,145,157,157,102,24,247,0,5,18,96,157,157,151,72,252,0,253,0,
+    5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,252,0,0,68,254,137,21,129,119,118,118,124,134,137,137,100,
+    31,0,0,26,95,137,137,135,125,118,118,113,54,252,0,0,127,254,255,17,147,19,0,0,88,216,255,255,186,59,0,0,
+    49,176,255,255,225,98,248,0,128,128,0,78,254,157,17,132,102,98,98,118,148,157,157,141,111,98,98,109,139,157,157,139,
+    60,248,0,253,0,13,108,235,255,255,166,39,0,0,68,196,255,255,206,78,244,0,253,0,21,74,163,177,177,115,27,0,
+    0,68,196,255,255,206,78,0,0,9,48,78,78,75,36,252,0,245,0,13,68,196,255,255,206,78,0,0,29,157,255,255,
+    245,117,252,0,249,0,17,20,50,59,59,96,164,196,196,169,101,59,59,75,143,196,196,191,122,254,59,1,32,2,249,0,
+    17,88,216,255,255,186,59,0,0,49,176,255,255,225,98,0,0,10,137,254,255,1,137,10,128,128,253,0,21,8,18,20,
+    20,94,202,235,235,172,54,0,0,45,163,235,235,210,103,20,20,28,135,254,235,1,126,9,253,0,5,108,235,255,255,166,
+    39,247,0,5,29,157,255,255,245,117,252,0,128,253,0,1,54,133,251,157,1,127,48,244,0,253,0,1,88,216,251,255,
+    1,206,78,244,0,5,58,126,137,137,130,121,251,118,5,121,131,137,137,121,53,248,0,5,108,235,255,255,166,39,251,0,
+    5,49,176,255,255,225,98,248,0,128,128,5,66,145,157,157,136,107,251,98,9,109,139,157,157,139,60,0,0,4,53,254,
+    98,1,53,4,253,0,1,88,216,251,255,1,206,78,251,0,1,10,137,254,255,1,137,10,5,33,72,78,78,112,161,251,
+    177,9,158,108,78,78,69,30,0,0,10,137,254,255,1,137,10,5,108,235,255,255,166,39,251,0,9,49,176,255,255,225,
+    98,0,0,10,137,254,255,1,137,10,5,108,235,255,255,166,39,251,0,9,37,135,196,196,180,111,59,59,64,132,254,196,
+    1,105,7,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,252,0,128,128,5,99,217,235,235,160,53,247,20,
+    5,44,152,235,235,227,119,254,20,1,11,1,253,0,1,88,216,247,255,5,225,98,0,0,10,137,254,255,1,137,10,128,
+    5,47,136,177,177,143,54,5,68,196,255,255,206,78,128,128,128,128,5,37,105,137,137,110,42,249,0,5,34,122,177,177,
+    156,68,249,0,5,49,176,255,255,225,98,253,0,9,42,120,157,157,145,116,98,98,86,37,253,0,5,68,196,255,255,206,
+    78,253,0,128,128,9,40,99,118,118,123,132,137,137,110,42,253,0,5,88,216,255,255,186,59,249,0,128,128,128,128,128,
+    128,128,128,9,81,199,235,235,177,69,20,20,16,6,253,0,253,0,5,68,196,255,255,206,78,253,0,128,128,128,253,0,
+    9,5,15,20,20,61,169,235,235,208,90,249,0,5,49,176,255,255,225,98,249,0,5,7,27,39,39,34,15,5,61,149,
+    177,177,129,40,249,0,5,88,216,255,255,186,59,249,0,9,34,83,98,98,114,143,157,157,127,48,253,0,253,0,5,68,
+    196,255,255,206,78,253,0,128,128,253,0,9,37,105,137,137,133,124,118,118,104,45,249,0,5,49,176,255,255,225,98,128,
+    128,128,128,128,128,128,128,253,0,9,5,15,20,20,61,169,235,235,208,90,253,0,5,68,196,255,255,206,78,253,0,128,
+    128,128,9,81,199,235,235,177,69,20,20,16,6,253,0,5,88,216,255,255,186,59,249,0,5,13,33,39,39,28,9,249,
+    0,249,0,5,31,90,118,118,95,36,249,0,249,0,5,68,196,255,255,206,78,249,0,21,41,90,98,98,64,15,0,0,
+    68,196,255,255,206,78,0,0,11,60,98,98,94,45,21,108,235,255,255,166,39,0,0,68,196,255,255,206,78,0,0,29,
+    157,255,255,245,117,21,74,163,177,177,143,93,78,78,126,214,255,255,221,132,78,78,89,139,177,177,170,81,253,0,1,88,
+    216,247,255,1,225,98,253,0,21,25,54,59,59,106,175,196,196,212,241,255,255,243,214,196,196,180,111,59,59,56,27,21,
+    108,235,255,255,166,39,0,0,68,196,255,255,206,78,0,0,29,157,255,255,245,117,21,91,199,216,216,141,33,0,0,68,
+    196,255,255,206,78,0,0,25,133,216,216,207,99,249,0,5,68,196,255,255,206,78,249,0,249,0,5,63,181,235,235,190,
+    72,249,0,249,0,5,31,90,118,118,95,36,249,0,249,0,5,68,196,255,255,206,78,249,0,128,128,1,33,72,251,78,
+    5,126,214,255,255,221,132,251,78,1,75,36,1,108,235,239,255,1,245,117,1,83,181,251,196,5,212,241,255,255,243,214,
+    251,196,1,188,90,249,0,5,68,196,255,255,206,78,249,0,128,128,249,0,5,63,181,235,235,190,72,249,0,253,0,5,
+    13,33,39,39,28,9,253,0,5,88,216,255,255,186,59,128,128,128,128,128,9,99,217,235,235,160,53,20,20,14,4,5,
+    108,235,255,255,166,39,253,0,5,16,36,39,39,25,6,253,0,1,33,72,239,78,1,75,36,1,108,235,239,255,1,245,
+    117,1,83,181,239,196,1,188,90,5,13,33,39,39,28,9,5,88,216,255,255,186,59,128,128,128,241,0,5,20,109,177,
+    177,170,81,241,0,5,29,157,255,255,245,117,128,128,245,0,9,26,95,137,137,135,125,118,118,113,54,245,0,5,49,176,
+    255,255,225,98,253,0,128,128,249,0,9,26,75,98,98,109,139,157,157,139,60,253,0,249,0,5,68,196,255,255,206,78,
+    249,0,128,128,253,0,9,20,50,59,59,96,164,196,196,158,60,249,0,253,0,5,88,216,255,255,186,59,245,0,128,128,
+    9,8,18,20,20,94,202,235,235,172,54,245,0,5,108,235,255,255,166,39,241,0,128,128,128,5,8,18,20,20,13,3,
+    241,0,253,0,1,54,133,247,157,1,139,60,253,0,253,0,1,88,216,247,255,1,225,98,253,0,5,58,126,137,137,130,
+    121,247,118,5,120,129,137,137,132,63,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,21,108,235,255,
+    255,166,39,0,0,26,75,98,98,79,30,0,0,29,157,255,255,245,117,21,108,235,255,255,166,39,0,0,68,196,255,255,
+    206,78,0,0,29,157,255,255,245,117,128,128,21,108,235,255,255,166,39,0,0,53,151,196,196,158,60,0,0,29,157,255,
+    255,245,117,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,5,99,217,235,235,160,53,247,20,5,44,
+    152,235,235,226,108,253,0,1,88,216,247,255,1,225,98,253,0,128,249,0,5,42,120,157,157,127,48,249,0,249,0,5,
+    68,196,255,255,206,78,249,0,253,0,9,47,116,137,137,169,228,255,255,206,78,249,0,253,0,1,88,216,251,255,1,206,
+    78,249,0,13,50,109,118,118,124,134,137,137,169,228,255,255,206,78,249,0,13,108,235,255,255,166,39,0,0,68,196,255,
+    255,206,78,249,0,13,66,145,157,157,102,24,0,0,68,196,255,255,206,78,249,0,249,0,5,68,196,255,255,206,78,249,
+    0,128,128,128,128,128,128,1,8,18,251,20,5,83,200,255,255,209,92,251,20,1,19,9,1,108,235,239,255,1,245,117,
+    128,253,0,1,54,133,247,157,1,139,60,253,0,253,0,1,88,216,247,255,1,225,98,253,0,5,58,126,137,137,130,121,
+    247,118,5,120,129,137,137,132,63,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,5,58,126,137,137,89,21,
+    247,0,5,29,157,255,255,245,117,241,0,5,29,157,255,255,245,117,245,0,9,19,68,98,98,105,134,157,157,151,72,245,
+    0,5,49,176,255,255,225,98,253,0,249,0,9,21,60,78,78,97,146,177,177,156,68,253,0,249,0,5,68,196,255,255,
+    206,78,249,0,253,0,9,20,50,59,59,96,164,196,196,158,60,249,0,253,0,5,88,216,255,255,186,59,245,0,9,16,
+    36,39,39,100,188,216,216,158,50,245,0,5,108,235,255,255,166,39,241,0,5,108,235,255,255,173,56,243,20,1,19,9,
+    1,108,235,239,255,1,245,117,128,253,0,1,54,133,247,157,1,139,60,253,0,253,0,1,88,216,247,255,1,225,98,253,
+    0,5,58,126,137,137,130,121,247,118,5,120,129,137,137,132,63,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,
+    117,5,58,126,137,137,89,21,247,0,5,29,157,255,255,245,117,241,0,5,29,157,255,255,245,117,249,0,1,26,75,251,
+    98,5,105,134,157,157,151,72,249,0,1,68,196,251,255,1,225,98,253,0,249,0,1,47,136,251,177,5,165,116,78,78,
+    75,36,241,0,5,29,157,255,255,245,117,128,128,5,16,36,39,39,25,6,247,0,5,29,157,255,255,245,117,5,108,235,
+    255,255,166,39,247,0,5,29,157,255,255,245,117,5,99,217,235,235,160,53,247,20,5,44,152,235,235,226,108,253,0,1,
+    88,216,247,255,1,225,98,253,0,128,241,0,5,18,96,157,157,151,72,252,0,241,0,5,29,157,255,255,245,117,252,0,
+    245,0,9,26,95,137,137,150,209,255,255,245,117,252,0,245,0,1,49,176,251,255,1,245,117,252,0,249,0,13,31,90,
+    118,118,121,131,137,137,150,209,255,255,245,117,252,0,249,0,13,68,196,255,255,206,78,0,0,29,157,255,255,245,117,252,
+    0,253,0,17,34,83,98,98,114,143,157,157,127,48,0,0,29,157,255,255,245,117,252,0,253,0,5,88,216,255,255,186,
+    59,251,0,5,29,157,255,255,245,117,252,0,9,33,72,78,78,112,161,177,177,129,40,251,0,5,29,157,255,255,245,117,
+    252,0,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,252,0,5,108,235,255,255,187,89,247,59,5,81,179,
+    255,255,247,149,254,59,1,32,2,1,108,235,234,255,1,137,10,1,91,199,243,216,5,220,240,255,255,253,234,254,216,1,
+    116,8,241,0,5,29,157,255,255,245,117,252,0,128,128,128,1,66,145,239,157,1,151,72,1,108,235,239,255,1,245,117,
+    5,108,235,255,255,207,139,243,118,1,113,54,5,108,235,255,255,166,39,241,0,128,128,5,108,235,255,255,200,122,247,98,
+    1,86,37,253,0,1,108,235,243,255,1,225,98,253,0,1,74,163,243,177,5,165,116,78,78,75,36,241,0,5,29,157,
+    255,255,245,117,128,128,5,16,36,39,39,25,6,247,0,5,29,157,255,255,245,117,5,108,235,255,255,166,39,247,0,5,
+    29,157,255,255,245,117,5,99,217,235,235,160,53,247,20,5,44,152,235,235,226,108,253,0,1,88,216,247,255,1,225,98,
+    253,0,128,249,0,1,42,120,251,157,1,139,60,253,0,249,0,1,68,196,251,255,1,225,98,253,0,253,0,5,47,116,
+    137,137,132,122,251,118,1,104,45,253,0,253,0,5,88,216,255,255,186,59,245,0,9,50,109,118,118,124,134,137,137,100,
+    31,245,0,5,108,235,255,255,166,39,241,0,5,108,235,255,255,200,122,247,98,1,86,37,253,0,1,108,235,243,255,1,
+    225,98,253,0,5,108,235,255,255,228,189,247,177,5,165,116,78,78,75,36,5,108,235,255,255,166,39,247,0,5,29,157,
+    255,255,245,117,128,128,128,128,5,99,217,235,235,160,53,247,20,5,44,152,235,235,226,108,253,0,1,88,216,247,255,1,
+    225,98,253,0,128,1,66,145,239,157,1,151,72,1,108,235,239,255,1,245,117,1,50,109,243,118,5,133,202,255,255,245,
+    117,241,0,5,29,157,255,255,245,117,245,0,9,22,81,118,118,120,129,137,137,132,63,245,0,5,49,176,255,255,225,98,
+    253,0,128,128,249,0,9,21,60,78,78,97,146,177,177,156,68,253,0,249,0,5,68,196,255,255,206,78,249,0,128,128,
+    253,0,9,13,33,39,39,86,175,216,216,174,66,249,0,253,0,5,88,216,255,255,186,59,245,0,128,128,128,253,0,1,
+    54,133,247,157,1,139,60,253,0,253,0,1,88,216,247,255,1,225,98,253,0,5,58,126,137,137,130,121,247,118,5,120,
+    129,137,137,132,63,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,5,66,145,157,157,136,107,247,98,
+    5,105,134,157,157,151,72,253,0,1,88,216,247,255,1,225,98,253,0,5,33,72,78,78,112,161,247,177,5,165,116,78,
+    78,75,36,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,128,128,5,99,217,235,235,160,53,247,20,
+    5,44,152,235,235,226,108,253,0,1,88,216,247,255,1,225,98,253,0,128,253,0,1,54,133,247,157,1,139,60,253,0,
+    253,0,1,88,216,247,255,1,225,98,253,0,5,58,126,137,137,130,121,247,118,5,120,129,137,137,132,63,5,108,235,255,
+    255,166,39,247,0,5,29,157,255,255,245,117,128,128,128,128,5,74,163,177,177,143,93,247,78,5,98,187,255,255,245,117,
+    253,0,1,88,216,243,255,1,245,117,253,0,1,68,166,247,196,5,203,232,255,255,245,117,241,0,5,29,157,255,255,245,
+    117,245,0,9,7,27,39,39,59,148,216,216,207,99,245,0,5,49,176,255,255,225,98,253,0,253,0,1,7,17,251,20,
+    5,61,169,235,235,208,90,253,0,253,0,1,88,216,251,255,1,206,78,249,0,128,5,31,90,118,118,95,36,5,68,196,
+    255,255,206,78,128,128,5,47,136,177,177,143,54,251,0,128,128,5,10,30,39,39,31,12,5,68,196,255,255,206,78,128,
+    128,128,253,0,5,40,99,118,118,86,27,253,0,5,88,216,255,255,186,59,128,128,253,0,5,61,149,177,177,129,40,247,
+    0,128,128,253,0,5,13,33,39,39,28,9,253,0,5,88,216,255,255,186,59,128,128,128,128,128,9,99,217,235,235,160,
+    53,20,20,14,4,5,108,235,255,255,166,39,253,0,5,16,36,39,39,25,6,253,0,241,0,1,22,81,251,118,1,113,
+    54,241,0,1,49,176,251,255,1,245,117,249,0,1,34,83,251,98,1,109,139,251,157,1,151,72,249,0,1,88,216,251,
+    255,1,206,78,249,0,0,39,250,78,1,112,161,251,177,1,143,54,249,0,0,127,250,255,1,166,39,241,0,0,98,250,
+    196,1,148,80,251,59,1,47,18,249,0,249,0,1,88,216,251,255,1,206,78,249,0,249,0,1,74,182,251,216,1,182,
+    93,251,39,1,37,18,241,0,1,49,176,251,255,1,245,117,241,0,1,45,163,251,235,1,226,108,1,41,90,234,98,1,
+    53,4,1,108,235,234,255,1,137,10,1,74,163,234,177,1,95,7,230,0,1,25,54,234,59,1,32,2,1,108,235,234,
+    255,1,137,10,1,91,199,234,216,1,116,8,1,50,109,251,118,1,86,27,240,0,1,108,235,251,255,1,186,59,240,0,
+    1,66,145,251,157,1,141,111,251,98,1,86,37,248,0,249,0,1,68,196,251,255,1,225,98,248,0,249,0,1,47,136,
+    251,177,1,165,116,250,78,1,42,3,241,0,1,29,157,250,255,1,137,10,249,0,1,16,45,251,59,1,75,143,250,196,
+    1,105,7,249,0,1,68,196,251,255,1,225,98,248,0,1,16,36,251,39,1,86,175,251,216,1,191,83,248,0,1,108,
+    235,251,255,1,186,59,240,0,1,99,217,251,235,1,172,54,240,0,253,0,1,54,133,247,157,1,139,60,253,0,253,0,
+    1,88,216,247,255,1,225,98,253,0,5,58,126,137,137,130,121,247,118,5,120,129,137,137,132,63,5,108,235,255,255,166,
+    39,247,0,5,29,157,255,255,245,117,5,58,126,137,137,89,21,247,0,5,29,157,255,255,245,117,241,0,5,29,157,255,
+    255,245,117,245,0,9,19,68,98,98,105,134,157,157,151,72,245,0,5,49,176,255,255,225,98,253,0,249,0,9,21,60,
+    78,78,97,146,177,177,156,68,253,0,249,0,5,68,196,255,255,206,78,249,0,128,128,249,0,5,58,166,216,216,174,66,
+    249,0,235,0,249,0,5,5,15,20,20,16,6,249,0,249,0,5,68,196,255,255,206,78,249,0,128,249,0,1,54,133,
+    247,157,1,139,60,248,0,249,0,1,88,216,247,255,1,225,98,248,0,253,0,5,58,126,137,137,130,121,247,118,5,120,
+    129,137,137,132,63,252,0,253,0,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,252,0,0,59,254,118,9,
+    126,135,137,137,89,21,0,0,31,90,251,118,5,120,129,137,137,136,127,254,118,1,63,4,0,127,254,255,1,147,19,251,
+    0,1,68,196,251,255,5,225,98,0,0,10,137,254,255,1,137,10,0,127,254,255,21,147,19,0,0,34,83,98,98,114,
+    143,157,157,176,225,255,255,225,98,0,0,10,137,254,255,1,137,10,0,127,254,255,21,147,19,0,0,88,216,255,255,186,
+    59,0,0,49,176,255,255,225,98,0,0,10,137,254,255,1,137,10,128,128,0,127,254,255,21,147,19,0,0,68,166,196,
+    196,159,90,59,59,96,194,255,255,232,134,59,59,64,132,254,196,1,105,7,0,127,254,255,1,147,19,251,0,1,68,196,
+    247,255,1,245,117,252,0,0,108,254,216,9,141,52,39,39,25,6,0,0,58,166,247,216,1,207,99,252,0,253,0,5,
+    108,235,255,255,166,39,236,0,253,0,5,99,217,235,235,160,53,243,20,1,19,9,252,0,249,0,1,88,216,243,255,1,
+    245,117,252,0,128,249,0,1,42,120,251,157,1,139,60,248,0,249,0,1,68,196,251,255,1,225,98,248,0,128,128,253,
+    0,5,40,99,118,118,123,132,251,137,5,135,125,118,118,113,54,252,0,253,0,5,88,216,255,255,186,59,251,0,5,29,
+    157,255,255,245,117,252,0,128,128,253,0,5,88,216,255,255,207,119,251,78,5,98,187,255,255,245,117,252,0,253,0,1,
+    88,216,243,255,1,245,117,252,0,5,25,54,59,59,106,175,243,196,1,191,122,254,59,1,32,2,5,108,235,255,255,166,
+    39,243,0,1,10,137,254,255,1,137,10,128,128,128,128,128,1,66,145,243,157,1,139,60,248,0,1,108,235,243,255,1,
+    225,98,248,0,5,108,235,255,255,207,139,247,118,5,120,129,137,137,132,63,252,0,5,108,235,255,255,166,39,247,0,5,
+    29,157,255,255,245,117,252,0,128,128,5,108,235,255,255,200,122,247,98,5,116,194,255,255,245,117,252,0,1,108,235,239,
+    255,1,245,117,252,0,5,108,235,255,255,228,189,243,177,1,173,123,254,78,1,42,3,5,108,235,255,255,166,39,243,0,
+    1,10,137,254,255,1,137,10,128,128,128,128,5,108,235,255,255,173,56,243,20,1,28,135,254,235,1,126,9,1,108,235,
+    239,255,1,245,117,252,0,128,249,0,1,42,120,247,157,1,151,72,252,0,249,0,1,68,196,247,255,1,245,117,252,0,
+    253,0,5,47,116,137,137,132,122,246,118,0,128,254,137,1,74,5,253,0,5,88,216,255,255,186,59,247,0,1,10,137,
+    254,255,1,137,10,9,50,109,118,118,124,134,137,137,100,31,247,0,1,5,74,254,137,1,74,5,5,108,235,255,255,166,
+    39,236,0,128,128,128,128,128,128,9,91,199,216,216,155,66,39,39,28,9,247,0,1,1,21,254,39,1,21,1,253,0,
+    5,88,216,255,255,186,59,247,0,1,10,137,254,255,1,137,10,253,0,5,81,199,235,235,177,69,247,20,1,28,135,254,
+    235,1,126,9,249,0,1,68,196,247,255,1,245,117,252,0,128,1,66,145,239,157,1,151,72,1,108,235,239,255,1,245,
+    117,5,108,235,255,255,207,139,243,118,1,113,54,5,108,235,255,255,166,39,241,0,128,128,5,108,235,255,255,200,122,247,
+    98,1,86,37,253,0,1,108,235,243,255,1,225,98,253,0,5,108,235,255,255,228,189,247,177,1,156,68,253,0,5,108,
+    235,255,255,166,39,241,0,128,128,128,128,5,108,235,255,255,173,56,243,20,1,19,9,1,108,235,239,255,1,245,117,128,
+    1,66,145,239,157,1,151,72,1,108,235,239,255,1,245,117,5,108,235,255,255,207,139,243,118,1,113,54,5,108,235,255,
+    255,166,39,241,0,128,128,5,108,235,255,255,200,122,247,98,1,86,37,253,0,1,108,235,243,255,1,225,98,253,0,5,
+    108,235,255,255,228,189,247,177,1,156,68,253,0,5,108,235,255,255,166,39,241,0,128,128,128,128,128,128,128,249,0,1,
+    42,120,247,157,1,151,72,252,0,249,0,1,68,196,247,255,1,245,117,252,0,253,0,5,47,116,137,137,132,122,246,118,
+    0,128,254,137,1,74,5,253,0,5,88,216,255,255,186,59,247,0,1,10,137,254,255,1,137,10,9,50,109,118,118,124,
+    134,137,137,100,31,247,0,1,5,74,254,137,1,74,5,5,108,235,255,255,166,39,236,0,128,128,5,108,235,255,255,166,
+    39,251,0,1,15,54,246,78,1,42,3,5,108,235,255,255,166,39,251,0,1,49,176,246,255,1,137,10,5,108,235,255,
+    255,166,39,251,0,1,37,135,251,196,1,198,228,254,255,1,137,10,5,108,235,255,255,166,39,243,0,1,10,137,254,255,
+    1,137,10,9,91,199,216,216,155,66,39,39,28,9,247,0,1,10,137,254,255,1,137,10,253,0,5,88,216,255,255,186,
+    59,247,0,1,10,137,254,255,1,137,10,253,0,5,81,199,235,235,177,69,247,20,1,28,135,254,235,1,126,9,249,0,
+    1,68,196,247,255,1,245,117,252,0,128,5,66,145,157,157,102,24,243,0,1,6,84,254,157,1,84,6,5,108,235,255,
+    255,166,39,243,0,1,10,137,254,255,1,137,10,128,128,128,128,5,108,235,255,255,200,122,243,98,1,104,182,254,255,1,
+    137,10,1,108,235,234,255,1,137,10,5,108,235,255,255,228,189,243,177,1,180,219,254,255,1,137,10,5,108,235,255,255,
+    166,39,243,0,1,10,137,254,255,1,137,10,128,128,128,128,128,128,128,1,54,133,247,157,1,139,60,1,88,216,247,255,
+    1,225,98,13,40,99,118,118,155,223,255,255,228,160,118,118,104,45,253,0,5,68,196,255,255,206,78,253,0,128,128,128,
+    128,128,128,128,128,128,128,13,7,17,20,20,83,200,255,255,209,92,20,20,17,7,1,88,216,247,255,1,225,98,128,253,
+    0,1,54,133,247,157,1,139,60,253,0,1,88,216,247,255,1,225,98,253,0,1,40,99,251,118,5,144,213,255,255,225,
+    98,245,0,5,49,176,255,255,225,98,128,128,128,128,128,128,128,128,128,128,1,8,18,247,20,5,61,169,235,235,208,90,
+    1,108,235,247,255,1,206,78,253,0,128,5,66,145,157,157,102,24,243,0,1,6,84,254,157,1,84,6,5,108,235,255,
+    255,166,39,243,0,1,10,137,254,255,1,137,10,5,108,235,255,255,166,39,247,0,5,16,84,137,137,136,127,254,118,1,
+    63,4,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,252,0,5,108,235,255,255,166,39,251,0,9,22,81,
+    118,118,120,129,137,137,132,63,252,0,5,108,235,255,255,166,39,251,0,5,49,176,255,255,225,98,248,0,17,108,235,255,
+    255,166,39,0,0,26,75,98,98,109,139,157,157,139,60,248,0,13,108,235,255,255,166,39,0,0,68,196,255,255,206,78,
+    244,0,13,108,235,255,255,194,105,78,78,126,214,255,255,206,78,244,0,1,108,235,247,255,1,206,78,244,0,5,108,235,
+    255,255,234,205,251,196,5,169,101,59,59,52,22,248,0,5,108,235,255,255,166,39,251,0,5,49,176,255,255,225,98,248,
+    0,5,108,235,255,255,166,39,251,0,9,41,149,216,216,195,107,39,39,37,18,252,0,5,108,235,255,255,166,39,247,0,
+    5,29,157,255,255,245,117,252,0,5,108,235,255,255,166,39,247,0,5,27,144,235,235,227,119,254,20,1,11,1,5,108,
+    235,255,255,166,39,243,0,1,10,137,254,255,1,137,10,128,5,66,145,157,157,102,24,241,0,5,108,235,255,255,166,39,
+    241,0,128,128,128,128,128,128,128,128,128,128,128,128,5,108,235,255,255,173,56,243,20,1,19,9,1,108,235,239,255,1,
+    245,117,128,0,78,250,157,1,102,24,247,0,1,18,96,250,157,1,84,6,0,127,250,255,1,166,39,247,0,1,29,157,
+    250,255,1,137,10,128,128,0,127,254,255,21,205,146,137,137,130,121,118,118,86,27,0,0,22,81,118,118,120,129,137,137,
+    141,200,254,255,1,137,10,0,127,254,255,21,147,19,0,0,88,216,255,255,186,59,0,0,49,176,255,255,225,98,0,0,
+    10,137,254,255,1,137,10,128,128,0,127,254,255,21,147,19,0,0,61,149,177,177,150,101,78,78,97,146,177,177,156,68,
+    0,0,10,137,254,255,1,137,10,0,127,254,255,1,147,19,251,0,5,68,196,255,255,206,78,251,0,1,10,137,254,255,
+    1,137,10,128,128,0,127,254,255,1,147,19,251,0,5,58,166,216,216,174,66,251,0,1,10,137,254,255,1,137,10,0,
+    127,254,255,1,147,19,239,0,1,10,137,254,255,1,137,10,128,128,128,1,66,145,251,157,1,114,36,247,0,1,6,84,
+    254,157,1,84,6,1,108,235,251,255,1,186,59,247,0,1,10,137,254,255,1,137,10,128,128,13,108,235,255,255,214,155,
+    137,137,132,122,118,118,95,36,251,0,1,10,137,254,255,1,137,10,13,108,235,255,255,166,39,0,0,68,196,255,255,206,
+    78,251,0,1,10,137,254,255,1,137,10,128,128,21,108,235,255,255,166,39,0,0,47,136,177,177,158,108,78,78,69,30,
+    0,0,10,137,254,255,1,137,10,5,108,235,255,255,166,39,251,0,9,49,176,255,255,225,98,0,0,10,137,254,255,1,
+    137,10,128,128,5,108,235,255,255,166,39,251,0,9,41,149,216,216,195,107,39,39,47,155,254,255,1,137,10,5,108,235,
+    255,255,166,39,247,0,1,29,157,250,255,1,137,10,128,128,128,249,0,1,42,120,251,157,1,139,60,248,0,249,0,1,
+    68,196,251,255,1,225,98,248,0,253,0,5,47,116,137,137,132,122,251,118,5,120,129,137,137,132,63,252,0,253,0,5,
+    88,216,255,255,186,59,251,0,5,29,157,255,255,245,117,252,0,9,50,109,118,118,124,134,137,137,100,31,251,0,5,16,
+    84,137,137,136,127,254,118,1,63,4,5,108,235,255,255,166,39,243,0,1,10,137,254,255,1,137,10,128,128,128,128,128,
+    128,9,91,199,216,216,155,66,39,39,28,9,251,0,5,4,24,39,39,46,134,254,216,1,116,8,253,0,5,88,216,255,
+    255,186,59,251,0,5,29,157,255,255,245,117,252,0,253,0,5,81,199,235,235,177,69,251,20,5,44,152,235,235,226,108,
+    252,0,249,0,1,68,196,251,255,1,225,98,248,0,128,1,66,145,243,157,1,139,60,253,0,1,108,235,243,255,1,225,
+    98,253,0,5,108,235,255,255,207,139,247,118,5,120,129,137,137,132,63,5,108,235,255,255,166,39,247,0,5,29,157,255,
+    255,245,117,128,128,128,128,5,108,235,255,255,194,105,247,78,5,89,139,177,177,170,81,1,108,235,243,255,1,225,98,253,
+    0,5,108,235,255,255,234,205,247,196,1,173,75,253,0,5,108,235,255,255,166,39,241,0,128,128,128,128,128,249,0,1,
+    42,120,251,157,1,139,60,248,0,249,0,1,68,196,251,255,1,225,98,248,0,253,0,5,47,116,137,137,132,122,251,118,
+    5,120,129,137,137,132,63,252,0,253,0,5,88,216,255,255,186,59,251,0,5,29,157,255,255,245,117,252,0,9,50,109,
+    118,118,124,134,137,137,100,31,251,0,5,16,84,137,137,136,127,254,118,1,63,4,5,108,235,255,255,166,39,243,0,1,
+    10,137,254,255,1,137,10,128,128,128,128,128,128,9,91,199,216,216,155,66,39,39,28,9,251,0,5,4,24,39,39,46,
+    134,254,216,1,116,8,253,0,5,88,216,255,255,186,59,251,0,5,29,157,255,255,245,117,252,0,253,0,5,81,199,235,
+    235,177,69,251,20,5,44,152,235,235,227,119,254,20,1,11,1,249,0,1,68,196,251,255,5,225,98,0,0,10,137,254,
+    255,1,137,10,128,237,0,1,10,137,254,255,1,137,10,128,237,0,1,1,11,254,20,1,11,1,1,66,145,243,157,1,
+    139,60,248,0,1,108,235,243,255,1,225,98,248,0,5,108,235,255,255,207,139,247,118,5,120,129,137,137,132,63,252,0,
+    5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,252,0,128,128,128,128,5,108,235,255,255,194,105,247,78,5,
+    89,139,177,177,170,81,252,0,1,108,235,243,255,1,225,98,248,0,5,108,235,255,255,234,205,251,196,5,207,237,255,255,
+    225,98,248,0,5,108,235,255,255,166,39,251,0,5,49,176,255,255,225,98,248,0,5,108,235,255,255,166,39,251,0,9,
+    41,149,216,216,195,107,39,39,37,18,252,0,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,252,0,5,108,
+    235,255,255,166,39,247,0,5,27,144,235,235,227,119,254,20,1,11,1,5,108,235,255,255,166,39,243,0,1,10,137,254,
+    255,1,137,10,128,253,0,1,54,133,243,157,1,151,72,252,0,253,0,1,88,216,243,255,1,245,117,252,0,5,58,126,
+    137,137,130,121,242,118,0,128,254,137,1,74,5,5,108,235,255,255,166,39,243,0,1,10,137,254,255,1,137,10,5,108,
+    235,255,255,166,39,243,0,1,5,74,254,137,1,74,5,5,108,235,255,255,166,39,236,0,5,66,145,157,157,136,107,251,
+    98,1,79,30,244,0,253,0,1,88,216,251,255,1,206,78,244,0,253,0,1,61,149,251,177,1,158,108,251,78,1,75,
+    36,252,0,245,0,1,49,176,251,255,1,245,117,252,0,245,0,1,37,135,251,196,1,191,122,254,59,1,32,2,237,0,
+    1,10,137,254,255,1,137,10,5,16,36,39,39,25,6,243,0,1,10,137,254,255,1,137,10,5,108,235,255,255,166,39,
+    243,0,1,10,137,254,255,1,137,10,5,99,217,235,235,160,53,243,20,1,28,135,254,235,1,126,9,253,0,1,88,216,
+    243,255,1,245,117,252,0,128,0,78,229,157,1,84,6,0,127,229,255,1,137,10,0,59,246,118,5,155,223,255,255,228,
+    160,246,118,1,63,4,245,0,5,68,196,255,255,206,78,244,0,128,128,128,128,128,128,128,128,128,128,128,128,128,5,66,
+    145,157,157,102,24,243,0,1,6,84,254,157,1,84,6,5,108,235,255,255,166,39,243,0,1,10,137,254,255,1,137,10,
+    128,128,128,128,128,128,128,128,128,128,128,128,5,99,217,235,235,160,53,243,20,1,28,135,254,235,1,126,9,253,0,1,
+    88,216,243,255,1,245,117,252,0,128,0,78,254,157,1,90,12,239,0,1,6,84,254,157,1,84,6,0,127,254,255,1,
+    147,19,239,0,1,10,137,254,255,1,137,10,128,128,0,68,254,137,5,129,119,118,118,77,18,247,0,1,13,72,254,118,
+    0,128,254,137,1,74,5,253,0,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,252,0,128,128,253,0,21,
+    74,163,177,177,143,93,78,78,57,18,0,0,15,54,78,78,89,139,177,177,170,81,252,0,249,0,13,88,216,255,255,186,
+    59,0,0,49,176,255,255,225,98,248,0,128,128,249,0,13,74,182,216,216,168,80,39,39,73,161,216,216,191,83,248,0,
+    245,0,5,68,196,255,255,206,78,244,0,128,128,128,0,78,254,157,1,90,12,239,0,1,6,84,254,157,1,84,6,0,
+    127,254,255,1,147,19,239,0,1,10,137,254,255,1,137,10,0,127,254,255,1,147,19,251,0,5,37,105,137,137,110,42,
+    251,0,1,10,137,254,255,1,137,10,0,127,254,255,1,147,19,251,0,5,68,196,255,255,206,78,251,0,1,10,137,254,
+    255,1,137,10,128,128,0,127,254,255,21,147,19,0,0,34,83,98,98,114,143,157,157,145,116,98,98,86,37,0,0,10,
+    137,254,255,1,137,10,0,127,254,255,21,147,19,0,0,88,216,255,255,186,59,0,0,49,176,255,255,225,98,0,0,10,
+    137,254,255,1,137,10,128,128,0,98,254,196,21,138,69,59,59,127,225,255,255,186,59,0,0,49,176,255,255,232,134,59,
+    59,64,132,254,196,1,105,7,253,0,1,108,235,251,255,5,186,59,0,0,49,176,251,255,1,245,117,252,0,253,0,21,
+    108,235,255,255,241,222,216,216,158,50,0,0,41,149,216,216,220,240,255,255,245,117,252,0,253,0,5,108,235,255,255,166,
+    39,247,0,5,29,157,255,255,245,117,252,0,128,128,128,5,66,145,157,157,102,24,243,0,1,6,84,254,157,1,84,6,
+    5,108,235,255,255,166,39,243,0,1,10,137,254,255,1,137,10,128,128,9,58,126,137,137,130,121,118,118,86,27,251,0,
+    1,13,72,254,118,0,128,254,137,1,74,5,253,0,5,88,216,255,255,186,59,251,0,5,29,157,255,255,245,117,252,0,
+    253,0,5,54,133,157,157,141,111,251,98,5,105,134,157,157,151,72,252,0,249,0,1,68,196,251,255,1,225,98,248,0,
+    128,128,253,0,5,20,50,59,59,96,164,251,196,5,180,111,59,59,56,27,252,0,253,0,5,88,216,255,255,186,59,251,
+    0,5,29,157,255,255,245,117,252,0,9,16,36,39,39,100,188,216,216,158,50,251,0,5,25,133,216,216,209,120,254,39,
+    1,21,1,5,108,235,255,255,166,39,243,0,1,10,137,254,255,1,137,10,128,128,128,0,78,254,157,1,90,12,239,0,
+    1,6,84,254,157,1,84,6,0,127,254,255,1,147,19,239,0,1,10,137,254,255,1,137,10,128,128,0,68,254,137,5,
+    129,119,118,118,77,18,247,0,1,13,72,254,118,0,128,254,137,1,74,5,253,0,5,108,235,255,255,166,39,247,0,5,
+    29,157,255,255,245,117,252,0,253,0,21,66,145,157,157,136,107,98,98,71,22,0,0,19,68,98,98,105,134,157,157,151,
+    72,252,0,249,0,13,88,216,255,255,186,59,0,0,49,176,255,255,225,98,248,0,249,0,13,61,149,177,177,150,101,78,
+    78,97,146,177,177,156,68,248,0,245,0,5,68,196,255,255,206,78,244,0,128,128,128,128,128,128,128,1,66,145,234,157,
+    1,84,6,1,108,235,234,255,1,137,10,1,50,109,239,118,1,123,191,254,255,1,137,10,237,0,1,10,137,254,255,1,
+    137,10,241,0,1,13,72,254,118,0,128,254,137,1,74,5,241,0,5,29,157,255,255,245,117,252,0,245,0,9,19,68,
+    98,98,105,134,157,157,151,72,252,0,245,0,5,49,176,255,255,225,98,248,0,249,0,9,21,60,78,78,97,146,177,177,
+    156,68,248,0,249,0,5,68,196,255,255,206,78,244,0,253,0,9,20,50,59,59,96,164,196,196,158,60,244,0,253,0,
+    5,88,216,255,255,186,59,240,0,9,16,36,39,39,100,188,216,216,158,50,240,0,5,108,235,255,255,166,39,236,0,5,
+    108,235,255,255,173,56,238,20,1,11,1,1,108,235,234,255,1,137,10,128,1,61,149,247,177,1,156,68,1,88,216,247,
+    255,1,225,98,5,88,216,255,255,213,134,251,98,1,86,37,5,88,216,255,255,186,59,249,0,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,5,88,216,255,255,249,239,251,235,1,208,90,1,88,216,247,255,1,225,98,1,13,
+    33,247,39,1,34,15,5,74,163,177,177,115,27,241,0,5,108,235,255,255,166,39,241,0,128,128,9,50,109,118,118,124,
+    134,137,137,100,31,245,0,253,0,5,88,216,255,255,186,59,245,0,128,128,253,0,9,54,133,157,157,141,111,98,98,79,
+    30,249,0,249,0,5,68,196,255,255,206,78,249,0,128,128,249,0,9,53,151,196,196,169,101,59,59,52,22,253,0,245,
+    0,5,49,176,255,255,225,98,253,0,128,128,245,0,9,45,163,235,235,210,103,20,20,19,9,241,0,5,29,157,255,255,
+    245,117,128,128,128,241,0,5,2,12,20,20,19,9,1,61,149,247,177,1,156,68,1,88,216,247,255,1,225,98,1,34,
+    83,251,98,5,128,206,255,255,225,98,249,0,5,49,176,255,255,225,98,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,1,81,199,251,235,5,239,249,255,255,225,98,1,88,216,247,255,1,225,98,1,13,33,247,39,1,34,15,
+    249,0,5,47,136,177,177,143,54,249,0,249,0,5,68,196,255,255,206,78,249,0,128,128,253,0,13,47,116,137,137,132,
+    122,118,118,121,131,137,137,121,53,253,0,253,0,13,88,216,255,255,186,59,0,0,49,176,255,255,225,98,253,0,128,128,
+    21,41,90,98,98,118,148,157,157,114,36,0,0,30,108,157,157,150,120,98,98,94,45,5,108,235,255,255,166,39,247,0,
+    5,29,157,255,255,245,117,128,128,5,83,181,196,196,128,30,247,0,5,22,120,196,196,188,90,0,127,229,255,1,137,10,
+    128,0,10,229,20,1,11,1,5,61,149,177,177,129,40,253,0,5,88,216,255,255,186,59,253,0,9,34,83,98,98,114,
+    143,157,157,127,48,253,0,5,68,196,255,255,206,78,253,0,5,31,90,118,118,95,36,253,0,1,40,99,247,118,1,104,
+    45,253,0,253,0,1,88,216,247,255,1,225,98,253,0,253,0,1,54,133,247,157,5,150,120,98,98,94,45,241,0,5,
+    29,157,255,255,245,117,253,0,1,27,66,247,78,5,98,187,255,255,245,117,253,0,1,88,216,243,255,1,245,117,5,25,
+    54,59,59,106,175,247,196,5,203,232,255,255,245,117,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,
+    5,99,217,235,235,160,53,247,20,5,47,164,255,255,245,117,253,0,1,88,216,243,255,1,245,117,128,253,0,1,40,99,
+    247,118,1,104,45,253,0,253,0,1,88,216,247,255,1,225,98,253,0,5,41,90,98,98,118,148,247,157,5,150,120,98,
+    98,94,45,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,5,108,235,255,255,166,39,247,0,5,20,109,177,
+    177,170,81,5,108,235,255,255,166,39,241,0,128,128,5,108,235,255,255,166,39,247,0,5,4,24,39,39,37,18,5,108,
+    235,255,255,166,39,247,0,5,29,157,255,255,245,117,5,99,217,235,235,160,53,247,20,5,44,152,235,235,226,108,253,0,
+    1,88,216,247,255,1,225,98,253,0,128,241,0,5,20,109,177,177,170,81,241,0,5,29,157,255,255,245,117,128,128,128,
+    128,253,0,1,40,99,247,118,5,133,202,255,255,245,117,253,0,1,88,216,243,255,1,245,117,5,41,90,98,98,118,148,
+    247,157,5,168,217,255,255,245,117,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,128,128,128,128,5,
+    99,217,235,235,160,53,247,20,5,47,164,255,255,245,117,253,0,1,88,216,243,255,1,245,117,128,249,0,1,47,136,247,
+    177,1,170,81,249,0,1,68,196,247,255,1,245,117,253,0,5,54,133,157,157,141,111,247,98,1,94,45,253,0,5,88,
+    216,255,255,186,59,245,0,128,128,9,50,109,118,118,165,234,255,255,218,149,251,118,1,104,45,253,0,1,108,235,243,255,
+    1,225,98,253,0,9,66,145,157,157,191,240,255,255,228,179,251,157,1,139,60,253,0,253,0,5,88,216,255,255,186,59,
+    245,0,128,128,128,128,128,128,128,128,128,5,74,163,177,177,115,27,241,0,5,108,235,255,255,166,39,241,0,128,128,128,
+    128,5,108,235,255,255,207,139,247,118,1,104,45,253,0,1,108,235,243,255,1,225,98,253,0,5,108,235,255,255,221,172,
+    247,157,5,150,120,98,98,94,45,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,128,128,128,128,128,
+    128,128,253,0,5,47,136,177,177,143,54,253,0,5,68,196,255,255,206,78,253,0,5,26,75,98,98,79,30,247,0,128,
+    128,1,40,99,251,118,1,95,36,1,88,216,251,255,1,206,78,9,54,133,157,157,183,232,255,255,206,78,253,0,5,68,
+    196,255,255,206,78,128,128,128,128,128,128,128,128,128,245,0,5,34,122,177,177,156,68,245,0,5,49,176,255,255,225,98,
+    245,0,5,19,68,98,98,86,37,239,0,128,128,249,0,1,31,90,251,118,1,104,45,249,0,1,68,196,251,255,1,225,
+    98,249,0,9,42,120,157,157,176,225,255,255,225,98,245,0,5,49,176,255,255,225,98,128,128,128,128,128,128,128,128,128,
+    128,128,1,99,217,247,235,5,193,86,20,20,17,7,1,108,235,247,255,1,206,78,253,0,1,16,36,247,39,1,31,12,
+    253,0,5,74,163,177,177,115,27,241,0,5,108,235,255,255,166,39,241,0,128,128,128,128,5,108,235,255,255,166,39,247,
+    0,5,13,72,118,118,113,54,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,5,108,235,255,255,166,39,251,
+    0,9,19,68,98,98,105,134,157,157,151,72,5,108,235,255,255,166,39,251,0,5,49,176,255,255,225,98,253,0,17,108,
+    235,255,255,166,39,0,0,21,60,78,78,97,146,177,177,156,68,253,0,13,108,235,255,255,166,39,0,0,68,196,255,255,
+    206,78,249,0,13,108,235,255,255,187,89,59,59,111,209,255,255,206,78,249,0,1,108,235,247,255,1,206,78,249,0,5,
+    108,235,255,255,241,222,251,216,5,182,93,39,39,34,15,253,0,5,108,235,255,255,166,39,251,0,5,49,176,255,255,225,
+    98,253,0,5,108,235,255,255,166,39,251,0,9,45,163,235,235,210,103,20,20,19,9,5,108,235,255,255,166,39,247,0,
+    5,29,157,255,255,245,117,128,1,61,149,251,177,1,143,54,1,88,216,251,255,1,206,78,9,34,83,98,98,140,219,255,
+    255,206,78,253,0,5,68,196,255,255,206,78,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,59,246,118,5,
+    86,27,0,0,22,81,251,118,1,113,54,252,0,0,127,246,255,5,186,59,0,0,49,176,251,255,1,245,117,252,0,0,
+    127,254,255,1,213,164,251,157,5,141,111,98,98,109,139,251,157,1,154,125,254,98,1,53,4,0,127,254,255,1,147,19,
+    251,0,5,68,196,255,255,206,78,251,0,1,10,137,254,255,1,137,10,128,128,128,128,128,128,128,128,128,1,50,109,243,
+    118,1,104,45,253,0,1,108,235,243,255,1,225,98,253,0,5,108,235,255,255,221,172,247,157,5,150,120,98,98,94,45,
+    5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,128,128,128,128,128,128,128,253,0,1,40,99,247,118,
+    1,104,45,253,0,253,0,1,88,216,247,255,1,225,98,253,0,5,41,90,98,98,118,148,247,157,5,150,120,98,98,94,
+    45,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,128,128,128,128,5,99,217,235,235,160,53,247,20,
+    5,44,152,235,235,226,108,253,0,1,88,216,247,255,1,225,98,253,0,128,1,50,109,243,118,1,104,45,253,0,1,108,
+    235,243,255,1,225,98,253,0,5,108,235,255,255,221,172,247,157,5,150,120,98,98,94,45,5,108,235,255,255,166,39,247,
+    0,5,29,157,255,255,245,117,128,128,128,128,128,128,5,108,235,255,255,173,56,247,20,5,44,152,235,235,226,108,1,108,
+    235,243,255,1,225,98,253,0,128,5,108,235,255,255,166,39,241,0,128,128,128,128,128,5,25,54,59,59,38,9,241,0,
+    253,0,1,40,99,243,118,1,113,54,253,0,1,88,216,243,255,1,245,117,5,41,90,98,98,118,148,247,157,5,168,217,
+    255,255,245,117,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,128,128,128,128,5,99,217,235,235,160,
+    53,247,20,5,47,164,255,255,245,117,253,0,1,88,216,243,255,1,245,117,128,241,0,5,29,157,255,255,245,117,128,128,
+    128,128,128,241,0,5,7,36,59,59,56,27,9,50,109,118,118,77,18,0,0,31,90,251,118,1,104,45,253,0,9,108,
+    235,255,255,166,39,0,0,68,196,251,255,1,225,98,253,0,9,108,235,255,255,200,122,98,98,114,143,251,157,5,150,120,
+    98,98,94,45,1,108,235,251,255,1,186,59,251,0,5,29,157,255,255,245,117,9,108,235,255,255,228,189,177,177,129,40,
+    251,0,5,20,109,177,177,170,81,5,108,235,255,255,166,39,241,0,128,128,128,128,128,128,128,253,0,1,40,99,243,118,
+    1,113,54,253,0,1,88,216,243,255,1,245,117,5,41,90,98,98,118,148,243,157,1,151,72,5,108,235,255,255,166,39,
+    241,0,5,74,163,177,177,143,93,251,78,1,63,24,249,0,253,0,1,88,216,251,255,1,206,78,249,0,253,0,1,68,
+    166,251,196,5,169,101,59,59,52,22,253,0,245,0,5,49,176,255,255,225,98,253,0,245,0,9,41,149,216,216,195,107,
+    39,39,37,18,241,0,5,29,157,255,255,245,117,1,8,18,243,20,5,44,152,235,235,226,108,1,108,235,243,255,1,225,
+    98,253,0,128,5,54,133,157,157,114,36,245,0,5,88,216,255,255,186,59,245,0,128,128,5,88,216,255,255,218,149,247,
+    118,1,113,54,1,88,216,243,255,1,245,117,5,88,216,255,255,228,179,247,157,1,151,72,5,88,216,255,255,186,59,245,
+    0,128,128,128,128,128,128,5,81,199,235,235,177,69,247,20,1,19,9,253,0,1,68,196,247,255,1,245,117,128,5,50,
+    109,118,118,77,18,247,0,5,13,72,118,118,113,54,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,117,128,128,
+    21,74,163,177,177,143,93,78,78,57,18,0,0,15,54,78,78,89,139,177,177,170,81,253,0,13,88,216,255,255,186,59,
+    0,0,49,176,255,255,225,98,253,0,128,128,253,0,13,74,182,216,216,168,80,39,39,73,161,216,216,191,83,253,0,249,
+    0,5,68,196,255,255,206,78,249,0,128,128,128,0,59,254,118,1,68,9,239,0,1,4,63,254,118,1,63,4,0,127,
+    254,255,1,147,19,239,0,1,10,137,254,255,1,137,10,0,127,254,255,1,147,19,251,0,5,26,75,98,98,79,30,251,
+    0,1,10,137,254,255,1,137,10,0,127,254,255,1,147,19,251,0,5,68,196,255,255,206,78,251,0,1,10,137,254,255,
+    1,137,10,128,128,0,127,254,255,21,147,19,0,0,20,50,59,59,96,164,196,196,169,101,59,59,52,22,0,0,10,137,
+    254,255,1,137,10,0,127,254,255,21,147,19,0,0,88,216,255,255,186,59,0,0,49,176,255,255,225,98,0,0,10,137,
+    254,255,1,137,10,0,108,254,216,21,141,52,39,39,114,222,255,255,186,59,0,0,49,176,255,255,230,122,39,39,46,134,
+    254,216,1,116,8,253,0,1,108,235,251,255,5,186,59,0,0,49,176,251,255,1,245,117,252,0,253,0,21,108,235,255,
+    255,248,238,235,235,172,54,0,0,45,163,235,235,237,247,255,255,245,117,252,0,253,0,5,108,235,255,255,166,39,247,0,
+    5,29,157,255,255,245,117,252,0,128,5,50,109,118,118,77,18,247,0,5,13,72,118,118,113,54,5,108,235,255,255,166,
+    39,247,0,5,29,157,255,255,245,117,21,66,145,157,157,136,107,98,98,71,22,0,0,19,68,98,98,105,134,157,157,151,
+    72,253,0,13,88,216,255,255,186,59,0,0,49,176,255,255,225,98,253,0,253,0,13,61,149,177,177,150,101,78,78,97,
+    146,177,177,156,68,253,0,249,0,5,68,196,255,255,206,78,249,0,128,128,253,0,13,13,33,39,39,86,175,216,216,182,
+    93,39,39,34,15,253,0,253,0,13,88,216,255,255,186,59,0,0,49,176,255,255,225,98,253,0,21,8,18,20,20,94,
+    202,235,235,172,54,0,0,45,163,235,235,210,103,20,20,19,9,5,108,235,255,255,166,39,247,0,5,29,157,255,255,245,
+    117,128,5,50,109,118,118,77,18,247,0,5,13,72,118,118,113,54,5,108,235,255,255,166,39,247,0,5,29,157,255,255,
+    245,117,128,128,128,128,128,128,128,128,5,99,217,235,235,160,53,247,20,5,47,164,255,255,245,117,253,0,1,88,216,243,
+    255,1,245,117,128,241,0,5,29,157,255,255,245,117,128,128,128,253,0,1,74,182,247,216,5,195,107,39,39,37,18,253,
+    0,1,88,216,247,255,1,225,98,253,0,253,0,1,20,50,247,59,1,52,22,253,0,1,50,109,239,118,1,113,54,1,
+    108,235,239,255,1,245,117,1,66,145,243,157,5,168,217,255,255,245,117,241,0,5,29,157,255,255,245,117,245,0,9,15,
+    54,78,78,89,139,177,177,170,81,245,0,5,49,176,255,255,225,98,253,0,249,0,9,16,45,59,59,85,154,196,196,173,
+    75,253,0,249,0,5,68,196,255,255,206,78,249,0,253,0,9,13,33,39,39,86,175,216,216,174,66,249,0,253,0,5,
+    88,216,255,255,186,59,245,0,9,8,18,20,20,101,219,255,255,191,74,247,20,1,19,9,1,108,235,239,255,1,245,117,
+    128,245,0,1,34,122,251,177,1,170,81,245,0,1,49,176,251,255,1,245,117,249,0,5,42,120,157,157,145,116,251,98,
+    1,94,45,249,0,5,68,196,255,255,206,78,249,0,128,128,128,128,128,128,1,33,72,251,78,5,104,154,177,177,143,54,
+    249,0,1,108,235,251,255,1,186,59,245,0,1,83,181,251,196,5,159,90,59,59,47,18,249,0,249,0,5,68,196,255,
+    255,206,78,249,0,128,128,128,128,128,128,128,249,0,5,5,15,20,20,61,169,251,235,1,226,108,245,0,1,49,176,251,
+    255,1,245,117,245,0,1,7,27,251,39,1,37,18,5,47,136,177,177,143,54,5,68,196,255,255,206,78,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,5,10,30,39,39,31,12,1,74,163,251,177,1,129,40,
+    245,0,1,108,235,251,255,1,186,59,245,0,1,41,90,251,98,5,114,143,157,157,127,48,249,0,249,0,5,68,196,255,
+    255,206,78,249,0,128,128,128,128,128,128,249,0,5,47,136,177,177,158,108,251,78,1,75,36,245,0,1,49,176,251,255,
+    1,245,117,249,0,5,16,45,59,59,85,154,251,196,1,188,90,249,0,5,68,196,255,255,206,78,249,0,128,128,128,128,
+    128,128,128,1,99,217,251,235,5,177,69,20,20,16,6,249,0,1,108,235,251,255,1,186,59,245,0,1,16,36,251,39,
+    1,28,9,245,0,253,0,1,41,90,247,98,1,79,30,251,0,1,4,53,254,98,1,53,4,253,0,1,108,235,247,255,
+    1,206,78,251,0,1,10,137,254,255,1,137,10,0,39,254,78,1,119,169,251,177,5,198,237,255,255,221,132,251,78,1,
+    82,131,254,177,1,95,7,0,127,254,255,1,147,19,251,0,1,68,196,247,255,1,245,117,252,0,0,98,254,196,1,113,
+    15,251,0,1,53,151,247,196,1,188,90,252,0,1,7,95,239,177,1,143,54,247,0,1,10,137,239,255,1,206,78,247,
+    0,1,10,137,254,255,1,250,221,244,196,1,169,101,254,59,1,45,16,252,0,1,10,137,254,255,1,235,108,244,0,1,
+    49,176,254,255,1,196,68,252,0,128,1,10,137,254,255,1,235,108,244,0,1,11,41,254,59,1,90,159,254,196,1,143,
+    45,1,10,137,254,255,1,235,108,239,0,1,59,186,254,255,1,186,59,128,128,128,128,128,128,128,128,1,10,137,254,255,
+    1,235,108,244,0,1,45,163,254,235,1,185,78,254,20,1,14,4,1,10,137,254,255,1,235,108,244,0,1,49,176,254,
+    255,1,196,68,252,0,1,10,137,254,255,1,244,176,244,118,1,121,131,254,137,1,105,37,252,0,1,10,137,239,255,1,
+    206,78,247,0,128,252,0,1,15,113,244,196,1,158,60,252,0,252,0,1,19,147,244,255,1,206,78,252,0,1,3,42,
+    254,78,1,86,135,244,177,1,158,108,254,78,1,60,21,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,
+    68,128,1,10,137,254,255,1,252,232,244,216,1,223,243,254,255,1,196,68,1,10,137,234,255,1,196,68,1,10,137,254,
+    255,1,247,198,239,157,1,120,42,1,10,137,254,255,1,235,108,237,0,128,1,10,137,254,255,1,235,108,244,0,1,45,
+    163,254,235,1,181,63,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,1,5,74,254,137,1,135,126,
+    244,118,1,121,131,254,137,1,105,37,252,0,1,19,147,244,255,1,206,78,252,0,128,1,1,21,254,39,1,36,16,237,
+    0,1,10,137,254,255,1,235,108,237,0,128,128,128,128,128,128,1,10,137,254,255,1,250,221,244,196,1,158,60,252,0,
+    1,10,137,239,255,1,206,78,252,0,1,10,137,254,255,1,249,210,244,177,1,158,108,254,78,1,60,21,1,10,137,254,
+    255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,128,128,128,128,128,128,128,1,10,137,254,255,1,244,176,244,118,
+    1,121,131,254,137,1,105,37,1,10,137,239,255,1,206,78,252,0,128,1,7,105,254,196,1,181,83,244,0,1,37,135,
+    254,196,1,151,53,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,128,128,128,128,128,128,128,128,
+    128,1,5,74,254,137,1,135,126,244,118,1,144,213,254,255,1,196,68,252,0,1,19,147,239,255,1,196,68,128,252,0,
+    1,15,113,239,196,1,151,53,252,0,1,19,147,239,255,1,196,68,1,3,42,254,78,1,86,135,244,177,1,192,231,254,
+    255,1,196,68,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,128,128,128,128,128,128,128,1,5,
+    74,254,137,1,135,126,244,118,1,144,213,254,255,1,196,68,252,0,1,19,147,239,255,1,196,68,128,237,0,1,49,176,
+    254,255,1,196,68,128,128,128,252,0,1,1,11,244,20,1,61,169,254,235,1,181,63,252,0,1,19,147,244,255,1,206,
+    78,252,0,128,252,0,1,7,56,244,98,1,79,30,252,0,1,20,109,254,177,1,149,61,1,29,157,254,255,1,216,88,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,1,2,12,254,20,1,17,7,250,0,1,13,72,254,118,1,99,40,1,
+    29,157,254,255,1,216,88,128,1,3,22,254,39,1,34,15,254,0,1,6,25,254,39,1,31,12,1,19,147,254,255,1,
+    225,98,254,0,1,39,166,254,255,1,206,78,128,128,128,128,128,128,1,4,34,254,59,1,52,22,254,0,1,9,38,254,
+    59,1,47,18,243,0,1,20,109,254,177,1,149,61,254,0,1,34,122,254,177,1,136,47,252,0,243,0,1,29,157,254,
+    255,1,216,88,254,0,1,49,176,254,255,1,196,68,252,0,128,128,128,253,0,1,7,105,249,196,1,203,232,254,255,1,
+    246,216,254,196,1,207,237,254,255,1,241,212,254,196,1,143,45,253,0,1,10,137,229,255,1,186,59,253,0,1,7,95,
+    254,177,1,183,222,254,255,1,246,207,254,177,1,189,228,254,255,1,240,201,249,177,1,129,40,248,0,1,19,147,254,255,
+    1,225,98,254,0,1,39,166,254,255,1,206,78,247,0,128,128,128,0,49,249,98,1,110,188,254,255,1,237,158,254,98,
+    1,122,200,254,255,1,225,146,254,98,1,75,26,252,0,0,127,229,255,1,196,68,252,0,128,0,10,254,20,1,29,146,
+    254,255,1,237,119,254,20,1,47,164,254,255,1,219,101,249,20,1,15,5,252,0,253,0,1,10,137,254,255,1,235,108,
+    254,0,1,29,157,254,255,1,216,88,242,0,128,128,128,247,0,1,20,109,254,177,1,149,61,247,0,247,0,1,29,157,
+    254,255,1,216,88,247,0,252,0,1,4,34,254,59,1,81,179,254,255,1,225,127,249,59,1,45,16,252,0,1,19,147,
+    239,255,1,196,68,128,1,7,105,254,196,1,185,117,254,59,1,81,179,254,255,1,225,127,249,59,1,45,16,1,10,137,
+    254,255,1,235,108,254,0,1,29,157,254,255,1,216,88,247,0,128,128,128,1,1,21,254,39,1,52,141,254,216,1,220,
+    240,254,255,1,249,229,254,216,1,174,66,252,0,252,0,1,19,147,244,255,1,206,78,252,0,252,0,1,12,90,254,157,
+    1,168,217,254,255,1,240,191,254,157,1,145,116,254,98,1,75,26,247,0,1,29,157,254,255,1,216,88,254,0,1,49,
+    176,254,255,1,196,68,128,128,128,1,4,63,249,118,1,133,202,254,255,1,234,165,254,118,1,121,131,254,137,1,105,37,
+    1,10,137,239,255,1,206,78,252,0,128,247,0,1,29,157,254,255,1,216,88,247,0,128,247,0,1,13,72,254,118,1,
+    99,40,247,0,253,0,1,7,95,254,177,1,163,74,244,0,1,34,122,254,177,1,136,47,252,0,253,0,1,10,137,254,
+    255,1,235,108,244,0,1,49,176,254,255,1,196,68,252,0,0,29,254,59,1,64,132,254,196,1,185,117,254,59,1,52,
+    22,254,0,1,9,38,254,59,1,85,154,254,196,1,151,53,252,0,0,127,254,255,1,245,117,254,0,1,19,147,254,255,
+    1,225,98,254,0,1,39,166,254,255,1,206,78,247,0,128,128,128,0,88,254,177,1,173,123,254,78,1,86,135,254,177,
+    1,165,116,254,78,1,93,143,254,177,1,143,54,247,0,253,0,1,10,137,254,255,1,235,108,254,0,1,29,157,254,255,
+    1,216,88,242,0,128,253,0,1,1,21,254,39,1,36,16,254,0,1,29,157,254,255,1,216,88,254,0,1,41,149,254,
+    216,1,166,58,252,0,243,0,1,29,157,254,255,1,216,88,254,0,1,49,176,254,255,1,196,68,252,0,248,0,1,7,
+    56,254,98,1,105,134,254,157,1,148,118,254,98,1,109,139,254,157,1,143,114,254,98,1,71,22,248,0,1,19,147,254,
+    255,1,225,98,254,0,1,39,166,254,255,1,206,78,254,0,1,59,186,254,255,1,186,59,128,128,128,253,0,1,4,63,
+    254,118,1,119,129,254,137,1,121,53,254,0,1,21,89,254,137,1,133,124,254,118,1,122,132,254,137,1,100,31,253,0,
+    1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,252,0,128,252,0,1,13,102,249,177,1,149,61,242,
+    0,252,0,1,19,147,249,255,1,216,88,242,0,1,2,32,254,59,1,69,138,249,196,1,175,106,254,59,1,47,18,247,
+    0,1,10,137,254,255,1,235,108,249,0,1,39,166,254,255,1,206,78,247,0,128,128,128,1,7,95,254,177,1,169,119,
+    249,78,1,93,143,254,177,1,143,54,254,0,1,18,57,254,78,1,57,18,252,0,1,19,147,249,255,1,216,88,249,0,
+    1,59,186,254,255,1,186,59,128,1,8,116,254,216,1,202,114,249,39,1,66,155,254,216,1,174,66,254,0,1,59,186,
+    254,255,1,186,59,1,10,137,254,255,1,235,108,249,0,1,39,166,254,255,1,206,78,254,0,1,59,186,254,255,1,186,
+    59,1,10,137,254,255,1,235,108,249,0,1,24,102,254,157,1,145,116,254,98,1,111,141,254,157,1,114,36,1,10,137,
+    254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,252,0,128,128,128,1,5,74,254,137,1,135,126,244,118,1,121,
+    131,254,137,1,132,123,254,118,1,86,27,252,0,1,19,147,244,255,1,206,78,254,0,1,59,186,254,255,1,186,59,128,
+    1,4,24,254,39,1,33,13,1,29,157,254,255,1,216,88,128,128,128,128,128,128,1,7,36,254,59,1,50,20,247,0,
+    1,6,25,254,39,1,31,12,247,0,1,39,166,254,255,1,206,78,128,252,0,1,20,109,254,177,1,161,112,254,78,1,
+    63,24,252,0,1,29,157,254,255,1,216,88,252,0,128,128,128,1,15,113,254,196,1,180,111,254,59,1,50,20,252,0,
+    1,19,147,254,255,1,225,98,247,0,128,128,128,128,128,128,128,128,128,128,1,10,79,254,137,1,135,125,254,118,1,99,
+    40,252,0,252,0,1,29,157,254,255,1,216,88,252,0,128,128,128,252,0,1,13,72,254,118,1,121,130,254,137,1,110,
+    42,247,0,1,39,166,254,255,1,206,78,247,0,1,36,153,254,235,1,190,72,1,3,22,254,39,1,34,15,247,0,1,
+    19,147,254,255,1,225,98,247,0,128,1,6,45,254,78,1,89,139,254,177,1,149,61,252,0,252,0,1,29,157,254,255,
+    1,216,88,252,0,128,128,128,252,0,1,7,36,254,59,1,80,148,254,196,1,158,60,247,0,1,39,166,254,255,1,206,
+    78,128,128,128,128,128,128,128,128,128,128,252,0,1,13,72,254,118,1,121,130,254,137,1,110,42,252,0,1,29,157,254,
+    255,1,216,88,252,0,128,128,128,1,10,79,254,137,1,135,125,254,118,1,99,40,252,0,1,19,147,254,255,1,225,98,
+    247,0,1,18,135,254,235,1,208,90,247,0,247,0,1,22,120,254,196,1,166,68,247,0,247,0,1,29,157,254,255,1,
+    216,88,247,0,1,3,42,254,78,1,72,33,254,0,1,29,157,254,255,1,216,88,254,0,1,15,54,254,78,1,60,21,
+    1,10,137,254,255,1,235,108,254,0,1,29,157,254,255,1,216,88,254,0,1,49,176,254,255,1,196,68,128,1,1,21,
+    254,39,1,52,141,254,216,1,220,240,254,255,1,249,229,254,216,1,182,93,254,39,1,30,10,252,0,1,19,147,244,255,
+    1,206,78,252,0,1,4,53,254,98,1,102,132,254,157,1,168,217,254,255,1,240,191,254,157,1,145,116,254,98,1,75,
+    26,1,10,137,254,255,1,235,108,254,0,1,29,157,254,255,1,216,88,254,0,1,49,176,254,255,1,196,68,128,1,1,
+    11,254,20,1,18,8,254,0,1,29,157,254,255,1,216,88,254,0,1,4,14,254,20,1,15,5,247,0,1,29,157,254,
+    255,1,216,88,247,0,247,0,1,16,84,254,137,1,116,47,247,0,247,0,1,22,120,254,196,1,166,68,247,0,247,0,
+    1,29,157,254,255,1,216,88,247,0,128,128,128,1,8,116,249,216,1,220,240,254,255,1,249,229,249,216,1,166,58,1,
+    10,137,234,255,1,196,68,1,6,84,249,157,1,168,217,254,255,1,240,191,249,157,1,120,42,247,0,1,29,157,254,255,
+    1,216,88,247,0,128,128,128,247,0,1,16,84,254,137,1,116,47,247,0,252,0,1,18,135,254,235,1,208,90,252,0,
+    1,19,147,254,255,1,225,98,128,128,128,128,128,1,5,74,254,137,1,135,126,254,118,1,104,45,1,10,137,254,255,1,
+    235,108,252,0,1,9,126,254,235,1,217,99,252,0,1,8,116,234,216,1,166,58,1,10,137,234,255,1,196,68,1,6,
+    84,234,157,1,120,42,1,18,135,254,235,1,208,90,1,19,147,254,255,1,225,98,128,128,128,237,0,1,7,27,254,39,
+    1,30,10,237,0,1,49,176,254,255,1,196,68,128,128,128,242,0,1,9,38,254,59,1,85,154,254,196,1,151,53,242,
+    0,1,39,166,254,255,1,206,78,252,0,128,128,128,247,0,1,9,48,254,78,1,93,143,254,177,1,143,54,252,0,247,
+    0,1,29,157,254,255,1,216,88,247,0,128,128,128,252,0,1,7,56,254,98,1,105,134,254,157,1,133,54,247,0,252,
+    0,1,19,147,254,255,1,225,98,242,0,128,128,128,1,4,63,254,118,1,119,129,254,137,1,121,53,242,0,1,10,137,
+    254,255,1,235,108,237,0,128,128,128,1,4,63,254,118,1,109,50,237,0,252,0,1,13,102,244,177,1,143,54,252,0,
+    252,0,1,19,147,244,255,1,206,78,252,0,1,2,32,254,59,1,69,138,244,196,1,169,101,254,59,1,45,16,1,10,
+    137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,128,128,1,10,137,254,255,1,235,108,254,0,1,9,48,
+    254,78,1,66,27,254,0,1,49,176,254,255,1,196,68,1,10,137,254,255,1,235,108,254,0,1,29,157,254,255,1,216,
+    88,254,0,1,49,176,254,255,1,196,68,128,128,128,1,10,137,254,255,1,235,108,254,0,1,18,96,254,157,1,133,54,
+    254,0,1,49,176,254,255,1,196,68,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,128,128,1,
+    5,74,254,137,1,135,126,244,118,1,121,131,254,137,1,105,37,252,0,1,19,147,244,255,1,206,78,252,0,128,247,0,
+    1,20,109,254,177,1,149,61,247,0,247,0,1,29,157,254,255,1,216,88,247,0,252,0,1,4,34,254,59,1,81,179,
+    254,255,1,216,88,247,0,252,0,1,19,147,249,255,1,216,88,247,0,128,1,7,105,254,196,1,185,117,254,59,1,81,
+    179,254,255,1,216,88,247,0,1,10,137,254,255,1,235,108,254,0,1,29,157,254,255,1,216,88,247,0,1,7,95,254,
+    177,1,163,74,254,0,1,29,157,254,255,1,216,88,247,0,247,0,1,29,157,254,255,1,216,88,247,0,128,128,128,128,
+    128,128,128,128,1,4,63,249,118,1,133,202,254,255,1,234,165,249,118,1,90,31,1,10,137,234,255,1,196,68,128,252,
+    0,1,13,102,244,177,1,143,54,252,0,252,0,1,19,147,244,255,1,206,78,252,0,1,2,32,254,59,1,69,138,244,
+    196,1,169,101,254,59,1,45,16,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,1,2,32,254,
+    59,1,54,25,244,0,1,49,176,254,255,1,196,68,237,0,1,49,176,254,255,1,196,68,242,0,1,12,51,254,78,1,
+    97,146,254,177,1,136,47,242,0,1,39,166,254,255,1,206,78,252,0,128,247,0,1,25,133,254,216,1,188,100,254,39,
+    1,31,12,252,0,247,0,1,29,157,254,255,1,216,88,247,0,252,0,1,7,56,254,98,1,105,134,254,157,1,133,54,
+    247,0,252,0,1,19,147,254,255,1,225,98,242,0,128,1,9,126,254,235,1,218,111,254,20,1,17,7,242,0,1,10,
+    137,254,255,1,235,108,237,0,1,10,137,254,255,1,244,176,239,118,1,90,31,1,10,137,234,255,1,196,68,128,252,0,
+    1,13,102,244,177,1,143,54,252,0,252,0,1,19,147,244,255,1,206,78,252,0,1,2,32,254,59,1,69,138,244,196,
+    1,169,101,254,59,1,45,16,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,1,2,32,254,59,
+    1,54,25,244,0,1,49,176,254,255,1,196,68,237,0,1,49,176,254,255,1,196,68,247,0,1,9,48,249,78,1,97,
+    146,254,177,1,136,47,247,0,1,29,157,249,255,1,206,78,252,0,128,247,0,1,4,24,249,39,1,73,161,254,216,1,
+    166,58,237,0,1,49,176,254,255,1,196,68,128,128,128,1,9,126,254,235,1,217,99,244,0,1,49,176,254,255,1,196,
+    68,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,1,5,74,254,137,1,135,126,244,118,1,121,131,
+    254,137,1,105,37,252,0,1,19,147,244,255,1,206,78,252,0,128,237,0,1,34,122,254,177,1,136,47,252,0,237,0,
+    1,49,176,254,255,1,196,68,252,0,242,0,1,9,38,254,59,1,96,194,254,255,1,196,68,252,0,242,0,1,39,166,
+    249,255,1,196,68,252,0,128,247,0,1,22,120,254,196,1,175,106,254,59,1,96,194,254,255,1,196,68,252,0,247,0,
+    1,29,157,254,255,1,216,88,254,0,1,49,176,254,255,1,196,68,252,0,252,0,1,6,45,254,78,1,89,139,254,177,
+    1,149,61,254,0,1,49,176,254,255,1,196,68,252,0,252,0,1,19,147,254,255,1,225,98,249,0,1,49,176,254,255,
+    1,196,68,252,0,128,1,8,116,254,216,1,202,114,254,39,1,34,15,249,0,1,49,176,254,255,1,196,68,252,0,1,
+    10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,252,0,1,10,137,254,255,1,243,164,244,98,1,128,206,
+    254,255,1,219,140,254,98,1,71,22,1,10,137,229,255,1,186,59,128,1,1,11,239,20,1,65,182,254,255,1,200,83,
+    254,20,1,14,4,237,0,1,49,176,254,255,1,196,68,252,0,128,128,128,1,7,95,234,177,1,136,47,1,10,137,234,
+    255,1,196,68,1,10,137,254,255,1,250,221,239,196,1,151,53,1,10,137,254,255,1,235,108,237,0,128,128,128,1,10,
+    137,254,255,1,241,153,244,78,1,63,24,252,0,1,10,137,239,255,1,206,78,252,0,128,1,1,21,239,39,1,73,161,
+    254,216,1,166,58,237,0,1,49,176,254,255,1,196,68,128,128,128,1,9,126,254,235,1,217,99,244,0,1,49,176,254,
+    255,1,196,68,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,1,5,74,254,137,1,135,126,244,118,
+    1,121,131,254,137,1,105,37,252,0,1,19,147,244,255,1,206,78,252,0,128,247,0,1,20,109,249,177,1,143,54,252,
+    0,247,0,1,29,157,249,255,1,206,78,252,0,252,0,1,4,34,254,59,1,75,143,249,196,1,158,60,252,0,252,0,
+    1,19,147,254,255,1,225,98,242,0,128,1,7,105,254,196,1,185,117,254,59,1,52,22,242,0,1,10,137,254,255,1,
+    235,108,237,0,1,10,137,254,255,1,241,153,244,78,1,63,24,252,0,1,10,137,239,255,1,206,78,252,0,128,1,10,
+    137,254,255,1,238,130,244,39,1,73,161,254,216,1,166,58,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,
+    196,68,128,128,128,128,128,1,5,74,254,137,1,135,126,244,118,1,121,131,254,137,1,105,37,252,0,1,19,147,244,255,
+    1,206,78,252,0,128,1,7,95,234,177,1,136,47,1,10,137,234,255,1,196,68,1,7,105,239,196,1,207,237,254,255,
+    1,196,68,237,0,1,49,176,254,255,1,196,68,128,242,0,1,30,128,254,196,1,169,101,254,59,1,45,16,242,0,1,
+    39,166,254,255,1,206,78,252,0,128,128,128,247,0,1,25,133,254,216,1,188,100,254,39,1,31,12,252,0,247,0,1,
+    29,157,254,255,1,216,88,247,0,128,128,128,252,0,1,18,135,254,235,1,210,103,254,20,1,17,7,247,0,252,0,1,
+    19,147,254,255,1,225,98,242,0,128,128,128,252,0,1,13,102,244,177,1,143,54,252,0,252,0,1,19,147,244,255,1,
+    206,78,252,0,1,2,32,254,59,1,69,138,244,196,1,169,101,254,59,1,45,16,1,10,137,254,255,1,235,108,244,0,
+    1,49,176,254,255,1,196,68,128,128,128,1,7,95,254,177,1,169,119,244,78,1,97,146,254,177,1,136,47,252,0,1,
+    19,147,244,255,1,206,78,252,0,128,1,8,116,254,216,1,202,114,244,39,1,73,161,254,216,1,166,58,1,10,137,254,
+    255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,128,128,128,128,1,5,74,254,137,1,135,126,244,118,1,121,131,
+    254,137,1,105,37,252,0,1,19,147,244,255,1,206,78,252,0,128,252,0,1,13,102,244,177,1,143,54,252,0,252,0,
+    1,19,147,244,255,1,206,78,252,0,1,2,32,254,59,1,69,138,244,196,1,169,101,254,59,1,45,16,1,10,137,254,
+    255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,128,128,128,128,128,1,1,21,254,39,1,52,141,244,216,1,223,
+    243,254,255,1,196,68,252,0,1,19,147,239,255,1,196,68,252,0,1,12,90,244,157,1,176,225,254,255,1,196,68,237,
+    0,1,49,176,254,255,1,196,68,128,242,0,1,36,153,254,235,1,193,86,254,20,1,15,5,242,0,1,39,166,254,255,
+    1,206,78,252,0,252,0,1,9,68,249,118,1,121,130,254,137,1,110,42,252,0,252,0,1,19,147,249,255,1,216,88,
+    247,0,128,1,22,120,254,196,1,166,68,1,29,157,254,255,1,216,88,128,128,128,1,4,24,254,39,1,33,13,250,0,
+    128,128,128,1,27,144,254,235,1,199,81,1,29,157,254,255,1,216,88,128,128,128,252,0,1,15,113,254,196,1,173,75,
+    252,0,1,19,147,254,255,1,225,98,128,128,128,252,0,1,3,22,254,39,1,34,15,245,0,128,128,128,252,0,1,18,
+    135,254,235,1,208,90,252,0,1,19,147,254,255,1,225,98,128,128,128,128,128,1,5,74,254,137,1,135,126,254,118,1,
+    104,45,1,10,137,254,255,1,235,108,252,0,1,9,126,254,235,1,217,99,252,0,238,0,1,30,128,249,196,1,151,53,
+    238,0,1,39,166,249,255,1,196,68,248,0,1,6,45,249,78,1,93,143,249,177,1,136,47,248,0,1,19,147,249,255,
+    1,216,88,247,0,128,0,108,249,216,1,202,114,249,39,1,33,13,247,0,0,127,249,255,1,235,108,237,0,0,78,249,
+    157,1,152,123,249,98,1,83,34,247,0,248,0,1,19,147,249,255,1,216,88,247,0,128,248,0,1,1,11,249,20,1,
+    53,160,249,235,1,181,63,238,0,1,39,166,249,255,1,196,68,238,0,1,21,89,249,137,1,105,37,1,3,42,229,78,
+    1,57,18,1,10,137,229,255,1,186,59,128,1,1,21,229,39,1,28,9,225,0,1,4,53,229,98,1,71,22,1,10,
+    137,229,255,1,186,59,128,1,1,11,229,20,1,14,4,1,7,105,249,196,1,173,75,237,0,1,10,137,249,255,1,225,
+    98,237,0,1,7,95,249,177,1,165,116,249,78,1,63,24,247,0,247,0,1,29,157,249,255,1,206,78,247,0,128,247,
+    0,1,4,24,249,39,1,73,161,249,216,1,158,50,237,0,1,49,176,249,255,1,186,59,247,0,1,11,60,249,98,1,
+    109,139,249,157,1,114,36,247,0,1,29,157,249,255,1,206,78,247,0,128,1,9,126,249,235,1,210,103,249,20,1,16,
+    6,247,0,1,10,137,249,255,1,225,98,237,0,1,5,74,249,137,1,121,53,237,0,252,0,1,13,102,244,177,1,143,
+    54,252,0,252,0,1,19,147,244,255,1,206,78,252,0,1,2,32,254,59,1,69,138,244,196,1,169,101,254,59,1,45,
+    16,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,1,2,32,254,59,1,54,25,244,0,1,49,
+    176,254,255,1,196,68,237,0,1,49,176,254,255,1,196,68,242,0,1,12,51,254,78,1,97,146,254,177,1,136,47,242,
+    0,1,39,166,254,255,1,206,78,252,0,128,247,0,1,25,133,254,216,1,188,100,254,39,1,31,12,252,0,247,0,1,
+    29,157,254,255,1,216,88,247,0,128,128,128,247,0,1,2,12,254,20,1,17,7,247,0,230,0,247,0,1,13,72,254,
+    118,1,99,40,247,0,247,0,1,29,157,254,255,1,216,88,247,0,128,248,0,1,13,102,244,177,1,143,54,247,0,248,
+    0,1,19,147,244,255,1,206,78,247,0,253,0,1,2,32,254,59,1,69,138,244,196,1,169,101,254,59,1,45,16,252,
+    0,253,0,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,252,0,128,0,98,254,196,1,191,122,254,
+    59,1,54,25,254,0,1,22,120,249,196,1,169,101,254,59,1,90,159,254,196,1,143,45,0,127,254,255,1,245,117,249,
+    0,1,29,157,249,255,1,206,78,254,0,1,59,186,254,255,1,186,59,0,127,254,255,1,245,117,254,0,1,6,45,254,
+    78,1,89,139,254,177,1,189,228,254,255,1,206,78,254,0,1,59,186,254,255,1,186,59,0,127,254,255,1,245,117,254,
+    0,1,19,147,254,255,1,225,98,254,0,1,39,166,254,255,1,206,78,254,0,1,59,186,254,255,1,186,59,128,128,128,
+    0,127,254,255,1,245,117,254,0,1,12,90,254,157,1,150,120,254,98,1,122,200,254,255,1,225,146,254,98,1,111,141,
+    254,157,1,114,36,0,127,254,255,1,245,117,249,0,1,29,157,244,255,1,196,68,252,0,128,0,10,254,20,1,28,135,
+    254,235,1,217,99,254,0,1,2,12,244,20,1,15,5,252,0,253,0,1,10,137,254,255,1,235,108,232,0,253,0,1,
+    5,74,254,137,1,135,126,239,118,1,90,31,252,0,248,0,1,19,147,239,255,1,196,68,252,0,128,247,0,1,20,109,
+    249,177,1,143,54,247,0,247,0,1,29,157,249,255,1,206,78,247,0,128,128,128,252,0,1,15,113,254,196,1,180,111,
+    249,59,1,85,154,254,196,1,151,53,252,0,252,0,1,19,147,254,255,1,225,98,249,0,1,49,176,254,255,1,196,68,
+    252,0,128,128,128,252,0,1,19,147,254,255,1,250,231,249,216,1,223,243,254,255,1,196,68,252,0,252,0,1,19,147,
+    239,255,1,196,68,252,0,1,4,53,254,98,1,102,132,239,157,1,143,114,254,98,1,71,22,1,10,137,254,255,1,235,
+    108,239,0,1,59,186,254,255,1,186,59,128,128,128,128,128,128,1,7,95,239,177,1,143,54,247,0,1,10,137,239,255,
+    1,206,78,247,0,1,10,137,254,255,1,250,221,244,196,1,169,101,254,59,1,45,16,252,0,1,10,137,254,255,1,235,
+    108,244,0,1,49,176,254,255,1,196,68,252,0,128,128,128,1,10,137,254,255,1,241,153,244,78,1,112,200,254,255,1,
+    196,68,252,0,1,10,137,234,255,1,196,68,252,0,128,1,10,137,254,255,1,238,130,239,39,1,80,168,254,216,1,158,
+    50,1,10,137,254,255,1,235,108,239,0,1,59,186,254,255,1,186,59,128,128,128,128,128,1,10,137,254,255,1,244,176,
+    239,118,1,122,132,254,137,1,100,31,1,10,137,234,255,1,196,68,252,0,128,247,0,1,20,109,244,177,1,136,47,252,
+    0,247,0,1,29,157,244,255,1,196,68,252,0,252,0,1,4,34,254,59,1,75,143,244,196,1,164,96,254,59,1,43,
+    13,252,0,1,19,147,254,255,1,225,98,244,0,1,59,186,254,255,1,186,59,128,1,7,105,254,196,1,185,117,254,59,
+    1,52,22,244,0,1,13,43,254,59,1,43,13,1,10,137,254,255,1,235,108,232,0,128,128,128,128,128,128,128,128,1,
+    1,11,254,20,1,36,144,254,235,1,208,90,244,0,1,54,172,254,235,1,172,54,252,0,1,19,147,254,255,1,225,98,
+    244,0,1,59,186,254,255,1,186,59,252,0,1,10,79,254,137,1,135,125,244,118,1,122,132,254,137,1,100,31,247,0,
+    1,29,157,244,255,1,196,68,252,0,128,1,7,95,234,177,1,136,47,1,10,137,234,255,1,196,68,1,10,137,254,255,
+    1,250,221,239,196,1,151,53,1,10,137,254,255,1,235,108,237,0,128,128,128,1,10,137,254,255,1,241,153,244,78,1,
+    63,24,252,0,1,10,137,239,255,1,206,78,252,0,128,1,10,137,254,255,1,238,130,244,39,1,31,12,252,0,1,10,
+    137,254,255,1,235,108,237,0,128,128,128,128,128,1,10,137,254,255,1,244,176,239,118,1,90,31,1,10,137,234,255,1,
+    196,68,128,1,7,95,234,177,1,136,47,1,10,137,234,255,1,196,68,1,10,137,254,255,1,250,221,239,196,1,151,53,
+    1,10,137,254,255,1,235,108,237,0,128,128,128,1,10,137,254,255,1,241,153,244,78,1,63,24,252,0,1,10,137,239,
+    255,1,206,78,252,0,128,1,10,137,254,255,1,238,130,244,39,1,31,12,252,0,1,10,137,254,255,1,235,108,237,0,
+    128,128,128,128,128,128,128,128,247,0,1,20,109,244,177,1,136,47,252,0,247,0,1,29,157,244,255,1,196,68,252,0,
+    252,0,1,4,34,254,59,1,75,143,244,196,1,164,96,254,59,1,43,13,252,0,1,19,147,254,255,1,225,98,244,0,
+    1,59,186,254,255,1,186,59,128,1,7,105,254,196,1,185,117,254,59,1,52,22,244,0,1,13,43,254,59,1,43,13,
+    1,10,137,254,255,1,235,108,232,0,128,128,128,1,10,137,254,255,1,235,108,249,0,1,33,141,244,216,1,158,50,1,
+    10,137,254,255,1,235,108,249,0,1,39,166,244,255,1,186,59,1,10,137,254,255,1,235,108,249,0,1,24,102,249,157,
+    1,179,228,254,255,1,186,59,1,10,137,254,255,1,235,108,239,0,1,59,186,254,255,1,186,59,128,1,1,11,254,20,
+    1,36,144,254,235,1,208,90,244,0,1,59,186,254,255,1,186,59,252,0,1,19,147,254,255,1,225,98,244,0,1,59,
+    186,254,255,1,186,59,252,0,1,10,79,254,137,1,135,125,244,118,1,122,132,254,137,1,100,31,247,0,1,29,157,244,
+    255,1,196,68,252,0,128,1,7,95,254,177,1,163,74,239,0,1,40,129,254,177,1,129,40,1,10,137,254,255,1,235,
+    108,239,0,1,59,186,254,255,1,186,59,128,128,128,128,128,1,10,137,254,255,1,241,153,239,78,1,119,207,254,255,1,
+    186,59,1,10,137,229,255,1,186,59,128,1,10,137,254,255,1,238,130,239,39,1,89,197,254,255,1,186,59,1,10,137,
+    254,255,1,235,108,239,0,1,59,186,254,255,1,186,59,128,128,128,128,128,128,128,128,1,13,102,244,177,1,143,54,1,
+    19,147,244,255,1,206,78,1,15,113,254,196,1,203,232,254,255,1,246,216,254,196,1,158,60,252,0,1,29,157,254,255,
+    1,216,88,252,0,128,128,128,128,128,128,128,128,128,128,128,128,128,1,9,68,254,118,1,133,202,254,255,1,234,165,254,
+    118,1,95,36,1,19,147,244,255,1,206,78,128,252,0,1,13,102,244,177,1,143,54,252,0,1,19,147,244,255,1,206,
+    78,252,0,1,15,113,249,196,1,205,234,254,255,1,206,78,242,0,1,39,166,254,255,1,206,78,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,1,4,63,244,118,1,121,130,254,137,1,110,42,1,10,137,244,255,1,216,88,252,0,128,1,
+    7,95,254,177,1,163,74,239,0,1,40,129,254,177,1,129,40,1,10,137,254,255,1,235,108,239,0,1,59,186,254,255,
+    1,186,59,1,10,137,254,255,1,235,108,244,0,1,11,41,254,59,1,90,159,254,196,1,143,45,1,10,137,254,255,1,
+    235,108,244,0,1,49,176,254,255,1,196,68,252,0,128,1,10,137,254,255,1,235,108,249,0,1,30,128,254,196,1,169,
+    101,254,59,1,45,16,252,0,1,10,137,254,255,1,235,108,249,0,1,39,166,254,255,1,206,78,247,0,1,10,137,254,
+    255,1,235,108,254,0,1,9,48,254,78,1,93,143,254,177,1,143,54,247,0,1,10,137,254,255,1,235,108,254,0,1,
+    29,157,254,255,1,216,88,242,0,128,1,10,137,254,255,1,252,232,254,216,1,220,240,254,255,1,216,88,242,0,1,10,
+    137,244,255,1,216,88,242,0,1,10,137,254,255,1,247,198,249,157,1,148,118,254,98,1,79,30,247,0,1,10,137,254,
+    255,1,235,108,249,0,1,39,166,254,255,1,206,78,247,0,128,1,10,137,254,255,1,235,108,249,0,1,3,13,254,20,
+    1,61,169,254,235,1,181,63,252,0,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,252,0,1,10,
+    137,254,255,1,235,108,244,0,1,26,95,254,137,1,132,123,254,118,1,86,27,1,10,137,254,255,1,235,108,239,0,1,
+    59,186,254,255,1,186,59,128,1,7,95,254,177,1,163,74,237,0,1,10,137,254,255,1,235,108,237,0,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,1,10,137,254,255,1,244,176,239,118,1,90,31,1,10,137,234,255,1,196,68,
+    128,0,88,249,177,1,163,74,244,0,1,34,122,249,177,1,129,40,0,127,249,255,1,235,108,244,0,1,49,176,249,255,
+    1,186,59,128,128,128,0,127,254,255,1,247,149,254,59,1,69,138,254,196,1,173,75,254,0,1,30,128,254,196,1,169,
+    101,254,59,1,104,202,254,255,1,186,59,0,127,254,255,1,245,117,254,0,1,19,147,254,255,1,225,98,254,0,1,39,
+    166,254,255,1,206,78,254,0,1,59,186,254,255,1,186,59,128,128,128,0,127,254,255,1,245,117,254,0,1,3,22,254,
+    39,1,59,148,254,216,1,188,100,254,39,1,31,12,254,0,1,59,186,254,255,1,186,59,0,127,254,255,1,245,117,249,
+    0,1,29,157,254,255,1,216,88,249,0,1,59,186,254,255,1,186,59,128,128,128,0,127,254,255,1,245,117,249,0,1,
+    2,12,254,20,1,17,7,249,0,1,59,186,254,255,1,186,59,0,127,254,255,1,245,117,234,0,1,59,186,254,255,1,
+    186,59,128,128,128,1,7,95,249,177,1,156,68,244,0,1,40,129,254,177,1,129,40,1,10,137,249,255,1,225,98,244,
+    0,1,59,186,254,255,1,186,59,128,128,128,1,10,137,254,255,1,240,142,254,59,1,75,143,254,196,1,166,68,249,0,
+    1,59,186,254,255,1,186,59,1,10,137,254,255,1,235,108,254,0,1,29,157,254,255,1,216,88,249,0,1,59,186,254,
+    255,1,186,59,128,128,128,1,10,137,254,255,1,235,108,254,0,1,4,24,254,39,1,66,155,254,216,1,174,66,254,0,
+    1,59,186,254,255,1,186,59,1,10,137,254,255,1,235,108,249,0,1,39,166,254,255,1,206,78,254,0,1,59,186,254,
+    255,1,186,59,128,128,128,1,10,137,254,255,1,235,108,249,0,1,3,13,254,20,1,61,169,254,235,1,239,249,254,255,
+    1,186,59,1,10,137,254,255,1,235,108,244,0,1,49,176,249,255,1,186,59,128,128,128,247,0,1,20,109,249,177,1,
+    143,54,247,0,247,0,1,29,157,249,255,1,206,78,247,0,252,0,1,4,34,254,59,1,75,143,249,196,1,169,101,254,
+    59,1,45,16,252,0,252,0,1,19,147,254,255,1,225,98,249,0,1,49,176,254,255,1,196,68,252,0,128,1,7,105,
+    254,196,1,185,117,254,59,1,52,22,249,0,1,11,41,254,59,1,90,159,254,196,1,143,45,1,10,137,254,255,1,235,
+    108,239,0,1,59,186,254,255,1,186,59,128,128,128,128,128,128,128,128,1,1,11,254,20,1,36,144,254,235,1,208,90,
+    249,0,1,45,163,254,235,1,185,78,254,20,1,14,4,252,0,1,19,147,254,255,1,225,98,249,0,1,49,176,254,255,
+    1,196,68,252,0,252,0,1,10,79,254,137,1,135,125,249,118,1,121,131,254,137,1,105,37,252,0,247,0,1,29,157,
+    249,255,1,206,78,247,0,128,1,7,95,239,177,1,143,54,252,0,1,10,137,239,255,1,206,78,252,0,1,10,137,254,
+    255,1,250,221,244,196,1,169,101,254,59,1,45,16,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,
+    128,128,128,128,128,128,1,10,137,254,255,1,252,232,244,216,1,182,93,254,39,1,30,10,1,10,137,239,255,1,206,78,
+    252,0,1,10,137,254,255,1,247,198,244,157,1,127,48,252,0,1,10,137,254,255,1,235,108,237,0,128,128,128,128,128,
+    128,247,0,1,20,109,249,177,1,143,54,247,0,247,0,1,29,157,249,255,1,206,78,247,0,252,0,1,4,34,254,59,
+    1,75,143,249,196,1,169,101,254,59,1,45,16,252,0,252,0,1,19,147,254,255,1,225,98,249,0,1,49,176,254,255,
+    1,196,68,252,0,128,1,7,105,254,196,1,185,117,254,59,1,52,22,249,0,1,11,41,254,59,1,90,159,254,196,1,
+    143,45,1,10,137,254,255,1,235,108,239,0,1,59,186,254,255,1,186,59,128,128,128,128,128,128,128,128,1,1,11,254,
+    20,1,36,144,254,235,1,208,90,249,0,1,45,163,254,235,1,185,78,254,20,1,14,4,252,0,1,19,147,254,255,1,
+    225,98,249,0,1,49,176,254,255,1,196,68,252,0,252,0,1,10,79,254,137,1,135,125,249,118,1,121,131,254,137,1,
+    132,123,254,118,1,86,27,247,0,1,29,157,249,255,1,206,78,254,0,1,59,186,254,255,1,186,59,128,232,0,1,59,
+    186,254,255,1,186,59,128,232,0,1,27,86,254,118,1,86,27,1,7,95,239,177,1,143,54,247,0,1,10,137,239,255,
+    1,206,78,247,0,1,10,137,254,255,1,250,221,244,196,1,169,101,254,59,1,45,16,252,0,1,10,137,254,255,1,235,
+    108,244,0,1,49,176,254,255,1,196,68,252,0,128,128,128,128,128,128,1,10,137,254,255,1,252,232,244,216,1,182,93,
+    254,39,1,30,10,252,0,1,10,137,239,255,1,206,78,247,0,1,10,137,254,255,1,247,198,249,157,1,172,221,254,255,
+    1,206,78,247,0,1,10,137,254,255,1,235,108,249,0,1,39,166,254,255,1,206,78,247,0,128,1,10,137,254,255,1,
+    235,108,249,0,1,3,13,254,20,1,61,169,254,235,1,181,63,252,0,1,10,137,254,255,1,235,108,244,0,1,49,176,
+    254,255,1,196,68,252,0,1,10,137,254,255,1,235,108,244,0,1,26,95,254,137,1,132,123,254,118,1,86,27,1,10,
+    137,254,255,1,235,108,239,0,1,59,186,254,255,1,186,59,128,252,0,1,13,102,239,177,1,136,47,252,0,252,0,1,
+    19,147,239,255,1,196,68,252,0,1,2,32,254,59,1,69,138,239,196,1,164,96,254,59,1,43,13,1,10,137,254,255,
+    1,235,108,239,0,1,59,186,254,255,1,186,59,128,1,10,137,254,255,1,235,108,239,0,1,13,43,254,59,1,43,13,
+    1,10,137,254,255,1,235,108,232,0,1,7,95,254,177,1,169,119,249,78,1,66,27,242,0,252,0,1,19,147,249,255,
+    1,216,88,242,0,128,252,0,1,3,22,249,39,1,66,155,249,216,1,166,58,252,0,242,0,1,39,166,249,255,1,196,
+    68,252,0,242,0,1,24,102,249,157,1,143,114,254,98,1,71,22,232,0,1,59,186,254,255,1,186,59,128,1,9,126,
+    254,235,1,217,99,239,0,1,59,186,254,255,1,186,59,1,10,137,254,255,1,235,108,239,0,1,59,186,254,255,1,186,
+    59,1,5,74,254,137,1,135,126,239,118,1,122,132,254,137,1,100,31,252,0,1,19,147,239,255,1,196,68,252,0,128,
+    0,88,224,177,1,129,40,0,127,224,255,1,186,59,0,98,244,196,1,203,232,254,255,1,246,216,244,196,1,143,45,243,
+    0,1,29,157,254,255,1,216,88,242,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,1,7,95,254,177,
+    1,163,74,239,0,1,40,129,254,177,1,129,40,1,10,137,254,255,1,235,108,239,0,1,59,186,254,255,1,186,59,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,1,5,74,254,137,1,135,126,239,118,1,122,132,254,137,1,100,31,
+    252,0,1,19,147,239,255,1,196,68,252,0,128,0,88,254,177,1,170,81,234,0,1,40,129,254,177,1,129,40,0,127,
+    254,255,1,245,117,234,0,1,59,186,254,255,1,186,59,128,128,128,0,29,254,59,1,64,132,254,196,1,181,83,244,0,
+    1,37,135,254,196,1,164,96,254,59,1,43,13,253,0,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,
+    68,252,0,128,128,128,253,0,1,1,21,254,39,1,52,141,254,216,1,191,83,254,0,1,33,141,254,216,1,182,93,254,
+    39,1,30,10,252,0,248,0,1,19,147,254,255,1,225,98,254,0,1,39,166,254,255,1,206,78,247,0,128,128,128,248,
+    0,1,1,11,254,20,1,44,152,254,235,1,202,94,254,20,1,16,6,247,0,243,0,1,29,157,254,255,1,216,88,242,
+    0,128,128,128,0,88,254,177,1,170,81,234,0,1,40,129,254,177,1,129,40,0,127,254,255,1,245,117,234,0,1,59,
+    186,254,255,1,186,59,0,127,254,255,1,245,117,249,0,1,7,36,254,59,1,50,20,249,0,1,59,186,254,255,1,186,
+    59,0,127,254,255,1,245,117,249,0,1,29,157,254,255,1,216,88,249,0,1,59,186,254,255,1,186,59,128,128,128,0,
+    127,254,255,1,245,117,254,0,1,6,45,254,78,1,89,139,254,177,1,161,112,254,78,1,63,24,254,0,1,59,186,254,
+    255,1,186,59,0,127,254,255,1,245,117,254,0,1,19,147,254,255,1,225,98,254,0,1,39,166,254,255,1,206,78,254,
+    0,1,59,186,254,255,1,186,59,128,128,128,0,78,254,157,1,154,125,254,98,1,110,188,254,255,1,225,98,254,0,1,
+    39,166,254,255,1,225,146,254,98,1,111,141,254,157,1,114,36,253,0,1,10,137,249,255,1,225,98,254,0,1,39,166,
+    249,255,1,196,68,252,0,128,253,0,1,10,137,254,255,1,237,119,254,20,1,17,7,254,0,1,3,13,254,20,1,65,
+    182,254,255,1,196,68,252,0,253,0,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,252,0,128,128,
+    128,1,7,95,254,177,1,163,74,239,0,1,40,129,254,177,1,129,40,1,10,137,254,255,1,235,108,239,0,1,59,186,
+    254,255,1,186,59,128,128,128,1,2,32,254,59,1,69,138,254,196,1,173,75,249,0,1,37,135,254,196,1,164,96,254,
+    59,1,43,13,252,0,1,19,147,254,255,1,225,98,249,0,1,49,176,254,255,1,196,68,252,0,252,0,1,13,102,254,
+    177,1,165,116,249,78,1,97,146,254,177,1,136,47,252,0,247,0,1,29,157,249,255,1,206,78,247,0,128,128,128,252,
+    0,1,7,56,254,98,1,105,134,249,157,1,145,116,254,98,1,75,26,252,0,252,0,1,19,147,254,255,1,225,98,249,
+    0,1,49,176,254,255,1,196,68,252,0,128,1,9,126,254,235,1,218,111,254,20,1,17,7,249,0,1,4,14,254,20,
+    1,69,177,254,235,1,172,54,1,10,137,254,255,1,235,108,239,0,1,59,186,254,255,1,186,59,128,128,128,0,88,254,
+    177,1,170,81,234,0,1,40,129,254,177,1,129,40,0,127,254,255,1,245,117,234,0,1,59,186,254,255,1,186,59,128,
+    128,128,0,29,254,59,1,64,132,254,196,1,181,83,244,0,1,37,135,254,196,1,164,96,254,59,1,43,13,253,0,1,
+    10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,252,0,253,0,1,7,95,254,177,1,169,119,254,78,1,
+    69,30,254,0,1,12,51,254,78,1,97,146,254,177,1,136,47,252,0,248,0,1,19,147,254,255,1,225,98,254,0,1,
+    39,166,254,255,1,206,78,247,0,128,248,0,1,3,22,254,39,1,59,148,254,216,1,188,100,254,39,1,31,12,247,0,
+    243,0,1,29,157,254,255,1,216,88,242,0,128,128,128,128,128,128,128,128,1,7,95,229,177,1,129,40,1,10,137,229,
+    255,1,186,59,1,7,105,234,196,1,209,239,254,255,1,186,59,232,0,1,59,186,254,255,1,186,59,128,237,0,1,37,
+    135,254,196,1,164,96,254,59,1,43,13,237,0,1,49,176,254,255,1,196,68,252,0,242,0,1,12,51,254,78,1,97,
+    146,254,177,1,136,47,252,0,242,0,1,39,166,254,255,1,206,78,247,0,128,247,0,1,25,133,254,216,1,188,100,254,
+    39,1,31,12,247,0,247,0,1,29,157,254,255,1,216,88,242,0,252,0,1,7,56,254,98,1,105,134,254,157,1,133,
+    54,242,0,252,0,1,19,147,254,255,1,225,98,237,0,128,1,9,126,254,235,1,218,111,254,20,1,17,7,237,0,1,
+    10,137,254,255,1,235,108,232,0,1,10,137,254,255,1,244,176,234,118,1,86,27,1,10,137,229,255,1,186,59,128,1,
+    3,22,244,39,1,31,12,1,19,147,244,255,1,206,78,128,1,19,147,254,255,1,234,146,249,78,1,63,24,1,19,147,
+    254,255,1,225,98,247,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,1,19,147,254,255,
+    1,241,182,249,137,1,110,42,1,19,147,244,255,1,206,78,1,18,135,244,235,1,190,72,1,1,21,254,39,1,36,16,
+    237,0,1,10,137,254,255,1,235,108,237,0,128,128,128,1,7,105,254,196,1,185,117,254,59,1,52,22,242,0,252,0,
+    1,19,147,254,255,1,225,98,242,0,128,128,128,252,0,1,13,102,254,177,1,165,116,254,78,1,66,27,247,0,247,0,
+    1,29,157,254,255,1,216,88,247,0,128,128,128,247,0,1,18,96,254,157,1,148,118,254,98,1,79,30,252,0,242,0,
+    1,39,166,254,255,1,206,78,252,0,128,128,128,242,0,1,21,89,254,137,1,133,124,254,118,1,90,31,237,0,1,49,
+    176,254,255,1,196,68,128,128,128,237,0,1,22,81,254,118,1,90,31,1,3,22,244,39,1,31,12,1,19,147,244,255,
+    1,206,78,128,1,6,45,249,78,1,105,194,254,255,1,206,78,247,0,1,39,166,254,255,1,206,78,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,1,10,79,249,137,1,155,214,254,255,1,206,78,1,19,147,244,
+    255,1,206,78,1,18,135,244,235,1,190,72,247,0,1,4,24,254,39,1,33,13,247,0,247,0,1,29,157,254,255,1,
+    216,88,247,0,128,128,128,252,0,1,4,34,254,59,1,75,143,254,196,1,175,106,254,59,1,47,18,252,0,252,0,1,
+    19,147,254,255,1,225,98,254,0,1,39,166,254,255,1,206,78,252,0,128,128,128,1,3,42,254,78,1,86,135,254,177,
+    1,156,68,254,0,1,27,115,254,177,1,158,108,254,78,1,60,21,1,10,137,254,255,1,235,108,244,0,1,49,176,254,
+    255,1,196,68,128,128,128,1,6,84,254,157,1,145,66,244,0,1,30,108,254,157,1,120,42,0,127,224,255,1,186,59,
+    128,0,59,224,118,1,86,27,1,3,22,254,39,1,34,15,252,0,1,19,147,254,255,1,225,98,252,0,128,1,6,45,
+    254,78,1,89,139,254,177,1,149,61,252,0,1,29,157,254,255,1,216,88,252,0,1,22,120,254,196,1,166,68,252,0,
+    1,15,113,244,196,1,158,60,252,0,252,0,1,19,147,244,255,1,206,78,252,0,252,0,1,13,102,244,177,1,158,108,
+    254,78,1,60,21,237,0,1,49,176,254,255,1,196,68,128,252,0,1,16,124,244,216,1,223,243,254,255,1,196,68,252,
+    0,1,19,147,239,255,1,196,68,1,4,53,254,98,1,102,132,244,157,1,176,225,254,255,1,196,68,1,10,137,254,255,
+    1,235,108,244,0,1,49,176,254,255,1,196,68,128,128,128,1,5,74,254,137,1,135,126,244,118,1,144,213,254,255,1,
+    196,68,252,0,1,19,147,239,255,1,196,68,128,252,0,1,15,113,244,196,1,158,60,252,0,252,0,1,19,147,244,255,
+    1,206,78,252,0,1,3,42,254,78,1,86,135,244,177,1,158,108,254,78,1,60,21,1,10,137,254,255,1,235,108,244,
+    0,1,49,176,254,255,1,196,68,128,1,10,137,254,255,1,235,108,244,0,1,7,27,254,39,1,30,10,1,10,137,254,
+    255,1,235,108,237,0,128,128,128,1,10,137,254,255,1,235,108,244,0,1,45,163,254,235,1,181,63,1,10,137,254,255,
+    1,235,108,244,0,1,49,176,254,255,1,196,68,1,5,74,254,137,1,135,126,244,118,1,121,131,254,137,1,105,37,252,
+    0,1,19,147,244,255,1,206,78,252,0,128,237,0,1,7,27,254,39,1,30,10,237,0,1,49,176,254,255,1,196,68,
+    128,128,128,128,128,128,252,0,1,15,113,244,196,1,207,237,254,255,1,196,68,252,0,1,19,147,239,255,1,196,68,1,
+    3,42,254,78,1,86,135,244,177,1,192,231,254,255,1,196,68,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,
+    1,196,68,128,128,128,128,128,128,128,128,1,5,74,254,137,1,135,126,244,118,1,144,213,254,255,1,196,68,252,0,1,
+    19,147,239,255,1,196,68,128,247,0,1,4,24,244,39,1,30,10,247,0,1,29,157,244,255,1,196,68,128,252,0,1,
+    13,102,254,177,1,165,116,244,78,1,60,21,252,0,1,19,147,254,255,1,225,98,242,0,128,128,128,1,7,105,254,196,
+    1,200,230,254,255,1,248,218,249,196,1,158,60,252,0,1,10,137,239,255,1,206,78,252,0,1,7,95,254,177,1,183,
+    222,254,255,1,246,207,249,177,1,143,54,252,0,252,0,1,19,147,254,255,1,225,98,242,0,128,128,128,128,128,128,128,
+    128,128,128,128,1,1,21,254,39,1,36,16,237,0,1,10,137,254,255,1,235,108,237,0,128,128,128,128,128,128,1,10,
+    137,254,255,1,250,221,244,196,1,158,60,252,0,1,10,137,239,255,1,206,78,252,0,1,10,137,254,255,1,249,210,244,
+    177,1,158,108,254,78,1,60,21,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,128,128,128,128,
+    128,128,128,128,128,128,252,0,1,4,24,254,39,1,33,13,252,0,1,29,157,254,255,1,216,88,128,252,0,1,9,48,
+    254,78,1,66,27,245,0,128,128,128,1,15,113,249,196,1,166,68,1,19,147,249,255,1,216,88,1,13,102,254,177,1,
+    186,225,254,255,1,216,88,252,0,1,29,157,254,255,1,216,88,128,128,128,128,128,128,128,128,128,128,128,242,0,1,6,
+    25,254,39,1,31,12,242,0,1,39,166,254,255,1,206,78,128,242,0,1,12,51,254,78,1,63,24,235,0,128,128,128,
+    247,0,1,22,120,249,196,1,158,60,247,0,1,29,157,249,255,1,206,78,247,0,1,20,109,254,177,1,189,228,254,255,
+    1,206,78,242,0,1,39,166,254,255,1,206,78,128,128,128,128,128,128,128,128,128,128,128,128,128,1,5,74,244,137,1,
+    134,124,254,118,1,95,36,1,10,137,244,255,1,216,88,252,0,1,9,126,244,235,1,199,81,252,0,1,1,21,254,39,
+    1,36,16,237,0,1,10,137,254,255,1,235,108,237,0,128,128,128,128,128,128,1,10,137,254,255,1,235,108,244,0,1,
+    37,135,254,196,1,151,53,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,1,10,137,254,255,1,235,
+    108,249,0,1,12,51,254,78,1,97,146,254,177,1,136,47,1,10,137,254,255,1,235,108,249,0,1,39,166,254,255,1,
+    206,78,252,0,128,1,10,137,254,255,1,235,108,254,0,1,25,133,254,216,1,188,100,254,39,1,31,12,252,0,1,10,
+    137,254,255,1,235,108,254,0,1,29,157,254,255,1,216,88,247,0,1,10,137,254,255,1,243,164,254,98,1,116,194,254,
+    255,1,216,88,247,0,1,10,137,244,255,1,216,88,247,0,128,1,10,137,254,255,1,237,119,249,20,1,53,160,254,235,
+    1,190,72,252,0,1,10,137,254,255,1,235,108,249,0,1,39,166,254,255,1,206,78,252,0,1,10,137,254,255,1,235,
+    108,249,0,1,21,89,254,137,1,133,124,254,118,1,90,31,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,
+    196,68,128,1,3,22,249,39,1,33,13,1,19,147,249,255,1,216,88,128,1,6,45,254,78,1,98,187,254,255,1,216,
+    88,252,0,1,29,157,254,255,1,216,88,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,98,244,
+    196,1,173,75,254,0,1,30,128,249,196,1,151,53,252,0,0,127,244,255,1,225,98,254,0,1,39,166,249,255,1,196,
+    68,252,0,0,127,254,255,1,252,213,249,177,1,165,116,254,78,1,93,143,249,177,1,154,104,254,78,1,57,18,0,127,
+    254,255,1,245,117,249,0,1,29,157,254,255,1,216,88,249,0,1,59,186,254,255,1,186,59,128,128,128,128,128,128,128,
+    128,128,128,128,1,7,105,239,196,1,158,60,252,0,1,10,137,239,255,1,206,78,252,0,1,10,137,254,255,1,249,210,
+    244,177,1,158,108,254,78,1,60,21,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,128,128,128,
+    128,128,128,128,128,128,128,252,0,1,15,113,244,196,1,158,60,252,0,252,0,1,19,147,244,255,1,206,78,252,0,1,
+    3,42,254,78,1,86,135,244,177,1,158,108,254,78,1,60,21,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,
+    1,196,68,128,128,128,128,128,128,128,128,1,5,74,254,137,1,135,126,244,118,1,121,131,254,137,1,105,37,252,0,1,
+    19,147,244,255,1,206,78,252,0,128,1,7,105,239,196,1,158,60,252,0,1,10,137,239,255,1,206,78,252,0,1,10,
+    137,254,255,1,249,210,244,177,1,158,108,254,78,1,60,21,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,
+    196,68,128,128,128,128,128,128,128,128,1,10,137,254,255,1,244,176,244,118,1,121,131,254,137,1,105,37,1,10,137,239,
+    255,1,206,78,252,0,128,1,10,137,254,255,1,235,108,237,0,128,128,128,128,128,128,1,4,53,254,98,1,90,41,237,
+    0,252,0,1,15,113,239,196,1,151,53,252,0,1,19,147,239,255,1,196,68,1,3,42,254,78,1,86,135,244,177,1,
+    192,231,254,255,1,196,68,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,128,128,128,128,128,128,
+    128,1,5,74,254,137,1,135,126,244,118,1,144,213,254,255,1,196,68,252,0,1,19,147,239,255,1,196,68,128,237,0,
+    1,49,176,254,255,1,196,68,128,128,128,128,128,128,237,0,1,19,68,254,98,1,75,26,1,7,105,254,196,1,181,83,
+    254,0,1,22,120,249,196,1,158,60,252,0,1,10,137,254,255,1,235,108,254,0,1,29,157,249,255,1,206,78,252,0,
+    1,10,137,254,255,1,241,153,254,78,1,89,139,249,177,1,158,108,254,78,1,60,21,1,10,137,249,255,1,225,98,249,
+    0,1,49,176,254,255,1,196,68,128,1,10,137,254,255,1,238,130,254,39,1,34,15,249,0,1,7,27,254,39,1,30,
+    10,1,10,137,254,255,1,235,108,237,0,128,128,128,128,128,128,128,128,252,0,1,15,113,239,196,1,151,53,252,0,1,
+    19,147,239,255,1,196,68,1,3,42,254,78,1,86,135,239,177,1,136,47,1,10,137,254,255,1,235,108,237,0,128,1,
+    1,21,254,39,1,52,141,249,216,1,182,74,247,0,252,0,1,19,147,249,255,1,216,88,247,0,252,0,1,12,90,249,
+    157,1,148,118,254,98,1,79,30,252,0,242,0,1,39,166,254,255,1,206,78,252,0,128,242,0,1,3,13,254,20,1,
+    61,169,254,235,1,181,63,237,0,1,49,176,254,255,1,196,68,1,4,63,239,118,1,121,131,254,137,1,105,37,1,10,
+    137,239,255,1,206,78,252,0,128,1,13,102,254,177,1,156,68,242,0,1,19,147,254,255,1,225,98,242,0,128,128,128,
+    1,19,147,254,255,1,248,218,244,196,1,151,53,1,19,147,239,255,1,196,68,1,19,147,254,255,1,246,207,244,177,1,
+    136,47,1,19,147,254,255,1,225,98,242,0,128,128,128,128,128,128,128,128,1,10,79,254,137,1,135,125,244,118,1,90,
+    31,252,0,1,29,157,244,255,1,196,68,128,1,7,105,254,196,1,181,83,244,0,1,37,135,254,196,1,151,53,1,10,
+    137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,128,128,1,1,21,254,39,1,52,141,254,216,1,191,83,
+    254,0,1,33,141,254,216,1,182,93,254,39,1,30,10,252,0,1,19,147,254,255,1,225,98,254,0,1,39,166,254,255,
+    1,206,78,252,0,128,128,128,252,0,1,1,11,254,20,1,44,152,254,235,1,202,94,254,20,1,16,6,252,0,247,0,
+    1,29,157,254,255,1,216,88,247,0,128,128,128,0,98,254,196,1,188,90,234,0,1,45,143,254,196,1,143,45,0,127,
+    254,255,1,245,117,234,0,1,59,186,254,255,1,186,59,0,127,254,255,1,245,117,249,0,1,9,48,254,78,1,66,27,
+    249,0,1,59,186,254,255,1,186,59,0,127,254,255,1,245,117,249,0,1,29,157,254,255,1,216,88,249,0,1,59,186,
+    254,255,1,186,59,128,128,128,0,127,254,255,1,245,117,254,0,1,7,56,254,98,1,105,134,254,157,1,148,118,254,98,
+    1,79,30,254,0,1,59,186,254,255,1,186,59,0,127,254,255,1,245,117,254,0,1,19,147,254,255,1,225,98,254,0,
+    1,39,166,254,255,1,206,78,254,0,1,59,186,254,255,1,186,59,128,0,10,254,20,1,28,135,254,235,1,236,246,254,
+    255,1,225,98,254,0,1,39,166,254,255,1,251,241,254,235,1,185,78,254,20,1,14,4,253,0,1,10,137,249,255,1,
+    225,98,254,0,1,39,166,249,255,1,196,68,252,0,253,0,1,10,137,254,255,1,246,187,254,137,1,121,53,254,0,1,
+    21,89,254,137,1,160,219,254,255,1,196,68,252,0,253,0,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,
+    196,68,252,0,128,1,7,105,254,196,1,181,83,244,0,1,37,135,254,196,1,151,53,1,10,137,254,255,1,235,108,244,
+    0,1,49,176,254,255,1,196,68,1,7,95,254,177,1,169,119,254,78,1,69,30,254,0,1,12,51,254,78,1,97,146,
+    254,177,1,136,47,252,0,1,19,147,254,255,1,225,98,254,0,1,39,166,254,255,1,206,78,252,0,128,252,0,1,3,
+    22,254,39,1,59,148,254,216,1,188,100,254,39,1,31,12,252,0,247,0,1,29,157,254,255,1,216,88,247,0,128,128,
+    128,252,0,1,18,135,254,235,1,210,103,254,20,1,53,160,254,235,1,190,72,252,0,252,0,1,19,147,254,255,1,225,
+    98,254,0,1,39,166,254,255,1,206,78,252,0,1,4,63,254,118,1,119,129,254,137,1,121,53,254,0,1,21,89,254,
+    137,1,133,124,254,118,1,90,31,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,128,1,7,105,254,
+    196,1,181,83,244,0,1,37,135,254,196,1,151,53,1,10,137,254,255,1,235,108,244,0,1,49,176,254,255,1,196,68,
+    128,128,128,128,128,128,128,128,128,128,1,5,74,254,137,1,135,126,244,118,1,144,213,254,255,1,196,68,252,0,1,19,
+    147,239,255,1,196,68,128,237,0,1,49,176,254,255,1,196,68,128,128,128,252,0,1,1,11,244,20,1,61,169,254,235,
+    1,181,63,252,0,1,19,147,244,255,1,206,78,252,0,128,252,0,1,7,56,244,98,1,79,30,252,0,1,7,105,234,
+    196,1,151,53,1,10,137,234,255,1,196,68,1,7,95,239,177,1,192,231,254,255,1,196,68,237,0,1,49,176,254,255,
+    1,196,68,128,242,0,1,33,141,254,216,1,182,93,254,39,1,30,10,242,0,1,39,166,254,255,1,206,78,252,0,247,
+    0,1,11,60,254,98,1,107,136,254,157,1,127,48,252,0,247,0,1,29,157,254,255,1,216,88,247,0,128,252,0,1,
+    18,135,254,235,1,210,103,254,20,1,17,7,247,0,252,0,1,19,147,254,255,1,225,98,242,0,1,4,63,254,118,1,
+    128,197,254,255,1,239,170,244,118,1,90,31,1,10,137,234,255,1,196,68,128,242,0,1,6,25,249,39,1,30,10,242,
+    0,1,39,166,249,255,1,196,68,128,247,0,1,20,109,254,177,1,161,112,249,78,1,60,21,247,0,1,29,157,254,255,
+    1,216,88,247,0,128,128,128,128,128,128,128,128,1,8,116,249,216,1,195,107,254,39,1,33,13,247,0,1,10,137,249,
+    255,1,225,98,242,0,1,6,84,249,157,1,150,120,254,98,1,83,34,247,0,247,0,1,29,157,254,255,1,216,88,247,
+    0,128,128,128,128,128,128,128,128,247,0,1,13,72,254,118,1,121,130,249,137,1,105,37,242,0,1,39,166,249,255,1,
+    196,68,242,0,1,36,153,249,235,1,181,63,1,4,24,254,39,1,33,13,1,29,157,254,255,1,216,88,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,1,27,144,254,235,1,199,81,1,1,21,
+    249,39,1,34,15,242,0,1,10,137,249,255,1,225,98,242,0,128,1,3,42,249,78,1,89,139,254,177,1,149,61,247,
+    0,247,0,1,29,157,254,255,1,216,88,247,0,128,128,128,128,128,128,128,128,247,0,1,4,24,254,39,1,66,155,249,
+    216,1,166,58,242,0,1,39,166,249,255,1,196,68,247,0,1,11,60,254,98,1,107,136,249,157,1,120,42,247,0,1,
+    29,157,254,255,1,216,88,247,0,128,128,128,128,128,128,128,128,1,5,74,249,137,1,135,125,254,118,1,99,40,247,0,
+    1,10,137,249,255,1,225,98,242,0,1,9,126,249,235,1,208,90,242,0,253,0,1,3,42,244,78,1,66,27,249,0,
+    1,18,57,254,78,1,57,18,253,0,1,10,137,244,255,1,216,88,249,0,1,59,186,254,255,1,186,59,128,0,108,254,
+    216,1,209,120,249,39,1,64,172,254,255,1,249,229,249,216,1,175,86,254,39,1,28,9,0,127,254,255,1,245,117,249,
+    0,1,29,157,244,255,1,196,68,252,0,0,78,254,157,1,151,72,249,0,1,18,96,244,157,1,120,42,252,0,1,9,
+    28,237,39,1,33,13,246,0,1,59,186,237,255,1,216,88,246,0,128,1,59,186,253,255,1,209,160,243,157,1,148,118,
+    253,98,1,60,11,252,0,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,252,0,128,1,59,186,253,
+    255,1,137,10,243,0,1,15,64,253,98,1,120,150,254,157,1,139,60,1,59,186,253,255,1,137,10,237,0,1,98,225,
+    254,255,1,225,98,128,128,128,128,128,128,128,128,128,1,59,186,253,255,1,137,10,243,0,1,21,89,253,137,1,129,120,
+    254,118,1,104,45,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,252,0,128,1,59,186,253,255,1,
+    228,198,243,196,1,175,106,253,59,1,36,7,252,0,1,59,186,237,255,1,216,88,246,0,128,251,0,1,72,151,243,157,
+    1,133,54,251,0,251,0,1,117,245,243,255,1,216,88,251,0,128,1,50,158,253,216,1,134,46,243,39,1,66,155,253,
+    216,1,133,25,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,1,59,186,253,255,1,146,29,243,20,
+    1,56,173,253,255,1,157,29,1,59,186,231,255,1,157,29,128,1,59,186,253,255,1,219,180,237,177,1,109,20,1,59,
+    186,253,255,1,137,10,235,0,128,1,59,186,253,255,1,137,10,243,0,1,21,89,253,137,1,84,16,1,59,186,253,255,
+    1,137,10,243,0,1,39,166,253,255,1,157,29,128,1,13,43,253,59,1,122,191,243,196,1,175,106,253,59,1,36,7,
+    251,0,1,117,245,243,255,1,216,88,251,0,128,1,54,172,253,235,1,126,9,235,0,1,59,186,253,255,1,137,10,235,
+    0,128,128,128,128,128,128,1,59,186,253,255,1,209,160,243,157,1,133,54,251,0,1,59,186,237,255,1,216,88,251,0,
+    128,1,59,186,253,255,1,155,47,243,39,1,66,155,253,216,1,133,25,1,59,186,253,255,1,137,10,243,0,1,39,166,
+    253,255,1,157,29,128,128,128,128,128,128,128,128,128,1,59,186,253,255,1,228,198,243,196,1,175,106,253,59,1,36,7,
+    1,59,186,237,255,1,216,88,251,0,128,1,36,114,253,157,1,84,6,243,0,1,24,102,253,157,1,96,18,1,59,186,
+    253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,128,128,128,128,128,128,128,128,128,128,128,1,13,43,253,59,
+    1,122,191,243,196,1,205,234,253,255,1,157,29,251,0,1,117,245,237,255,1,157,29,128,251,0,1,72,151,237,157,1,
+    96,18,251,0,1,117,245,237,255,1,157,29,128,1,50,158,253,216,1,134,46,243,39,1,72,180,253,255,1,157,29,1,
+    59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,128,128,128,128,128,128,128,128,1,13,43,253,59,1,
+    122,191,243,196,1,205,234,253,255,1,157,29,251,0,1,117,245,237,255,1,157,29,128,235,0,1,39,166,253,255,1,157,
+    29,128,128,128,128,251,0,1,54,113,243,118,1,121,130,253,137,1,84,16,251,0,1,117,245,243,255,1,216,88,251,0,
+    128,251,0,1,36,75,243,78,1,66,27,251,0,1,7,27,253,39,1,22,3,1,49,176,253,255,1,147,19,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,1,22,81,253,118,1,68,9,249,0,128,1,37,135,253,196,1,113,15,1,
+    49,176,253,255,1,147,19,128,1,108,226,254,235,1,190,72,253,0,1,99,217,254,235,1,199,81,1,117,245,254,255,1,
+    206,78,253,0,1,108,235,254,255,1,216,88,128,128,128,128,128,128,1,45,94,254,98,1,79,30,253,0,1,41,90,254,
+    98,1,83,34,241,0,1,7,27,253,39,1,22,3,254,0,1,6,25,253,39,1,24,4,252,0,241,0,1,49,176,253,
+    255,1,147,19,254,0,1,39,166,253,255,1,157,29,252,0,128,128,128,128,252,0,1,36,114,248,157,1,176,225,253,255,
+    1,213,164,254,157,1,172,221,253,255,1,217,168,254,157,1,139,60,252,0,1,59,186,226,255,1,225,98,128,252,0,1,
+    9,28,253,39,1,138,246,254,255,1,213,105,253,39,1,130,238,254,255,1,222,114,248,39,1,34,15,246,0,1,117,245,
+    254,255,1,206,78,253,0,1,108,235,254,255,1,216,88,246,0,128,128,128,0,39,247,78,1,159,248,254,255,1,221,132,
+    253,78,1,153,241,254,255,1,228,139,253,78,1,48,9,252,0,0,127,225,255,1,157,29,252,0,128,0,59,253,118,1,
+    149,218,253,255,1,191,123,254,118,1,144,213,253,255,1,197,128,248,118,1,72,13,252,0,252,0,1,59,186,253,255,1,
+    137,10,254,0,1,49,176,253,255,1,147,19,241,0,128,128,128,128,246,0,1,7,27,253,39,1,22,3,246,0,246,0,
+    1,49,176,253,255,1,147,19,246,0,128,251,0,1,45,94,254,98,1,128,206,253,255,1,188,110,248,98,1,60,11,251,
+    0,1,117,245,237,255,1,157,29,128,1,36,114,253,157,1,130,100,254,98,1,128,206,253,255,1,188,110,248,98,1,60,
+    11,1,59,186,253,255,1,137,10,254,0,1,49,176,253,255,1,147,19,246,0,128,128,128,1,54,172,253,235,1,135,28,
+    254,20,1,65,182,253,255,1,155,38,254,20,1,17,7,251,0,251,0,1,117,245,243,255,1,216,88,251,0,128,251,0,
+    1,81,170,254,177,1,192,231,253,255,1,222,183,254,177,1,161,112,253,78,1,48,9,246,0,1,49,176,253,255,1,147,
+    19,254,0,1,39,166,253,255,1,157,29,128,128,128,128,1,45,143,248,196,1,207,237,253,255,1,230,200,254,196,1,175,
+    106,253,59,1,36,7,1,59,186,237,255,1,216,88,251,0,128,246,0,1,49,176,253,255,1,147,19,246,0,128,246,0,
+    1,37,135,253,196,1,113,15,246,0,252,0,1,9,28,253,39,1,21,1,243,0,1,6,25,253,39,1,24,4,252,0,
+    252,0,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,252,0,128,0,49,253,98,1,111,141,253,157,
+    1,130,100,254,98,1,79,30,253,0,1,41,90,254,98,1,107,136,253,157,1,96,18,252,0,0,127,253,255,1,196,68,
+    253,0,1,117,245,254,255,1,206,78,253,0,1,108,235,254,255,1,216,88,246,0,128,128,128,128,0,19,253,39,1,80,
+    168,253,216,1,134,46,254,39,1,73,161,253,216,1,141,52,254,39,1,33,13,246,0,252,0,1,59,186,253,255,1,137,
+    10,254,0,1,49,176,253,255,1,147,19,241,0,252,0,1,54,172,253,235,1,126,9,254,0,1,49,176,253,255,1,147,
+    19,254,0,1,3,13,253,20,1,12,2,252,0,241,0,1,49,176,253,255,1,147,19,254,0,1,39,166,253,255,1,157,
+    29,252,0,128,246,0,1,36,75,254,78,1,97,146,253,177,1,135,86,254,78,1,93,143,253,177,1,139,89,254,78,1,
+    69,30,246,0,1,117,245,254,255,1,206,78,253,0,1,108,235,254,255,1,216,88,253,0,1,98,225,254,255,1,225,98,
+    128,128,128,128,252,0,1,45,143,253,196,1,132,64,254,59,1,47,18,253,0,1,25,54,254,59,1,80,148,253,196,1,
+    143,75,254,59,1,52,22,252,0,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,252,0,128,251,0,
+    1,18,37,248,39,1,22,3,241,0,251,0,1,117,245,248,255,1,147,19,241,0,128,1,22,71,253,98,1,125,154,248,
+    157,1,132,102,254,98,1,83,34,246,0,1,59,186,253,255,1,137,10,248,0,1,108,235,254,255,1,216,88,246,0,128,
+    128,128,128,1,9,28,253,39,1,120,209,248,216,1,141,52,254,39,1,33,13,253,0,1,83,191,254,216,1,191,83,251,
+    0,1,117,245,248,255,1,147,19,248,0,1,98,225,254,255,1,225,98,1,4,14,253,20,1,119,227,248,235,1,144,36,
+    254,20,1,17,7,253,0,1,98,225,254,255,1,225,98,1,59,186,253,255,1,137,10,248,0,1,108,235,254,255,1,216,
+    88,253,0,1,98,225,254,255,1,225,98,128,1,59,186,253,255,1,137,10,248,0,1,74,163,254,177,1,161,112,253,78,
+    1,116,165,254,177,1,156,68,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,252,0,128,128,128,128,
+    1,13,43,253,59,1,122,191,243,196,1,175,106,253,59,1,111,180,254,196,1,173,75,251,0,1,117,245,243,255,1,216,
+    88,253,0,1,98,225,254,255,1,225,98,128,1,45,163,253,235,1,135,18,1,49,176,253,255,1,147,19,128,128,128,128,
+    128,128,1,19,68,253,98,1,56,7,246,0,1,99,217,254,235,1,199,81,246,0,1,108,235,254,255,1,216,88,252,0,
+    1,7,27,253,39,1,114,202,254,216,1,182,74,252,0,1,49,176,253,255,1,147,19,252,0,128,128,128,128,1,72,151,
+    254,157,1,145,116,253,98,1,56,7,252,0,1,117,245,254,255,1,206,78,246,0,128,128,128,128,128,128,128,128,128,128,
+    128,128,1,27,56,254,59,1,85,154,253,196,1,113,15,252,0,252,0,1,49,176,253,255,1,147,19,252,0,128,128,128,
+    252,0,1,37,135,253,196,1,138,69,254,59,1,50,20,246,0,1,108,235,254,255,1,216,88,128,246,0,1,58,126,254,
+    137,1,116,47,1,108,226,254,235,1,190,72,246,0,1,117,245,254,255,1,206,78,246,0,1,99,207,254,216,1,182,93,
+    253,39,1,22,3,252,0,252,0,1,49,176,253,255,1,147,19,252,0,128,128,128,128,252,0,1,19,68,253,98,1,123,
+    152,254,157,1,133,54,246,0,1,108,235,254,255,1,216,88,128,128,128,128,128,128,128,128,128,128,128,128,252,0,1,37,
+    135,253,196,1,138,69,254,59,1,50,20,252,0,1,49,176,253,255,1,147,19,252,0,128,128,128,1,27,56,254,59,1,
+    85,154,253,196,1,113,15,252,0,1,117,245,254,255,1,206,78,246,0,128,1,63,132,254,137,1,110,42,246,0,246,0,
+    1,30,108,253,157,1,90,12,246,0,246,0,1,49,176,253,255,1,147,19,246,0,128,1,50,158,253,216,1,116,8,254,
+    0,1,49,176,253,255,1,147,19,254,0,1,33,141,253,216,1,133,25,1,59,186,253,255,1,137,10,254,0,1,49,176,
+    253,255,1,147,19,254,0,1,39,166,253,255,1,157,29,1,54,172,253,235,1,135,28,254,20,1,65,182,253,255,1,155,
+    38,254,20,1,53,160,253,235,1,144,27,251,0,1,117,245,243,255,1,216,88,251,0,128,1,18,57,253,78,1,123,173,
+    254,177,1,192,231,253,255,1,222,183,254,177,1,161,112,253,78,1,48,9,1,59,186,253,255,1,137,10,254,0,1,49,
+    176,253,255,1,147,19,254,0,1,39,166,253,255,1,157,29,128,1,27,86,253,118,1,63,4,254,0,1,49,176,253,255,
+    1,147,19,254,0,1,18,77,253,118,1,72,13,246,0,1,49,176,253,255,1,147,19,246,0,128,246,0,1,11,41,253,
+    59,1,34,4,246,0,246,0,1,30,108,253,157,1,90,12,246,0,246,0,1,49,176,253,255,1,147,19,246,0,128,128,
+    128,1,4,14,248,20,1,65,182,253,255,1,155,38,248,20,1,12,2,1,59,186,231,255,1,157,29,128,1,40,129,248,
+    177,1,192,231,253,255,1,222,183,248,177,1,109,20,246,0,1,49,176,253,255,1,147,19,246,0,128,128,128,128,246,0,
+    1,11,41,253,59,1,34,4,246,0,251,0,1,63,132,254,137,1,110,42,251,0,1,117,245,254,255,1,206,78,128,128,
+    128,128,128,128,1,13,43,253,59,1,122,191,254,196,1,158,60,1,59,186,253,255,1,137,10,252,0,128,1,31,100,253,
+    137,1,74,5,252,0,1,4,14,231,20,1,12,2,1,59,186,231,255,1,157,29,128,1,40,129,231,177,1,109,20,1,
+    63,132,254,137,1,110,42,1,117,245,254,255,1,206,78,128,128,128,128,235,0,1,36,153,253,235,1,144,27,235,0,1,
+    39,166,253,255,1,157,29,128,128,128,240,0,1,41,90,254,98,1,107,136,253,157,1,96,18,240,0,1,108,235,254,255,
+    1,216,88,251,0,128,128,128,128,246,0,1,41,149,253,216,1,141,52,254,39,1,33,13,251,0,246,0,1,49,176,253,
+    255,1,147,19,246,0,128,128,128,251,0,1,36,75,254,78,1,97,146,253,177,1,102,13,246,0,251,0,1,117,245,254,
+    255,1,206,78,240,0,128,128,128,128,1,45,143,253,196,1,132,64,254,59,1,47,18,240,0,1,59,186,253,255,1,137,
+    10,235,0,128,128,128,1,45,143,253,196,1,105,7,235,0,251,0,1,18,37,243,39,1,33,13,251,0,251,0,1,117,
+    245,243,255,1,216,88,251,0,128,1,22,71,253,98,1,125,154,243,157,1,148,118,253,98,1,60,11,1,59,186,253,255,
+    1,137,10,243,0,1,39,166,253,255,1,157,29,128,128,128,128,1,59,186,253,255,1,137,10,254,0,1,41,149,253,216,
+    1,124,16,254,0,1,39,166,253,255,1,157,29,1,59,186,253,255,1,137,10,254,0,1,49,176,253,255,1,147,19,254,
+    0,1,39,166,253,255,1,157,29,128,128,128,1,59,186,253,255,1,137,10,254,0,1,34,122,253,177,1,102,13,254,0,
+    1,39,166,253,255,1,157,29,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,128,128,128,1,13,
+    43,253,59,1,122,191,243,196,1,175,106,253,59,1,36,7,251,0,1,117,245,243,255,1,216,88,251,0,128,246,0,1,
+    7,27,253,39,1,22,3,246,0,246,0,1,49,176,253,255,1,147,19,246,0,128,251,0,1,45,94,254,98,1,128,206,
+    253,255,1,147,19,246,0,251,0,1,117,245,248,255,1,147,19,246,0,128,1,36,114,253,157,1,130,100,254,98,1,128,
+    206,253,255,1,147,19,246,0,1,59,186,253,255,1,137,10,254,0,1,49,176,253,255,1,147,19,246,0,128,1,9,28,
+    253,39,1,21,1,254,0,1,49,176,253,255,1,147,19,246,0,246,0,1,49,176,253,255,1,147,19,246,0,128,128,128,
+    128,128,128,128,128,128,1,45,143,248,196,1,207,237,253,255,1,230,200,248,196,1,120,22,1,59,186,231,255,1,157,29,
+    128,251,0,1,18,37,243,39,1,33,13,251,0,251,0,1,117,245,243,255,1,216,88,251,0,128,1,22,71,253,98,1,
+    125,154,243,157,1,148,118,253,98,1,60,11,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,1,
+    22,71,253,98,1,53,4,243,0,1,39,166,253,255,1,157,29,235,0,1,39,166,253,255,1,157,29,128,240,0,1,91,
+    199,254,216,1,188,100,253,39,1,24,4,240,0,1,108,235,254,255,1,216,88,251,0,246,0,1,4,14,253,20,1,111,
+    218,254,235,1,199,81,251,0,246,0,1,49,176,253,255,1,147,19,246,0,128,251,0,1,36,75,254,78,1,97,146,253,
+    177,1,102,13,246,0,251,0,1,117,245,254,255,1,206,78,240,0,128,1,31,100,253,137,0,128,253,118,1,95,36,240,
+    0,1,59,186,253,255,1,137,10,235,0,128,1,59,186,253,255,1,228,198,237,196,1,120,22,1,59,186,231,255,1,157,
+    29,128,251,0,1,18,37,243,39,1,33,13,251,0,251,0,1,117,245,243,255,1,216,88,251,0,128,1,22,71,253,98,
+    1,125,154,243,157,1,148,118,253,98,1,60,11,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,
+    1,22,71,253,98,1,53,4,243,0,1,39,166,253,255,1,157,29,235,0,1,39,166,253,255,1,157,29,128,246,0,1,
+    41,149,248,216,1,188,100,253,39,1,24,4,246,0,1,49,176,248,255,1,216,88,251,0,246,0,1,45,163,248,235,1,
+    202,94,253,20,1,12,2,235,0,1,39,166,253,255,1,157,29,128,128,128,128,1,31,100,253,137,1,74,5,243,0,1,
+    39,166,253,255,1,157,29,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,1,13,43,253,59,1,
+    122,191,243,196,1,175,106,253,59,1,36,7,251,0,1,117,245,243,255,1,216,88,251,0,128,235,0,1,6,25,253,39,
+    1,24,4,252,0,235,0,1,39,166,253,255,1,157,29,252,0,128,240,0,1,41,90,254,98,1,122,200,253,255,1,157,
+    29,252,0,240,0,1,108,235,248,255,1,157,29,252,0,128,246,0,1,30,108,253,157,1,132,102,254,98,1,122,200,253,
+    255,1,157,29,252,0,246,0,1,49,176,253,255,1,147,19,254,0,1,39,166,253,255,1,157,29,252,0,128,251,0,1,
+    99,207,254,216,1,182,93,253,39,1,22,3,254,0,1,39,166,253,255,1,157,29,252,0,251,0,1,117,245,254,255,1,
+    206,78,248,0,1,39,166,253,255,1,157,29,252,0,1,4,14,253,20,1,119,227,254,235,1,190,72,248,0,1,39,166,
+    253,255,1,157,29,252,0,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,252,0,128,1,59,186,253,
+    255,1,173,85,243,78,1,105,194,253,255,1,187,98,254,78,1,69,30,1,59,186,226,255,1,225,98,128,1,27,86,237,
+    118,1,139,207,253,255,1,202,133,254,118,1,104,45,235,0,1,39,166,253,255,1,157,29,252,0,128,128,128,128,1,9,
+    28,231,39,1,24,4,1,59,186,231,255,1,157,29,128,1,59,186,253,255,1,209,160,237,157,1,96,18,1,59,186,253,
+    255,1,137,10,235,0,128,128,128,128,1,59,186,253,255,1,237,217,243,216,1,182,74,251,0,1,59,186,237,255,1,216,
+    88,251,0,1,54,172,237,235,1,202,94,253,20,1,12,2,235,0,1,39,166,253,255,1,157,29,128,128,128,128,1,31,
+    100,253,137,1,74,5,243,0,1,39,166,253,255,1,157,29,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,
+    157,29,128,1,13,43,253,59,1,122,191,243,196,1,175,106,253,59,1,36,7,251,0,1,117,245,243,255,1,216,88,251,
+    0,128,246,0,1,7,27,248,39,1,33,13,251,0,246,0,1,49,176,248,255,1,216,88,251,0,128,251,0,1,45,94,
+    254,98,1,109,139,248,157,1,133,54,251,0,251,0,1,117,245,254,255,1,206,78,240,0,128,1,36,114,253,157,1,130,
+    100,254,98,1,79,30,240,0,1,59,186,253,255,1,137,10,235,0,128,1,59,186,253,255,1,237,217,243,216,1,182,74,
+    251,0,1,59,186,237,255,1,216,88,251,0,1,59,186,253,255,1,246,236,243,235,1,202,94,253,20,1,12,2,1,59,
+    186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,128,128,128,128,128,128,1,13,43,253,59,1,122,191,243,
+    196,1,175,106,253,59,1,36,7,251,0,1,117,245,243,255,1,216,88,251,0,128,1,9,28,231,39,1,24,4,1,59,
+    186,231,255,1,157,29,128,1,36,114,237,157,1,172,221,253,255,1,157,29,235,0,1,39,166,253,255,1,157,29,128,240,
+    0,1,66,145,254,157,1,148,118,253,98,1,60,11,240,0,1,108,235,254,255,1,216,88,251,0,128,128,128,246,0,1,
+    4,14,253,20,1,111,218,254,235,1,199,81,251,0,246,0,1,49,176,253,255,1,147,19,246,0,128,128,128,128,251,0,
+    1,63,132,254,137,1,133,124,253,118,1,68,9,246,0,251,0,1,117,245,254,255,1,206,78,240,0,128,128,128,128,251,
+    0,1,18,37,243,39,1,33,13,251,0,251,0,1,117,245,243,255,1,216,88,251,0,128,1,22,71,253,98,1,125,154,
+    243,157,1,148,118,253,98,1,60,11,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,128,128,128,
+    1,9,28,253,39,1,120,209,243,216,1,188,100,253,39,1,24,4,251,0,1,117,245,243,255,1,216,88,251,0,1,4,
+    14,253,20,1,119,227,243,235,1,202,94,253,20,1,12,2,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,
+    157,29,128,128,128,128,128,128,128,1,13,43,253,59,1,122,191,243,196,1,175,106,253,59,1,36,7,251,0,1,117,245,
+    243,255,1,216,88,251,0,128,251,0,1,18,37,243,39,1,33,13,251,0,251,0,1,117,245,243,255,1,216,88,251,0,
+    128,1,22,71,253,98,1,125,154,243,157,1,148,118,253,98,1,60,11,1,59,186,253,255,1,137,10,243,0,1,39,166,
+    253,255,1,157,29,128,128,128,128,128,128,1,54,172,253,235,1,135,28,243,20,1,56,173,253,255,1,157,29,251,0,1,
+    117,245,237,255,1,157,29,128,251,0,1,81,170,243,177,1,189,228,253,255,1,157,29,235,0,1,39,166,253,255,1,157,
+    29,128,240,0,1,58,126,254,137,1,134,124,253,118,1,72,13,240,0,1,108,235,254,255,1,216,88,251,0,128,251,0,
+    1,90,188,248,196,1,138,69,254,59,1,50,20,251,0,251,0,1,117,245,248,255,1,147,19,246,0,128,1,30,108,253,
+    157,1,90,12,1,49,176,253,255,1,147,19,128,128,128,1,45,163,253,235,1,135,18,249,0,128,128,128,128,1,26,95,
+    253,137,1,79,10,1,49,176,253,255,1,147,19,128,128,128,128,251,0,1,72,151,254,157,1,127,48,251,0,1,117,245,
+    254,255,1,206,78,128,128,128,251,0,1,108,226,254,235,1,190,72,244,0,128,128,128,128,251,0,1,63,132,254,137,1,
+    110,42,251,0,1,117,245,254,255,1,206,78,128,128,128,128,128,128,1,13,43,253,59,1,122,191,254,196,1,158,60,1,
+    59,186,253,255,1,137,10,252,0,128,1,31,100,253,137,1,74,5,252,0,235,0,1,66,145,248,157,1,96,18,235,0,
+    1,108,235,248,255,1,157,29,128,246,0,1,99,207,248,216,1,141,52,248,39,1,24,4,246,0,1,117,245,248,255,1,
+    147,19,246,0,0,10,247,20,1,119,227,248,235,1,135,18,246,0,0,127,247,255,1,137,10,235,0,128,0,88,247,177,
+    1,131,82,248,78,1,45,6,246,0,246,0,1,117,245,248,255,1,147,19,246,0,128,246,0,1,54,113,248,118,1,126,
+    135,248,137,1,84,16,235,0,1,108,235,248,255,1,157,29,128,235,0,1,25,54,248,59,1,36,7,1,50,158,226,216,
+    1,191,83,1,59,186,226,255,1,225,98,1,54,172,226,235,1,208,90,222,0,128,1,18,57,226,78,1,69,30,1,59,
+    186,226,255,1,225,98,128,1,27,86,226,118,1,104,45,1,36,114,248,157,1,127,48,235,0,1,59,186,248,255,1,206,
+    78,235,0,128,1,9,28,248,39,1,73,161,248,216,1,182,74,246,0,246,0,1,49,176,248,255,1,216,88,246,0,246,
+    0,1,45,163,248,235,1,202,94,248,20,1,17,7,235,0,1,39,166,248,255,1,225,98,128,246,0,1,15,54,248,78,
+    1,93,143,248,177,1,156,68,246,0,1,49,176,248,255,1,216,88,246,0,128,1,31,100,248,137,1,133,124,248,118,1,
+    99,40,246,0,1,59,186,248,255,1,206,78,235,0,128,1,13,43,248,59,1,47,18,235,0,251,0,1,18,37,243,39,
+    1,33,13,251,0,251,0,1,117,245,243,255,1,216,88,251,0,128,1,22,71,253,98,1,125,154,243,157,1,148,118,253,
+    98,1,60,11,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,1,22,71,253,98,1,53,4,243,
+    0,1,39,166,253,255,1,157,29,235,0,1,39,166,253,255,1,157,29,128,240,0,1,91,199,254,216,1,188,100,253,39,
+    1,24,4,240,0,1,108,235,254,255,1,216,88,251,0,246,0,1,4,14,253,20,1,111,218,254,235,1,199,81,251,0,
+    246,0,1,49,176,253,255,1,147,19,246,0,128,128,128,128,246,0,1,22,81,253,118,1,68,9,246,0,227,0,128,246,
+    0,1,37,135,253,196,1,113,15,246,0,246,0,1,49,176,253,255,1,147,19,246,0,128,246,0,1,18,37,243,39,1,
+    33,13,246,0,246,0,1,117,245,243,255,1,216,88,246,0,128,252,0,1,22,71,253,98,1,125,154,243,157,1,148,118,
+    253,98,1,60,11,252,0,252,0,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,252,0,128,0,78,
+    253,157,1,143,114,253,98,1,53,4,254,0,1,30,108,248,157,1,148,118,253,98,1,120,150,254,157,1,139,60,0,127,
+    253,255,1,196,68,248,0,1,49,176,248,255,1,216,88,253,0,1,98,225,254,255,1,225,98,128,0,127,253,255,1,196,
+    68,253,0,1,99,207,254,216,1,182,93,253,39,1,130,238,254,255,1,216,88,253,0,1,98,225,254,255,1,225,98,0,
+    127,253,255,1,196,68,253,0,1,117,245,254,255,1,206,78,253,0,1,108,235,254,255,1,216,88,253,0,1,98,225,254,
+    255,1,225,98,128,128,128,0,127,253,255,1,196,68,253,0,1,81,170,254,177,1,158,108,253,78,1,153,241,254,255,1,
+    228,139,253,78,1,116,165,254,177,1,156,68,0,127,253,255,1,196,68,248,0,1,49,176,242,255,1,157,29,252,0,128,
+    0,59,253,118,1,122,132,253,137,1,74,5,254,0,1,22,81,242,118,1,72,13,252,0,252,0,1,59,186,253,255,1,
+    137,10,230,0,128,252,0,1,13,43,253,59,1,122,191,237,196,1,120,22,252,0,246,0,1,117,245,237,255,1,157,29,
+    252,0,128,246,0,1,7,27,248,39,1,33,13,246,0,246,0,1,49,176,248,255,1,216,88,246,0,128,128,128,128,251,
+    0,1,72,151,254,157,1,145,116,248,98,1,107,136,253,157,1,96,18,252,0,251,0,1,117,245,254,255,1,206,78,248,
+    0,1,39,166,253,255,1,157,29,252,0,128,128,128,251,0,1,117,245,254,255,1,209,92,248,20,1,56,173,253,255,1,
+    157,29,252,0,251,0,1,117,245,237,255,1,157,29,252,0,128,1,18,57,253,78,1,123,173,237,177,1,139,89,254,78,
+    1,69,30,1,59,186,253,255,1,137,10,237,0,1,98,225,254,255,1,225,98,128,128,128,128,128,128,128,1,9,28,237,
+    39,1,33,13,246,0,1,59,186,237,255,1,216,88,246,0,128,1,59,186,253,255,1,209,160,243,157,1,148,118,253,98,
+    1,60,11,252,0,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,252,0,128,128,128,128,1,59,186,
+    253,255,1,237,217,243,216,1,222,241,253,255,1,157,29,252,0,1,59,186,231,255,1,157,29,252,0,1,59,186,253,255,
+    1,246,236,237,235,1,152,44,254,20,1,17,7,1,59,186,253,255,1,137,10,237,0,1,98,225,254,255,1,225,98,128,
+    128,128,128,128,128,128,1,59,186,253,255,1,228,198,237,196,1,143,75,254,59,1,52,22,1,59,186,231,255,1,157,29,
+    252,0,128,246,0,1,7,27,242,39,1,24,4,252,0,246,0,1,49,176,242,255,1,157,29,252,0,128,251,0,1,45,
+    94,254,98,1,109,139,242,157,1,134,105,254,98,1,86,37,251,0,1,117,245,254,255,1,206,78,242,0,1,98,225,254,
+    255,1,225,98,128,1,36,114,253,157,1,130,100,254,98,1,79,30,242,0,1,37,86,254,98,1,86,37,1,59,186,253,
+    255,1,137,10,230,0,128,128,128,128,128,128,128,128,128,1,27,86,253,118,1,127,136,254,137,1,110,42,242,0,1,53,
+    121,254,137,1,121,53,251,0,1,117,245,254,255,1,206,78,242,0,1,98,225,254,255,1,225,98,128,251,0,1,27,56,
+    254,59,1,85,154,242,196,1,143,75,254,59,1,52,22,246,0,1,49,176,242,255,1,157,29,252,0,128,1,9,28,231,
+    39,1,24,4,1,59,186,231,255,1,157,29,128,1,59,186,253,255,1,209,160,237,157,1,96,18,1,59,186,253,255,1,
+    137,10,235,0,128,128,128,128,1,59,186,253,255,1,237,217,243,216,1,182,74,251,0,1,59,186,237,255,1,216,88,251,
+    0,1,59,186,253,255,1,246,236,243,235,1,199,81,251,0,1,59,186,253,255,1,137,10,235,0,128,128,128,128,128,128,
+    128,1,59,186,253,255,1,228,198,237,196,1,120,22,1,59,186,231,255,1,157,29,128,1,9,28,231,39,1,24,4,1,
+    59,186,231,255,1,157,29,128,1,59,186,253,255,1,209,160,237,157,1,96,18,1,59,186,253,255,1,137,10,235,0,128,
+    128,128,128,1,59,186,253,255,1,237,217,243,216,1,182,74,251,0,1,59,186,237,255,1,216,88,251,0,1,59,186,253,
+    255,1,246,236,243,235,1,199,81,251,0,1,59,186,253,255,1,137,10,235,0,128,128,128,128,128,128,128,128,128,128,246,
+    0,1,7,27,242,39,1,24,4,252,0,246,0,1,49,176,242,255,1,157,29,252,0,128,251,0,1,45,94,254,98,1,
+    109,139,242,157,1,134,105,254,98,1,86,37,251,0,1,117,245,254,255,1,206,78,242,0,1,98,225,254,255,1,225,98,
+    128,1,36,114,253,157,1,130,100,254,98,1,79,30,242,0,1,37,86,254,98,1,86,37,1,59,186,253,255,1,137,10,
+    230,0,128,128,128,1,59,186,253,255,1,137,10,248,0,1,8,18,243,20,1,17,7,1,59,186,253,255,1,137,10,248,
+    0,1,108,235,243,255,1,225,98,128,1,59,186,253,255,1,137,10,248,0,1,74,163,248,177,1,207,246,254,255,1,225,
+    98,1,59,186,253,255,1,137,10,237,0,1,98,225,254,255,1,225,98,128,1,27,86,253,118,1,127,136,254,137,1,110,
+    42,242,0,1,98,225,254,255,1,225,98,251,0,1,117,245,254,255,1,206,78,242,0,1,98,225,254,255,1,225,98,128,
+    251,0,1,27,56,254,59,1,85,154,242,196,1,143,75,254,59,1,52,22,246,0,1,49,176,242,255,1,157,29,252,0,
+    128,1,9,28,253,39,1,21,1,237,0,1,15,34,254,39,1,34,15,1,59,186,253,255,1,137,10,237,0,1,98,225,
+    254,255,1,225,98,128,128,128,128,128,128,128,1,59,186,253,255,1,237,217,237,216,1,231,250,254,255,1,225,98,1,59,
+    186,226,255,1,225,98,1,59,186,253,255,1,246,236,237,235,1,242,252,254,255,1,225,98,1,59,186,253,255,1,137,10,
+    237,0,1,98,225,254,255,1,225,98,128,128,128,128,128,128,128,128,128,128,1,18,37,243,39,1,33,13,1,117,245,243,
+    255,1,216,88,128,1,72,151,254,157,1,176,225,253,255,1,213,164,254,157,1,133,54,252,0,1,49,176,253,255,1,147,
+    19,252,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,1,90,188,254,196,1,207,237,253,255,1,230,200,254,
+    196,1,166,68,1,117,245,243,255,1,216,88,128,251,0,1,18,37,243,39,1,33,13,251,0,1,117,245,243,255,1,216,
+    88,128,251,0,1,72,151,248,157,1,198,247,254,255,1,216,88,240,0,1,108,235,254,255,1,216,88,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,1,45,143,242,196,1,138,69,254,59,1,50,20,1,59,186,242,255,1,147,19,252,
+    0,128,1,9,28,253,39,1,21,1,237,0,1,15,34,254,39,1,34,15,1,59,186,253,255,1,137,10,237,0,1,98,
+    225,254,255,1,225,98,128,1,59,186,253,255,1,137,10,243,0,1,15,64,253,98,1,120,150,254,157,1,139,60,1,59,
+    186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,252,0,128,1,59,186,253,255,1,137,10,248,0,1,66,145,
+    254,157,1,148,118,253,98,1,60,11,252,0,1,59,186,253,255,1,137,10,248,0,1,108,235,254,255,1,216,88,246,0,
+    128,1,59,186,253,255,1,137,10,254,0,1,41,149,253,216,1,141,52,254,39,1,33,13,246,0,1,59,186,253,255,1,
+    137,10,254,0,1,49,176,253,255,1,147,19,241,0,1,59,186,253,255,1,146,29,254,20,1,65,182,253,255,1,147,19,
+    241,0,1,59,186,242,255,1,147,19,241,0,128,1,59,186,253,255,1,219,180,248,177,1,135,86,254,78,1,66,27,246,
+    0,1,59,186,253,255,1,137,10,248,0,1,108,235,254,255,1,216,88,246,0,128,1,59,186,253,255,1,137,10,248,0,
+    1,50,109,254,118,1,121,130,253,137,1,84,16,252,0,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,
+    29,252,0,128,1,59,186,253,255,1,137,10,243,0,1,9,38,253,59,1,111,180,254,196,1,173,75,1,59,186,253,255,
+    1,137,10,237,0,1,98,225,254,255,1,225,98,128,1,9,28,253,39,1,21,1,235,0,1,59,186,253,255,1,137,10,
+    235,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,1,59,186,253,255,1,228,198,237,196,1,120,
+    22,1,59,186,231,255,1,157,29,128,0,19,247,39,1,21,1,243,0,1,6,25,248,39,1,34,15,0,127,247,255,1,
+    137,10,243,0,1,39,166,248,255,1,225,98,128,128,128,128,0,127,253,255,1,219,140,253,98,1,125,154,254,157,1,127,
+    48,253,0,1,66,145,254,157,1,148,118,253,98,1,158,237,254,255,1,225,98,0,127,253,255,1,196,68,253,0,1,117,
+    245,254,255,1,206,78,253,0,1,108,235,254,255,1,216,88,253,0,1,98,225,254,255,1,225,98,128,128,128,0,127,253,
+    255,1,196,68,253,0,1,108,226,254,235,1,193,86,253,20,1,111,218,254,235,1,199,81,253,0,1,98,225,254,255,1,
+    225,98,0,127,253,255,1,196,68,248,0,1,49,176,253,255,1,147,19,248,0,1,98,225,254,255,1,225,98,128,128,128,
+    128,0,127,253,255,1,196,68,248,0,1,22,81,253,118,1,68,9,248,0,1,98,225,254,255,1,225,98,0,127,253,255,
+    1,196,68,231,0,1,98,225,254,255,1,225,98,128,128,128,128,1,9,28,248,39,1,31,12,242,0,1,15,34,254,39,
+    1,34,15,1,59,186,248,255,1,206,78,242,0,1,98,225,254,255,1,225,98,128,128,128,128,1,59,186,253,255,1,182,
+    104,254,98,1,109,139,253,157,1,90,12,248,0,1,98,225,254,255,1,225,98,1,59,186,253,255,1,137,10,254,0,1,
+    49,176,253,255,1,147,19,248,0,1,98,225,254,255,1,225,98,128,128,128,1,59,186,253,255,1,137,10,254,0,1,45,
+    163,253,235,1,144,36,254,20,1,17,7,253,0,1,98,225,254,255,1,225,98,1,59,186,253,255,1,137,10,248,0,1,
+    108,235,254,255,1,216,88,253,0,1,98,225,254,255,1,225,98,128,128,128,128,1,59,186,253,255,1,137,10,248,0,1,
+    50,109,254,118,1,121,130,253,137,1,182,241,254,255,1,225,98,1,59,186,253,255,1,137,10,243,0,1,39,166,248,255,
+    1,225,98,128,128,128,128,246,0,1,7,27,248,39,1,33,13,246,0,246,0,1,49,176,248,255,1,216,88,246,0,128,
+    251,0,1,45,94,254,98,1,109,139,248,157,1,148,118,253,98,1,60,11,252,0,251,0,1,117,245,254,255,1,206,78,
+    248,0,1,39,166,253,255,1,157,29,252,0,128,1,36,114,253,157,1,130,100,254,98,1,79,30,248,0,1,15,64,253,
+    98,1,120,150,254,157,1,139,60,1,59,186,253,255,1,137,10,237,0,1,98,225,254,255,1,225,98,128,128,128,128,128,
+    128,128,128,128,1,27,86,253,118,1,127,136,254,137,1,110,42,248,0,1,21,89,253,137,1,129,120,254,118,1,104,45,
+    251,0,1,117,245,254,255,1,206,78,248,0,1,39,166,253,255,1,157,29,252,0,128,251,0,1,27,56,254,59,1,85,
+    154,248,196,1,175,106,253,59,1,36,7,252,0,246,0,1,49,176,248,255,1,216,88,246,0,128,1,9,28,237,39,1,
+    33,13,251,0,1,59,186,237,255,1,216,88,251,0,128,1,59,186,253,255,1,209,160,243,157,1,148,118,253,98,1,60,
+    11,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,128,128,128,128,128,1,59,186,253,255,1,146,
+    29,243,20,1,53,160,253,235,1,144,27,1,59,186,237,255,1,216,88,251,0,128,1,59,186,253,255,1,219,180,243,177,
+    1,149,61,251,0,1,59,186,253,255,1,137,10,235,0,128,128,128,128,128,128,128,246,0,1,7,27,248,39,1,33,13,
+    246,0,246,0,1,49,176,248,255,1,216,88,246,0,128,251,0,1,45,94,254,98,1,109,139,248,157,1,148,118,253,98,
+    1,60,11,252,0,251,0,1,117,245,254,255,1,206,78,248,0,1,39,166,253,255,1,157,29,252,0,128,1,36,114,253,
+    157,1,130,100,254,98,1,79,30,248,0,1,15,64,253,98,1,120,150,254,157,1,139,60,1,59,186,253,255,1,137,10,
+    237,0,1,98,225,254,255,1,225,98,128,128,128,128,128,128,128,128,128,1,27,86,253,118,1,127,136,254,137,1,110,42,
+    248,0,1,21,89,253,137,1,129,120,254,118,1,104,45,251,0,1,117,245,254,255,1,206,78,248,0,1,39,166,253,255,
+    1,157,29,252,0,128,251,0,1,27,56,254,59,1,85,154,248,196,1,175,106,253,59,1,111,180,254,196,1,173,75,246,
+    0,1,49,176,248,255,1,216,88,253,0,1,98,225,254,255,1,225,98,128,229,0,1,98,225,254,255,1,225,98,128,229,
+    0,1,75,173,254,196,1,173,75,1,9,28,237,39,1,33,13,246,0,1,59,186,237,255,1,216,88,246,0,128,1,59,
+    186,253,255,1,209,160,243,157,1,148,118,253,98,1,60,11,252,0,1,59,186,253,255,1,137,10,243,0,1,39,166,253,
+    255,1,157,29,252,0,128,128,128,128,128,128,1,59,186,253,255,1,146,29,243,20,1,53,160,253,235,1,144,27,252,0,
+    1,59,186,237,255,1,216,88,246,0,128,1,59,186,253,255,1,219,180,248,177,1,210,249,254,255,1,216,88,246,0,1,
+    59,186,253,255,1,137,10,248,0,1,108,235,254,255,1,216,88,246,0,128,1,59,186,253,255,1,137,10,248,0,1,50,
+    109,254,118,1,121,130,253,137,1,84,16,252,0,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,252,
+    0,128,1,59,186,253,255,1,137,10,243,0,1,9,38,253,59,1,111,180,254,196,1,173,75,1,59,186,253,255,1,137,
+    10,237,0,1,98,225,254,255,1,225,98,128,251,0,1,18,37,237,39,1,24,4,252,0,251,0,1,117,245,237,255,1,
+    157,29,252,0,128,1,22,71,253,98,1,125,154,237,157,1,134,105,254,98,1,86,37,1,59,186,253,255,1,137,10,237,
+    0,1,98,225,254,255,1,225,98,128,1,59,186,253,255,1,137,10,237,0,1,37,86,254,98,1,86,37,1,59,186,253,
+    255,1,137,10,230,0,128,1,9,28,253,39,1,120,209,248,216,1,124,16,241,0,251,0,1,117,245,248,255,1,147,19,
+    241,0,251,0,1,108,226,248,235,1,144,36,248,20,1,12,2,252,0,240,0,1,108,235,248,255,1,157,29,252,0,128,
+    240,0,1,74,163,248,177,1,139,89,254,78,1,69,30,229,0,1,98,225,254,255,1,225,98,128,1,31,100,253,137,1,
+    74,5,237,0,1,98,225,254,255,1,225,98,1,59,186,253,255,1,137,10,237,0,1,98,225,254,255,1,225,98,128,1,
+    13,43,253,59,1,122,191,237,196,1,143,75,254,59,1,52,22,251,0,1,117,245,237,255,1,157,29,252,0,128,0,19,
+    220,39,1,34,15,0,127,220,255,1,225,98,128,0,78,242,157,1,176,225,253,255,1,213,164,243,157,1,139,60,241,0,
+    1,49,176,253,255,1,147,19,241,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,1,9,28,253,
+    39,1,21,1,237,0,1,15,34,254,39,1,34,15,1,59,186,253,255,1,137,10,237,0,1,98,225,254,255,1,225,98,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,1,13,43,253,59,1,122,191,237,196,1,143,75,254,
+    59,1,52,22,251,0,1,117,245,237,255,1,157,29,252,0,128,0,19,253,39,1,30,10,231,0,1,15,34,254,39,1,
+    34,15,0,127,253,255,1,196,68,231,0,1,98,225,254,255,1,225,98,128,128,128,128,0,49,253,98,1,111,141,253,157,
+    1,84,6,243,0,1,24,102,253,157,1,134,105,254,98,1,86,37,252,0,1,59,186,253,255,1,137,10,243,0,1,39,
+    166,253,255,1,157,29,252,0,128,128,128,252,0,1,54,172,253,235,1,135,28,254,20,1,16,6,253,0,1,8,18,254,
+    20,1,53,160,253,235,1,144,27,252,0,246,0,1,117,245,254,255,1,206,78,253,0,1,108,235,254,255,1,216,88,246,
+    0,128,128,128,128,246,0,1,54,113,254,118,1,121,131,253,137,1,129,119,254,118,1,99,40,246,0,241,0,1,49,176,
+    253,255,1,147,19,241,0,128,128,128,128,0,19,253,39,1,30,10,231,0,1,15,34,254,39,1,34,15,0,127,253,255,
+    1,196,68,231,0,1,98,225,254,255,1,225,98,128,0,127,253,255,1,196,68,248,0,1,19,68,253,98,1,56,7,248,
+    0,1,98,225,254,255,1,225,98,0,127,253,255,1,196,68,248,0,1,49,176,253,255,1,147,19,248,0,1,98,225,254,
+    255,1,225,98,128,128,128,128,0,127,253,255,1,196,68,253,0,1,99,207,254,216,1,182,93,253,39,1,114,202,254,216,
+    1,182,74,253,0,1,98,225,254,255,1,225,98,0,127,253,255,1,196,68,253,0,1,117,245,254,255,1,206,78,253,0,
+    1,108,235,254,255,1,216,88,253,0,1,98,225,254,255,1,225,98,128,128,128,0,88,253,177,1,154,104,253,78,1,159,
+    248,254,255,1,206,78,253,0,1,108,235,254,255,1,228,139,253,78,1,116,165,254,177,1,156,68,252,0,1,59,186,248,
+    255,1,206,78,253,0,1,108,235,248,255,1,157,29,252,0,128,252,0,1,59,186,253,255,1,191,123,254,118,1,95,36,
+    253,0,1,50,109,254,118,1,139,207,253,255,1,157,29,252,0,252,0,1,59,186,253,255,1,137,10,243,0,1,39,166,
+    253,255,1,157,29,252,0,128,128,128,128,1,9,28,253,39,1,21,1,237,0,1,15,34,254,39,1,34,15,1,59,186,
+    253,255,1,137,10,237,0,1,98,225,254,255,1,225,98,128,128,128,128,1,22,71,253,98,1,125,154,254,157,1,127,48,
+    248,0,1,24,102,253,157,1,134,105,254,98,1,86,37,251,0,1,117,245,254,255,1,206,78,248,0,1,39,166,253,255,
+    1,157,29,252,0,128,251,0,1,18,37,254,39,1,73,161,248,216,1,188,100,253,39,1,24,4,252,0,246,0,1,49,
+    176,248,255,1,216,88,246,0,128,128,128,251,0,1,36,75,254,78,1,97,146,248,177,1,161,112,253,78,1,48,9,252,
+    0,251,0,1,117,245,254,255,1,206,78,248,0,1,39,166,253,255,1,157,29,252,0,128,1,31,100,253,137,0,128,253,
+    118,1,95,36,248,0,1,18,77,253,118,1,125,135,254,137,1,121,53,1,59,186,253,255,1,137,10,237,0,1,98,225,
+    254,255,1,225,98,128,128,128,128,0,19,253,39,1,30,10,231,0,1,15,34,254,39,1,34,15,0,127,253,255,1,196,
+    68,231,0,1,98,225,254,255,1,225,98,128,128,128,128,0,49,253,98,1,111,141,253,157,1,84,6,243,0,1,24,102,
+    253,157,1,134,105,254,98,1,86,37,252,0,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,252,0,
+    128,252,0,1,9,28,253,39,1,120,209,254,216,1,174,66,253,0,1,91,199,254,216,1,188,100,253,39,1,24,4,252,
+    0,246,0,1,117,245,254,255,1,206,78,253,0,1,108,235,254,255,1,216,88,246,0,246,0,1,108,226,254,235,1,193,
+    86,253,20,1,111,218,254,235,1,199,81,246,0,241,0,1,49,176,253,255,1,147,19,241,0,128,128,128,128,128,128,128,
+    128,128,128,1,9,28,226,39,1,34,15,1,59,186,226,255,1,225,98,128,1,36,114,231,157,1,194,243,254,255,1,225,
+    98,229,0,1,98,225,254,255,1,225,98,128,235,0,1,24,102,253,157,1,134,105,254,98,1,86,37,235,0,1,39,166,
+    253,255,1,157,29,252,0,128,240,0,1,91,199,254,216,1,188,100,253,39,1,24,4,252,0,240,0,1,108,235,254,255,
+    1,216,88,246,0,246,0,1,4,14,253,20,1,111,218,254,235,1,199,81,246,0,246,0,1,49,176,253,255,1,147,19,
+    241,0,128,251,0,1,36,75,254,78,1,97,146,253,177,1,102,13,241,0,251,0,1,117,245,254,255,1,206,78,235,0,
+    128,1,31,100,253,137,0,128,253,118,1,95,36,235,0,1,59,186,253,255,1,137,10,230,0,128,1,59,186,253,255,1,
+    228,198,232,196,1,173,75,1,59,186,226,255,1,225,98,128,1,108,226,243,235,1,199,81,1,117,245,243,255,1,216,88,
+    1,117,245,254,255,1,247,228,248,216,1,182,74,1,117,245,254,255,1,206,78,246,0,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,1,117,245,254,255,1,217,119,248,59,1,50,20,1,117,245,243,255,
+    1,216,88,128,1,63,132,243,137,1,116,47,1,54,172,253,235,1,126,9,235,0,1,59,186,253,255,1,137,10,235,0,
+    128,128,128,1,36,114,253,157,1,130,100,254,98,1,79,30,240,0,251,0,1,117,245,254,255,1,206,78,240,0,128,128,
+    128,128,251,0,1,18,37,254,39,1,73,161,253,216,1,124,16,246,0,246,0,1,49,176,253,255,1,147,19,246,0,128,
+    128,128,246,0,1,34,122,253,177,1,135,86,254,78,1,66,27,251,0,240,0,1,108,235,254,255,1,216,88,251,0,128,
+    128,128,128,240,0,1,25,54,254,59,1,80,148,253,196,1,120,22,235,0,1,39,166,253,255,1,157,29,128,128,128,235,
+    0,1,30,128,253,196,1,120,22,1,108,226,243,235,1,199,81,1,117,245,243,255,1,216,88,1,99,207,248,216,1,232,
+    252,254,255,1,216,88,246,0,1,108,235,254,255,1,216,88,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,1,27,56,248,59,1,142,240,254,255,1,216,88,1,117,245,243,255,1,216,88,128,1,63,132,
+    243,137,1,116,47,246,0,1,45,163,253,235,1,135,18,246,0,246,0,1,49,176,253,255,1,147,19,246,0,128,128,128,
+    251,0,1,45,94,254,98,1,109,139,253,157,1,132,102,254,98,1,83,34,251,0,251,0,1,117,245,254,255,1,206,78,
+    253,0,1,108,235,254,255,1,216,88,251,0,128,128,128,128,1,50,158,253,216,1,134,46,254,39,1,31,12,253,0,1,
+    16,36,254,39,1,66,155,253,216,1,133,25,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,128,
+    128,1,40,129,253,177,1,95,7,243,0,1,27,115,253,177,1,109,20,0,127,220,255,1,225,98,128,0,98,220,196,1,
+    173,75,1,108,226,254,235,1,190,72,251,0,1,117,245,254,255,1,206,78,251,0,1,99,207,254,216,1,182,93,253,39,
+    1,22,3,252,0,1,49,176,253,255,1,147,19,128,252,0,1,30,108,253,157,1,90,12,251,0,1,72,151,243,157,1,
+    133,54,251,0,251,0,1,117,245,243,255,1,216,88,251,0,128,251,0,1,18,37,243,39,1,66,155,253,216,1,133,25,
+    235,0,1,39,166,253,255,1,157,29,251,0,1,9,19,243,20,1,56,173,253,255,1,157,29,251,0,1,117,245,237,255,
+    1,157,29,128,1,18,57,253,78,1,123,173,243,177,1,189,228,253,255,1,157,29,1,59,186,253,255,1,137,10,243,0,
+    1,39,166,253,255,1,157,29,128,128,128,128,1,13,43,253,59,1,122,191,243,196,1,205,234,253,255,1,157,29,251,0,
+    1,117,245,237,255,1,157,29,128,251,0,1,72,151,243,157,1,133,54,251,0,251,0,1,117,245,243,255,1,216,88,251,
+    0,128,1,50,158,253,216,1,134,46,243,39,1,66,155,253,216,1,133,25,1,59,186,253,255,1,137,10,243,0,1,39,
+    166,253,255,1,157,29,1,59,186,253,255,1,137,10,243,0,1,36,153,253,235,1,144,27,1,59,186,253,255,1,137,10,
+    235,0,128,128,128,128,1,59,186,253,255,1,137,10,243,0,1,21,89,253,137,1,84,16,1,59,186,253,255,1,137,10,
+    243,0,1,39,166,253,255,1,157,29,128,1,13,43,253,59,1,122,191,243,196,1,175,106,253,59,1,36,7,251,0,1,
+    117,245,243,255,1,216,88,251,0,128,235,0,1,36,153,253,235,1,144,27,235,0,1,39,166,253,255,1,157,29,128,128,
+    128,128,128,128,251,0,1,72,151,243,157,1,172,221,253,255,1,157,29,251,0,1,117,245,237,255,1,157,29,128,1,50,
+    158,253,216,1,134,46,243,39,1,72,180,253,255,1,157,29,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,
+    157,29,128,128,128,128,128,128,128,128,128,1,13,43,253,59,1,122,191,243,196,1,205,234,253,255,1,157,29,251,0,1,
+    117,245,237,255,1,157,29,128,246,0,1,45,163,242,235,1,144,27,246,0,1,49,176,242,255,1,157,29,251,0,1,18,
+    37,254,39,1,73,161,242,216,1,133,25,251,0,1,117,245,254,255,1,206,78,240,0,128,128,128,128,1,36,114,253,157,
+    1,202,251,254,255,1,236,187,248,157,1,133,54,251,0,1,59,186,237,255,1,216,88,251,0,128,1,9,28,253,39,1,
+    138,246,254,255,1,213,105,248,39,1,33,13,251,0,251,0,1,117,245,254,255,1,206,78,240,0,128,128,128,128,128,128,
+    128,128,128,128,128,128,1,54,172,253,235,1,126,9,235,0,1,59,186,253,255,1,137,10,235,0,128,128,128,128,128,128,
+    1,59,186,253,255,1,209,160,243,157,1,133,54,251,0,1,59,186,237,255,1,216,88,251,0,128,1,59,186,253,255,1,
+    155,47,243,39,1,66,155,253,216,1,133,25,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,128,
+    128,128,128,128,128,128,128,128,128,128,252,0,1,45,163,253,235,1,135,18,252,0,1,49,176,253,255,1,147,19,252,0,
+    1,41,149,253,216,1,124,16,244,0,128,128,128,128,1,72,151,248,157,1,90,12,1,117,245,248,255,1,147,19,128,1,
+    18,37,254,39,1,80,188,253,255,1,147,19,252,0,1,49,176,253,255,1,147,19,128,128,128,128,128,128,128,128,128,128,
+    128,128,240,0,1,99,217,254,235,1,199,81,240,0,1,108,235,254,255,1,216,88,240,0,1,91,199,254,216,1,182,74,
+    233,0,128,128,128,128,246,0,1,30,108,248,157,1,133,54,246,0,1,49,176,248,255,1,216,88,128,246,0,1,7,27,
+    253,39,1,130,238,254,255,1,216,88,240,0,1,108,235,254,255,1,216,88,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,1,13,43,242,59,1,117,185,254,196,1,166,68,1,59,186,242,255,1,147,19,252,0,128,1,31,100,242,137,1,
+    79,10,252,0,1,54,172,253,235,1,126,9,235,0,1,59,186,253,255,1,137,10,235,0,128,128,128,128,128,128,1,59,
+    186,253,255,1,137,10,243,0,1,24,102,253,157,1,96,18,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,
+    157,29,128,1,59,186,253,255,1,137,10,248,0,1,91,199,254,216,1,188,100,253,39,1,24,4,1,59,186,253,255,1,
+    137,10,248,0,1,108,235,254,255,1,216,88,251,0,1,59,186,253,255,1,137,10,254,0,1,4,14,253,20,1,111,218,
+    254,235,1,199,81,251,0,1,59,186,253,255,1,137,10,254,0,1,49,176,253,255,1,147,19,246,0,128,1,59,186,253,
+    255,1,173,85,254,78,1,112,200,253,255,1,147,19,246,0,1,59,186,242,255,1,147,19,246,0,128,1,59,186,253,255,
+    1,191,123,248,118,1,126,135,254,137,1,116,47,251,0,1,59,186,253,255,1,137,10,248,0,1,108,235,254,255,1,216,
+    88,251,0,128,1,59,186,253,255,1,137,10,248,0,1,25,54,254,59,1,80,148,253,196,1,120,22,1,59,186,253,255,
+    1,137,10,243,0,1,39,166,253,255,1,157,29,128,1,108,226,248,235,1,135,18,1,117,245,248,255,1,147,19,1,99,
+    207,254,216,1,223,243,253,255,1,147,19,252,0,1,49,176,253,255,1,147,19,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,0,78,242,157,1,127,48,253,0,1,66,145,248,157,1,96,18,252,0,0,127,242,
+    255,1,206,78,253,0,1,108,235,248,255,1,157,29,252,0,128,0,127,253,255,1,205,97,248,39,1,73,161,253,216,1,
+    141,52,248,39,1,107,195,254,216,1,191,83,0,127,253,255,1,196,68,248,0,1,49,176,253,255,1,147,19,248,0,1,
+    98,225,254,255,1,225,98,128,128,128,128,128,128,128,128,128,128,128,128,1,36,114,237,157,1,133,54,251,0,1,59,186,
+    237,255,1,216,88,251,0,128,1,59,186,253,255,1,155,47,243,39,1,66,155,253,216,1,133,25,1,59,186,253,255,1,
+    137,10,243,0,1,39,166,253,255,1,157,29,128,128,128,128,128,128,128,128,128,128,128,128,251,0,1,72,151,243,157,1,
+    133,54,251,0,251,0,1,117,245,243,255,1,216,88,251,0,128,1,50,158,253,216,1,134,46,243,39,1,66,155,253,216,
+    1,133,25,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,128,128,128,128,128,128,128,128,1,13,
+    43,253,59,1,122,191,243,196,1,175,106,253,59,1,36,7,251,0,1,117,245,243,255,1,216,88,251,0,128,1,36,114,
+    237,157,1,133,54,251,0,1,59,186,237,255,1,216,88,251,0,128,1,59,186,253,255,1,155,47,243,39,1,66,155,253,
+    216,1,133,25,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,128,128,128,128,128,128,128,128,1,
+    59,186,253,255,1,228,198,243,196,1,175,106,253,59,1,36,7,1,59,186,237,255,1,216,88,251,0,128,1,59,186,253,
+    255,1,137,10,235,0,128,128,128,128,128,128,128,1,18,57,253,78,1,42,3,235,0,251,0,1,72,151,237,157,1,96,
+    18,251,0,1,117,245,237,255,1,157,29,128,1,50,158,253,216,1,134,46,243,39,1,72,180,253,255,1,157,29,1,59,
+    186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,128,128,128,128,128,128,128,128,1,13,43,253,59,1,122,
+    191,243,196,1,205,234,253,255,1,157,29,251,0,1,117,245,237,255,1,157,29,128,235,0,1,39,166,253,255,1,157,29,
+    128,128,128,128,128,128,128,235,0,1,12,51,253,78,1,48,9,1,36,114,253,157,1,84,6,254,0,1,30,108,248,157,
+    1,133,54,251,0,1,59,186,253,255,1,137,10,254,0,1,49,176,248,255,1,216,88,251,0,128,1,59,186,253,255,1,
+    237,217,254,216,1,182,93,248,39,1,66,155,253,216,1,133,25,1,59,186,248,255,1,206,78,248,0,1,39,166,253,255,
+    1,157,29,1,59,186,253,255,1,246,236,254,235,1,190,72,248,0,1,36,153,253,235,1,144,27,1,59,186,253,255,1,
+    137,10,235,0,128,128,128,128,128,128,128,128,128,128,251,0,1,72,151,237,157,1,96,18,251,0,1,117,245,237,255,1,
+    157,29,128,1,50,158,253,216,1,134,46,237,39,1,24,4,1,59,186,253,255,1,137,10,235,0,1,54,172,253,235,1,
+    135,28,248,20,1,11,1,246,0,251,0,1,117,245,248,255,1,147,19,246,0,128,251,0,1,81,170,248,177,1,135,86,
+    254,78,1,66,27,251,0,240,0,1,108,235,254,255,1,216,88,251,0,128,240,0,1,50,109,254,118,1,121,130,253,137,
+    1,84,16,235,0,1,39,166,253,255,1,157,29,128,1,45,143,237,196,1,175,106,253,59,1,36,7,1,59,186,237,255,
+    1,216,88,251,0,128,1,18,37,254,39,1,31,12,240,0,1,117,245,254,255,1,206,78,240,0,128,128,128,128,1,117,
+    245,254,255,1,236,187,242,157,1,96,18,1,117,245,237,255,1,157,29,128,1,117,245,254,255,1,213,105,242,39,1,24,
+    4,1,117,245,254,255,1,206,78,240,0,128,128,128,128,128,128,128,128,128,1,27,56,254,59,1,85,154,242,196,1,120,
+    22,252,0,1,49,176,242,255,1,157,29,128,1,36,114,253,157,1,84,6,243,0,1,24,102,253,157,1,96,18,1,59,
+    186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,29,128,128,128,1,54,172,253,235,1,135,28,254,20,1,16,6,
+    253,0,1,8,18,254,20,1,53,160,253,235,1,144,27,251,0,1,117,245,254,255,1,206,78,253,0,1,108,235,254,255,
+    1,216,88,251,0,128,128,128,128,251,0,1,54,113,254,118,1,121,131,253,137,1,129,119,254,118,1,99,40,251,0,246,
+    0,1,49,176,253,255,1,147,19,246,0,128,128,128,128,0,78,253,157,1,120,42,231,0,1,60,139,254,157,1,139,60,
+    0,127,253,255,1,196,68,231,0,1,98,225,254,255,1,225,98,128,0,127,253,255,1,196,68,248,0,1,41,149,253,216,
+    1,124,16,248,0,1,98,225,254,255,1,225,98,0,127,253,255,1,196,68,248,0,1,49,176,253,255,1,147,19,248,0,
+    1,98,225,254,255,1,225,98,128,128,128,0,127,253,255,1,196,68,253,0,1,36,75,254,78,1,97,146,253,177,1,135,
+    86,254,78,1,66,27,253,0,1,98,225,254,255,1,225,98,0,127,253,255,1,196,68,253,0,1,117,245,254,255,1,206,
+    78,253,0,1,108,235,254,255,1,216,88,253,0,1,98,225,254,255,1,225,98,128,0,59,253,118,1,122,132,253,137,1,
+    191,250,254,255,1,206,78,253,0,1,108,235,254,255,1,237,178,253,137,1,129,120,254,118,1,104,45,252,0,1,59,186,
+    248,255,1,206,78,253,0,1,108,235,248,255,1,157,29,252,0,128,252,0,1,59,186,253,255,1,164,66,254,59,1,47,
+    18,253,0,1,25,54,254,59,1,89,187,253,255,1,157,29,252,0,252,0,1,59,186,253,255,1,137,10,243,0,1,39,
+    166,253,255,1,157,29,252,0,128,1,36,114,253,157,1,84,6,243,0,1,24,102,253,157,1,96,18,1,59,186,253,255,
+    1,137,10,243,0,1,39,166,253,255,1,157,29,128,1,9,28,253,39,1,120,209,254,216,1,174,66,253,0,1,91,199,
+    254,216,1,188,100,253,39,1,24,4,251,0,1,117,245,254,255,1,206,78,253,0,1,108,235,254,255,1,216,88,251,0,
+    251,0,1,108,226,254,235,1,193,86,253,20,1,111,218,254,235,1,199,81,251,0,246,0,1,49,176,253,255,1,147,19,
+    246,0,128,128,128,128,251,0,1,63,132,254,137,1,133,124,253,118,1,126,135,254,137,1,116,47,251,0,251,0,1,117,
+    245,254,255,1,206,78,253,0,1,108,235,254,255,1,216,88,251,0,128,1,45,143,253,196,1,132,64,254,59,1,47,18,
+    253,0,1,25,54,254,59,1,80,148,253,196,1,120,22,1,59,186,253,255,1,137,10,243,0,1,39,166,253,255,1,157,
+    29,128,1,36,114,253,157,1,84,6,243,0,1,24,102,253,157,1,96,18,1,59,186,253,255,1,137,10,243,0,1,39,
+    166,253,255,1,157,29,128,128,128,128,128,128,128,128,128,128,128,128,1,13,43,253,59,1,122,191,243,196,1,205,234,253,
+    255,1,157,29,251,0,1,117,245,237,255,1,157,29,128,235,0,1,39,166,253,255,1,157,29,128,128,128,128,251,0,1,
+    54,113,243,118,1,121,130,253,137,1,84,16,251,0,1,117,245,243,255,1,216,88,251,0,128,251,0,1,36,75,243,78,
+    1,66,27,251,0,1,36,114,231,157,1,96,18,1,59,186,231,255,1,157,29,128,1,9,28,237,39,1,72,180,253,255,
+    1,157,29,235,0,1,39,166,253,255,1,157,29,240,0,1,8,18,254,20,1,53,160,253,235,1,144,27,240,0,1,108,
+    235,254,255,1,216,88,251,0,128,246,0,1,15,54,253,78,1,119,169,254,177,1,149,61,251,0,246,0,1,49,176,253,
+    255,1,147,19,246,0,128,251,0,1,63,132,254,137,1,133,124,253,118,1,68,9,246,0,251,0,1,117,245,254,255,1,
+    206,78,240,0,128,1,45,143,253,196,1,223,252,254,255,1,243,214,242,196,1,120,22,1,59,186,231,255,1,157,29,128,
+    240,0,1,99,217,248,235,1,144,27,240,0,1,108,235,248,255,1,157,29,246,0,1,7,27,253,39,1,114,202,248,216,
+    1,133,25,246,0,1,49,176,253,255,1,147,19,246,0,128,128,128,128,128,128,128,128,128,1,4,14,248,20,1,61,169,
+    253,235,1,135,18,246,0,1,59,186,248,255,1,206,78,240,0,128,1,40,129,248,177,1,158,108,253,78,1,45,6,246,
+    0,246,0,1,49,176,253,255,1,147,19,246,0,128,128,128,128,128,128,128,128,128,246,0,1,37,135,253,196,1,138,69,
+    248,59,1,36,7,240,0,1,108,235,248,255,1,157,29,128,240,0,1,58,126,248,137,1,84,16,1,45,163,253,235,1,
+    135,18,1,49,176,253,255,1,147,19,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,1,26,95,253,137,1,79,10,1,54,172,248,235,1,190,72,240,0,1,59,186,248,255,1,206,78,
+    240,0,1,50,158,248,216,1,182,93,253,39,1,22,3,246,0,246,0,1,49,176,253,255,1,147,19,246,0,128,128,128,
+    128,128,128,128,128,128,246,0,1,45,163,253,235,1,144,36,248,20,1,12,2,240,0,1,108,235,248,255,1,157,29,128,
+    246,0,1,15,54,253,78,1,119,169,248,177,1,109,20,246,0,1,49,176,253,255,1,147,19,246,0,128,128,128,128,128,
+    128,128,128,128,1,13,43,248,59,1,85,154,253,196,1,113,15,246,0,1,59,186,248,255,1,206,78,240,0,128,1,31,
+    100,248,137,1,110,42,240,0,252,0,1,50,158,242,216,1,124,16,248,0,1,83,191,254,216,1,191,83,252,0,1,59,
+    186,242,255,1,147,19,248,0,1,98,225,254,255,1,225,98,0,10,253,20,1,69,177,248,235,1,239,249,253,255,1,155,
+    38,248,20,1,103,210,254,235,1,208,90,0,127,253,255,1,196,68,248,0,1,49,176,242,255,1,157,29,252,0,128,0,
+    88,253,177,1,136,47,248,0,1,34,122,242,177,1,109,20,252,0,0,50,246,59,0,45,250,0,0,216,246,255,0,196,
+    250,0,128,3,216,255,255,241,249,235,3,186,20,20,18,253,0,3,216,255,255,78,249,0,3,59,255,255,235,253,0,128,
+    128,3,216,255,255,78,249,0,3,5,20,20,36,254,235,0,18,3,216,255,255,78,246,0,0,20,254,255,0,20,128,128,
+    128,128,128,128,128,128,128,128,3,216,255,255,78,249,0,3,18,78,78,86,254,177,0,14,3,216,255,255,78,249,0,3,
+    59,255,255,235,253,0,128,3,216,255,255,106,249,39,3,80,216,216,199,253,0,0,216,246,255,0,196,250,0,128,128,254,
+    0,0,163,249,235,0,181,254,0,254,0,0,177,249,255,0,196,254,0,128,3,166,196,196,101,249,59,3,91,196,196,181,
+    3,216,255,255,78,249,0,3,59,255,255,235,128,3,216,255,255,187,249,157,3,180,255,255,235,0,216,243,255,0,235,128,
+    3,216,255,255,174,246,137,0,127,3,216,255,255,78,245,0,128,3,216,255,255,78,249,0,3,18,78,78,72,3,216,255,
+    255,78,249,0,3,59,255,255,235,128,3,183,216,216,94,249,39,3,80,216,216,199,254,0,0,177,249,255,0,196,254,0,
+    128,128,3,83,98,98,30,245,0,3,216,255,255,78,245,0,128,128,128,128,128,128,128,128,3,216,255,255,241,249,235,0,
+    181,254,0,0,216,246,255,0,196,254,0,128,3,216,255,255,119,249,59,3,91,196,196,181,3,216,255,255,78,249,0,3,
+    59,255,255,235,128,128,128,128,128,128,128,128,128,128,3,216,255,255,106,249,39,3,80,216,216,199,0,216,246,255,0,196,
+    254,0,128,128,3,199,235,235,72,249,0,3,54,235,235,217,3,216,255,255,78,249,0,3,59,255,255,235,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,3,183,216,216,94,249,39,3,89,255,255,235,254,0,0,177,246,255,0,235,128,128,254,
+    0,0,163,246,235,0,217,254,0,0,177,246,255,0,235,128,3,166,196,196,101,249,59,3,104,255,255,235,3,216,255,255,
+    78,249,0,3,59,255,255,235,128,128,128,128,128,128,128,128,128,128,3,183,216,216,94,249,39,3,89,255,255,235,254,0,
+    0,177,246,255,0,235,128,128,245,0,3,59,255,255,235,128,128,128,128,128,254,0,0,122,249,177,3,154,78,78,72,254,
+    0,0,177,249,255,0,196,254,0,128,254,0,0,81,249,118,0,91,254,0,3,32,59,59,36,3,137,255,255,157,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,3,95,177,177,109,253,0,128,3,21,39,39,24,3,137,255,255,
+    157,128,128,9,68,98,98,45,0,0,38,98,98,75,9,177,255,255,118,0,0,98,255,255,196,128,128,128,128,128,128,128,
+    128,9,14,20,20,9,0,0,8,20,20,15,248,0,9,32,59,59,36,0,0,14,59,59,54,253,0,248,0,9,137,255,
+    255,157,0,0,59,255,255,235,253,0,128,128,128,128,128,254,0,0,199,252,235,9,246,255,255,247,235,235,240,255,255,253,
+    254,235,0,18,254,0,0,216,239,255,0,20,128,254,0,12,50,59,59,195,255,255,149,59,59,134,255,255,210,251,59,0,
+    5,251,0,9,177,255,255,118,0,0,98,255,255,196,250,0,128,128,128,128,251,118,12,213,255,255,181,118,118,171,255,255,
+    223,118,118,109,253,0,239,255,0,235,253,0,128,254,177,9,243,255,255,201,177,177,219,255,255,225,252,177,0,163,253,0,
+    254,0,9,216,255,255,78,0,0,137,255,255,157,247,0,128,128,128,128,128,251,0,3,32,59,59,36,251,0,251,0,3,
+    137,255,255,157,251,0,128,254,0,6,14,20,20,146,255,255,164,252,20,0,18,254,0,0,177,246,255,0,235,128,128,9,
+    199,235,235,86,20,20,146,255,255,164,252,20,0,18,9,216,255,255,78,0,0,137,255,255,157,251,0,128,128,128,128,12,
+    83,98,98,139,157,157,210,255,255,217,157,157,121,254,0,254,0,0,177,249,255,0,196,254,0,128,254,0,12,95,137,137,
+    201,255,255,210,137,137,133,118,118,109,251,0,9,137,255,255,157,0,0,59,255,255,235,128,128,128,128,0,33,252,39,9,
+    155,255,255,172,39,39,80,216,216,199,0,216,246,255,0,196,254,0,128,128,251,0,3,137,255,255,157,251,0,128,128,251,
+    0,3,21,39,39,24,251,0,254,0,3,50,59,59,18,249,0,3,14,59,59,54,253,0,254,0,3,216,255,255,78,249,
+    0,3,59,255,255,235,253,0,128,254,20,15,202,235,235,86,20,20,9,0,0,8,20,20,69,235,235,217,253,0,254,255,
+    12,39,0,0,177,255,255,118,0,0,98,255,255,196,250,0,128,128,128,128,128,254,59,12,175,196,196,101,59,59,133,196,
+    196,143,59,59,45,250,0,254,0,9,216,255,255,78,0,0,137,255,255,157,247,0,128,254,0,15,83,98,98,30,0,0,
+    137,255,255,157,0,0,36,157,157,145,253,0,248,0,9,137,255,255,157,0,0,59,255,255,235,253,0,128,251,0,12,81,
+    118,118,128,137,137,130,118,118,122,137,137,136,254,118,0,9,251,0,12,177,255,255,118,0,0,98,255,255,196,0,0,20,
+    254,255,0,20,128,128,128,128,254,0,15,33,39,39,161,216,216,100,0,0,83,216,216,175,39,39,53,254,216,0,17,254,
+    0,3,216,255,255,78,249,0,3,59,255,255,235,253,0,128,128,254,0,0,41,252,59,0,36,247,0,254,0,0,177,252,
+    255,0,157,247,0,128,3,17,20,20,169,252,235,3,152,20,20,15,250,0,3,216,255,255,78,252,0,3,98,255,255,196,
+    250,0,128,128,128,128,128,3,50,59,59,154,252,196,6,143,59,59,45,0,0,15,254,196,0,15,254,0,0,177,252,255,
+    0,157,252,0,0,20,254,255,0,20,128,3,133,157,157,116,252,98,6,121,157,157,121,0,0,20,254,255,0,20,3,216,
+    255,255,78,252,0,6,98,255,255,196,0,0,20,254,255,0,20,128,3,216,255,255,78,252,0,6,53,137,137,133,118,118,
+    119,254,137,0,11,3,216,255,255,78,249,0,3,59,255,255,235,253,0,128,128,128,128,3,183,216,216,94,249,39,3,80,
+    216,216,202,254,39,0,3,254,0,0,177,249,255,3,196,0,0,20,254,255,0,20,128,128,3,53,98,98,60,3,137,255,
+    255,157,128,128,128,128,128,128,128,128,3,11,20,20,12,251,0,3,38,98,98,75,251,0,3,98,255,255,196,128,254,0,
+    6,32,59,59,112,196,196,151,254,0,3,137,255,255,157,254,0,128,128,128,128,128,6,163,235,235,119,20,20,12,254,0,
+    3,177,255,255,118,251,0,128,128,128,128,128,128,128,128,128,128,128,128,128,6,149,216,216,121,39,39,24,254,0,254,0,
+    3,137,255,255,157,254,0,128,128,128,128,128,254,0,6,21,39,39,107,216,216,166,251,0,3,98,255,255,196,128,251,0,
+    3,30,78,78,60,3,68,98,98,45,251,0,3,177,255,255,118,251,0,128,6,136,196,196,122,59,59,36,254,0,254,0,
+    3,137,255,255,157,254,0,128,128,128,128,128,254,0,6,11,20,20,103,235,235,181,251,0,3,98,255,255,196,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,254,0,6,21,39,39,107,216,216,166,254,0,3,137,255,255,157,254,0,128,128,128,
+    128,128,6,149,216,216,121,39,39,24,254,0,3,177,255,255,118,251,0,128,3,54,78,78,36,251,0,251,0,3,127,235,
+    235,145,251,0,251,0,3,137,255,255,157,251,0,128,15,166,196,196,60,0,0,137,255,255,157,0,0,45,196,196,181,15,
+    216,255,255,78,0,0,137,255,255,157,0,0,59,255,255,235,128,15,83,98,98,139,157,157,210,255,255,217,157,157,143,98,
+    98,91,254,0,0,177,249,255,0,196,254,0,128,15,100,118,118,131,137,137,201,255,255,210,137,137,133,118,118,109,15,216,
+    255,255,78,0,0,137,255,255,157,0,0,59,255,255,235,128,15,149,177,177,54,0,0,137,255,255,157,0,0,41,177,177,
+    163,251,0,3,137,255,255,157,251,0,128,251,0,3,116,216,216,133,251,0,251,0,3,127,235,235,145,251,0,251,0,3,
+    137,255,255,157,251,0,128,128,128,128,0,133,252,157,3,210,255,255,217,252,157,0,145,0,216,243,255,0,235,128,0,116,
+    252,137,3,201,255,255,210,252,137,0,127,251,0,3,137,255,255,157,251,0,128,128,128,128,251,0,3,116,216,216,133,251,
+    0,254,0,3,54,78,78,36,254,0,3,177,255,255,118,128,128,128,128,128,128,128,128,6,183,216,216,94,39,39,18,3,
+    216,255,255,78,254,0,128,3,66,78,78,24,254,0,0,133,243,157,0,145,0,216,243,255,0,235,128,0,116,243,137,0,
+    127,3,54,78,78,36,3,177,255,255,118,128,128,128,128,128,245,0,3,23,98,98,91,245,0,3,59,255,255,235,128,128,
+    128,128,248,0,6,8,20,20,69,235,235,217,248,0,3,98,255,255,196,254,0,128,128,128,128,128,251,0,6,106,196,196,
+    143,59,59,45,254,0,251,0,3,137,255,255,157,251,0,128,128,128,128,254,0,6,81,118,118,128,137,137,84,251,0,254,
+    0,3,177,255,255,118,248,0,128,128,128,128,6,33,39,39,161,216,216,100,248,0,3,216,255,255,78,245,0,128,128,128,
+    128,128,3,33,39,39,12,245,0,254,0,0,41,249,59,0,45,254,0,254,0,0,177,249,255,0,196,254,0,128,3,17,
+    20,20,169,249,235,3,186,20,20,18,3,216,255,255,78,249,0,3,59,255,255,235,128,128,128,128,128,15,216,255,255,78,
+    0,0,106,196,196,121,0,0,59,255,255,235,15,216,255,255,78,0,0,137,255,255,157,0,0,59,255,255,235,128,128,128,
+    128,15,216,255,255,78,0,0,74,137,137,84,0,0,59,255,255,235,3,216,255,255,78,249,0,3,59,255,255,235,128,128,
+    128,128,3,183,216,216,94,249,39,3,80,216,216,199,254,0,0,177,249,255,0,196,254,0,128,128,251,0,3,32,59,59,
+    36,251,0,251,0,3,137,255,255,157,251,0,128,254,0,6,14,20,20,146,255,255,157,251,0,254,0,0,177,252,255,0,
+    157,251,0,128,128,9,199,235,235,86,20,20,146,255,255,157,251,0,9,216,255,255,78,0,0,137,255,255,157,251,0,128,
+    9,50,59,59,18,0,0,137,255,255,157,251,0,251,0,3,137,255,255,157,251,0,128,128,128,128,128,128,128,128,128,128,
+    0,33,252,39,3,155,255,255,172,252,39,0,36,0,216,243,255,0,235,128,128,254,0,0,41,249,59,0,45,254,0,254,
+    0,0,177,249,255,0,196,254,0,128,3,17,20,20,169,249,235,3,186,20,20,18,3,216,255,255,78,249,0,3,59,255,
+    255,235,128,128,3,17,20,20,6,249,0,3,59,255,255,235,245,0,3,59,255,255,235,128,248,0,6,75,196,196,164,59,
+    59,54,248,0,3,98,255,255,196,254,0,128,251,0,6,84,157,157,134,98,98,75,254,0,251,0,3,137,255,255,157,251,
+    0,128,254,0,6,81,118,118,128,137,137,84,251,0,254,0,3,177,255,255,118,248,0,128,6,66,78,78,146,177,177,81,
+    248,0,3,216,255,255,78,245,0,128,3,216,255,255,106,246,39,0,36,0,216,243,255,0,235,128,128,254,0,0,41,249,
+    59,0,45,254,0,254,0,0,177,249,255,0,196,254,0,128,3,17,20,20,169,249,235,3,186,20,20,18,3,216,255,255,
+    78,249,0,3,59,255,255,235,128,128,3,17,20,20,6,249,0,3,59,255,255,235,245,0,3,59,255,255,235,128,251,0,
+    0,106,252,196,3,164,59,59,54,251,0,0,137,252,255,0,196,254,0,128,251,0,0,53,252,98,3,112,157,157,145,245,
+    0,3,59,255,255,235,128,128,128,128,3,66,78,78,24,249,0,3,59,255,255,235,3,216,255,255,78,249,0,3,59,255,
+    255,235,128,3,183,216,216,94,249,39,3,80,216,216,199,254,0,0,177,249,255,0,196,254,0,128,128,245,0,3,14,59,
+    59,54,253,0,245,0,3,59,255,255,235,253,0,128,248,0,6,8,20,20,74,255,255,235,253,0,248,0,0,98,252,255,
+    0,235,253,0,128,128,251,0,9,127,235,235,152,20,20,74,255,255,235,253,0,251,0,9,137,255,255,157,0,0,59,255,
+    255,235,253,0,128,254,0,12,136,196,196,122,59,59,36,0,0,59,255,255,235,253,0,254,0,3,177,255,255,118,252,0,
+    3,59,255,255,235,253,0,128,6,133,157,157,116,98,98,45,252,0,3,59,255,255,235,253,0,3,216,255,255,78,249,0,
+    3,59,255,255,235,253,0,128,3,216,255,255,160,249,118,3,149,255,255,244,254,118,0,9,0,216,239,255,0,20,128,0,
+    149,246,177,3,195,255,255,249,254,177,0,14,245,0,3,59,255,255,235,253,0,128,128,128,128,128,0,50,243,59,0,54,
+    0,216,243,255,0,235,128,3,216,255,255,241,246,235,0,217,3,216,255,255,78,245,0,128,128,128,128,128,3,216,255,255,
+    214,249,196,0,151,254,0,0,216,246,255,0,196,254,0,128,0,83,246,98,3,112,157,157,145,245,0,3,59,255,255,235,
+    128,128,128,128,3,66,78,78,24,249,0,3,59,255,255,235,3,216,255,255,78,249,0,3,59,255,255,235,128,3,183,216,
+    216,94,249,39,3,80,216,216,199,254,0,0,177,249,255,0,196,254,0,128,128,251,0,0,32,252,59,0,45,254,0,251,
+    0,0,137,252,255,0,196,254,0,128,254,0,3,14,20,20,136,252,235,0,181,254,0,254,0,3,177,255,255,118,248,0,
+    128,128,6,199,235,235,86,20,20,9,248,0,3,216,255,255,78,245,0,128,3,216,255,255,214,249,196,0,151,254,0,0,
+    216,246,255,0,196,254,0,128,3,216,255,255,146,249,98,3,112,157,157,145,3,216,255,255,78,249,0,3,59,255,255,235,
+    128,128,128,128,128,128,128,3,183,216,216,94,249,39,3,80,216,216,199,254,0,0,177,249,255,0,196,254,0,128,128,0,
+    50,243,59,0,54,0,216,243,255,0,235,128,0,199,246,235,3,240,255,255,235,245,0,3,59,255,255,235,128,128,248,0,
+    6,91,235,235,186,20,20,18,248,0,3,98,255,255,196,254,0,128,128,128,128,251,0,6,84,157,157,134,98,98,75,254,
+    0,251,0,3,137,255,255,157,251,0,128,128,128,128,254,0,6,54,78,78,131,177,177,109,251,0,254,0,3,177,255,255,
+    118,248,0,128,128,128,128,128,254,0,0,41,249,59,0,45,254,0,254,0,0,177,249,255,0,196,254,0,128,3,17,20,
+    20,169,249,235,3,186,20,20,18,3,216,255,255,78,249,0,3,59,255,255,235,128,128,128,128,128,3,50,59,59,154,249,
+    196,3,164,59,59,54,254,0,0,177,249,255,0,196,254,0,128,3,133,157,157,116,249,98,3,112,157,157,145,3,216,255,
+    255,78,249,0,3,59,255,255,235,128,128,128,128,128,128,128,3,183,216,216,94,249,39,3,80,216,216,199,254,0,0,177,
+    249,255,0,196,254,0,128,128,254,0,0,41,249,59,0,45,254,0,254,0,0,177,249,255,0,196,254,0,128,3,17,20,
+    20,169,249,235,3,186,20,20,18,3,216,255,255,78,249,0,3,59,255,255,235,128,128,128,128,128,128,128,128,3,83,98,
+    98,139,249,157,3,180,255,255,235,254,0,0,177,246,255,0,235,128,254,0,0,95,249,137,3,164,255,255,235,245,0,3,
+    59,255,255,235,128,248,0,6,30,78,78,101,177,177,163,248,0,3,98,255,255,196,254,0,128,254,0,0,27,252,39,3,
+    107,216,216,166,254,0,254,0,0,177,252,255,0,157,251,0,128,128,3,127,235,235,145,3,137,255,255,157,128,128,128,128,
+    3,53,98,98,60,253,0,128,128,128,128,3,42,78,78,48,3,137,255,255,157,128,128,128,128,128,254,0,3,163,235,235,
+    109,254,0,3,177,255,255,118,128,128,128,128,254,0,3,68,98,98,45,250,0,128,128,128,128,254,0,3,54,78,78,36,
+    254,0,3,177,255,255,118,128,128,128,128,128,128,128,128,6,183,216,216,94,39,39,18,3,216,255,255,78,254,0,128,3,
+    66,78,78,24,254,0,245,0,0,91,252,235,0,217,245,0,0,98,252,255,0,235,128,251,0,0,136,252,196,0,143,252,
+    59,0,54,251,0,0,177,252,255,0,157,251,0,128,251,157,0,116,252,98,0,60,251,0,251,255,0,78,245,0,128,251,
+    137,0,124,252,118,0,72,251,0,251,0,0,177,252,255,0,157,251,0,128,251,0,0,122,252,177,0,139,252,78,0,72,
+    245,0,0,98,252,255,0,235,128,245,0,0,83,252,216,0,199,0,166,239,196,0,15,0,216,239,255,0,20,128,0,83,
+    239,98,0,8,237,0,128,0,100,239,118,0,9,0,216,239,255,0,20,128,0,149,239,177,0,14,0,199,252,235,0,109,
+    244,0,0,216,252,255,0,118,244,0,128,0,50,252,59,0,133,252,196,0,151,250,0,251,0,0,137,252,255,0,196,250,
+    0,128,251,0,0,53,252,98,0,112,251,157,0,12,245,0,0,59,251,255,0,20,128,251,0,0,63,252,118,0,122,251,
+    137,0,11,251,0,0,137,252,255,0,196,250,0,128,0,66,252,78,0,131,252,177,0,136,250,0,0,216,252,255,0,118,
+    244,0,128,0,183,252,216,0,100,244,0,254,0,0,41,249,59,0,45,254,0,254,0,0,177,249,255,0,196,254,0,128,
+    3,17,20,20,169,249,235,3,186,20,20,18,3,216,255,255,78,249,0,3,59,255,255,235,128,128,3,17,20,20,6,249,
+    0,3,59,255,255,235,245,0,3,59,255,255,235,128,248,0,6,75,196,196,164,59,59,54,248,0,3,98,255,255,196,254,
+    0,128,251,0,6,84,157,157,134,98,98,75,254,0,251,0,3,137,255,255,157,251,0,128,128,128,128,251,0,3,95,177,
+    177,109,251,0,241,0,128,251,0,3,21,39,39,24,251,0,251,0,3,137,255,255,157,251,0,128,128,251,0,0,41,249,
+    59,0,45,250,0,251,0,0,177,249,255,0,196,250,0,128,254,0,3,17,20,20,169,249,235,3,186,20,20,18,253,0,
+    254,0,3,216,255,255,78,249,0,3,59,255,255,235,253,0,128,128,254,235,6,53,20,20,6,0,0,127,252,235,3,186,
+    20,20,36,254,235,0,18,254,255,0,39,252,0,0,137,252,255,3,196,0,0,20,254,255,0,20,128,254,255,15,39,0,
+    0,136,196,196,122,59,59,134,255,255,196,0,0,20,254,255,0,20,254,255,15,39,0,0,177,255,255,118,0,0,98,255,
+    255,196,0,0,20,254,255,0,20,128,128,128,128,254,255,15,39,0,0,95,137,137,127,118,118,171,255,255,223,118,118,119,
+    254,137,0,11,254,255,0,39,252,0,0,137,249,255,0,235,253,0,128,254,177,6,94,78,78,24,0,0,95,249,177,0,
+    163,253,0,254,0,3,216,255,255,78,241,0,128,254,0,3,183,216,216,94,246,39,0,36,253,0,251,0,0,177,246,255,
+    0,235,253,0,128,128,251,0,0,32,252,59,0,45,250,0,251,0,0,137,252,255,0,196,250,0,128,128,128,128,128,254,
+    0,3,163,235,235,119,252,20,3,69,235,235,217,253,0,254,0,3,177,255,255,118,252,0,3,59,255,255,235,253,0,128,
+    128,128,128,254,0,3,177,255,255,202,252,157,3,180,255,255,235,253,0,254,0,0,177,246,255,0,235,253,0,128,3,100,
+    118,118,131,246,137,0,136,254,118,0,9,3,216,255,255,78,246,0,0,20,254,255,0,20,128,128,128,128,128,128,128,128,
+    0,50,246,59,0,45,250,0,0,216,246,255,0,196,250,0,128,3,216,255,255,241,249,235,3,186,20,20,18,253,0,3,
+    216,255,255,78,249,0,3,59,255,255,235,253,0,128,128,128,128,128,3,216,255,255,214,249,196,3,210,255,255,235,253,0,
+    0,216,243,255,0,235,253,0,128,3,216,255,255,146,246,98,0,103,254,157,0,12,3,216,255,255,78,246,0,0,20,254,
+    255,0,20,128,128,128,128,128,128,128,3,216,255,255,106,246,39,0,53,254,216,0,17,0,216,243,255,0,235,253,0,128,
+    128,251,0,0,32,249,59,0,54,253,0,251,0,0,137,249,255,0,235,253,0,128,254,0,3,14,20,20,136,249,235,0,
+    219,254,20,0,2,254,0,3,177,255,255,118,249,0,0,20,254,255,0,20,128,128,6,199,235,235,86,20,20,9,249,0,
+    0,2,254,20,0,2,3,216,255,255,78,241,0,128,128,128,128,128,128,128,128,128,128,6,149,177,177,109,78,78,36,249,
+    0,0,6,254,78,0,6,254,0,3,177,255,255,118,249,0,0,20,254,255,0,20,128,254,0,3,149,216,216,121,249,39,
+    0,53,254,216,0,17,251,0,0,137,249,255,0,235,253,0,128,128,0,50,243,59,0,54,0,216,243,255,0,235,128,3,
+    216,255,255,241,246,235,0,217,3,216,255,255,78,245,0,128,128,128,128,128,3,216,255,255,214,249,196,0,151,254,0,0,
+    216,246,255,0,196,254,0,128,3,216,255,255,146,249,98,0,75,254,0,3,216,255,255,78,245,0,128,128,128,128,128,128,
+    128,3,216,255,255,106,246,39,0,36,0,216,243,255,0,235,128,128,0,50,243,59,0,54,0,216,243,255,0,235,128,3,
+    216,255,255,241,246,235,0,217,3,216,255,255,78,245,0,128,128,128,128,128,3,216,255,255,214,249,196,0,151,254,0,0,
+    216,246,255,0,196,254,0,128,3,216,255,255,146,249,98,0,75,254,0,3,216,255,255,78,245,0,128,128,128,128,128,128,
+    128,128,128,128,128,251,0,0,32,249,59,0,54,253,0,251,0,0,137,249,255,0,235,253,0,128,254,0,3,14,20,20,
+    136,249,235,0,219,254,20,0,2,254,0,3,177,255,255,118,249,0,0,20,254,255,0,20,128,128,6,199,235,235,86,20,
+    20,9,249,0,0,2,254,20,0,2,3,216,255,255,78,241,0,128,128,128,128,3,216,255,255,78,252,0,0,60,248,157,
+    0,12,3,216,255,255,78,252,0,0,98,248,255,0,20,128,3,216,255,255,78,252,0,0,53,252,137,0,146,254,255,0,
+    20,3,216,255,255,78,246,0,0,20,254,255,0,20,128,6,149,177,177,109,78,78,36,249,0,0,20,254,255,0,20,254,
+    0,3,177,255,255,118,249,0,0,20,254,255,0,20,128,254,0,3,149,216,216,121,249,39,0,53,254,216,0,17,251,0,
+    0,137,249,255,0,235,253,0,128,128,3,50,59,59,18,246,0,0,5,254,59,0,5,3,216,255,255,78,246,0,0,20,
+    254,255,0,20,128,128,128,128,128,128,128,128,3,216,255,255,214,246,196,0,201,254,255,0,20,0,216,239,255,0,20,128,
+    3,216,255,255,146,246,98,0,110,254,255,0,20,3,216,255,255,78,246,0,0,20,254,255,0,20,128,128,128,128,128,128,
+    128,128,128,128,128,0,41,249,59,0,45,0,177,249,255,0,196,128,9,163,235,235,246,255,255,247,235,235,181,254,0,3,
+    137,255,255,157,254,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,9,27,39,39,155,255,255,172,39,
+    39,30,0,177,249,255,0,196,128,128,254,0,0,41,249,59,0,45,254,0,0,177,249,255,0,196,128,254,0,0,163,252,
+    235,3,243,255,255,196,248,0,3,98,255,255,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,33,
+    249,39,3,107,216,216,166,0,216,249,255,0,157,254,0,128,128,3,50,59,59,18,246,0,0,5,254,59,0,5,3,216,
+    255,255,78,246,0,0,20,254,255,0,20,128,3,216,255,255,78,249,0,3,5,20,20,36,254,235,0,18,3,216,255,255,
+    78,249,0,3,59,255,255,235,253,0,128,128,3,216,255,255,78,252,0,6,91,235,235,186,20,20,18,253,0,3,216,255,
+    255,78,252,0,3,98,255,255,196,250,0,128,12,216,255,255,78,0,0,106,196,196,143,59,59,45,250,0,9,216,255,255,
+    78,0,0,137,255,255,157,247,0,128,9,216,255,255,187,157,157,210,255,255,157,247,0,0,216,249,255,0,157,247,0,128,
+    3,216,255,255,174,252,137,3,130,118,118,91,250,0,3,216,255,255,78,252,0,3,98,255,255,196,250,0,128,3,216,255,
+    255,78,252,0,6,68,177,177,154,78,78,72,253,0,3,216,255,255,78,249,0,3,59,255,255,235,253,0,128,3,216,255,
+    255,78,249,0,3,50,216,216,202,254,39,0,3,3,216,255,255,78,246,0,0,20,254,255,0,20,128,128,3,50,59,59,
+    18,245,0,3,216,255,255,78,245,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,3,216,
+    255,255,106,246,39,0,36,0,216,243,255,0,235,128,128,251,59,0,18,249,0,0,14,251,59,0,5,251,255,0,78,249,
+    0,0,59,251,255,0,20,128,128,128,128,128,254,255,15,56,20,20,169,235,235,109,0,0,91,235,235,186,20,20,38,254,
+    255,0,20,254,255,15,39,0,0,177,255,255,118,0,0,98,255,255,196,0,0,20,254,255,0,20,128,128,128,128,254,255,
+    15,39,0,0,68,98,98,130,157,157,134,98,98,75,0,0,20,254,255,0,20,254,255,0,39,252,0,3,137,255,255,157,
+    252,0,0,20,254,255,0,20,128,128,128,128,254,255,0,39,252,0,3,95,177,177,109,252,0,0,20,254,255,0,20,254,
+    255,0,39,243,0,0,20,254,255,0,20,128,128,128,128,128,0,50,252,59,0,27,249,0,0,5,254,59,0,5,0,216,
+    252,255,0,118,249,0,0,20,254,255,0,20,128,128,128,128,128,9,216,255,255,92,20,20,136,235,235,145,252,0,0,20,
+    254,255,0,20,9,216,255,255,78,0,0,137,255,255,157,252,0,0,20,254,255,0,20,128,128,128,128,15,216,255,255,78,
+    0,0,53,98,98,121,157,157,121,0,0,20,254,255,0,20,3,216,255,255,78,252,0,6,98,255,255,196,0,0,20,254,
+    255,0,20,128,128,128,128,3,216,255,255,78,252,0,6,68,177,177,154,78,78,92,254,255,0,20,3,216,255,255,78,249,
+    0,0,59,251,255,0,20,128,128,128,128,128,251,0,0,32,252,59,0,45,250,0,251,0,0,137,252,255,0,196,250,0,
+    128,254,0,3,14,20,20,136,252,235,3,186,20,20,18,253,0,254,0,3,177,255,255,118,252,0,3,59,255,255,235,253,
+    0,128,128,6,199,235,235,86,20,20,9,252,0,3,5,20,20,36,254,235,0,18,3,216,255,255,78,246,0,0,20,254,
+    255,0,20,128,128,128,128,128,128,128,128,128,128,6,149,177,177,109,78,78,36,252,0,3,18,78,78,86,254,177,0,14,
+    254,0,3,177,255,255,118,252,0,3,59,255,255,235,253,0,128,254,0,3,149,216,216,121,252,39,3,80,216,216,199,253,
+    0,251,0,0,137,252,255,0,196,250,0,128,128,0,50,246,59,0,45,254,0,0,216,246,255,0,196,254,0,128,3,216,
+    255,255,241,249,235,3,186,20,20,18,3,216,255,255,78,249,0,3,59,255,255,235,128,128,128,128,128,128,128,128,3,216,
+    255,255,187,249,157,3,143,98,98,91,0,216,246,255,0,196,254,0,128,3,216,255,255,174,249,137,0,106,254,0,3,216,
+    255,255,78,245,0,128,128,128,128,128,128,128,128,251,0,0,32,252,59,0,45,250,0,251,0,0,137,252,255,0,196,250,
+    0,128,254,0,3,14,20,20,136,252,235,3,186,20,20,18,253,0,254,0,3,177,255,255,118,252,0,3,59,255,255,235,
+    253,0,128,128,6,199,235,235,86,20,20,9,252,0,3,5,20,20,36,254,235,0,18,3,216,255,255,78,246,0,0,20,
+    254,255,0,20,128,128,128,128,128,128,128,128,128,128,6,149,177,177,109,78,78,36,252,0,3,18,78,78,86,254,177,0,
+    14,254,0,3,177,255,255,118,252,0,3,59,255,255,235,253,0,128,254,0,3,149,216,216,121,252,39,3,80,216,216,202,
+    254,39,0,3,251,0,0,137,252,255,3,196,0,0,20,254,255,0,20,128,128,242,0,0,20,254,255,0,20,128,128,242,
+    0,0,3,254,39,0,3,0,50,246,59,0,45,250,0,0,216,246,255,0,196,250,0,128,3,216,255,255,241,249,235,3,
+    186,20,20,18,253,0,3,216,255,255,78,249,0,3,59,255,255,235,253,0,128,128,128,128,128,128,128,128,3,216,255,255,
+    187,249,157,3,143,98,98,91,253,0,0,216,246,255,0,196,250,0,128,3,216,255,255,174,252,137,3,183,255,255,196,250,
+    0,3,216,255,255,78,252,0,3,98,255,255,196,250,0,128,3,216,255,255,78,252,0,6,68,177,177,154,78,78,72,253,
+    0,3,216,255,255,78,249,0,3,59,255,255,235,253,0,128,3,216,255,255,78,249,0,3,50,216,216,202,254,39,0,3,
+    3,216,255,255,78,246,0,0,20,254,255,0,20,128,128,254,0,0,41,246,59,0,54,253,0,254,0,0,177,246,255,0,
+    235,253,0,128,3,17,20,20,169,246,235,0,219,254,20,0,2,3,216,255,255,78,246,0,0,20,254,255,0,20,128,128,
+    3,216,255,255,78,246,0,0,2,254,20,0,2,3,216,255,255,78,241,0,128,3,50,59,59,154,252,196,0,121,247,0,
+    254,0,0,177,252,255,0,157,247,0,128,254,0,0,68,252,98,0,121,252,157,0,145,253,0,248,0,0,98,252,255,0,
+    235,253,0,128,248,0,0,53,252,137,0,136,254,118,0,9,242,0,0,20,254,255,0,20,128,3,66,78,78,24,246,0,
+    0,20,254,255,0,20,3,216,255,255,78,246,0,0,20,254,255,0,20,128,3,183,216,216,94,246,39,0,53,254,216,0,
+    17,254,0,0,177,246,255,0,235,253,0,128,128,235,59,0,5,235,255,0,20,128,248,235,3,246,255,255,247,248,235,0,
+    18,248,0,3,137,255,255,157,247,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,3,
+    50,59,59,18,246,0,0,5,254,59,0,5,3,216,255,255,78,246,0,0,20,254,255,0,20,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,3,183,216,216,94,246,39,0,53,254,216,0,17,254,0,0,177,246,255,
+    0,235,253,0,128,128,254,59,0,9,243,0,0,5,254,59,0,5,254,255,0,39,243,0,0,20,254,255,0,20,128,128,
+    128,128,128,254,20,3,202,235,235,72,249,0,3,54,235,235,219,254,20,0,2,254,0,3,216,255,255,78,249,0,3,59,
+    255,255,235,253,0,128,128,128,128,254,0,15,83,98,98,139,157,157,72,0,0,60,157,157,143,98,98,91,253,0,251,0,
+    9,177,255,255,118,0,0,98,255,255,196,250,0,128,128,128,128,251,0,9,122,177,177,124,78,78,116,177,177,136,250,0,
+    248,0,3,137,255,255,157,247,0,128,128,128,128,128,254,59,0,9,243,0,0,5,254,59,0,5,254,255,0,39,243,0,
+    0,20,254,255,0,20,128,254,255,0,39,252,0,3,11,20,20,12,252,0,0,20,254,255,0,20,254,255,0,39,252,0,
+    3,137,255,255,157,252,0,0,20,254,255,0,20,128,128,128,128,128,254,255,15,39,0,0,136,196,196,122,59,59,112,196,
+    196,151,0,0,20,254,255,0,20,254,255,15,39,0,0,177,255,255,118,0,0,98,255,255,196,0,0,20,254,255,0,20,
+    128,128,128,128,254,137,15,121,118,118,213,255,255,118,0,0,98,255,255,223,118,118,119,254,137,0,11,254,0,0,216,252,
+    255,3,118,0,0,98,252,255,0,235,253,0,128,254,0,15,216,255,255,201,177,177,81,0,0,68,177,177,195,255,255,235,
+    253,0,254,0,3,216,255,255,78,249,0,3,59,255,255,235,253,0,128,128,128,128,128,3,50,59,59,18,246,0,0,5,
+    254,59,0,5,3,216,255,255,78,246,0,0,20,254,255,0,20,128,128,128,128,128,6,17,20,20,169,235,235,109,252,0,
+    3,54,235,235,219,254,20,0,2,254,0,3,177,255,255,118,252,0,3,59,255,255,235,253,0,128,254,0,3,41,59,59,
+    133,252,196,3,164,59,59,54,253,0,251,0,0,137,252,255,0,196,250,0,128,128,128,128,254,0,3,81,118,118,128,252,
+    137,3,133,118,118,109,253,0,254,0,3,177,255,255,118,252,0,3,59,255,255,235,253,0,128,6,66,78,78,146,177,177,
+    81,252,0,3,41,177,177,169,254,78,0,6,3,216,255,255,78,246,0,0,20,254,255,0,20,128,128,128,128,128,254,59,
+    0,9,243,0,0,5,254,59,0,5,254,255,0,39,243,0,0,20,254,255,0,20,128,128,128,128,128,254,20,3,202,235,
+    235,72,249,0,3,54,235,235,219,254,20,0,2,254,0,3,216,255,255,78,249,0,3,59,255,255,235,253,0,128,254,0,
+    15,50,59,59,154,196,196,91,0,0,75,196,196,164,59,59,54,253,0,251,0,9,177,255,255,118,0,0,98,255,255,196,
+    250,0,128,251,0,9,68,98,98,130,157,157,134,98,98,75,250,0,248,0,3,137,255,255,157,247,0,128,128,128,128,128,
+    128,128,128,128,128,128,0,50,239,59,0,5,0,216,239,255,0,20,128,0,199,243,235,0,237,254,255,0,20,242,0,0,
+    20,254,255,0,20,128,128,245,0,3,54,235,235,219,254,20,0,2,245,0,3,59,255,255,235,253,0,128,248,0,6,75,
+    196,196,164,59,59,54,253,0,248,0,3,98,255,255,196,250,0,128,251,0,6,84,157,157,134,98,98,75,250,0,251,0,
+    3,137,255,255,157,247,0,128,254,0,6,81,118,118,128,137,137,84,247,0,254,0,3,177,255,255,118,244,0,128,6,66,
+    78,78,146,177,177,81,244,0,3,216,255,255,78,241,0,128,3,216,255,255,106,242,39,0,3,0,216,239,255,0,20,128,
+    128,0,68,249,98,0,75,0,177,249,255,0,196,128,3,177,255,255,223,252,196,0,151,3,177,255,255,118,251,0,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,3,177,255,255,234,252,216,
+    0,166,0,177,249,255,0,196,128,0,54,249,78,0,60,3,83,98,98,30,245,0,3,216,255,255,78,245,0,128,128,128,
+    128,6,199,235,235,86,20,20,9,248,0,254,0,3,177,255,255,118,248,0,128,128,128,128,128,254,0,6,41,59,59,133,
+    196,196,121,251,0,251,0,3,137,255,255,157,251,0,128,128,128,128,251,0,6,74,137,137,130,118,118,91,254,0,248,0,
+    3,98,255,255,196,254,0,128,128,128,128,248,0,6,83,216,216,175,39,39,36,245,0,3,59,255,255,235,128,128,128,128,
+    128,245,0,3,9,39,39,36,0,68,249,98,0,75,0,177,249,255,0,196,128,0,136,252,196,3,219,255,255,196,251,0,
+    3,98,255,255,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    0,149,252,216,3,231,255,255,196,0,177,249,255,0,196,128,0,54,249,78,0,60,251,0,3,53,98,98,60,251,0,251,
+    0,3,137,255,255,157,251,0,128,128,128,128,254,0,9,14,20,20,136,235,235,152,20,20,15,254,0,254,0,9,177,255,
+    255,118,0,0,98,255,255,196,254,0,128,128,128,128,128,15,166,196,196,101,59,59,27,0,0,23,59,59,91,196,196,181,
+    3,216,255,255,78,249,0,3,59,255,255,235,128,128,128,128,3,116,137,137,42,249,0,3,32,137,137,127,235,255,0,20,
+    128,128,235,39,0,3,3,68,98,98,45,254,0,3,177,255,255,118,254,0,128,6,136,196,196,122,59,59,36,254,0,3,
+    137,255,255,157,128,254,0,3,127,235,235,145,254,0,0,163,249,235,0,181,254,0,254,0,0,177,249,255,0,196,254,0,
+    128,254,0,0,41,249,59,3,91,196,196,181,245,0,3,59,255,255,235,128,254,0,0,109,249,157,3,180,255,255,235,254,
+    0,0,177,246,255,0,235,128,3,100,118,118,131,249,137,3,164,255,255,235,3,216,255,255,78,249,0,3,59,255,255,235,
+    128,128,128,128,3,183,216,216,94,249,39,3,89,255,255,235,254,0,0,177,246,255,0,235,128,128,254,0,0,163,249,235,
+    0,181,254,0,254,0,0,177,249,255,0,196,254,0,128,3,166,196,196,101,249,59,3,91,196,196,181,3,216,255,255,78,
+    249,0,3,59,255,255,235,128,3,216,255,255,78,249,0,3,23,98,98,91,3,216,255,255,78,245,0,128,128,128,128,3,
+    216,255,255,78,249,0,3,18,78,78,72,3,216,255,255,78,249,0,3,59,255,255,235,128,3,183,216,216,94,249,39,3,
+    80,216,216,199,254,0,0,177,249,255,0,196,254,0,128,128,245,0,3,23,98,98,91,245,0,3,59,255,255,235,128,128,
+    128,128,128,128,128,128,254,0,0,163,249,235,3,240,255,255,235,254,0,0,177,246,255,0,235,128,3,166,196,196,101,249,
+    59,3,104,255,255,235,3,216,255,255,78,249,0,3,59,255,255,235,128,128,128,128,128,128,128,128,128,128,3,183,216,216,
+    94,249,39,3,89,255,255,235,254,0,0,177,246,255,0,235,128,128,251,0,0,53,249,98,0,91,251,0,0,137,249,255,
+    0,235,128,254,0,3,41,59,59,133,249,196,0,181,254,0,3,177,255,255,118,248,0,128,128,128,128,128,6,199,235,235,
+    249,255,255,244,252,235,0,181,254,0,0,216,246,255,0,196,254,0,128,6,50,59,59,195,255,255,149,252,59,0,45,254,
+    0,254,0,3,177,255,255,118,248,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,3,83,98,98,30,245,0,3,
+    216,255,255,78,245,0,128,128,128,128,128,128,128,128,3,216,255,255,241,249,235,0,181,254,0,0,216,246,255,0,196,254,
+    0,128,3,216,255,255,119,249,59,3,91,196,196,181,3,216,255,255,78,249,0,3,59,255,255,235,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,254,0,3,53,98,98,60,254,0,3,137,255,255,157,128,254,0,3,106,196,196,121,250,0,
+    128,128,128,128,128,0,163,252,235,0,145,0,177,252,255,0,157,128,6,41,59,59,164,255,255,157,254,0,3,137,255,255,
+    157,128,128,128,128,128,128,128,128,128,128,128,128,128,128,248,0,3,38,98,98,75,248,0,3,98,255,255,196,128,248,0,
+    3,75,196,196,151,244,0,128,128,128,128,128,251,0,0,127,252,235,0,181,251,0,0,137,252,255,0,196,128,251,0,6,
+    32,59,59,134,255,255,196,248,0,3,98,255,255,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,
+    183,249,216,3,148,39,39,30,0,216,249,255,0,157,254,0,128,0,66,249,78,0,48,254,0,3,83,98,98,30,245,0,
+    3,216,255,255,78,245,0,128,128,128,128,128,128,128,128,3,216,255,255,78,249,0,3,54,235,235,217,3,216,255,255,78,
+    249,0,3,59,255,255,235,128,3,216,255,255,78,252,0,6,75,196,196,164,59,59,54,3,216,255,255,78,252,0,3,98,
+    255,255,196,254,0,128,12,216,255,255,78,0,0,84,157,157,134,98,98,75,254,0,9,216,255,255,78,0,0,137,255,255,
+    157,251,0,128,9,216,255,255,160,118,118,192,255,255,157,251,0,0,216,249,255,0,157,251,0,128,3,216,255,255,201,252,
+    177,3,139,78,78,60,254,0,3,216,255,255,78,252,0,3,98,255,255,196,254,0,128,3,216,255,255,78,252,0,6,83,
+    216,216,175,39,39,36,3,216,255,255,78,249,0,3,59,255,255,235,128,128,0,68,252,98,0,60,0,177,252,255,0,157,
+    128,6,136,196,196,228,255,255,157,254,0,3,137,255,255,157,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,248,235,3,109,0,0,91,252,235,0,217,253,0,248,255,3,118,0,0,98,252,255,0,235,
+    253,0,128,254,255,0,89,252,59,3,133,196,196,143,252,59,0,69,254,196,0,15,254,255,0,39,252,0,3,137,255,255,
+    157,252,0,0,20,254,255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,199,246,235,0,181,254,0,0,
+    216,246,255,0,196,254,0,128,3,216,255,255,119,249,59,3,91,196,196,181,3,216,255,255,78,249,0,3,59,255,255,235,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,254,0,0,163,249,235,0,181,254,0,254,0,0,177,249,255,0,196,
+    254,0,128,3,166,196,196,101,249,59,3,91,196,196,181,3,216,255,255,78,249,0,3,59,255,255,235,128,128,128,128,128,
+    128,128,128,128,128,3,183,216,216,94,249,39,3,80,216,216,199,254,0,0,177,249,255,0,196,254,0,128,128,0,199,246,
+    235,0,181,254,0,0,216,246,255,0,196,254,0,128,3,216,255,255,119,249,59,3,91,196,196,181,3,216,255,255,78,249,
+    0,3,59,255,255,235,128,128,128,128,128,128,128,128,128,128,3,216,255,255,106,249,39,3,80,216,216,199,0,216,246,255,
+    0,196,254,0,128,128,3,216,255,255,78,245,0,128,128,128,128,128,128,128,128,3,100,118,118,36,245,0,254,0,0,163,
+    246,235,0,217,254,0,0,177,246,255,0,235,128,3,166,196,196,101,249,59,3,104,255,255,235,3,216,255,255,78,249,0,
+    3,59,255,255,235,128,128,128,128,128,128,128,128,128,128,3,183,216,216,94,249,39,3,89,255,255,235,254,0,0,177,246,
+    255,0,235,128,128,245,0,3,59,255,255,235,128,128,128,128,128,128,128,128,245,0,3,27,118,118,109,6,199,235,235,72,
+    0,0,127,252,235,0,181,254,0,6,216,255,255,78,0,0,137,252,255,0,196,254,0,128,6,216,255,255,214,196,196,122,
+    252,59,3,91,196,196,181,0,216,252,255,0,118,252,0,3,59,255,255,235,128,6,216,255,255,146,98,98,45,252,0,3,
+    23,98,98,91,3,216,255,255,78,245,0,128,128,128,128,128,128,128,128,128,128,128,254,0,0,163,246,235,0,217,254,0,
+    0,177,246,255,0,235,128,3,166,196,196,101,246,59,0,54,3,216,255,255,78,245,0,128,3,83,98,98,139,252,157,0,
+    97,251,0,254,0,0,177,252,255,0,157,251,0,128,254,0,0,95,252,137,3,130,118,118,91,254,0,248,0,3,98,255,
+    255,196,254,0,128,248,0,6,68,177,177,154,78,78,72,245,0,3,59,255,255,235,128,0,33,246,39,3,80,216,216,199,
+    0,216,246,255,0,196,254,0,128,128,3,41,59,59,27,248,0,3,177,255,255,118,248,0,128,128,128,128,128,3,177,255,
+    255,244,249,235,0,217,0,177,246,255,0,235,128,3,177,255,255,149,249,59,0,54,3,177,255,255,118,248,0,128,128,128,
+    128,128,128,128,128,128,128,3,149,216,216,121,249,39,0,36,254,0,0,137,249,255,0,235,128,128,3,199,235,235,72,249,
+    0,3,54,235,235,217,3,216,255,255,78,249,0,3,59,255,255,235,128,128,128,128,15,83,98,98,139,157,157,72,0,0,
+    60,157,157,143,98,98,91,254,0,9,177,255,255,118,0,0,98,255,255,196,254,0,128,128,128,128,254,0,9,122,177,177,
+    124,78,78,116,177,177,136,254,0,251,0,3,137,255,255,157,251,0,128,128,128,128,128,254,235,0,36,243,0,0,18,254,
+    235,0,18,254,255,0,39,243,0,0,20,254,255,0,20,128,254,255,0,39,252,0,3,106,196,196,121,252,0,0,20,254,
+    255,0,20,254,255,0,39,252,0,3,137,255,255,157,252,0,0,20,254,255,0,20,128,128,128,128,254,255,15,39,0,0,
+    81,118,118,128,137,137,130,118,118,91,0,0,20,254,255,0,20,254,255,15,39,0,0,177,255,255,118,0,0,98,255,255,
+    196,0,0,20,254,255,0,20,128,254,177,15,94,78,78,201,255,255,118,0,0,98,255,255,214,78,78,86,254,177,0,14,
+    254,0,0,216,252,255,3,118,0,0,98,252,255,0,235,253,0,128,254,0,15,216,255,255,228,216,216,100,0,0,83,216,
+    216,225,255,255,235,253,0,254,0,3,216,255,255,78,249,0,3,59,255,255,235,253,0,128,128,3,199,235,235,72,249,0,
+    3,54,235,235,217,3,216,255,255,78,249,0,3,59,255,255,235,128,15,50,59,59,154,196,196,91,0,0,75,196,196,164,
+    59,59,54,254,0,9,177,255,255,118,0,0,98,255,255,196,254,0,128,254,0,9,68,98,98,130,157,157,134,98,98,75,
+    254,0,251,0,3,137,255,255,157,251,0,128,128,128,128,254,0,9,54,78,78,131,177,177,139,78,78,60,254,0,254,0,
+    9,177,255,255,118,0,0,98,255,255,196,254,0,128,15,33,39,39,161,216,216,100,0,0,83,216,216,175,39,39,36,3,
+    216,255,255,78,249,0,3,59,255,255,235,128,128,3,199,235,235,72,249,0,3,54,235,235,217,3,216,255,255,78,249,0,
+    3,59,255,255,235,128,128,128,128,128,128,128,128,128,128,128,128,128,3,183,216,216,94,249,39,3,89,255,255,235,254,0,
+    0,177,246,255,0,235,128,128,245,0,3,59,255,255,235,128,128,128,128,128,254,0,0,122,249,177,3,154,78,78,72,254,
+    0,0,177,249,255,0,196,254,0,128,254,0,0,81,249,118,0,91,254,0,0,199,243,235,0,217,0,216,243,255,0,235,
+    128,0,50,246,59,3,104,255,255,235,245,0,3,59,255,255,235,128,248,0,6,60,157,157,143,98,98,91,248,0,3,98,
+    255,255,196,254,0,128,251,0,6,63,118,118,125,137,137,106,254,0,251,0,3,137,255,255,157,251,0,128,254,0,6,54,
+    78,78,131,177,177,109,251,0,254,0,3,177,255,255,118,248,0,128,6,33,39,39,189,255,255,139,249,39,0,36,0,216,
+    243,255,0,235,128,128,248,0,0,38,252,98,0,91,248,0,0,98,252,255,0,235,128,251,0,3,32,59,59,112,252,196,
+    0,181,251,0,3,137,255,255,157,251,0,128,128,128,128,128,128,128,128,128,128,128,0,133,252,157,3,125,98,98,60,251,
+    0,0,216,252,255,0,118,248,0,128,0,116,252,137,3,127,118,118,72,251,0,251,0,3,137,255,255,157,251,0,128,128,
+    128,128,128,128,128,128,128,128,128,251,0,3,21,39,39,107,252,216,0,199,248,0,0,98,252,255,0,235,128,248,0,0,
+    30,252,78,0,72,3,53,98,98,60,3,137,255,255,157,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,3,42,78,78,48,0,83,252,98,0,45,248,0,0,216,252,
+    255,0,118,248,0,128,0,166,252,196,3,122,59,59,36,251,0,251,0,3,137,255,255,157,251,0,128,128,128,128,128,128,
+    128,128,128,128,128,251,0,3,53,98,98,121,252,157,0,145,248,0,0,98,252,255,0,235,128,251,0,3,63,118,118,125,
+    252,137,0,127,251,0,3,137,255,255,157,251,0,128,128,128,128,128,128,128,128,128,128,128,0,183,252,216,3,121,39,39,
+    24,251,0,0,216,252,255,0,118,248,0,128,0,66,252,78,0,36,248,0,254,0,0,166,249,196,0,121,252,0,0,15,
+    254,196,0,15,254,0,0,216,249,255,0,157,252,0,0,20,254,255,0,20,128,254,157,0,107,252,98,3,183,255,255,217,
+    252,157,0,152,254,98,0,8,254,255,0,39,252,0,0,137,249,255,0,235,253,0,128,254,137,0,21,252,0,0,74,249,
+    137,0,127,253,0,0,95,244,177,0,54,250,0,0,137,244,255,0,78,250,0,128,3,137,255,255,250,247,196,3,101,59,
+    59,45,253,0,3,137,255,255,235,247,0,3,177,255,255,196,253,0,128,128,3,137,255,255,235,247,0,3,41,59,59,91,
+    254,196,0,45,3,137,255,255,235,244,0,0,59,254,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,3,137,255,
+    255,235,247,0,3,163,235,235,186,254,20,0,5,3,137,255,255,235,247,0,3,177,255,255,196,253,0,128,3,137,255,255,
+    244,247,118,3,131,137,137,106,253,0,0,137,244,255,0,78,250,0,128,128,254,0,0,15,247,196,0,60,254,0,254,0,
+    0,20,247,255,0,78,254,0,128,3,42,78,78,86,247,177,3,109,78,78,60,3,137,255,255,235,247,0,3,177,255,255,
+    196,128,128,3,137,255,255,252,247,216,3,243,255,255,196,0,137,241,255,0,196,128,3,137,255,255,247,244,157,0,121,3,
+    137,255,255,235,243,0,128,128,3,137,255,255,235,247,0,3,163,235,235,181,3,137,255,255,235,247,0,3,177,255,255,196,
+    128,3,74,137,137,136,247,118,3,131,137,137,106,254,0,0,20,247,255,0,78,254,0,128,128,3,21,39,39,36,243,0,
+    3,137,255,255,235,243,0,128,128,128,128,128,128,128,128,128,3,137,255,255,250,247,196,0,60,254,0,0,137,244,255,0,
+    78,254,0,128,3,137,255,255,249,247,177,3,109,78,78,60,3,137,255,255,235,247,0,3,177,255,255,196,128,128,128,128,
+    128,128,128,128,128,128,128,128,3,137,255,255,244,247,118,3,131,137,137,106,0,137,244,255,0,78,254,0,128,128,3,106,
+    196,196,181,247,0,3,136,196,196,151,3,137,255,255,235,247,0,3,177,255,255,196,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,3,74,137,137,136,247,118,3,213,255,255,196,254,0,0,20,244,255,0,196,128,128,254,0,0,15,244,
+    196,0,151,254,0,0,20,244,255,0,196,128,3,42,78,78,86,247,177,3,231,255,255,196,3,137,255,255,235,247,0,3,
+    177,255,255,196,128,128,128,128,128,128,128,128,128,128,128,128,3,74,137,137,136,247,118,3,213,255,255,196,254,0,0,20,
+    244,255,0,196,128,128,243,0,3,177,255,255,196,128,128,128,128,128,254,0,0,2,247,20,3,169,235,235,181,254,0,0,
+    20,247,255,0,78,254,0,128,128,254,0,0,8,247,98,0,30,254,0,3,109,177,177,149,3,157,255,255,216,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,3,12,20,20,17,253,0,128,3,72,118,118,100,3,157,255,
+    255,216,128,128,0,3,254,39,3,15,0,0,6,254,39,0,12,0,20,254,255,3,98,0,0,39,254,255,0,78,128,128,
+    128,128,128,128,128,128,128,0,5,254,59,3,23,0,0,9,254,59,0,18,247,0,3,109,177,177,149,254,0,3,122,177,
+    177,136,253,0,247,0,3,157,255,255,216,254,0,3,177,255,255,196,253,0,128,128,128,128,128,254,0,0,106,251,196,3,
+    232,255,255,246,254,196,3,237,255,255,241,254,196,0,45,254,0,0,137,237,255,0,59,128,254,0,3,95,177,177,183,254,
+    255,3,207,177,177,189,254,255,0,201,251,177,0,41,251,0,0,20,254,255,3,98,0,0,39,254,255,0,78,250,0,128,
+    128,128,128,128,251,98,0,110,254,255,3,158,98,98,122,254,255,3,146,98,98,75,253,0,237,255,0,196,253,0,128,128,
+    254,20,3,146,255,255,237,254,20,3,164,255,255,219,251,20,0,15,253,0,254,0,3,137,255,255,235,254,0,3,157,255,
+    255,216,246,0,128,128,128,128,128,250,0,3,109,177,177,149,250,0,250,0,3,157,255,255,216,250,0,128,254,0,0,5,
+    254,59,3,180,255,255,225,251,59,0,45,254,0,0,20,244,255,0,196,128,128,3,106,196,196,186,254,59,3,180,255,255,
+    225,251,59,0,45,3,137,255,255,235,254,0,3,157,255,255,216,250,0,128,128,128,128,128,3,21,39,39,53,254,216,3,
+    240,255,255,249,254,216,0,66,254,0,254,0,0,20,247,255,0,78,254,0,128,254,0,0,12,254,157,3,217,255,255,240,
+    254,157,3,116,98,98,75,250,0,3,157,255,255,216,254,0,3,177,255,255,196,128,128,128,128,128,0,63,251,118,3,202,
+    255,255,234,254,118,3,131,137,137,106,0,137,244,255,0,78,254,0,128,128,250,0,3,157,255,255,216,250,0,128,128,250,
+    0,3,72,118,118,100,250,0,254,0,3,95,177,177,163,247,0,3,122,177,177,136,253,0,254,0,3,137,255,255,235,247,
+    0,3,177,255,255,196,253,0,128,254,59,3,133,196,196,186,254,59,3,23,0,0,9,254,59,3,154,196,196,151,253,0,
+    254,255,3,118,0,0,20,254,255,3,98,0,0,39,254,255,0,78,250,0,128,128,128,128,128,254,177,3,124,78,78,86,
+    254,177,3,116,78,78,94,254,177,0,54,250,0,254,0,3,137,255,255,235,254,0,3,157,255,255,216,246,0,128,128,254,
+    0,3,21,39,39,36,254,0,3,157,255,255,216,254,0,3,149,216,216,166,253,0,247,0,3,157,255,255,216,254,0,3,
+    177,255,255,196,253,0,128,251,0,0,8,254,98,3,134,157,157,148,254,98,3,139,157,157,143,254,98,0,23,251,0,0,
+    20,254,255,3,98,0,0,39,254,255,3,78,0,0,59,254,255,0,59,128,128,128,128,128,254,0,3,63,118,118,119,254,
+    137,3,53,0,0,21,254,137,3,124,118,118,122,254,137,0,32,254,0,3,137,255,255,235,247,0,3,177,255,255,196,253,
+    0,128,128,254,0,0,14,251,177,0,149,246,0,254,0,0,20,251,255,0,216,246,0,128,3,32,59,59,69,251,196,0,
+    175,254,59,0,18,250,0,3,137,255,255,235,251,0,0,39,254,255,0,78,250,0,128,128,128,128,128,3,95,177,177,169,
+    251,78,0,94,254,177,3,54,0,0,18,254,78,0,18,254,0,0,20,251,255,0,216,251,0,0,59,254,255,0,59,128,
+    128,3,116,216,216,202,251,39,0,66,254,216,3,66,0,0,59,254,255,0,59,3,137,255,255,235,251,0,0,39,254,255,
+    3,78,0,0,59,254,255,0,59,128,3,137,255,255,235,251,0,0,24,254,157,3,116,98,98,112,254,157,0,36,3,137,
+    255,255,235,247,0,3,177,255,255,196,253,0,128,128,128,128,128,3,74,137,137,136,247,118,3,131,137,137,133,254,118,0,
+    27,254,0,0,20,247,255,3,78,0,0,59,254,255,0,59,128,128,3,24,39,39,33,3,157,255,255,216,128,128,128,128,
+    128,128,128,128,128,3,36,59,59,50,250,0,0,6,254,39,0,12,250,0,0,39,254,255,0,78,128,128,253,0,3,109,
+    177,177,161,254,78,0,24,253,0,3,157,255,255,216,253,0,128,128,128,128,128,0,15,254,196,3,112,59,59,50,253,0,
+    0,20,254,255,0,98,250,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,11,254,137,3,125,118,118,100,
+    253,0,253,0,3,157,255,255,216,253,0,128,128,128,128,128,253,0,3,72,118,118,121,254,137,0,42,250,0,0,39,254,
+    255,0,78,128,250,0,0,36,254,235,0,72,0,3,254,39,0,15,250,0,0,20,254,255,0,98,250,0,128,128,0,6,
+    254,78,3,139,177,177,149,253,0,253,0,3,157,255,255,216,253,0,128,128,128,128,128,253,0,3,36,59,59,80,254,196,
+    0,60,250,0,0,39,254,255,0,78,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,253,0,3,72,118,118,121,
+    254,137,0,42,253,0,3,157,255,255,216,253,0,128,128,128,128,128,0,11,254,137,3,125,118,118,100,253,0,0,20,254,
+    255,0,98,250,0,128,0,18,254,235,0,91,250,0,250,0,3,121,196,196,166,250,0,250,0,3,157,255,255,216,250,0,
+    128,3,42,78,78,72,254,0,3,157,255,255,216,254,0,3,54,78,78,60,3,137,255,255,235,254,0,3,157,255,255,216,
+    254,0,3,177,255,255,196,128,128,3,21,39,39,53,254,216,3,240,255,255,249,254,216,3,94,39,39,30,254,0,0,20,
+    247,255,0,78,254,0,128,3,53,98,98,103,254,157,3,217,255,255,240,254,157,3,116,98,98,75,3,137,255,255,235,254,
+    0,3,157,255,255,216,254,0,3,177,255,255,196,128,128,3,11,20,20,18,254,0,3,157,255,255,216,254,0,3,14,20,
+    20,15,250,0,3,157,255,255,216,250,0,128,250,0,3,84,137,137,116,250,0,250,0,3,121,196,196,166,250,0,250,0,
+    3,157,255,255,216,250,0,128,128,128,128,128,0,116,251,216,3,240,255,255,249,251,216,0,166,0,137,241,255,0,196,128,
+    0,84,251,157,3,217,255,255,240,251,157,0,121,250,0,3,157,255,255,216,250,0,128,128,128,128,128,250,0,3,84,137,
+    137,116,250,0,254,0,0,18,254,235,0,91,254,0,0,20,254,255,0,98,128,128,128,128,128,128,128,128,3,74,137,137,
+    136,254,118,0,45,3,137,255,255,235,253,0,128,3,127,235,235,217,253,0,0,116,241,216,0,166,0,137,241,255,0,196,
+    128,0,84,241,157,0,121,0,18,254,235,0,91,0,20,254,255,0,98,128,128,128,128,128,243,0,3,27,39,39,30,243,
+    0,3,177,255,255,196,128,128,128,128,128,247,0,0,9,254,59,3,154,196,196,151,247,0,0,39,254,255,0,78,254,0,
+    128,128,128,128,128,250,0,3,48,78,78,94,254,177,0,54,254,0,250,0,3,157,255,255,216,250,0,128,128,128,128,128,
+    254,0,0,8,254,98,3,134,157,157,133,250,0,254,0,0,20,254,255,0,98,247,0,128,128,128,128,128,3,63,118,118,
+    119,254,137,0,53,247,0,3,137,255,255,235,243,0,128,128,128,128,128,3,63,118,118,109,243,0,254,0,0,14,247,177,
+    0,54,254,0,254,0,0,20,247,255,0,78,254,0,128,3,32,59,59,69,247,196,3,101,59,59,45,3,137,255,255,235,
+    247,0,3,177,255,255,196,128,128,128,128,128,3,137,255,255,235,254,0,3,48,78,78,66,254,0,3,177,255,255,196,3,
+    137,255,255,235,254,0,3,157,255,255,216,254,0,3,177,255,255,196,128,128,128,128,128,3,137,255,255,235,254,0,3,97,
+    157,157,133,254,0,3,177,255,255,196,3,137,255,255,235,247,0,3,177,255,255,196,128,128,128,128,128,3,74,137,137,136,
+    247,118,3,131,137,137,106,254,0,0,20,247,255,0,78,254,0,128,128,250,0,3,109,177,177,149,250,0,250,0,3,157,
+    255,255,216,250,0,128,254,0,0,5,254,59,3,180,255,255,216,250,0,254,0,0,20,251,255,0,216,250,0,128,128,3,
+    106,196,196,186,254,59,3,180,255,255,216,250,0,3,137,255,255,235,254,0,3,157,255,255,216,250,0,128,3,95,177,177,
+    163,254,0,3,157,255,255,216,250,0,250,0,3,157,255,255,216,250,0,128,128,128,128,128,128,128,128,128,128,128,128,0,
+    63,251,118,3,202,255,255,234,251,118,0,91,0,137,241,255,0,196,128,128,254,0,0,14,247,177,0,54,254,0,254,0,
+    0,20,247,255,0,78,254,0,128,3,32,59,59,69,247,196,3,101,59,59,45,3,137,255,255,235,247,0,3,177,255,255,
+    196,128,128,3,32,59,59,54,247,0,3,177,255,255,196,243,0,3,177,255,255,196,128,247,0,0,12,254,78,3,146,177,
+    177,136,247,0,0,39,254,255,0,78,254,0,128,128,250,0,3,133,216,216,189,254,39,0,12,254,0,250,0,3,157,255,
+    255,216,250,0,128,254,0,0,8,254,98,3,134,157,157,133,250,0,254,0,0,20,254,255,0,98,247,0,128,128,3,127,
+    235,235,219,254,20,0,8,247,0,3,137,255,255,235,243,0,128,3,137,255,255,244,244,118,0,91,0,137,241,255,0,196,
+    128,128,254,0,0,14,247,177,0,54,254,0,254,0,0,20,247,255,0,78,254,0,128,3,32,59,59,69,247,196,3,101,
+    59,59,45,3,137,255,255,235,247,0,3,177,255,255,196,128,128,3,32,59,59,54,247,0,3,177,255,255,196,243,0,3,
+    177,255,255,196,128,250,0,0,48,251,78,3,146,177,177,136,250,0,0,157,251,255,0,78,254,0,128,128,250,0,0,24,
+    251,39,3,161,216,216,166,243,0,3,177,255,255,196,128,128,128,128,128,3,127,235,235,217,247,0,3,177,255,255,196,3,
+    137,255,255,235,247,0,3,177,255,255,196,128,3,74,137,137,136,247,118,3,131,137,137,106,254,0,0,20,247,255,0,78,
+    254,0,128,128,243,0,3,122,177,177,136,253,0,243,0,3,177,255,255,196,253,0,128,247,0,0,9,254,59,3,195,255,
+    255,196,253,0,247,0,0,39,251,255,0,196,253,0,128,128,250,0,3,121,196,196,175,254,59,3,195,255,255,196,253,0,
+    250,0,3,157,255,255,216,254,0,3,177,255,255,196,253,0,128,254,0,0,6,254,78,3,139,177,177,149,254,0,3,177,
+    255,255,196,253,0,254,0,0,20,254,255,0,98,251,0,3,177,255,255,196,253,0,128,128,3,116,216,216,202,254,39,0,
+    15,251,0,3,177,255,255,196,253,0,3,137,255,255,235,247,0,3,177,255,255,196,253,0,128,3,137,255,255,243,247,98,
+    3,207,255,255,219,254,98,0,23,0,137,237,255,0,59,128,128,0,11,244,20,3,183,255,255,201,254,20,0,5,243,0,
+    3,177,255,255,196,253,0,128,128,128,128,128,0,95,241,177,0,136,0,137,241,255,0,196,128,3,137,255,255,250,244,196,
+    0,151,3,137,255,255,235,243,0,128,128,128,128,128,3,137,255,255,241,247,78,0,24,254,0,0,137,244,255,0,78,254,
+    0,128,128,0,21,244,39,3,161,216,216,166,243,0,3,177,255,255,196,128,128,128,128,128,3,127,235,235,217,247,0,3,
+    177,255,255,196,3,137,255,255,235,247,0,3,177,255,255,196,128,3,74,137,137,136,247,118,3,131,137,137,106,254,0,0,
+    20,247,255,0,78,254,0,128,128,250,0,0,109,251,177,0,54,254,0,250,0,0,157,251,255,0,78,254,0,128,254,0,
+    0,5,254,59,0,143,251,196,0,60,254,0,254,0,0,20,254,255,0,98,247,0,128,128,3,106,196,196,186,254,59,0,
+    23,247,0,3,137,255,255,235,243,0,128,3,137,255,255,241,247,78,0,24,254,0,0,137,244,255,0,78,254,0,128,128,
+    3,137,255,255,238,247,39,3,161,216,216,166,3,137,255,255,235,247,0,3,177,255,255,196,128,128,128,128,128,128,128,128,
+    3,74,137,137,136,247,118,3,131,137,137,106,254,0,0,20,247,255,0,78,254,0,128,128,0,95,241,177,0,136,0,137,
+    241,255,0,196,128,0,106,244,196,3,237,255,255,196,243,0,3,177,255,255,196,128,128,247,0,0,30,254,196,3,101,59,
+    59,45,247,0,0,39,254,255,0,78,254,0,128,128,128,128,128,250,0,3,133,216,216,189,254,39,0,12,254,0,250,0,
+    3,157,255,255,216,250,0,128,128,128,128,128,254,0,0,18,254,235,3,103,20,20,17,250,0,254,0,0,20,254,255,0,
+    98,247,0,128,128,128,128,128,254,0,0,14,247,177,0,54,254,0,254,0,0,20,247,255,0,78,254,0,128,3,32,59,
+    59,69,247,196,3,101,59,59,45,3,137,255,255,235,247,0,3,177,255,255,196,128,128,128,128,128,3,95,177,177,169,247,
+    78,3,146,177,177,136,254,0,0,20,247,255,0,78,254,0,128,128,3,116,216,216,202,247,39,3,161,216,216,166,3,137,
+    255,255,235,247,0,3,177,255,255,196,128,128,128,128,128,128,128,128,3,74,137,137,136,247,118,3,131,137,137,106,254,0,
+    0,20,247,255,0,78,254,0,128,128,254,0,0,14,247,177,0,54,254,0,254,0,0,20,247,255,0,78,254,0,128,3,
+    32,59,59,69,247,196,3,101,59,59,45,3,137,255,255,235,247,0,3,177,255,255,196,128,128,128,128,128,128,128,128,128,
+    3,21,39,39,53,247,216,3,243,255,255,196,254,0,0,20,244,255,0,196,128,254,0,0,12,247,157,3,225,255,255,196,
+    243,0,3,177,255,255,196,128,128,247,0,0,36,254,235,3,86,20,20,15,247,0,0,39,254,255,0,78,254,0,128,254,
+    0,0,9,251,118,0,121,254,137,0,42,254,0,254,0,0,20,251,255,0,216,250,0,128,128,3,121,196,196,166,3,157,
+    255,255,216,128,128,128,128,128,3,24,39,39,33,253,0,128,128,128,128,128,3,145,235,235,199,3,157,255,255,216,128,128,
+    128,128,128,254,0,0,15,254,196,0,75,254,0,0,20,254,255,0,98,128,128,128,128,128,254,0,0,3,254,39,0,15,
+    249,0,128,128,128,128,128,254,0,0,18,254,235,0,91,254,0,0,20,254,255,0,98,128,128,128,128,128,128,128,128,3,
+    74,137,137,136,254,118,0,45,3,137,255,255,235,253,0,128,3,127,235,235,217,253,0,244,0,0,30,251,196,0,151,244,
+    0,0,39,251,255,0,196,128,251,0,0,6,251,78,0,94,251,177,0,136,251,0,0,20,251,255,0,216,250,0,128,128,
+    251,216,0,202,251,39,0,33,250,0,251,255,0,235,243,0,128,251,157,0,152,251,98,0,83,250,0,251,0,0,20,251,
+    255,0,216,250,0,128,128,251,0,0,2,251,20,0,53,251,235,0,181,244,0,0,39,251,255,0,196,128,244,0,0,21,
+    251,137,0,106,0,42,237,78,0,18,0,137,237,255,0,59,128,128,0,21,237,39,0,9,235,0,128,0,53,237,98,0,
+    23,0,137,237,255,0,59,128,128,0,11,237,20,0,5,0,106,251,196,0,75,243,0,0,137,251,255,0,98,243,0,128,
+    0,95,251,177,0,116,251,78,0,24,250,0,250,0,0,157,251,255,0,78,250,0,128,128,250,0,0,24,251,39,0,161,
+    251,216,0,50,243,0,0,177,251,255,0,59,128,250,0,0,60,251,98,0,139,251,157,0,36,250,0,0,157,251,255,0,
+    78,250,0,128,128,0,127,251,235,0,103,251,20,0,6,250,0,0,137,251,255,0,98,243,0,128,0,74,251,137,0,53,
+    243,0,254,0,0,14,247,177,0,54,254,0,254,0,0,20,247,255,0,78,254,0,128,3,32,59,59,69,247,196,3,101,
+    59,59,45,3,137,255,255,235,247,0,3,177,255,255,196,128,128,3,32,59,59,54,247,0,3,177,255,255,196,243,0,3,
+    177,255,255,196,128,247,0,0,12,254,78,3,146,177,177,136,247,0,0,39,254,255,0,78,254,0,128,128,250,0,3,133,
+    216,216,189,254,39,0,12,254,0,250,0,3,157,255,255,216,250,0,128,128,128,128,128,250,0,3,12,20,20,17,250,0,
+    239,0,128,250,0,3,72,118,118,100,250,0,250,0,3,157,255,255,216,250,0,128,128,251,0,0,14,247,177,0,54,250,
+    0,251,0,0,20,247,255,0,78,250,0,128,254,0,3,32,59,59,69,247,196,3,101,59,59,45,253,0,254,0,3,137,
+    255,255,235,247,0,3,177,255,255,196,253,0,128,128,254,196,3,122,59,59,54,254,0,0,121,251,196,3,101,59,59,91,
+    254,196,0,45,254,255,0,118,251,0,0,157,251,255,3,78,0,0,59,254,255,0,59,128,254,255,3,118,0,0,6,254,
+    78,3,139,177,177,189,254,255,3,78,0,0,59,254,255,0,59,254,255,3,118,0,0,20,254,255,3,98,0,0,39,254,
+    255,3,78,0,0,59,254,255,0,59,128,128,128,128,128,254,255,3,118,0,0,12,254,157,3,121,98,98,122,254,255,3,
+    146,98,98,112,254,157,0,36,254,255,0,118,251,0,0,157,248,255,0,196,253,0,128,128,254,20,3,136,235,235,217,254,
+    0,0,12,248,20,0,15,253,0,254,0,3,137,255,255,235,239,0,128,254,0,3,74,137,137,136,244,118,0,91,253,0,
+    251,0,0,20,244,255,0,196,253,0,128,128,250,0,0,109,251,177,0,54,250,0,250,0,0,157,251,255,0,78,250,0,
+    128,128,128,128,128,254,0,0,15,254,196,0,112,251,59,3,154,196,196,151,253,0,254,0,0,20,254,255,0,98,251,0,
+    3,177,255,255,196,253,0,128,128,128,128,128,254,0,0,20,254,255,0,231,251,216,3,243,255,255,196,253,0,254,0,0,
+    20,244,255,0,196,253,0,128,3,53,98,98,103,244,157,0,143,254,98,0,23,3,137,255,255,235,244,0,0,59,254,255,
+    0,59,128,128,128,128,128,128,128,128,128,0,95,244,177,0,54,250,0,0,137,244,255,0,78,250,0,128,3,137,255,255,
+    250,247,196,3,101,59,59,45,253,0,3,137,255,255,235,247,0,3,177,255,255,196,253,0,128,128,128,128,128,3,137,255,
+    255,241,247,78,3,201,255,255,196,253,0,0,137,241,255,0,196,253,0,128,128,3,137,255,255,238,244,39,0,80,254,216,
+    0,50,3,137,255,255,235,244,0,0,59,254,255,0,59,128,128,128,128,128,128,128,128,3,137,255,255,244,244,118,0,122,
+    254,137,0,32,0,137,241,255,0,196,253,0,128,128,250,0,0,109,248,177,0,136,253,0,250,0,0,157,248,255,0,196,
+    253,0,128,254,0,0,5,254,59,0,143,248,196,0,164,254,59,0,14,254,0,0,20,254,255,0,98,248,0,0,59,254,
+    255,0,59,128,128,3,106,196,196,186,254,59,0,23,248,0,0,14,254,59,0,14,3,137,255,255,235,239,0,128,128,128,
+    128,128,128,128,128,128,128,128,128,3,11,20,20,36,254,235,0,91,248,0,0,54,254,235,0,54,254,0,0,20,254,255,
+    0,98,248,0,0,59,254,255,0,59,128,254,0,0,11,254,137,0,125,248,118,0,122,254,137,0,32,250,0,0,157,248,
+    255,0,196,253,0,128,128,0,95,241,177,0,136,0,137,241,255,0,196,128,3,137,255,255,250,244,196,0,151,3,137,255,
+    255,235,243,0,128,128,128,128,128,3,137,255,255,241,247,78,0,24,254,0,0,137,244,255,0,78,254,0,128,128,3,137,
+    255,255,238,247,39,0,12,254,0,3,137,255,255,235,243,0,128,128,128,128,128,128,128,128,3,137,255,255,244,244,118,0,
+    91,0,137,241,255,0,196,128,128,0,95,241,177,0,136,0,137,241,255,0,196,128,3,137,255,255,250,244,196,0,151,3,
+    137,255,255,235,243,0,128,128,128,128,128,3,137,255,255,241,247,78,0,24,254,0,0,137,244,255,0,78,254,0,128,128,
+    3,137,255,255,238,247,39,0,12,254,0,3,137,255,255,235,243,0,128,128,128,128,128,128,128,128,128,128,128,128,250,0,
+    0,109,248,177,0,136,253,0,250,0,0,157,248,255,0,196,253,0,128,254,0,0,5,254,59,0,143,248,196,0,164,254,
+    59,0,14,254,0,0,20,254,255,0,98,248,0,0,59,254,255,0,59,128,128,3,106,196,196,186,254,59,0,23,248,0,
+    0,14,254,59,0,14,3,137,255,255,235,239,0,128,128,128,128,128,3,137,255,255,235,251,0,0,33,247,216,0,50,3,
+    137,255,255,235,251,0,0,39,247,255,0,59,128,3,137,255,255,235,251,0,0,24,251,157,0,180,254,255,0,59,3,137,
+    255,255,235,244,0,0,59,254,255,0,59,128,128,3,11,20,20,36,254,235,0,91,248,0,0,59,254,255,0,59,254,0,
+    0,20,254,255,0,98,248,0,0,59,254,255,0,59,128,254,0,0,11,254,137,0,125,248,118,0,122,254,137,0,32,250,
+    0,0,157,248,255,0,196,253,0,128,128,3,95,177,177,163,244,0,0,41,254,177,0,41,3,137,255,255,235,244,0,0,
+    59,254,255,0,59,128,128,128,128,128,128,128,128,3,137,255,255,241,244,78,0,119,254,255,0,59,0,137,237,255,0,59,
+    128,128,3,137,255,255,238,244,39,0,89,254,255,0,59,3,137,255,255,235,244,0,0,59,254,255,0,59,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,14,247,177,0,54,0,20,247,255,0,78,128,0,15,254,196,3,232,255,255,246,254,196,
+    0,60,253,0,3,157,255,255,216,253,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,9,
+    254,118,3,202,255,255,234,254,118,0,36,0,20,247,255,0,78,128,128,254,0,0,14,247,177,0,54,254,0,0,20,247,
+    255,0,78,128,254,0,0,15,251,196,0,205,254,255,0,78,247,0,0,39,254,255,0,78,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,0,63,248,118,0,121,254,137,0,42,0,137,248,255,0,216,253,0,128,128,3,
+    95,177,177,163,244,0,0,41,254,177,0,41,3,137,255,255,235,244,0,0,59,254,255,0,59,128,3,137,255,255,235,247,
+    0,3,41,59,59,91,254,196,0,45,3,137,255,255,235,247,0,3,177,255,255,196,253,0,128,128,3,137,255,255,235,251,
+    0,0,30,254,196,3,101,59,59,45,253,0,3,137,255,255,235,251,0,0,39,254,255,0,78,250,0,128,3,137,255,255,
+    235,254,0,3,48,78,78,94,254,177,0,54,250,0,3,137,255,255,235,254,0,3,157,255,255,216,246,0,128,128,3,137,
+    255,255,252,254,216,3,240,255,255,216,246,0,0,137,248,255,0,216,246,0,128,3,137,255,255,247,251,157,0,148,254,98,
+    0,30,250,0,3,137,255,255,235,251,0,0,39,254,255,0,78,250,0,128,128,3,137,255,255,235,251,0,0,3,254,20,
+    3,169,235,235,181,253,0,3,137,255,255,235,247,0,3,177,255,255,196,253,0,128,3,137,255,255,235,247,0,3,95,137,
+    137,133,254,118,0,27,3,137,255,255,235,244,0,0,59,254,255,0,59,128,128,3,95,177,177,163,243,0,3,137,255,255,
+    235,243,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,3,137,255,255,244,244,118,
+    0,91,0,137,241,255,0,196,128,128,251,177,0,163,247,0,0,122,251,177,0,41,251,255,0,235,247,0,0,177,251,255,
+    0,59,128,128,128,128,128,254,255,3,149,59,59,69,254,196,3,75,0,0,30,254,196,3,101,59,59,104,254,255,0,59,
+    254,255,3,118,0,0,20,254,255,3,98,0,0,39,254,255,3,78,0,0,59,254,255,0,59,128,128,128,128,128,254,255,
+    3,118,0,0,3,254,39,3,148,216,216,189,254,39,3,12,0,0,59,254,255,0,59,254,255,0,118,251,0,3,157,255,
+    255,216,251,0,0,59,254,255,0,59,128,128,128,128,128,254,255,0,118,251,0,3,12,20,20,17,251,0,0,59,254,255,
+    0,59,254,255,0,118,241,0,0,59,254,255,0,59,128,128,128,128,128,0,95,251,177,0,68,248,0,0,41,254,177,0,
+    41,0,137,251,255,0,98,248,0,0,59,254,255,0,59,128,128,128,128,128,3,137,255,255,240,254,59,3,143,196,196,166,
+    251,0,0,59,254,255,0,59,3,137,255,255,235,254,0,3,157,255,255,216,251,0,0,59,254,255,0,59,128,128,128,128,
+    128,3,137,255,255,235,254,0,3,24,39,39,66,254,216,3,66,0,0,59,254,255,0,59,3,137,255,255,235,251,0,0,
+    39,254,255,3,78,0,0,59,254,255,0,59,128,128,128,128,128,3,137,255,255,235,251,0,0,3,254,20,3,169,235,235,
+    240,254,255,0,59,3,137,255,255,235,247,0,0,177,251,255,0,59,128,128,128,128,128,250,0,0,109,251,177,0,54,250,
+    0,250,0,0,157,251,255,0,78,250,0,128,254,0,0,5,254,59,0,143,251,196,3,101,59,59,45,253,0,254,0,0,
+    20,254,255,0,98,251,0,3,177,255,255,196,253,0,128,128,3,106,196,196,186,254,59,0,23,251,0,3,41,59,59,91,
+    254,196,0,45,3,137,255,255,235,244,0,0,59,254,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,3,11,20,
+    20,36,254,235,0,91,251,0,3,163,235,235,186,254,20,0,5,254,0,0,20,254,255,0,98,251,0,3,177,255,255,196,
+    253,0,128,254,0,0,11,254,137,0,125,251,118,3,131,137,137,106,253,0,250,0,0,157,251,255,0,78,250,0,128,128,
+    0,95,244,177,0,54,254,0,0,137,244,255,0,78,254,0,128,3,137,255,255,250,247,196,3,101,59,59,45,3,137,255,
+    255,235,247,0,3,177,255,255,196,128,128,128,128,128,128,128,128,128,3,137,255,255,252,247,216,3,94,39,39,30,0,137,
+    244,255,0,78,254,0,128,3,137,255,255,247,247,157,0,48,254,0,3,137,255,255,235,243,0,128,128,128,128,128,128,128,
+    128,128,250,0,0,109,251,177,0,54,250,0,250,0,0,157,251,255,0,78,250,0,128,254,0,0,5,254,59,0,143,251,
+    196,3,101,59,59,45,253,0,254,0,0,20,254,255,0,98,251,0,3,177,255,255,196,253,0,128,128,3,106,196,196,186,
+    254,59,0,23,251,0,3,41,59,59,91,254,196,0,45,3,137,255,255,235,244,0,0,59,254,255,0,59,128,128,128,128,
+    128,128,128,128,128,128,128,128,3,11,20,20,36,254,235,0,91,251,0,3,163,235,235,186,254,20,0,5,254,0,0,20,
+    254,255,0,98,251,0,3,177,255,255,196,253,0,128,254,0,0,11,254,137,0,125,251,118,3,131,137,137,133,254,118,0,
+    27,250,0,0,157,251,255,3,78,0,0,59,254,255,0,59,128,128,240,0,0,59,254,255,0,59,128,128,240,0,0,27,
+    254,118,0,27,0,95,244,177,0,54,250,0,0,137,244,255,0,78,250,0,128,3,137,255,255,250,247,196,3,101,59,59,
+    45,253,0,3,137,255,255,235,247,0,3,177,255,255,196,253,0,128,128,128,128,128,128,128,128,128,3,137,255,255,252,247,
+    216,3,94,39,39,30,253,0,0,137,244,255,0,78,250,0,128,3,137,255,255,247,251,157,0,172,254,255,0,78,250,0,
+    3,137,255,255,235,251,0,0,39,254,255,0,78,250,0,128,128,3,137,255,255,235,251,0,0,3,254,20,3,169,235,235,
+    181,253,0,3,137,255,255,235,247,0,3,177,255,255,196,253,0,128,3,137,255,255,235,247,0,3,95,137,137,133,254,118,
+    0,27,3,137,255,255,235,244,0,0,59,254,255,0,59,128,128,254,0,0,14,244,177,0,136,253,0,254,0,0,20,244,
+    255,0,196,253,0,128,3,32,59,59,69,244,196,0,164,254,59,0,14,3,137,255,255,235,244,0,0,59,254,255,0,59,
+    128,128,3,137,255,255,235,244,0,0,14,254,59,0,14,3,137,255,255,235,239,0,128,3,95,177,177,169,251,78,0,66,
+    246,0,254,0,0,20,251,255,0,216,246,0,128,128,254,0,0,3,251,39,0,66,251,216,0,166,253,0,247,0,0,39,
+    251,255,0,196,253,0,128,247,0,0,24,251,157,0,143,254,98,0,23,240,0,0,59,254,255,0,59,128,128,3,127,235,
+    235,217,244,0,0,59,254,255,0,59,3,137,255,255,235,244,0,0,59,254,255,0,59,128,3,74,137,137,136,244,118,0,
+    122,254,137,0,32,254,0,0,20,244,255,0,196,253,0,128,128,233,177,0,41,233,255,0,59,128,247,196,3,232,255,255,
+    246,247,196,0,45,247,0,3,157,255,255,216,246,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,3,95,177,177,163,244,0,0,41,254,177,0,41,3,137,255,255,235,244,0,0,59,254,255,0,59,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,3,74,137,137,136,244,118,0,122,254,137,
+    0,32,254,0,0,20,244,255,0,196,253,0,128,128,254,177,0,81,241,0,0,41,254,177,0,41,254,255,0,118,241,0,
+    0,59,254,255,0,59,128,128,128,128,128,254,59,3,133,196,196,181,247,0,3,136,196,196,164,254,59,0,14,254,0,3,
+    137,255,255,235,247,0,3,177,255,255,196,253,0,128,128,128,128,128,254,0,3,21,39,39,53,254,216,3,83,0,0,33,
+    254,216,3,94,39,39,30,253,0,251,0,0,20,254,255,3,98,0,0,39,254,255,0,78,250,0,128,128,128,128,128,251,
+    0,0,2,254,20,3,152,235,235,202,254,20,0,6,250,0,247,0,3,157,255,255,216,246,0,128,128,128,128,128,254,177,
+    0,81,241,0,0,41,254,177,0,41,254,255,0,118,241,0,0,59,254,255,0,59,128,254,255,0,118,251,0,3,36,59,
+    59,50,251,0,0,59,254,255,0,59,254,255,0,118,251,0,3,157,255,255,216,251,0,0,59,254,255,0,59,128,128,128,
+    128,128,254,255,3,118,0,0,6,254,78,3,139,177,177,161,254,78,3,24,0,0,59,254,255,0,59,254,255,3,118,0,
+    0,20,254,255,3,98,0,0,39,254,255,3,78,0,0,59,254,255,0,59,128,128,128,128,128,254,157,3,125,98,98,110,
+    254,255,3,98,0,0,39,254,255,3,146,98,98,112,254,157,0,36,254,0,0,137,251,255,3,98,0,0,39,251,255,0,
+    196,253,0,128,128,254,0,3,137,255,255,237,254,20,3,8,0,0,3,254,20,3,183,255,255,196,253,0,254,0,3,137,
+    255,255,235,247,0,3,177,255,255,196,253,0,128,128,128,128,128,3,95,177,177,163,244,0,0,41,254,177,0,41,3,137,
+    255,255,235,244,0,0,59,254,255,0,59,128,128,128,128,128,3,32,59,59,69,254,196,0,75,251,0,3,136,196,196,164,
+    254,59,0,14,254,0,0,20,254,255,0,98,251,0,3,177,255,255,196,253,0,128,254,0,0,14,254,177,0,116,251,78,
+    3,146,177,177,136,253,0,250,0,0,157,251,255,0,78,250,0,128,128,128,128,128,254,0,0,8,254,98,0,134,251,157,
+    3,116,98,98,75,253,0,254,0,0,20,254,255,0,98,251,0,3,177,255,255,196,253,0,128,128,3,127,235,235,219,254,
+    20,0,8,251,0,3,14,20,20,69,254,235,0,54,3,137,255,255,235,244,0,0,59,254,255,0,59,128,128,128,128,128,
+    254,177,0,81,241,0,0,41,254,177,0,41,254,255,0,118,241,0,0,59,254,255,0,59,128,128,128,128,128,254,59,3,
+    133,196,196,181,247,0,3,136,196,196,164,254,59,0,14,254,0,3,137,255,255,235,247,0,3,177,255,255,196,253,0,128,
+    254,0,3,95,177,177,169,254,78,3,30,0,0,12,254,78,3,146,177,177,136,253,0,251,0,0,20,254,255,3,98,0,
+    0,39,254,255,0,78,250,0,128,128,251,0,0,3,254,39,3,148,216,216,189,254,39,0,12,250,0,247,0,3,157,255,
+    255,216,246,0,128,128,128,128,128,128,128,128,128,128,128,128,0,95,237,177,0,41,0,137,237,255,0,59,128,0,106,241,
+    196,0,210,254,255,0,59,240,0,0,59,254,255,0,59,128,128,243,0,3,136,196,196,164,254,59,0,14,243,0,3,177,
+    255,255,196,253,0,128,247,0,0,12,254,78,3,146,177,177,136,253,0,247,0,0,39,254,255,0,78,250,0,128,128,250,
+    0,3,133,216,216,189,254,39,0,12,250,0,250,0,3,157,255,255,216,246,0,128,254,0,0,8,254,98,3,134,157,157,
+    133,246,0,254,0,0,20,254,255,0,98,243,0,128,128,3,127,235,235,219,254,20,0,8,243,0,3,137,255,255,235,239,
+    0,128,3,137,255,255,244,240,118,0,27,0,137,237,255,0,59,128,128,0,3,247,39,0,12,0,20,247,255,0,78,128,
+    128,0,20,254,255,0,146,251,78,0,24,0,20,254,255,0,98,250,0,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,20,254,255,0,183,251,137,0,42,0,20,247,255,0,78,
+    128,0,18,247,235,0,72,3,21,39,39,36,243,0,3,137,255,255,235,243,0,128,128,128,128,128,3,106,196,196,186,254,
+    59,0,23,247,0,254,0,0,20,254,255,0,98,247,0,128,128,128,128,128,254,0,0,14,254,177,3,116,78,78,66,250,
+    0,250,0,3,157,255,255,216,250,0,128,128,128,128,128,250,0,3,97,157,157,148,254,98,0,30,254,0,247,0,0,39,
+    254,255,0,78,254,0,128,128,128,128,128,247,0,0,21,254,137,3,124,118,118,91,243,0,3,177,255,255,196,128,128,128,
+    128,128,243,0,3,81,118,118,91,0,3,247,39,0,12,0,20,247,255,0,78,128,128,0,6,251,78,0,106,254,255,0,
+    78,250,0,0,39,254,255,0,78,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,0,11,251,137,0,155,254,255,0,78,0,20,247,255,0,78,128,0,18,247,235,0,72,250,0,3,
+    24,39,39,33,250,0,250,0,3,157,255,255,216,250,0,128,128,128,128,128,254,0,0,5,254,59,3,143,196,196,175,254,
+    59,0,18,254,0,254,0,0,20,254,255,3,98,0,0,39,254,255,0,78,254,0,128,128,128,128,128,3,42,78,78,86,
+    254,177,3,68,0,0,27,254,177,3,109,78,78,60,3,137,255,255,235,247,0,3,177,255,255,196,128,128,128,128,128,3,
+    84,157,157,145,247,0,3,109,157,157,121,233,255,0,59,128,128,233,118,0,27,0,3,254,39,0,15,254,0,0,20,254,
+    255,0,98,254,0,128,128,0,6,254,78,3,139,177,177,149,253,0,3,157,255,255,216,128,253,0,3,121,196,196,166,254,
+    0,0,15,247,196,0,60,254,0,254,0,0,20,247,255,0,78,254,0,128,254,0,0,14,247,177,3,109,78,78,60,243,
+    0,3,177,255,255,196,128,128,254,0,0,17,247,216,3,243,255,255,196,254,0,0,20,244,255,0,196,128,3,53,98,98,
+    103,247,157,3,225,255,255,196,3,137,255,255,235,247,0,3,177,255,255,196,128,128,128,128,128,3,74,137,137,136,247,118,
+    3,213,255,255,196,254,0,0,20,244,255,0,196,128,128,254,0,0,15,247,196,0,60,254,0,254,0,0,20,247,255,0,
+    78,254,0,128,3,42,78,78,86,247,177,3,109,78,78,60,3,137,255,255,235,247,0,3,177,255,255,196,128,128,3,137,
+    255,255,235,247,0,3,27,39,39,30,3,137,255,255,235,243,0,128,128,128,128,128,3,137,255,255,235,247,0,3,163,235,
+    235,181,3,137,255,255,235,247,0,3,177,255,255,196,128,3,74,137,137,136,247,118,3,131,137,137,106,254,0,0,20,247,
+    255,0,78,254,0,128,128,243,0,3,27,39,39,30,243,0,3,177,255,255,196,128,128,128,128,128,128,128,128,128,254,0,
+    0,15,247,196,3,237,255,255,196,254,0,0,20,244,255,0,196,128,3,42,78,78,86,247,177,3,231,255,255,196,3,137,
+    255,255,235,247,0,3,177,255,255,196,128,128,128,128,128,128,128,128,128,128,128,128,3,74,137,137,136,247,118,3,213,255,
+    255,196,254,0,0,20,244,255,0,196,128,128,250,0,0,24,248,39,0,30,250,0,0,157,248,255,0,196,128,128,254,0,
+    0,14,254,177,0,116,248,78,0,60,254,0,0,20,254,255,0,98,247,0,128,128,128,128,128,3,106,196,196,201,254,255,
+    0,219,251,196,0,60,254,0,0,137,244,255,0,78,254,0,128,3,95,177,177,183,254,255,0,207,251,177,0,54,254,0,
+    254,0,0,20,254,255,0,98,247,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,3,21,39,39,36,243,
+    0,3,137,255,255,235,243,0,128,128,128,128,128,128,128,128,128,3,137,255,255,250,247,196,0,60,254,0,0,137,244,255,
+    0,78,254,0,128,3,137,255,255,249,247,177,3,109,78,78,60,3,137,255,255,235,247,0,3,177,255,255,196,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,253,0,3,24,39,39,33,253,0,3,157,255,255,216,128,128,253,0,3,
+    48,78,78,66,249,0,128,128,128,128,128,0,15,251,196,0,166,0,20,251,255,0,216,128,0,14,254,177,3,225,255,255,
+    216,253,0,3,157,255,255,216,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,247,0,0,6,254,39,0,12,
+    247,0,0,39,254,255,0,78,128,128,247,0,0,12,254,78,0,24,242,0,128,128,128,128,128,250,0,0,121,251,196,0,
+    60,250,0,0,157,251,255,0,78,128,250,0,3,109,177,177,189,254,255,0,78,247,0,0,39,254,255,0,78,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,74,248,137,0,134,254,118,0,36,0,137,248,255,0,216,
+    253,0,128,0,127,248,235,0,199,253,0,3,21,39,39,36,243,0,3,137,255,255,235,243,0,128,128,128,128,128,128,128,
+    128,128,3,137,255,255,235,247,0,3,136,196,196,151,3,137,255,255,235,247,0,3,177,255,255,196,128,3,137,255,255,235,
+    251,0,0,12,254,78,3,146,177,177,136,3,137,255,255,235,251,0,0,39,254,255,0,78,254,0,128,128,3,137,255,255,
+    235,254,0,3,133,216,216,189,254,39,0,12,254,0,3,137,255,255,235,254,0,3,157,255,255,216,250,0,128,3,137,255,
+    255,243,254,98,3,195,255,255,216,250,0,0,137,248,255,0,216,250,0,128,128,3,137,255,255,237,251,20,0,53,254,235,
+    0,72,254,0,3,137,255,255,235,251,0,0,39,254,255,0,78,254,0,128,3,137,255,255,235,251,0,0,21,254,137,3,
+    124,118,118,91,3,137,255,255,235,247,0,3,177,255,255,196,128,128,0,3,251,39,0,33,0,20,251,255,0,216,128,128,
+    0,6,254,78,3,187,255,255,216,253,0,3,157,255,255,216,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,247,196,3,75,0,0,30,251,196,0,151,253,0,247,255,3,98,0,0,39,251,255,
+    0,196,253,0,128,254,255,0,213,251,177,3,116,78,78,94,251,177,0,154,254,78,0,18,254,255,0,118,251,0,3,157,
+    255,255,216,251,0,0,59,254,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,106,244,196,0,
+    60,254,0,0,137,244,255,0,78,254,0,128,3,137,255,255,249,247,177,3,109,78,78,60,3,137,255,255,235,247,0,3,
+    177,255,255,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,254,0,0,15,247,196,0,60,254,0,254,0,
+    0,20,247,255,0,78,254,0,128,3,42,78,78,86,247,177,3,109,78,78,60,3,137,255,255,235,247,0,3,177,255,255,
+    196,128,128,128,128,128,128,128,128,128,128,128,128,3,74,137,137,136,247,118,3,131,137,137,106,254,0,0,20,247,255,0,
+    78,254,0,128,128,0,106,244,196,0,60,254,0,0,137,244,255,0,78,254,0,128,3,137,255,255,249,247,177,3,109,78,
+    78,60,3,137,255,255,235,247,0,3,177,255,255,196,128,128,128,128,128,128,128,128,128,128,128,128,3,137,255,255,244,247,
+    118,3,131,137,137,106,0,137,244,255,0,78,254,0,128,128,3,137,255,255,235,243,0,128,128,128,128,128,128,128,128,128,
+    3,53,98,98,91,243,0,254,0,0,15,244,196,0,151,254,0,0,20,244,255,0,196,128,3,42,78,78,86,247,177,3,
+    231,255,255,196,3,137,255,255,235,247,0,3,177,255,255,196,128,128,128,128,128,128,128,128,128,128,128,128,3,74,137,137,
+    136,247,118,3,213,255,255,196,254,0,0,20,244,255,0,196,128,128,243,0,3,177,255,255,196,128,128,128,128,128,128,128,
+    128,128,243,0,3,68,98,98,75,3,106,196,196,181,254,0,0,121,251,196,0,60,254,0,3,137,255,255,235,254,0,0,
+    157,251,255,0,78,254,0,128,3,137,255,255,241,254,78,0,139,251,177,3,109,78,78,60,0,137,251,255,0,98,251,0,
+    3,177,255,255,196,128,128,3,137,255,255,238,254,39,0,15,251,0,3,27,39,39,30,3,137,255,255,235,243,0,128,128,
+    128,128,128,128,128,128,128,128,128,128,254,0,0,15,244,196,0,151,254,0,0,20,244,255,0,196,128,3,42,78,78,86,
+    244,177,0,136,3,137,255,255,235,243,0,128,128,3,21,39,39,53,251,216,0,183,250,0,254,0,0,20,251,255,0,216,
+    250,0,128,254,0,0,12,251,157,0,148,254,98,0,30,254,0,247,0,0,39,254,255,0,78,254,0,128,128,247,0,0,
+    3,254,20,3,169,235,235,181,243,0,3,177,255,255,196,128,0,63,244,118,3,131,137,137,106,0,137,244,255,0,78,254,
+    0,128,128,0,14,254,177,0,68,247,0,0,20,254,255,0,98,247,0,128,128,128,128,128,0,20,254,255,0,219,248,196,
+    0,151,0,20,244,255,0,196,128,0,20,254,255,0,207,248,177,0,136,0,20,254,255,0,98,247,0,128,128,128,128,128,
+    128,128,128,128,128,128,128,0,11,254,137,0,125,248,118,0,91,253,0,0,157,248,255,0,196,128,128,3,106,196,196,181,
+    247,0,3,136,196,196,151,3,137,255,255,235,247,0,3,177,255,255,196,128,128,128,128,128,3,21,39,39,53,254,216,3,
+    83,0,0,33,254,216,3,94,39,39,30,254,0,0,20,254,255,3,98,0,0,39,254,255,0,78,254,0,128,128,128,128,
+    128,254,0,0,2,254,20,3,152,235,235,202,254,20,0,6,254,0,250,0,3,157,255,255,216,250,0,128,128,128,128,128,
+    254,196,0,91,241,0,0,45,254,196,0,45,254,255,0,118,241,0,0,59,254,255,0,59,128,254,255,0,118,251,0,3,
+    48,78,78,66,251,0,0,59,254,255,0,59,254,255,0,118,251,0,3,157,255,255,216,251,0,0,59,254,255,0,59,128,
+    128,128,128,128,254,255,3,118,0,0,8,254,98,3,134,157,157,148,254,98,3,30,0,0,59,254,255,0,59,254,255,3,
+    118,0,0,20,254,255,3,98,0,0,39,254,255,3,78,0,0,59,254,255,0,59,128,128,254,20,3,136,235,235,237,254,
+    255,3,98,0,0,39,254,255,3,241,235,235,186,254,20,0,5,254,0,0,137,251,255,3,98,0,0,39,251,255,0,196,
+    253,0,128,254,0,3,137,255,255,246,254,137,3,53,0,0,21,254,137,3,219,255,255,196,253,0,254,0,3,137,255,255,
+    235,247,0,3,177,255,255,196,253,0,128,128,3,106,196,196,181,247,0,3,136,196,196,151,3,137,255,255,235,247,0,3,
+    177,255,255,196,128,3,95,177,177,169,254,78,3,30,0,0,12,254,78,3,146,177,177,136,254,0,0,20,254,255,3,98,
+    0,0,39,254,255,0,78,254,0,128,128,254,0,0,3,254,39,3,148,216,216,189,254,39,0,12,254,0,250,0,3,157,
+    255,255,216,250,0,128,128,128,128,128,254,0,0,18,254,235,3,103,20,20,53,254,235,0,72,254,0,254,0,0,20,254,
+    255,3,98,0,0,39,254,255,0,78,254,0,128,3,63,118,118,119,254,137,3,53,0,0,21,254,137,3,124,118,118,91,
+    3,137,255,255,235,247,0,3,177,255,255,196,128,128,3,106,196,196,181,247,0,3,136,196,196,151,3,137,255,255,235,247,
+    0,3,177,255,255,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,3,74,137,137,136,247,118,3,213,255,255,
+    196,254,0,0,20,244,255,0,196,128,128,243,0,3,177,255,255,196,128,128,128,128,128,254,0,0,2,247,20,3,169,235,
+    235,181,254,0,0,20,247,255,0,78,254,0,128,128,254,0,0,8,247,98,0,30,254,0,0,106,241,196,0,151,0,137,
+    241,255,0,196,128,0,95,244,177,3,231,255,255,196,243,0,3,177,255,255,196,128,128,247,0,0,33,254,216,3,94,39,
+    39,30,247,0,0,39,254,255,0,78,254,0,128,250,0,3,60,98,98,107,254,157,0,48,254,0,250,0,3,157,255,255,
+    216,250,0,128,128,254,0,0,18,254,235,3,103,20,20,17,250,0,254,0,0,20,254,255,0,98,247,0,128,3,63,118,
+    118,128,254,255,0,171,248,118,0,91,0,137,241,255,0,196,128,128,247,0,0,6,251,39,0,30,247,0,0,39,251,255,
+    0,196,128,128,250,0,3,109,177,177,161,251,78,0,60,250,0,3,157,255,255,216,250,0,128,128,128,128,128,128,128,128,
+    128,128,128,128,0,116,251,216,3,107,39,39,33,250,0,0,137,251,255,0,98,247,0,128,0,84,251,157,3,121,98,98,
+    83,250,0,250,0,3,157,255,255,216,250,0,128,128,128,128,128,128,128,128,128,128,128,128,250,0,3,72,118,118,121,251,
+    137,0,106,247,0,0,39,251,255,0,196,128,247,0,0,36,251,235,0,181,3,24,39,39,33,3,157,255,255,216,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,3,145,235,235,199,0,21,251,39,0,15,247,0,0,137,251,255,0,98,247,0,128,128,0,42,251,78,3,139,177,
+    177,149,250,0,250,0,3,157,255,255,216,250,0,128,128,128,128,128,128,128,128,128,128,128,128,250,0,3,24,39,39,66,
+    251,216,0,166,247,0,0,39,251,255,0,196,128,250,0,3,60,98,98,107,251,157,0,121,250,0,3,157,255,255,216,250,
+    0,128,128,128,128,128,128,128,128,128,128,128,128,0,74,251,137,3,125,118,118,100,250,0,0,137,251,255,0,98,247,0,
+    128,0,127,251,235,0,91,247,0,254,0,0,42,248,78,0,66,251,0,0,18,254,78,0,18,254,0,0,137,248,255,0,
+    216,251,0,0,59,254,255,0,59,128,128,254,216,0,121,251,39,3,172,255,255,249,251,216,0,175,254,39,0,9,254,255,
+    0,118,251,0,0,157,248,255,0,196,253,0,128,254,157,0,72,251,0,0,97,248,157,0,121,253,0,0,30,242,196,0,
+    45,250,0,0,39,242,255,0,59,250,0,128,128,0,39,254,255,0,183,246,20,0,186,254,235,0,18,254,0,0,39,254,
+    255,0,177,246,0,0,196,254,255,0,20,254,0,128,0,39,254,255,0,177,246,0,0,181,254,235,3,36,20,20,18,0,
+    39,254,255,0,177,242,0,3,235,255,255,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,39,254,255,0,177,
+    246,0,0,136,254,177,3,86,78,78,72,0,39,254,255,0,177,246,0,0,196,254,255,0,20,254,0,128,128,0,39,254,
+    255,0,243,246,216,0,80,254,39,0,3,254,0,0,39,242,255,0,59,250,0,128,128,253,0,0,6,246,20,0,5,253,
+    0,253,0,0,78,246,255,0,59,253,0,128,128,0,9,254,59,0,101,246,196,0,91,254,59,0,5,0,39,254,255,0,
+    177,246,0,0,196,254,255,0,20,128,128,0,39,254,255,0,207,246,98,0,219,254,255,0,20,0,39,238,255,0,20,128,
+    128,0,39,254,255,0,213,242,118,0,9,0,39,254,255,0,177,241,0,128,128,0,39,254,255,0,177,246,0,0,136,254,
+    177,0,14,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,0,6,254,39,0,94,246,216,0,80,254,39,0,
+    3,253,0,0,78,246,255,0,59,253,0,128,128,0,24,254,157,0,109,241,0,0,39,254,255,0,177,241,0,128,128,128,
+    128,128,128,128,128,128,0,39,254,255,0,183,246,20,0,5,253,0,0,39,242,255,0,59,253,0,128,128,0,39,254,255,
+    0,237,246,196,0,91,254,59,0,5,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,0,39,254,255,0,243,246,216,0,80,254,39,0,3,0,39,242,255,0,59,253,0,128,128,0,3,
+    254,20,0,14,246,0,0,15,254,20,0,2,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,0,6,254,39,0,94,246,216,0,246,254,255,0,20,253,0,0,78,242,255,
+    0,20,128,128,253,0,0,6,242,20,0,2,253,0,0,78,242,255,0,20,128,128,0,9,254,59,0,101,246,196,0,241,
+    254,255,0,20,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    0,6,254,39,0,94,246,216,0,246,254,255,0,20,253,0,0,78,242,255,0,20,128,128,241,0,0,196,254,255,0,20,
+    128,128,128,128,128,128,253,0,0,24,246,78,0,154,254,177,0,14,253,0,0,78,246,255,0,59,253,0,128,128,253,0,
+    0,42,246,137,0,32,253,0,0,91,254,196,0,75,0,118,254,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,0,36,254,78,0,30,252,0,128,128,0,100,254,216,0,83,0,118,254,255,0,98,128,
+    128,0,48,254,157,0,84,254,0,0,97,254,157,0,36,0,78,254,255,0,137,254,0,0,157,254,255,0,59,128,128,128,
+    128,128,128,128,128,128,0,72,254,235,0,127,254,0,0,145,254,235,0,54,246,0,0,91,254,196,0,75,254,0,0,151,
+    254,196,0,15,254,0,246,0,0,118,254,255,0,98,254,0,0,196,254,255,0,20,254,0,128,128,128,128,128,254,0,0,
+    3,250,20,0,128,254,255,0,110,254,20,0,201,254,255,3,38,20,20,18,254,0,0,39,235,255,0,235,128,128,254,0,
+    0,30,254,196,0,214,254,255,0,228,254,196,0,232,254,255,0,210,251,196,0,181,250,0,0,78,254,255,0,137,254,0,
+    0,157,254,255,0,59,250,0,128,128,128,128,128,128,250,137,0,174,254,255,0,201,254,137,0,210,254,255,0,164,254,137,
+    0,11,254,0,234,255,0,20,254,0,128,128,254,78,0,106,254,255,0,201,254,78,0,160,254,255,0,146,250,78,0,6,
+    254,0,254,0,0,39,254,255,0,177,254,0,0,118,254,255,0,98,246,0,128,128,128,128,128,128,249,0,0,91,254,196,
+    0,75,249,0,249,0,0,118,254,255,0,98,249,0,128,128,253,0,0,72,254,235,0,244,254,255,0,243,250,235,0,18,
+    253,0,0,78,242,255,0,20,128,0,3,254,20,0,86,254,235,0,244,254,255,0,243,250,235,0,18,0,39,254,255,0,
+    177,254,0,0,118,254,255,0,98,249,0,128,128,128,128,128,128,0,24,254,157,0,139,254,98,0,171,254,255,0,158,254,
+    98,0,23,253,0,253,0,0,78,246,255,0,59,253,0,128,128,253,0,0,36,254,118,0,181,254,255,0,171,254,118,0,
+    133,254,137,0,11,249,0,0,118,254,255,0,98,254,0,0,196,254,255,0,20,128,128,128,128,128,128,0,33,250,216,0,
+    234,254,255,0,231,254,216,0,80,254,39,0,3,0,39,242,255,0,59,253,0,128,128,249,0,0,118,254,255,0,98,249,
+    0,128,128,249,0,0,100,254,216,0,83,249,0,254,0,0,30,254,196,0,136,246,0,0,151,254,196,0,15,254,0,254,
+    0,0,39,254,255,0,177,246,0,0,196,254,255,0,20,254,0,128,128,254,235,0,202,254,20,0,86,254,235,0,127,254,
+    0,0,145,254,235,0,69,254,20,0,2,254,0,254,255,0,216,254,0,0,78,254,255,0,137,254,0,0,157,254,255,0,
+    59,250,0,128,128,128,128,128,254,196,0,175,254,59,0,101,254,196,0,133,254,59,0,143,254,196,0,45,250,0,254,0,
+    0,39,254,255,0,177,254,0,0,118,254,255,0,98,246,0,128,128,254,0,0,24,254,157,0,109,254,0,0,118,254,255,
+    0,98,254,0,0,75,254,98,0,8,254,0,246,0,0,118,254,255,0,98,254,0,0,196,254,255,0,20,254,0,128,128,
+    250,0,0,42,254,137,0,128,254,118,0,130,254,137,0,122,254,118,3,136,137,137,127,250,0,0,78,254,255,0,137,254,
+    0,0,157,254,255,0,59,254,0,3,235,255,255,235,128,128,128,128,128,128,254,0,0,33,254,216,0,161,254,39,0,21,
+    254,0,0,24,254,39,0,175,254,216,3,53,39,39,36,254,0,0,39,254,255,0,177,246,0,0,196,254,255,0,20,254,
+    0,128,128,253,0,0,60,250,196,0,75,246,0,253,0,0,78,250,255,0,98,246,0,128,128,0,36,254,235,0,169,250,
+    20,0,152,254,235,0,54,250,0,0,39,254,255,0,177,250,0,0,157,254,255,0,59,250,0,128,128,128,128,128,0,30,
+    254,196,0,154,250,59,0,143,254,196,0,45,254,0,3,54,59,59,54,253,0,0,78,250,255,0,98,250,0,3,235,255,
+    255,235,128,128,0,15,254,98,0,116,250,157,0,121,254,98,0,23,254,0,3,235,255,255,235,0,39,254,255,0,177,250,
+    0,0,157,254,255,0,59,254,0,3,235,255,255,235,128,128,0,39,254,255,0,177,250,0,0,72,254,118,0,133,254,137,
+    3,119,118,118,109,0,39,254,255,0,177,246,0,0,196,254,255,0,20,254,0,128,128,128,128,128,128,0,6,254,39,0,
+    94,246,216,0,80,254,39,3,202,216,216,199,253,0,0,78,246,255,0,59,254,0,3,235,255,255,235,128,128,0,72,254,
+    157,0,60,0,118,254,255,0,98,128,128,128,128,128,128,128,128,128,0,109,254,235,0,91,249,0,0,97,254,157,0,36,
+    249,0,0,157,254,255,0,59,128,128,253,0,0,91,254,196,0,112,254,59,0,14,253,0,0,118,254,255,0,98,253,0,
+    128,128,128,128,128,0,6,254,20,0,119,254,235,0,91,253,0,0,78,254,255,0,137,249,0,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,0,12,254,39,0,121,254,216,0,83,253,0,253,0,0,118,254,255,0,98,253,
+    0,128,128,128,128,128,253,0,0,100,254,216,0,107,254,39,0,9,249,0,0,157,254,255,0,59,128,128,249,0,0,109,
+    254,177,0,41,0,48,254,157,0,84,249,0,0,78,254,255,0,137,249,0,128,128,0,18,254,59,0,122,254,196,0,75,
+    253,0,253,0,0,118,254,255,0,98,253,0,128,128,128,128,128,253,0,0,109,254,235,0,103,254,20,0,5,249,0,0,
+    157,254,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,253,0,0,100,254,216,0,107,254,
+    39,0,9,253,0,0,118,254,255,0,98,253,0,128,128,128,128,128,0,12,254,39,0,121,254,216,0,83,253,0,0,78,
+    254,255,0,137,249,0,128,128,0,54,254,177,0,95,249,0,249,0,0,9,254,20,0,8,249,0,249,0,0,118,254,255,
+    0,98,249,0,128,128,0,9,254,59,0,41,254,0,0,118,254,255,0,98,254,0,0,45,254,59,0,5,0,39,254,255,
+    0,177,254,0,0,118,254,255,0,98,254,0,0,196,254,255,0,20,128,128,0,24,254,157,0,139,254,98,0,171,254,255,
+    0,158,254,98,0,143,254,157,0,12,253,0,0,78,246,255,0,59,253,0,128,128,0,21,254,137,0,131,254,118,0,181,
+    254,255,0,171,254,118,0,133,254,137,0,11,0,39,254,255,0,177,254,0,0,118,254,255,0,98,254,0,0,196,254,255,
+    0,20,128,128,0,12,254,78,0,54,254,0,0,118,254,255,0,98,254,0,0,60,254,78,0,6,249,0,0,118,254,255,
+    0,98,249,0,128,128,249,0,0,18,254,39,0,15,249,0,249,0,0,9,254,20,0,8,249,0,249,0,0,118,254,255,
+    0,98,249,0,128,128,128,128,128,128,0,15,250,98,0,171,254,255,0,158,250,98,0,8,0,39,238,255,0,20,128,128,
+    0,18,250,118,0,181,254,255,0,171,250,118,0,9,249,0,0,118,254,255,0,98,249,0,128,128,128,128,128,128,249,0,
+    0,18,254,39,0,15,249,0,253,0,0,54,254,177,0,95,253,0,0,78,254,255,0,137,128,128,128,128,128,128,128,128,
+    128,0,6,254,39,0,94,254,216,0,116,0,39,254,255,0,177,253,0,128,128,0,27,254,177,0,122,253,0,0,15,238,
+    98,0,8,0,39,238,255,0,20,128,128,0,18,238,118,0,9,0,54,254,177,0,95,0,78,254,255,0,137,128,128,128,
+    128,128,128,241,0,0,121,254,157,0,12,241,0,0,196,254,255,0,20,128,128,128,128,128,128,245,0,0,145,254,235,0,
+    69,254,20,0,2,245,0,0,157,254,255,0,59,253,0,128,128,128,128,128,249,0,0,27,254,59,0,143,254,196,0,45,
+    253,0,249,0,0,118,254,255,0,98,249,0,128,128,128,128,128,128,253,0,0,42,254,137,0,128,254,118,0,45,249,0,
+    253,0,0,78,254,255,0,137,245,0,128,128,128,128,128,128,0,33,254,216,0,161,254,39,0,21,245,0,0,39,254,255,
+    0,177,241,0,128,128,128,128,128,0,33,254,216,0,149,241,0,253,0,0,60,246,196,0,45,253,0,253,0,0,78,246,
+    255,0,59,253,0,128,128,0,36,254,235,0,169,246,20,0,186,254,235,0,18,0,39,254,255,0,177,246,0,0,196,254,
+    255,0,20,128,128,128,128,128,0,39,254,255,0,177,254,0,0,27,254,59,0,23,254,0,0,196,254,255,0,20,0,39,
+    254,255,0,177,254,0,0,118,254,255,0,98,254,0,0,196,254,255,0,20,128,128,128,128,128,128,0,39,254,255,0,177,
+    254,0,0,54,254,118,0,45,254,0,0,196,254,255,0,20,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,
+    128,128,128,128,0,6,254,39,0,94,246,216,0,80,254,39,0,3,253,0,0,78,246,255,0,59,253,0,128,128,249,0,
+    0,91,254,196,0,75,249,0,249,0,0,118,254,255,0,98,249,0,128,128,253,0,0,72,254,235,0,244,254,255,0,98,
+    249,0,253,0,0,78,250,255,0,98,249,0,128,0,3,254,20,0,86,254,235,0,244,254,255,0,98,249,0,0,39,254,
+    255,0,177,254,0,0,118,254,255,0,98,249,0,128,128,0,30,254,196,0,136,254,0,0,118,254,255,0,98,249,0,249,
+    0,0,118,254,255,0,98,249,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,33,250,216,0,234,254,255,0,
+    231,250,216,0,17,0,39,238,255,0,20,128,128,253,0,0,60,246,196,0,45,253,0,253,0,0,78,246,255,0,59,253,
+    0,128,128,0,36,254,235,0,169,246,20,0,186,254,235,0,18,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,
+    0,36,254,235,0,163,246,0,0,196,254,255,0,20,241,0,0,196,254,255,0,20,128,128,245,0,0,36,254,59,0,164,
+    254,196,0,15,245,0,0,157,254,255,0,59,253,0,128,128,249,0,0,45,254,98,0,134,254,157,0,36,253,0,249,0,
+    0,118,254,255,0,98,249,0,128,128,253,0,0,42,254,137,0,128,254,118,0,45,249,0,253,0,0,78,254,255,0,137,
+    245,0,128,128,0,27,254,177,0,146,254,78,0,42,245,0,0,39,254,255,0,177,241,0,128,128,0,39,254,255,0,243,
+    242,216,0,17,0,39,238,255,0,20,128,128,253,0,0,60,246,196,0,45,253,0,253,0,0,78,246,255,0,59,253,0,
+    128,128,0,36,254,235,0,169,246,20,0,186,254,235,0,18,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,0,
+    36,254,235,0,163,246,0,0,196,254,255,0,20,241,0,0,196,254,255,0,20,128,128,249,0,0,27,250,59,0,164,254,
+    196,0,15,249,0,0,118,250,255,0,59,253,0,128,128,249,0,0,72,250,157,0,112,254,98,0,8,241,0,0,196,254,
+    255,0,20,128,128,128,128,128,128,0,27,254,177,0,122,246,0,0,196,254,255,0,20,0,39,254,255,0,177,246,0,0,
+    196,254,255,0,20,128,128,0,6,254,39,0,94,246,216,0,80,254,39,0,3,253,0,0,78,246,255,0,59,253,0,128,
+    128,241,0,0,151,254,196,0,15,254,0,241,0,0,196,254,255,0,20,254,0,128,128,245,0,0,145,254,235,0,250,254,
+    255,0,20,254,0,245,0,0,157,250,255,0,20,254,0,128,249,0,0,9,254,20,0,152,254,235,0,250,254,255,0,20,
+    254,0,249,0,0,118,254,255,0,98,254,0,0,196,254,255,0,20,254,0,128,128,253,0,0,18,254,59,0,122,254,196,
+    0,75,254,0,0,196,254,255,0,20,254,0,253,0,0,78,254,255,0,137,250,0,0,196,254,255,0,20,254,0,128,128,
+    0,15,254,98,0,116,254,157,0,84,250,0,0,196,254,255,0,20,254,0,0,39,254,255,0,177,246,0,0,196,254,255,
+    0,20,254,0,128,128,0,39,254,255,0,219,246,137,0,228,254,255,3,146,137,137,127,0,39,235,255,0,235,128,128,0,
+    12,242,78,0,214,254,255,3,92,78,78,72,241,0,0,196,254,255,0,20,254,0,128,128,128,128,128,128,0,30,238,196,
+    0,15,0,39,238,255,0,20,128,128,0,39,254,255,0,183,242,20,0,2,0,39,254,255,0,177,241,0,128,128,128,128,
+    128,0,39,254,255,0,195,246,59,0,14,253,0,0,39,242,255,0,59,253,0,128,128,0,24,242,157,0,112,254,98,0,
+    8,241,0,0,196,254,255,0,20,128,128,128,128,128,128,0,27,254,177,0,122,246,0,0,196,254,255,0,20,0,39,254,
+    255,0,177,246,0,0,196,254,255,0,20,128,128,0,6,254,39,0,94,246,216,0,80,254,39,0,3,253,0,0,78,246,
+    255,0,59,253,0,128,128,249,0,0,91,250,196,0,45,253,0,249,0,0,118,250,255,0,59,253,0,128,128,253,0,0,
+    72,254,235,0,136,250,20,0,5,253,0,253,0,0,78,254,255,0,137,245,0,128,0,3,254,20,0,86,254,235,0,127,
+    245,0,0,39,254,255,0,177,241,0,128,128,0,39,254,255,0,195,246,59,0,14,253,0,0,39,242,255,0,59,253,0,
+    128,128,0,39,254,255,0,225,246,157,0,112,254,98,0,8,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,
+    128,128,128,128,128,128,128,128,0,6,254,39,0,94,246,216,0,80,254,39,0,3,253,0,0,78,246,255,0,59,253,0,
+    128,128,0,30,238,196,0,15,0,39,238,255,0,20,128,128,0,3,242,20,0,201,254,255,0,20,241,0,0,196,254,255,
+    0,20,128,245,0,0,12,254,20,0,186,254,235,0,18,245,0,0,157,254,255,0,59,253,0,128,128,128,128,128,128,249,
+    0,0,45,254,98,0,134,254,157,0,36,253,0,249,0,0,118,254,255,0,98,249,0,128,128,128,128,128,128,253,0,0,
+    54,254,177,0,131,254,78,0,30,249,0,253,0,0,78,254,255,0,137,245,0,128,128,128,128,128,128,253,0,0,60,246,
+    196,0,45,253,0,253,0,0,78,246,255,0,59,253,0,128,128,0,36,254,235,0,169,246,20,0,186,254,235,0,18,0,
+    39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,128,128,128,0,30,254,196,0,154,246,59,0,164,254,196,0,15,
+    253,0,0,78,246,255,0,59,253,0,128,128,0,15,254,98,0,116,246,157,0,112,254,98,0,8,0,39,254,255,0,177,
+    246,0,0,196,254,255,0,20,128,128,128,128,128,128,128,128,128,128,0,6,254,39,0,94,246,216,0,80,254,39,0,3,
+    253,0,0,78,246,255,0,59,253,0,128,128,253,0,0,60,246,196,0,45,253,0,253,0,0,78,246,255,0,59,253,0,
+    128,128,0,36,254,235,0,169,246,20,0,186,254,235,0,18,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,
+    128,128,128,128,128,128,128,0,24,254,157,0,139,246,98,0,219,254,255,0,20,253,0,0,78,242,255,0,20,128,128,253,
+    0,0,36,246,118,0,223,254,255,0,20,241,0,0,196,254,255,0,20,128,128,245,0,0,109,254,177,0,101,254,78,0,
+    6,245,0,0,157,254,255,0,59,253,0,128,128,253,0,0,66,250,216,0,107,254,39,0,9,253,0,253,0,0,78,250,
+    255,0,98,249,0,128,128,0,9,254,20,0,8,0,118,254,255,0,98,128,128,128,128,128,128,0,72,254,157,0,60,252,
+    0,128,128,128,128,128,128,0,81,254,177,0,68,0,118,254,255,0,98,128,128,128,128,128,128,253,0,0,6,254,20,0,
+    11,253,0,0,78,254,255,0,137,128,128,128,128,128,128,253,0,0,48,254,157,0,84,248,0,128,128,128,128,128,128,253,
+    0,0,54,254,177,0,95,253,0,0,78,254,255,0,137,128,128,128,128,128,128,128,128,128,0,6,254,39,0,94,254,216,
+    0,116,0,39,254,255,0,177,253,0,128,128,0,27,254,177,0,122,253,0,242,0,0,12,250,20,0,2,242,0,0,157,
+    250,255,0,20,128,128,250,0,0,18,250,59,0,143,250,196,0,15,250,0,0,78,250,255,0,98,249,0,128,128,250,98,
+    0,116,250,157,0,60,249,0,250,255,0,177,241,0,128,128,250,118,0,124,250,137,0,53,249,0,250,0,0,78,250,255,
+    0,98,249,0,128,128,250,0,0,24,250,78,0,139,250,177,0,14,242,0,0,157,250,255,0,20,128,128,242,0,0,24,
+    250,39,0,3,0,9,235,59,0,54,0,39,235,255,0,235,128,128,0,24,235,157,0,145,233,0,128,128,0,21,235,137,
+    0,127,0,39,235,255,0,235,128,128,0,12,235,78,0,72,0,3,250,20,0,11,242,0,0,39,250,255,0,137,242,0,
+    128,128,0,30,250,196,0,133,250,59,0,14,250,0,249,0,0,118,250,255,0,59,250,0,128,128,249,0,0,72,250,157,
+    0,112,251,98,0,91,241,0,0,196,251,255,0,235,128,128,249,0,0,63,250,137,0,122,251,118,0,109,249,0,0,118,
+    250,255,0,59,250,0,128,128,0,27,250,177,0,131,250,78,0,18,250,0,0,39,250,255,0,137,242,0,128,128,0,6,
+    250,39,0,21,242,0,253,0,0,60,246,196,0,45,253,0,253,0,0,78,246,255,0,59,253,0,128,128,0,36,254,235,
+    0,169,246,20,0,186,254,235,0,18,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,0,36,254,235,0,163,246,
+    0,0,196,254,255,0,20,241,0,0,196,254,255,0,20,128,128,245,0,0,36,254,59,0,164,254,196,0,15,245,0,0,
+    157,254,255,0,59,253,0,128,128,249,0,0,45,254,98,0,134,254,157,0,36,253,0,249,0,0,118,254,255,0,98,249,
+    0,128,128,128,128,128,128,249,0,0,36,254,78,0,30,249,0,236,0,128,128,249,0,0,100,254,216,0,83,249,0,249,
+    0,0,118,254,255,0,98,249,0,128,128,250,0,0,60,246,196,0,45,250,0,250,0,0,78,246,255,0,59,250,0,128,
+    128,254,0,0,36,254,235,0,169,246,20,0,186,254,235,0,18,254,0,254,0,0,39,254,255,0,177,246,0,0,196,254,
+    255,0,20,254,0,128,254,20,0,53,254,235,0,163,254,0,0,9,250,20,0,186,254,235,3,36,20,20,18,254,255,0,
+    216,250,0,0,118,250,255,0,59,254,0,3,235,255,255,235,128,128,254,255,0,216,254,0,0,18,254,59,0,122,254,196,
+    0,232,254,255,0,59,254,0,3,235,255,255,235,254,255,0,216,254,0,0,78,254,255,0,137,254,0,0,157,254,255,0,
+    59,254,0,3,235,255,255,235,128,128,128,128,128,128,254,255,0,216,254,0,0,36,254,118,0,127,254,137,0,210,254,255,
+    0,164,254,137,3,119,118,118,109,254,255,0,216,250,0,0,118,246,255,0,20,254,0,128,128,254,78,0,94,254,177,0,
+    122,254,0,0,36,246,78,0,6,254,0,254,0,0,39,254,255,0,177,238,0,128,128,254,0,0,6,254,39,0,94,242,
+    216,0,17,254,0,250,0,0,78,242,255,0,20,254,0,128,128,249,0,0,91,250,196,0,45,250,0,249,0,0,118,250,
+    255,0,59,250,0,128,128,128,128,128,253,0,0,6,254,20,0,119,250,235,0,69,254,20,0,2,254,0,253,0,0,78,
+    254,255,0,137,250,0,0,196,254,255,0,20,254,0,128,128,128,128,128,128,253,0,0,78,254,255,0,183,250,98,0,219,
+    254,255,0,20,254,0,253,0,0,78,242,255,0,20,254,0,128,128,0,21,254,137,0,131,242,118,3,136,137,137,127,0,
+    39,254,255,0,177,242,0,3,235,255,255,235,128,128,128,128,128,128,128,128,128,128,0,30,242,196,0,45,250,0,0,39,
+    242,255,0,59,250,0,128,128,0,39,254,255,0,183,246,20,0,186,254,235,0,18,254,0,0,39,254,255,0,177,246,0,
+    0,196,254,255,0,20,254,0,128,128,128,128,128,0,39,254,255,0,195,246,59,0,210,254,255,0,20,254,0,0,39,238,
+    255,0,20,254,0,128,128,0,39,254,255,0,225,242,157,3,103,98,98,91,0,39,254,255,0,177,242,0,3,235,255,255,
+    235,128,128,128,128,128,128,128,128,128,128,0,39,254,255,0,243,242,216,3,53,39,39,36,0,39,238,255,0,20,254,0,
+    128,128,249,0,0,91,246,196,0,15,254,0,249,0,0,118,246,255,0,20,254,0,128,128,253,0,0,72,254,235,0,136,
+    246,20,3,219,235,235,217,253,0,0,78,254,255,0,137,246,0,3,235,255,255,235,128,0,3,254,20,0,86,254,235,0,
+    127,246,0,3,217,235,235,217,0,39,254,255,0,177,238,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,12,
+    254,78,0,109,254,177,0,95,246,0,3,163,177,177,163,253,0,0,78,254,255,0,137,246,0,3,235,255,255,235,128,128,
+    253,0,0,12,254,39,0,121,246,216,3,53,39,39,36,249,0,0,118,246,255,0,20,254,0,128,128,0,30,238,196,0,
+    15,0,39,238,255,0,20,128,128,0,39,254,255,0,183,242,20,0,2,0,39,254,255,0,177,241,0,128,128,128,128,128,
+    0,39,254,255,0,195,246,59,0,14,253,0,0,39,242,255,0,59,253,0,128,128,0,39,254,255,0,225,246,157,0,36,
+    253,0,0,39,254,255,0,177,241,0,128,128,128,128,128,128,128,128,128,128,0,39,254,255,0,243,242,216,0,17,0,39,
+    238,255,0,20,128,128,0,30,238,196,0,15,0,39,238,255,0,20,128,128,0,39,254,255,0,183,242,20,0,2,0,39,
+    254,255,0,177,241,0,128,128,128,128,128,0,39,254,255,0,195,246,59,0,14,253,0,0,39,242,255,0,59,253,0,128,
+    128,0,39,254,255,0,225,246,157,0,36,253,0,0,39,254,255,0,177,241,0,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,249,0,0,91,246,196,0,15,254,0,249,0,0,118,246,255,0,20,254,0,128,128,253,0,0,72,254,235,0,
+    136,246,20,3,219,235,235,217,253,0,0,78,254,255,0,137,246,0,3,235,255,255,235,128,0,3,254,20,0,86,254,235,
+    0,127,246,0,3,217,235,235,217,0,39,254,255,0,177,238,0,128,128,128,128,128,128,0,39,254,255,0,177,250,0,0,
+    60,247,98,0,91,0,39,254,255,0,177,250,0,0,157,247,255,0,235,128,128,0,39,254,255,0,177,250,0,0,72,250,
+    118,3,244,255,255,235,0,39,254,255,0,177,242,0,3,235,255,255,235,128,128,0,12,254,78,0,109,254,177,0,95,246,
+    0,3,235,255,255,235,253,0,0,78,254,255,0,137,246,0,3,235,255,255,235,128,128,253,0,0,12,254,39,0,121,246,
+    216,3,53,39,39,36,249,0,0,118,246,255,0,20,254,0,128,128,0,30,254,196,0,136,242,0,3,181,196,196,181,0,
+    39,254,255,0,177,242,0,3,235,255,255,235,128,128,128,128,128,128,128,128,128,0,39,254,255,0,195,242,59,3,240,255,
+    255,235,0,39,235,255,0,235,128,128,0,39,254,255,0,225,242,157,3,247,255,255,235,0,39,254,255,0,177,242,0,3,
+    235,255,255,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,60,246,196,0,45,0,78,246,255,0,59,128,128,
+    0,6,254,20,0,128,254,255,0,110,254,20,0,5,253,0,0,118,254,255,0,98,253,0,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,0,66,254,216,0,234,254,255,0,231,254,216,0,50,0,78,246,255,0,
+    59,128,128,253,0,0,60,246,196,0,45,253,0,0,78,246,255,0,59,128,128,253,0,0,6,250,20,0,164,254,255,0,
+    59,245,0,0,157,254,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,33,
+    246,216,0,107,254,39,0,9,0,39,246,255,0,98,253,0,128,128,0,30,254,196,0,136,242,0,3,181,196,196,181,0,
+    39,254,255,0,177,242,0,3,235,255,255,235,128,128,0,39,254,255,0,177,246,0,0,181,254,235,3,36,20,20,18,0,
+    39,254,255,0,177,246,0,0,196,254,255,0,20,254,0,128,0,39,254,255,0,177,250,0,0,12,254,20,0,186,254,235,
+    0,18,254,0,0,39,254,255,0,177,250,0,0,157,254,255,0,59,250,0,128,128,0,39,254,255,0,177,254,0,0,27,
+    254,59,0,143,254,196,0,45,250,0,0,39,254,255,0,177,254,0,0,118,254,255,0,98,246,0,128,128,0,39,254,255,
+    0,207,254,98,0,171,254,255,0,98,246,0,0,39,246,255,0,98,246,0,128,128,0,39,254,255,0,213,250,118,0,130,
+    254,137,0,32,250,0,0,39,254,255,0,177,250,0,0,157,254,255,0,59,250,0,128,128,0,39,254,255,0,177,250,0,
+    0,48,254,78,0,154,254,177,0,14,254,0,0,39,254,255,0,177,246,0,0,196,254,255,0,20,254,0,128,128,0,39,
+    254,255,0,177,246,0,0,30,254,39,3,202,216,216,199,0,39,254,255,0,177,242,0,3,235,255,255,235,128,128,0,30,
+    254,196,0,136,241,0,0,39,254,255,0,177,241,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,0,39,254,255,0,243,242,216,0,17,0,39,238,255,0,20,128,128,250,196,0,136,246,0,0,
+    151,251,196,0,181,250,255,0,177,246,0,0,196,251,255,0,235,128,128,128,128,128,254,255,0,252,254,235,0,169,254,20,
+    0,11,254,0,0,12,254,20,0,186,254,235,3,253,255,255,235,254,255,0,216,254,0,0,78,254,255,0,137,254,0,0,
+    157,254,255,0,59,254,0,3,235,255,255,235,128,128,128,128,128,128,254,255,0,216,254,0,0,48,254,157,0,130,254,98,
+    0,134,254,157,0,36,254,0,3,235,255,255,235,254,255,0,216,250,0,0,118,254,255,0,98,250,0,3,235,255,255,235,
+    128,128,128,128,128,128,254,255,0,216,250,0,0,36,254,78,0,30,250,0,3,235,255,255,235,254,255,0,216,238,0,3,
+    235,255,255,235,128,128,128,128,128,128,0,30,250,196,0,106,246,0,3,181,196,196,181,0,39,250,255,0,137,246,0,3,
+    235,255,255,235,128,128,128,128,128,0,39,254,255,0,249,254,235,0,136,254,20,0,8,250,0,3,235,255,255,235,0,39,
+    254,255,0,177,254,0,0,118,254,255,0,98,250,0,3,235,255,255,235,128,128,128,128,128,128,0,39,254,255,0,177,254,
+    0,0,72,254,157,0,121,254,98,0,23,254,0,3,235,255,255,235,0,39,254,255,0,177,250,0,0,157,254,255,0,59,
+    254,0,3,235,255,255,235,128,128,128,128,128,128,0,39,254,255,0,177,250,0,0,48,254,78,0,154,254,177,3,249,255,
+    255,235,0,39,254,255,0,177,246,0,0,196,251,255,0,235,128,128,128,128,128,128,249,0,0,91,250,196,0,45,250,0,
+    249,0,0,118,250,255,0,59,250,0,128,128,253,0,0,72,254,235,0,136,250,20,0,186,254,235,0,18,254,0,253,0,
+    0,78,254,255,0,137,250,0,0,196,254,255,0,20,254,0,128,0,3,254,20,0,86,254,235,0,127,250,0,0,181,254,
+    235,3,36,20,20,18,0,39,254,255,0,177,242,0,3,235,255,255,235,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,0,12,254,78,0,109,254,177,0,95,250,0,0,136,254,177,3,86,78,78,72,253,0,0,78,254,255,0,137,250,0,
+    0,196,254,255,0,20,254,0,128,128,253,0,0,12,254,39,0,121,250,216,0,80,254,39,0,3,254,0,249,0,0,118,
+    250,255,0,59,250,0,128,128,0,30,242,196,0,45,253,0,0,39,242,255,0,59,253,0,128,128,0,39,254,255,0,183,
+    246,20,0,186,254,235,0,18,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,128,128,128,128,128,128,128,0,
+    39,254,255,0,207,246,98,0,143,254,157,0,12,0,39,242,255,0,59,253,0,128,128,0,39,254,255,0,213,246,118,0,
+    27,253,0,0,39,254,255,0,177,241,0,128,128,128,128,128,128,128,128,128,128,249,0,0,91,250,196,0,45,250,0,249,
+    0,0,118,250,255,0,59,250,0,128,128,253,0,0,72,254,235,0,136,250,20,0,186,254,235,0,18,254,0,253,0,0,
+    78,254,255,0,137,250,0,0,196,254,255,0,20,254,0,128,0,3,254,20,0,86,254,235,0,127,250,0,0,181,254,235,
+    3,36,20,20,18,0,39,254,255,0,177,242,0,3,235,255,255,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    0,12,254,78,0,109,254,177,0,95,250,0,0,136,254,177,3,86,78,78,72,253,0,0,78,254,255,0,137,250,0,0,
+    196,254,255,0,20,254,0,128,128,253,0,0,12,254,39,0,121,250,216,0,80,254,39,3,202,216,216,199,249,0,0,118,
+    250,255,0,59,254,0,3,235,255,255,235,128,128,237,0,3,235,255,255,235,128,128,237,0,3,199,216,216,199,0,30,242,
+    196,0,45,250,0,0,39,242,255,0,59,250,0,128,128,0,39,254,255,0,183,246,20,0,186,254,235,0,18,254,0,0,
+    39,254,255,0,177,246,0,0,196,254,255,0,20,254,0,128,128,128,128,128,128,128,128,128,0,39,254,255,0,207,246,98,
+    0,143,254,157,0,12,254,0,0,39,242,255,0,59,250,0,128,128,0,39,254,255,0,213,250,118,0,202,254,255,0,59,
+    250,0,0,39,254,255,0,177,250,0,0,157,254,255,0,59,250,0,128,128,0,39,254,255,0,177,250,0,0,48,254,78,
+    0,154,254,177,0,14,254,0,0,39,254,255,0,177,246,0,0,196,254,255,0,20,254,0,128,128,0,39,254,255,0,177,
+    246,0,0,30,254,39,3,202,216,216,199,0,39,254,255,0,177,242,0,3,235,255,255,235,128,128,253,0,0,60,242,196,
+    0,15,254,0,253,0,0,78,242,255,0,20,254,0,128,128,0,36,254,235,0,169,242,20,3,219,235,235,217,0,39,254,
+    255,0,177,242,0,3,235,255,255,235,128,0,39,254,255,0,177,242,0,3,217,235,235,217,0,39,254,255,0,177,238,0,
+    128,128,0,30,254,196,0,154,250,59,0,23,246,0,253,0,0,78,250,255,0,98,246,0,128,128,253,0,0,48,250,157,
+    0,121,250,98,0,8,254,0,245,0,0,157,250,255,0,20,254,0,128,128,245,0,0,72,250,118,3,136,137,137,127,237,
+    0,3,235,255,255,235,128,128,0,27,254,177,0,122,242,0,3,235,255,255,235,0,39,254,255,0,177,242,0,3,235,255,
+    255,235,128,128,0,6,254,39,0,94,242,216,3,53,39,39,36,253,0,0,78,242,255,0,20,254,0,128,128,231,196,0,
+    181,231,255,0,235,128,128,246,20,0,128,254,255,0,110,247,20,0,18,246,0,0,118,254,255,0,98,246,0,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,30,254,196,0,136,242,0,3,181,
+    196,196,181,0,39,254,255,0,177,242,0,3,235,255,255,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,0,6,254,39,0,94,242,216,3,53,39,39,36,253,0,0,78,242,255,0,20,254,0,
+    128,128,254,196,0,166,238,0,3,181,196,196,181,254,255,0,216,238,0,3,235,255,255,235,128,128,128,128,128,254,235,0,
+    202,254,20,0,14,246,0,0,15,254,20,3,219,235,235,217,254,0,0,39,254,255,0,177,246,0,0,196,254,255,0,20,
+    254,0,128,128,128,128,128,128,254,0,0,24,254,157,0,139,254,98,0,53,254,0,0,60,254,98,0,143,254,157,0,12,
+    254,0,250,0,0,78,254,255,0,137,254,0,0,157,254,255,0,59,250,0,128,128,128,128,128,128,250,0,0,24,254,78,
+    0,124,254,177,0,116,254,78,0,18,250,0,246,0,0,118,254,255,0,98,246,0,128,128,128,128,128,128,254,196,0,166,
+    238,0,3,181,196,196,181,254,255,0,216,238,0,3,235,255,255,235,128,128,254,255,0,216,250,0,0,109,254,235,0,91,
+    250,0,3,235,255,255,235,254,255,0,216,250,0,0,118,254,255,0,98,250,0,3,235,255,255,235,128,128,128,128,128,254,
+    255,0,216,254,0,0,18,254,59,0,122,254,196,0,112,254,59,0,14,254,0,3,235,255,255,235,254,255,0,216,254,0,
+    0,78,254,255,0,137,254,0,0,157,254,255,0,59,254,0,3,235,255,255,235,128,128,128,128,128,128,254,118,0,121,254,
+    137,0,174,254,255,0,137,254,0,0,157,254,255,0,164,254,137,3,119,118,118,109,254,0,0,39,250,255,0,137,254,0,
+    0,157,250,255,0,20,254,0,128,128,254,0,0,39,254,255,0,201,254,78,0,42,254,0,0,48,254,78,0,214,254,255,
+    0,20,254,0,254,0,0,39,254,255,0,177,246,0,0,196,254,255,0,20,254,0,128,128,128,128,128,128,0,30,254,196,
+    0,136,242,0,3,181,196,196,181,0,39,254,255,0,177,242,0,3,235,255,255,235,128,128,128,128,128,0,36,254,235,0,
+    169,254,20,0,11,250,0,0,15,254,20,3,219,235,235,217,253,0,0,78,254,255,0,137,250,0,0,196,254,255,0,20,
+    254,0,128,128,253,0,0,60,254,196,0,133,250,59,0,164,254,196,0,15,254,0,249,0,0,118,250,255,0,59,250,0,
+    128,128,128,128,128,128,253,0,0,42,254,137,0,128,250,118,0,133,254,137,0,11,254,0,253,0,0,78,254,255,0,137,
+    250,0,0,196,254,255,0,20,254,0,128,128,0,27,254,177,0,146,254,78,0,42,250,0,0,60,254,78,3,169,177,177,
+    163,0,39,254,255,0,177,242,0,3,235,255,255,235,128,128,128,128,128,128,254,196,0,166,238,0,3,181,196,196,181,254,
+    255,0,216,238,0,3,235,255,255,235,128,128,128,128,128,254,235,0,202,254,20,0,14,246,0,0,15,254,20,3,219,235,
+    235,217,254,0,0,39,254,255,0,177,246,0,0,196,254,255,0,20,254,0,128,128,254,0,0,30,254,196,0,154,254,59,
+    0,32,254,0,0,36,254,59,0,164,254,196,0,15,254,0,250,0,0,78,254,255,0,137,254,0,0,157,254,255,0,59,
+    250,0,128,128,250,0,0,48,254,157,0,130,254,98,0,134,254,157,0,36,250,0,246,0,0,118,254,255,0,98,246,0,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,30,235,196,0,181,0,39,235,255,0,235,128,128,0,3,238,20,
+    3,237,255,255,235,237,0,3,235,255,255,235,128,241,0,0,15,254,20,3,219,235,235,217,241,0,0,196,254,255,0,20,
+    254,0,128,128,245,0,0,36,254,59,0,164,254,196,0,15,254,0,245,0,0,157,254,255,0,59,250,0,128,128,249,0,
+    0,45,254,98,0,134,254,157,0,36,250,0,249,0,0,118,254,255,0,98,246,0,128,128,253,0,0,42,254,137,0,128,
+    254,118,0,45,246,0,253,0,0,78,254,255,0,137,242,0,128,128,0,27,254,177,0,146,254,78,0,42,242,0,0,39,
+    254,255,0,177,238,0,128,128,0,39,254,255,0,243,239,216,0,199,0,39,235,255,0,235,128,128,0,48,246,157,0,36,
+    0,78,246,255,0,59,128,128,0,78,254,255,0,164,250,59,0,14,0,78,254,255,0,137,249,0,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,78,254,255,0,155,
+    250,39,0,9,0,78,246,255,0,59,128,128,0,54,246,177,0,41,0,24,254,157,0,109,241,0,0,39,254,255,0,177,
+    241,0,128,128,128,128,128,128,0,3,254,20,0,86,254,235,0,127,245,0,253,0,0,78,254,255,0,137,245,0,128,128,
+    128,128,128,253,0,0,60,254,196,0,133,254,59,0,23,249,0,249,0,0,118,254,255,0,98,249,0,128,128,128,128,128,
+    128,249,0,0,54,254,118,0,130,254,137,0,32,253,0,245,0,0,157,254,255,0,59,253,0,128,128,128,128,128,128,245,
+    0,0,24,254,39,0,175,254,216,0,17,241,0,0,196,254,255,0,20,128,128,128,128,128,241,0,0,166,254,216,0,17,
+    0,48,246,157,0,36,0,78,246,255,0,59,128,128,0,18,250,59,0,180,254,255,0,59,249,0,0,157,254,255,0,59,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    0,12,250,39,0,172,254,255,0,59,0,78,246,255,0,59,128,128,0,54,246,177,0,41,249,0,0,72,254,157,0,60,
+    249,0,249,0,0,118,254,255,0,98,249,0,128,128,128,128,128,128,253,0,0,72,254,235,0,136,254,20,0,152,254,235,
+    0,54,253,0,253,0,0,78,254,255,0,137,254,0,0,157,254,255,0,59,253,0,128,128,128,128,128,0,9,254,59,0,
+    101,254,196,0,106,254,0,0,121,254,196,0,91,254,59,0,5,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,
+    128,128,128,128,128,0,18,254,118,0,81,246,0,0,91,254,118,0,9,231,255,0,235,128,128,231,216,0,199,0,48,254,
+    157,0,84,253,0,0,78,254,255,0,137,253,0,128,128,0,18,254,59,0,122,254,196,0,75,253,0,0,118,254,255,0,
+    98,128,128,253,0,0,9,254,20,0,8,253,0,0,6,246,20,0,5,253,0,253,0,0,78,246,255,0,59,253,0,128,
+    128,253,0,0,60,246,196,0,91,254,59,0,5,241,0,0,196,254,255,0,20,128,128,253,0,0,30,246,98,0,219,254,
+    255,0,20,253,0,0,78,242,255,0,20,128,128,0,21,254,137,0,131,246,118,0,223,254,255,0,20,0,39,254,255,0,
+    177,246,0,0,196,254,255,0,20,128,128,128,128,128,128,0,6,254,39,0,94,246,216,0,246,254,255,0,20,253,0,0,
+    78,242,255,0,20,128,128,253,0,0,6,246,20,0,5,253,0,253,0,0,78,246,255,0,59,253,0,128,128,0,9,254,
+    59,0,101,246,196,0,91,254,59,0,5,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,0,39,254,255,0,
+    177,246,0,0,121,254,157,0,12,0,39,254,255,0,177,241,0,128,128,128,128,128,128,0,39,254,255,0,177,246,0,0,
+    136,254,177,0,14,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,0,6,254,39,0,94,246,216,0,80,254,
+    39,0,3,253,0,0,78,246,255,0,59,253,0,128,128,241,0,0,121,254,157,0,12,241,0,0,196,254,255,0,20,128,
+    128,128,128,128,128,128,128,128,253,0,0,6,246,20,0,201,254,255,0,20,253,0,0,78,242,255,0,20,128,128,0,9,
+    254,59,0,101,246,196,0,241,254,255,0,20,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,6,254,39,0,94,246,216,0,246,254,255,0,20,253,0,0,78,242,255,0,20,128,128,
+    249,0,0,72,246,157,0,12,249,0,0,118,246,255,0,20,128,128,253,0,0,60,254,196,0,133,246,59,0,5,253,0,
+    0,78,254,255,0,137,245,0,128,128,128,128,128,0,3,254,20,0,92,254,255,0,146,250,20,0,5,253,0,0,39,242,
+    255,0,59,253,0,128,128,0,30,254,196,0,214,254,255,0,228,250,196,0,45,253,0,253,0,0,78,254,255,0,137,245,
+    0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,24,254,157,0,109,241,0,0,39,254,255,0,
+    177,241,0,128,128,128,128,128,128,128,128,128,0,39,254,255,0,183,246,20,0,5,253,0,0,39,242,255,0,59,253,0,
+    128,128,0,39,254,255,0,237,246,196,0,91,254,59,0,5,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,253,0,0,72,254,157,0,60,253,0,0,118,254,255,0,98,
+    128,128,253,0,0,27,254,59,0,23,248,0,128,128,128,128,128,0,6,250,20,0,8,0,78,250,255,0,98,128,128,0,
+    60,254,196,0,223,254,255,0,98,253,0,0,118,254,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,245,0,0,97,254,157,0,36,245,0,0,157,254,255,0,59,128,128,245,0,0,36,254,59,0,14,240,0,128,
+    128,128,128,128,249,0,0,9,250,20,0,5,249,0,0,118,250,255,0,59,128,128,249,0,0,91,254,196,0,232,254,255,
+    0,59,245,0,0,157,254,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,
+    6,246,39,0,148,254,216,0,50,0,39,246,255,0,98,253,0,128,128,0,27,246,177,0,68,253,0,0,24,254,157,0,
+    109,241,0,0,39,254,255,0,177,241,0,128,128,128,128,128,128,128,128,128,0,39,254,255,0,177,246,0,0,15,254,20,
+    0,2,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,0,39,254,255,0,177,250,0,0,36,254,59,0,164,
+    254,196,0,15,0,39,254,255,0,177,250,0,0,157,254,255,0,59,253,0,128,128,0,39,254,255,0,177,254,0,0,45,
+    254,98,0,134,254,157,0,36,253,0,0,39,254,255,0,177,254,0,0,118,254,255,0,98,249,0,128,128,0,39,254,255,
+    0,219,254,137,0,192,254,255,0,98,249,0,0,39,246,255,0,98,249,0,128,128,0,39,254,255,0,201,250,78,0,139,
+    254,177,0,41,253,0,0,39,254,255,0,177,250,0,0,157,254,255,0,59,253,0,128,128,0,39,254,255,0,177,250,0,
+    0,24,254,39,0,175,254,216,0,17,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,0,48,250,157,0,60,
+    0,78,250,255,0,98,128,128,0,18,254,59,0,149,254,255,0,98,253,0,0,118,254,255,0,98,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,246,20,0,11,254,0,0,12,250,
+    20,0,2,254,0,246,255,0,137,254,0,0,157,250,255,0,20,254,0,128,128,254,255,0,246,250,196,0,133,254,59,0,
+    143,250,196,3,69,59,59,54,254,255,0,216,250,0,0,118,254,255,0,98,250,0,3,235,255,255,235,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,0,3,242,20,0,5,253,0,0,39,242,255,0,59,253,0,128,128,0,
+    39,254,255,0,237,246,196,0,91,254,59,0,5,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,253,0,0,6,246,20,0,5,253,0,253,0,0,78,246,255,0,59,253,
+    0,128,128,0,9,254,59,0,101,246,196,0,91,254,59,0,5,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,0,6,254,39,0,94,246,216,0,80,254,39,0,3,253,0,0,78,246,
+    255,0,59,253,0,128,128,0,3,242,20,0,5,253,0,0,39,242,255,0,59,253,0,128,128,0,39,254,255,0,237,246,
+    196,0,91,254,59,0,5,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,0,39,254,255,0,243,246,216,0,80,254,39,0,3,0,39,242,255,0,59,253,0,128,128,0,39,254,255,0,
+    177,241,0,128,128,128,128,128,128,128,128,128,128,0,21,254,137,0,95,241,0,253,0,0,6,242,20,0,2,253,0,0,
+    78,242,255,0,20,128,128,0,9,254,59,0,101,246,196,0,241,254,255,0,20,0,39,254,255,0,177,246,0,0,196,254,
+    255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,6,254,39,0,94,246,216,0,246,254,255,0,20,253,
+    0,0,78,242,255,0,20,128,128,241,0,0,196,254,255,0,20,128,128,128,128,128,128,128,128,128,128,241,0,0,106,254,
+    137,0,11,0,3,254,20,0,14,254,0,0,9,250,20,0,5,253,0,0,39,254,255,0,177,254,0,0,118,250,255,0,
+    59,253,0,128,128,0,39,254,255,0,195,254,59,0,122,250,196,0,91,254,59,0,5,0,39,250,255,0,137,250,0,0,
+    196,254,255,0,20,128,128,0,39,254,255,0,225,254,157,0,84,250,0,0,121,254,157,0,12,0,39,254,255,0,177,241,
+    0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,253,0,0,6,242,20,0,2,253,0,0,78,242,255,0,20,128,
+    128,0,9,254,59,0,101,242,196,0,15,0,39,254,255,0,177,241,0,128,128,0,24,254,157,0,139,250,98,0,38,249,
+    0,253,0,0,78,250,255,0,98,249,0,128,128,253,0,0,36,250,118,0,130,254,137,0,32,253,0,245,0,0,157,254,
+    255,0,59,253,0,128,128,245,0,0,48,254,78,0,154,254,177,0,14,241,0,0,196,254,255,0,20,128,128,0,33,242,
+    216,0,80,254,39,0,3,0,39,242,255,0,59,253,0,128,128,0,60,254,196,0,106,245,0,0,78,254,255,0,137,245,
+    0,128,128,128,128,128,0,78,254,255,0,146,246,20,0,2,0,78,242,255,0,20,128,128,0,78,254,255,0,228,246,196,
+    0,15,0,78,254,255,0,137,245,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,12,254,39,0,121,246,216,
+    0,17,253,0,0,118,246,255,0,20,128,128,0,3,254,20,0,14,246,0,0,15,254,20,0,2,0,39,254,255,0,177,
+    246,0,0,196,254,255,0,20,128,128,128,128,128,128,0,24,254,157,0,139,254,98,0,53,254,0,0,60,254,98,0,143,
+    254,157,0,12,253,0,0,78,254,255,0,137,254,0,0,157,254,255,0,59,253,0,128,128,128,128,128,128,253,0,0,24,
+    254,78,0,124,254,177,0,116,254,78,0,18,253,0,249,0,0,118,254,255,0,98,249,0,128,128,128,128,128,128,254,20,
+    0,17,238,0,3,18,20,20,18,254,255,0,216,238,0,3,235,255,255,235,128,128,254,255,0,216,250,0,0,27,254,59,
+    0,23,250,0,3,235,255,255,235,254,255,0,216,250,0,0,118,254,255,0,98,250,0,3,235,255,255,235,128,128,128,128,
+    128,128,254,255,0,216,254,0,0,42,254,137,0,128,254,118,0,130,254,137,0,32,254,0,3,235,255,255,235,254,255,0,
+    216,254,0,0,78,254,255,0,137,254,0,0,157,254,255,0,59,254,0,3,235,255,255,235,128,128,254,78,0,94,254,177,
+    0,201,254,255,0,137,254,0,0,157,254,255,0,195,254,177,3,86,78,78,72,254,0,0,39,250,255,0,137,254,0,0,
+    157,250,255,0,20,254,0,128,128,254,0,0,39,254,255,0,189,254,39,0,21,254,0,0,24,254,39,0,205,254,255,0,
+    20,254,0,254,0,0,39,254,255,0,177,246,0,0,196,254,255,0,20,254,0,128,128,0,3,254,20,0,14,246,0,0,
+    15,254,20,0,2,0,39,254,255,0,177,246,0,0,196,254,255,0,20,128,128,0,30,254,196,0,154,254,59,0,32,254,
+    0,0,36,254,59,0,164,254,196,0,15,253,0,0,78,254,255,0,137,254,0,0,157,254,255,0,59,253,0,128,128,253,
+    0,0,48,254,157,0,130,254,98,0,134,254,157,0,36,253,0,249,0,0,118,254,255,0,98,249,0,128,128,128,128,128,
+    128,253,0,0,54,254,177,0,131,254,78,0,139,254,177,0,41,253,0,253,0,0,78,254,255,0,137,254,0,0,157,254,
+    255,0,59,253,0,128,128,0,33,254,216,0,161,254,39,0,21,254,0,0,24,254,39,0,175,254,216,0,17,0,39,254,
+    255,0,177,246,0,0,196,254,255,0,20,128,128,0,3,254,20,0,14,246,0,0,15,254,20,0,2,0,39,254,255,0,
+    177,246,0,0,196,254,255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,6,254,39,0,
+    94,246,216,0,246,254,255,0,20,253,0,0,78,242,255,0,20,128,128,241,0,0,196,254,255,0,20,128,128,128,128,128,
+    128,253,0,0,24,246,78,0,154,254,177,0,14,253,0,0,78,246,255,0,59,253,0,128,128,253,0,0,42,246,137,0,
+    32,253,0,0,3,238,20,0,2,0,39,238,255,0,20,128,128,0,30,242,196,0,241,254,255,0,20,241,0,0,196,254,
+    255,0,20,128,128,245,0,0,60,254,98,0,143,254,157,0,12,245,0,0,157,254,255,0,59,253,0,128,128,249,0,0,
+    63,254,137,0,125,254,118,0,27,253,0,249,0,0,118,254,255,0,98,249,0,128,128,253,0,0,54,254,177,0,131,254,
+    78,0,30,249,0,253,0,0,78,254,255,0,137,245,0,128,128,0,33,254,216,0,228,254,255,0,237,246,216,0,17,0,
+    39,238,255,0,20,128,128,245,0,0,97,250,157,0,12,245,0,0,157,250,255,0,20,128,128,249,0,0,91,254,196,0,
+    112,250,59,0,5,249,0,0,118,254,255,0,98,249,0,128,128,128,128,128,128,128,128,128,128,128,128,128,0,15,250,98,
+    0,125,254,157,0,60,249,0,0,39,250,255,0,137,245,0,128,128,0,18,250,118,0,127,254,137,0,53,249,0,249,0,
+    0,118,254,255,0,98,249,0,128,128,128,128,128,128,128,128,128,128,128,128,128,249,0,0,100,254,216,0,107,250,39,0,
+    3,245,0,0,157,250,255,0,20,128,128,245,0,0,109,250,177,0,14,0,72,254,157,0,60,0,118,254,255,0,98,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,0,81,254,177,0,68,0,24,250,157,0,84,245,0,0,39,250,255,0,137,245,0,128,128,0,
+    9,250,59,0,122,254,196,0,75,249,0,249,0,0,118,254,255,0,98,249,0,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,249,0,0,72,254,157,0,121,250,98,0,8,245,0,0,157,250,255,0,20,128,128,249,0,0,63,254,137,0,125,
+    250,118,0,9,249,0,0,118,254,255,0,98,249,0,128,128,128,128,128,128,128,128,128,128,128,128,128,0,6,250,39,0,
+    121,254,216,0,83,249,0,0,39,250,255,0,137,245,0,128,128,0,27,250,177,0,95,245,0,254,0,0,9,246,59,0,
+    23,250,0,3,54,59,59,54,254,0,0,39,246,255,0,98,250,0,3,235,255,255,235,128,128,254,98,0,107,250,157,0,
+    202,254,255,0,158,250,98,3,152,157,157,145,254,255,0,216,250,0,0,118,246,255,0,20,254,0,128,128,254,118,0,100,
+    250,0,0,54,246,118,0,9,254,0,0,50,242,59,0,45,248,0,0,216,242,255,0,196,248,0,128,128,0,216,254,255,
+    0,241,246,235,0,186,254,20,0,18,252,0,0,216,254,255,0,78,246,0,0,59,254,255,0,235,252,0,128,128,128,0,
+    216,254,255,0,78,246,0,0,5,254,20,0,36,253,235,0,18,0,216,254,255,0,78,242,0,0,20,253,255,0,20,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,0,216,254,255,0,78,246,0,0,18,254,78,0,86,253,177,0,14,0,
+    216,254,255,0,78,246,0,0,59,254,255,0,235,252,0,128,128,0,216,254,255,0,106,246,39,0,80,254,216,0,199,252,
+    0,0,216,242,255,0,196,248,0,128,128,128,253,0,0,163,246,235,0,181,253,0,253,0,0,177,246,255,0,196,253,0,
+    128,128,0,166,254,196,0,101,246,59,0,91,254,196,0,181,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,
+    0,216,254,255,0,187,246,157,0,180,254,255,0,235,0,216,238,255,0,235,128,128,0,216,254,255,0,174,242,137,0,127,
+    0,216,254,255,0,78,241,0,128,128,0,216,254,255,0,78,246,0,0,18,254,78,0,72,0,216,254,255,0,78,246,0,
+    0,59,254,255,0,235,128,128,0,183,254,216,0,94,246,39,0,80,254,216,0,199,253,0,0,177,246,255,0,196,253,0,
+    128,128,128,0,83,254,98,0,30,241,0,0,216,254,255,0,78,241,0,128,128,128,128,128,128,128,128,128,128,128,0,216,
+    254,255,0,241,246,235,0,181,253,0,0,216,242,255,0,196,253,0,128,128,0,216,254,255,0,119,246,59,0,91,254,196,
+    0,181,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,216,
+    254,255,0,106,246,39,0,80,254,216,0,199,0,216,242,255,0,196,253,0,128,128,128,0,199,254,235,0,72,246,0,0,
+    54,254,235,0,217,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,0,183,254,216,0,94,246,39,0,89,254,255,0,235,253,0,0,177,242,255,0,235,128,128,128,253,0,
+    0,163,242,235,0,217,253,0,0,177,242,255,0,235,128,128,0,166,254,196,0,101,246,59,0,104,254,255,0,235,0,216,
+    254,255,0,78,246,0,0,59,254,255,0,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,183,254,216,0,94,
+    246,39,0,89,254,255,0,235,253,0,0,177,242,255,0,235,128,128,128,241,0,0,59,254,255,0,235,128,128,128,128,128,
+    128,128,253,0,0,122,246,177,0,154,254,78,0,72,253,0,0,177,246,255,0,196,253,0,128,128,253,0,0,81,246,118,
+    0,91,253,0,0,32,254,59,0,36,0,137,254,255,0,157,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,0,95,254,177,0,109,252,0,128,128,0,21,254,39,0,24,0,137,254,255,0,157,128,128,128,
+    0,68,254,98,0,45,254,0,0,38,254,98,0,75,0,177,254,255,0,118,254,0,0,98,254,255,0,196,128,128,128,128,
+    128,128,128,128,128,128,128,0,14,254,20,0,9,254,0,0,8,254,20,0,15,245,0,0,32,254,59,0,36,254,0,0,
+    14,254,59,0,54,252,0,245,0,0,137,254,255,0,157,254,0,0,59,254,255,0,235,252,0,128,128,128,128,128,128,128,
+    253,0,0,199,250,235,0,246,254,255,0,247,254,235,0,240,254,255,0,253,253,235,0,18,253,0,0,216,233,255,0,20,
+    128,128,253,0,0,50,254,59,0,195,254,255,0,149,254,59,0,134,254,255,0,210,249,59,0,5,249,0,0,177,254,255,
+    0,118,254,0,0,98,254,255,0,196,248,0,128,128,128,128,128,128,249,118,0,213,254,255,0,181,254,118,0,171,254,255,
+    0,223,254,118,0,109,252,0,233,255,0,235,252,0,128,128,253,177,0,243,254,255,0,201,254,177,0,219,254,255,0,225,
+    250,177,0,163,252,0,253,0,0,216,254,255,0,78,254,0,0,137,254,255,0,157,244,0,128,128,128,128,128,128,128,249,
+    0,0,32,254,59,0,36,249,0,249,0,0,137,254,255,0,157,249,0,128,128,253,0,0,14,254,20,0,146,254,255,0,
+    164,250,20,0,18,253,0,0,177,242,255,0,235,128,128,128,0,199,254,235,0,86,254,20,0,146,254,255,0,164,250,20,
+    0,18,0,216,254,255,0,78,254,0,0,137,254,255,0,157,249,0,128,128,128,128,128,128,0,83,254,98,0,139,254,157,
+    0,210,254,255,0,217,254,157,0,121,253,0,253,0,0,177,246,255,0,196,253,0,128,128,253,0,0,95,254,137,0,201,
+    254,255,0,210,254,137,0,133,254,118,0,109,249,0,0,137,254,255,0,157,254,0,0,59,254,255,0,235,128,128,128,128,
+    128,128,0,33,250,39,0,155,254,255,0,172,254,39,0,80,254,216,0,199,0,216,242,255,0,196,253,0,128,128,128,249,
+    0,0,137,254,255,0,157,249,0,128,128,128,249,0,0,21,254,39,0,24,249,0,253,0,0,50,254,59,0,18,246,0,
+    0,14,254,59,0,54,252,0,253,0,0,216,254,255,0,78,246,0,0,59,254,255,0,235,252,0,128,128,253,20,0,202,
+    254,235,0,86,254,20,0,9,254,0,0,8,254,20,0,69,254,235,0,217,252,0,253,255,0,39,254,0,0,177,254,255,
+    0,118,254,0,0,98,254,255,0,196,248,0,128,128,128,128,128,128,128,253,59,0,175,254,196,0,101,254,59,0,133,254,
+    196,0,143,254,59,0,45,248,0,253,0,0,216,254,255,0,78,254,0,0,137,254,255,0,157,244,0,128,128,253,0,0,
+    83,254,98,0,30,254,0,0,137,254,255,0,157,254,0,0,36,254,157,0,145,252,0,245,0,0,137,254,255,0,157,254,
+    0,0,59,254,255,0,235,252,0,128,128,249,0,0,81,254,118,0,128,254,137,0,130,254,118,0,122,254,137,0,136,253,
+    118,0,9,249,0,0,177,254,255,0,118,254,0,0,98,254,255,0,196,254,0,0,20,253,255,0,20,128,128,128,128,128,
+    128,253,0,0,33,254,39,0,161,254,216,0,100,254,0,0,83,254,216,0,175,254,39,0,53,253,216,0,17,253,0,0,
+    216,254,255,0,78,246,0,0,59,254,255,0,235,252,0,128,128,128,253,0,0,41,250,59,0,36,244,0,253,0,0,177,
+    250,255,0,157,244,0,128,128,0,17,254,20,0,169,250,235,0,152,254,20,0,15,248,0,0,216,254,255,0,78,250,0,
+    0,98,254,255,0,196,248,0,128,128,128,128,128,128,128,0,50,254,59,0,154,250,196,0,143,254,59,0,45,254,0,0,
+    15,253,196,0,15,253,0,0,177,250,255,0,157,250,0,0,20,253,255,0,20,128,128,0,133,254,157,0,116,250,98,0,
+    121,254,157,0,121,254,0,0,20,253,255,0,20,0,216,254,255,0,78,250,0,0,98,254,255,0,196,254,0,0,20,253,
+    255,0,20,128,128,0,216,254,255,0,78,250,0,0,53,254,137,0,133,254,118,0,119,253,137,0,11,0,216,254,255,0,
+    78,246,0,0,59,254,255,0,235,252,0,128,128,128,128,128,128,0,183,254,216,0,94,246,39,0,80,254,216,0,202,253,
+    39,0,3,253,0,0,177,246,255,0,196,254,0,0,20,253,255,0,20,128,128,128,0,53,254,98,0,60,0,137,254,255,
+    0,157,128,128,128,128,128,128,128,128,128,128,128,0,11,254,20,0,12,249,0,0,38,254,98,0,75,249,0,0,98,254,
+    255,0,196,128,128,253,0,0,32,254,59,0,112,254,196,0,151,253,0,0,137,254,255,0,157,253,0,128,128,128,128,128,
+    128,128,0,163,254,235,0,119,254,20,0,12,253,0,0,177,254,255,0,118,249,0,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,149,254,216,0,121,254,39,0,24,253,0,253,0,0,137,254,255,0,157,253,0,128,128,
+    128,128,128,128,128,253,0,0,21,254,39,0,107,254,216,0,166,249,0,0,98,254,255,0,196,128,128,249,0,0,30,254,
+    78,0,60,0,68,254,98,0,45,249,0,0,177,254,255,0,118,249,0,128,128,0,136,254,196,0,122,254,59,0,36,253,
+    0,253,0,0,137,254,255,0,157,253,0,128,128,128,128,128,128,128,253,0,0,11,254,20,0,103,254,235,0,181,249,0,
+    0,98,254,255,0,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,253,0,0,21,254,39,0,107,
+    254,216,0,166,253,0,0,137,254,255,0,157,253,0,128,128,128,128,128,128,128,0,149,254,216,0,121,254,39,0,24,253,
+    0,0,177,254,255,0,118,249,0,128,128,0,54,254,78,0,36,249,0,249,0,0,127,254,235,0,145,249,0,249,0,0,
+    137,254,255,0,157,249,0,128,128,0,166,254,196,0,60,254,0,0,137,254,255,0,157,254,0,0,45,254,196,0,181,0,
+    216,254,255,0,78,254,0,0,137,254,255,0,157,254,0,0,59,254,255,0,235,128,128,0,83,254,98,0,139,254,157,0,
+    210,254,255,0,217,254,157,0,143,254,98,0,91,253,0,0,177,246,255,0,196,253,0,128,128,0,100,254,118,0,131,254,
+    137,0,201,254,255,0,210,254,137,0,133,254,118,0,109,0,216,254,255,0,78,254,0,0,137,254,255,0,157,254,0,0,
+    59,254,255,0,235,128,128,0,149,254,177,0,54,254,0,0,137,254,255,0,157,254,0,0,41,254,177,0,163,249,0,0,
+    137,254,255,0,157,249,0,128,128,249,0,0,116,254,216,0,133,249,0,249,0,0,127,254,235,0,145,249,0,249,0,0,
+    137,254,255,0,157,249,0,128,128,128,128,128,128,0,133,250,157,0,210,254,255,0,217,250,157,0,145,0,216,238,255,0,
+    235,128,128,0,116,250,137,0,201,254,255,0,210,250,137,0,127,249,0,0,137,254,255,0,157,249,0,128,128,128,128,128,
+    128,249,0,0,116,254,216,0,133,249,0,253,0,0,54,254,78,0,36,253,0,0,177,254,255,0,118,128,128,128,128,128,
+    128,128,128,128,128,128,0,183,254,216,0,94,254,39,0,18,0,216,254,255,0,78,253,0,128,128,0,66,254,78,0,24,
+    253,0,0,133,238,157,0,145,0,216,238,255,0,235,128,128,0,116,238,137,0,127,0,54,254,78,0,36,0,177,254,255,
+    0,118,128,128,128,128,128,128,128,241,0,0,23,254,98,0,91,241,0,0,59,254,255,0,235,128,128,128,128,128,128,245,
+    0,0,8,254,20,0,69,254,235,0,217,245,0,0,98,254,255,0,196,253,0,128,128,128,128,128,128,128,249,0,0,106,
+    254,196,0,143,254,59,0,45,253,0,249,0,0,137,254,255,0,157,249,0,128,128,128,128,128,128,253,0,0,81,254,118,
+    0,128,254,137,0,84,249,0,253,0,0,177,254,255,0,118,245,0,128,128,128,128,128,128,0,33,254,39,0,161,254,216,
+    0,100,245,0,0,216,254,255,0,78,241,0,128,128,128,128,128,128,128,0,33,254,39,0,12,241,0,253,0,0,41,246,
+    59,0,45,253,0,253,0,0,177,246,255,0,196,253,0,128,128,0,17,254,20,0,169,246,235,0,186,254,20,0,18,0,
+    216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,128,128,128,128,128,0,216,254,255,0,78,254,0,0,106,254,196,
+    0,121,254,0,0,59,254,255,0,235,0,216,254,255,0,78,254,0,0,137,254,255,0,157,254,0,0,59,254,255,0,235,
+    128,128,128,128,128,128,0,216,254,255,0,78,254,0,0,74,254,137,0,84,254,0,0,59,254,255,0,235,0,216,254,255,
+    0,78,246,0,0,59,254,255,0,235,128,128,128,128,128,128,0,183,254,216,0,94,246,39,0,80,254,216,0,199,253,0,
+    0,177,246,255,0,196,253,0,128,128,128,249,0,0,32,254,59,0,36,249,0,249,0,0,137,254,255,0,157,249,0,128,
+    128,253,0,0,14,254,20,0,146,254,255,0,157,249,0,253,0,0,177,250,255,0,157,249,0,128,128,128,0,199,254,235,
+    0,86,254,20,0,146,254,255,0,157,249,0,0,216,254,255,0,78,254,0,0,137,254,255,0,157,249,0,128,128,0,50,
+    254,59,0,18,254,0,0,137,254,255,0,157,249,0,249,0,0,137,254,255,0,157,249,0,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,0,33,250,39,0,155,254,255,0,172,250,39,0,36,0,216,238,255,0,235,128,128,128,253,0,0,
+    41,246,59,0,45,253,0,253,0,0,177,246,255,0,196,253,0,128,128,0,17,254,20,0,169,246,235,0,186,254,20,0,
+    18,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,128,0,17,254,20,0,6,246,0,0,59,254,255,0,235,
+    241,0,0,59,254,255,0,235,128,128,245,0,0,75,254,196,0,164,254,59,0,54,245,0,0,98,254,255,0,196,253,0,
+    128,128,249,0,0,84,254,157,0,134,254,98,0,75,253,0,249,0,0,137,254,255,0,157,249,0,128,128,253,0,0,81,
+    254,118,0,128,254,137,0,84,249,0,253,0,0,177,254,255,0,118,245,0,128,128,0,66,254,78,0,146,254,177,0,81,
+    245,0,0,216,254,255,0,78,241,0,128,128,0,216,254,255,0,106,242,39,0,36,0,216,238,255,0,235,128,128,128,253,
+    0,0,41,246,59,0,45,253,0,253,0,0,177,246,255,0,196,253,0,128,128,0,17,254,20,0,169,246,235,0,186,254,
+    20,0,18,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,128,0,17,254,20,0,6,246,0,0,59,254,255,
+    0,235,241,0,0,59,254,255,0,235,128,128,249,0,0,106,250,196,0,164,254,59,0,54,249,0,0,137,250,255,0,196,
+    253,0,128,128,249,0,0,53,250,98,0,112,254,157,0,145,241,0,0,59,254,255,0,235,128,128,128,128,128,128,0,66,
+    254,78,0,24,246,0,0,59,254,255,0,235,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,0,183,254,216,
+    0,94,246,39,0,80,254,216,0,199,253,0,0,177,246,255,0,196,253,0,128,128,128,241,0,0,14,254,59,0,54,252,
+    0,241,0,0,59,254,255,0,235,252,0,128,128,245,0,0,8,254,20,0,74,254,255,0,235,252,0,245,0,0,98,250,
+    255,0,235,252,0,128,128,128,249,0,0,127,254,235,0,152,254,20,0,74,254,255,0,235,252,0,249,0,0,137,254,255,
+    0,157,254,0,0,59,254,255,0,235,252,0,128,128,253,0,0,136,254,196,0,122,254,59,0,36,254,0,0,59,254,255,
+    0,235,252,0,253,0,0,177,254,255,0,118,250,0,0,59,254,255,0,235,252,0,128,128,0,133,254,157,0,116,254,98,
+    0,45,250,0,0,59,254,255,0,235,252,0,0,216,254,255,0,78,246,0,0,59,254,255,0,235,252,0,128,128,0,216,
+    254,255,0,160,246,118,0,149,254,255,0,244,253,118,0,9,0,216,233,255,0,20,128,128,0,149,242,177,0,195,254,255,
+    0,249,253,177,0,14,241,0,0,59,254,255,0,235,252,0,128,128,128,128,128,128,128,0,50,238,59,0,54,0,216,238,
+    255,0,235,128,128,0,216,254,255,0,241,242,235,0,217,0,216,254,255,0,78,241,0,128,128,128,128,128,128,128,0,216,
+    254,255,0,214,246,196,0,151,253,0,0,216,242,255,0,196,253,0,128,128,0,83,242,98,0,112,254,157,0,145,241,0,
+    0,59,254,255,0,235,128,128,128,128,128,128,0,66,254,78,0,24,246,0,0,59,254,255,0,235,0,216,254,255,0,78,
+    246,0,0,59,254,255,0,235,128,128,0,183,254,216,0,94,246,39,0,80,254,216,0,199,253,0,0,177,246,255,0,196,
+    253,0,128,128,128,249,0,0,32,250,59,0,45,253,0,249,0,0,137,250,255,0,196,253,0,128,128,253,0,0,14,254,
+    20,0,136,250,235,0,181,253,0,253,0,0,177,254,255,0,118,245,0,128,128,128,0,199,254,235,0,86,254,20,0,9,
+    245,0,0,216,254,255,0,78,241,0,128,128,0,216,254,255,0,214,246,196,0,151,253,0,0,216,242,255,0,196,253,0,
+    128,128,0,216,254,255,0,146,246,98,0,112,254,157,0,145,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,
+    128,128,128,128,128,128,128,128,0,183,254,216,0,94,246,39,0,80,254,216,0,199,253,0,0,177,246,255,0,196,253,0,
+    128,128,128,0,50,238,59,0,54,0,216,238,255,0,235,128,128,0,199,242,235,0,240,254,255,0,235,241,0,0,59,254,
+    255,0,235,128,128,128,245,0,0,91,254,235,0,186,254,20,0,18,245,0,0,98,254,255,0,196,253,0,128,128,128,128,
+    128,128,249,0,0,84,254,157,0,134,254,98,0,75,253,0,249,0,0,137,254,255,0,157,249,0,128,128,128,128,128,128,
+    253,0,0,54,254,78,0,131,254,177,0,109,249,0,253,0,0,177,254,255,0,118,245,0,128,128,128,128,128,128,128,253,
+    0,0,41,246,59,0,45,253,0,253,0,0,177,246,255,0,196,253,0,128,128,0,17,254,20,0,169,246,235,0,186,254,
+    20,0,18,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,128,128,128,128,128,0,50,254,59,0,154,246,196,
+    0,164,254,59,0,54,253,0,0,177,246,255,0,196,253,0,128,128,0,133,254,157,0,116,246,98,0,112,254,157,0,145,
+    0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,128,128,128,128,128,128,128,128,0,183,254,216,0,94,246,39,
+    0,80,254,216,0,199,253,0,0,177,246,255,0,196,253,0,128,128,128,253,0,0,41,246,59,0,45,253,0,253,0,0,
+    177,246,255,0,196,253,0,128,128,0,17,254,20,0,169,246,235,0,186,254,20,0,18,0,216,254,255,0,78,246,0,0,
+    59,254,255,0,235,128,128,128,128,128,128,128,128,128,128,128,0,83,254,98,0,139,246,157,0,180,254,255,0,235,253,0,
+    0,177,242,255,0,235,128,128,253,0,0,95,246,137,0,164,254,255,0,235,241,0,0,59,254,255,0,235,128,128,245,0,
+    0,30,254,78,0,101,254,177,0,163,245,0,0,98,254,255,0,196,253,0,128,128,253,0,0,27,250,39,0,107,254,216,
+    0,166,253,0,253,0,0,177,250,255,0,157,249,0,128,128,128,0,127,254,235,0,145,0,137,254,255,0,157,128,128,128,
+    128,128,128,0,53,254,98,0,60,252,0,128,128,128,128,128,128,0,42,254,78,0,48,0,137,254,255,0,157,128,128,128,
+    128,128,128,128,253,0,0,163,254,235,0,109,253,0,0,177,254,255,0,118,128,128,128,128,128,128,253,0,0,68,254,98,
+    0,45,248,0,128,128,128,128,128,128,253,0,0,54,254,78,0,36,253,0,0,177,254,255,0,118,128,128,128,128,128,128,
+    128,128,128,128,128,0,183,254,216,0,94,254,39,0,18,0,216,254,255,0,78,253,0,128,128,0,66,254,78,0,24,253,
+    0,241,0,0,91,250,235,0,217,241,0,0,98,250,255,0,235,128,128,249,0,0,136,250,196,0,143,250,59,0,54,249,
+    0,0,177,250,255,0,157,249,0,128,128,249,157,0,116,250,98,0,60,249,0,249,255,0,78,241,0,128,128,249,137,0,
+    124,250,118,0,72,249,0,249,0,0,177,250,255,0,157,249,0,128,128,249,0,0,122,250,177,0,139,250,78,0,72,241,
+    0,0,98,250,255,0,235,128,128,241,0,0,83,250,216,0,199,0,166,233,196,0,15,0,216,233,255,0,20,128,128,0,
+    83,233,98,0,8,231,0,128,128,0,100,233,118,0,9,0,216,233,255,0,20,128,128,0,149,233,177,0,14,0,199,250,
+    235,0,109,240,0,0,216,250,255,0,118,240,0,128,128,0,50,250,59,0,133,250,196,0,151,248,0,249,0,0,137,250,
+    255,0,196,248,0,128,128,249,0,0,53,250,98,0,112,249,157,0,12,241,0,0,59,249,255,0,20,128,128,249,0,0,
+    63,250,118,0,122,249,137,0,11,249,0,0,137,250,255,0,196,248,0,128,128,0,66,250,78,0,131,250,177,0,136,248,
+    0,0,216,250,255,0,118,240,0,128,128,0,183,250,216,0,100,240,0,253,0,0,41,246,59,0,45,253,0,253,0,0,
+    177,246,255,0,196,253,0,128,128,0,17,254,20,0,169,246,235,0,186,254,20,0,18,0,216,254,255,0,78,246,0,0,
+    59,254,255,0,235,128,128,128,0,17,254,20,0,6,246,0,0,59,254,255,0,235,241,0,0,59,254,255,0,235,128,128,
+    245,0,0,75,254,196,0,164,254,59,0,54,245,0,0,98,254,255,0,196,253,0,128,128,249,0,0,84,254,157,0,134,
+    254,98,0,75,253,0,249,0,0,137,254,255,0,157,249,0,128,128,128,128,128,128,249,0,0,95,254,177,0,109,249,0,
+    236,0,128,128,249,0,0,21,254,39,0,24,249,0,249,0,0,137,254,255,0,157,249,0,128,128,128,249,0,0,41,246,
+    59,0,45,248,0,249,0,0,177,246,255,0,196,248,0,128,128,253,0,0,17,254,20,0,169,246,235,0,186,254,20,0,
+    18,252,0,253,0,0,216,254,255,0,78,246,0,0,59,254,255,0,235,252,0,128,128,128,253,235,0,53,254,20,0,6,
+    254,0,0,127,250,235,0,186,254,20,0,36,253,235,0,18,253,255,0,39,250,0,0,137,250,255,0,196,254,0,0,20,
+    253,255,0,20,128,128,253,255,0,39,254,0,0,136,254,196,0,122,254,59,0,134,254,255,0,196,254,0,0,20,253,255,
+    0,20,253,255,0,39,254,0,0,177,254,255,0,118,254,0,0,98,254,255,0,196,254,0,0,20,253,255,0,20,128,128,
+    128,128,128,128,253,255,0,39,254,0,0,95,254,137,0,127,254,118,0,171,254,255,0,223,254,118,0,119,253,137,0,11,
+    253,255,0,39,250,0,0,137,246,255,0,235,252,0,128,128,253,177,0,94,254,78,0,24,254,0,0,95,246,177,0,163,
+    252,0,253,0,0,216,254,255,0,78,236,0,128,128,253,0,0,183,254,216,0,94,242,39,0,36,252,0,249,0,0,177,
+    242,255,0,235,252,0,128,128,128,249,0,0,32,250,59,0,45,248,0,249,0,0,137,250,255,0,196,248,0,128,128,128,
+    128,128,128,128,253,0,0,163,254,235,0,119,250,20,0,69,254,235,0,217,252,0,253,0,0,177,254,255,0,118,250,0,
+    0,59,254,255,0,235,252,0,128,128,128,128,128,128,253,0,0,177,254,255,0,202,250,157,0,180,254,255,0,235,252,0,
+    253,0,0,177,242,255,0,235,252,0,128,128,0,100,254,118,0,131,242,137,0,136,253,118,0,9,0,216,254,255,0,78,
+    242,0,0,20,253,255,0,20,128,128,128,128,128,128,128,128,128,128,128,0,50,242,59,0,45,248,0,0,216,242,255,0,
+    196,248,0,128,128,0,216,254,255,0,241,246,235,0,186,254,20,0,18,252,0,0,216,254,255,0,78,246,0,0,59,254,
+    255,0,235,252,0,128,128,128,128,128,128,128,0,216,254,255,0,214,246,196,0,210,254,255,0,235,252,0,0,216,238,255,
+    0,235,252,0,128,128,0,216,254,255,0,146,242,98,0,103,253,157,0,12,0,216,254,255,0,78,242,0,0,20,253,255,
+    0,20,128,128,128,128,128,128,128,128,128,128,0,216,254,255,0,106,242,39,0,53,253,216,0,17,0,216,238,255,0,235,
+    252,0,128,128,128,249,0,0,32,246,59,0,54,252,0,249,0,0,137,246,255,0,235,252,0,128,128,253,0,0,14,254,
+    20,0,136,246,235,0,219,253,20,0,2,253,0,0,177,254,255,0,118,246,0,0,20,253,255,0,20,128,128,128,0,199,
+    254,235,0,86,254,20,0,9,246,0,0,2,253,20,0,2,0,216,254,255,0,78,236,0,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,0,149,254,177,0,109,254,78,0,36,246,0,0,6,253,78,0,6,253,0,0,177,254,255,0,118,
+    246,0,0,20,253,255,0,20,128,128,253,0,0,149,254,216,0,121,246,39,0,53,253,216,0,17,249,0,0,137,246,255,
+    0,235,252,0,128,128,128,0,50,238,59,0,54,0,216,238,255,0,235,128,128,0,216,254,255,0,241,242,235,0,217,0,
+    216,254,255,0,78,241,0,128,128,128,128,128,128,128,0,216,254,255,0,214,246,196,0,151,253,0,0,216,242,255,0,196,
+    253,0,128,128,0,216,254,255,0,146,246,98,0,75,253,0,0,216,254,255,0,78,241,0,128,128,128,128,128,128,128,128,
+    128,128,0,216,254,255,0,106,242,39,0,36,0,216,238,255,0,235,128,128,128,0,50,238,59,0,54,0,216,238,255,0,
+    235,128,128,0,216,254,255,0,241,242,235,0,217,0,216,254,255,0,78,241,0,128,128,128,128,128,128,128,0,216,254,255,
+    0,214,246,196,0,151,253,0,0,216,242,255,0,196,253,0,128,128,0,216,254,255,0,146,246,98,0,75,253,0,0,216,
+    254,255,0,78,241,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,249,0,0,32,246,59,0,54,252,0,249,
+    0,0,137,246,255,0,235,252,0,128,128,253,0,0,14,254,20,0,136,246,235,0,219,253,20,0,2,253,0,0,177,254,
+    255,0,118,246,0,0,20,253,255,0,20,128,128,128,0,199,254,235,0,86,254,20,0,9,246,0,0,2,253,20,0,2,
+    0,216,254,255,0,78,236,0,128,128,128,128,128,128,0,216,254,255,0,78,250,0,0,60,245,157,0,12,0,216,254,255,
+    0,78,250,0,0,98,245,255,0,20,128,128,0,216,254,255,0,78,250,0,0,53,250,137,0,146,253,255,0,20,0,216,
+    254,255,0,78,242,0,0,20,253,255,0,20,128,128,0,149,254,177,0,109,254,78,0,36,246,0,0,20,253,255,0,20,
+    253,0,0,177,254,255,0,118,246,0,0,20,253,255,0,20,128,128,253,0,0,149,254,216,0,121,246,39,0,53,253,216,
+    0,17,249,0,0,137,246,255,0,235,252,0,128,128,128,0,50,254,59,0,18,242,0,0,5,253,59,0,5,0,216,254,
+    255,0,78,242,0,0,20,253,255,0,20,128,128,128,128,128,128,128,128,128,128,128,0,216,254,255,0,214,242,196,0,201,
+    253,255,0,20,0,216,233,255,0,20,128,128,0,216,254,255,0,146,242,98,0,110,253,255,0,20,0,216,254,255,0,78,
+    242,0,0,20,253,255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,41,246,59,0,45,0,177,246,
+    255,0,196,128,128,0,163,254,235,0,246,254,255,0,247,254,235,0,181,253,0,0,137,254,255,0,157,253,0,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,27,254,39,0,155,254,255,0,172,254,39,
+    0,30,0,177,246,255,0,196,128,128,128,253,0,0,41,246,59,0,45,253,0,0,177,246,255,0,196,128,128,253,0,0,
+    163,250,235,0,243,254,255,0,196,245,0,0,98,254,255,0,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,33,246,39,0,107,254,216,0,166,0,216,246,255,0,157,253,0,128,128,128,0,50,254,
+    59,0,18,242,0,0,5,253,59,0,5,0,216,254,255,0,78,242,0,0,20,253,255,0,20,128,128,0,216,254,255,0,
+    78,246,0,0,5,254,20,0,36,253,235,0,18,0,216,254,255,0,78,246,0,0,59,254,255,0,235,252,0,128,128,128,
+    0,216,254,255,0,78,250,0,0,91,254,235,0,186,254,20,0,18,252,0,0,216,254,255,0,78,250,0,0,98,254,255,
+    0,196,248,0,128,128,0,216,254,255,0,78,254,0,0,106,254,196,0,143,254,59,0,45,248,0,0,216,254,255,0,78,
+    254,0,0,137,254,255,0,157,244,0,128,128,0,216,254,255,0,187,254,157,0,210,254,255,0,157,244,0,0,216,246,255,
+    0,157,244,0,128,128,0,216,254,255,0,174,250,137,0,130,254,118,0,91,248,0,0,216,254,255,0,78,250,0,0,98,
+    254,255,0,196,248,0,128,128,0,216,254,255,0,78,250,0,0,68,254,177,0,154,254,78,0,72,252,0,0,216,254,255,
+    0,78,246,0,0,59,254,255,0,235,252,0,128,128,0,216,254,255,0,78,246,0,0,50,254,216,0,202,253,39,0,3,
+    0,216,254,255,0,78,242,0,0,20,253,255,0,20,128,128,128,0,50,254,59,0,18,241,0,0,216,254,255,0,78,241,
+    0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,216,254,255,
+    0,106,242,39,0,36,0,216,238,255,0,235,128,128,128,249,59,0,18,246,0,0,14,249,59,0,5,249,255,0,78,246,
+    0,0,59,249,255,0,20,128,128,128,128,128,128,128,253,255,0,56,254,20,0,169,254,235,0,109,254,0,0,91,254,235,
+    0,186,254,20,0,38,253,255,0,20,253,255,0,39,254,0,0,177,254,255,0,118,254,0,0,98,254,255,0,196,254,0,
+    0,20,253,255,0,20,128,128,128,128,128,128,253,255,0,39,254,0,0,68,254,98,0,130,254,157,0,134,254,98,0,75,
+    254,0,0,20,253,255,0,20,253,255,0,39,250,0,0,137,254,255,0,157,250,0,0,20,253,255,0,20,128,128,128,128,
+    128,128,253,255,0,39,250,0,0,95,254,177,0,109,250,0,0,20,253,255,0,20,253,255,0,39,238,0,0,20,253,255,
+    0,20,128,128,128,128,128,128,128,0,50,250,59,0,27,246,0,0,5,253,59,0,5,0,216,250,255,0,118,246,0,0,
+    20,253,255,0,20,128,128,128,128,128,128,128,0,216,254,255,0,92,254,20,0,136,254,235,0,145,250,0,0,20,253,255,
+    0,20,0,216,254,255,0,78,254,0,0,137,254,255,0,157,250,0,0,20,253,255,0,20,128,128,128,128,128,128,0,216,
+    254,255,0,78,254,0,0,53,254,98,0,121,254,157,0,121,254,0,0,20,253,255,0,20,0,216,254,255,0,78,250,0,
+    0,98,254,255,0,196,254,0,0,20,253,255,0,20,128,128,128,128,128,128,0,216,254,255,0,78,250,0,0,68,254,177,
+    0,154,254,78,0,92,253,255,0,20,0,216,254,255,0,78,246,0,0,59,249,255,0,20,128,128,128,128,128,128,128,249,
+    0,0,32,250,59,0,45,248,0,249,0,0,137,250,255,0,196,248,0,128,128,253,0,0,14,254,20,0,136,250,235,0,
+    186,254,20,0,18,252,0,253,0,0,177,254,255,0,118,250,0,0,59,254,255,0,235,252,0,128,128,128,0,199,254,235,
+    0,86,254,20,0,9,250,0,0,5,254,20,0,36,253,235,0,18,0,216,254,255,0,78,242,0,0,20,253,255,0,20,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,149,254,177,0,109,254,78,0,36,250,0,0,18,254,78,0,86,
+    253,177,0,14,253,0,0,177,254,255,0,118,250,0,0,59,254,255,0,235,252,0,128,128,253,0,0,149,254,216,0,121,
+    250,39,0,80,254,216,0,199,252,0,249,0,0,137,250,255,0,196,248,0,128,128,128,0,50,242,59,0,45,253,0,0,
+    216,242,255,0,196,253,0,128,128,0,216,254,255,0,241,246,235,0,186,254,20,0,18,0,216,254,255,0,78,246,0,0,
+    59,254,255,0,235,128,128,128,128,128,128,128,128,128,128,128,0,216,254,255,0,187,246,157,0,143,254,98,0,91,0,216,
+    242,255,0,196,253,0,128,128,0,216,254,255,0,174,246,137,0,106,253,0,0,216,254,255,0,78,241,0,128,128,128,128,
+    128,128,128,128,128,128,128,249,0,0,32,250,59,0,45,248,0,249,0,0,137,250,255,0,196,248,0,128,128,253,0,0,
+    14,254,20,0,136,250,235,0,186,254,20,0,18,252,0,253,0,0,177,254,255,0,118,250,0,0,59,254,255,0,235,252,
+    0,128,128,128,0,199,254,235,0,86,254,20,0,9,250,0,0,5,254,20,0,36,253,235,0,18,0,216,254,255,0,78,
+    242,0,0,20,253,255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,149,254,177,0,109,254,78,0,36,
+    250,0,0,18,254,78,0,86,253,177,0,14,253,0,0,177,254,255,0,118,250,0,0,59,254,255,0,235,252,0,128,128,
+    253,0,0,149,254,216,0,121,250,39,0,80,254,216,0,202,253,39,0,3,249,0,0,137,250,255,0,196,254,0,0,20,
+    253,255,0,20,128,128,128,237,0,0,20,253,255,0,20,128,128,128,237,0,0,3,253,39,0,3,0,50,242,59,0,45,
+    248,0,0,216,242,255,0,196,248,0,128,128,0,216,254,255,0,241,246,235,0,186,254,20,0,18,252,0,0,216,254,255,
+    0,78,246,0,0,59,254,255,0,235,252,0,128,128,128,128,128,128,128,128,128,128,128,0,216,254,255,0,187,246,157,0,
+    143,254,98,0,91,252,0,0,216,242,255,0,196,248,0,128,128,0,216,254,255,0,174,250,137,0,183,254,255,0,196,248,
+    0,0,216,254,255,0,78,250,0,0,98,254,255,0,196,248,0,128,128,0,216,254,255,0,78,250,0,0,68,254,177,0,
+    154,254,78,0,72,252,0,0,216,254,255,0,78,246,0,0,59,254,255,0,235,252,0,128,128,0,216,254,255,0,78,246,
+    0,0,50,254,216,0,202,253,39,0,3,0,216,254,255,0,78,242,0,0,20,253,255,0,20,128,128,128,253,0,0,41,
+    242,59,0,54,252,0,253,0,0,177,242,255,0,235,252,0,128,128,0,17,254,20,0,169,242,235,0,219,253,20,0,2,
+    0,216,254,255,0,78,242,0,0,20,253,255,0,20,128,128,128,0,216,254,255,0,78,242,0,0,2,253,20,0,2,0,
+    216,254,255,0,78,236,0,128,128,0,50,254,59,0,154,250,196,0,121,244,0,253,0,0,177,250,255,0,157,244,0,128,
+    128,253,0,0,68,250,98,0,121,250,157,0,145,252,0,245,0,0,98,250,255,0,235,252,0,128,128,245,0,0,53,250,
+    137,0,136,253,118,0,9,237,0,0,20,253,255,0,20,128,128,0,66,254,78,0,24,242,0,0,20,253,255,0,20,0,
+    216,254,255,0,78,242,0,0,20,253,255,0,20,128,128,0,183,254,216,0,94,242,39,0,53,253,216,0,17,253,0,0,
+    177,242,255,0,235,252,0,128,128,128,228,59,0,5,228,255,0,20,128,128,245,235,0,246,254,255,0,247,245,235,0,18,
+    245,0,0,137,254,255,0,157,244,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,0,50,254,59,0,18,242,0,0,5,253,59,0,5,0,216,254,255,0,78,242,0,0,20,253,255,
+    0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,183,254,
+    216,0,94,242,39,0,53,253,216,0,17,253,0,0,177,242,255,0,235,252,0,128,128,128,253,59,0,9,238,0,0,5,
+    253,59,0,5,253,255,0,39,238,0,0,20,253,255,0,20,128,128,128,128,128,128,128,253,20,0,202,254,235,0,72,246,
+    0,0,54,254,235,0,219,253,20,0,2,253,0,0,216,254,255,0,78,246,0,0,59,254,255,0,235,252,0,128,128,128,
+    128,128,128,253,0,0,83,254,98,0,139,254,157,0,72,254,0,0,60,254,157,0,143,254,98,0,91,252,0,249,0,0,
+    177,254,255,0,118,254,0,0,98,254,255,0,196,248,0,128,128,128,128,128,128,249,0,0,122,254,177,0,124,254,78,0,
+    116,254,177,0,136,248,0,245,0,0,137,254,255,0,157,244,0,128,128,128,128,128,128,128,253,59,0,9,238,0,0,5,
+    253,59,0,5,253,255,0,39,238,0,0,20,253,255,0,20,128,128,253,255,0,39,250,0,0,11,254,20,0,12,250,0,
+    0,20,253,255,0,20,253,255,0,39,250,0,0,137,254,255,0,157,250,0,0,20,253,255,0,20,128,128,128,128,128,128,
+    128,253,255,0,39,254,0,0,136,254,196,0,122,254,59,0,112,254,196,0,151,254,0,0,20,253,255,0,20,253,255,0,
+    39,254,0,0,177,254,255,0,118,254,0,0,98,254,255,0,196,254,0,0,20,253,255,0,20,128,128,128,128,128,128,253,
+    137,0,121,254,118,0,213,254,255,0,118,254,0,0,98,254,255,0,223,254,118,0,119,253,137,0,11,253,0,0,216,250,
+    255,0,118,254,0,0,98,250,255,0,235,252,0,128,128,253,0,0,216,254,255,0,201,254,177,0,81,254,0,0,68,254,
+    177,0,195,254,255,0,235,252,0,253,0,0,216,254,255,0,78,246,0,0,59,254,255,0,235,252,0,128,128,128,128,128,
+    128,128,0,50,254,59,0,18,242,0,0,5,253,59,0,5,0,216,254,255,0,78,242,0,0,20,253,255,0,20,128,128,
+    128,128,128,128,128,0,17,254,20,0,169,254,235,0,109,250,0,0,54,254,235,0,219,253,20,0,2,253,0,0,177,254,
+    255,0,118,250,0,0,59,254,255,0,235,252,0,128,128,253,0,0,41,254,59,0,133,250,196,0,164,254,59,0,54,252,
+    0,249,0,0,137,250,255,0,196,248,0,128,128,128,128,128,128,253,0,0,81,254,118,0,128,250,137,0,133,254,118,0,
+    109,252,0,253,0,0,177,254,255,0,118,250,0,0,59,254,255,0,235,252,0,128,128,0,66,254,78,0,146,254,177,0,
+    81,250,0,0,41,254,177,0,169,253,78,0,6,0,216,254,255,0,78,242,0,0,20,253,255,0,20,128,128,128,128,128,
+    128,128,253,59,0,9,238,0,0,5,253,59,0,5,253,255,0,39,238,0,0,20,253,255,0,20,128,128,128,128,128,128,
+    128,253,20,0,202,254,235,0,72,246,0,0,54,254,235,0,219,253,20,0,2,253,0,0,216,254,255,0,78,246,0,0,
+    59,254,255,0,235,252,0,128,128,253,0,0,50,254,59,0,154,254,196,0,91,254,0,0,75,254,196,0,164,254,59,0,
+    54,252,0,249,0,0,177,254,255,0,118,254,0,0,98,254,255,0,196,248,0,128,128,249,0,0,68,254,98,0,130,254,
+    157,0,134,254,98,0,75,248,0,245,0,0,137,254,255,0,157,244,0,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,0,50,233,59,0,5,0,216,233,255,0,20,128,128,0,199,238,235,0,237,253,255,0,20,237,0,0,20,253,255,
+    0,20,128,128,128,241,0,0,54,254,235,0,219,253,20,0,2,241,0,0,59,254,255,0,235,252,0,128,128,245,0,0,
+    75,254,196,0,164,254,59,0,54,252,0,245,0,0,98,254,255,0,196,248,0,128,128,249,0,0,84,254,157,0,134,254,
+    98,0,75,248,0,249,0,0,137,254,255,0,157,244,0,128,128,253,0,0,81,254,118,0,128,254,137,0,84,244,0,253,
+    0,0,177,254,255,0,118,240,0,128,128,0,66,254,78,0,146,254,177,0,81,240,0,0,216,254,255,0,78,236,0,128,
+    128,0,216,254,255,0,106,237,39,0,3,0,216,233,255,0,20,128,128,128,0,68,246,98,0,75,0,177,246,255,0,196,
+    128,128,0,177,254,255,0,223,250,196,0,151,0,177,254,255,0,118,249,0,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,177,254,255,0,234,250,216,
+    0,166,0,177,246,255,0,196,128,128,0,54,246,78,0,60,0,83,254,98,0,30,241,0,0,216,254,255,0,78,241,0,
+    128,128,128,128,128,128,0,199,254,235,0,86,254,20,0,9,245,0,253,0,0,177,254,255,0,118,245,0,128,128,128,128,
+    128,128,128,253,0,0,41,254,59,0,133,254,196,0,121,249,0,249,0,0,137,254,255,0,157,249,0,128,128,128,128,128,
+    128,249,0,0,74,254,137,0,130,254,118,0,91,253,0,245,0,0,98,254,255,0,196,253,0,128,128,128,128,128,128,245,
+    0,0,83,254,216,0,175,254,39,0,36,241,0,0,59,254,255,0,235,128,128,128,128,128,128,128,241,0,0,9,254,39,
+    0,36,0,68,246,98,0,75,0,177,246,255,0,196,128,128,0,136,250,196,0,219,254,255,0,196,249,0,0,98,254,255,
+    0,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,0,149,250,216,0,231,254,255,0,196,0,177,246,255,0,196,128,128,0,54,246,78,0,60,249,0,
+    0,53,254,98,0,60,249,0,249,0,0,137,254,255,0,157,249,0,128,128,128,128,128,128,253,0,0,14,254,20,0,136,
+    254,235,0,152,254,20,0,15,253,0,253,0,0,177,254,255,0,118,254,0,0,98,254,255,0,196,253,0,128,128,128,128,
+    128,128,128,0,166,254,196,0,101,254,59,0,27,254,0,0,23,254,59,0,91,254,196,0,181,0,216,254,255,0,78,246,
+    0,0,59,254,255,0,235,128,128,128,128,128,128,0,116,254,137,0,42,246,0,0,32,254,137,0,127,228,255,0,20,128,
+    128,128,228,39,0,3,0,68,254,98,0,45,253,0,0,177,254,255,0,118,253,0,128,128,0,136,254,196,0,122,254,59,
+    0,36,253,0,0,137,254,255,0,157,128,128,253,0,0,127,254,235,0,145,253,0,0,163,246,235,0,181,253,0,253,0,
+    0,177,246,255,0,196,253,0,128,128,253,0,0,41,246,59,0,91,254,196,0,181,241,0,0,59,254,255,0,235,128,128,
+    253,0,0,109,246,157,0,180,254,255,0,235,253,0,0,177,242,255,0,235,128,128,0,100,254,118,0,131,246,137,0,164,
+    254,255,0,235,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,128,128,128,128,0,183,254,216,0,94,246,39,
+    0,89,254,255,0,235,253,0,0,177,242,255,0,235,128,128,128,253,0,0,163,246,235,0,181,253,0,253,0,0,177,246,
+    255,0,196,253,0,128,128,0,166,254,196,0,101,246,59,0,91,254,196,0,181,0,216,254,255,0,78,246,0,0,59,254,
+    255,0,235,128,128,0,216,254,255,0,78,246,0,0,23,254,98,0,91,0,216,254,255,0,78,241,0,128,128,128,128,128,
+    128,0,216,254,255,0,78,246,0,0,18,254,78,0,72,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,0,
+    183,254,216,0,94,246,39,0,80,254,216,0,199,253,0,0,177,246,255,0,196,253,0,128,128,128,241,0,0,23,254,98,
+    0,91,241,0,0,59,254,255,0,235,128,128,128,128,128,128,128,128,128,128,128,253,0,0,163,246,235,0,240,254,255,0,
+    235,253,0,0,177,242,255,0,235,128,128,0,166,254,196,0,101,246,59,0,104,254,255,0,235,0,216,254,255,0,78,246,
+    0,0,59,254,255,0,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,183,254,216,0,94,246,39,0,89,254,
+    255,0,235,253,0,0,177,242,255,0,235,128,128,128,249,0,0,53,246,98,0,91,249,0,0,137,246,255,0,235,128,128,
+    253,0,0,41,254,59,0,133,246,196,0,181,253,0,0,177,254,255,0,118,245,0,128,128,128,128,128,128,128,0,199,254,
+    235,0,249,254,255,0,244,250,235,0,181,253,0,0,216,242,255,0,196,253,0,128,128,0,50,254,59,0,195,254,255,0,
+    149,250,59,0,45,253,0,253,0,0,177,254,255,0,118,245,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,0,83,254,98,0,30,241,0,0,216,254,255,0,78,241,0,128,128,128,128,128,128,128,128,128,128,128,0,
+    216,254,255,0,241,246,235,0,181,253,0,0,216,242,255,0,196,253,0,128,128,0,216,254,255,0,119,246,59,0,91,254,
+    196,0,181,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,253,0,0,53,254,98,0,60,253,0,0,137,254,255,0,157,128,128,253,0,0,106,254,196,0,121,248,0,
+    128,128,128,128,128,128,128,0,163,250,235,0,145,0,177,250,255,0,157,128,128,0,41,254,59,0,164,254,255,0,157,253,
+    0,0,137,254,255,0,157,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,245,0,0,38,254,98,
+    0,75,245,0,0,98,254,255,0,196,128,128,245,0,0,75,254,196,0,151,240,0,128,128,128,128,128,128,128,249,0,0,
+    127,250,235,0,181,249,0,0,137,250,255,0,196,128,128,249,0,0,32,254,59,0,134,254,255,0,196,245,0,0,98,254,
+    255,0,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,183,246,216,0,148,
+    254,39,0,30,0,216,246,255,0,157,253,0,128,128,0,66,246,78,0,48,253,0,0,83,254,98,0,30,241,0,0,216,
+    254,255,0,78,241,0,128,128,128,128,128,128,128,128,128,128,128,0,216,254,255,0,78,246,0,0,54,254,235,0,217,0,
+    216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,0,216,254,255,0,78,250,0,0,75,254,196,0,164,254,59,0,
+    54,0,216,254,255,0,78,250,0,0,98,254,255,0,196,253,0,128,128,0,216,254,255,0,78,254,0,0,84,254,157,0,
+    134,254,98,0,75,253,0,0,216,254,255,0,78,254,0,0,137,254,255,0,157,249,0,128,128,0,216,254,255,0,160,254,
+    118,0,192,254,255,0,157,249,0,0,216,246,255,0,157,249,0,128,128,0,216,254,255,0,201,250,177,0,139,254,78,0,
+    60,253,0,0,216,254,255,0,78,250,0,0,98,254,255,0,196,253,0,128,128,0,216,254,255,0,78,250,0,0,83,254,
+    216,0,175,254,39,0,36,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,128,0,68,250,98,0,60,0,177,
+    250,255,0,157,128,128,0,136,254,196,0,228,254,255,0,157,253,0,0,137,254,255,0,157,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,245,235,0,109,254,0,0,91,
+    250,235,0,217,252,0,245,255,0,118,254,0,0,98,250,255,0,235,252,0,128,128,253,255,0,89,250,59,0,133,254,196,
+    0,143,250,59,0,69,253,196,0,15,253,255,0,39,250,0,0,137,254,255,0,157,250,0,0,20,253,255,0,20,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,199,242,235,0,181,253,0,0,216,242,255,0,196,253,
+    0,128,128,0,216,254,255,0,119,246,59,0,91,254,196,0,181,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,253,0,0,163,246,235,0,181,253,0,253,0,0,177,
+    246,255,0,196,253,0,128,128,0,166,254,196,0,101,246,59,0,91,254,196,0,181,0,216,254,255,0,78,246,0,0,59,
+    254,255,0,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,183,254,216,0,94,246,39,0,80,254,216,0,199,
+    253,0,0,177,246,255,0,196,253,0,128,128,128,0,199,242,235,0,181,253,0,0,216,242,255,0,196,253,0,128,128,0,
+    216,254,255,0,119,246,59,0,91,254,196,0,181,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,0,216,254,255,0,106,246,39,0,80,254,216,0,199,0,216,242,255,0,196,253,0,128,
+    128,128,0,216,254,255,0,78,241,0,128,128,128,128,128,128,128,128,128,128,128,0,100,254,118,0,36,241,0,253,0,0,
+    163,242,235,0,217,253,0,0,177,242,255,0,235,128,128,0,166,254,196,0,101,246,59,0,104,254,255,0,235,0,216,254,
+    255,0,78,246,0,0,59,254,255,0,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,183,254,216,0,94,246,
+    39,0,89,254,255,0,235,253,0,0,177,242,255,0,235,128,128,128,241,0,0,59,254,255,0,235,128,128,128,128,128,128,
+    128,128,128,128,128,241,0,0,27,254,118,0,109,0,199,254,235,0,72,254,0,0,127,250,235,0,181,253,0,0,216,254,
+    255,0,78,254,0,0,137,250,255,0,196,253,0,128,128,0,216,254,255,0,214,254,196,0,122,250,59,0,91,254,196,0,
+    181,0,216,250,255,0,118,250,0,0,59,254,255,0,235,128,128,0,216,254,255,0,146,254,98,0,45,250,0,0,23,254,
+    98,0,91,0,216,254,255,0,78,241,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,253,0,0,163,242,235,
+    0,217,253,0,0,177,242,255,0,235,128,128,0,166,254,196,0,101,242,59,0,54,0,216,254,255,0,78,241,0,128,128,
+    0,83,254,98,0,139,250,157,0,97,249,0,253,0,0,177,250,255,0,157,249,0,128,128,253,0,0,95,250,137,0,130,
+    254,118,0,91,253,0,245,0,0,98,254,255,0,196,253,0,128,128,245,0,0,68,254,177,0,154,254,78,0,72,241,0,
+    0,59,254,255,0,235,128,128,0,33,242,39,0,80,254,216,0,199,0,216,242,255,0,196,253,0,128,128,128,0,41,254,
+    59,0,27,245,0,0,177,254,255,0,118,245,0,128,128,128,128,128,128,128,0,177,254,255,0,244,246,235,0,217,0,177,
+    242,255,0,235,128,128,0,177,254,255,0,149,246,59,0,54,0,177,254,255,0,118,245,0,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,0,149,254,216,0,121,246,39,0,36,253,0,0,137,246,255,0,235,128,128,128,0,199,254,235,0,
+    72,246,0,0,54,254,235,0,217,0,216,254,255,0,78,246,0,0,59,254,255,0,235,128,128,128,128,128,128,0,83,254,
+    98,0,139,254,157,0,72,254,0,0,60,254,157,0,143,254,98,0,91,253,0,0,177,254,255,0,118,254,0,0,98,254,
+    255,0,196,253,0,128,128,128,128,128,128,253,0,0,122,254,177,0,124,254,78,0,116,254,177,0,136,253,0,249,0,0,
+    137,254,255,0,157,249,0,128,128,128,128,128,128,128,253,235,0,36,238,0,0,18,253,235,0,18,253,255,0,39,238,0,
+    0,20,253,255,0,20,128,128,253,255,0,39,250,0,0,106,254,196,0,121,250,0,0,20,253,255,0,20,253,255,0,39,
+    250,0,0,137,254,255,0,157,250,0,0,20,253,255,0,20,128,128,128,128,128,128,253,255,0,39,254,0,0,81,254,118,
+    0,128,254,137,0,130,254,118,0,91,254,0,0,20,253,255,0,20,253,255,0,39,254,0,0,177,254,255,0,118,254,0,
+    0,98,254,255,0,196,254,0,0,20,253,255,0,20,128,128,253,177,0,94,254,78,0,201,254,255,0,118,254,0,0,98,
+    254,255,0,214,254,78,0,86,253,177,0,14,253,0,0,216,250,255,0,118,254,0,0,98,250,255,0,235,252,0,128,128,
+    253,0,0,216,254,255,0,228,254,216,0,100,254,0,0,83,254,216,0,225,254,255,0,235,252,0,253,0,0,216,254,255,
+    0,78,246,0,0,59,254,255,0,235,252,0,128,128,128,0,199,254,235,0,72,246,0,0,54,254,235,0,217,0,216,254,
+    255,0,78,246,0,0,59,254,255,0,235,128,128,0,50,254,59,0,154,254,196,0,91,254,0,0,75,254,196,0,164,254,
+    59,0,54,253,0,0,177,254,255,0,118,254,0,0,98,254,255,0,196,253,0,128,128,253,0,0,68,254,98,0,130,254,
+    157,0,134,254,98,0,75,253,0,249,0,0,137,254,255,0,157,249,0,128,128,128,128,128,128,253,0,0,54,254,78,0,
+    131,254,177,0,139,254,78,0,60,253,0,253,0,0,177,254,255,0,118,254,0,0,98,254,255,0,196,253,0,128,128,0,
+    33,254,39,0,161,254,216,0,100,254,0,0,83,254,216,0,175,254,39,0,36,0,216,254,255,0,78,246,0,0,59,254,
+    255,0,235,128,128,128,0,199,254,235,0,72,246,0,0,54,254,235,0,217,0,216,254,255,0,78,246,0,0,59,254,255,
+    0,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,183,254,216,0,94,246,39,0,89,254,255,
+    0,235,253,0,0,177,242,255,0,235,128,128,128,241,0,0,59,254,255,0,235,128,128,128,128,128,128,128,253,0,0,122,
+    246,177,0,154,254,78,0,72,253,0,0,177,246,255,0,196,253,0,128,128,253,0,0,81,246,118,0,91,253,0,0,199,
+    238,235,0,217,0,216,238,255,0,235,128,128,0,50,242,59,0,104,254,255,0,235,241,0,0,59,254,255,0,235,128,128,
+    245,0,0,60,254,157,0,143,254,98,0,91,245,0,0,98,254,255,0,196,253,0,128,128,249,0,0,63,254,118,0,125,
+    254,137,0,106,253,0,249,0,0,137,254,255,0,157,249,0,128,128,253,0,0,54,254,78,0,131,254,177,0,109,249,0,
+    253,0,0,177,254,255,0,118,245,0,128,128,0,33,254,39,0,189,254,255,0,139,246,39,0,36,0,216,238,255,0,235,
+    128,128,128,245,0,0,38,250,98,0,91,245,0,0,98,250,255,0,235,128,128,249,0,0,32,254,59,0,112,250,196,0,
+    181,249,0,0,137,254,255,0,157,249,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,133,250,157,0,125,
+    254,98,0,60,249,0,0,216,250,255,0,118,245,0,128,128,0,116,250,137,0,127,254,118,0,72,249,0,249,0,0,137,
+    254,255,0,157,249,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,249,0,0,21,254,39,0,107,250,216,0,
+    199,245,0,0,98,250,255,0,235,128,128,245,0,0,30,250,78,0,72,0,53,254,98,0,60,0,137,254,255,0,157,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,0,42,254,78,0,48,0,83,250,98,0,45,245,0,0,216,250,255,0,118,245,
+    0,128,128,0,166,250,196,0,122,254,59,0,36,249,0,249,0,0,137,254,255,0,157,249,0,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,249,0,0,53,254,98,0,121,250,157,0,145,245,0,0,98,250,255,0,235,128,128,249,0,
+    0,63,254,118,0,125,250,137,0,127,249,0,0,137,254,255,0,157,249,0,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,0,183,250,216,0,121,254,39,0,24,249,0,0,216,250,255,0,118,245,0,128,128,0,66,250,78,0,36,245,
+    0,253,0,0,166,246,196,0,121,250,0,0,15,253,196,0,15,253,0,0,216,246,255,0,157,250,0,0,20,253,255,0,
+    20,128,128,253,157,0,107,250,98,0,183,254,255,0,217,250,157,0,152,253,98,0,8,253,255,0,39,250,0,0,137,246,
+    255,0,235,252,0,128,128,253,137,0,21,250,0,0,74,246,137,0,127,252,0,0,36,240,78,0,54,248,0,0,118,240,
+    255,0,177,248,0,128,128,128,0,118,253,255,0,74,245,59,0,101,253,196,0,45,253,0,0,118,253,255,0,20,245,0,
+    0,78,253,255,0,59,253,0,128,128,0,118,253,255,0,20,245,0,0,60,253,196,0,91,254,59,0,45,0,118,253,255,
+    0,20,240,0,0,196,254,255,0,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,118,253,255,0,20,
+    245,0,0,6,253,20,0,186,254,235,0,181,0,118,253,255,0,20,245,0,0,78,253,255,0,59,253,0,128,128,128,0,
+    118,253,255,0,146,245,137,0,131,253,118,0,27,253,0,0,118,240,255,0,177,248,0,128,128,128,252,0,0,54,245,59,
+    0,41,252,0,252,0,0,235,245,255,0,177,252,0,128,128,128,0,81,253,177,0,86,245,78,0,109,253,177,0,41,0,
+    118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,0,118,253,255,0,56,245,39,0,106,253,255,0,59,0,118,235,
+    255,0,59,128,128,128,0,118,253,255,0,110,240,98,0,23,0,118,253,255,0,20,239,0,128,128,0,118,253,255,0,20,
+    245,0,0,6,253,20,0,5,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,128,0,54,253,118,0,136,245,
+    137,0,131,253,118,0,27,252,0,0,235,245,255,0,177,252,0,128,128,128,0,100,253,216,0,17,239,0,0,118,253,255,
+    0,20,239,0,128,128,128,128,128,128,128,128,128,128,128,0,118,253,255,0,74,245,59,0,41,252,0,0,118,240,255,0,
+    177,252,0,128,128,128,0,118,253,255,0,92,245,78,0,109,253,177,0,41,0,118,253,255,0,20,245,0,0,78,253,255,
+    0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,118,253,255,0,146,245,137,0,131,253,118,0,27,
+    0,118,240,255,0,177,252,0,128,128,128,0,27,253,59,0,5,245,0,0,18,253,59,0,14,0,118,253,255,0,20,245,
+    0,0,78,253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,54,253,118,
+    0,136,245,137,0,174,253,255,0,59,252,0,0,235,240,255,0,59,128,128,128,252,0,0,54,240,59,0,14,252,0,0,
+    235,240,255,0,59,128,128,128,0,81,253,177,0,86,245,78,0,133,253,255,0,59,0,118,253,255,0,20,245,0,0,78,
+    253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,54,253,118,0,136,245,137,0,174,253,255,
+    0,59,252,0,0,235,240,255,0,59,128,128,128,239,0,0,78,253,255,0,59,128,128,128,128,128,128,128,128,252,0,0,
+    217,245,235,0,169,253,20,0,5,252,0,0,235,245,255,0,177,252,0,128,128,252,0,0,145,245,157,0,109,252,0,0,
+    30,253,78,0,12,0,98,253,255,0,39,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,0,91,253,235,0,36,251,0,128,128,128,0,53,253,137,0,21,0,98,253,255,0,39,128,128,128,0,199,
+    254,216,0,133,253,0,0,183,254,216,0,149,0,235,254,255,0,157,253,0,0,216,254,255,0,177,128,128,128,128,128,128,
+    128,128,128,128,128,0,181,254,196,0,121,253,0,0,166,254,196,0,136,244,0,0,30,253,78,0,12,254,0,0,24,253,
+    78,0,18,253,0,244,0,0,98,253,255,0,39,254,0,0,78,253,255,0,59,253,0,128,128,128,128,128,128,128,253,0,
+    0,27,249,59,0,134,253,255,0,89,254,59,0,119,253,255,0,104,254,59,0,45,253,0,0,118,231,255,0,196,128,128,
+    128,253,0,0,36,253,78,0,241,254,255,0,187,253,78,0,228,254,255,0,201,249,78,0,60,248,0,0,235,254,255,0,
+    157,253,0,0,216,254,255,0,177,248,0,128,128,128,128,128,128,128,248,157,0,247,254,255,0,217,253,157,0,240,254,255,
+    0,225,253,157,0,36,253,0,230,255,0,59,253,0,128,128,253,235,0,244,253,255,0,237,254,235,0,243,253,255,0,238,
+    249,235,0,54,253,0,253,0,0,118,253,255,0,20,254,0,0,98,253,255,0,39,244,0,128,128,128,128,128,128,128,128,
+    248,0,0,30,253,78,0,12,248,0,248,0,0,98,253,255,0,39,248,0,128,128,128,252,0,0,181,254,196,0,219,253,
+    255,0,205,249,196,0,45,252,0,0,235,240,255,0,59,128,128,0,27,253,59,0,186,254,196,0,219,253,255,0,205,249,
+    196,0,45,0,118,253,255,0,20,254,0,0,98,253,255,0,39,248,0,128,128,128,128,128,128,128,0,100,253,216,0,53,
+    254,39,0,122,253,255,0,72,254,39,0,27,252,0,252,0,0,235,245,255,0,177,252,0,128,128,128,252,0,0,91,254,
+    98,0,158,253,255,0,122,254,98,0,116,253,157,0,36,248,0,0,98,253,255,0,39,254,0,0,78,253,255,0,59,128,
+    128,128,128,128,128,128,0,63,249,137,0,183,253,255,0,155,254,137,0,131,253,118,0,27,0,118,240,255,0,177,252,0,
+    128,128,128,248,0,0,98,253,255,0,39,248,0,128,128,128,248,0,0,53,253,137,0,21,248,0,253,0,0,36,253,78,
+    0,6,245,0,0,24,253,78,0,18,253,0,253,0,0,118,253,255,0,20,245,0,0,78,253,255,0,59,253,0,128,128,
+    128,253,196,0,133,253,59,0,186,254,196,0,121,253,0,0,166,254,196,0,154,253,59,0,14,253,0,253,255,0,137,253,
+    0,0,235,254,255,0,157,253,0,0,216,254,255,0,177,248,0,128,128,128,128,128,128,128,253,78,0,124,253,177,0,86,
+    254,78,0,116,253,177,0,94,254,78,0,54,248,0,253,0,0,118,253,255,0,20,254,0,0,98,253,255,0,39,244,0,
+    128,128,253,0,0,100,253,216,0,17,254,0,0,98,253,255,0,39,254,0,0,12,253,39,0,9,253,0,244,0,0,98,
+    253,255,0,39,254,0,0,78,253,255,0,59,253,0,128,128,128,248,0,0,145,254,157,0,134,253,98,0,148,254,157,0,
+    139,253,98,0,143,254,157,0,121,248,0,0,235,254,255,0,157,253,0,0,216,254,255,0,177,253,0,0,196,254,255,0,
+    196,128,128,128,128,128,128,128,253,0,0,63,253,137,0,119,254,118,0,72,253,0,0,100,254,118,0,124,253,137,0,122,
+    254,118,0,91,253,0,0,118,253,255,0,20,245,0,0,78,253,255,0,59,253,0,128,128,128,252,0,0,72,249,78,0,
+    12,244,0,252,0,0,235,249,255,0,39,244,0,128,128,128,0,91,253,196,0,69,249,59,0,175,254,196,0,136,248,0,
+    0,118,253,255,0,20,249,0,0,216,254,255,0,177,248,0,128,128,128,128,128,128,128,0,36,253,78,0,169,249,177,0,
+    94,254,78,0,54,253,0,0,136,254,177,0,136,252,0,0,235,249,255,0,39,249,0,0,196,254,255,0,196,128,128,0,
+    18,253,39,0,202,249,216,0,66,254,39,0,27,253,0,0,196,254,255,0,196,0,118,253,255,0,20,249,0,0,216,254,
+    255,0,177,253,0,0,196,254,255,0,196,128,128,128,0,118,253,255,0,20,249,0,0,83,254,98,0,116,253,157,0,112,
+    254,98,0,75,0,118,253,255,0,20,245,0,0,78,253,255,0,59,253,0,128,128,128,128,128,128,128,0,54,253,118,0,
+    136,245,137,0,131,253,118,0,133,254,137,0,106,252,0,0,235,245,255,0,177,253,0,0,196,254,255,0,196,128,128,128,
+    0,83,253,216,0,33,0,98,253,255,0,39,128,128,128,128,128,128,128,128,128,128,128,0,75,253,196,0,30,248,0,0,
+    183,254,216,0,149,248,0,0,216,254,255,0,177,128,128,253,0,0,30,253,78,0,161,254,177,0,122,253,0,0,98,253,
+    255,0,39,253,0,128,128,128,128,128,128,128,0,54,254,59,0,112,253,196,0,30,253,0,0,235,254,255,0,157,248,0,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,109,254,118,0,125,253,137,0,21,253,
+    0,253,0,0,98,253,255,0,39,253,0,128,128,128,128,128,128,128,253,0,0,53,253,137,0,121,254,118,0,81,248,0,
+    0,216,254,255,0,177,128,128,128,248,0,0,17,254,20,0,14,0,199,254,216,0,133,248,0,0,235,254,255,0,157,248,
+    0,128,128,0,163,254,177,0,139,253,78,0,12,253,0,253,0,0,98,253,255,0,39,253,0,128,128,128,128,128,128,128,
+    253,0,0,75,253,196,0,80,254,59,0,41,248,0,0,216,254,255,0,177,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,253,0,0,53,253,137,0,121,254,118,0,81,253,0,0,98,253,255,0,39,253,0,128,
+    128,128,128,128,128,128,0,109,254,118,0,125,253,137,0,21,253,0,0,235,254,255,0,157,248,0,128,128,128,0,18,254,
+    20,0,12,248,0,248,0,0,23,253,59,0,9,248,0,248,0,0,98,253,255,0,39,248,0,128,128,128,0,81,253,177,
+    0,14,254,0,0,98,253,255,0,39,254,0,0,54,253,177,0,41,0,118,253,255,0,20,254,0,0,98,253,255,0,39,
+    254,0,0,78,253,255,0,59,128,128,0,100,253,216,0,53,254,39,0,122,253,255,0,72,254,39,0,94,253,216,0,50,
+    252,0,0,235,245,255,0,177,252,0,128,128,128,0,72,253,157,0,103,254,98,0,158,253,255,0,122,254,98,0,116,253,
+    157,0,36,0,118,253,255,0,20,254,0,0,98,253,255,0,39,254,0,0,78,253,255,0,59,128,128,0,109,253,235,0,
+    18,254,0,0,98,253,255,0,39,254,0,0,72,253,235,0,54,248,0,0,98,253,255,0,39,248,0,128,128,128,248,0,
+    0,45,253,118,0,18,248,0,248,0,0,23,253,59,0,9,248,0,248,0,0,98,253,255,0,39,248,0,128,128,128,128,
+    128,128,128,0,18,249,39,0,122,253,255,0,72,249,39,0,9,0,118,235,255,0,59,128,128,128,0,45,249,98,0,158,
+    253,255,0,122,249,98,0,23,248,0,0,98,253,255,0,39,248,0,128,128,128,128,128,128,128,248,0,0,45,253,118,0,
+    18,248,0,252,0,0,18,254,20,0,12,252,0,0,235,254,255,0,157,128,128,128,128,128,128,128,128,128,128,128,128,0,
+    54,253,118,0,136,254,137,0,84,0,118,253,255,0,20,253,0,128,128,128,0,9,253,20,0,2,253,0,0,18,235,39,
+    0,9,0,118,235,255,0,59,128,128,128,0,45,235,98,0,23,0,18,254,20,0,12,0,235,254,255,0,157,128,128,128,
+    128,128,128,128,128,239,0,0,66,253,216,0,50,239,0,0,78,253,255,0,59,128,128,128,128,128,128,128,243,0,0,166,
+    254,196,0,154,253,59,0,14,243,0,0,216,254,255,0,177,252,0,128,128,128,128,128,128,128,248,0,0,68,253,177,0,
+    94,254,78,0,54,252,0,248,0,0,98,253,255,0,39,248,0,128,128,128,128,128,128,128,252,0,0,145,254,157,0,134,
+    253,98,0,15,248,0,252,0,0,235,254,255,0,157,243,0,128,128,128,128,128,128,128,0,63,253,137,0,119,254,118,0,
+    72,243,0,0,118,253,255,0,20,239,0,128,128,128,128,128,128,128,0,63,253,137,0,11,239,0,252,0,0,72,245,78,
+    0,54,252,0,252,0,0,235,245,255,0,177,252,0,128,128,128,0,91,253,196,0,69,245,59,0,101,253,196,0,45,0,
+    118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,128,128,128,128,128,0,118,253,255,0,20,254,0,0,68,253,177,
+    0,27,254,0,0,78,253,255,0,59,0,118,253,255,0,20,254,0,0,98,253,255,0,39,254,0,0,78,253,255,0,59,
+    128,128,128,128,128,128,128,0,118,253,255,0,20,254,0,0,38,253,98,0,15,254,0,0,78,253,255,0,59,0,118,253,
+    255,0,20,245,0,0,78,253,255,0,59,128,128,128,128,128,128,128,0,54,253,118,0,136,245,137,0,131,253,118,0,27,
+    252,0,0,235,245,255,0,177,252,0,128,128,128,248,0,0,30,253,78,0,12,248,0,248,0,0,98,253,255,0,39,248,
+    0,128,128,128,252,0,0,181,254,196,0,219,253,255,0,39,248,0,252,0,0,235,249,255,0,39,248,0,128,128,0,27,
+    253,59,0,186,254,196,0,219,253,255,0,39,248,0,0,118,253,255,0,20,254,0,0,98,253,255,0,39,248,0,128,128,
+    128,0,36,253,78,0,6,254,0,0,98,253,255,0,39,248,0,248,0,0,98,253,255,0,39,248,0,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,0,63,249,137,0,183,253,255,0,155,249,137,0,32,0,118,235,255,0,59,128,
+    128,128,252,0,0,72,245,78,0,54,252,0,252,0,0,235,245,255,0,177,252,0,128,128,128,0,91,253,196,0,69,245,
+    59,0,101,253,196,0,45,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,0,91,253,196,0,15,245,0,0,
+    78,253,255,0,59,239,0,0,78,253,255,0,59,128,128,128,243,0,0,149,254,177,0,146,253,78,0,18,243,0,0,216,
+    254,255,0,177,252,0,128,128,248,0,0,15,253,39,0,189,254,216,0,149,252,0,248,0,0,98,253,255,0,39,248,0,
+    128,128,128,252,0,0,145,254,157,0,134,253,98,0,15,248,0,252,0,0,235,254,255,0,157,243,0,128,128,0,9,253,
+    20,0,219,254,235,0,145,243,0,0,118,253,255,0,20,239,0,128,128,128,0,118,253,255,0,146,240,137,0,32,0,118,
+    235,255,0,59,128,128,128,252,0,0,72,245,78,0,54,252,0,252,0,0,235,245,255,0,177,252,0,128,128,128,0,91,
+    253,196,0,69,245,59,0,101,253,196,0,45,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,0,91,253,196,
+    0,15,245,0,0,78,253,255,0,59,239,0,0,78,253,255,0,59,128,128,128,248,0,0,68,249,177,0,146,253,78,0,
+    18,248,0,0,98,249,255,0,177,252,0,128,128,248,0,0,83,249,216,0,161,253,39,0,9,239,0,0,78,253,255,0,
+    59,128,128,128,128,128,128,128,0,9,253,20,0,2,245,0,0,78,253,255,0,59,0,118,253,255,0,20,245,0,0,78,
+    253,255,0,59,128,128,128,0,54,253,118,0,136,245,137,0,131,253,118,0,27,252,0,0,235,245,255,0,177,252,0,128,
+    128,128,239,0,0,24,253,78,0,18,253,0,239,0,0,78,253,255,0,59,253,0,128,128,128,243,0,0,166,254,196,0,
+    214,253,255,0,59,253,0,243,0,0,216,249,255,0,59,253,0,128,128,248,0,0,23,253,59,0,175,254,196,0,214,253,
+    255,0,59,253,0,248,0,0,98,253,255,0,39,254,0,0,78,253,255,0,59,253,0,128,128,128,252,0,0,163,254,177,
+    0,139,253,78,0,12,254,0,0,78,253,255,0,59,253,0,252,0,0,235,254,255,0,157,249,0,0,78,253,255,0,59,
+    253,0,128,128,0,18,253,39,0,202,254,216,0,133,249,0,0,78,253,255,0,59,253,0,0,118,253,255,0,20,245,0,
+    0,78,253,255,0,59,253,0,128,128,128,0,118,253,255,0,164,245,157,0,187,253,255,0,180,254,157,0,121,0,118,231,
+    255,0,196,128,128,0,109,240,235,0,241,253,255,0,240,254,235,0,181,239,0,0,78,253,255,0,59,253,0,128,128,128,
+    128,128,128,128,128,0,36,235,78,0,18,0,118,235,255,0,59,128,128,128,0,118,253,255,0,74,240,59,0,14,0,118,
+    253,255,0,20,239,0,128,128,128,128,128,128,128,0,118,253,255,0,183,245,177,0,122,252,0,0,118,240,255,0,177,252,
+    0,128,128,0,100,240,216,0,161,253,39,0,9,239,0,0,78,253,255,0,59,128,128,128,128,128,128,128,0,9,253,20,
+    0,2,245,0,0,78,253,255,0,59,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,128,0,54,253,118,0,
+    136,245,137,0,131,253,118,0,27,252,0,0,235,245,255,0,177,252,0,128,128,128,248,0,0,30,249,78,0,54,252,0,
+    248,0,0,98,249,255,0,177,252,0,128,128,128,252,0,0,181,254,196,0,143,249,59,0,41,252,0,252,0,0,235,254,
+    255,0,157,243,0,128,128,0,27,253,59,0,186,254,196,0,121,243,0,0,118,253,255,0,20,239,0,128,128,128,0,118,
+    253,255,0,183,245,177,0,122,252,0,0,118,240,255,0,177,252,0,128,128,0,118,253,255,0,219,245,216,0,161,253,39,
+    0,9,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,0,54,253,118,
+    0,136,245,137,0,131,253,118,0,27,252,0,0,235,245,255,0,177,252,0,128,128,128,0,36,235,78,0,18,0,118,235,
+    255,0,59,128,128,128,0,27,240,59,0,119,253,255,0,59,239,0,0,78,253,255,0,59,128,128,243,0,0,50,254,59,
+    0,101,253,196,0,45,243,0,0,216,254,255,0,177,252,0,128,128,128,128,128,128,128,248,0,0,15,253,39,0,189,254,
+    216,0,149,252,0,248,0,0,98,253,255,0,39,248,0,128,128,128,128,128,128,128,252,0,0,18,254,20,0,103,253,235,
+    0,36,248,0,252,0,0,235,254,255,0,157,243,0,128,128,128,128,128,128,128,128,252,0,0,72,245,78,0,54,252,0,
+    252,0,0,235,245,255,0,177,252,0,128,128,128,0,91,253,196,0,69,245,59,0,101,253,196,0,45,0,118,253,255,0,
+    20,245,0,0,78,253,255,0,59,128,128,128,128,128,128,128,0,36,253,78,0,169,245,177,0,146,253,78,0,18,252,0,
+    0,235,245,255,0,177,252,0,128,128,0,18,253,39,0,202,245,216,0,161,253,39,0,9,0,118,253,255,0,20,245,0,
+    0,78,253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,0,54,253,118,0,136,245,137,0,131,253,118,0,27,
+    252,0,0,235,245,255,0,177,252,0,128,128,128,252,0,0,72,245,78,0,54,252,0,252,0,0,235,245,255,0,177,252,
+    0,128,128,128,0,91,253,196,0,69,245,59,0,101,253,196,0,45,0,118,253,255,0,20,245,0,0,78,253,255,0,59,
+    128,128,128,128,128,128,128,128,128,128,128,0,100,253,216,0,53,245,39,0,106,253,255,0,59,252,0,0,235,240,255,0,
+    59,128,128,128,252,0,0,91,245,98,0,146,253,255,0,59,239,0,0,78,253,255,0,59,128,128,243,0,0,17,254,20,
+    0,86,253,235,0,54,243,0,0,216,254,255,0,177,252,0,128,128,128,252,0,0,127,249,137,0,121,254,118,0,81,252,
+    0,252,0,0,235,249,255,0,39,248,0,128,128,128,0,23,253,59,0,9,0,98,253,255,0,39,128,128,128,128,128,128,
+    128,0,83,253,216,0,33,251,0,128,128,128,128,128,128,128,0,8,253,20,0,3,0,98,253,255,0,39,128,128,128,128,
+    128,128,128,128,252,0,0,54,254,59,0,36,252,0,0,235,254,255,0,157,128,128,128,128,128,128,128,252,0,0,199,254,
+    216,0,133,247,0,128,128,128,128,128,128,128,252,0,0,18,254,20,0,12,252,0,0,235,254,255,0,157,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,54,253,118,0,136,254,137,0,84,0,118,253,255,0,20,253,0,128,128,128,0,9,253,
+    20,0,2,253,0,239,0,0,50,249,59,0,14,239,0,0,216,249,255,0,59,128,128,128,248,0,0,163,249,177,0,94,
+    249,78,0,18,248,0,0,235,249,255,0,39,248,0,128,128,248,39,0,202,249,216,0,33,248,0,248,255,0,20,239,0,
+    128,128,128,248,98,0,152,249,157,0,24,248,0,248,0,0,235,249,255,0,39,248,0,128,128,248,0,0,217,249,235,0,
+    53,249,20,0,5,239,0,0,216,249,255,0,59,128,128,128,239,0,0,100,249,118,0,27,0,81,231,177,0,136,0,118,
+    231,255,0,196,128,128,0,100,231,216,0,166,229,0,128,128,128,0,72,231,157,0,121,0,118,231,255,0,196,128,128,0,
+    109,231,235,0,181,0,27,249,59,0,36,239,0,0,118,249,255,0,157,239,0,128,128,128,0,36,249,78,0,116,249,177,
+    0,122,248,0,248,0,0,98,249,255,0,177,248,0,128,128,248,0,0,83,249,216,0,161,249,39,0,30,239,0,0,78,
+    249,255,0,196,128,128,128,248,0,0,60,249,157,0,139,249,98,0,75,248,0,0,98,249,255,0,177,248,0,128,128,0,
+    9,249,20,0,103,249,235,0,163,248,0,0,118,249,255,0,157,239,0,128,128,128,0,54,249,118,0,72,239,0,252,0,
+    0,72,245,78,0,54,252,0,252,0,0,235,245,255,0,177,252,0,128,128,128,0,91,253,196,0,69,245,59,0,101,253,
+    196,0,45,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,0,91,253,196,0,15,245,0,0,78,253,255,0,
+    59,239,0,0,78,253,255,0,59,128,128,128,243,0,0,149,254,177,0,146,253,78,0,18,243,0,0,216,254,255,0,177,
+    252,0,128,128,248,0,0,15,253,39,0,189,254,216,0,149,252,0,248,0,0,98,253,255,0,39,248,0,128,128,128,128,
+    128,128,128,248,0,0,91,253,235,0,36,248,0,233,0,128,128,128,248,0,0,53,253,137,0,21,248,0,248,0,0,98,
+    253,255,0,39,248,0,128,128,128,248,0,0,72,245,78,0,54,248,0,248,0,0,235,245,255,0,177,248,0,128,128,128,
+    253,0,0,91,253,196,0,69,245,59,0,101,253,196,0,45,253,0,253,0,0,118,253,255,0,20,245,0,0,78,253,255,
+    0,59,253,0,128,128,253,59,0,122,253,196,0,15,254,0,0,23,249,59,0,101,253,196,0,91,254,59,0,45,253,255,
+    0,137,249,0,0,98,249,255,0,177,253,0,0,196,254,255,0,196,128,128,128,253,255,0,137,253,0,0,163,254,177,0,
+    139,253,78,0,228,254,255,0,177,253,0,0,196,254,255,0,196,253,255,0,137,253,0,0,235,254,255,0,157,253,0,0,
+    216,254,255,0,177,253,0,0,196,254,255,0,196,128,128,128,128,128,128,128,253,255,0,137,253,0,0,91,254,98,0,121,
+    253,157,0,240,254,255,0,225,253,157,0,112,254,98,0,75,253,255,0,137,249,0,0,98,244,255,0,59,253,0,128,128,
+    253,235,0,136,253,20,0,2,254,0,0,91,244,235,0,54,253,0,253,0,0,118,253,255,0,20,235,0,128,128,128,253,
+    0,0,54,253,118,0,136,240,137,0,32,253,0,248,0,0,235,240,255,0,59,253,0,128,128,128,248,0,0,30,249,78,
+    0,54,248,0,248,0,0,98,249,255,0,177,248,0,128,128,128,128,128,128,128,252,0,0,54,254,59,0,112,249,196,0,
+    154,253,59,0,14,253,0,252,0,0,235,254,255,0,157,249,0,0,78,253,255,0,59,253,0,128,128,128,128,128,128,128,
+    252,0,0,235,254,255,0,172,249,39,0,106,253,255,0,59,253,0,252,0,0,235,240,255,0,59,253,0,128,128,128,0,
+    72,253,157,0,103,240,98,0,143,254,157,0,121,0,118,253,255,0,20,240,0,0,196,254,255,0,196,128,128,128,128,128,
+    128,128,128,128,128,128,128,0,36,240,78,0,54,248,0,0,118,240,255,0,177,248,0,128,128,128,0,118,253,255,0,74,
+    245,59,0,101,253,196,0,45,253,0,0,118,253,255,0,20,245,0,0,78,253,255,0,59,253,0,128,128,128,128,128,128,
+    128,0,118,253,255,0,183,245,177,0,201,253,255,0,59,253,0,0,118,235,255,0,59,253,0,128,128,0,118,253,255,0,
+    219,240,216,0,80,254,39,0,30,0,118,253,255,0,20,240,0,0,196,254,255,0,196,128,128,128,128,128,128,128,128,128,
+    128,128,128,0,118,253,255,0,146,240,137,0,122,254,118,0,91,0,118,235,255,0,59,253,0,128,128,128,248,0,0,30,
+    244,78,0,18,253,0,248,0,0,98,244,255,0,59,253,0,128,128,128,252,0,0,181,254,196,0,143,244,59,0,164,254,
+    196,0,151,252,0,0,235,254,255,0,157,244,0,0,196,254,255,0,196,128,128,0,27,253,59,0,186,254,196,0,121,244,
+    0,0,151,254,196,0,151,0,118,253,255,0,20,235,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,
+    109,253,235,0,36,254,20,0,12,244,0,0,15,254,20,0,15,252,0,0,235,254,255,0,157,244,0,0,196,254,255,0,
+    196,128,128,128,252,0,0,109,254,118,0,125,244,137,0,122,254,118,0,91,248,0,0,98,244,255,0,59,253,0,128,128,
+    128,0,36,235,78,0,18,0,118,235,255,0,59,128,128,128,0,118,253,255,0,74,240,59,0,14,0,118,253,255,0,20,
+    239,0,128,128,128,128,128,128,128,0,118,253,255,0,183,245,177,0,122,252,0,0,118,240,255,0,177,252,0,128,128,0,
+    118,253,255,0,219,245,216,0,149,252,0,0,118,253,255,0,20,239,0,128,128,128,128,128,128,128,128,128,128,128,128,0,
+    118,253,255,0,146,240,137,0,32,0,118,235,255,0,59,128,128,128,0,36,235,78,0,18,0,118,235,255,0,59,128,128,
+    128,0,118,253,255,0,74,240,59,0,14,0,118,253,255,0,20,239,0,128,128,128,128,128,128,128,0,118,253,255,0,183,
+    245,177,0,122,252,0,0,118,240,255,0,177,252,0,128,128,0,118,253,255,0,219,245,216,0,149,252,0,0,118,253,255,
+    0,20,239,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,248,0,0,30,244,78,0,18,253,0,248,
+    0,0,98,244,255,0,59,253,0,128,128,128,252,0,0,181,254,196,0,143,244,59,0,164,254,196,0,151,252,0,0,235,
+    254,255,0,157,244,0,0,196,254,255,0,196,128,128,0,27,253,59,0,186,254,196,0,121,244,0,0,151,254,196,0,151,
+    0,118,253,255,0,20,235,0,128,128,128,128,128,128,128,0,118,253,255,0,20,249,0,0,33,245,39,0,30,0,118,253,
+    255,0,20,249,0,0,216,245,255,0,196,128,128,128,0,118,253,255,0,20,249,0,0,83,249,98,0,219,254,255,0,196,
+    0,118,253,255,0,20,240,0,0,196,254,255,0,196,128,128,0,109,253,235,0,36,254,20,0,12,244,0,0,196,254,255,
+    0,196,252,0,0,235,254,255,0,157,244,0,0,196,254,255,0,196,128,128,128,252,0,0,109,254,118,0,125,244,137,0,
+    122,254,118,0,91,248,0,0,98,244,255,0,59,253,0,128,128,128,0,36,253,78,0,6,240,0,0,60,254,78,0,60,
+    0,118,253,255,0,20,240,0,0,196,254,255,0,196,128,128,128,128,128,128,128,128,128,128,128,128,0,118,253,255,0,183,
+    240,177,0,237,254,255,0,196,0,118,231,255,0,196,128,128,0,118,253,255,0,219,240,216,0,246,254,255,0,196,0,118,
+    253,255,0,20,240,0,0,196,254,255,0,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,72,245,
+    78,0,54,0,235,245,255,0,177,128,128,128,0,54,254,59,0,134,253,255,0,89,254,59,0,41,253,0,0,98,253,255,
+    0,39,253,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,127,254,
+    137,0,183,253,255,0,155,254,137,0,95,0,235,245,255,0,177,128,128,128,252,0,0,72,245,78,0,54,252,0,0,235,
+    245,255,0,177,128,128,128,252,0,0,54,249,59,0,225,254,255,0,177,243,0,0,216,254,255,0,177,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,63,244,137,0,121,254,118,0,81,0,118,
+    244,255,0,39,253,0,128,128,128,0,36,253,78,0,6,240,0,0,60,254,78,0,60,0,118,253,255,0,20,240,0,0,
+    196,254,255,0,196,128,128,128,0,118,253,255,0,20,245,0,0,60,253,196,0,91,254,59,0,45,0,118,253,255,0,20,
+    245,0,0,78,253,255,0,59,253,0,128,128,0,118,253,255,0,20,249,0,0,50,254,59,0,101,253,196,0,45,253,0,
+    0,118,253,255,0,20,249,0,0,216,254,255,0,177,248,0,128,128,128,0,118,253,255,0,20,254,0,0,68,253,177,0,
+    94,254,78,0,54,248,0,0,118,253,255,0,20,254,0,0,98,253,255,0,39,244,0,128,128,0,118,253,255,0,56,254,
+    39,0,122,253,255,0,39,244,0,0,118,244,255,0,39,244,0,128,128,128,0,118,253,255,0,110,249,98,0,148,254,157,
+    0,109,248,0,0,118,253,255,0,20,249,0,0,216,254,255,0,177,248,0,128,128,0,118,253,255,0,20,249,0,0,199,
+    254,235,0,169,253,20,0,5,253,0,0,118,253,255,0,20,245,0,0,78,253,255,0,59,253,0,128,128,128,0,118,253,
+    255,0,20,245,0,0,36,253,118,0,133,254,137,0,106,0,118,253,255,0,20,240,0,0,196,254,255,0,196,128,128,128,
+    0,36,253,78,0,6,239,0,0,118,253,255,0,20,239,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,118,253,255,0,146,240,137,0,32,0,118,235,255,0,59,128,128,
+    128,248,78,0,6,245,0,0,24,249,78,0,60,248,255,0,20,245,0,0,78,249,255,0,196,128,128,128,128,128,128,128,
+    253,255,0,228,253,196,0,69,254,59,0,36,253,0,0,50,254,59,0,101,253,196,0,241,254,255,0,196,253,255,0,137,
+    253,0,0,235,254,255,0,157,253,0,0,216,254,255,0,177,253,0,0,196,254,255,0,196,128,128,128,128,128,128,128,253,
+    255,0,137,253,0,0,199,254,216,0,148,253,39,0,189,254,216,0,149,253,0,0,196,254,255,0,196,253,255,0,137,249,
+    0,0,98,253,255,0,39,249,0,0,196,254,255,0,196,128,128,128,128,128,128,128,253,255,0,137,249,0,0,91,253,235,
+    0,36,249,0,0,196,254,255,0,196,253,255,0,137,235,0,0,196,254,255,0,196,128,128,128,128,128,128,128,128,0,36,
+    249,78,0,48,244,0,0,60,254,78,0,60,0,118,249,255,0,157,244,0,0,196,254,255,0,196,128,128,128,128,128,128,
+    128,0,118,253,255,0,201,254,196,0,143,253,59,0,9,249,0,0,196,254,255,0,196,0,118,253,255,0,20,254,0,0,
+    98,253,255,0,39,249,0,0,196,254,255,0,196,128,128,128,128,128,128,128,0,118,253,255,0,20,254,0,0,83,253,216,
+    0,66,254,39,0,27,253,0,0,196,254,255,0,196,0,118,253,255,0,20,249,0,0,216,254,255,0,177,253,0,0,196,
+    254,255,0,196,128,128,128,128,128,128,128,0,118,253,255,0,20,249,0,0,199,254,235,0,169,253,20,0,201,254,255,0,
+    196,0,118,253,255,0,20,245,0,0,78,249,255,0,196,128,128,128,128,128,128,128,128,248,0,0,30,249,78,0,54,248,
+    0,248,0,0,98,249,255,0,177,248,0,128,128,128,252,0,0,181,254,196,0,143,249,59,0,101,253,196,0,45,253,0,
+    252,0,0,235,254,255,0,157,249,0,0,78,253,255,0,59,253,0,128,128,0,27,253,59,0,186,254,196,0,121,249,0,
+    0,60,253,196,0,91,254,59,0,45,0,118,253,255,0,20,240,0,0,196,254,255,0,196,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,109,253,235,0,36,254,20,0,12,249,0,0,6,253,20,0,186,254,235,0,181,252,0,
+    0,235,254,255,0,157,249,0,0,78,253,255,0,59,253,0,128,128,128,252,0,0,109,254,118,0,125,249,137,0,131,253,
+    118,0,27,253,0,248,0,0,98,249,255,0,177,248,0,128,128,128,0,36,240,78,0,54,252,0,0,118,240,255,0,177,
+    252,0,128,128,128,0,118,253,255,0,74,245,59,0,101,253,196,0,45,0,118,253,255,0,20,245,0,0,78,253,255,0,
+    59,128,128,128,128,128,128,128,128,128,128,128,0,118,253,255,0,56,245,39,0,94,253,216,0,50,0,118,240,255,0,177,
+    252,0,128,128,128,0,118,253,255,0,110,245,98,0,68,252,0,0,118,253,255,0,20,239,0,128,128,128,128,128,128,128,
+    128,128,128,128,128,248,0,0,30,249,78,0,54,248,0,248,0,0,98,249,255,0,177,248,0,128,128,128,252,0,0,181,
+    254,196,0,143,249,59,0,101,253,196,0,45,253,0,252,0,0,235,254,255,0,157,249,0,0,78,253,255,0,59,253,0,
+    128,128,0,27,253,59,0,186,254,196,0,121,249,0,0,60,253,196,0,91,254,59,0,45,0,118,253,255,0,20,240,0,
+    0,196,254,255,0,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,109,253,235,0,36,254,20,0,12,
+    249,0,0,6,253,20,0,186,254,235,0,181,252,0,0,235,254,255,0,157,249,0,0,78,253,255,0,59,253,0,128,128,
+    128,252,0,0,109,254,118,0,125,249,137,0,131,253,118,0,133,254,137,0,106,248,0,0,98,249,255,0,177,253,0,0,
+    196,254,255,0,196,128,128,128,234,0,0,196,254,255,0,196,128,128,128,234,0,0,106,254,137,0,106,0,36,240,78,0,
+    54,248,0,0,118,240,255,0,177,248,0,128,128,128,0,118,253,255,0,74,245,59,0,101,253,196,0,45,253,0,0,118,
+    253,255,0,20,245,0,0,78,253,255,0,59,253,0,128,128,128,128,128,128,128,128,128,128,128,0,118,253,255,0,56,245,
+    39,0,94,253,216,0,50,253,0,0,118,240,255,0,177,248,0,128,128,128,0,118,253,255,0,110,249,98,0,231,254,255,
+    0,177,248,0,0,118,253,255,0,20,249,0,0,216,254,255,0,177,248,0,128,128,0,118,253,255,0,20,249,0,0,199,
+    254,235,0,169,253,20,0,5,253,0,0,118,253,255,0,20,245,0,0,78,253,255,0,59,253,0,128,128,128,0,118,253,
+    255,0,20,245,0,0,36,253,118,0,133,254,137,0,106,0,118,253,255,0,20,240,0,0,196,254,255,0,196,128,128,128,
+    252,0,0,72,240,78,0,18,253,0,252,0,0,235,240,255,0,59,253,0,128,128,128,0,91,253,196,0,69,240,59,0,
+    164,254,196,0,151,0,118,253,255,0,20,240,0,0,196,254,255,0,196,128,128,0,118,253,255,0,20,240,0,0,151,254,
+    196,0,151,0,118,253,255,0,20,235,0,128,128,128,0,36,253,78,0,169,249,177,0,27,244,0,252,0,0,235,249,255,
+    0,39,244,0,128,128,252,0,0,199,249,216,0,66,249,39,0,9,253,0,243,0,0,216,249,255,0,59,253,0,128,128,
+    128,243,0,0,83,249,98,0,143,254,157,0,121,234,0,0,196,254,255,0,196,128,128,0,9,253,20,0,2,240,0,0,
+    196,254,255,0,196,0,118,253,255,0,20,240,0,0,196,254,255,0,196,128,128,128,0,54,253,118,0,136,240,137,0,122,
+    254,118,0,91,252,0,0,235,240,255,0,59,253,0,128,128,128,226,78,0,60,226,255,0,196,128,128,128,244,59,0,134,
+    253,255,0,89,245,59,0,45,244,0,0,98,253,255,0,39,244,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,36,253,78,0,6,240,0,0,60,254,78,0,60,0,118,
+    253,255,0,20,240,0,0,196,254,255,0,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,0,54,253,118,0,136,240,137,0,122,254,118,0,91,252,0,0,235,240,255,0,59,
+    253,0,128,128,128,253,78,0,42,235,0,0,60,254,78,0,60,253,255,0,137,235,0,0,196,254,255,0,196,128,128,128,
+    128,128,128,128,253,196,0,133,253,59,0,5,245,0,0,18,253,59,0,164,254,196,0,151,253,0,0,118,253,255,0,20,
+    245,0,0,78,253,255,0,59,253,0,128,128,128,128,128,128,128,253,0,0,100,253,216,0,53,254,39,0,24,253,0,0,
+    33,254,39,0,94,253,216,0,50,253,0,248,0,0,235,254,255,0,157,253,0,0,216,254,255,0,177,248,0,128,128,128,
+    128,128,128,128,248,0,0,217,254,235,0,152,253,20,0,202,254,235,0,163,248,0,244,0,0,98,253,255,0,39,244,0,
+    128,128,128,128,128,128,128,128,253,78,0,42,235,0,0,60,254,78,0,60,253,255,0,137,235,0,0,196,254,255,0,196,
+    128,128,128,253,255,0,137,249,0,0,75,253,196,0,30,249,0,0,196,254,255,0,196,253,255,0,137,249,0,0,98,253,
+    255,0,39,249,0,0,196,254,255,0,196,128,128,128,128,128,128,128,253,255,0,137,253,0,0,163,254,177,0,139,253,78,
+    0,161,254,177,0,122,253,0,0,196,254,255,0,196,253,255,0,137,253,0,0,235,254,255,0,157,253,0,0,216,254,255,
+    0,177,253,0,0,196,254,255,0,196,128,128,128,128,128,128,128,253,98,0,125,253,157,0,247,254,255,0,157,253,0,0,
+    216,254,255,0,225,253,157,0,112,254,98,0,75,253,0,0,118,249,255,0,157,253,0,0,216,249,255,0,59,253,0,128,
+    128,253,0,0,118,253,255,0,237,254,235,0,145,253,0,0,199,254,235,0,241,253,255,0,59,253,0,253,0,0,118,253,
+    255,0,20,245,0,0,78,253,255,0,59,253,0,128,128,128,128,128,128,128,128,0,36,253,78,0,6,240,0,0,60,254,
+    78,0,60,0,118,253,255,0,20,240,0,0,196,254,255,0,196,128,128,128,128,128,128,128,0,91,253,196,0,69,254,59,
+    0,36,249,0,0,18,253,59,0,164,254,196,0,151,252,0,0,235,254,255,0,157,249,0,0,78,253,255,0,59,253,0,
+    128,128,128,252,0,0,72,254,78,0,116,249,177,0,146,253,78,0,18,253,0,248,0,0,98,249,255,0,177,248,0,128,
+    128,128,128,128,128,128,252,0,0,145,254,157,0,134,249,98,0,116,253,157,0,36,253,0,252,0,0,235,254,255,0,157,
+    249,0,0,78,253,255,0,59,253,0,128,128,0,9,253,20,0,219,254,235,0,145,249,0,0,72,253,235,0,69,254,20,
+    0,15,0,118,253,255,0,20,240,0,0,196,254,255,0,196,128,128,128,128,128,128,128,128,253,78,0,42,235,0,0,60,
+    254,78,0,60,253,255,0,137,235,0,0,196,254,255,0,196,128,128,128,128,128,128,128,253,196,0,133,253,59,0,5,245,
+    0,0,18,253,59,0,164,254,196,0,151,253,0,0,118,253,255,0,20,245,0,0,78,253,255,0,59,253,0,128,128,128,
+    253,0,0,36,253,78,0,169,254,177,0,109,253,0,0,149,254,177,0,146,253,78,0,18,253,0,248,0,0,235,254,255,
+    0,157,253,0,0,216,254,255,0,177,248,0,128,128,248,0,0,199,254,216,0,148,253,39,0,189,254,216,0,149,248,0,
+    244,0,0,98,253,255,0,39,244,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,36,231,78,0,
+    60,0,118,231,255,0,196,128,128,128,0,27,235,59,0,210,254,255,0,196,234,0,0,196,254,255,0,196,128,128,239,0,
+    0,18,253,59,0,164,254,196,0,151,239,0,0,78,253,255,0,59,253,0,128,128,128,243,0,0,149,254,177,0,146,253,
+    78,0,18,253,0,243,0,0,216,254,255,0,177,248,0,128,128,248,0,0,15,253,39,0,189,254,216,0,149,248,0,248,
+    0,0,98,253,255,0,39,244,0,128,128,128,252,0,0,145,254,157,0,134,253,98,0,15,244,0,252,0,0,235,254,255,
+    0,157,239,0,128,128,0,9,253,20,0,219,254,235,0,145,239,0,0,118,253,255,0,20,235,0,128,128,128,0,118,253,
+    255,0,146,236,137,0,106,0,118,231,255,0,196,128,128,128,0,199,245,216,0,149,0,235,245,255,0,177,128,128,0,235,
+    254,255,0,225,249,177,0,122,0,235,254,255,0,157,248,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,235,254,255,0,202,249,118,0,
+    81,0,235,245,255,0,177,128,128,128,0,18,245,20,0,14,0,100,253,216,0,17,239,0,0,118,253,255,0,20,239,0,
+    128,128,128,128,128,128,128,0,27,253,59,0,186,254,196,0,121,243,0,252,0,0,235,254,255,0,157,243,0,128,128,128,
+    128,128,128,128,252,0,0,72,254,78,0,116,253,177,0,27,248,0,248,0,0,98,253,255,0,39,248,0,128,128,128,128,
+    128,128,128,248,0,0,38,253,98,0,148,254,157,0,109,252,0,243,0,0,216,254,255,0,177,252,0,128,128,128,128,128,
+    128,128,243,0,0,100,254,118,0,124,253,137,0,32,239,0,0,78,253,255,0,59,128,128,128,128,128,128,128,239,0,0,
+    42,253,137,0,32,0,199,245,216,0,149,0,235,245,255,0,177,128,128,0,163,249,177,0,243,254,255,0,177,248,0,0,
+    216,254,255,0,177,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,0,109,249,118,0,234,254,255,0,177,0,235,245,255,0,177,128,128,128,0,
+    18,245,20,0,14,248,0,0,83,253,216,0,33,248,0,248,0,0,98,253,255,0,39,248,0,128,128,128,128,128,128,128,
+    252,0,0,181,254,196,0,143,253,59,0,175,254,196,0,136,252,0,252,0,0,235,254,255,0,157,253,0,0,216,254,255,
+    0,177,252,0,128,128,128,128,128,128,128,0,81,253,177,0,86,254,78,0,48,253,0,0,66,254,78,0,109,253,177,0,
+    41,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,128,128,128,128,128,0,45,253,98,0,8,245,0,0,30,
+    253,98,0,23,226,255,0,196,128,128,128,226,137,0,106,0,199,254,216,0,133,252,0,0,235,254,255,0,157,252,0,128,
+    128,0,163,254,177,0,139,253,78,0,12,253,0,0,98,253,255,0,39,128,128,128,253,0,0,23,253,59,0,9,252,0,
+    0,54,245,59,0,41,252,0,252,0,0,235,245,255,0,177,252,0,128,128,128,252,0,0,72,245,78,0,109,253,177,0,
+    41,239,0,0,78,253,255,0,59,128,128,252,0,0,36,245,39,0,106,253,255,0,59,252,0,0,235,240,255,0,59,128,
+    128,128,0,72,253,157,0,103,245,98,0,146,253,255,0,59,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,
+    128,128,128,128,128,0,54,253,118,0,136,245,137,0,174,253,255,0,59,252,0,0,235,240,255,0,59,128,128,128,252,0,
+    0,54,245,59,0,41,252,0,252,0,0,235,245,255,0,177,252,0,128,128,128,0,81,253,177,0,86,245,78,0,109,253,
+    177,0,41,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,0,118,253,255,0,20,245,0,0,66,253,216,0,
+    50,0,118,253,255,0,20,239,0,128,128,128,128,128,128,128,0,118,253,255,0,20,245,0,0,6,253,20,0,5,0,118,
+    253,255,0,20,245,0,0,78,253,255,0,59,128,128,128,0,54,253,118,0,136,245,137,0,131,253,118,0,27,252,0,0,
+    235,245,255,0,177,252,0,128,128,128,239,0,0,66,253,216,0,50,239,0,0,78,253,255,0,59,128,128,128,128,128,128,
+    128,128,128,128,128,252,0,0,54,245,59,0,119,253,255,0,59,252,0,0,235,240,255,0,59,128,128,128,0,81,253,177,
+    0,86,245,78,0,133,253,255,0,59,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,54,253,118,0,136,245,137,0,174,253,255,0,59,252,0,0,235,240,255,0,59,128,128,
+    128,248,0,0,83,244,216,0,50,248,0,0,98,244,255,0,59,128,128,252,0,0,72,254,78,0,116,244,177,0,41,252,
+    0,0,235,254,255,0,157,243,0,128,128,128,128,128,128,128,0,27,253,59,0,240,254,255,0,180,249,59,0,41,252,0,
+    0,118,240,255,0,177,252,0,128,128,128,0,36,253,78,0,241,254,255,0,187,249,78,0,54,252,0,252,0,0,235,254,
+    255,0,157,243,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,100,253,216,0,17,
+    239,0,0,118,253,255,0,20,239,0,128,128,128,128,128,128,128,128,128,128,128,0,118,253,255,0,74,245,59,0,41,252,
+    0,0,118,240,255,0,177,252,0,128,128,128,0,118,253,255,0,92,245,78,0,109,253,177,0,41,0,118,253,255,0,20,
+    245,0,0,78,253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,253,0,0,
+    83,253,216,0,33,253,0,0,98,253,255,0,39,128,128,253,0,0,68,253,177,0,27,247,0,128,128,128,128,128,128,128,
+    0,54,249,59,0,9,0,235,249,255,0,39,128,128,128,0,72,254,78,0,146,253,255,0,39,253,0,0,98,253,255,0,
+    39,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,243,0,0,183,254,216,0,149,243,0,
+    0,216,254,255,0,177,128,128,243,0,0,149,254,177,0,122,238,0,128,128,128,128,128,128,128,248,0,0,23,249,59,0,
+    41,248,0,0,98,249,255,0,177,128,128,128,248,0,0,30,253,78,0,228,254,255,0,177,243,0,0,216,254,255,0,177,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,54,244,118,0,134,254,
+    137,0,95,0,118,244,255,0,39,253,0,128,128,128,0,9,244,20,0,3,253,0,0,100,253,216,0,17,239,0,0,118,
+    253,255,0,20,239,0,128,128,128,128,128,128,128,128,128,128,128,0,118,253,255,0,20,245,0,0,18,253,59,0,14,0,
+    118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,128,0,118,253,255,0,20,249,0,0,149,254,177,0,146,253,78,
+    0,18,0,118,253,255,0,20,249,0,0,216,254,255,0,177,252,0,128,128,0,118,253,255,0,20,254,0,0,15,253,39,
+    0,189,254,216,0,149,252,0,0,118,253,255,0,20,254,0,0,98,253,255,0,39,248,0,128,128,128,0,118,253,255,0,
+    164,254,157,0,195,253,255,0,39,248,0,0,118,244,255,0,39,248,0,128,128,0,118,253,255,0,237,249,235,0,53,254,
+    20,0,14,252,0,0,118,253,255,0,20,249,0,0,216,254,255,0,177,252,0,128,128,128,0,118,253,255,0,20,249,0,
+    0,100,254,118,0,124,253,137,0,32,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,128,0,199,249,216,0,
+    33,0,235,249,255,0,39,128,128,0,163,254,177,0,207,253,255,0,39,253,0,0,98,253,255,0,39,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,244,59,
+    0,36,253,0,0,50,249,59,0,14,253,0,244,255,0,157,253,0,0,216,249,255,0,59,253,0,128,128,128,253,255,0,
+    174,249,78,0,116,253,177,0,94,249,78,0,154,254,177,0,136,253,255,0,137,249,0,0,98,253,255,0,39,249,0,0,
+    196,254,255,0,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,27,240,59,0,41,
+    252,0,0,118,240,255,0,177,252,0,128,128,128,0,118,253,255,0,92,245,78,0,109,253,177,0,41,0,118,253,255,0,
+    20,245,0,0,78,253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,252,0,
+    0,54,245,59,0,41,252,0,252,0,0,235,245,255,0,177,252,0,128,128,128,0,81,253,177,0,86,245,78,0,109,253,
+    177,0,41,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,0,54,253,118,0,136,245,137,0,131,253,118,0,27,252,0,0,235,245,255,0,177,252,0,128,128,128,0,27,240,59,
+    0,41,252,0,0,118,240,255,0,177,252,0,128,128,128,0,118,253,255,0,92,245,78,0,109,253,177,0,41,0,118,253,
+    255,0,20,245,0,0,78,253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,118,253,255,0,
+    146,245,137,0,131,253,118,0,27,0,118,240,255,0,177,252,0,128,128,128,0,118,253,255,0,20,239,0,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,72,253,157,0,12,239,0,252,0,0,54,240,59,0,14,252,0,0,235,240,255,0,59,
+    128,128,128,0,81,253,177,0,86,245,78,0,133,253,255,0,59,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,54,253,118,0,136,245,137,0,174,253,255,0,59,252,0,0,
+    235,240,255,0,59,128,128,128,239,0,0,78,253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,239,0,0,48,
+    253,157,0,36,0,27,253,59,0,5,254,0,0,23,249,59,0,41,252,0,0,118,253,255,0,20,254,0,0,98,249,255,
+    0,177,252,0,128,128,128,0,118,253,255,0,183,254,177,0,139,249,78,0,109,253,177,0,41,0,118,249,255,0,157,249,
+    0,0,78,253,255,0,59,128,128,0,118,253,255,0,219,254,216,0,133,249,0,0,66,253,216,0,50,0,118,253,255,0,
+    20,239,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,252,0,0,54,240,59,0,14,252,0,0,235,
+    240,255,0,59,128,128,128,0,81,253,177,0,86,240,78,0,18,0,118,253,255,0,20,239,0,128,128,0,100,253,216,0,
+    53,249,39,0,6,248,0,252,0,0,235,249,255,0,39,248,0,128,128,128,252,0,0,91,249,98,0,148,254,157,0,109,
+    252,0,243,0,0,216,254,255,0,177,252,0,128,128,243,0,0,199,254,235,0,169,253,20,0,5,239,0,0,78,253,255,
+    0,59,128,128,128,0,63,240,137,0,131,253,118,0,27,0,118,240,255,0,177,252,0,128,128,128,0,72,254,78,0,48,
+    243,0,0,235,254,255,0,157,243,0,128,128,128,128,128,128,128,0,235,254,255,0,180,244,59,0,14,0,235,240,255,0,
+    59,128,128,128,0,235,254,255,0,187,244,78,0,18,0,235,254,255,0,157,243,0,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,0,109,254,118,0,125,244,137,0,32,253,0,0,98,244,255,0,59,128,128,128,0,27,253,59,0,
+    5,245,0,0,18,253,59,0,14,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,128,128,128,128,128,0,100,
+    253,216,0,53,254,39,0,24,253,0,0,33,254,39,0,94,253,216,0,50,252,0,0,235,254,255,0,157,253,0,0,216,
+    254,255,0,177,252,0,128,128,128,128,128,128,128,252,0,0,217,254,235,0,152,253,20,0,202,254,235,0,163,252,0,248,
+    0,0,98,253,255,0,39,248,0,128,128,128,128,128,128,128,128,253,59,0,32,235,0,0,45,254,59,0,45,253,255,0,
+    137,235,0,0,196,254,255,0,196,128,128,128,253,255,0,137,249,0,0,68,253,177,0,27,249,0,0,196,254,255,0,196,
+    253,255,0,137,249,0,0,98,253,255,0,39,249,0,0,196,254,255,0,196,128,128,128,128,128,128,128,253,255,0,137,253,
+    0,0,145,254,157,0,134,253,98,0,148,254,157,0,109,253,0,0,196,254,255,0,196,253,255,0,137,253,0,0,235,254,
+    255,0,157,253,0,0,216,254,255,0,177,253,0,0,196,254,255,0,196,128,128,253,235,0,136,253,20,0,237,254,255,0,
+    157,253,0,0,216,254,255,0,183,253,20,0,186,254,235,0,181,253,0,0,118,249,255,0,157,253,0,0,216,249,255,0,
+    59,253,0,128,128,128,253,0,0,118,253,255,0,128,254,118,0,72,253,0,0,100,254,118,0,160,253,255,0,59,253,0,
+    253,0,0,118,253,255,0,20,245,0,0,78,253,255,0,59,253,0,128,128,128,0,27,253,59,0,5,245,0,0,18,253,
+    59,0,14,0,118,253,255,0,20,245,0,0,78,253,255,0,59,128,128,128,0,36,253,78,0,169,254,177,0,109,253,0,
+    0,149,254,177,0,146,253,78,0,18,252,0,0,235,254,255,0,157,253,0,0,216,254,255,0,177,252,0,128,128,252,0,
+    0,199,254,216,0,148,253,39,0,189,254,216,0,149,252,0,248,0,0,98,253,255,0,39,248,0,128,128,128,128,128,128,
+    128,252,0,0,18,254,20,0,103,253,235,0,53,254,20,0,14,252,0,252,0,0,235,254,255,0,157,253,0,0,216,254,
+    255,0,177,252,0,128,128,128,0,63,253,137,0,119,254,118,0,72,253,0,0,100,254,118,0,124,253,137,0,32,0,118,
+    253,255,0,20,245,0,0,78,253,255,0,59,128,128,128,0,27,253,59,0,5,245,0,0,18,253,59,0,14,0,118,253,
+    255,0,20,245,0,0,78,253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    0,54,253,118,0,136,245,137,0,174,253,255,0,59,252,0,0,235,240,255,0,59,128,128,128,239,0,0,78,253,255,0,
+    59,128,128,128,128,128,128,128,128,252,0,0,217,245,235,0,169,253,20,0,5,252,0,0,235,245,255,0,177,252,0,128,
+    128,252,0,0,145,245,157,0,109,252,0,0,27,235,59,0,14,0,118,235,255,0,59,128,128,128,0,36,240,78,0,133,
+    253,255,0,59,239,0,0,78,253,255,0,59,128,128,243,0,0,33,254,39,0,94,253,216,0,50,243,0,0,216,254,255,
+    0,177,252,0,128,128,128,248,0,0,60,253,157,0,107,254,98,0,68,252,0,248,0,0,98,253,255,0,39,248,0,128,
+    128,252,0,0,18,254,20,0,103,253,235,0,36,248,0,252,0,0,235,254,255,0,157,243,0,128,128,128,0,63,253,137,
+    0,246,254,255,0,210,244,137,0,32,0,118,235,255,0,59,128,128,128,243,0,0,183,249,216,0,50,243,0,0,216,249,
+    255,0,59,128,128,248,0,0,30,253,78,0,161,249,177,0,41,248,0,0,98,253,255,0,39,248,0,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,0,18,249,39,0,107,253,216,0,33,248,0,0,118,249,255,0,157,243,0,128,
+    128,128,0,45,249,98,0,121,253,157,0,24,248,0,248,0,0,98,253,255,0,39,248,0,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,248,0,0,53,253,137,0,121,249,118,0,27,243,0,0,216,249,255,0,59,128,128,128,243,
+    0,0,17,249,20,0,5,0,83,253,216,0,33,0,98,253,255,0,39,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,0,8,253,20,0,3,0,100,249,216,0,133,243,0,0,118,249,255,0,157,243,0,128,128,0,81,249,177,0,
+    139,253,78,0,12,248,0,248,0,0,98,253,255,0,39,248,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,248,0,0,83,253,216,0,66,249,39,0,9,243,0,0,216,249,255,0,59,128,128,128,248,0,0,60,253,157,0,107,
+    249,98,0,23,248,0,0,98,253,255,0,39,248,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,54,
+    249,118,0,125,253,137,0,21,248,0,0,118,249,255,0,157,243,0,128,128,128,0,9,249,20,0,12,243,0,253,0,0,
+    81,244,177,0,27,249,0,0,136,254,177,0,136,253,0,0,118,244,255,0,39,249,0,0,196,254,255,0,196,128,128,253,
+    39,0,121,249,216,0,231,253,255,0,72,249,39,0,175,254,216,0,166,253,255,0,137,249,0,0,98,244,255,0,59,253,
+    0,128,128,128,253,98,0,53,249,0,0,38,244,98,0,23,253,0,0,30,238,196,0,45,248,0,0,39,238,255,0,59,
+    248,0,128,128,128,0,39,253,255,0,183,243,20,0,186,253,235,0,18,253,0,0,39,253,255,0,177,243,0,0,196,253,
+    255,0,20,253,0,128,128,0,39,253,255,0,177,243,0,0,181,253,235,0,36,254,20,0,18,0,39,253,255,0,177,238,
+    0,0,235,254,255,0,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,39,253,255,0,177,243,
+    0,0,136,253,177,0,86,254,78,0,72,0,39,253,255,0,177,243,0,0,196,253,255,0,20,253,0,128,128,128,0,39,
+    253,255,0,243,243,216,0,80,253,39,0,3,253,0,0,39,238,255,0,59,248,0,128,128,128,252,0,0,6,243,20,0,
+    5,252,0,252,0,0,78,243,255,0,59,252,0,128,128,128,0,9,253,59,0,101,243,196,0,91,253,59,0,5,0,39,
+    253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,0,39,253,255,0,207,243,98,0,219,253,255,0,20,0,39,233,
+    255,0,20,128,128,128,0,39,253,255,0,213,238,118,0,9,0,39,253,255,0,177,237,0,128,128,128,0,39,253,255,0,
+    177,243,0,0,136,253,177,0,14,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,0,6,253,39,0,94,
+    243,216,0,80,253,39,0,3,252,0,0,78,243,255,0,59,252,0,128,128,128,0,24,253,157,0,109,237,0,0,39,253,
+    255,0,177,237,0,128,128,128,128,128,128,128,128,128,128,128,128,0,39,253,255,0,183,243,20,0,5,252,0,0,39,238,
+    255,0,59,252,0,128,128,128,0,39,253,255,0,237,243,196,0,91,253,59,0,5,0,39,253,255,0,177,243,0,0,196,
+    253,255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,39,253,255,0,243,243,216,0,80,
+    253,39,0,3,0,39,238,255,0,59,252,0,128,128,128,0,3,253,20,0,14,243,0,0,15,253,20,0,2,0,39,253,
+    255,0,177,243,0,0,196,253,255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,0,6,253,39,0,94,243,216,0,246,253,255,0,20,252,0,0,78,238,255,0,20,128,128,128,252,0,0,6,238,
+    20,0,2,252,0,0,78,238,255,0,20,128,128,128,0,9,253,59,0,101,243,196,0,241,253,255,0,20,0,39,253,255,
+    0,177,243,0,0,196,253,255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,6,253,39,
+    0,94,243,216,0,246,253,255,0,20,252,0,0,78,238,255,0,20,128,128,128,237,0,0,196,253,255,0,20,128,128,128,
+    128,128,128,128,128,252,0,0,24,243,78,0,154,253,177,0,14,252,0,0,78,243,255,0,59,252,0,128,128,128,252,0,
+    0,42,243,137,0,32,252,0,0,91,253,196,0,75,0,118,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,36,253,78,0,30,251,0,128,128,128,0,100,253,216,0,83,
+    0,118,253,255,0,98,128,128,128,0,48,253,157,0,84,253,0,0,97,253,157,0,36,0,78,253,255,0,137,253,0,0,
+    157,253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,0,72,253,235,0,127,253,0,0,145,253,235,0,54,243,
+    0,0,91,253,196,0,75,253,0,0,151,253,196,0,15,253,0,243,0,0,118,253,255,0,98,253,0,0,196,253,255,0,
+    20,253,0,128,128,128,128,128,128,128,253,0,0,3,248,20,0,128,253,255,0,110,253,20,0,201,253,255,0,38,254,20,
+    0,18,253,0,0,39,229,255,0,235,128,128,128,253,0,0,30,253,196,0,214,253,255,0,228,253,196,0,232,253,255,0,
+    210,249,196,0,181,248,0,0,78,253,255,0,137,253,0,0,157,253,255,0,59,248,0,128,128,128,128,128,128,128,128,248,
+    137,0,174,253,255,0,201,253,137,0,210,253,255,0,164,253,137,0,11,253,0,228,255,0,20,253,0,128,128,128,253,78,
+    0,106,253,255,0,201,253,78,0,160,253,255,0,146,248,78,0,6,253,0,253,0,0,39,253,255,0,177,253,0,0,118,
+    253,255,0,98,243,0,128,128,128,128,128,128,128,128,247,0,0,91,253,196,0,75,247,0,247,0,0,118,253,255,0,98,
+    247,0,128,128,128,252,0,0,72,253,235,0,244,253,255,0,243,248,235,0,18,252,0,0,78,238,255,0,20,128,128,0,
+    3,253,20,0,86,253,235,0,244,253,255,0,243,248,235,0,18,0,39,253,255,0,177,253,0,0,118,253,255,0,98,247,
+    0,128,128,128,128,128,128,128,128,0,24,253,157,0,139,253,98,0,171,253,255,0,158,253,98,0,23,252,0,252,0,0,
+    78,243,255,0,59,252,0,128,128,128,252,0,0,36,253,118,0,181,253,255,0,171,253,118,0,133,253,137,0,11,247,0,
+    0,118,253,255,0,98,253,0,0,196,253,255,0,20,128,128,128,128,128,128,128,128,0,33,248,216,0,234,253,255,0,231,
+    253,216,0,80,253,39,0,3,0,39,238,255,0,59,252,0,128,128,128,247,0,0,118,253,255,0,98,247,0,128,128,128,
+    247,0,0,100,253,216,0,83,247,0,253,0,0,30,253,196,0,136,243,0,0,151,253,196,0,15,253,0,253,0,0,39,
+    253,255,0,177,243,0,0,196,253,255,0,20,253,0,128,128,128,253,235,0,202,253,20,0,86,253,235,0,127,253,0,0,
+    145,253,235,0,69,253,20,0,2,253,0,253,255,0,216,253,0,0,78,253,255,0,137,253,0,0,157,253,255,0,59,248,
+    0,128,128,128,128,128,128,128,253,196,0,175,253,59,0,101,253,196,0,133,253,59,0,143,253,196,0,45,248,0,253,0,
+    0,39,253,255,0,177,253,0,0,118,253,255,0,98,243,0,128,128,128,253,0,0,24,253,157,0,109,253,0,0,118,253,
+    255,0,98,253,0,0,75,253,98,0,8,253,0,243,0,0,118,253,255,0,98,253,0,0,196,253,255,0,20,253,0,128,
+    128,128,248,0,0,42,253,137,0,128,253,118,0,130,253,137,0,122,253,118,0,136,254,137,0,127,248,0,0,78,253,255,
+    0,137,253,0,0,157,253,255,0,59,253,0,0,235,254,255,0,235,128,128,128,128,128,128,128,128,253,0,0,33,253,216,
+    0,161,253,39,0,21,253,0,0,24,253,39,0,175,253,216,0,53,254,39,0,36,253,0,0,39,253,255,0,177,243,0,
+    0,196,253,255,0,20,253,0,128,128,128,252,0,0,60,248,196,0,75,243,0,252,0,0,78,248,255,0,98,243,0,128,
+    128,128,0,36,253,235,0,169,248,20,0,152,253,235,0,54,248,0,0,39,253,255,0,177,248,0,0,157,253,255,0,59,
+    248,0,128,128,128,128,128,128,128,0,30,253,196,0,154,248,59,0,143,253,196,0,45,253,0,0,54,254,59,0,54,252,
+    0,0,78,248,255,0,98,248,0,0,235,254,255,0,235,128,128,128,0,15,253,98,0,116,248,157,0,121,253,98,0,23,
+    253,0,0,235,254,255,0,235,0,39,253,255,0,177,248,0,0,157,253,255,0,59,253,0,0,235,254,255,0,235,128,128,
+    128,0,39,253,255,0,177,248,0,0,72,253,118,0,133,253,137,0,119,254,118,0,109,0,39,253,255,0,177,243,0,0,
+    196,253,255,0,20,253,0,128,128,128,128,128,128,128,128,0,6,253,39,0,94,243,216,0,80,253,39,0,202,254,216,0,
+    199,252,0,0,78,243,255,0,59,253,0,0,235,254,255,0,235,128,128,128,0,72,253,157,0,60,0,118,253,255,0,98,
+    128,128,128,128,128,128,128,128,128,128,128,128,0,109,253,235,0,91,247,0,0,97,253,157,0,36,247,0,0,157,253,255,
+    0,59,128,128,128,252,0,0,91,253,196,0,112,253,59,0,14,252,0,0,118,253,255,0,98,252,0,128,128,128,128,128,
+    128,128,0,6,253,20,0,119,253,235,0,91,252,0,0,78,253,255,0,137,247,0,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,0,12,253,39,0,121,253,216,0,83,252,0,252,0,0,118,253,255,0,
+    98,252,0,128,128,128,128,128,128,128,252,0,0,100,253,216,0,107,253,39,0,9,247,0,0,157,253,255,0,59,128,128,
+    128,247,0,0,109,253,177,0,41,0,48,253,157,0,84,247,0,0,78,253,255,0,137,247,0,128,128,128,0,18,253,59,
+    0,122,253,196,0,75,252,0,252,0,0,118,253,255,0,98,252,0,128,128,128,128,128,128,128,252,0,0,109,253,235,0,
+    103,253,20,0,5,247,0,0,157,253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,252,0,0,100,253,216,0,107,253,39,0,9,252,0,0,118,253,255,0,98,252,0,128,128,128,128,128,128,
+    128,0,12,253,39,0,121,253,216,0,83,252,0,0,78,253,255,0,137,247,0,128,128,128,0,54,253,177,0,95,247,0,
+    247,0,0,9,253,20,0,8,247,0,247,0,0,118,253,255,0,98,247,0,128,128,128,0,9,253,59,0,41,253,0,0,
+    118,253,255,0,98,253,0,0,45,253,59,0,5,0,39,253,255,0,177,253,0,0,118,253,255,0,98,253,0,0,196,253,
+    255,0,20,128,128,128,0,24,253,157,0,139,253,98,0,171,253,255,0,158,253,98,0,143,253,157,0,12,252,0,0,78,
+    243,255,0,59,252,0,128,128,128,0,21,253,137,0,131,253,118,0,181,253,255,0,171,253,118,0,133,253,137,0,11,0,
+    39,253,255,0,177,253,0,0,118,253,255,0,98,253,0,0,196,253,255,0,20,128,128,128,0,12,253,78,0,54,253,0,
+    0,118,253,255,0,98,253,0,0,60,253,78,0,6,247,0,0,118,253,255,0,98,247,0,128,128,128,247,0,0,18,253,
+    39,0,15,247,0,247,0,0,9,253,20,0,8,247,0,247,0,0,118,253,255,0,98,247,0,128,128,128,128,128,128,128,
+    128,0,15,248,98,0,171,253,255,0,158,248,98,0,8,0,39,233,255,0,20,128,128,128,0,18,248,118,0,181,253,255,
+    0,171,248,118,0,9,247,0,0,118,253,255,0,98,247,0,128,128,128,128,128,128,128,128,247,0,0,18,253,39,0,15,
+    247,0,252,0,0,54,253,177,0,95,252,0,0,78,253,255,0,137,128,128,128,128,128,128,128,128,128,128,128,128,0,6,
+    253,39,0,94,253,216,0,116,0,39,253,255,0,177,252,0,128,128,128,0,27,253,177,0,122,252,0,0,15,233,98,0,
+    8,0,39,233,255,0,20,128,128,128,0,18,233,118,0,9,0,54,253,177,0,95,0,78,253,255,0,137,128,128,128,128,
+    128,128,128,128,237,0,0,121,253,157,0,12,237,0,0,196,253,255,0,20,128,128,128,128,128,128,128,128,242,0,0,145,
+    253,235,0,69,253,20,0,2,242,0,0,157,253,255,0,59,252,0,128,128,128,128,128,128,128,247,0,0,27,253,59,0,
+    143,253,196,0,45,252,0,247,0,0,118,253,255,0,98,247,0,128,128,128,128,128,128,128,128,252,0,0,42,253,137,0,
+    128,253,118,0,45,247,0,252,0,0,78,253,255,0,137,242,0,128,128,128,128,128,128,128,128,0,33,253,216,0,161,253,
+    39,0,21,242,0,0,39,253,255,0,177,237,0,128,128,128,128,128,128,128,0,33,253,216,0,149,237,0,252,0,0,60,
+    243,196,0,45,252,0,252,0,0,78,243,255,0,59,252,0,128,128,128,0,36,253,235,0,169,243,20,0,186,253,235,0,
+    18,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,128,128,128,128,0,39,253,255,0,177,253,0,0,27,
+    253,59,0,23,253,0,0,196,253,255,0,20,0,39,253,255,0,177,253,0,0,118,253,255,0,98,253,0,0,196,253,255,
+    0,20,128,128,128,128,128,128,128,128,0,39,253,255,0,177,253,0,0,54,253,118,0,45,253,0,0,196,253,255,0,20,
+    0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,128,128,128,128,128,0,6,253,39,0,94,243,216,0,80,
+    253,39,0,3,252,0,0,78,243,255,0,59,252,0,128,128,128,247,0,0,91,253,196,0,75,247,0,247,0,0,118,253,
+    255,0,98,247,0,128,128,128,252,0,0,72,253,235,0,244,253,255,0,98,247,0,252,0,0,78,248,255,0,98,247,0,
+    128,128,0,3,253,20,0,86,253,235,0,244,253,255,0,98,247,0,0,39,253,255,0,177,253,0,0,118,253,255,0,98,
+    247,0,128,128,128,0,30,253,196,0,136,253,0,0,118,253,255,0,98,247,0,247,0,0,118,253,255,0,98,247,0,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,33,248,216,0,234,253,255,0,231,248,216,0,17,0,
+    39,233,255,0,20,128,128,128,252,0,0,60,243,196,0,45,252,0,252,0,0,78,243,255,0,59,252,0,128,128,128,0,
+    36,253,235,0,169,243,20,0,186,253,235,0,18,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,0,36,253,
+    235,0,163,243,0,0,196,253,255,0,20,237,0,0,196,253,255,0,20,128,128,128,242,0,0,36,253,59,0,164,253,196,
+    0,15,242,0,0,157,253,255,0,59,252,0,128,128,128,247,0,0,45,253,98,0,134,253,157,0,36,252,0,247,0,0,
+    118,253,255,0,98,247,0,128,128,128,252,0,0,42,253,137,0,128,253,118,0,45,247,0,252,0,0,78,253,255,0,137,
+    242,0,128,128,128,0,27,253,177,0,146,253,78,0,42,242,0,0,39,253,255,0,177,237,0,128,128,128,0,39,253,255,
+    0,243,238,216,0,17,0,39,233,255,0,20,128,128,128,252,0,0,60,243,196,0,45,252,0,252,0,0,78,243,255,0,
+    59,252,0,128,128,128,0,36,253,235,0,169,243,20,0,186,253,235,0,18,0,39,253,255,0,177,243,0,0,196,253,255,
+    0,20,128,128,0,36,253,235,0,163,243,0,0,196,253,255,0,20,237,0,0,196,253,255,0,20,128,128,128,247,0,0,
+    27,248,59,0,164,253,196,0,15,247,0,0,118,248,255,0,59,252,0,128,128,128,247,0,0,72,248,157,0,112,253,98,
+    0,8,237,0,0,196,253,255,0,20,128,128,128,128,128,128,128,128,0,27,253,177,0,122,243,0,0,196,253,255,0,20,
+    0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,0,6,253,39,0,94,243,216,0,80,253,39,0,3,252,
+    0,0,78,243,255,0,59,252,0,128,128,128,237,0,0,151,253,196,0,15,253,0,237,0,0,196,253,255,0,20,253,0,
+    128,128,128,242,0,0,145,253,235,0,250,253,255,0,20,253,0,242,0,0,157,248,255,0,20,253,0,128,128,247,0,0,
+    9,253,20,0,152,253,235,0,250,253,255,0,20,253,0,247,0,0,118,253,255,0,98,253,0,0,196,253,255,0,20,253,
+    0,128,128,128,252,0,0,18,253,59,0,122,253,196,0,75,253,0,0,196,253,255,0,20,253,0,252,0,0,78,253,255,
+    0,137,248,0,0,196,253,255,0,20,253,0,128,128,128,0,15,253,98,0,116,253,157,0,84,248,0,0,196,253,255,0,
+    20,253,0,0,39,253,255,0,177,243,0,0,196,253,255,0,20,253,0,128,128,128,0,39,253,255,0,219,243,137,0,228,
+    253,255,0,146,254,137,0,127,0,39,229,255,0,235,128,128,128,0,12,238,78,0,214,253,255,0,92,254,78,0,72,237,
+    0,0,196,253,255,0,20,253,0,128,128,128,128,128,128,128,128,0,30,233,196,0,15,0,39,233,255,0,20,128,128,128,
+    0,39,253,255,0,183,238,20,0,2,0,39,253,255,0,177,237,0,128,128,128,128,128,128,128,0,39,253,255,0,195,243,
+    59,0,14,252,0,0,39,238,255,0,59,252,0,128,128,128,0,24,238,157,0,112,253,98,0,8,237,0,0,196,253,255,
+    0,20,128,128,128,128,128,128,128,128,0,27,253,177,0,122,243,0,0,196,253,255,0,20,0,39,253,255,0,177,243,0,
+    0,196,253,255,0,20,128,128,128,0,6,253,39,0,94,243,216,0,80,253,39,0,3,252,0,0,78,243,255,0,59,252,
+    0,128,128,128,247,0,0,91,248,196,0,45,252,0,247,0,0,118,248,255,0,59,252,0,128,128,128,252,0,0,72,253,
+    235,0,136,248,20,0,5,252,0,252,0,0,78,253,255,0,137,242,0,128,128,0,3,253,20,0,86,253,235,0,127,242,
+    0,0,39,253,255,0,177,237,0,128,128,128,0,39,253,255,0,195,243,59,0,14,252,0,0,39,238,255,0,59,252,0,
+    128,128,128,0,39,253,255,0,225,243,157,0,112,253,98,0,8,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,0,6,253,39,0,94,243,216,0,80,253,39,0,3,252,0,0,78,243,255,
+    0,59,252,0,128,128,128,0,30,233,196,0,15,0,39,233,255,0,20,128,128,128,0,3,238,20,0,201,253,255,0,20,
+    237,0,0,196,253,255,0,20,128,128,242,0,0,12,253,20,0,186,253,235,0,18,242,0,0,157,253,255,0,59,252,0,
+    128,128,128,128,128,128,128,128,247,0,0,45,253,98,0,134,253,157,0,36,252,0,247,0,0,118,253,255,0,98,247,0,
+    128,128,128,128,128,128,128,128,252,0,0,54,253,177,0,131,253,78,0,30,247,0,252,0,0,78,253,255,0,137,242,0,
+    128,128,128,128,128,128,128,128,252,0,0,60,243,196,0,45,252,0,252,0,0,78,243,255,0,59,252,0,128,128,128,0,
+    36,253,235,0,169,243,20,0,186,253,235,0,18,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,128,128,
+    128,128,0,30,253,196,0,154,243,59,0,164,253,196,0,15,252,0,0,78,243,255,0,59,252,0,128,128,128,0,15,253,
+    98,0,116,243,157,0,112,253,98,0,8,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,0,6,253,39,0,94,243,216,0,80,253,39,0,3,252,0,0,78,243,255,0,59,252,0,128,128,
+    128,252,0,0,60,243,196,0,45,252,0,252,0,0,78,243,255,0,59,252,0,128,128,128,0,36,253,235,0,169,243,20,
+    0,186,253,235,0,18,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,
+    0,24,253,157,0,139,243,98,0,219,253,255,0,20,252,0,0,78,238,255,0,20,128,128,128,252,0,0,36,243,118,0,
+    223,253,255,0,20,237,0,0,196,253,255,0,20,128,128,128,242,0,0,109,253,177,0,101,253,78,0,6,242,0,0,157,
+    253,255,0,59,252,0,128,128,128,252,0,0,66,248,216,0,107,253,39,0,9,252,0,252,0,0,78,248,255,0,98,247,
+    0,128,128,128,0,9,253,20,0,8,0,118,253,255,0,98,128,128,128,128,128,128,128,128,0,72,253,157,0,60,251,0,
+    128,128,128,128,128,128,128,128,0,81,253,177,0,68,0,118,253,255,0,98,128,128,128,128,128,128,128,128,252,0,0,6,
+    253,20,0,11,252,0,0,78,253,255,0,137,128,128,128,128,128,128,128,128,252,0,0,48,253,157,0,84,246,0,128,128,
+    128,128,128,128,128,128,252,0,0,54,253,177,0,95,252,0,0,78,253,255,0,137,128,128,128,128,128,128,128,128,128,128,
+    128,128,0,6,253,39,0,94,253,216,0,116,0,39,253,255,0,177,252,0,128,128,128,0,27,253,177,0,122,252,0,238,
+    0,0,12,248,20,0,2,238,0,0,157,248,255,0,20,128,128,128,248,0,0,18,248,59,0,143,248,196,0,15,248,0,
+    0,78,248,255,0,98,247,0,128,128,128,248,98,0,116,248,157,0,60,247,0,248,255,0,177,237,0,128,128,128,248,118,
+    0,124,248,137,0,53,247,0,248,0,0,78,248,255,0,98,247,0,128,128,128,248,0,0,24,248,78,0,139,248,177,0,
+    14,238,0,0,157,248,255,0,20,128,128,128,238,0,0,24,248,39,0,3,0,9,229,59,0,54,0,39,229,255,0,235,
+    128,128,128,0,24,229,157,0,145,227,0,128,128,128,0,21,229,137,0,127,0,39,229,255,0,235,128,128,128,0,12,229,
+    78,0,72,0,3,248,20,0,11,238,0,0,39,248,255,0,137,238,0,128,128,128,0,30,248,196,0,133,248,59,0,14,
+    248,0,247,0,0,118,248,255,0,59,248,0,128,128,128,247,0,0,72,248,157,0,112,249,98,0,91,237,0,0,196,249,
+    255,0,235,128,128,128,247,0,0,63,248,137,0,122,249,118,0,109,247,0,0,118,248,255,0,59,248,0,128,128,128,0,
+    27,248,177,0,131,248,78,0,18,248,0,0,39,248,255,0,137,238,0,128,128,128,0,6,248,39,0,21,238,0,252,0,
+    0,60,243,196,0,45,252,0,252,0,0,78,243,255,0,59,252,0,128,128,128,0,36,253,235,0,169,243,20,0,186,253,
+    235,0,18,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,0,36,253,235,0,163,243,0,0,196,253,255,0,
+    20,237,0,0,196,253,255,0,20,128,128,128,242,0,0,36,253,59,0,164,253,196,0,15,242,0,0,157,253,255,0,59,
+    252,0,128,128,128,247,0,0,45,253,98,0,134,253,157,0,36,252,0,247,0,0,118,253,255,0,98,247,0,128,128,128,
+    128,128,128,128,128,247,0,0,36,253,78,0,30,247,0,231,0,128,128,128,247,0,0,100,253,216,0,83,247,0,247,0,
+    0,118,253,255,0,98,247,0,128,128,128,248,0,0,60,243,196,0,45,248,0,248,0,0,78,243,255,0,59,248,0,128,
+    128,128,253,0,0,36,253,235,0,169,243,20,0,186,253,235,0,18,253,0,253,0,0,39,253,255,0,177,243,0,0,196,
+    253,255,0,20,253,0,128,128,253,20,0,53,253,235,0,163,253,0,0,9,248,20,0,186,253,235,0,36,254,20,0,18,
+    253,255,0,216,248,0,0,118,248,255,0,59,253,0,0,235,254,255,0,235,128,128,128,253,255,0,216,253,0,0,18,253,
+    59,0,122,253,196,0,232,253,255,0,59,253,0,0,235,254,255,0,235,253,255,0,216,253,0,0,78,253,255,0,137,253,
+    0,0,157,253,255,0,59,253,0,0,235,254,255,0,235,128,128,128,128,128,128,128,128,253,255,0,216,253,0,0,36,253,
+    118,0,127,253,137,0,210,253,255,0,164,253,137,0,119,254,118,0,109,253,255,0,216,248,0,0,118,243,255,0,20,253,
+    0,128,128,128,253,78,0,94,253,177,0,122,253,0,0,36,243,78,0,6,253,0,253,0,0,39,253,255,0,177,233,0,
+    128,128,128,253,0,0,6,253,39,0,94,238,216,0,17,253,0,248,0,0,78,238,255,0,20,253,0,128,128,128,247,0,
+    0,91,248,196,0,45,248,0,247,0,0,118,248,255,0,59,248,0,128,128,128,128,128,128,128,252,0,0,6,253,20,0,
+    119,248,235,0,69,253,20,0,2,253,0,252,0,0,78,253,255,0,137,248,0,0,196,253,255,0,20,253,0,128,128,128,
+    128,128,128,128,128,252,0,0,78,253,255,0,183,248,98,0,219,253,255,0,20,253,0,252,0,0,78,238,255,0,20,253,
+    0,128,128,128,0,21,253,137,0,131,238,118,0,136,254,137,0,127,0,39,253,255,0,177,238,0,0,235,254,255,0,235,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,0,30,238,196,0,45,248,0,0,39,238,255,0,59,248,0,128,128,128,
+    0,39,253,255,0,183,243,20,0,186,253,235,0,18,253,0,0,39,253,255,0,177,243,0,0,196,253,255,0,20,253,0,
+    128,128,128,128,128,128,128,0,39,253,255,0,195,243,59,0,210,253,255,0,20,253,0,0,39,233,255,0,20,253,0,128,
+    128,128,0,39,253,255,0,225,238,157,0,103,254,98,0,91,0,39,253,255,0,177,238,0,0,235,254,255,0,235,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,0,39,253,255,0,243,238,216,0,53,254,39,0,36,0,39,233,255,0,20,253,
+    0,128,128,128,247,0,0,91,243,196,0,15,253,0,247,0,0,118,243,255,0,20,253,0,128,128,128,252,0,0,72,253,
+    235,0,136,243,20,0,219,254,235,0,217,252,0,0,78,253,255,0,137,243,0,0,235,254,255,0,235,128,128,0,3,253,
+    20,0,86,253,235,0,127,243,0,0,217,254,235,0,217,0,39,253,255,0,177,233,0,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,0,12,253,78,0,109,253,177,0,95,243,0,0,163,254,177,0,163,252,0,0,78,253,
+    255,0,137,243,0,0,235,254,255,0,235,128,128,128,252,0,0,12,253,39,0,121,243,216,0,53,254,39,0,36,247,0,
+    0,118,243,255,0,20,253,0,128,128,128,0,30,233,196,0,15,0,39,233,255,0,20,128,128,128,0,39,253,255,0,183,
+    238,20,0,2,0,39,253,255,0,177,237,0,128,128,128,128,128,128,128,0,39,253,255,0,195,243,59,0,14,252,0,0,
+    39,238,255,0,59,252,0,128,128,128,0,39,253,255,0,225,243,157,0,36,252,0,0,39,253,255,0,177,237,0,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,0,39,253,255,0,243,238,216,0,17,0,39,233,255,0,20,128,128,128,0,30,
+    233,196,0,15,0,39,233,255,0,20,128,128,128,0,39,253,255,0,183,238,20,0,2,0,39,253,255,0,177,237,0,128,
+    128,128,128,128,128,128,0,39,253,255,0,195,243,59,0,14,252,0,0,39,238,255,0,59,252,0,128,128,128,0,39,253,
+    255,0,225,243,157,0,36,252,0,0,39,253,255,0,177,237,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,247,0,0,91,243,196,0,15,253,0,247,0,0,118,243,255,0,20,253,0,128,128,128,252,0,0,72,253,235,
+    0,136,243,20,0,219,254,235,0,217,252,0,0,78,253,255,0,137,243,0,0,235,254,255,0,235,128,128,0,3,253,20,
+    0,86,253,235,0,127,243,0,0,217,254,235,0,217,0,39,253,255,0,177,233,0,128,128,128,128,128,128,128,128,0,39,
+    253,255,0,177,248,0,0,60,244,98,0,91,0,39,253,255,0,177,248,0,0,157,244,255,0,235,128,128,128,0,39,253,
+    255,0,177,248,0,0,72,248,118,0,244,254,255,0,235,0,39,253,255,0,177,238,0,0,235,254,255,0,235,128,128,128,
+    0,12,253,78,0,109,253,177,0,95,243,0,0,235,254,255,0,235,252,0,0,78,253,255,0,137,243,0,0,235,254,255,
+    0,235,128,128,128,252,0,0,12,253,39,0,121,243,216,0,53,254,39,0,36,247,0,0,118,243,255,0,20,253,0,128,
+    128,128,0,30,253,196,0,136,238,0,0,181,254,196,0,181,0,39,253,255,0,177,238,0,0,235,254,255,0,235,128,128,
+    128,128,128,128,128,128,128,128,128,128,0,39,253,255,0,195,238,59,0,240,254,255,0,235,0,39,229,255,0,235,128,128,
+    128,0,39,253,255,0,225,238,157,0,247,254,255,0,235,0,39,253,255,0,177,238,0,0,235,254,255,0,235,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,60,243,196,0,45,0,78,243,255,0,59,128,128,128,0,6,
+    253,20,0,128,253,255,0,110,253,20,0,5,252,0,0,118,253,255,0,98,252,0,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,66,253,216,0,234,253,255,0,231,253,216,0,50,0,
+    78,243,255,0,59,128,128,128,252,0,0,60,243,196,0,45,252,0,0,78,243,255,0,59,128,128,128,252,0,0,6,248,
+    20,0,164,253,255,0,59,242,0,0,157,253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,0,33,243,216,0,107,253,39,0,9,0,39,243,255,0,98,252,0,128,128,128,0,
+    30,253,196,0,136,238,0,0,181,254,196,0,181,0,39,253,255,0,177,238,0,0,235,254,255,0,235,128,128,128,0,39,
+    253,255,0,177,243,0,0,181,253,235,0,36,254,20,0,18,0,39,253,255,0,177,243,0,0,196,253,255,0,20,253,0,
+    128,128,0,39,253,255,0,177,248,0,0,12,253,20,0,186,253,235,0,18,253,0,0,39,253,255,0,177,248,0,0,157,
+    253,255,0,59,248,0,128,128,128,0,39,253,255,0,177,253,0,0,27,253,59,0,143,253,196,0,45,248,0,0,39,253,
+    255,0,177,253,0,0,118,253,255,0,98,243,0,128,128,128,0,39,253,255,0,207,253,98,0,171,253,255,0,98,243,0,
+    0,39,243,255,0,98,243,0,128,128,128,0,39,253,255,0,213,248,118,0,130,253,137,0,32,248,0,0,39,253,255,0,
+    177,248,0,0,157,253,255,0,59,248,0,128,128,128,0,39,253,255,0,177,248,0,0,48,253,78,0,154,253,177,0,14,
+    253,0,0,39,253,255,0,177,243,0,0,196,253,255,0,20,253,0,128,128,128,0,39,253,255,0,177,243,0,0,30,253,
+    39,0,202,254,216,0,199,0,39,253,255,0,177,238,0,0,235,254,255,0,235,128,128,128,0,30,253,196,0,136,237,0,
+    0,39,253,255,0,177,237,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,39,253,255,0,243,238,216,0,17,0,39,233,255,0,20,128,128,128,248,196,0,136,243,
+    0,0,151,249,196,0,181,248,255,0,177,243,0,0,196,249,255,0,235,128,128,128,128,128,128,128,253,255,0,252,253,235,
+    0,169,253,20,0,11,253,0,0,12,253,20,0,186,253,235,0,253,254,255,0,235,253,255,0,216,253,0,0,78,253,255,
+    0,137,253,0,0,157,253,255,0,59,253,0,0,235,254,255,0,235,128,128,128,128,128,128,128,128,253,255,0,216,253,0,
+    0,48,253,157,0,130,253,98,0,134,253,157,0,36,253,0,0,235,254,255,0,235,253,255,0,216,248,0,0,118,253,255,
+    0,98,248,0,0,235,254,255,0,235,128,128,128,128,128,128,128,128,253,255,0,216,248,0,0,36,253,78,0,30,248,0,
+    0,235,254,255,0,235,253,255,0,216,233,0,0,235,254,255,0,235,128,128,128,128,128,128,128,128,0,30,248,196,0,106,
+    243,0,0,181,254,196,0,181,0,39,248,255,0,137,243,0,0,235,254,255,0,235,128,128,128,128,128,128,128,0,39,253,
+    255,0,249,253,235,0,136,253,20,0,8,248,0,0,235,254,255,0,235,0,39,253,255,0,177,253,0,0,118,253,255,0,
+    98,248,0,0,235,254,255,0,235,128,128,128,128,128,128,128,128,0,39,253,255,0,177,253,0,0,72,253,157,0,121,253,
+    98,0,23,253,0,0,235,254,255,0,235,0,39,253,255,0,177,248,0,0,157,253,255,0,59,253,0,0,235,254,255,0,
+    235,128,128,128,128,128,128,128,128,0,39,253,255,0,177,248,0,0,48,253,78,0,154,253,177,0,249,254,255,0,235,0,
+    39,253,255,0,177,243,0,0,196,249,255,0,235,128,128,128,128,128,128,128,128,247,0,0,91,248,196,0,45,248,0,247,
+    0,0,118,248,255,0,59,248,0,128,128,128,252,0,0,72,253,235,0,136,248,20,0,186,253,235,0,18,253,0,252,0,
+    0,78,253,255,0,137,248,0,0,196,253,255,0,20,253,0,128,128,0,3,253,20,0,86,253,235,0,127,248,0,0,181,
+    253,235,0,36,254,20,0,18,0,39,253,255,0,177,238,0,0,235,254,255,0,235,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,12,253,78,0,109,253,177,0,95,248,0,0,136,253,177,0,86,254,78,0,72,252,0,
+    0,78,253,255,0,137,248,0,0,196,253,255,0,20,253,0,128,128,128,252,0,0,12,253,39,0,121,248,216,0,80,253,
+    39,0,3,253,0,247,0,0,118,248,255,0,59,248,0,128,128,128,0,30,238,196,0,45,252,0,0,39,238,255,0,59,
+    252,0,128,128,128,0,39,253,255,0,183,243,20,0,186,253,235,0,18,0,39,253,255,0,177,243,0,0,196,253,255,0,
+    20,128,128,128,128,128,128,128,128,128,128,128,128,0,39,253,255,0,207,243,98,0,143,253,157,0,12,0,39,238,255,0,
+    59,252,0,128,128,128,0,39,253,255,0,213,243,118,0,27,252,0,0,39,253,255,0,177,237,0,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,247,0,0,91,248,196,0,45,248,0,247,0,0,118,248,255,0,59,248,0,128,128,128,252,0,
+    0,72,253,235,0,136,248,20,0,186,253,235,0,18,253,0,252,0,0,78,253,255,0,137,248,0,0,196,253,255,0,20,
+    253,0,128,128,0,3,253,20,0,86,253,235,0,127,248,0,0,181,253,235,0,36,254,20,0,18,0,39,253,255,0,177,
+    238,0,0,235,254,255,0,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,12,253,78,0,109,
+    253,177,0,95,248,0,0,136,253,177,0,86,254,78,0,72,252,0,0,78,253,255,0,137,248,0,0,196,253,255,0,20,
+    253,0,128,128,128,252,0,0,12,253,39,0,121,248,216,0,80,253,39,0,202,254,216,0,199,247,0,0,118,248,255,0,
+    59,253,0,0,235,254,255,0,235,128,128,128,232,0,0,235,254,255,0,235,128,128,128,232,0,0,199,254,216,0,199,0,
+    30,238,196,0,45,248,0,0,39,238,255,0,59,248,0,128,128,128,0,39,253,255,0,183,243,20,0,186,253,235,0,18,
+    253,0,0,39,253,255,0,177,243,0,0,196,253,255,0,20,253,0,128,128,128,128,128,128,128,128,128,128,128,128,0,39,
+    253,255,0,207,243,98,0,143,253,157,0,12,253,0,0,39,238,255,0,59,248,0,128,128,128,0,39,253,255,0,213,248,
+    118,0,202,253,255,0,59,248,0,0,39,253,255,0,177,248,0,0,157,253,255,0,59,248,0,128,128,128,0,39,253,255,
+    0,177,248,0,0,48,253,78,0,154,253,177,0,14,253,0,0,39,253,255,0,177,243,0,0,196,253,255,0,20,253,0,
+    128,128,128,0,39,253,255,0,177,243,0,0,30,253,39,0,202,254,216,0,199,0,39,253,255,0,177,238,0,0,235,254,
+    255,0,235,128,128,128,252,0,0,60,238,196,0,15,253,0,252,0,0,78,238,255,0,20,253,0,128,128,128,0,36,253,
+    235,0,169,238,20,0,219,254,235,0,217,0,39,253,255,0,177,238,0,0,235,254,255,0,235,128,128,0,39,253,255,0,
+    177,238,0,0,217,254,235,0,217,0,39,253,255,0,177,233,0,128,128,128,0,30,253,196,0,154,248,59,0,23,243,0,
+    252,0,0,78,248,255,0,98,243,0,128,128,128,252,0,0,48,248,157,0,121,248,98,0,8,253,0,242,0,0,157,248,
+    255,0,20,253,0,128,128,128,242,0,0,72,248,118,0,136,254,137,0,127,232,0,0,235,254,255,0,235,128,128,128,0,
+    27,253,177,0,122,238,0,0,235,254,255,0,235,0,39,253,255,0,177,238,0,0,235,254,255,0,235,128,128,128,0,6,
+    253,39,0,94,238,216,0,53,254,39,0,36,252,0,0,78,238,255,0,20,253,0,128,128,128,224,196,0,181,224,255,0,
+    235,128,128,128,243,20,0,128,253,255,0,110,244,20,0,18,243,0,0,118,253,255,0,98,243,0,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,30,253,196,0,136,
+    238,0,0,181,254,196,0,181,0,39,253,255,0,177,238,0,0,235,254,255,0,235,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,6,253,39,0,94,238,216,0,53,
+    254,39,0,36,252,0,0,78,238,255,0,20,253,0,128,128,128,253,196,0,166,233,0,0,181,254,196,0,181,253,255,0,
+    216,233,0,0,235,254,255,0,235,128,128,128,128,128,128,128,253,235,0,202,253,20,0,14,243,0,0,15,253,20,0,219,
+    254,235,0,217,253,0,0,39,253,255,0,177,243,0,0,196,253,255,0,20,253,0,128,128,128,128,128,128,128,128,253,0,
+    0,24,253,157,0,139,253,98,0,53,253,0,0,60,253,98,0,143,253,157,0,12,253,0,248,0,0,78,253,255,0,137,
+    253,0,0,157,253,255,0,59,248,0,128,128,128,128,128,128,128,128,248,0,0,24,253,78,0,124,253,177,0,116,253,78,
+    0,18,248,0,243,0,0,118,253,255,0,98,243,0,128,128,128,128,128,128,128,128,253,196,0,166,233,0,0,181,254,196,
+    0,181,253,255,0,216,233,0,0,235,254,255,0,235,128,128,128,253,255,0,216,248,0,0,109,253,235,0,91,248,0,0,
+    235,254,255,0,235,253,255,0,216,248,0,0,118,253,255,0,98,248,0,0,235,254,255,0,235,128,128,128,128,128,128,128,
+    253,255,0,216,253,0,0,18,253,59,0,122,253,196,0,112,253,59,0,14,253,0,0,235,254,255,0,235,253,255,0,216,
+    253,0,0,78,253,255,0,137,253,0,0,157,253,255,0,59,253,0,0,235,254,255,0,235,128,128,128,128,128,128,128,128,
+    253,118,0,121,253,137,0,174,253,255,0,137,253,0,0,157,253,255,0,164,253,137,0,119,254,118,0,109,253,0,0,39,
+    248,255,0,137,253,0,0,157,248,255,0,20,253,0,128,128,128,253,0,0,39,253,255,0,201,253,78,0,42,253,0,0,
+    48,253,78,0,214,253,255,0,20,253,0,253,0,0,39,253,255,0,177,243,0,0,196,253,255,0,20,253,0,128,128,128,
+    128,128,128,128,128,0,30,253,196,0,136,238,0,0,181,254,196,0,181,0,39,253,255,0,177,238,0,0,235,254,255,0,
+    235,128,128,128,128,128,128,128,0,36,253,235,0,169,253,20,0,11,248,0,0,15,253,20,0,219,254,235,0,217,252,0,
+    0,78,253,255,0,137,248,0,0,196,253,255,0,20,253,0,128,128,128,252,0,0,60,253,196,0,133,248,59,0,164,253,
+    196,0,15,253,0,247,0,0,118,248,255,0,59,248,0,128,128,128,128,128,128,128,128,252,0,0,42,253,137,0,128,248,
+    118,0,133,253,137,0,11,253,0,252,0,0,78,253,255,0,137,248,0,0,196,253,255,0,20,253,0,128,128,128,0,27,
+    253,177,0,146,253,78,0,42,248,0,0,60,253,78,0,169,254,177,0,163,0,39,253,255,0,177,238,0,0,235,254,255,
+    0,235,128,128,128,128,128,128,128,128,253,196,0,166,233,0,0,181,254,196,0,181,253,255,0,216,233,0,0,235,254,255,
+    0,235,128,128,128,128,128,128,128,253,235,0,202,253,20,0,14,243,0,0,15,253,20,0,219,254,235,0,217,253,0,0,
+    39,253,255,0,177,243,0,0,196,253,255,0,20,253,0,128,128,128,253,0,0,30,253,196,0,154,253,59,0,32,253,0,
+    0,36,253,59,0,164,253,196,0,15,253,0,248,0,0,78,253,255,0,137,253,0,0,157,253,255,0,59,248,0,128,128,
+    128,248,0,0,48,253,157,0,130,253,98,0,134,253,157,0,36,248,0,243,0,0,118,253,255,0,98,243,0,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,30,229,196,0,181,0,39,229,255,0,235,128,128,128,0,3,
+    233,20,0,237,254,255,0,235,232,0,0,235,254,255,0,235,128,128,237,0,0,15,253,20,0,219,254,235,0,217,237,0,
+    0,196,253,255,0,20,253,0,128,128,128,242,0,0,36,253,59,0,164,253,196,0,15,253,0,242,0,0,157,253,255,0,
+    59,248,0,128,128,128,247,0,0,45,253,98,0,134,253,157,0,36,248,0,247,0,0,118,253,255,0,98,243,0,128,128,
+    128,252,0,0,42,253,137,0,128,253,118,0,45,243,0,252,0,0,78,253,255,0,137,238,0,128,128,128,0,27,253,177,
+    0,146,253,78,0,42,238,0,0,39,253,255,0,177,233,0,128,128,128,0,39,253,255,0,243,234,216,0,199,0,39,229,
+    255,0,235,128,128,128,0,48,243,157,0,36,0,78,243,255,0,59,128,128,128,0,78,253,255,0,164,248,59,0,14,0,
+    78,253,255,0,137,247,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,78,253,255,0,155,248,39,0,9,0,78,243,255,0,59,
+    128,128,128,0,54,243,177,0,41,0,24,253,157,0,109,237,0,0,39,253,255,0,177,237,0,128,128,128,128,128,128,128,
+    128,0,3,253,20,0,86,253,235,0,127,242,0,252,0,0,78,253,255,0,137,242,0,128,128,128,128,128,128,128,252,0,
+    0,60,253,196,0,133,253,59,0,23,247,0,247,0,0,118,253,255,0,98,247,0,128,128,128,128,128,128,128,128,247,0,
+    0,54,253,118,0,130,253,137,0,32,252,0,242,0,0,157,253,255,0,59,252,0,128,128,128,128,128,128,128,128,242,0,
+    0,24,253,39,0,175,253,216,0,17,237,0,0,196,253,255,0,20,128,128,128,128,128,128,128,237,0,0,166,253,216,0,
+    17,0,48,243,157,0,36,0,78,243,255,0,59,128,128,128,0,18,248,59,0,180,253,255,0,59,247,0,0,157,253,255,
+    0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,0,12,248,39,0,172,253,255,0,59,0,78,243,255,0,59,128,128,128,0,54,
+    243,177,0,41,247,0,0,72,253,157,0,60,247,0,247,0,0,118,253,255,0,98,247,0,128,128,128,128,128,128,128,128,
+    252,0,0,72,253,235,0,136,253,20,0,152,253,235,0,54,252,0,252,0,0,78,253,255,0,137,253,0,0,157,253,255,
+    0,59,252,0,128,128,128,128,128,128,128,0,9,253,59,0,101,253,196,0,106,253,0,0,121,253,196,0,91,253,59,0,
+    5,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,128,128,128,128,128,0,18,253,118,0,81,243,0,0,
+    91,253,118,0,9,224,255,0,235,128,128,128,224,216,0,199,0,48,253,157,0,84,252,0,0,78,253,255,0,137,252,0,
+    128,128,128,0,18,253,59,0,122,253,196,0,75,252,0,0,118,253,255,0,98,128,128,128,252,0,0,9,253,20,0,8,
+    252,0,0,6,243,20,0,5,252,0,252,0,0,78,243,255,0,59,252,0,128,128,128,252,0,0,60,243,196,0,91,253,
+    59,0,5,237,0,0,196,253,255,0,20,128,128,128,252,0,0,30,243,98,0,219,253,255,0,20,252,0,0,78,238,255,
+    0,20,128,128,128,0,21,253,137,0,131,243,118,0,223,253,255,0,20,0,39,253,255,0,177,243,0,0,196,253,255,0,
+    20,128,128,128,128,128,128,128,128,0,6,253,39,0,94,243,216,0,246,253,255,0,20,252,0,0,78,238,255,0,20,128,
+    128,128,252,0,0,6,243,20,0,5,252,0,252,0,0,78,243,255,0,59,252,0,128,128,128,0,9,253,59,0,101,243,
+    196,0,91,253,59,0,5,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,0,39,253,255,0,177,243,0,
+    0,121,253,157,0,12,0,39,253,255,0,177,237,0,128,128,128,128,128,128,128,128,0,39,253,255,0,177,243,0,0,136,
+    253,177,0,14,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,0,6,253,39,0,94,243,216,0,80,253,
+    39,0,3,252,0,0,78,243,255,0,59,252,0,128,128,128,237,0,0,121,253,157,0,12,237,0,0,196,253,255,0,20,
+    128,128,128,128,128,128,128,128,128,128,128,128,252,0,0,6,243,20,0,201,253,255,0,20,252,0,0,78,238,255,0,20,
+    128,128,128,0,9,253,59,0,101,243,196,0,241,253,255,0,20,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,6,253,39,0,94,243,216,0,246,253,255,0,20,252,
+    0,0,78,238,255,0,20,128,128,128,247,0,0,72,243,157,0,12,247,0,0,118,243,255,0,20,128,128,128,252,0,0,
+    60,253,196,0,133,243,59,0,5,252,0,0,78,253,255,0,137,242,0,128,128,128,128,128,128,128,0,3,253,20,0,92,
+    253,255,0,146,248,20,0,5,252,0,0,39,238,255,0,59,252,0,128,128,128,0,30,253,196,0,214,253,255,0,228,248,
+    196,0,45,252,0,252,0,0,78,253,255,0,137,242,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,0,24,253,157,0,109,237,0,0,39,253,255,0,177,237,0,128,128,128,128,128,128,128,128,128,128,
+    128,128,0,39,253,255,0,183,243,20,0,5,252,0,0,39,238,255,0,59,252,0,128,128,128,0,39,253,255,0,237,243,
+    196,0,91,253,59,0,5,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,252,0,0,72,253,157,0,60,252,0,0,118,253,255,0,98,128,128,128,252,
+    0,0,27,253,59,0,23,246,0,128,128,128,128,128,128,128,0,6,248,20,0,8,0,78,248,255,0,98,128,128,128,0,
+    60,253,196,0,223,253,255,0,98,252,0,0,118,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,242,0,0,97,253,157,0,36,242,0,0,157,253,255,0,59,128,128,128,242,0,0,36,253,
+    59,0,14,236,0,128,128,128,128,128,128,128,247,0,0,9,248,20,0,5,247,0,0,118,248,255,0,59,128,128,128,247,
+    0,0,91,253,196,0,232,253,255,0,59,242,0,0,157,253,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,6,243,39,0,148,253,216,0,50,0,39,243,255,0,98,252,0,
+    128,128,128,0,27,243,177,0,68,252,0,0,24,253,157,0,109,237,0,0,39,253,255,0,177,237,0,128,128,128,128,128,
+    128,128,128,128,128,128,128,0,39,253,255,0,177,243,0,0,15,253,20,0,2,0,39,253,255,0,177,243,0,0,196,253,
+    255,0,20,128,128,128,0,39,253,255,0,177,248,0,0,36,253,59,0,164,253,196,0,15,0,39,253,255,0,177,248,0,
+    0,157,253,255,0,59,252,0,128,128,128,0,39,253,255,0,177,253,0,0,45,253,98,0,134,253,157,0,36,252,0,0,
+    39,253,255,0,177,253,0,0,118,253,255,0,98,247,0,128,128,128,0,39,253,255,0,219,253,137,0,192,253,255,0,98,
+    247,0,0,39,243,255,0,98,247,0,128,128,128,0,39,253,255,0,201,248,78,0,139,253,177,0,41,252,0,0,39,253,
+    255,0,177,248,0,0,157,253,255,0,59,252,0,128,128,128,0,39,253,255,0,177,248,0,0,24,253,39,0,175,253,216,
+    0,17,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,0,48,248,157,0,60,0,78,248,255,0,98,128,
+    128,128,0,18,253,59,0,149,253,255,0,98,252,0,0,118,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,243,20,0,11,253,0,0,
+    12,248,20,0,2,253,0,243,255,0,137,253,0,0,157,248,255,0,20,253,0,128,128,128,253,255,0,246,248,196,0,133,
+    253,59,0,143,248,196,0,69,254,59,0,54,253,255,0,216,248,0,0,118,253,255,0,98,248,0,0,235,254,255,0,235,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,3,238,20,0,5,252,0,0,
+    39,238,255,0,59,252,0,128,128,128,0,39,253,255,0,237,243,196,0,91,253,59,0,5,0,39,253,255,0,177,243,0,
+    0,196,253,255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,252,0,0,
+    6,243,20,0,5,252,0,252,0,0,78,243,255,0,59,252,0,128,128,128,0,9,253,59,0,101,243,196,0,91,253,59,
+    0,5,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,0,6,253,39,0,94,243,216,0,80,253,39,0,3,252,0,0,78,243,255,0,59,252,0,128,128,128,0,3,238,
+    20,0,5,252,0,0,39,238,255,0,59,252,0,128,128,128,0,39,253,255,0,237,243,196,0,91,253,59,0,5,0,39,
+    253,255,0,177,243,0,0,196,253,255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,39,
+    253,255,0,243,243,216,0,80,253,39,0,3,0,39,238,255,0,59,252,0,128,128,128,0,39,253,255,0,177,237,0,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,0,21,253,137,0,95,237,0,252,0,0,6,238,20,0,2,252,0,0,78,
+    238,255,0,20,128,128,128,0,9,253,59,0,101,243,196,0,241,253,255,0,20,0,39,253,255,0,177,243,0,0,196,253,
+    255,0,20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,6,253,39,0,94,243,216,0,246,253,
+    255,0,20,252,0,0,78,238,255,0,20,128,128,128,237,0,0,196,253,255,0,20,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,237,0,0,106,253,137,0,11,0,3,253,20,0,14,253,0,0,9,248,20,0,5,252,0,0,39,253,255,0,
+    177,253,0,0,118,248,255,0,59,252,0,128,128,128,0,39,253,255,0,195,253,59,0,122,248,196,0,91,253,59,0,5,
+    0,39,248,255,0,137,248,0,0,196,253,255,0,20,128,128,128,0,39,253,255,0,225,253,157,0,84,248,0,0,121,253,
+    157,0,12,0,39,253,255,0,177,237,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,252,0,0,
+    6,238,20,0,2,252,0,0,78,238,255,0,20,128,128,128,0,9,253,59,0,101,238,196,0,15,0,39,253,255,0,177,
+    237,0,128,128,128,0,24,253,157,0,139,248,98,0,38,247,0,252,0,0,78,248,255,0,98,247,0,128,128,128,252,0,
+    0,36,248,118,0,130,253,137,0,32,252,0,242,0,0,157,253,255,0,59,252,0,128,128,128,242,0,0,48,253,78,0,
+    154,253,177,0,14,237,0,0,196,253,255,0,20,128,128,128,0,33,238,216,0,80,253,39,0,3,0,39,238,255,0,59,
+    252,0,128,128,128,0,60,253,196,0,106,242,0,0,78,253,255,0,137,242,0,128,128,128,128,128,128,128,0,78,253,255,
+    0,146,243,20,0,2,0,78,238,255,0,20,128,128,128,0,78,253,255,0,228,243,196,0,15,0,78,253,255,0,137,242,
+    0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,12,253,39,0,121,243,216,0,17,252,0,0,
+    118,243,255,0,20,128,128,128,0,3,253,20,0,14,243,0,0,15,253,20,0,2,0,39,253,255,0,177,243,0,0,196,
+    253,255,0,20,128,128,128,128,128,128,128,128,0,24,253,157,0,139,253,98,0,53,253,0,0,60,253,98,0,143,253,157,
+    0,12,252,0,0,78,253,255,0,137,253,0,0,157,253,255,0,59,252,0,128,128,128,128,128,128,128,128,252,0,0,24,
+    253,78,0,124,253,177,0,116,253,78,0,18,252,0,247,0,0,118,253,255,0,98,247,0,128,128,128,128,128,128,128,128,
+    253,20,0,17,233,0,0,18,254,20,0,18,253,255,0,216,233,0,0,235,254,255,0,235,128,128,128,253,255,0,216,248,
+    0,0,27,253,59,0,23,248,0,0,235,254,255,0,235,253,255,0,216,248,0,0,118,253,255,0,98,248,0,0,235,254,
+    255,0,235,128,128,128,128,128,128,128,128,253,255,0,216,253,0,0,42,253,137,0,128,253,118,0,130,253,137,0,32,253,
+    0,0,235,254,255,0,235,253,255,0,216,253,0,0,78,253,255,0,137,253,0,0,157,253,255,0,59,253,0,0,235,254,
+    255,0,235,128,128,128,253,78,0,94,253,177,0,201,253,255,0,137,253,0,0,157,253,255,0,195,253,177,0,86,254,78,
+    0,72,253,0,0,39,248,255,0,137,253,0,0,157,248,255,0,20,253,0,128,128,128,253,0,0,39,253,255,0,189,253,
+    39,0,21,253,0,0,24,253,39,0,205,253,255,0,20,253,0,253,0,0,39,253,255,0,177,243,0,0,196,253,255,0,
+    20,253,0,128,128,128,0,3,253,20,0,14,243,0,0,15,253,20,0,2,0,39,253,255,0,177,243,0,0,196,253,255,
+    0,20,128,128,128,0,30,253,196,0,154,253,59,0,32,253,0,0,36,253,59,0,164,253,196,0,15,252,0,0,78,253,
+    255,0,137,253,0,0,157,253,255,0,59,252,0,128,128,128,252,0,0,48,253,157,0,130,253,98,0,134,253,157,0,36,
+    252,0,247,0,0,118,253,255,0,98,247,0,128,128,128,128,128,128,128,128,252,0,0,54,253,177,0,131,253,78,0,139,
+    253,177,0,41,252,0,252,0,0,78,253,255,0,137,253,0,0,157,253,255,0,59,252,0,128,128,128,0,33,253,216,0,
+    161,253,39,0,21,253,0,0,24,253,39,0,175,253,216,0,17,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,
+    128,128,0,3,253,20,0,14,243,0,0,15,253,20,0,2,0,39,253,255,0,177,243,0,0,196,253,255,0,20,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,6,253,39,0,94,243,216,0,246,253,
+    255,0,20,252,0,0,78,238,255,0,20,128,128,128,237,0,0,196,253,255,0,20,128,128,128,128,128,128,128,128,252,0,
+    0,24,243,78,0,154,253,177,0,14,252,0,0,78,243,255,0,59,252,0,128,128,128,252,0,0,42,243,137,0,32,252,
+    0,0,3,233,20,0,2,0,39,233,255,0,20,128,128,128,0,30,238,196,0,241,253,255,0,20,237,0,0,196,253,255,
+    0,20,128,128,128,242,0,0,60,253,98,0,143,253,157,0,12,242,0,0,157,253,255,0,59,252,0,128,128,128,247,0,
+    0,63,253,137,0,125,253,118,0,27,252,0,247,0,0,118,253,255,0,98,247,0,128,128,128,252,0,0,54,253,177,0,
+    131,253,78,0,30,247,0,252,0,0,78,253,255,0,137,242,0,128,128,128,0,33,253,216,0,228,253,255,0,237,243,216,
+    0,17,0,39,233,255,0,20,128,128,128,242,0,0,97,248,157,0,12,242,0,0,157,248,255,0,20,128,128,128,247,0,
+    0,91,253,196,0,112,248,59,0,5,247,0,0,118,253,255,0,98,247,0,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,0,15,248,98,0,125,253,157,0,60,247,0,0,39,248,255,0,137,242,0,128,128,128,0,18,248,118,
+    0,127,253,137,0,53,247,0,247,0,0,118,253,255,0,98,247,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,247,0,0,100,253,216,0,107,248,39,0,3,242,0,0,157,248,255,0,20,128,128,128,242,0,0,109,248,177,
+    0,14,0,72,253,157,0,60,0,118,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,0,81,253,177,0,68,0,24,248,157,0,84,242,0,0,39,248,255,0,137,242,0,128,128,128,0,9,248,59,0,122,
+    253,196,0,75,247,0,247,0,0,118,253,255,0,98,247,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,247,0,0,72,253,157,0,121,248,98,0,8,242,0,0,157,248,255,0,20,128,128,128,247,0,0,63,253,137,0,125,
+    248,118,0,9,247,0,0,118,253,255,0,98,247,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,
+    6,248,39,0,121,253,216,0,83,247,0,0,39,248,255,0,137,242,0,128,128,128,0,27,248,177,0,95,242,0,253,0,
+    0,9,243,59,0,23,248,0,0,54,254,59,0,54,253,0,0,39,243,255,0,98,248,0,0,235,254,255,0,235,128,128,
+    128,253,98,0,107,248,157,0,202,253,255,0,158,248,98,0,152,254,157,0,145,253,255,0,216,248,0,0,118,243,255,0,
+    20,253,0,128,128,128,253,118,0,100,248,0,0,54,243,118,0,9,253,0,0,166,237,216,0,33,247,0,0,196,237,255,
+    0,39,247,0,128,128,128,0,196,253,255,0,171,242,98,0,148,253,157,0,60,252,0,0,196,253,255,0,118,242,0,0,
+    216,253,255,0,98,252,0,128,128,128,0,196,253,255,0,118,242,0,0,133,253,157,0,121,253,98,0,60,0,196,253,255,
+    0,118,237,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,196,253,
+    255,0,118,242,0,0,100,253,118,0,130,253,137,0,84,0,196,253,255,0,118,242,0,0,216,253,255,0,98,252,0,128,
+    128,128,0,196,253,255,0,149,242,59,0,175,253,196,0,75,252,0,0,196,237,255,0,39,247,0,128,128,128,128,252,0,
+    0,53,242,98,0,15,252,0,252,0,0,137,242,255,0,39,252,0,128,128,128,0,30,253,39,0,134,242,216,0,66,253,
+    39,0,15,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,0,196,253,255,0,244,242,235,0,252,253,
+    255,0,98,0,196,232,255,0,98,128,128,128,0,196,253,255,0,160,237,78,0,30,0,196,253,255,0,118,236,0,128,128,
+    128,0,196,253,255,0,118,242,0,0,100,253,118,0,45,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,
+    0,151,253,196,0,122,242,59,0,175,253,196,0,75,252,0,0,137,242,255,0,39,252,0,128,128,128,128,0,15,253,20,
+    0,9,236,0,0,196,253,255,0,118,236,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,196,253,255,0,171,
+    242,98,0,15,252,0,0,196,237,255,0,39,252,0,128,128,128,0,196,253,255,0,234,242,216,0,66,253,39,0,15,0,
+    196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    0,196,253,255,0,149,242,59,0,175,253,196,0,75,0,196,237,255,0,39,252,0,128,128,128,128,0,75,253,98,0,45,
+    242,0,0,83,253,98,0,38,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,151,253,196,0,122,242,59,0,225,253,255,0,98,252,0,0,137,
+    237,255,0,98,128,128,128,128,252,0,0,53,237,98,0,38,252,0,0,137,237,255,0,98,128,128,128,0,30,253,39,0,
+    134,242,216,0,249,253,255,0,98,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,0,151,253,196,0,122,242,59,0,225,253,255,0,98,252,0,0,137,237,255,0,98,
+    128,128,128,128,236,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,252,0,0,74,242,137,0,121,253,118,0,
+    45,252,0,0,137,242,255,0,39,252,0,128,128,128,252,0,0,95,242,177,0,27,252,0,0,66,253,216,0,199,0,78,
+    253,255,0,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,0,42,253,137,0,127,251,0,128,128,128,0,18,253,59,0,54,0,78,253,255,0,235,128,128,128,128,0,11,253,20,
+    0,14,253,0,0,2,252,20,0,3,0,137,253,255,0,177,253,0,0,20,252,255,0,39,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,0,84,253,157,0,109,253,0,0,12,252,157,0,24,242,0,0,66,253,216,0,199,252,0,0,183,
+    253,216,0,83,252,0,242,0,0,78,253,255,0,235,252,0,0,216,253,255,0,98,252,0,128,128,128,128,128,128,128,128,
+    252,0,0,75,248,98,0,146,253,255,0,243,252,98,0,231,253,255,0,158,253,98,0,60,252,0,0,196,227,255,0,157,
+    128,128,128,252,0,0,166,253,216,0,237,253,255,0,243,253,216,0,219,252,255,0,222,248,216,0,133,247,0,0,137,253,
+    255,0,177,253,0,0,20,252,255,0,39,247,0,128,128,128,128,128,128,128,128,128,247,177,0,219,253,255,0,231,253,177,
+    0,183,252,255,0,189,253,177,0,68,252,0,226,255,0,98,252,0,128,128,128,252,137,0,228,253,255,0,192,253,137,0,
+    174,253,255,0,246,247,137,0,53,252,0,252,0,0,196,253,255,0,118,253,0,0,78,253,255,0,235,241,0,128,128,128,
+    128,128,128,128,128,128,247,0,0,66,253,216,0,199,246,0,247,0,0,78,253,255,0,235,246,0,128,128,128,252,0,0,
+    84,253,157,0,187,253,255,0,247,247,157,0,60,252,0,0,137,237,255,0,98,128,128,128,0,75,253,98,0,130,253,157,
+    0,187,253,255,0,247,247,157,0,60,0,196,253,255,0,118,253,0,0,78,253,255,0,235,246,0,128,128,128,128,128,128,
+    128,128,128,0,15,253,20,0,136,253,235,0,241,253,255,0,253,252,235,0,36,252,0,252,0,0,137,242,255,0,39,252,
+    0,128,128,128,252,0,0,42,253,78,0,133,253,255,0,241,252,78,0,161,253,177,0,68,247,0,0,78,253,255,0,235,
+    252,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,0,45,248,59,0,119,253,255,0,240,252,59,0,175,253,196,
+    0,75,0,196,237,255,0,39,252,0,128,128,128,128,247,0,0,78,253,255,0,235,246,0,128,128,128,128,247,0,0,18,
+    253,59,0,54,246,0,252,0,0,166,253,216,0,100,242,0,0,183,253,216,0,83,252,0,252,0,0,196,253,255,0,118,
+    242,0,0,216,253,255,0,98,252,0,128,128,128,252,157,0,112,253,98,0,130,253,157,0,109,253,0,0,12,252,157,0,
+    107,253,98,0,38,252,0,252,255,0,59,253,0,0,137,253,255,0,177,253,0,0,20,252,255,0,39,247,0,128,128,128,
+    128,128,128,128,128,252,216,0,80,253,39,0,134,253,216,0,161,253,39,0,53,252,216,0,33,247,0,252,0,0,196,253,
+    255,0,118,253,0,0,78,253,255,0,235,241,0,128,128,128,128,252,0,0,15,253,20,0,9,253,0,0,78,253,255,0,
+    235,252,0,0,199,253,235,0,91,252,0,242,0,0,78,253,255,0,235,252,0,0,216,253,255,0,98,252,0,128,128,128,
+    247,0,0,95,253,177,0,146,253,78,0,86,252,177,0,94,253,78,0,139,253,177,0,109,247,0,0,137,253,255,0,177,
+    253,0,0,20,252,255,0,39,253,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,252,0,0,45,253,59,0,133,
+    253,196,0,136,253,0,0,15,252,196,0,80,253,59,0,143,253,196,0,121,252,0,0,196,253,255,0,118,242,0,0,216,
+    253,255,0,98,252,0,128,128,128,128,252,0,0,116,248,216,0,199,241,0,252,0,0,137,248,255,0,235,241,0,128,128,
+    128,0,121,253,157,0,125,248,98,0,103,252,157,0,24,247,0,0,196,253,255,0,118,248,0,0,20,252,255,0,39,247,
+    0,128,128,128,128,128,128,128,128,0,166,253,216,0,121,248,39,0,53,252,216,0,33,253,0,0,24,253,39,0,24,252,
+    0,0,137,248,255,0,235,247,0,0,157,253,255,0,157,128,128,128,128,0,181,253,235,0,119,248,20,0,36,252,235,0,
+    36,253,0,0,157,253,255,0,157,0,196,253,255,0,118,248,0,0,20,252,255,0,39,253,0,0,157,253,255,0,157,128,
+    128,128,0,196,253,255,0,118,248,0,0,6,252,78,0,161,253,177,0,116,253,78,0,48,0,196,253,255,0,118,242,0,
+    0,216,253,255,0,98,252,0,128,128,128,128,128,128,128,128,0,151,253,196,0,122,242,59,0,175,253,196,0,112,253,59,
+    0,36,252,0,0,137,242,255,0,39,253,0,0,157,253,255,0,157,128,128,128,128,0,6,253,20,0,18,0,78,253,255,
+    0,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,48,253,157,0,145,247,0,0,2,252,20,0,3,247,0,
+    0,20,252,255,0,39,128,128,128,128,252,0,0,66,253,216,0,202,252,39,0,6,252,0,0,78,253,255,0,235,251,0,
+    128,128,128,128,128,128,128,128,0,53,253,98,0,116,253,157,0,145,251,0,0,137,253,255,0,177,246,0,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,106,253,196,0,154,253,59,0,54,251,0,
+    252,0,0,78,253,255,0,235,251,0,128,128,128,128,128,128,128,128,128,252,0,0,18,253,59,0,69,252,196,0,30,247,
+    0,0,20,252,255,0,39,128,128,128,247,0,0,9,252,118,0,18,0,11,253,20,0,14,246,0,0,137,253,255,0,177,
+    246,0,128,128,128,128,0,21,253,39,0,94,253,216,0,199,251,0,252,0,0,78,253,255,0,235,251,0,128,128,128,128,
+    128,128,128,128,252,0,0,48,253,157,0,152,252,98,0,15,247,0,0,20,252,255,0,39,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,252,0,0,18,253,59,0,69,252,196,0,30,252,0,0,78,
+    253,255,0,235,251,0,128,128,128,128,128,128,128,128,128,0,106,253,196,0,154,253,59,0,54,251,0,0,137,253,255,0,
+    177,246,0,128,128,128,0,63,253,118,0,81,246,0,247,0,0,30,253,98,0,91,246,0,247,0,0,78,253,255,0,235,
+    246,0,128,128,128,0,30,253,39,0,18,253,0,0,78,253,255,0,235,252,0,0,33,253,39,0,15,0,196,253,255,0,
+    118,253,0,0,78,253,255,0,235,252,0,0,216,253,255,0,98,128,128,128,128,0,15,253,20,0,136,253,235,0,241,253,
+    255,0,253,252,235,0,53,253,20,0,8,252,0,0,137,242,255,0,39,252,0,128,128,128,0,136,253,177,0,124,253,78,
+    0,133,253,255,0,241,252,78,0,161,253,177,0,68,0,196,253,255,0,118,253,0,0,78,253,255,0,235,252,0,0,216,
+    253,255,0,98,128,128,128,0,106,253,137,0,63,253,0,0,78,253,255,0,235,252,0,0,116,253,137,0,53,247,0,0,
+    78,253,255,0,235,246,0,128,128,128,247,0,0,60,253,196,0,181,246,0,247,0,0,30,253,98,0,91,246,0,247,0,
+    0,78,253,255,0,235,246,0,128,128,128,128,128,128,128,128,128,0,181,248,235,0,241,253,255,0,253,247,235,0,91,0,
+    196,232,255,0,98,128,128,128,0,60,248,78,0,133,253,255,0,241,247,78,0,30,247,0,0,78,253,255,0,235,246,0,
+    128,128,128,128,128,128,128,128,247,0,0,60,253,196,0,181,246,0,252,0,0,63,253,118,0,81,252,0,0,137,253,255,
+    0,177,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,151,253,196,0,122,253,59,0,41,0,196,253,255,0,118,
+    252,0,128,128,128,0,91,253,118,0,54,252,0,0,181,232,235,0,91,0,196,232,255,0,98,128,128,128,0,60,232,78,
+    0,30,0,63,253,118,0,81,0,137,253,255,0,177,128,128,128,128,128,128,128,128,128,236,0,0,17,253,20,0,8,236,
+    0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,242,0,0,12,252,157,0,107,253,98,0,38,242,0,0,20,
+    252,255,0,39,252,0,128,128,128,128,128,128,128,128,247,0,0,12,253,39,0,53,252,216,0,33,252,0,247,0,0,78,
+    253,255,0,235,246,0,128,128,128,128,128,128,128,128,128,252,0,0,95,253,177,0,146,253,78,0,72,246,0,252,0,0,
+    137,253,255,0,177,241,0,128,128,128,128,128,128,128,128,0,45,253,59,0,133,253,196,0,136,241,0,0,196,253,255,0,
+    118,236,0,128,128,128,128,128,128,128,128,128,0,45,253,59,0,27,236,0,252,0,0,116,242,216,0,33,252,0,252,0,
+    0,137,242,255,0,39,252,0,128,128,128,0,121,253,157,0,125,242,98,0,148,253,157,0,60,0,196,253,255,0,118,242,
+    0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,0,196,253,255,0,118,253,0,0,12,253,39,0,36,252,0,0,
+    216,253,255,0,98,0,196,253,255,0,118,253,0,0,78,253,255,0,235,252,0,0,216,253,255,0,98,128,128,128,128,128,
+    128,128,128,128,0,196,253,255,0,118,253,0,0,24,253,78,0,72,252,0,0,216,253,255,0,98,0,196,253,255,0,118,
+    242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,0,151,253,196,0,122,242,59,0,175,253,196,0,75,252,0,
+    0,137,242,255,0,39,252,0,128,128,128,128,247,0,0,66,253,216,0,199,246,0,247,0,0,78,253,255,0,235,246,0,
+    128,128,128,252,0,0,84,253,157,0,187,253,255,0,235,246,0,252,0,0,137,248,255,0,235,246,0,128,128,128,0,75,
+    253,98,0,130,253,157,0,187,253,255,0,235,246,0,0,196,253,255,0,118,253,0,0,78,253,255,0,235,246,0,128,128,
+    128,0,166,253,216,0,100,253,0,0,78,253,255,0,235,246,0,247,0,0,78,253,255,0,235,246,0,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,45,248,59,0,119,253,255,0,240,247,59,0,23,0,196,232,255,
+    0,98,128,128,128,128,252,0,0,116,242,216,0,33,252,0,252,0,0,137,242,255,0,39,252,0,128,128,128,0,121,253,
+    157,0,125,242,98,0,148,253,157,0,60,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,0,121,253,157,
+    0,72,242,0,0,216,253,255,0,98,236,0,0,216,253,255,0,98,128,128,128,242,0,0,3,252,39,0,189,253,216,0,
+    83,242,0,0,20,252,255,0,39,252,0,128,128,128,128,247,0,0,72,253,235,0,219,252,20,0,3,252,0,247,0,0,
+    78,253,255,0,235,246,0,128,128,128,252,0,0,95,253,177,0,146,253,78,0,72,246,0,252,0,0,137,253,255,0,177,
+    241,0,128,128,128,0,91,253,118,0,128,253,137,0,95,241,0,0,196,253,255,0,118,236,0,128,128,128,0,196,253,255,
+    0,149,237,59,0,23,0,196,232,255,0,98,128,128,128,128,252,0,0,116,242,216,0,33,252,0,252,0,0,137,242,255,
+    0,39,252,0,128,128,128,0,121,253,157,0,125,242,98,0,148,253,157,0,60,0,196,253,255,0,118,242,0,0,216,253,
+    255,0,98,128,128,128,0,121,253,157,0,72,242,0,0,216,253,255,0,98,236,0,0,216,253,255,0,98,128,128,128,247,
+    0,0,12,247,39,0,189,253,216,0,83,247,0,0,78,247,255,0,39,252,0,128,128,128,128,247,0,0,6,247,20,0,
+    202,253,235,0,91,236,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,0,91,253,118,0,54,242,0,0,216,253,
+    255,0,98,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,0,151,253,196,0,122,242,59,0,175,253,196,
+    0,75,252,0,0,137,242,255,0,39,252,0,128,128,128,128,236,0,0,183,253,216,0,83,252,0,236,0,0,216,253,255,
+    0,98,252,0,128,128,128,242,0,0,12,252,157,0,240,253,255,0,98,252,0,242,0,0,20,247,255,0,98,252,0,128,
+    128,128,247,0,0,30,253,98,0,103,252,157,0,240,253,255,0,98,252,0,247,0,0,78,253,255,0,235,252,0,0,216,
+    253,255,0,98,252,0,128,128,128,252,0,0,21,253,39,0,94,253,216,0,199,252,0,0,216,253,255,0,98,252,0,252,
+    0,0,137,253,255,0,177,247,0,0,216,253,255,0,98,252,0,128,128,128,128,0,181,253,235,0,119,253,20,0,14,247,
+    0,0,216,253,255,0,98,252,0,0,196,253,255,0,118,242,0,0,216,253,255,0,98,252,0,128,128,128,0,196,253,255,
+    0,213,242,177,0,243,253,255,0,207,253,177,0,109,0,196,227,255,0,157,128,128,128,0,106,237,137,0,237,253,255,0,
+    183,253,137,0,84,236,0,0,216,253,255,0,98,252,0,128,128,128,128,128,128,128,128,128,0,166,232,216,0,83,0,196,
+    232,255,0,98,128,128,128,0,196,253,255,0,171,237,98,0,38,0,196,253,255,0,118,236,0,128,128,128,128,128,128,128,
+    128,0,196,253,255,0,139,242,39,0,6,252,0,0,196,237,255,0,39,252,0,128,128,128,128,0,15,237,20,0,202,253,
+    235,0,91,236,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,0,91,253,118,0,54,242,0,0,216,253,255,0,
+    98,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,0,151,253,196,0,122,242,59,0,175,253,196,0,75,
+    252,0,0,137,242,255,0,39,252,0,128,128,128,128,247,0,0,66,247,216,0,33,252,0,247,0,0,78,247,255,0,39,
+    252,0,128,128,128,252,0,0,84,253,157,0,139,247,98,0,15,252,0,252,0,0,137,253,255,0,177,241,0,128,128,128,
+    0,75,253,98,0,130,253,157,0,109,241,0,0,196,253,255,0,118,236,0,128,128,128,0,196,253,255,0,139,242,39,0,
+    6,252,0,0,196,237,255,0,39,252,0,128,128,128,128,0,196,253,255,0,128,242,20,0,202,253,235,0,91,0,196,253,
+    255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,0,151,253,196,0,122,242,59,
+    0,175,253,196,0,75,252,0,0,137,242,255,0,39,252,0,128,128,128,128,0,166,232,216,0,83,0,196,232,255,0,98,
+    128,128,128,0,75,237,98,0,231,253,255,0,98,236,0,0,216,253,255,0,98,128,128,128,242,0,0,8,252,98,0,148,
+    253,157,0,60,242,0,0,20,252,255,0,39,252,0,128,128,128,128,128,128,128,128,128,247,0,0,72,253,235,0,219,252,
+    20,0,3,252,0,247,0,0,78,253,255,0,235,246,0,128,128,128,128,128,128,128,128,252,0,0,63,253,118,0,124,253,
+    137,0,127,246,0,252,0,0,137,253,255,0,177,241,0,128,128,128,128,128,128,128,128,128,252,0,0,116,242,216,0,33,
+    252,0,252,0,0,137,242,255,0,39,252,0,128,128,128,0,121,253,157,0,125,242,98,0,148,253,157,0,60,0,196,253,
+    255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,0,166,253,216,0,121,242,39,0,189,253,216,0,
+    83,252,0,0,137,242,255,0,39,252,0,128,128,128,128,0,181,253,235,0,119,242,20,0,202,253,235,0,91,0,196,253,
+    255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,0,151,253,196,0,122,242,59,
+    0,175,253,196,0,75,252,0,0,137,242,255,0,39,252,0,128,128,128,128,252,0,0,116,242,216,0,33,252,0,252,0,
+    0,137,242,255,0,39,252,0,128,128,128,0,121,253,157,0,125,242,98,0,148,253,157,0,60,0,196,253,255,0,118,242,
+    0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,15,253,20,0,136,242,235,0,252,253,
+    255,0,98,252,0,0,137,237,255,0,98,128,128,128,252,0,0,42,242,78,0,228,253,255,0,98,236,0,0,216,253,255,
+    0,98,128,128,128,242,0,0,9,252,118,0,134,253,137,0,53,242,0,0,20,252,255,0,39,252,0,128,128,128,252,0,
+    0,32,248,59,0,69,252,196,0,30,252,0,252,0,0,137,248,255,0,235,246,0,128,128,128,128,0,30,253,98,0,91,
+    0,78,253,255,0,235,128,128,128,128,128,128,128,128,128,0,6,253,20,0,18,251,0,128,128,128,128,128,128,128,128,0,
+    36,253,118,0,109,0,78,253,255,0,235,128,128,128,128,128,128,128,128,128,252,0,0,53,253,98,0,68,252,0,0,137,
+    253,255,0,177,128,128,128,128,128,128,128,128,128,252,0,0,11,253,20,0,14,246,0,128,128,128,128,128,128,128,128,252,
+    0,0,63,253,118,0,81,252,0,0,137,253,255,0,177,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,151,253,
+    196,0,122,253,59,0,41,0,196,253,255,0,118,252,0,128,128,128,0,91,253,118,0,54,252,0,237,0,0,8,247,98,
+    0,38,237,0,0,20,247,255,0,98,128,128,128,247,0,0,21,248,39,0,53,247,216,0,83,247,0,0,137,248,255,0,
+    235,246,0,128,128,128,128,247,235,0,119,248,20,0,18,246,0,247,255,0,118,236,0,128,128,128,247,78,0,131,248,177,
+    0,163,246,0,247,0,0,137,248,255,0,235,246,0,128,128,128,247,0,0,74,248,137,0,136,247,118,0,45,237,0,0,
+    20,247,255,0,98,128,128,128,237,0,0,15,247,196,0,75,0,30,227,39,0,24,0,196,227,255,0,157,128,128,128,128,
+    0,15,227,20,0,12,225,0,128,128,128,0,136,227,177,0,109,0,196,227,255,0,157,128,128,128,0,106,227,137,0,84,
+    0,75,248,98,0,68,236,0,0,196,248,255,0,177,236,0,128,128,128,0,166,248,216,0,161,247,39,0,6,247,0,247,
+    0,0,78,247,255,0,39,247,0,128,128,128,128,247,0,0,6,247,20,0,202,248,235,0,145,236,0,0,216,248,255,0,
+    157,128,128,128,247,0,0,54,247,177,0,94,248,78,0,48,247,0,0,78,247,255,0,39,247,0,128,128,128,0,91,248,
+    118,0,124,247,137,0,21,247,0,0,196,248,255,0,177,236,0,128,128,128,0,151,248,196,0,136,236,0,252,0,0,116,
+    242,216,0,33,252,0,252,0,0,137,242,255,0,39,252,0,128,128,128,0,121,253,157,0,125,242,98,0,148,253,157,0,
+    60,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,0,121,253,157,0,72,242,0,0,216,253,255,0,98,
+    236,0,0,216,253,255,0,98,128,128,128,242,0,0,3,252,39,0,189,253,216,0,83,242,0,0,20,252,255,0,39,252,
+    0,128,128,128,128,247,0,0,72,253,235,0,219,252,20,0,3,252,0,247,0,0,78,253,255,0,235,246,0,128,128,128,
+    128,128,128,128,128,247,0,0,42,253,137,0,127,246,0,230,0,128,128,128,247,0,0,18,253,59,0,54,246,0,247,0,
+    0,78,253,255,0,235,246,0,128,128,128,128,247,0,0,116,242,216,0,33,247,0,247,0,0,137,242,255,0,39,247,0,
+    128,128,128,252,0,0,121,253,157,0,125,242,98,0,148,253,157,0,60,252,0,252,0,0,196,253,255,0,118,242,0,0,
+    216,253,255,0,98,252,0,128,128,128,252,98,0,143,253,157,0,72,253,0,0,30,247,98,0,148,253,157,0,121,253,98,
+    0,60,252,255,0,59,248,0,0,78,247,255,0,39,253,0,0,157,253,255,0,157,128,128,128,252,255,0,59,253,0,0,
+    21,253,39,0,94,253,216,0,219,252,255,0,39,253,0,0,157,253,255,0,157,252,255,0,59,253,0,0,137,253,255,0,
+    177,253,0,0,20,252,255,0,39,253,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,128,252,255,0,59,253,0,
+    0,42,253,78,0,109,253,177,0,183,252,255,0,189,253,177,0,116,253,78,0,48,252,255,0,59,248,0,0,78,242,255,
+    0,98,252,0,128,128,128,252,137,0,122,253,118,0,54,253,0,0,42,242,137,0,53,252,0,252,0,0,196,253,255,0,
+    118,231,0,128,128,128,252,0,0,151,253,196,0,122,237,59,0,23,252,0,247,0,0,137,237,255,0,98,252,0,128,128,
+    128,128,247,0,0,66,247,216,0,33,247,0,247,0,0,78,247,255,0,39,247,0,128,128,128,128,128,128,128,128,252,0,
+    0,53,253,98,0,116,247,157,0,107,253,98,0,38,252,0,252,0,0,137,253,255,0,177,247,0,0,216,253,255,0,98,
+    252,0,128,128,128,128,128,128,128,128,128,252,0,0,137,253,255,0,249,247,235,0,252,253,255,0,98,252,0,252,0,0,
+    137,237,255,0,98,252,0,128,128,128,0,136,253,177,0,124,237,78,0,139,253,177,0,109,0,196,253,255,0,118,237,0,
+    0,157,253,255,0,157,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,166,237,216,0,33,247,0,0,196,237,255,
+    0,39,247,0,128,128,128,0,196,253,255,0,171,242,98,0,148,253,157,0,60,252,0,0,196,253,255,0,118,242,0,0,
+    216,253,255,0,98,252,0,128,128,128,128,128,128,128,128,0,196,253,255,0,139,242,39,0,222,253,255,0,98,252,0,0,
+    196,232,255,0,98,252,0,128,128,128,128,0,196,253,255,0,128,237,20,0,152,253,235,0,145,0,196,253,255,0,118,237,
+    0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,128,128,128,128,128,0,196,253,255,0,149,237,59,0,143,253,196,
+    0,121,0,196,232,255,0,98,252,0,128,128,128,128,247,0,0,66,242,216,0,83,252,0,247,0,0,78,242,255,0,98,
+    252,0,128,128,128,252,0,0,84,253,157,0,139,242,98,0,134,253,157,0,97,252,0,0,137,253,255,0,177,242,0,0,
+    157,253,255,0,157,128,128,128,0,75,253,98,0,130,253,157,0,109,242,0,0,97,253,157,0,97,0,196,253,255,0,118,
+    231,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,106,253,137,0,127,253,118,0,81,242,
+    0,0,72,253,118,0,72,252,0,0,137,253,255,0,177,242,0,0,157,253,255,0,157,128,128,128,252,0,0,106,253,196,
+    0,154,242,59,0,143,253,196,0,121,247,0,0,78,242,255,0,98,252,0,128,128,128,128,0,166,232,216,0,83,0,196,
+    232,255,0,98,128,128,128,0,196,253,255,0,171,237,98,0,38,0,196,253,255,0,118,236,0,128,128,128,128,128,128,128,
+    128,0,196,253,255,0,139,242,39,0,6,252,0,0,196,237,255,0,39,252,0,128,128,128,128,0,196,253,255,0,128,242,
+    20,0,3,252,0,0,196,253,255,0,118,236,0,128,128,128,128,128,128,128,128,128,128,128,128,128,0,196,253,255,0,149,
+    237,59,0,23,0,196,232,255,0,98,128,128,128,128,0,166,232,216,0,83,0,196,232,255,0,98,128,128,128,0,196,253,
+    255,0,171,237,98,0,38,0,196,253,255,0,118,236,0,128,128,128,128,128,128,128,128,0,196,253,255,0,139,242,39,0,
+    6,252,0,0,196,237,255,0,39,252,0,128,128,128,128,0,196,253,255,0,128,242,20,0,3,252,0,0,196,253,255,0,
+    118,236,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,247,0,0,66,242,216,0,83,252,0,
+    247,0,0,78,242,255,0,98,252,0,128,128,128,252,0,0,84,253,157,0,139,242,98,0,134,253,157,0,97,252,0,0,
+    137,253,255,0,177,242,0,0,157,253,255,0,157,128,128,128,0,75,253,98,0,130,253,157,0,109,242,0,0,97,253,157,
+    0,97,0,196,253,255,0,118,231,0,128,128,128,128,128,128,128,128,128,0,196,253,255,0,118,248,0,0,18,242,235,0,
+    145,0,196,253,255,0,118,248,0,0,20,242,255,0,157,128,128,128,0,196,253,255,0,118,248,0,0,6,247,78,0,187,
+    253,255,0,157,0,196,253,255,0,118,237,0,0,157,253,255,0,157,128,128,128,0,106,253,137,0,127,253,118,0,81,242,
+    0,0,157,253,255,0,157,252,0,0,137,253,255,0,177,242,0,0,157,253,255,0,157,128,128,128,252,0,0,106,253,196,
+    0,154,242,59,0,143,253,196,0,121,247,0,0,78,242,255,0,98,252,0,128,128,128,128,0,166,253,216,0,100,237,0,
+    0,133,253,216,0,133,0,196,253,255,0,118,237,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,0,196,253,255,0,139,237,39,0,172,253,255,0,157,0,196,227,255,0,157,128,128,128,128,0,196,253,255,0,128,237,
+    20,0,164,253,255,0,157,0,196,253,255,0,118,237,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,116,242,216,0,33,0,137,242,255,0,39,128,128,128,0,53,253,98,0,146,253,255,0,
+    243,252,98,0,15,252,0,0,78,253,255,0,235,251,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,0,32,253,59,0,119,253,255,0,240,252,59,0,9,0,137,242,255,0,39,
+    128,128,128,128,252,0,0,116,242,216,0,33,252,0,0,137,242,255,0,39,128,128,128,252,0,0,53,248,98,0,110,252,
+    255,0,39,242,0,0,20,252,255,0,39,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,45,243,59,0,69,252,196,0,30,0,196,243,255,0,235,251,0,128,128,128,128,0,166,
+    253,216,0,100,237,0,0,133,253,216,0,133,0,196,253,255,0,118,237,0,0,157,253,255,0,157,128,128,128,0,196,253,
+    255,0,118,242,0,0,133,253,157,0,121,253,98,0,60,0,196,253,255,0,118,242,0,0,216,253,255,0,98,252,0,128,
+    128,128,0,196,253,255,0,118,248,0,0,8,252,98,0,148,253,157,0,60,252,0,0,196,253,255,0,118,248,0,0,20,
+    252,255,0,39,247,0,128,128,128,0,196,253,255,0,118,253,0,0,12,253,39,0,53,252,216,0,33,247,0,0,196,253,
+    255,0,118,253,0,0,78,253,255,0,235,241,0,128,128,128,128,0,196,253,255,0,244,253,235,0,241,253,255,0,235,241,
+    0,0,196,243,255,0,235,241,0,128,128,128,0,196,253,255,0,160,248,78,0,86,252,177,0,27,247,0,0,196,253,255,
+    0,118,248,0,0,20,252,255,0,39,247,0,128,128,128,0,196,253,255,0,118,248,0,0,11,252,137,0,121,253,118,0,
+    45,252,0,0,196,253,255,0,118,242,0,0,216,253,255,0,98,252,0,128,128,128,0,196,253,255,0,118,242,0,0,166,
+    253,196,0,112,253,59,0,36,0,196,253,255,0,118,237,0,0,157,253,255,0,157,128,128,128,128,0,166,253,216,0,100,
+    236,0,0,196,253,255,0,118,236,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,0,196,253,255,0,149,237,59,0,23,0,196,232,255,0,98,128,128,128,128,
+    247,216,0,100,242,0,0,183,248,216,0,133,247,255,0,118,242,0,0,216,248,255,0,157,128,128,128,128,128,128,128,128,
+    252,255,0,180,253,157,0,125,253,98,0,68,253,0,0,8,252,98,0,148,253,157,0,217,253,255,0,157,252,255,0,59,
+    253,0,0,137,253,255,0,177,253,0,0,20,252,255,0,39,253,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,
+    128,252,255,0,59,253,0,0,11,253,20,0,86,253,235,0,219,252,20,0,3,253,0,0,157,253,255,0,157,252,255,0,
+    59,248,0,0,78,253,255,0,235,247,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,252,255,0,59,248,0,0,
+    42,253,137,0,127,247,0,0,157,253,255,0,157,252,255,0,59,232,0,0,157,253,255,0,157,128,128,128,128,128,128,128,
+    128,128,0,166,248,216,0,149,242,0,0,133,253,216,0,133,0,196,248,255,0,177,242,0,0,157,253,255,0,157,128,128,
+    128,128,128,128,128,128,0,196,253,255,0,202,253,157,0,139,253,98,0,91,247,0,0,157,253,255,0,157,0,196,253,255,
+    0,118,253,0,0,78,253,255,0,235,247,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,128,0,196,253,255,0,
+    118,253,0,0,6,253,20,0,36,252,235,0,36,253,0,0,157,253,255,0,157,0,196,253,255,0,118,248,0,0,20,252,
+    255,0,39,253,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,0,196,253,255,0,118,248,0,0,11,252,137,0,
+    121,253,118,0,202,253,255,0,157,0,196,253,255,0,118,242,0,0,216,248,255,0,157,128,128,128,128,128,128,128,128,128,
+    247,0,0,66,247,216,0,33,247,0,247,0,0,78,247,255,0,39,247,0,128,128,128,252,0,0,84,253,157,0,139,247,
+    98,0,148,253,157,0,60,252,0,252,0,0,137,253,255,0,177,247,0,0,216,253,255,0,98,252,0,128,128,128,0,75,
+    253,98,0,130,253,157,0,109,247,0,0,133,253,157,0,121,253,98,0,60,0,196,253,255,0,118,237,0,0,157,253,255,
+    0,157,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,106,253,137,0,127,253,118,0,81,247,
+    0,0,100,253,118,0,130,253,137,0,84,252,0,0,137,253,255,0,177,247,0,0,216,253,255,0,98,252,0,128,128,128,
+    252,0,0,106,253,196,0,154,247,59,0,175,253,196,0,75,252,0,247,0,0,78,247,255,0,39,247,0,128,128,128,128,
+    0,166,237,216,0,33,252,0,0,196,237,255,0,39,252,0,128,128,128,0,196,253,255,0,171,242,98,0,148,253,157,0,
+    60,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,196,253,
+    255,0,244,242,235,0,53,253,20,0,8,0,196,237,255,0,39,252,0,128,128,128,0,196,253,255,0,160,242,78,0,12,
+    252,0,0,196,253,255,0,118,236,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,247,0,0,66,247,216,0,33,
+    247,0,247,0,0,78,247,255,0,39,247,0,128,128,128,252,0,0,84,253,157,0,139,247,98,0,148,253,157,0,60,252,
+    0,252,0,0,137,253,255,0,177,247,0,0,216,253,255,0,98,252,0,128,128,128,0,75,253,98,0,130,253,157,0,109,
+    247,0,0,133,253,157,0,121,253,98,0,60,0,196,253,255,0,118,237,0,0,157,253,255,0,157,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,0,106,253,137,0,127,253,118,0,81,247,0,0,100,253,118,0,130,253,
+    137,0,84,252,0,0,137,253,255,0,177,247,0,0,216,253,255,0,98,252,0,128,128,128,252,0,0,106,253,196,0,154,
+    247,59,0,175,253,196,0,112,253,59,0,36,247,0,0,78,247,255,0,39,253,0,0,157,253,255,0,157,128,128,128,128,
+    231,0,0,157,253,255,0,157,128,128,128,128,231,0,0,36,253,59,0,36,0,166,237,216,0,33,247,0,0,196,237,255,
+    0,39,247,0,128,128,128,0,196,253,255,0,171,242,98,0,148,253,157,0,60,252,0,0,196,253,255,0,118,242,0,0,
+    216,253,255,0,98,252,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,196,253,255,0,244,242,235,0,53,253,
+    20,0,8,252,0,0,196,237,255,0,39,247,0,128,128,128,0,196,253,255,0,160,248,78,0,92,252,255,0,39,247,0,
+    0,196,253,255,0,118,248,0,0,20,252,255,0,39,247,0,128,128,128,0,196,253,255,0,118,248,0,0,11,252,137,0,
+    121,253,118,0,45,252,0,0,196,253,255,0,118,242,0,0,216,253,255,0,98,252,0,128,128,128,0,196,253,255,0,118,
+    242,0,0,166,253,196,0,112,253,59,0,36,0,196,253,255,0,118,237,0,0,157,253,255,0,157,128,128,128,128,252,0,
+    0,116,237,216,0,83,252,0,252,0,0,137,237,255,0,98,252,0,128,128,128,0,121,253,157,0,125,237,98,0,134,253,
+    157,0,97,0,196,253,255,0,118,237,0,0,157,253,255,0,157,128,128,128,0,196,253,255,0,118,237,0,0,97,253,157,
+    0,97,0,196,253,255,0,118,231,0,128,128,128,0,166,253,216,0,121,248,39,0,36,241,0,252,0,0,137,248,255,0,
+    235,241,0,128,128,128,128,252,0,0,11,248,20,0,36,247,235,0,91,252,0,242,0,0,20,247,255,0,98,252,0,128,
+    128,128,242,0,0,6,247,78,0,139,253,177,0,109,231,0,0,157,253,255,0,157,128,128,128,0,91,253,118,0,54,237,
+    0,0,157,253,255,0,157,0,196,253,255,0,118,237,0,0,157,253,255,0,157,128,128,128,0,151,253,196,0,122,237,59,
+    0,143,253,196,0,121,252,0,0,137,237,255,0,98,252,0,128,128,128,128,221,216,0,133,221,255,0,157,128,128,128,242,
+    98,0,146,253,255,0,243,242,98,0,60,242,0,0,78,253,255,0,235,241,0,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,166,253,216,0,100,237,0,
+    0,133,253,216,0,133,0,196,253,255,0,118,237,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,151,253,196,0,122,237,59,0,143,
+    253,196,0,121,252,0,0,137,237,255,0,98,252,0,128,128,128,128,252,216,0,50,232,0,0,133,253,216,0,133,252,255,
+    0,59,232,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,252,157,0,112,253,98,0,45,242,0,0,83,253,98,
+    0,134,253,157,0,97,252,0,0,196,253,255,0,118,242,0,0,216,253,255,0,98,252,0,128,128,128,128,128,128,128,128,
+    128,252,0,0,15,253,20,0,136,253,235,0,163,253,0,0,18,252,235,0,53,253,20,0,8,252,0,247,0,0,137,253,
+    255,0,177,253,0,0,20,252,255,0,39,247,0,128,128,128,128,128,128,128,128,247,0,0,74,253,137,0,131,253,118,0,
+    119,252,137,0,21,247,0,242,0,0,78,253,255,0,235,241,0,128,128,128,128,128,128,128,128,128,252,216,0,50,232,0,
+    0,133,253,216,0,133,252,255,0,59,232,0,0,157,253,255,0,157,128,128,128,252,255,0,59,248,0,0,48,253,157,0,
+    145,247,0,0,157,253,255,0,157,252,255,0,59,248,0,0,78,253,255,0,235,247,0,0,157,253,255,0,157,128,128,128,
+    128,128,128,128,128,252,255,0,59,253,0,0,21,253,39,0,94,253,216,0,202,252,39,0,6,253,0,0,157,253,255,0,
+    157,252,255,0,59,253,0,0,137,253,255,0,177,253,0,0,20,252,255,0,39,253,0,0,157,253,255,0,157,128,128,128,
+    128,128,128,128,128,128,252,78,0,154,253,177,0,219,253,255,0,177,253,0,0,20,252,255,0,189,253,177,0,116,253,78,
+    0,48,252,0,0,196,248,255,0,177,253,0,0,20,247,255,0,98,252,0,128,128,128,252,0,0,196,253,255,0,192,253,
+    137,0,95,253,0,0,11,252,137,0,237,253,255,0,98,252,0,252,0,0,196,253,255,0,118,242,0,0,216,253,255,0,
+    98,252,0,128,128,128,128,128,128,128,128,128,0,166,253,216,0,100,237,0,0,133,253,216,0,133,0,196,253,255,0,118,
+    237,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,0,121,253,157,0,125,253,98,0,68,247,0,0,83,253,98,
+    0,134,253,157,0,97,252,0,0,137,253,255,0,177,247,0,0,216,253,255,0,98,252,0,128,128,128,252,0,0,116,253,
+    216,0,161,247,39,0,189,253,216,0,83,252,0,247,0,0,78,247,255,0,39,247,0,128,128,128,128,128,128,128,128,128,
+    252,0,0,95,253,177,0,146,247,78,0,161,253,177,0,68,252,0,252,0,0,137,253,255,0,177,247,0,0,216,253,255,
+    0,98,252,0,128,128,128,0,91,253,118,0,128,253,137,0,95,247,0,0,116,253,137,0,125,253,118,0,72,0,196,253,
+    255,0,118,237,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,128,252,216,0,50,232,0,0,133,253,216,0,133,
+    252,255,0,59,232,0,0,157,253,255,0,157,128,128,128,128,128,128,128,128,252,157,0,112,253,98,0,45,242,0,0,83,
+    253,98,0,134,253,157,0,97,252,0,0,196,253,255,0,118,242,0,0,216,253,255,0,98,252,0,128,128,128,252,0,0,
+    166,253,216,0,121,253,39,0,27,253,0,0,3,252,39,0,189,253,216,0,83,252,0,247,0,0,137,253,255,0,177,253,
+    0,0,20,252,255,0,39,247,0,128,128,128,128,247,0,0,11,253,20,0,86,253,235,0,219,252,20,0,3,247,0,242,
+    0,0,78,253,255,0,235,241,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,166,227,216,
+    0,133,0,196,227,255,0,157,128,128,128,0,75,232,98,0,195,253,255,0,157,231,0,0,157,253,255,0,157,128,128,128,
+    236,0,0,83,253,98,0,134,253,157,0,97,236,0,0,216,253,255,0,98,252,0,128,128,128,242,0,0,3,252,39,0,
+    189,253,216,0,83,252,0,242,0,0,20,252,255,0,39,247,0,128,128,128,128,247,0,0,72,253,235,0,219,252,20,0,
+    3,247,0,247,0,0,78,253,255,0,235,241,0,128,128,128,252,0,0,95,253,177,0,146,253,78,0,72,241,0,252,0,
+    0,137,253,255,0,177,236,0,128,128,128,0,91,253,118,0,128,253,137,0,95,236,0,0,196,253,255,0,118,231,0,128,
+    128,128,0,196,253,255,0,149,232,59,0,36,0,196,227,255,0,157,128,128,128,128,0,11,242,20,0,3,0,137,242,255,
+    0,39,128,128,128,128,0,137,253,255,0,189,247,39,0,6,0,137,253,255,0,177,246,0,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,0,137,253,255,0,237,247,196,0,30,0,137,242,255,0,39,128,128,128,0,63,242,118,0,18,0,15,
+    253,20,0,9,236,0,0,196,253,255,0,118,236,0,128,128,128,128,128,128,128,128,128,0,75,253,98,0,130,253,157,0,
+    109,241,0,252,0,0,137,253,255,0,177,241,0,128,128,128,128,128,128,128,128,252,0,0,116,253,216,0,161,253,39,0,
+    36,246,0,247,0,0,78,253,255,0,235,246,0,128,128,128,128,128,128,128,128,128,247,0,0,24,253,78,0,86,252,177,
+    0,27,252,0,242,0,0,20,252,255,0,39,252,0,128,128,128,128,128,128,128,128,242,0,0,15,252,196,0,80,253,59,
+    0,23,236,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,236,0,0,50,253,59,0,23,0,11,242,20,0,
+    3,0,137,242,255,0,39,128,128,128,128,0,21,248,39,0,56,252,255,0,39,247,0,0,20,252,255,0,39,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,0,106,248,196,0,201,252,255,0,39,0,137,242,255,0,39,128,128,128,0,63,242,
+    118,0,18,247,0,0,6,253,20,0,18,246,0,247,0,0,78,253,255,0,235,246,0,128,128,128,128,128,128,128,128,128,
+    252,0,0,84,253,157,0,139,253,98,0,103,252,157,0,24,252,0,252,0,0,137,253,255,0,177,253,0,0,20,252,255,
+    0,39,252,0,128,128,128,128,128,128,128,128,0,30,253,39,0,134,253,216,0,149,253,0,0,17,252,216,0,66,253,39,
+    0,15,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,0,60,253,78,0,36,242,
+    0,0,66,253,78,0,30,221,255,0,157,128,128,128,128,221,59,0,36,0,11,253,20,0,14,252,0,0,137,253,255,0,
+    177,252,0,128,128,128,128,0,21,253,39,0,94,253,216,0,199,252,0,0,78,253,255,0,235,128,128,128,252,0,0,30,
+    253,98,0,91,252,0,0,53,242,98,0,15,252,0,252,0,0,137,242,255,0,39,252,0,128,128,128,252,0,0,116,242,
+    216,0,66,253,39,0,15,236,0,0,216,253,255,0,98,128,128,128,128,252,0,0,127,242,235,0,252,253,255,0,98,252,
+    0,0,137,237,255,0,98,128,128,128,0,136,253,177,0,124,242,78,0,228,253,255,0,98,0,196,253,255,0,118,242,0,
+    0,216,253,255,0,98,128,128,128,128,128,128,128,128,0,151,253,196,0,122,242,59,0,225,253,255,0,98,252,0,0,137,
+    237,255,0,98,128,128,128,128,252,0,0,53,242,98,0,15,252,0,252,0,0,137,242,255,0,39,252,0,128,128,128,0,
+    30,253,39,0,134,242,216,0,66,253,39,0,15,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,0,
+    196,253,255,0,118,242,0,0,17,253,20,0,8,0,196,253,255,0,118,236,0,128,128,128,128,128,128,128,128,0,196,253,
+    255,0,118,242,0,0,100,253,118,0,45,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,0,151,253,196,
+    0,122,242,59,0,175,253,196,0,75,252,0,0,137,242,255,0,39,252,0,128,128,128,128,236,0,0,17,253,20,0,8,
+    236,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,128,252,0,0,53,242,98,0,231,253,255,
+    0,98,252,0,0,137,237,255,0,98,128,128,128,0,30,253,39,0,134,242,216,0,249,253,255,0,98,0,196,253,255,0,
+    118,242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,151,253,196,
+    0,122,242,59,0,225,253,255,0,98,252,0,0,137,237,255,0,98,128,128,128,128,247,0,0,6,242,20,0,8,247,0,
+    0,78,242,255,0,98,128,128,128,128,252,0,0,116,253,216,0,161,242,39,0,15,252,0,0,137,253,255,0,177,241,0,
+    128,128,128,128,128,128,128,128,0,75,253,98,0,183,253,255,0,207,247,98,0,15,252,0,0,196,237,255,0,39,252,0,
+    128,128,128,0,166,253,216,0,237,253,255,0,243,247,216,0,33,252,0,252,0,0,137,253,255,0,177,241,0,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,15,253,20,0,9,236,0,0,196,
+    253,255,0,118,236,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,196,253,255,0,171,242,98,0,15,252,0,
+    0,196,237,255,0,39,252,0,128,128,128,0,196,253,255,0,234,242,216,0,66,253,39,0,15,0,196,253,255,0,118,242,
+    0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    252,0,0,6,253,20,0,18,252,0,0,78,253,255,0,235,128,128,128,128,252,0,0,12,253,39,0,36,246,0,128,128,
+    128,128,128,128,128,128,0,53,248,98,0,91,0,137,248,255,0,235,128,128,128,0,116,253,216,0,228,253,255,0,235,252,
+    0,0,78,253,255,0,235,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    242,0,0,2,252,20,0,3,242,0,0,20,252,255,0,39,128,128,128,128,242,0,0,3,252,39,0,6,235,0,128,128,
+    128,128,128,128,128,128,247,0,0,30,247,98,0,15,247,0,0,78,247,255,0,39,128,128,128,247,0,0,66,253,216,0,
+    219,252,255,0,39,242,0,0,20,252,255,0,39,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,0,151,243,196,0,186,252,59,0,9,0,196,243,255,0,235,251,0,128,128,128,
+    0,91,243,118,0,109,251,0,0,15,253,20,0,9,236,0,0,196,253,255,0,118,236,0,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,0,196,253,255,0,118,242,0,0,83,253,98,0,38,0,196,253,255,0,118,242,0,0,216,253,255,
+    0,98,128,128,128,0,196,253,255,0,118,248,0,0,3,252,39,0,189,253,216,0,83,0,196,253,255,0,118,248,0,0,
+    20,252,255,0,39,252,0,128,128,128,128,0,196,253,255,0,118,253,0,0,72,253,235,0,219,252,20,0,3,252,0,0,
+    196,253,255,0,118,253,0,0,78,253,255,0,235,246,0,128,128,128,0,196,253,255,0,213,253,177,0,201,253,255,0,235,
+    246,0,0,196,243,255,0,235,246,0,128,128,128,0,196,253,255,0,192,248,137,0,136,252,118,0,18,252,0,0,196,253,
+    255,0,118,248,0,0,20,252,255,0,39,252,0,128,128,128,0,196,253,255,0,118,248,0,0,15,252,196,0,80,253,59,
+    0,23,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,0,11,248,20,0,18,0,137,248,255,0,235,
+    128,128,128,128,0,21,253,39,0,106,253,255,0,235,252,0,0,78,253,255,0,235,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,242,98,
+    0,68,253,0,0,8,247,98,0,38,252,0,242,255,0,177,253,0,0,20,247,255,0,98,252,0,128,128,128,252,255,0,
+    225,248,216,0,161,253,39,0,53,247,216,0,107,253,39,0,24,252,255,0,59,248,0,0,78,253,255,0,235,247,0,0,
+    157,253,255,0,157,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,75,
+    237,98,0,15,252,0,0,196,237,255,0,39,252,0,128,128,128,0,196,253,255,0,234,242,216,0,66,253,39,0,15,0,
+    196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,252,0,0,53,242,98,0,15,252,0,252,0,0,137,242,255,0,39,252,0,128,128,128,0,30,253,
+    39,0,134,242,216,0,66,253,39,0,15,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,0,151,253,196,0,122,242,59,0,175,253,196,0,75,252,0,0,137,242,255,
+    0,39,252,0,128,128,128,128,0,75,237,98,0,15,252,0,0,196,237,255,0,39,252,0,128,128,128,0,196,253,255,0,
+    234,242,216,0,66,253,39,0,15,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,0,196,253,255,0,149,242,59,0,175,253,196,0,75,0,196,237,255,0,39,252,0,
+    128,128,128,128,0,196,253,255,0,118,236,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,136,253,177,0,81,
+    236,0,252,0,0,53,237,98,0,38,252,0,0,137,237,255,0,98,128,128,128,0,30,253,39,0,134,242,216,0,249,253,
+    255,0,98,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,0,151,253,196,0,122,242,59,0,225,253,255,0,98,252,0,0,137,237,255,0,98,128,128,128,128,236,0,
+    0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,128,128,128,128,128,236,0,0,149,253,177,0,68,0,75,253,98,
+    0,45,253,0,0,30,247,98,0,15,252,0,0,196,253,255,0,118,253,0,0,78,247,255,0,39,252,0,128,128,128,0,
+    196,253,255,0,139,253,39,0,94,247,216,0,66,253,39,0,15,0,196,248,255,0,177,247,0,0,216,253,255,0,98,128,
+    128,128,128,0,196,253,255,0,128,253,20,0,14,247,0,0,17,253,20,0,8,0,196,253,255,0,118,236,0,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,252,0,0,53,237,98,0,38,252,0,0,137,237,255,0,98,
+    128,128,128,0,30,253,39,0,134,237,216,0,83,0,196,253,255,0,118,236,0,128,128,128,128,0,15,253,20,0,136,248,
+    235,0,217,246,0,252,0,0,137,248,255,0,235,246,0,128,128,128,252,0,0,42,248,78,0,86,252,177,0,27,252,0,
+    242,0,0,20,252,255,0,39,252,0,128,128,128,242,0,0,11,252,137,0,121,253,118,0,45,236,0,0,216,253,255,0,
+    98,128,128,128,0,45,237,59,0,175,253,196,0,75,0,196,237,255,0,39,252,0,128,128,128,128,0,116,253,216,0,149,
+    241,0,0,137,253,255,0,177,241,0,128,128,128,128,128,128,128,128,0,137,253,255,0,207,242,98,0,38,0,137,237,255,
+    0,98,128,128,128,0,137,253,255,0,243,242,216,0,83,0,137,253,255,0,177,241,0,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,0,106,253,196,0,154,242,59,0,23,252,0,0,78,242,255,0,98,128,128,128,128,
+    0,75,253,98,0,45,242,0,0,83,253,98,0,38,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,
+    128,128,128,128,128,0,15,253,20,0,136,253,235,0,163,253,0,0,18,252,235,0,53,253,20,0,8,252,0,0,137,253,
+    255,0,177,253,0,0,20,252,255,0,39,252,0,128,128,128,128,128,128,128,128,252,0,0,74,253,137,0,131,253,118,0,
+    119,252,137,0,21,252,0,247,0,0,78,253,255,0,235,246,0,128,128,128,128,128,128,128,128,128,252,98,0,23,232,0,
+    0,60,253,98,0,60,252,255,0,59,232,0,0,157,253,255,0,157,128,128,128,252,255,0,59,248,0,0,12,253,39,0,
+    36,247,0,0,157,253,255,0,157,252,255,0,59,248,0,0,78,253,255,0,235,247,0,0,157,253,255,0,157,128,128,128,
+    128,128,128,128,128,128,252,255,0,59,253,0,0,95,253,177,0,146,253,78,0,86,252,177,0,27,253,0,0,157,253,255,
+    0,157,252,255,0,59,253,0,0,137,253,255,0,177,253,0,0,20,252,255,0,39,253,0,0,157,253,255,0,157,128,128,
+    128,252,137,0,122,253,118,0,192,253,255,0,177,253,0,0,20,252,255,0,139,253,118,0,130,253,137,0,84,252,0,0,
+    196,248,255,0,177,253,0,0,20,247,255,0,98,252,0,128,128,128,252,0,0,196,253,255,0,223,253,196,0,136,253,0,
+    0,15,252,196,0,246,253,255,0,98,252,0,252,0,0,196,253,255,0,118,242,0,0,216,253,255,0,98,252,0,128,128,
+    128,128,0,75,253,98,0,45,242,0,0,83,253,98,0,38,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,
+    128,0,166,253,216,0,121,253,39,0,27,253,0,0,3,252,39,0,189,253,216,0,83,252,0,0,137,253,255,0,177,253,
+    0,0,20,252,255,0,39,252,0,128,128,128,128,252,0,0,11,253,20,0,86,253,235,0,219,252,20,0,3,252,0,247,
+    0,0,78,253,255,0,235,246,0,128,128,128,128,128,128,128,128,252,0,0,63,253,118,0,124,253,137,0,136,252,118,0,
+    18,252,0,252,0,0,137,253,255,0,177,253,0,0,20,252,255,0,39,252,0,128,128,128,0,45,253,59,0,133,253,196,
+    0,136,253,0,0,15,252,196,0,80,253,59,0,23,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,
+    0,75,253,98,0,45,242,0,0,83,253,98,0,38,0,196,253,255,0,118,242,0,0,216,253,255,0,98,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,151,253,196,0,122,242,59,0,225,253,255,
+    0,98,252,0,0,137,237,255,0,98,128,128,128,128,236,0,0,216,253,255,0,98,128,128,128,128,128,128,128,128,128,252,
+    0,0,74,242,137,0,121,253,118,0,45,252,0,0,137,242,255,0,39,252,0,128,128,128,252,0,0,95,242,177,0,27,
+    252,0,0,75,232,98,0,38,0,196,232,255,0,98,128,128,128,0,166,237,216,0,249,253,255,0,98,236,0,0,216,253,
+    255,0,98,128,128,128,128,242,0,0,18,252,235,0,53,253,20,0,8,242,0,0,20,252,255,0,39,252,0,128,128,128,
+    247,0,0,54,253,177,0,169,252,78,0,12,252,0,247,0,0,78,253,255,0,235,246,0,128,128,128,252,0,0,63,253,
+    118,0,124,253,137,0,127,246,0,252,0,0,137,253,255,0,177,241,0,128,128,128,0,45,253,59,0,164,253,255,0,195,
+    242,59,0,23,0,196,232,255,0,98,128,128,128,128,242,0,0,2,247,20,0,8,242,0,0,20,247,255,0,98,128,128,
+    128,128,247,0,0,66,253,216,0,202,247,39,0,15,247,0,0,78,253,255,0,235,246,0,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,0,181,248,235,0,169,253,20,0,18,246,0,0,196,248,255,0,177,241,0,128,
+    128,128,0,60,248,78,0,109,253,177,0,163,246,0,247,0,0,78,253,255,0,235,246,0,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,247,0,0,18,253,59,0,69,247,196,0,75,242,0,0,20,247,255,0,98,128,
+    128,128,242,0,0,9,247,118,0,45,0,6,253,20,0,18,0,78,253,255,0,235,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,36,253,118,0,109,0,15,248,20,0,14,241,0,0,196,248,255,
+    0,177,241,0,128,128,128,128,0,30,248,39,0,94,253,216,0,199,246,0,247,0,0,78,253,255,0,235,246,0,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,247,0,0,6,253,20,0,36,247,235,0,91,242,0,0,
+    20,247,255,0,98,128,128,128,247,0,0,54,253,177,0,169,247,78,0,30,247,0,0,78,253,255,0,235,246,0,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,151,248,196,0,154,253,59,0,54,246,0,0,196,248,
+    255,0,177,241,0,128,128,128,0,91,248,118,0,81,241,0,252,0,0,30,243,39,0,36,247,0,0,24,253,39,0,24,
+    252,0,0,196,243,255,0,235,247,0,0,157,253,255,0,157,128,128,128,128,252,235,0,69,248,20,0,92,253,255,0,253,
+    247,235,0,103,253,20,0,12,252,255,0,59,248,0,0,78,242,255,0,98,252,0,128,128,128,252,78,0,18,248,0,0,
+    24,242,78,0,30,252,0,0,36,236,78,0,54,246,0,0,118,236,255,0,177,246,0,128,128,128,128,0,118,252,255,0,
+    74,242,59,0,101,252,196,0,45,252,0,0,118,252,255,0,20,242,0,0,78,252,255,0,59,252,0,128,128,128,0,118,
+    252,255,0,20,242,0,0,60,252,196,0,91,253,59,0,45,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,118,252,255,0,20,242,0,0,6,252,20,0,186,
+    253,235,0,181,0,118,252,255,0,20,242,0,0,78,252,255,0,59,252,0,128,128,128,128,0,118,252,255,0,146,242,137,
+    0,131,252,118,0,27,252,0,0,118,236,255,0,177,246,0,128,128,128,128,251,0,0,54,242,59,0,41,251,0,251,0,
+    0,235,242,255,0,177,251,0,128,128,128,128,0,81,252,177,0,86,242,78,0,109,252,177,0,41,0,118,252,255,0,20,
+    242,0,0,78,252,255,0,59,128,128,128,0,118,252,255,0,56,242,39,0,106,252,255,0,59,0,118,230,255,0,59,128,
+    128,128,128,0,118,252,255,0,110,236,98,0,23,0,118,252,255,0,20,235,0,128,128,128,0,118,252,255,0,20,242,0,
+    0,6,252,20,0,5,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,128,0,54,252,118,0,136,242,137,
+    0,131,252,118,0,27,251,0,0,235,242,255,0,177,251,0,128,128,128,128,0,100,252,216,0,17,235,0,0,118,252,255,
+    0,20,235,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,118,252,255,0,74,242,59,0,41,251,0,0,118,
+    236,255,0,177,251,0,128,128,128,128,0,118,252,255,0,92,242,78,0,109,252,177,0,41,0,118,252,255,0,20,242,0,
+    0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,118,252,255,0,146,
+    242,137,0,131,252,118,0,27,0,118,236,255,0,177,251,0,128,128,128,128,0,27,252,59,0,5,242,0,0,18,252,59,
+    0,14,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,0,54,252,118,0,136,242,137,0,174,252,255,0,59,251,0,0,235,236,255,0,59,
+    128,128,128,128,251,0,0,54,236,59,0,14,251,0,0,235,236,255,0,59,128,128,128,128,0,81,252,177,0,86,242,78,
+    0,133,252,255,0,59,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,54,252,118,0,136,242,137,0,174,252,255,0,59,251,0,0,235,236,255,0,59,128,128,
+    128,128,235,0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,128,251,0,0,217,242,235,0,169,252,20,0,5,
+    251,0,0,235,242,255,0,177,251,0,128,128,128,251,0,0,145,242,157,0,109,251,0,0,30,252,78,0,12,0,98,252,
+    255,0,39,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,0,91,252,235,0,36,250,0,128,128,128,128,0,53,252,137,0,21,0,98,252,255,0,39,128,128,128,128,0,199,
+    253,216,0,133,252,0,0,183,253,216,0,149,0,235,253,255,0,157,252,0,0,216,253,255,0,177,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,181,253,196,0,121,252,0,0,166,253,196,0,136,241,0,0,30,252,78,0,12,253,0,
+    0,24,252,78,0,18,252,0,241,0,0,98,252,255,0,39,253,0,0,78,252,255,0,59,252,0,128,128,128,128,128,128,
+    128,128,128,252,0,0,27,247,59,0,134,252,255,0,89,253,59,0,119,252,255,0,104,253,59,0,45,252,0,0,118,225,
+    255,0,196,128,128,128,128,252,0,0,36,252,78,0,241,253,255,0,187,252,78,0,228,253,255,0,201,247,78,0,60,246,
+    0,0,235,253,255,0,157,252,0,0,216,253,255,0,177,246,0,128,128,128,128,128,128,128,128,128,246,157,0,247,253,255,
+    0,217,252,157,0,240,253,255,0,225,252,157,0,36,252,0,224,255,0,59,252,0,128,128,128,252,235,0,244,252,255,0,
+    237,253,235,0,243,252,255,0,238,247,235,0,54,252,0,252,0,0,118,252,255,0,20,253,0,0,98,252,255,0,39,241,
+    0,128,128,128,128,128,128,128,128,128,128,246,0,0,30,252,78,0,12,246,0,246,0,0,98,252,255,0,39,246,0,128,
+    128,128,128,251,0,0,181,253,196,0,219,252,255,0,205,247,196,0,45,251,0,0,235,236,255,0,59,128,128,128,0,27,
+    252,59,0,186,253,196,0,219,252,255,0,205,247,196,0,45,0,118,252,255,0,20,253,0,0,98,252,255,0,39,246,0,
+    128,128,128,128,128,128,128,128,128,0,100,252,216,0,53,253,39,0,122,252,255,0,72,253,39,0,27,251,0,251,0,0,
+    235,242,255,0,177,251,0,128,128,128,128,251,0,0,91,253,98,0,158,252,255,0,122,253,98,0,116,252,157,0,36,246,
+    0,0,98,252,255,0,39,253,0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,0,63,247,137,0,183,252,255,
+    0,155,253,137,0,131,252,118,0,27,0,118,236,255,0,177,251,0,128,128,128,128,246,0,0,98,252,255,0,39,246,0,
+    128,128,128,128,246,0,0,53,252,137,0,21,246,0,252,0,0,36,252,78,0,6,242,0,0,24,252,78,0,18,252,0,
+    252,0,0,118,252,255,0,20,242,0,0,78,252,255,0,59,252,0,128,128,128,128,252,196,0,133,252,59,0,186,253,196,
+    0,121,252,0,0,166,253,196,0,154,252,59,0,14,252,0,252,255,0,137,252,0,0,235,253,255,0,157,252,0,0,216,
+    253,255,0,177,246,0,128,128,128,128,128,128,128,128,128,252,78,0,124,252,177,0,86,253,78,0,116,252,177,0,94,253,
+    78,0,54,246,0,252,0,0,118,252,255,0,20,253,0,0,98,252,255,0,39,241,0,128,128,128,252,0,0,100,252,216,
+    0,17,253,0,0,98,252,255,0,39,253,0,0,12,252,39,0,9,252,0,241,0,0,98,252,255,0,39,253,0,0,78,
+    252,255,0,59,252,0,128,128,128,128,246,0,0,145,253,157,0,134,252,98,0,148,253,157,0,139,252,98,0,143,253,157,
+    0,121,246,0,0,235,253,255,0,157,252,0,0,216,253,255,0,177,252,0,0,196,253,255,0,196,128,128,128,128,128,128,
+    128,128,128,252,0,0,63,252,137,0,119,253,118,0,72,252,0,0,100,253,118,0,124,252,137,0,122,253,118,0,91,252,
+    0,0,118,252,255,0,20,242,0,0,78,252,255,0,59,252,0,128,128,128,128,251,0,0,72,247,78,0,12,241,0,251,
+    0,0,235,247,255,0,39,241,0,128,128,128,128,0,91,252,196,0,69,247,59,0,175,253,196,0,136,246,0,0,118,252,
+    255,0,20,247,0,0,216,253,255,0,177,246,0,128,128,128,128,128,128,128,128,128,0,36,252,78,0,169,247,177,0,94,
+    253,78,0,54,252,0,0,136,253,177,0,136,251,0,0,235,247,255,0,39,247,0,0,196,253,255,0,196,128,128,128,0,
+    18,252,39,0,202,247,216,0,66,253,39,0,27,252,0,0,196,253,255,0,196,0,118,252,255,0,20,247,0,0,216,253,
+    255,0,177,252,0,0,196,253,255,0,196,128,128,128,128,0,118,252,255,0,20,247,0,0,83,253,98,0,116,252,157,0,
+    112,253,98,0,75,0,118,252,255,0,20,242,0,0,78,252,255,0,59,252,0,128,128,128,128,128,128,128,128,128,0,54,
+    252,118,0,136,242,137,0,131,252,118,0,133,253,137,0,106,251,0,0,235,242,255,0,177,252,0,0,196,253,255,0,196,
+    128,128,128,128,0,83,252,216,0,33,0,98,252,255,0,39,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,75,
+    252,196,0,30,246,0,0,183,253,216,0,149,246,0,0,216,253,255,0,177,128,128,128,252,0,0,30,252,78,0,161,253,
+    177,0,122,252,0,0,98,252,255,0,39,252,0,128,128,128,128,128,128,128,128,128,0,54,253,59,0,112,252,196,0,30,
+    252,0,0,235,253,255,0,157,246,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,0,109,253,118,0,125,252,137,0,21,252,0,252,0,0,98,252,255,0,39,252,0,128,128,128,128,128,128,
+    128,128,128,252,0,0,53,252,137,0,121,253,118,0,81,246,0,0,216,253,255,0,177,128,128,128,128,246,0,0,17,253,
+    20,0,14,0,199,253,216,0,133,246,0,0,235,253,255,0,157,246,0,128,128,128,0,163,253,177,0,139,252,78,0,12,
+    252,0,252,0,0,98,252,255,0,39,252,0,128,128,128,128,128,128,128,128,128,252,0,0,75,252,196,0,80,253,59,0,
+    41,246,0,0,216,253,255,0,177,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,252,0,0,53,252,137,0,121,253,118,0,81,252,0,0,98,252,255,0,39,252,0,128,128,128,128,128,128,128,
+    128,128,0,109,253,118,0,125,252,137,0,21,252,0,0,235,253,255,0,157,246,0,128,128,128,128,0,18,253,20,0,12,
+    246,0,246,0,0,23,252,59,0,9,246,0,246,0,0,98,252,255,0,39,246,0,128,128,128,128,0,81,252,177,0,14,
+    253,0,0,98,252,255,0,39,253,0,0,54,252,177,0,41,0,118,252,255,0,20,253,0,0,98,252,255,0,39,253,0,
+    0,78,252,255,0,59,128,128,128,0,100,252,216,0,53,253,39,0,122,252,255,0,72,253,39,0,94,252,216,0,50,251,
+    0,0,235,242,255,0,177,251,0,128,128,128,128,0,72,252,157,0,103,253,98,0,158,252,255,0,122,253,98,0,116,252,
+    157,0,36,0,118,252,255,0,20,253,0,0,98,252,255,0,39,253,0,0,78,252,255,0,59,128,128,128,0,109,252,235,
+    0,18,253,0,0,98,252,255,0,39,253,0,0,72,252,235,0,54,246,0,0,98,252,255,0,39,246,0,128,128,128,128,
+    246,0,0,45,252,118,0,18,246,0,246,0,0,23,252,59,0,9,246,0,246,0,0,98,252,255,0,39,246,0,128,128,
+    128,128,128,128,128,128,128,0,18,247,39,0,122,252,255,0,72,247,39,0,9,0,118,230,255,0,59,128,128,128,128,0,
+    45,247,98,0,158,252,255,0,122,247,98,0,23,246,0,0,98,252,255,0,39,246,0,128,128,128,128,128,128,128,128,128,
+    246,0,0,45,252,118,0,18,246,0,251,0,0,18,253,20,0,12,251,0,0,235,253,255,0,157,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,0,54,252,118,0,136,253,137,0,84,0,118,252,255,0,20,252,0,128,128,128,128,0,
+    9,252,20,0,2,252,0,0,18,230,39,0,9,0,118,230,255,0,59,128,128,128,128,0,45,230,98,0,23,0,18,253,
+    20,0,12,0,235,253,255,0,157,128,128,128,128,128,128,128,128,128,128,235,0,0,66,252,216,0,50,235,0,0,78,252,
+    255,0,59,128,128,128,128,128,128,128,128,128,240,0,0,166,253,196,0,154,252,59,0,14,240,0,0,216,253,255,0,177,
+    251,0,128,128,128,128,128,128,128,128,128,246,0,0,68,252,177,0,94,253,78,0,54,251,0,246,0,0,98,252,255,0,
+    39,246,0,128,128,128,128,128,128,128,128,128,251,0,0,145,253,157,0,134,252,98,0,15,246,0,251,0,0,235,253,255,
+    0,157,240,0,128,128,128,128,128,128,128,128,128,0,63,252,137,0,119,253,118,0,72,240,0,0,118,252,255,0,20,235,
+    0,128,128,128,128,128,128,128,128,128,0,63,252,137,0,11,235,0,251,0,0,72,242,78,0,54,251,0,251,0,0,235,
+    242,255,0,177,251,0,128,128,128,128,0,91,252,196,0,69,242,59,0,101,252,196,0,45,0,118,252,255,0,20,242,0,
+    0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,0,118,252,255,0,20,253,0,0,68,252,177,0,27,253,0,0,
+    78,252,255,0,59,0,118,252,255,0,20,253,0,0,98,252,255,0,39,253,0,0,78,252,255,0,59,128,128,128,128,128,
+    128,128,128,128,0,118,252,255,0,20,253,0,0,38,252,98,0,15,253,0,0,78,252,255,0,59,0,118,252,255,0,20,
+    242,0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,0,54,252,118,0,136,242,137,0,131,252,118,0,27,251,
+    0,0,235,242,255,0,177,251,0,128,128,128,128,246,0,0,30,252,78,0,12,246,0,246,0,0,98,252,255,0,39,246,
+    0,128,128,128,128,251,0,0,181,253,196,0,219,252,255,0,39,246,0,251,0,0,235,247,255,0,39,246,0,128,128,128,
+    0,27,252,59,0,186,253,196,0,219,252,255,0,39,246,0,0,118,252,255,0,20,253,0,0,98,252,255,0,39,246,0,
+    128,128,128,128,0,36,252,78,0,6,253,0,0,98,252,255,0,39,246,0,246,0,0,98,252,255,0,39,246,0,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,63,247,137,0,183,252,255,0,155,247,137,0,32,
+    0,118,230,255,0,59,128,128,128,128,251,0,0,72,242,78,0,54,251,0,251,0,0,235,242,255,0,177,251,0,128,128,
+    128,128,0,91,252,196,0,69,242,59,0,101,252,196,0,45,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,
+    128,0,91,252,196,0,15,242,0,0,78,252,255,0,59,235,0,0,78,252,255,0,59,128,128,128,128,240,0,0,149,253,
+    177,0,146,252,78,0,18,240,0,0,216,253,255,0,177,251,0,128,128,128,246,0,0,15,252,39,0,189,253,216,0,149,
+    251,0,246,0,0,98,252,255,0,39,246,0,128,128,128,128,251,0,0,145,253,157,0,134,252,98,0,15,246,0,251,0,
+    0,235,253,255,0,157,240,0,128,128,128,0,9,252,20,0,219,253,235,0,145,240,0,0,118,252,255,0,20,235,0,128,
+    128,128,128,0,118,252,255,0,146,236,137,0,32,0,118,230,255,0,59,128,128,128,128,251,0,0,72,242,78,0,54,251,
+    0,251,0,0,235,242,255,0,177,251,0,128,128,128,128,0,91,252,196,0,69,242,59,0,101,252,196,0,45,0,118,252,
+    255,0,20,242,0,0,78,252,255,0,59,128,128,128,0,91,252,196,0,15,242,0,0,78,252,255,0,59,235,0,0,78,
+    252,255,0,59,128,128,128,128,246,0,0,68,247,177,0,146,252,78,0,18,246,0,0,98,247,255,0,177,251,0,128,128,
+    128,246,0,0,83,247,216,0,161,252,39,0,9,235,0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,0,9,
+    252,20,0,2,242,0,0,78,252,255,0,59,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,128,0,54,
+    252,118,0,136,242,137,0,131,252,118,0,27,251,0,0,235,242,255,0,177,251,0,128,128,128,128,235,0,0,24,252,78,
+    0,18,252,0,235,0,0,78,252,255,0,59,252,0,128,128,128,128,240,0,0,166,253,196,0,214,252,255,0,59,252,0,
+    240,0,0,216,247,255,0,59,252,0,128,128,128,246,0,0,23,252,59,0,175,253,196,0,214,252,255,0,59,252,0,246,
+    0,0,98,252,255,0,39,253,0,0,78,252,255,0,59,252,0,128,128,128,128,251,0,0,163,253,177,0,139,252,78,0,
+    12,253,0,0,78,252,255,0,59,252,0,251,0,0,235,253,255,0,157,247,0,0,78,252,255,0,59,252,0,128,128,128,
+    0,18,252,39,0,202,253,216,0,133,247,0,0,78,252,255,0,59,252,0,0,118,252,255,0,20,242,0,0,78,252,255,
+    0,59,252,0,128,128,128,128,0,118,252,255,0,164,242,157,0,187,252,255,0,180,253,157,0,121,0,118,225,255,0,196,
+    128,128,128,0,109,236,235,0,241,252,255,0,240,253,235,0,181,235,0,0,78,252,255,0,59,252,0,128,128,128,128,128,
+    128,128,128,128,128,0,36,230,78,0,18,0,118,230,255,0,59,128,128,128,128,0,118,252,255,0,74,236,59,0,14,0,
+    118,252,255,0,20,235,0,128,128,128,128,128,128,128,128,128,0,118,252,255,0,183,242,177,0,122,251,0,0,118,236,255,
+    0,177,251,0,128,128,128,0,100,236,216,0,161,252,39,0,9,235,0,0,78,252,255,0,59,128,128,128,128,128,128,128,
+    128,128,0,9,252,20,0,2,242,0,0,78,252,255,0,59,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,
+    128,128,0,54,252,118,0,136,242,137,0,131,252,118,0,27,251,0,0,235,242,255,0,177,251,0,128,128,128,128,246,0,
+    0,30,247,78,0,54,251,0,246,0,0,98,247,255,0,177,251,0,128,128,128,128,251,0,0,181,253,196,0,143,247,59,
+    0,41,251,0,251,0,0,235,253,255,0,157,240,0,128,128,128,0,27,252,59,0,186,253,196,0,121,240,0,0,118,252,
+    255,0,20,235,0,128,128,128,128,0,118,252,255,0,183,242,177,0,122,251,0,0,118,236,255,0,177,251,0,128,128,128,
+    0,118,252,255,0,219,242,216,0,161,252,39,0,9,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,0,54,252,118,0,136,242,137,0,131,252,118,0,27,251,0,0,235,242,255,0,
+    177,251,0,128,128,128,128,0,36,230,78,0,18,0,118,230,255,0,59,128,128,128,128,0,27,236,59,0,119,252,255,0,
+    59,235,0,0,78,252,255,0,59,128,128,128,240,0,0,50,253,59,0,101,252,196,0,45,240,0,0,216,253,255,0,177,
+    251,0,128,128,128,128,128,128,128,128,128,246,0,0,15,252,39,0,189,253,216,0,149,251,0,246,0,0,98,252,255,0,
+    39,246,0,128,128,128,128,128,128,128,128,128,251,0,0,18,253,20,0,103,252,235,0,36,246,0,251,0,0,235,253,255,
+    0,157,240,0,128,128,128,128,128,128,128,128,128,128,251,0,0,72,242,78,0,54,251,0,251,0,0,235,242,255,0,177,
+    251,0,128,128,128,128,0,91,252,196,0,69,242,59,0,101,252,196,0,45,0,118,252,255,0,20,242,0,0,78,252,255,
+    0,59,128,128,128,128,128,128,128,128,128,0,36,252,78,0,169,242,177,0,146,252,78,0,18,251,0,0,235,242,255,0,
+    177,251,0,128,128,128,0,18,252,39,0,202,242,216,0,161,252,39,0,9,0,118,252,255,0,20,242,0,0,78,252,255,
+    0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,54,252,118,0,136,242,137,0,131,252,118,0,27,251,
+    0,0,235,242,255,0,177,251,0,128,128,128,128,251,0,0,72,242,78,0,54,251,0,251,0,0,235,242,255,0,177,251,
+    0,128,128,128,128,0,91,252,196,0,69,242,59,0,101,252,196,0,45,0,118,252,255,0,20,242,0,0,78,252,255,0,
+    59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,100,252,216,0,53,242,39,0,106,252,255,0,59,251,0,0,
+    235,236,255,0,59,128,128,128,128,251,0,0,91,242,98,0,146,252,255,0,59,235,0,0,78,252,255,0,59,128,128,128,
+    240,0,0,17,253,20,0,86,252,235,0,54,240,0,0,216,253,255,0,177,251,0,128,128,128,128,251,0,0,127,247,137,
+    0,121,253,118,0,81,251,0,251,0,0,235,247,255,0,39,246,0,128,128,128,128,0,23,252,59,0,9,0,98,252,255,
+    0,39,128,128,128,128,128,128,128,128,128,0,83,252,216,0,33,250,0,128,128,128,128,128,128,128,128,128,0,8,252,20,
+    0,3,0,98,252,255,0,39,128,128,128,128,128,128,128,128,128,128,251,0,0,54,253,59,0,36,251,0,0,235,253,255,
+    0,157,128,128,128,128,128,128,128,128,128,251,0,0,199,253,216,0,133,245,0,128,128,128,128,128,128,128,128,128,251,0,
+    0,18,253,20,0,12,251,0,0,235,253,255,0,157,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,54,252,
+    118,0,136,253,137,0,84,0,118,252,255,0,20,252,0,128,128,128,128,0,9,252,20,0,2,252,0,235,0,0,50,247,
+    59,0,14,235,0,0,216,247,255,0,59,128,128,128,128,246,0,0,163,247,177,0,94,247,78,0,18,246,0,0,235,247,
+    255,0,39,246,0,128,128,128,246,39,0,202,247,216,0,33,246,0,246,255,0,20,235,0,128,128,128,128,246,98,0,152,
+    247,157,0,24,246,0,246,0,0,235,247,255,0,39,246,0,128,128,128,246,0,0,217,247,235,0,53,247,20,0,5,235,
+    0,0,216,247,255,0,59,128,128,128,128,235,0,0,100,247,118,0,27,0,81,225,177,0,136,0,118,225,255,0,196,128,
+    128,128,0,100,225,216,0,166,223,0,128,128,128,128,0,72,225,157,0,121,0,118,225,255,0,196,128,128,128,0,109,225,
+    235,0,181,0,27,247,59,0,36,235,0,0,118,247,255,0,157,235,0,128,128,128,128,0,36,247,78,0,116,247,177,0,
+    122,246,0,246,0,0,98,247,255,0,177,246,0,128,128,128,246,0,0,83,247,216,0,161,247,39,0,30,235,0,0,78,
+    247,255,0,196,128,128,128,128,246,0,0,60,247,157,0,139,247,98,0,75,246,0,0,98,247,255,0,177,246,0,128,128,
+    128,0,9,247,20,0,103,247,235,0,163,246,0,0,118,247,255,0,157,235,0,128,128,128,128,0,54,247,118,0,72,235,
+    0,251,0,0,72,242,78,0,54,251,0,251,0,0,235,242,255,0,177,251,0,128,128,128,128,0,91,252,196,0,69,242,
+    59,0,101,252,196,0,45,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,0,91,252,196,0,15,242,0,
+    0,78,252,255,0,59,235,0,0,78,252,255,0,59,128,128,128,128,240,0,0,149,253,177,0,146,252,78,0,18,240,0,
+    0,216,253,255,0,177,251,0,128,128,128,246,0,0,15,252,39,0,189,253,216,0,149,251,0,246,0,0,98,252,255,0,
+    39,246,0,128,128,128,128,128,128,128,128,128,246,0,0,91,252,235,0,36,246,0,228,0,128,128,128,128,246,0,0,53,
+    252,137,0,21,246,0,246,0,0,98,252,255,0,39,246,0,128,128,128,128,246,0,0,72,242,78,0,54,246,0,246,0,
+    0,235,242,255,0,177,246,0,128,128,128,128,252,0,0,91,252,196,0,69,242,59,0,101,252,196,0,45,252,0,252,0,
+    0,118,252,255,0,20,242,0,0,78,252,255,0,59,252,0,128,128,128,252,59,0,122,252,196,0,15,253,0,0,23,247,
+    59,0,101,252,196,0,91,253,59,0,45,252,255,0,137,247,0,0,98,247,255,0,177,252,0,0,196,253,255,0,196,128,
+    128,128,128,252,255,0,137,252,0,0,163,253,177,0,139,252,78,0,228,253,255,0,177,252,0,0,196,253,255,0,196,252,
+    255,0,137,252,0,0,235,253,255,0,157,252,0,0,216,253,255,0,177,252,0,0,196,253,255,0,196,128,128,128,128,128,
+    128,128,128,128,252,255,0,137,252,0,0,91,253,98,0,121,252,157,0,240,253,255,0,225,252,157,0,112,253,98,0,75,
+    252,255,0,137,247,0,0,98,241,255,0,59,252,0,128,128,128,252,235,0,136,252,20,0,2,253,0,0,91,241,235,0,
+    54,252,0,252,0,0,118,252,255,0,20,230,0,128,128,128,128,252,0,0,54,252,118,0,136,236,137,0,32,252,0,246,
+    0,0,235,236,255,0,59,252,0,128,128,128,128,246,0,0,30,247,78,0,54,246,0,246,0,0,98,247,255,0,177,246,
+    0,128,128,128,128,128,128,128,128,128,251,0,0,54,253,59,0,112,247,196,0,154,252,59,0,14,252,0,251,0,0,235,
+    253,255,0,157,247,0,0,78,252,255,0,59,252,0,128,128,128,128,128,128,128,128,128,251,0,0,235,253,255,0,172,247,
+    39,0,106,252,255,0,59,252,0,251,0,0,235,236,255,0,59,252,0,128,128,128,128,0,72,252,157,0,103,236,98,0,
+    143,253,157,0,121,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,0,36,236,78,0,54,246,0,0,118,236,255,0,177,246,0,128,128,128,128,0,118,252,255,0,74,242,59,0,101,
+    252,196,0,45,252,0,0,118,252,255,0,20,242,0,0,78,252,255,0,59,252,0,128,128,128,128,128,128,128,128,128,0,
+    118,252,255,0,183,242,177,0,201,252,255,0,59,252,0,0,118,230,255,0,59,252,0,128,128,128,0,118,252,255,0,219,
+    236,216,0,80,253,39,0,30,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,0,118,252,255,0,146,236,137,0,122,253,118,0,91,0,118,230,255,0,59,252,0,128,128,128,128,246,
+    0,0,30,241,78,0,18,252,0,246,0,0,98,241,255,0,59,252,0,128,128,128,128,251,0,0,181,253,196,0,143,241,
+    59,0,164,253,196,0,151,251,0,0,235,253,255,0,157,241,0,0,196,253,255,0,196,128,128,128,0,27,252,59,0,186,
+    253,196,0,121,241,0,0,151,253,196,0,151,0,118,252,255,0,20,230,0,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,109,252,235,0,36,253,20,0,12,241,0,0,15,253,20,0,15,251,0,0,235,253,255,
+    0,157,241,0,0,196,253,255,0,196,128,128,128,128,251,0,0,109,253,118,0,125,241,137,0,122,253,118,0,91,246,0,
+    0,98,241,255,0,59,252,0,128,128,128,128,0,36,230,78,0,18,0,118,230,255,0,59,128,128,128,128,0,118,252,255,
+    0,74,236,59,0,14,0,118,252,255,0,20,235,0,128,128,128,128,128,128,128,128,128,0,118,252,255,0,183,242,177,0,
+    122,251,0,0,118,236,255,0,177,251,0,128,128,128,0,118,252,255,0,219,242,216,0,149,251,0,0,118,252,255,0,20,
+    235,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,118,252,255,0,146,236,137,0,32,0,118,230,255,0,
+    59,128,128,128,128,0,36,230,78,0,18,0,118,230,255,0,59,128,128,128,128,0,118,252,255,0,74,236,59,0,14,0,
+    118,252,255,0,20,235,0,128,128,128,128,128,128,128,128,128,0,118,252,255,0,183,242,177,0,122,251,0,0,118,236,255,
+    0,177,251,0,128,128,128,0,118,252,255,0,219,242,216,0,149,251,0,0,118,252,255,0,20,235,0,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,246,0,0,30,241,78,0,18,252,0,246,0,0,98,241,255,
+    0,59,252,0,128,128,128,128,251,0,0,181,253,196,0,143,241,59,0,164,253,196,0,151,251,0,0,235,253,255,0,157,
+    241,0,0,196,253,255,0,196,128,128,128,0,27,252,59,0,186,253,196,0,121,241,0,0,151,253,196,0,151,0,118,252,
+    255,0,20,230,0,128,128,128,128,128,128,128,128,128,0,118,252,255,0,20,247,0,0,33,242,39,0,30,0,118,252,255,
+    0,20,247,0,0,216,242,255,0,196,128,128,128,128,0,118,252,255,0,20,247,0,0,83,247,98,0,219,253,255,0,196,
+    0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,128,0,109,252,235,0,36,253,20,0,12,241,0,0,196,253,
+    255,0,196,251,0,0,235,253,255,0,157,241,0,0,196,253,255,0,196,128,128,128,128,251,0,0,109,253,118,0,125,241,
+    137,0,122,253,118,0,91,246,0,0,98,241,255,0,59,252,0,128,128,128,128,0,36,252,78,0,6,236,0,0,60,253,
+    78,0,60,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    0,118,252,255,0,183,236,177,0,237,253,255,0,196,0,118,225,255,0,196,128,128,128,0,118,252,255,0,219,236,216,0,
+    246,253,255,0,196,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,0,72,242,78,0,54,0,235,242,255,0,177,128,128,128,128,0,54,253,59,0,134,252,255,
+    0,89,253,59,0,41,252,0,0,98,252,255,0,39,252,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,127,253,137,0,183,252,255,0,155,253,137,0,95,0,235,242,
+    255,0,177,128,128,128,128,251,0,0,72,242,78,0,54,251,0,0,235,242,255,0,177,128,128,128,128,251,0,0,54,247,
+    59,0,225,253,255,0,177,240,0,0,216,253,255,0,177,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,63,241,137,0,121,253,118,0,81,0,118,241,255,0,39,252,0,
+    128,128,128,128,0,36,252,78,0,6,236,0,0,60,253,78,0,60,0,118,252,255,0,20,236,0,0,196,253,255,0,196,
+    128,128,128,128,0,118,252,255,0,20,242,0,0,60,252,196,0,91,253,59,0,45,0,118,252,255,0,20,242,0,0,78,
+    252,255,0,59,252,0,128,128,128,0,118,252,255,0,20,247,0,0,50,253,59,0,101,252,196,0,45,252,0,0,118,252,
+    255,0,20,247,0,0,216,253,255,0,177,246,0,128,128,128,128,0,118,252,255,0,20,253,0,0,68,252,177,0,94,253,
+    78,0,54,246,0,0,118,252,255,0,20,253,0,0,98,252,255,0,39,241,0,128,128,128,0,118,252,255,0,56,253,39,
+    0,122,252,255,0,39,241,0,0,118,241,255,0,39,241,0,128,128,128,128,0,118,252,255,0,110,247,98,0,148,253,157,
+    0,109,246,0,0,118,252,255,0,20,247,0,0,216,253,255,0,177,246,0,128,128,128,0,118,252,255,0,20,247,0,0,
+    199,253,235,0,169,252,20,0,5,252,0,0,118,252,255,0,20,242,0,0,78,252,255,0,59,252,0,128,128,128,128,0,
+    118,252,255,0,20,242,0,0,36,252,118,0,133,253,137,0,106,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,
+    128,128,128,0,36,252,78,0,6,235,0,0,118,252,255,0,20,235,0,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,118,252,255,0,146,236,137,
+    0,32,0,118,230,255,0,59,128,128,128,128,246,78,0,6,242,0,0,24,247,78,0,60,246,255,0,20,242,0,0,78,
+    247,255,0,196,128,128,128,128,128,128,128,128,128,252,255,0,228,252,196,0,69,253,59,0,36,252,0,0,50,253,59,0,
+    101,252,196,0,241,253,255,0,196,252,255,0,137,252,0,0,235,253,255,0,157,252,0,0,216,253,255,0,177,252,0,0,
+    196,253,255,0,196,128,128,128,128,128,128,128,128,128,252,255,0,137,252,0,0,199,253,216,0,148,252,39,0,189,253,216,
+    0,149,252,0,0,196,253,255,0,196,252,255,0,137,247,0,0,98,252,255,0,39,247,0,0,196,253,255,0,196,128,128,
+    128,128,128,128,128,128,128,252,255,0,137,247,0,0,91,252,235,0,36,247,0,0,196,253,255,0,196,252,255,0,137,230,
+    0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,128,128,0,36,247,78,0,48,241,0,0,60,253,78,0,60,0,
+    118,247,255,0,157,241,0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,128,0,118,252,255,0,201,253,196,0,143,
+    252,59,0,9,247,0,0,196,253,255,0,196,0,118,252,255,0,20,253,0,0,98,252,255,0,39,247,0,0,196,253,255,
+    0,196,128,128,128,128,128,128,128,128,128,0,118,252,255,0,20,253,0,0,83,252,216,0,66,253,39,0,27,252,0,0,
+    196,253,255,0,196,0,118,252,255,0,20,247,0,0,216,253,255,0,177,252,0,0,196,253,255,0,196,128,128,128,128,128,
+    128,128,128,128,0,118,252,255,0,20,247,0,0,199,253,235,0,169,252,20,0,201,253,255,0,196,0,118,252,255,0,20,
+    242,0,0,78,247,255,0,196,128,128,128,128,128,128,128,128,128,128,246,0,0,30,247,78,0,54,246,0,246,0,0,98,
+    247,255,0,177,246,0,128,128,128,128,251,0,0,181,253,196,0,143,247,59,0,101,252,196,0,45,252,0,251,0,0,235,
+    253,255,0,157,247,0,0,78,252,255,0,59,252,0,128,128,128,0,27,252,59,0,186,253,196,0,121,247,0,0,60,252,
+    196,0,91,253,59,0,45,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,0,109,252,235,0,36,253,20,0,12,247,0,0,6,252,20,0,186,253,235,0,181,251,
+    0,0,235,253,255,0,157,247,0,0,78,252,255,0,59,252,0,128,128,128,128,251,0,0,109,253,118,0,125,247,137,0,
+    131,252,118,0,27,252,0,246,0,0,98,247,255,0,177,246,0,128,128,128,128,0,36,236,78,0,54,251,0,0,118,236,
+    255,0,177,251,0,128,128,128,128,0,118,252,255,0,74,242,59,0,101,252,196,0,45,0,118,252,255,0,20,242,0,0,
+    78,252,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,118,252,255,0,56,242,39,0,94,252,216,0,
+    50,0,118,236,255,0,177,251,0,128,128,128,128,0,118,252,255,0,110,242,98,0,68,251,0,0,118,252,255,0,20,235,
+    0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,246,0,0,30,247,78,0,54,246,0,246,0,0,98,247,255,
+    0,177,246,0,128,128,128,128,251,0,0,181,253,196,0,143,247,59,0,101,252,196,0,45,252,0,251,0,0,235,253,255,
+    0,157,247,0,0,78,252,255,0,59,252,0,128,128,128,0,27,252,59,0,186,253,196,0,121,247,0,0,60,252,196,0,
+    91,253,59,0,45,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,0,109,252,235,0,36,253,20,0,12,247,0,0,6,252,20,0,186,253,235,0,181,251,0,0,
+    235,253,255,0,157,247,0,0,78,252,255,0,59,252,0,128,128,128,128,251,0,0,109,253,118,0,125,247,137,0,131,252,
+    118,0,133,253,137,0,106,246,0,0,98,247,255,0,177,252,0,0,196,253,255,0,196,128,128,128,128,229,0,0,196,253,
+    255,0,196,128,128,128,128,229,0,0,106,253,137,0,106,0,36,236,78,0,54,246,0,0,118,236,255,0,177,246,0,128,
+    128,128,128,0,118,252,255,0,74,242,59,0,101,252,196,0,45,252,0,0,118,252,255,0,20,242,0,0,78,252,255,0,
+    59,252,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,118,252,255,0,56,242,39,0,94,252,216,0,50,252,
+    0,0,118,236,255,0,177,246,0,128,128,128,128,0,118,252,255,0,110,247,98,0,231,253,255,0,177,246,0,0,118,252,
+    255,0,20,247,0,0,216,253,255,0,177,246,0,128,128,128,0,118,252,255,0,20,247,0,0,199,253,235,0,169,252,20,
+    0,5,252,0,0,118,252,255,0,20,242,0,0,78,252,255,0,59,252,0,128,128,128,128,0,118,252,255,0,20,242,0,
+    0,36,252,118,0,133,253,137,0,106,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,128,128,251,0,0,72,
+    236,78,0,18,252,0,251,0,0,235,236,255,0,59,252,0,128,128,128,128,0,91,252,196,0,69,236,59,0,164,253,196,
+    0,151,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,128,0,118,252,255,0,20,236,0,0,151,253,196,0,
+    151,0,118,252,255,0,20,230,0,128,128,128,128,0,36,252,78,0,169,247,177,0,27,241,0,251,0,0,235,247,255,0,
+    39,241,0,128,128,128,251,0,0,199,247,216,0,66,247,39,0,9,252,0,240,0,0,216,247,255,0,59,252,0,128,128,
+    128,128,240,0,0,83,247,98,0,143,253,157,0,121,229,0,0,196,253,255,0,196,128,128,128,0,9,252,20,0,2,236,
+    0,0,196,253,255,0,196,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,128,128,0,54,252,118,0,136,236,
+    137,0,122,253,118,0,91,251,0,0,235,236,255,0,59,252,0,128,128,128,128,219,78,0,60,219,255,0,196,128,128,128,
+    128,241,59,0,134,252,255,0,89,242,59,0,45,241,0,0,98,252,255,0,39,241,0,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,36,252,78,
+    0,6,236,0,0,60,253,78,0,60,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,54,252,
+    118,0,136,236,137,0,122,253,118,0,91,251,0,0,235,236,255,0,59,252,0,128,128,128,128,252,78,0,42,230,0,0,
+    60,253,78,0,60,252,255,0,137,230,0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,128,252,196,0,133,252,59,
+    0,5,242,0,0,18,252,59,0,164,253,196,0,151,252,0,0,118,252,255,0,20,242,0,0,78,252,255,0,59,252,0,
+    128,128,128,128,128,128,128,128,128,252,0,0,100,252,216,0,53,253,39,0,24,252,0,0,33,253,39,0,94,252,216,0,
+    50,252,0,246,0,0,235,253,255,0,157,252,0,0,216,253,255,0,177,246,0,128,128,128,128,128,128,128,128,128,246,0,
+    0,217,253,235,0,152,252,20,0,202,253,235,0,163,246,0,241,0,0,98,252,255,0,39,241,0,128,128,128,128,128,128,
+    128,128,128,128,252,78,0,42,230,0,0,60,253,78,0,60,252,255,0,137,230,0,0,196,253,255,0,196,128,128,128,128,
+    252,255,0,137,247,0,0,75,252,196,0,30,247,0,0,196,253,255,0,196,252,255,0,137,247,0,0,98,252,255,0,39,
+    247,0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,128,252,255,0,137,252,0,0,163,253,177,0,139,252,78,0,
+    161,253,177,0,122,252,0,0,196,253,255,0,196,252,255,0,137,252,0,0,235,253,255,0,157,252,0,0,216,253,255,0,
+    177,252,0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,128,252,98,0,125,252,157,0,247,253,255,0,157,252,0,
+    0,216,253,255,0,225,252,157,0,112,253,98,0,75,252,0,0,118,247,255,0,157,252,0,0,216,247,255,0,59,252,0,
+    128,128,128,252,0,0,118,252,255,0,237,253,235,0,145,252,0,0,199,253,235,0,241,252,255,0,59,252,0,252,0,0,
+    118,252,255,0,20,242,0,0,78,252,255,0,59,252,0,128,128,128,128,128,128,128,128,128,128,0,36,252,78,0,6,236,
+    0,0,60,253,78,0,60,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,128,0,91,
+    252,196,0,69,253,59,0,36,247,0,0,18,252,59,0,164,253,196,0,151,251,0,0,235,253,255,0,157,247,0,0,78,
+    252,255,0,59,252,0,128,128,128,128,251,0,0,72,253,78,0,116,247,177,0,146,252,78,0,18,252,0,246,0,0,98,
+    247,255,0,177,246,0,128,128,128,128,128,128,128,128,128,251,0,0,145,253,157,0,134,247,98,0,116,252,157,0,36,252,
+    0,251,0,0,235,253,255,0,157,247,0,0,78,252,255,0,59,252,0,128,128,128,0,9,252,20,0,219,253,235,0,145,
+    247,0,0,72,252,235,0,69,253,20,0,15,0,118,252,255,0,20,236,0,0,196,253,255,0,196,128,128,128,128,128,128,
+    128,128,128,128,252,78,0,42,230,0,0,60,253,78,0,60,252,255,0,137,230,0,0,196,253,255,0,196,128,128,128,128,
+    128,128,128,128,128,252,196,0,133,252,59,0,5,242,0,0,18,252,59,0,164,253,196,0,151,252,0,0,118,252,255,0,
+    20,242,0,0,78,252,255,0,59,252,0,128,128,128,128,252,0,0,36,252,78,0,169,253,177,0,109,252,0,0,149,253,
+    177,0,146,252,78,0,18,252,0,246,0,0,235,253,255,0,157,252,0,0,216,253,255,0,177,246,0,128,128,128,246,0,
+    0,199,253,216,0,148,252,39,0,189,253,216,0,149,246,0,241,0,0,98,252,255,0,39,241,0,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,36,225,78,0,60,0,118,225,255,0,196,128,128,128,128,0,
+    27,230,59,0,210,253,255,0,196,229,0,0,196,253,255,0,196,128,128,128,235,0,0,18,252,59,0,164,253,196,0,151,
+    235,0,0,78,252,255,0,59,252,0,128,128,128,128,240,0,0,149,253,177,0,146,252,78,0,18,252,0,240,0,0,216,
+    253,255,0,177,246,0,128,128,128,246,0,0,15,252,39,0,189,253,216,0,149,246,0,246,0,0,98,252,255,0,39,241,
+    0,128,128,128,128,251,0,0,145,253,157,0,134,252,98,0,15,241,0,251,0,0,235,253,255,0,157,235,0,128,128,128,
+    0,9,252,20,0,219,253,235,0,145,235,0,0,118,252,255,0,20,230,0,128,128,128,128,0,118,252,255,0,146,231,137,
+    0,106,0,118,225,255,0,196,128,128,128,128,0,199,242,216,0,149,0,235,242,255,0,177,128,128,128,0,235,253,255,0,
+    225,247,177,0,122,0,235,253,255,0,157,246,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,235,253,
+    255,0,202,247,118,0,81,0,235,242,255,0,177,128,128,128,128,0,18,242,20,0,14,0,100,252,216,0,17,235,0,0,
+    118,252,255,0,20,235,0,128,128,128,128,128,128,128,128,128,0,27,252,59,0,186,253,196,0,121,240,0,251,0,0,235,
+    253,255,0,157,240,0,128,128,128,128,128,128,128,128,128,251,0,0,72,253,78,0,116,252,177,0,27,246,0,246,0,0,
+    98,252,255,0,39,246,0,128,128,128,128,128,128,128,128,128,246,0,0,38,252,98,0,148,253,157,0,109,251,0,240,0,
+    0,216,253,255,0,177,251,0,128,128,128,128,128,128,128,128,128,240,0,0,100,253,118,0,124,252,137,0,32,235,0,0,
+    78,252,255,0,59,128,128,128,128,128,128,128,128,128,235,0,0,42,252,137,0,32,0,199,242,216,0,149,0,235,242,255,
+    0,177,128,128,128,0,163,247,177,0,243,253,255,0,177,246,0,0,216,253,255,0,177,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,0,109,247,118,0,234,253,255,0,177,0,235,242,255,0,177,128,128,128,128,0,18,242,20,0,
+    14,246,0,0,83,252,216,0,33,246,0,246,0,0,98,252,255,0,39,246,0,128,128,128,128,128,128,128,128,128,251,0,
+    0,181,253,196,0,143,252,59,0,175,253,196,0,136,251,0,251,0,0,235,253,255,0,157,252,0,0,216,253,255,0,177,
+    251,0,128,128,128,128,128,128,128,128,128,0,81,252,177,0,86,253,78,0,48,252,0,0,66,253,78,0,109,252,177,0,
+    41,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,0,45,252,98,0,8,242,0,
+    0,30,252,98,0,23,219,255,0,196,128,128,128,128,219,137,0,106,0,199,253,216,0,133,251,0,0,235,253,255,0,157,
+    251,0,128,128,128,0,163,253,177,0,139,252,78,0,12,252,0,0,98,252,255,0,39,128,128,128,128,252,0,0,23,252,
+    59,0,9,251,0,0,54,242,59,0,41,251,0,251,0,0,235,242,255,0,177,251,0,128,128,128,128,251,0,0,72,242,
+    78,0,109,252,177,0,41,235,0,0,78,252,255,0,59,128,128,128,251,0,0,36,242,39,0,106,252,255,0,59,251,0,
+    0,235,236,255,0,59,128,128,128,128,0,72,252,157,0,103,242,98,0,146,252,255,0,59,0,118,252,255,0,20,242,0,
+    0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,0,54,252,118,0,136,242,137,0,174,252,255,0,59,251,0,0,
+    235,236,255,0,59,128,128,128,128,251,0,0,54,242,59,0,41,251,0,251,0,0,235,242,255,0,177,251,0,128,128,128,
+    128,0,81,252,177,0,86,242,78,0,109,252,177,0,41,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,
+    0,118,252,255,0,20,242,0,0,66,252,216,0,50,0,118,252,255,0,20,235,0,128,128,128,128,128,128,128,128,128,0,
+    118,252,255,0,20,242,0,0,6,252,20,0,5,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,128,0,
+    54,252,118,0,136,242,137,0,131,252,118,0,27,251,0,0,235,242,255,0,177,251,0,128,128,128,128,235,0,0,66,252,
+    216,0,50,235,0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,251,0,0,54,242,59,0,
+    119,252,255,0,59,251,0,0,235,236,255,0,59,128,128,128,128,0,81,252,177,0,86,242,78,0,133,252,255,0,59,0,
+    118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,0,54,252,118,0,136,242,137,0,174,252,255,0,59,251,0,0,235,236,255,0,59,128,128,128,128,246,0,0,83,241,
+    216,0,50,246,0,0,98,241,255,0,59,128,128,128,251,0,0,72,253,78,0,116,241,177,0,41,251,0,0,235,253,255,
+    0,157,240,0,128,128,128,128,128,128,128,128,128,0,27,252,59,0,240,253,255,0,180,247,59,0,41,251,0,0,118,236,
+    255,0,177,251,0,128,128,128,128,0,36,252,78,0,241,253,255,0,187,247,78,0,54,251,0,251,0,0,235,253,255,0,
+    157,240,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,100,252,
+    216,0,17,235,0,0,118,252,255,0,20,235,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,118,252,255,0,
+    74,242,59,0,41,251,0,0,118,236,255,0,177,251,0,128,128,128,128,0,118,252,255,0,92,242,78,0,109,252,177,0,
+    41,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,252,0,0,83,252,216,0,33,252,0,0,98,252,255,0,39,128,128,128,252,0,0,68,
+    252,177,0,27,245,0,128,128,128,128,128,128,128,128,128,0,54,247,59,0,9,0,235,247,255,0,39,128,128,128,128,0,
+    72,253,78,0,146,252,255,0,39,252,0,0,98,252,255,0,39,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,240,0,0,183,253,216,0,149,240,0,0,216,253,255,0,177,128,128,128,240,0,
+    0,149,253,177,0,122,234,0,128,128,128,128,128,128,128,128,128,246,0,0,23,247,59,0,41,246,0,0,98,247,255,0,
+    177,128,128,128,128,246,0,0,30,252,78,0,228,253,255,0,177,240,0,0,216,253,255,0,177,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,54,241,118,0,134,253,137,
+    0,95,0,118,241,255,0,39,252,0,128,128,128,128,0,9,241,20,0,3,252,0,0,100,252,216,0,17,235,0,0,118,
+    252,255,0,20,235,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,118,252,255,0,20,242,0,0,18,252,59,
+    0,14,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,128,0,118,252,255,0,20,247,0,0,149,253,177,
+    0,146,252,78,0,18,0,118,252,255,0,20,247,0,0,216,253,255,0,177,251,0,128,128,128,0,118,252,255,0,20,253,
+    0,0,15,252,39,0,189,253,216,0,149,251,0,0,118,252,255,0,20,253,0,0,98,252,255,0,39,246,0,128,128,128,
+    128,0,118,252,255,0,164,253,157,0,195,252,255,0,39,246,0,0,118,241,255,0,39,246,0,128,128,128,0,118,252,255,
+    0,237,247,235,0,53,253,20,0,14,251,0,0,118,252,255,0,20,247,0,0,216,253,255,0,177,251,0,128,128,128,128,
+    0,118,252,255,0,20,247,0,0,100,253,118,0,124,252,137,0,32,0,118,252,255,0,20,242,0,0,78,252,255,0,59,
+    128,128,128,128,0,199,247,216,0,33,0,235,247,255,0,39,128,128,128,0,163,253,177,0,207,252,255,0,39,252,0,0,
+    98,252,255,0,39,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,241,59,0,36,252,0,0,50,247,59,0,14,252,0,241,255,
+    0,157,252,0,0,216,247,255,0,59,252,0,128,128,128,128,252,255,0,174,247,78,0,116,252,177,0,94,247,78,0,154,
+    253,177,0,136,252,255,0,137,247,0,0,98,252,255,0,39,247,0,0,196,253,255,0,196,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,27,236,59,0,41,251,0,0,118,236,255,0,177,
+    251,0,128,128,128,128,0,118,252,255,0,92,242,78,0,109,252,177,0,41,0,118,252,255,0,20,242,0,0,78,252,255,
+    0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,251,0,0,54,
+    242,59,0,41,251,0,251,0,0,235,242,255,0,177,251,0,128,128,128,128,0,81,252,177,0,86,242,78,0,109,252,177,
+    0,41,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,0,54,252,118,0,136,242,137,0,131,252,118,0,27,251,0,0,235,242,255,0,177,251,0,128,128,128,128,
+    0,27,236,59,0,41,251,0,0,118,236,255,0,177,251,0,128,128,128,128,0,118,252,255,0,92,242,78,0,109,252,177,
+    0,41,0,118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,0,118,252,255,0,146,242,137,0,131,252,118,0,27,0,118,236,255,0,177,251,0,128,128,128,128,0,118,
+    252,255,0,20,235,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,72,252,157,0,12,235,0,251,0,0,
+    54,236,59,0,14,251,0,0,235,236,255,0,59,128,128,128,128,0,81,252,177,0,86,242,78,0,133,252,255,0,59,0,
+    118,252,255,0,20,242,0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,0,54,252,118,0,136,242,137,0,174,252,255,0,59,251,0,0,235,236,255,0,59,128,128,128,128,235,0,0,78,252,
+    255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,235,0,0,48,252,157,0,36,0,27,252,59,0,5,
+    253,0,0,23,247,59,0,41,251,0,0,118,252,255,0,20,253,0,0,98,247,255,0,177,251,0,128,128,128,128,0,118,
+    252,255,0,183,253,177,0,139,247,78,0,109,252,177,0,41,0,118,247,255,0,157,247,0,0,78,252,255,0,59,128,128,
+    128,0,118,252,255,0,219,253,216,0,133,247,0,0,66,252,216,0,50,0,118,252,255,0,20,235,0,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,251,0,0,54,236,59,0,14,251,0,0,235,236,255,0,59,
+    128,128,128,128,0,81,252,177,0,86,236,78,0,18,0,118,252,255,0,20,235,0,128,128,128,0,100,252,216,0,53,247,
+    39,0,6,246,0,251,0,0,235,247,255,0,39,246,0,128,128,128,128,251,0,0,91,247,98,0,148,253,157,0,109,251,
+    0,240,0,0,216,253,255,0,177,251,0,128,128,128,240,0,0,199,253,235,0,169,252,20,0,5,235,0,0,78,252,255,
+    0,59,128,128,128,128,0,63,236,137,0,131,252,118,0,27,0,118,236,255,0,177,251,0,128,128,128,128,0,72,253,78,
+    0,48,240,0,0,235,253,255,0,157,240,0,128,128,128,128,128,128,128,128,128,0,235,253,255,0,180,241,59,0,14,0,
+    235,236,255,0,59,128,128,128,128,0,235,253,255,0,187,241,78,0,18,0,235,253,255,0,157,240,0,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,109,253,118,0,125,241,137,0,32,252,0,0,98,241,255,0,
+    59,128,128,128,128,0,27,252,59,0,5,242,0,0,18,252,59,0,14,0,118,252,255,0,20,242,0,0,78,252,255,0,
+    59,128,128,128,128,128,128,128,128,128,0,100,252,216,0,53,253,39,0,24,252,0,0,33,253,39,0,94,252,216,0,50,
+    251,0,0,235,253,255,0,157,252,0,0,216,253,255,0,177,251,0,128,128,128,128,128,128,128,128,128,251,0,0,217,253,
+    235,0,152,252,20,0,202,253,235,0,163,251,0,246,0,0,98,252,255,0,39,246,0,128,128,128,128,128,128,128,128,128,
+    128,252,59,0,32,230,0,0,45,253,59,0,45,252,255,0,137,230,0,0,196,253,255,0,196,128,128,128,128,252,255,0,
+    137,247,0,0,68,252,177,0,27,247,0,0,196,253,255,0,196,252,255,0,137,247,0,0,98,252,255,0,39,247,0,0,
+    196,253,255,0,196,128,128,128,128,128,128,128,128,128,252,255,0,137,252,0,0,145,253,157,0,134,252,98,0,148,253,157,
+    0,109,252,0,0,196,253,255,0,196,252,255,0,137,252,0,0,235,253,255,0,157,252,0,0,216,253,255,0,177,252,0,
+    0,196,253,255,0,196,128,128,128,252,235,0,136,252,20,0,237,253,255,0,157,252,0,0,216,253,255,0,183,252,20,0,
+    186,253,235,0,181,252,0,0,118,247,255,0,157,252,0,0,216,247,255,0,59,252,0,128,128,128,128,252,0,0,118,252,
+    255,0,128,253,118,0,72,252,0,0,100,253,118,0,160,252,255,0,59,252,0,252,0,0,118,252,255,0,20,242,0,0,
+    78,252,255,0,59,252,0,128,128,128,128,0,27,252,59,0,5,242,0,0,18,252,59,0,14,0,118,252,255,0,20,242,
+    0,0,78,252,255,0,59,128,128,128,128,0,36,252,78,0,169,253,177,0,109,252,0,0,149,253,177,0,146,252,78,0,
+    18,251,0,0,235,253,255,0,157,252,0,0,216,253,255,0,177,251,0,128,128,128,251,0,0,199,253,216,0,148,252,39,
+    0,189,253,216,0,149,251,0,246,0,0,98,252,255,0,39,246,0,128,128,128,128,128,128,128,128,128,251,0,0,18,253,
+    20,0,103,252,235,0,53,253,20,0,14,251,0,251,0,0,235,253,255,0,157,252,0,0,216,253,255,0,177,251,0,128,
+    128,128,128,0,63,252,137,0,119,253,118,0,72,252,0,0,100,253,118,0,124,252,137,0,32,0,118,252,255,0,20,242,
+    0,0,78,252,255,0,59,128,128,128,128,0,27,252,59,0,5,242,0,0,18,252,59,0,14,0,118,252,255,0,20,242,
+    0,0,78,252,255,0,59,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,0,54,252,118,0,136,242,137,0,174,252,255,0,59,251,0,0,235,236,255,0,59,128,128,128,128,235,0,0,78,252,
+    255,0,59,128,128,128,128,128,128,128,128,128,128,251,0,0,217,242,235,0,169,252,20,0,5,251,0,0,235,242,255,0,
+    177,251,0,128,128,128,251,0,0,145,242,157,0,109,251,0,0,27,230,59,0,14,0,118,230,255,0,59,128,128,128,128,
+    0,36,236,78,0,133,252,255,0,59,235,0,0,78,252,255,0,59,128,128,128,240,0,0,33,253,39,0,94,252,216,0,
+    50,240,0,0,216,253,255,0,177,251,0,128,128,128,128,246,0,0,60,252,157,0,107,253,98,0,68,251,0,246,0,0,
+    98,252,255,0,39,246,0,128,128,128,251,0,0,18,253,20,0,103,252,235,0,36,246,0,251,0,0,235,253,255,0,157,
+    240,0,128,128,128,128,0,63,252,137,0,246,253,255,0,210,241,137,0,32,0,118,230,255,0,59,128,128,128,128,240,0,
+    0,183,247,216,0,50,240,0,0,216,247,255,0,59,128,128,128,246,0,0,30,252,78,0,161,247,177,0,41,246,0,0,
+    98,252,255,0,39,246,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,18,247,39,0,
+    107,252,216,0,33,246,0,0,118,247,255,0,157,240,0,128,128,128,128,0,45,247,98,0,121,252,157,0,24,246,0,246,
+    0,0,98,252,255,0,39,246,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,246,0,0,
+    53,252,137,0,121,247,118,0,27,240,0,0,216,247,255,0,59,128,128,128,128,240,0,0,17,247,20,0,5,0,83,252,
+    216,0,33,0,98,252,255,0,39,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,0,8,252,20,0,3,0,100,247,216,0,133,240,0,0,118,247,255,0,157,240,0,128,128,128,0,81,247,
+    177,0,139,252,78,0,12,246,0,246,0,0,98,252,255,0,39,246,0,128,128,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,246,0,0,83,252,216,0,66,247,39,0,9,240,0,0,216,247,255,0,59,128,128,128,128,246,
+    0,0,60,252,157,0,107,247,98,0,23,246,0,0,98,252,255,0,39,246,0,128,128,128,128,128,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,128,0,54,247,118,0,125,252,137,0,21,246,0,0,118,247,255,0,157,240,0,128,128,128,
+    128,0,9,247,20,0,12,240,0,252,0,0,81,241,177,0,27,247,0,0,136,253,177,0,136,252,0,0,118,241,255,0,
+    39,247,0,0,196,253,255,0,196,128,128,128,252,39,0,121,247,216,0,231,252,255,0,72,247,39,0,175,253,216,0,166,
+    252,255,0,137,247,0,0,98,241,255,0,59,252,0,128,128,128,128,252,98,0,53,247,0,0,38,241,98,0,23,252,0,
+};
@@ -2,8 +2,14 @@
 #include <cstdlib>
 #include <cstdio>
 #include <cstring>
+#include <cmath>
+#include <ctime>
+#include <string>
 #include <vector>
+#include <atomic>
+#include <thread>
 #include <mutex>
+#include <condition_variable>
 
 #include <jni.h>
 #include <android/input.h>
@@ -12,26 +18,49 @@
 
 #include <EGL/egl.h>
 #include <GLES3/gl3.h>
+#ifdef VULKAN_OVERLAY
+#include <vulkan/vulkan.h>
+#include <vulkan/vulkan_android.h>
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include "pl/Hook.h"
 #include "pl/Gloss.h"
 #include "pl/PreloaderInput.h"
 
 #include "ImGui/imgui.h"
+#include "ImGui/imgui_internal.h"
 #include "ImGui/backends/imgui_impl_opengl3.h"
+#ifdef VULKAN_OVERLAY
+#include "ImGui/backends/imgui_impl_vulkan.h"
+#endif
 #include "ImGui/backends/imgui_impl_android.h"
+#include "font_prebaked.h"
+#include "draw_trace.h"
+#include "menu.h"
+#include "overlay_alloc.h"
+#ifdef VULKAN_OVERLAY
+#include "vulkan_overlay.h"
+#endif
 
 #define LOG_TAG "AnarchyArray"
 #define LOGI(...) __android_log_print(ANDROID_LOG_INFO,  LOG_TAG, __VA_ARGS__)
 #define LOGW(...) __android_log_print(ANDROID_LOG_WARN,  LOG_TAG, __VA_ARGS__)
 #define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
 
-static bool g_Initialized = false;
+// Whichever the game draws with first: a game using GL over Vulkan (ANGLE) is drawn on in eglSwapBuffers
+enum class Renderer { GL, Vulkan };
+
+static std::atomic<bool> g_Initialized{false};
+static Renderer g_Renderer = Renderer::GL;
 static int g_Width = 0;
 static int g_Height = 0;
 static ANativeWindow* g_Window = nullptr;
-static bool g_touchCapturedByGui = false;
-static std::mutex g_boundsMutex;
 static bool g_PatchesReady = false;
 static std::vector<uintptr_t> g_PatchAddrs;
 static std::vector<std::vector<uint8_t>> g_Originals;
@@ -76,12 +105,143 @@ static void RestoreGL(const GLState& s) {
     s.scissorTest ? glEnable(GL_SCISSOR_TEST) : glDisable(GL_SCISSOR_TEST);
 }
 
+// Input never touches ImGuiIO directly: whichever input path is active (one InputConsumer
+// hook or the Preloader touch callback, never both) is the single producer of this ring,
+// and the render thread drains it into ImGuiIO at the start of Render().
+static constexpr uint32_t kInputRingSize = 256; // power of two
+
+struct InputRing {
+    alignas(64) std::atomic<uint32_t> head{0}; // written by the input thread
+    alignas(64) std::atomic<uint32_t> tail{0}; // written by the render thread
+    alignas(64) ImGui_ImplAndroid_InputEvent events[kInputRingSize];
+    std::atomic<uint32_t> dropped{0};
+};
+
+static InputRing g_inputRing;
+
+static bool PushInput(const ImGui_ImplAndroid_InputEvent& e) {
+    uint32_t head = g_inputRing.head.load(std::memory_order_relaxed);
+    if (head - g_inputRing.tail.load(std::memory_order_acquire) == kInputRingSize) {
+        g_inputRing.dropped.fetch_add(1, std::memory_order_relaxed); // render thread stalled, drop newest
+        return false;
+    }
+    g_inputRing.events[head & (kInputRingSize - 1)] = e;
+    g_inputRing.head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+static int64_t NowNs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts); // same time base as AMotionEvent_getEventTime
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static bool IsMoveEvent(const ImGui_ImplAndroid_InputEvent& e) {
+    return e.Type == AINPUT_EVENT_TYPE_MOTION &&
+        (e.Action == AMOTION_EVENT_ACTION_MOVE || e.Action == AMOTION_EVENT_ACTION_HOVER_MOVE);
+}
+
+// Touch-to-frame latency: hardware timestamp of the oldest event applied this frame
+// versus the moment the frame is submitted.
+struct InputLatency {
+    int64_t pendingEventTime = 0; // oldest event drained into the current frame, 0 if none
+    float lastMs = 0.0f;
+    float avgMs = 0.0f;
+    float maxMs = 0.0f;
+    uint32_t coalesced = 0;
+};
+
+static InputLatency g_inputLatency;
+
+static void DrainInput() {
+    uint32_t tail = g_inputRing.tail.load(std::memory_order_relaxed);
+    uint32_t head = g_inputRing.head.load(std::memory_order_acquire);
+    int64_t oldest = 0;
+    for (; tail != head; tail++) {
+        const ImGui_ImplAndroid_InputEvent& e = g_inputRing.events[tail & (kInputRingSize - 1)];
+        if (e.EventTime != 0 && (oldest == 0 || e.EventTime < oldest)) oldest = e.EventTime;
+        // Only the last MOVE of a pointer matters; anything else in between (DOWN/UP,
+        // another pointer's button, a key) keeps this one so ordering is preserved.
+        bool superseded = false;
+        if (IsMoveEvent(e)) {
+            for (uint32_t i = tail + 1; i != head; i++) {
+                const ImGui_ImplAndroid_InputEvent& next = g_inputRing.events[i & (kInputRingSize - 1)];
+                if (!IsMoveEvent(next)) break;
+                if (next.PointerId == e.PointerId && next.Action == e.Action) {
+                    superseded = true;
+                    break;
+                }
+            }
+        }
+        if (superseded) {
+            g_inputLatency.coalesced++;
+            continue;
+        }
+        ImGui_ImplAndroid_ProcessInputEvent(&e);
+    }
+    g_inputRing.tail.store(tail, std::memory_order_release);
+    g_inputLatency.pendingEventTime = oldest;
+}
+
+static void RecordInputLatency() {
+    if (g_inputLatency.pendingEventTime == 0) return;
+    float ms = (float)(NowNs() - g_inputLatency.pendingEventTime) / 1000000.0f;
+    g_inputLatency.pendingEventTime = 0;
+    g_inputLatency.lastMs = ms;
+    g_inputLatency.avgMs = g_inputLatency.avgMs == 0.0f ? ms : g_inputLatency.avgMs * 0.9f + ms * 0.1f;
+    if (ms > g_inputLatency.maxMs) g_inputLatency.maxMs = ms;
+}
+
+// Legacy path: ImGui has a single mouse, driven by the first finger down until it lifts. Other fingers
+// are left out, except that a POINTER_DOWN takes the mouse over if the finger driving it already lifted.
+static int g_legacyPointer = -1;
+
+static void PushAndroidInput(const AInputEvent* event) {
+    ImGui_ImplAndroid_InputEvent e;
+    if (!ImGui_ImplAndroid_CaptureInputEvent(event, &e)) return;
+    if (e.Type == AINPUT_EVENT_TYPE_MOTION) {
+        switch (e.Action) {
+            case AMOTION_EVENT_ACTION_DOWN:
+                g_legacyPointer = e.PointerId;
+                break;
+            case AMOTION_EVENT_ACTION_POINTER_DOWN:
+                if (g_legacyPointer != -1) return;
+                g_legacyPointer = e.PointerId;
+                e.Action = AMOTION_EVENT_ACTION_DOWN;
+                break;
+            case AMOTION_EVENT_ACTION_POINTER_UP:
+                if (e.PointerId != g_legacyPointer) return;
+                g_legacyPointer = -1;
+                e.Action = AMOTION_EVENT_ACTION_UP;
+                break;
+            case AMOTION_EVENT_ACTION_UP:
+            case AMOTION_EVENT_ACTION_CANCEL:
+                g_legacyPointer = -1;
+                break;
+            case AMOTION_EVENT_ACTION_MOVE:
+            {
+                // MOVE carries every pointer and no action index: follow the one driving the mouse
+                if (g_legacyPointer == -1) return;
+                size_t count = AMotionEvent_getPointerCount(event);
+                size_t n = 0;
+                while (n < count && AMotionEvent_getPointerId(event, n) != g_legacyPointer) n++;
+                if (n == count) return;
+                e.PointerId = (int8_t)g_legacyPointer;
+                e.X = AMotionEvent_getX(event, n);
+                e.Y = AMotionEvent_getY(event, n);
+                break;
+            }
+        }
+    }
+    PushInput(e);
+}
+
 // InputConsumer::initializeMotionEvent
 static void (*initMotionEvent)(void*, void*, void*) = nullptr;
 static void HookInput1(void* thiz, void* a1, void* a2) {
     if (initMotionEvent) initMotionEvent(thiz, a1, a2);
     if (thiz && g_Initialized) {
-        ImGui_ImplAndroid_HandleInputEvent((AInputEvent*)thiz);
+        PushAndroidInput((AInputEvent*)thiz);
     }
 }
 
@@ -90,84 +250,205 @@ static int32_t (*Consume)(void*, void*, bool, long, uint32_t*, AInputEvent**) =
 static int32_t HookInput2(void* thiz, void* a1, bool a2, long a3, uint32_t* a4, AInputEvent** event) {
     int32_t result = Consume ? Consume(thiz, a1, a2, a3, a4, event) : 0;
     if (result == 0 && event && *event && g_Initialized) {
-        ImGui_ImplAndroid_HandleInputEvent(*event);
+        PushAndroidInput(*event);
     }
     return result;
 }
 
+// consume() builds motion events with initializeMotionEvent(): hooking both would push every touch twice.
+// initializeMotionEvent() is the fallback, it doesn't see key events.
 static void HookLegacyInput() {
-    void* sym1 = (void*)GlossSymbol(GlossOpen("libinput.so"),
-        "_ZN7android13InputConsumer21initializeMotionEventEPNS_11MotionEventEPKNS_12InputMessageE", nullptr);
-    if (sym1) {
-        GHook h = GlossHook(sym1, (void*)HookInput1, (void**)&initMotionEvent);
-        if (h) {
-            LOGI("HookInput1: successfully hooked InputConsumer::initializeMotionEvent");
-        }
-    }
     void* sym2 = (void*)GlossSymbol(GlossOpen("libinput.so"),
         "_ZN7android13InputConsumer7consumeEPNS_26InputEventFactoryInterfaceEblPjPPNS_10InputEventE", nullptr);
     if (sym2) {
         GHook h = GlossHook(sym2, (void*)HookInput2, (void**)&Consume);
         if (h) {
             LOGI("HookInput2: successfully hooked InputConsumer::consume");
+            return;
+        }
+    }
+    void* sym1 = (void*)GlossSymbol(GlossOpen("libinput.so"),
+        "_ZN7android13InputConsumer21initializeMotionEventEPNS_11MotionEventEPKNS_12InputMessageE", nullptr);
+    if (sym1) {
+        GHook h = GlossHook(sym1, (void*)HookInput1, (void**)&initMotionEvent);
+        if (h) {
+            LOGI("HookInput1: successfully hooked InputConsumer::initializeMotionEvent");
         }
     }
 }
 
-struct WindowBounds {
-    float x, y, w, h;
-    bool visible;
+// Screen rects of every visible top-level ImGui window (popups and menus included), collected
+// after EndFrame so new panels are picked up without any bookkeeping. Kept as a flat
+// structure-of-arrays padded to a multiple of 4 so the hit test checks 4 rects per step.
+static constexpr int kMaxHitRects = 32;
+
+struct HitRects {
+    alignas(16) float x0[kMaxHitRects];
+    alignas(16) float y0[kMaxHitRects];
+    alignas(16) float x1[kMaxHitRects];
+    alignas(16) float y1[kMaxHitRects];
+    int count; // multiple of 4, padding entries are empty rects
 };
 
-static WindowBounds g_bounds[3] = {
-    {0,0,0,0,false}, // menu
-    {0,0,0,0,false}, // info
-    {0,0,0,0,false}  // keypad
+static HitRects g_hitRects = {};       // render thread working copy
+static HitRects g_lastPublished = {};
+
+// Copy seen by the input thread, published once per frame through a seqlock.
+// The render thread is the only writer and never waits; readers retry only if
+// they raced a publish, so a touch never blocks behind a frame or vice versa.
+struct PublishedHitRects {
+    std::atomic<float> x0[kMaxHitRects], y0[kMaxHitRects], x1[kMaxHitRects], y1[kMaxHitRects];
+    std::atomic<int> count{0};
 };
 
-static void UpdateBounds(int index) {
-    std::lock_guard<std::mutex> lock(g_boundsMutex);
-    ImVec2 pos = ImGui::GetWindowPos();
-    ImVec2 size = ImGui::GetWindowSize();
-    g_bounds[index] = {pos.x, pos.y, size.x, size.y, true};
+static std::atomic<uint32_t> g_hitRectsSeq{0}; // odd while a publish is in progress
+static PublishedHitRects g_publishedHitRects;
+
+static void PublishHitRects() {
+    const HitRects& r = g_hitRects;
+    if (memcmp(&r, &g_lastPublished, sizeof(r)) == 0) return; // nothing moved
+    uint32_t seq = g_hitRectsSeq.load(std::memory_order_relaxed);
+    g_hitRectsSeq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (int i = 0; i < r.count; i++) {
+        g_publishedHitRects.x0[i].store(r.x0[i], std::memory_order_relaxed);
+        g_publishedHitRects.y0[i].store(r.y0[i], std::memory_order_relaxed);
+        g_publishedHitRects.x1[i].store(r.x1[i], std::memory_order_relaxed);
+        g_publishedHitRects.y1[i].store(r.y1[i], std::memory_order_relaxed);
+    }
+    g_publishedHitRects.count.store(r.count, std::memory_order_relaxed);
+    g_hitRectsSeq.store(seq + 2, std::memory_order_release);
+    memcpy(&g_lastPublished, &r, sizeof(r));
 }
 
-static bool HandleTouchEvent(int action, int pointerId, float x, float y) {
-    ImGuiIO& io = ImGui::GetIO();
-    io.MousePos = ImVec2(x, y);
-    bool isTouchInsideGui = false;
-    {
-        std::lock_guard<std::mutex> lock(g_boundsMutex);
-        auto InBounds = [&](const WindowBounds& b) {
-            return b.visible && x >= b.x && x <= (b.x + b.w) && y >= b.y && y <= (b.y + b.h);
-        };
-        for (int i = 0; i < 3; i++) {
-            if (InBounds(g_bounds[i])) {
-                isTouchInsideGui = true;
-                break;
-            }
+// ImGuiContextHookType_EndFramePost
+static void CollectHitRects(ImGuiContext* ctx, ImGuiContextHook*) {
+    HitRects& r = g_hitRects;
+    memset(&r, 0, sizeof(r));
+    int n = 0;
+    for (ImGuiWindow* w : ctx->Windows) {
+        if (!w->Active || w->Hidden) continue;
+        if ((w->Flags & ImGuiWindowFlags_ChildWindow) && !(w->Flags & ImGuiWindowFlags_Popup)) continue; // inside its parent
+        if (w->Flags & (ImGuiWindowFlags_Tooltip | ImGuiWindowFlags_NoMouseInputs)) continue;
+        if (n == kMaxHitRects) break;
+        r.x0[n] = w->Pos.x;
+        r.y0[n] = w->Pos.y;
+        r.x1[n] = w->Pos.x + w->Size.x;
+        r.y1[n] = w->Pos.y + w->Size.y;
+        n++;
+    }
+    for (; n & 3; n++) {
+        r.x0[n] = r.y0[n] = 1.0f; // x0 > x1: never hit
+    }
+    r.count = n;
+    PublishHitRects();
+}
+
+static void ReadHitRects(HitRects& out) {
+    uint32_t seq0, seq1;
+    do {
+        seq0 = g_hitRectsSeq.load(std::memory_order_acquire);
+        int count = g_publishedHitRects.count.load(std::memory_order_relaxed);
+        if (count > kMaxHitRects) count = kMaxHitRects;
+        for (int i = 0; i < count; i++) {
+            out.x0[i] = g_publishedHitRects.x0[i].load(std::memory_order_relaxed);
+            out.y0[i] = g_publishedHitRects.y0[i].load(std::memory_order_relaxed);
+            out.x1[i] = g_publishedHitRects.x1[i].load(std::memory_order_relaxed);
+            out.y1[i] = g_publishedHitRects.y1[i].load(std::memory_order_relaxed);
         }
+        out.count = count;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        seq1 = g_hitRectsSeq.load(std::memory_order_relaxed);
+    } while ((seq0 & 1) || seq0 != seq1);
+}
+
+static bool HitTest(const HitRects& r, float x, float y) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    float32x4_t px = vdupq_n_f32(x);
+    float32x4_t py = vdupq_n_f32(y);
+    for (int i = 0; i < r.count; i += 4) {
+        uint32x4_t inX = vandq_u32(vcgeq_f32(px, vld1q_f32(r.x0 + i)), vcleq_f32(px, vld1q_f32(r.x1 + i)));
+        uint32x4_t inY = vandq_u32(vcgeq_f32(py, vld1q_f32(r.y0 + i)), vcleq_f32(py, vld1q_f32(r.y1 + i)));
+        if (vmaxvq_u32(vandq_u32(inX, inY))) return true;
+    }
+    return false;
+#elif defined(__SSE2__)
+    __m128 px = _mm_set1_ps(x);
+    __m128 py = _mm_set1_ps(y);
+    for (int i = 0; i < r.count; i += 4) {
+        __m128 inX = _mm_and_ps(_mm_cmpge_ps(px, _mm_load_ps(r.x0 + i)), _mm_cmple_ps(px, _mm_load_ps(r.x1 + i)));
+        __m128 inY = _mm_and_ps(_mm_cmpge_ps(py, _mm_load_ps(r.y0 + i)), _mm_cmple_ps(py, _mm_load_ps(r.y1 + i)));
+        if (_mm_movemask_ps(_mm_and_ps(inX, inY))) return true;
     }
-    switch (action & 0xFF) {
-        case 0: // DOWN
+    return false;
+#else
+    for (int i = 0; i < r.count; i++) {
+        if (x >= r.x0[i] && x <= r.x1[i] && y >= r.y0[i] && y <= r.y1[i]) return true;
+    }
+    return false;
+#endif
+}
+
+// Per-pointer touch ownership for the Preloader path. Pointers that went down on a GUI
+// window are hidden from the game until they lift; every other pointer passes through.
+// ImGui has a single mouse, driven by one pointer at a time (g_guiPointer).
+static constexpr int kMaxPointers = 32; // Android pointer ids are 0..31
+static bool g_pointerCapturedByGui[kMaxPointers] = {};
+static int g_guiPointer = -1;
+
+static void PushTouch(int8_t action, int pointerId, float x, float y) {
+    if (!g_Initialized) return;
+    ImGui_ImplAndroid_InputEvent e = {};
+    e.Type = AINPUT_EVENT_TYPE_MOTION;
+    e.Action = action;
+    e.ToolType = AMOTION_EVENT_TOOL_TYPE_FINGER;
+    e.PointerId = (int8_t)pointerId;
+    e.X = x;
+    e.Y = y;
+    e.EventTime = NowNs(); // Preloader does not forward the hardware timestamp
+    PushInput(e);
+}
+
+static bool HandleTouchEvent(int action, int pointerId, float x, float y) {
+    if (pointerId < 0 || pointerId >= kMaxPointers) return false;
+    HitRects rects;
+    ReadHitRects(rects);
+    bool isTouchInsideGui = HitTest(rects, x, y);
+    switch (action & AMOTION_EVENT_ACTION_MASK) {
+        case AMOTION_EVENT_ACTION_DOWN:
+        case AMOTION_EVENT_ACTION_POINTER_DOWN:
         {
-            io.MouseDown[0] = true;
-            if (isTouchInsideGui) {
-                g_touchCapturedByGui = true;
-                return true; // block game
+            g_pointerCapturedByGui[pointerId] = isTouchInsideGui;
+            // A finger on the GUI takes the ImGui mouse over from a finger playing the game;
+            // a finger on the game only drives ImGui when nothing else does (click-outside to close popups).
+            bool guiPointerBusy = g_guiPointer != -1 && g_guiPointer != pointerId;
+            if (guiPointerBusy && isTouchInsideGui && !g_pointerCapturedByGui[g_guiPointer]) {
+                PushTouch(AMOTION_EVENT_ACTION_UP, g_guiPointer, x, y);
+                guiPointerBusy = false;
             }
-            g_touchCapturedByGui = false;
-            return false;
+            if (!guiPointerBusy) {
+                g_guiPointer = pointerId;
+                PushTouch(AMOTION_EVENT_ACTION_DOWN, pointerId, x, y);
+            }
+            return isTouchInsideGui; // block game only for GUI-owned pointers
         }
-        case 1: // UP
+        case AMOTION_EVENT_ACTION_UP:
+        case AMOTION_EVENT_ACTION_POINTER_UP:
+        case AMOTION_EVENT_ACTION_CANCEL:
         {
-            io.MouseDown[0] = false;
-            bool wasCaptured = g_touchCapturedByGui;
-            g_touchCapturedByGui = false;
-            return wasCaptured; // block only if GUI owned it
+            if (g_guiPointer == pointerId) {
+                PushTouch(AMOTION_EVENT_ACTION_UP, pointerId, x, y);
+                g_guiPointer = -1;
+            }
+            bool wasCaptured = g_pointerCapturedByGui[pointerId];
+            g_pointerCapturedByGui[pointerId] = false;
+            return wasCaptured;
         }
-        case 2: // MOVE
-            return g_touchCapturedByGui;
+        case AMOTION_EVENT_ACTION_MOVE:
+            if (g_guiPointer == pointerId) {
+                PushTouch(AMOTION_EVENT_ACTION_MOVE, pointerId, x, y);
+            }
+            return g_pointerCapturedByGui[pointerId];
     }
     return false;
 }
@@ -198,16 +479,202 @@ static void RegisterPreloaderTouch() {
     LOGI("Using Preloader touch input.");
 }
 
-static uint32_t EncodeCmpW8Imm_Table(int imm) { // for absorb type
-    if (imm < 0 || imm > 575) return 0;
-    uint32_t instr = 0x7100001F;
-    int block = imm / 64;
-    int offset = imm % 64;
-    uint8_t immByte = 0x01 + (offset * 0x04);
-    uint8_t* p = reinterpret_cast<uint8_t*>(&instr);
-    p[1] = immByte;
-    p[2] = (uint8_t)block;
-    return instr;
+// Off-thread panels. Overlays that need no widgets or input (no ImGui:: calls) are built
+// as raw ImDrawLists on a worker thread instead of the game's render thread. The build runs
+// between frames, from the end of Render() to the start of the next one, while ImGui and
+// the font atlas are idle: the worker reads already-baked glyphs without locking
+// (ImDrawListFlags_NoFontLoading), the render thread waits for it before NewFrame and
+// appends the lists to the draw data after ImGui::Render(). Panels lag one frame behind.
+// A single worker builds every panel: ImGui::MemAlloc() bumps debug counters on the shared
+// context, so two threads must never be inside ImGui allocation calls at the same time.
+static constexpr int kFrameHistory = 120;
+
+struct FrameStats {
+    float frameMs[kFrameHistory]; // interval between frames, oldest first
+    float cpuMs;                  // time spent in Render()
+    float touchMs;
+    AllocStats alloc;
+    ImVec2 display;
+};
+
+struct Panel {
+    void (*build)(ImDrawList* dl, const FrameStats& s);
+    ImDrawList* list; // created and only ever grown on the panel thread
+};
+
+struct PanelWorker {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::thread thread;
+    bool stop = false;            // StopPanels(): leave once the build in flight is done
+    bool busy = false;            // a build is in flight
+    bool built = false;           // lists hold a complete build
+    ImDrawListSharedData shared;  // this thread's own copy, TempBuffer can't be shared
+    ImFont* font = nullptr;
+    float fontSize = 0.0f;
+    int texUniqueId = -1;         // atlas texture the lists were built against
+    FrameStats stats = {};        // snapshot taken when the build was launched
+};
+
+static bool g_showStats = false;
+static AllocStats g_allocLast = {}; // last completed frame
+static FrameStats g_frameStats = {}; // render thread's running copy
+static int64_t g_lastFrameStart = 0;
+static PanelWorker* g_panelWorker = nullptr;
+
+// CalcTextSize() may load glyphs, so panels measure with the no-load lookups (ASCII only).
+static float PanelTextWidth(const ImDrawList* dl, const char* text) {
+    const ImDrawListSharedData* shared = dl->_Data;
+    ImFontBaked* baked = shared->Font->FindFontBaked(shared->FontSize);
+    if (!baked) return 0.0f;
+    float w = 0.0f;
+    for (const char* p = text; *p; p++) {
+        if (const ImFontGlyph* glyph = baked->FindGlyphNoLoad((ImWchar)(unsigned char)*p))
+            w += glyph->AdvanceX;
+    }
+    return w * shared->FontSize / baked->Size;
+}
+
+static float PanelRight(const FrameStats& s, float fontSize) {
+    return s.display.x - fontSize * 0.5f;
+}
+
+static void BuildStatsHud(ImDrawList* dl, const FrameStats& s) {
+    float fontSize = dl->_Data->FontSize;
+    float lastMs = s.frameMs[kFrameHistory - 1];
+    char lines[4][64];
+    snprintf(lines[0], sizeof(lines[0]), "%.0f FPS  %.2f ms", lastMs > 0.0f ? 1000.0f / lastMs : 0.0f, lastMs);
+    snprintf(lines[1], sizeof(lines[1]), "Overlay %.2f ms", s.cpuMs);
+    snprintf(lines[2], sizeof(lines[2]), "Alloc %u calls, %u B", s.alloc.calls, s.alloc.bytes);
+    snprintf(lines[3], sizeof(lines[3]), "Touch %.1f ms", s.touchMs);
+    float width = 0.0f;
+    for (const char* line : lines) width = ImMax(width, PanelTextWidth(dl, line));
+    float pad = fontSize * 0.25f;
+    ImVec2 max(PanelRight(s, fontSize), fontSize * 0.5f + pad * 2 + fontSize * 4);
+    ImVec2 min(max.x - width - pad * 2, fontSize * 0.5f);
+    dl->AddRectFilled(min, max, IM_COL32(0, 0, 0, 160), pad);
+    for (int i = 0; i < 4; i++)
+        dl->AddText(ImVec2(min.x + pad, min.y + pad + fontSize * i), IM_COL32(255, 255, 255, 255), lines[i]);
+}
+
+static void BuildFrameGraph(ImDrawList* dl, const FrameStats& s) {
+    float fontSize = dl->_Data->FontSize;
+    ImVec2 size(fontSize * 12.0f, fontSize * 3.0f);
+    ImVec2 max(PanelRight(s, fontSize), fontSize * 5.5f + size.y);
+    ImVec2 min(max.x - size.x, max.y - size.y);
+    dl->AddRectFilled(min, max, IM_COL32(0, 0, 0, 160));
+    // Scale so 33 ms (30 FPS) fills the graph, with a line at 16.7 ms (60 FPS)
+    const float msToY = size.y / 33.3f;
+    float y60 = max.y - 16.7f * msToY;
+    dl->AddLine(ImVec2(min.x, y60), ImVec2(max.x, y60), IM_COL32(255, 255, 255, 64));
+    ImVec2 points[kFrameHistory];
+    for (int i = 0; i < kFrameHistory; i++) {
+        float y = ImMax(max.y - s.frameMs[i] * msToY, min.y);
+        points[i] = ImVec2(min.x + size.x * i / (kFrameHistory - 1), y);
+    }
+    dl->AddPolyline(points, kFrameHistory, IM_COL32(90, 220, 120, 255), ImDrawFlags_None, 1.5f);
+}
+
+static Panel g_panels[] = {
+    { BuildStatsHud, nullptr },
+    { BuildFrameGraph, nullptr },
+};
+
+static void PanelThread(PanelWorker* w) {
+    SetOverlayAllocWorkerThread();
+    std::unique_lock<std::mutex> lock(w->mutex);
+    for (;;) {
+        w->cv.wait(lock, [w] { return w->busy || w->stop; });
+        if (w->stop) return;
+        lock.unlock();
+        for (Panel& p : g_panels) {
+            if (!p.list) p.list = IM_NEW(ImDrawList)(&w->shared);
+            p.list->_ResetForNewFrame();
+            p.list->PushTexture(w->shared.FontAtlas->TexRef);
+            p.list->PushClipRectFullScreen();
+            p.build(p.list, w->stats);
+        }
+        lock.lock();
+        w->busy = false;
+        w->built = true;
+        w->cv.notify_all();
+    }
+}
+
+static void StopPanels() {
+    PanelWorker* w = g_panelWorker;
+    if (!w) return;
+    {
+        std::lock_guard<std::mutex> lock(w->mutex);
+        w->stop = true;
+    }
+    w->cv.notify_all();
+    w->thread.join();
+    for (Panel& p : g_panels) {
+        IM_DELETE(p.list);
+        p.list = nullptr;
+    }
+    g_panelWorker = nullptr;
+    delete w;
+}
+
+// Start of Render(): nothing may touch ImGui before the panel build is done.
+static void WaitPanels() {
+    PanelWorker* w = g_panelWorker;
+    if (!w) return;
+    std::unique_lock<std::mutex> lock(w->mutex);
+    w->cv.wait(lock, [w] { return !w->busy; });
+}
+
+// Inside the frame: pick the panel font and bake the glyphs the worker may need.
+// The menu uses the same font size every frame, which keeps it from being garbage collected.
+static void PreparePanels() {
+    if (!g_showStats) return;
+    if (!g_panelWorker) {
+        g_panelWorker = new PanelWorker();
+        g_panelWorker->thread = std::thread(PanelThread, g_panelWorker);
+    }
+    g_panelWorker->font = ImGui::GetFont();
+    g_panelWorker->fontSize = ImGui::GetFontSize();
+    static const ImWchar kPanelGlyphs[] = { 32, 126, 0 };
+    ImGui::GetFontBaked()->LoadGlyphs(kPanelGlyphs);
+}
+
+// After ImGui::Render(): append last build, unless the atlas texture changed since (UVs would be stale).
+static void SubmitPanels(ImDrawData* drawData) {
+    PanelWorker* w = g_panelWorker;
+    if (!g_showStats || !w || !w->built) return;
+    if (ImGui::GetIO().Fonts->TexData->UniqueID != w->texUniqueId) return;
+    for (Panel& p : g_panels) drawData->AddDrawList(p.list);
+}
+
+// End of Render(): the atlas won't change until the next NewFrame, hand the next build to the worker.
+static void LaunchPanels() {
+    PanelWorker* w = g_panelWorker;
+    if (!g_showStats || !w) return;
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    w->shared.CopySettingsFrom(*ImGui::GetDrawListSharedData());
+    w->shared.Font = w->font;
+    w->shared.FontSize = w->fontSize;
+    w->shared.InitialFlags |= ImDrawListFlags_NoFontLoading;
+    w->texUniqueId = atlas->TexData->UniqueID;
+    w->stats = g_frameStats;
+    w->stats.display = ImGui::GetIO().DisplaySize;
+    std::lock_guard<std::mutex> lock(w->mutex);
+    w->busy = true;
+    w->built = false;
+    w->cv.notify_all();
+}
+
+static void RecordFrameStats(int64_t start, int64_t end) {
+    if (g_lastFrameStart != 0) {
+        memmove(g_frameStats.frameMs, g_frameStats.frameMs + 1, sizeof(float) * (kFrameHistory - 1));
+        g_frameStats.frameMs[kFrameHistory - 1] = (float)(start - g_lastFrameStart) / 1000000.0f;
+    }
+    g_lastFrameStart = start;
+    g_frameStats.cpuMs = (float)(end - start) / 1000000.0f;
+    g_frameStats.touchMs = g_inputLatency.lastMs;
+    g_frameStats.alloc = g_allocLast;
 }
 
 static void ScanSignatures() {
@@ -250,193 +717,203 @@ static void ScanSignatures() {
     g_PatchesReady = true;
 }
 
-static void DrawMenu() {
-    ImGui::Begin("AnarchyArray", nullptr, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoResize);
-    UpdateBounds(0);
-    static bool infinitySpread = false;
-    static bool spongePlus = false;
-    static bool spongePlusPlus = false;
-    static int absorbTypeVal = 5;
-    static int lastAbsorbValue = -1;
-    // InfinitySpread
-    if (ImGui::Checkbox("InfinitySpread", &infinitySpread) && g_PatchesReady) {
-        const uint8_t patch[] = {0x03, 0x00, 0x80, 0x52};
-        for (size_t i = 0; i < 4 && i < g_PatchAddrs.size(); i++) {
-            if (infinitySpread) {
-                WriteMemory((void*)g_PatchAddrs[i], (void*)patch, sizeof(patch), true);
-            } else {
-                WriteMemory((void*)g_PatchAddrs[i], g_Originals[i].data(), g_Originals[i].size(), true);
-            }
-        }
+bool PatchesReady() {
+    return g_PatchesReady;
+}
+
+void ApplyPatch(size_t index, const void* bytes, size_t size) {
+    if (index < g_PatchAddrs.size()) WriteMemory((void*)g_PatchAddrs[index], (void*)bytes, size, true);
+}
+
+void RestorePatch(size_t index) {
+    if (index < g_PatchAddrs.size()) WriteMemory((void*)g_PatchAddrs[index], g_Originals[index].data(), g_Originals[index].size(), true);
+}
+
+// Default font loader serving the glyphs prebaked by tools/font_prebake.cpp. They are exactly
+// what stb_truetype would produce, read from .rodata and decompressed straight into the atlas,
+// so the first frame skips rasterization. Any other size or codepoint goes to stb_truetype.
+static const ImFontLoader* g_stbLoader = nullptr;
+static ImFontLoader g_prebakedLoader;
+
+static const PrebakedGlyph* FindPrebakedGlyph(const ImFontConfig* src, const ImFontBaked* baked, ImWchar c) {
+    if (c < kPrebakedFirstChar || c > kPrebakedLastChar) return nullptr;
+    if (src->MergeMode || src->RasterizerDensity * baked->RasterizerDensity != 1.0f) return nullptr;
+    if (baked->OwnerFont->Flags & ImFontFlags_DistanceField) return nullptr; // prebaked glyphs are bitmaps
+    for (const PrebakedFont& f : kPrebakedFonts) {
+        if (f.sizePixels == src->SizePixels && f.bakedSize == baked->Size)
+            return &f.glyphs[c - kPrebakedFirstChar];
     }
-    // SpongeRange+
-    if (ImGui::Checkbox("SpongeRange+", &spongePlus) && g_PatchesReady) {
-        const uint8_t patchPlus[] = {0x1F, 0x20, 0x03, 0xD5, 0xFB, 0x13, 0x40, 0xF9, 0x7F, 0x07, 0x00, 0xB1};
-        size_t idx = 4;
-        if (idx < g_PatchAddrs.size()) {
-            if (spongePlus) {
-                WriteMemory((void*)g_PatchAddrs[idx], (void*)patchPlus, sizeof(patchPlus), true);
-            } else {
-                WriteMemory((void*)g_PatchAddrs[idx], g_Originals[idx].data(), g_Originals[idx].size(), true);
-            }
+    return nullptr;
+}
+
+// See Compress() in tools/font_prebake.cpp
+static void DecompressPrebaked(const uint8_t* src, uint8_t* dst, int w, int h) {
+    for (int y = 0; y < h; y++, dst += w) {
+        if (*src == 0x80) {
+            memcpy(dst, dst - w, w);
+            src++;
+            continue;
         }
-    }
-    // SpongeRange++
-    ImGui::BeginDisabled(!spongePlus); // grey out if SpongeRange+ is not active
-    if (ImGui::Checkbox("SpongeRange++", &spongePlusPlus) && g_PatchesReady) {
-        const uint8_t patchPlusPlus[] = {0x5F, 0xFD, 0x03, 0xF1, 0x8B, 0x2D, 0x0D, 0x9B};
-        size_t idx = 5;
-        if (idx < g_PatchAddrs.size()) {
-            if (spongePlusPlus) {
-                WriteMemory((void*)g_PatchAddrs[idx], (void*)patchPlusPlus, sizeof(patchPlusPlus), true);
+        for (int x = 0; x < w;) {
+            int n = (int8_t)*src++;
+            if (n >= 0) {
+                memcpy(dst + x, src, n + 1);
+                src += n + 1;
+                x += n + 1;
             } else {
-                WriteMemory((void*)g_PatchAddrs[idx], g_Originals[idx].data(), g_Originals[idx].size(), true);
+                memset(dst + x, *src++, 1 - n);
+                x += 1 - n;
             }
         }
     }
-    ImGui::EndDisabled();
-    ImGui::Text("Absorb Type");
-    ImGui::SameLine();
-    // Number display
-    ImGui::SetNextItemWidth(50);
-    ImGui::InputInt("##absorbDisplay", &absorbTypeVal, 0, 0, ImGuiInputTextFlags_ReadOnly);
-    ImGui::SameLine();
-    // K button + square gap + minus/plus arrows
-    ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(6, 6));
-    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4, 4));
-    ImGui::PushStyleVar(ImGuiStyleVar_FrameRounding, 3.0f);
-    // Keypad button
-    if (ImGui::Button("K", ImVec2(ImGui::GetFrameHeight(), ImGui::GetFrameHeight()))) {
-        ImGui::OpenPopup("AbsorbKeypad");
-    }
-    ImGui::SameLine();
-    // i button
-    if (ImGui::Button("i", ImVec2(ImGui::GetFrameHeight(), ImGui::GetFrameHeight()))) {
-        ImGui::OpenPopup("AbsorbTypeInfo");
-    }
-    ImGui::SameLine();
-    // Minus button
-    if (ImGui::Button("-", ImVec2(ImGui::GetFrameHeight(), ImGui::GetFrameHeight()))) {
-        if (absorbTypeVal > 0) absorbTypeVal--;
-    }
-    ImGui::SameLine();
-    // Plus button
-    if (ImGui::Button("+", ImVec2(ImGui::GetFrameHeight(), ImGui::GetFrameHeight()))) {
-        if (absorbTypeVal < 575) absorbTypeVal++;
-    }
-    ImGui::PopStyleVar(3);
-    // Apply patch when value changes
-    if (g_PatchesReady && absorbTypeVal >= 0 && absorbTypeVal <= 575 && absorbTypeVal != lastAbsorbValue) {
-        uint32_t instr = EncodeCmpW8Imm_Table(absorbTypeVal);
-        if (instr != 0) {
-            for (size_t idx : {6, 7}) {
-                if (idx < g_PatchAddrs.size()) {
-                    WriteMemory((void*)g_PatchAddrs[idx], &instr, 4, true);
-                }
-            }
-            lastAbsorbValue = absorbTypeVal;
-        }
+}
+
+static void SetPrebakedMetrics(const PrebakedGlyph* g, ImWchar codepoint, ImFontGlyph* outGlyph) {
+    outGlyph->Codepoint = codepoint;
+    outGlyph->AdvanceX = g->advanceX;
+    if (g->w == 0) return;
+    outGlyph->X0 = g->x0;
+    outGlyph->Y0 = g->y0;
+    outGlyph->X1 = g->x1;
+    outGlyph->Y1 = g->y1;
+    outGlyph->Visible = true;
+}
+
+static bool PrebakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loaderData, ImWchar codepoint, ImFontGlyph* outGlyph, float* outAdvanceX) {
+    const PrebakedGlyph* g = FindPrebakedGlyph(src, baked, codepoint);
+    if (!g) return g_stbLoader->FontBakedLoadGlyph(atlas, src, baked, loaderData, codepoint, outGlyph, outAdvanceX);
+    if (outAdvanceX) {
+        *outAdvanceX = g->advanceX;
+        return true;
     }
-    // Info popup
-    if (ImGui::BeginPopup("AbsorbTypeInfo", ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) {
-        UpdateBounds(1);
-        ImGui::Text("Absorb Type Reference");
-        ImGui::SameLine(ImGui::GetWindowContentRegionMax().x - ImGui::GetFrameHeight());
-        if (ImGui::Button("X", ImVec2(ImGui::GetFrameHeight(), ImGui::GetFrameHeight()))) {
-            ImGui::CloseCurrentPopup();
-        }
-        ImGui::Separator();
-        if (ImGui::BeginTable("AbsorbRefTable", 2, ImGuiTableFlags_NoBordersInBody)) {
-            // First column
-            ImGui::TableNextColumn();
-            ImGui::BulletText("0 = air");
-            ImGui::BulletText("1 = dirt");
-            ImGui::BulletText("2 = wood");
-            ImGui::BulletText("3 = metal");
-            ImGui::BulletText("4 = copper grates");
-            ImGui::BulletText("5 = water");
-            ImGui::BulletText("6 = lava");
-            ImGui::BulletText("7 = leaves");
-            ImGui::BulletText("8 = plants");
-            ImGui::BulletText("9 = azalea, dried kelp, solid plants");
-            ImGui::BulletText("10 = fire, soul fire");
-            ImGui::BulletText("11 = glass");
-            ImGui::BulletText("12 = tnt");
-            // Second column
-            ImGui::TableNextColumn();
-            ImGui::BulletText("13 = ice (not blue/packed)");
-            ImGui::BulletText("14 = powdered snow");
-            ImGui::BulletText("15 = cactus");
-            ImGui::BulletText("16 = portals");
-            ImGui::BulletText("17 = unknown");
-            ImGui::BulletText("18 = bubble column");
-            ImGui::BulletText("19 = unknown");
-            ImGui::BulletText("20 = decorated pot, decoration solids");
-            ImGui::BulletText("21 = n/a");
-            ImGui::BulletText("22 = structure void");
-            ImGui::BulletText("23 = stone, etc, solids");
-            ImGui::BulletText("24 = torches, pot, etc, non-solids");
-            ImGui::BulletText("25 = unknown");
-            ImGui::EndTable();
-        }
-        ImGui::EndPopup();
-    } else {
-        std::lock_guard<std::mutex> lock(g_boundsMutex);
-        g_bounds[1].visible = false;
-    }
-    // Keypad popup window
-    if (ImGui::BeginPopup("AbsorbKeypad", ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) {
-        UpdateBounds(2);
-        // Title bar with a close X button at top-right
-        ImGui::Text("Keypad");
-        ImGui::SameLine(ImGui::GetWindowContentRegionMax().x - ImGui::GetFrameHeight());
-        if (ImGui::Button("X", ImVec2(ImGui::GetFrameHeight(), ImGui::GetFrameHeight()))) {
-            ImGui::CloseCurrentPopup();
-        }
-        ImGui::Separator();
-        // Fixed keypad grid size
-        const float cellWidth = 60.0f;
-        const float rowHeight = 50.0f;
-        // 1 2 3
-        for (int i = 1; i <= 3; i++) {
-            if (ImGui::Button(std::to_string(i).c_str(), ImVec2(cellWidth, rowHeight))) {
-                absorbTypeVal = absorbTypeVal * 10 + i;
-            }
-            if (i < 3) ImGui::SameLine();
-        }
-        // 4 5 6
-        for (int i = 4; i <= 6; i++) {
-            if (ImGui::Button(std::to_string(i).c_str(), ImVec2(cellWidth, rowHeight))) {
-                absorbTypeVal = absorbTypeVal * 10 + i;
-            }
-            if (i < 6) ImGui::SameLine();
-        }
-        // 7 8 9
-        for (int i = 7; i <= 9; i++) {
-            if (ImGui::Button(std::to_string(i).c_str(), ImVec2(cellWidth, rowHeight))) {
-                absorbTypeVal = absorbTypeVal * 10 + i;
-            }
-            if (i < 9) ImGui::SameLine();
-        }
-        // blank 0 <-
-        ImGui::Dummy(ImVec2(cellWidth, rowHeight));
-        ImGui::SameLine();
-        if (ImGui::Button("0", ImVec2(cellWidth, rowHeight))) {
-            absorbTypeVal = absorbTypeVal * 10;
-        }
-        ImGui::SameLine();
-        if (ImGui::Button("<-", ImVec2(cellWidth, rowHeight))) { // backspace arrow
-            absorbTypeVal /= 10;
-        }
-        ImGui::EndPopup();
-    } else {
-        std::lock_guard<std::mutex> lock(g_boundsMutex);
-        g_bounds[2].visible = false;
+    SetPrebakedMetrics(g, codepoint, outGlyph);
+    if (g->w == 0) return true;
+    ImFontAtlasRectId packId = ImFontAtlasPackAddRect(atlas, g->w, g->h);
+    if (packId == ImFontAtlasRectId_Invalid) return false;
+    ImTextureRect* r = ImFontAtlasPackGetRect(atlas, packId);
+    ImVector<unsigned char>& pixels = atlas->Builder->TempBuffer;
+    pixels.resize(g->w * g->h);
+    DecompressPrebaked(kPrebakedPixels + g->offset, pixels.Data, g->w, g->h);
+    outGlyph->PackId = packId;
+    ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, outGlyph, r, pixels.Data, ImTextureFormat_Alpha8, g->w);
+    return true;
+}
+
+// Split load used by ImFontBaked::LoadGlyphs(), the rasterize half runs on RunFontJobs workers
+static bool PrebakedPrepareGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loaderData, ImWchar codepoint, ImFontGlyph* outGlyph, int* outW, int* outH) {
+    const PrebakedGlyph* g = FindPrebakedGlyph(src, baked, codepoint);
+    if (!g) return g_stbLoader->FontBakedPrepareGlyph(atlas, src, baked, loaderData, codepoint, outGlyph, outW, outH);
+    SetPrebakedMetrics(g, codepoint, outGlyph);
+    *outW = g->w;
+    *outH = g->h;
+    return true;
+}
+
+static void PrebakedRasterizeGlyph(ImFontConfig* src, ImFontBaked* baked, void* loaderData, ImWchar codepoint, unsigned char* pixels, int w, int h) {
+    const PrebakedGlyph* g = FindPrebakedGlyph(src, baked, codepoint);
+    if (!g) return g_stbLoader->FontBakedRasterizeGlyph(src, baked, loaderData, codepoint, pixels, w, h);
+    DecompressPrebaked(kPrebakedPixels + g->offset, pixels, w, h);
+}
+
+static const ImFontLoader* GetPrebakedFontLoader() {
+    if (!g_stbLoader) {
+        g_stbLoader = ImFontAtlasGetFontLoaderForStbTruetype();
+        g_prebakedLoader = *g_stbLoader;
+        g_prebakedLoader.Name = "prebaked";
+        g_prebakedLoader.FontBakedLoadGlyph = PrebakedLoadGlyph;
+        g_prebakedLoader.FontBakedPrepareGlyph = PrebakedPrepareGlyph;
+        g_prebakedLoader.FontBakedRasterizeGlyph = PrebakedRasterizeGlyph;
     }
-    ImGui::End();
+    return &g_prebakedLoader;
 }
 
-static void Setup(ANativeWindow* window) {
+// ImFontAtlas::RunJobs: glyph rasterization for large ranges fans out over helper threads started once by
+// Setup(). A batch is handed over by bumping the generation, the caller works on it too and returns once
+// every helper picked for it has left. Only the render thread loads glyphs, so batches never overlap.
+struct FontJobPool {
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::vector<std::thread> threads;
+    bool stop = false;
+    uint32_t generation = 0;      // bumped for each batch
+    int helpers = 0;              // threads [0, helpers) take part in the current batch
+    int active = 0;               // helpers still in the current batch
+    void (*jobFunc)(void*, int) = nullptr;
+    void* jobData = nullptr;
+    int jobCount = 0;
+    std::atomic<int> next{0};
+};
+
+static FontJobPool* g_fontJobs = nullptr;
+
+static void RunFontJobRange(FontJobPool* p) {
+    for (int n = p->next++; n < p->jobCount; n = p->next++) p->jobFunc(p->jobData, n);
+}
+
+static void FontJobThread(FontJobPool* p, int index) {
+    SetOverlayAllocWorkerThread();
+    uint32_t seen = 0;
+    std::unique_lock<std::mutex> lock(p->mutex);
+    for (;;) {
+        p->wake.wait(lock, [&] { return p->stop || p->generation != seen; });
+        if (p->stop) return;
+        seen = p->generation;
+        if (index >= p->helpers) continue;
+        lock.unlock();
+        RunFontJobRange(p);
+        lock.lock();
+        if (--p->active == 0) p->done.notify_one();
+    }
+}
+
+static void StartFontJobs() {
+    int count = ImMin((int)std::thread::hardware_concurrency(), 8) - 1;
+    if (count <= 0 || g_fontJobs) return;
+    g_fontJobs = new FontJobPool();
+    for (int i = 0; i < count; i++) g_fontJobs->threads.emplace_back(FontJobThread, g_fontJobs, i);
+}
+
+static void StopFontJobs() {
+    FontJobPool* p = g_fontJobs;
+    if (!p) return;
+    {
+        std::lock_guard<std::mutex> lock(p->mutex);
+        p->stop = true;
+    }
+    p->wake.notify_all();
+    for (std::thread& t : p->threads) t.join();
+    g_fontJobs = nullptr;
+    delete p;
+}
+
+// Small batches aren't worth waking helpers for
+static void RunFontJobs(void (*jobFunc)(void*, int), void* jobData, int jobCount) {
+    static constexpr int kJobsPerThread = 16;
+    FontJobPool* p = g_fontJobs;
+    int helpers = p ? ImMin((int)p->threads.size(), jobCount / kJobsPerThread - 1) : 0;
+    if (helpers <= 0) {
+        for (int n = 0; n < jobCount; n++) jobFunc(jobData, n);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(p->mutex);
+        p->jobFunc = jobFunc;
+        p->jobData = jobData;
+        p->jobCount = jobCount;
+        p->next = 0;
+        p->helpers = p->active = helpers;
+        p->generation++;
+    }
+    p->wake.notify_all();
+    RunFontJobRange(p);
+    std::unique_lock<std::mutex> lock(p->mutex);
+    p->done.wait(lock, [p] { return p->active == 0; });
+}
+
+// The Vulkan backend is initialized by PrepareVulkanOverlay(), it depends on the swapchain
+static void Setup(ANativeWindow* window, Renderer renderer) {
+    ImGui::SetAllocatorFunctions(OverlayAlloc, OverlayFree, nullptr);
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
     io.IniFilename = nullptr;
@@ -444,11 +921,23 @@ static void Setup(ANativeWindow* window) {
     float scale = (float)g_Height / 720.0f;
     if (scale < 1.5f) scale = 1.5f;
     if (scale > 4.0f) scale = 4.0f;
+    // Font size snaps to the buckets prebaked in font_prebaked.h (1.5x..4x in 0.25 steps),
+    // the style keeps the exact scale
     ImFontConfig cfg;
-    cfg.SizePixels = 18.0f * scale;
+    cfg.SizePixels = 18.0f * (roundf(scale * 4.0f) / 4.0f);
+    cfg.FontLoader = GetPrebakedFontLoader();
+    // Glyphs discarded on rescale free their space in place, instead of a repack and full re-upload
+    io.Fonts->Flags |= ImFontAtlasFlags_PackGuillotine;
     io.Fonts->AddFontDefault(&cfg);
+    StartFontJobs();
+    io.Fonts->RunJobs = RunFontJobs;
+    ImGuiContextHook hitRectsHook;
+    hitRectsHook.Type = ImGuiContextHookType_EndFramePost;
+    hitRectsHook.Callback = CollectHitRects;
+    ImGui::AddContextHook(ImGui::GetCurrentContext(), &hitRectsHook);
     ImGui_ImplAndroid_Init(window);
-    ImGui_ImplOpenGL3_Init("#version 300 es");
+    if (renderer == Renderer::GL) ImGui_ImplOpenGL3_Init("#version 300 es");
+    g_Renderer = renderer;
     ImGuiStyle& style = ImGui::GetStyle();
     style.ScaleAllSizes(scale * 0.65f);
     style.Alpha = 1.0f;
@@ -456,8 +945,9 @@ static void Setup(ANativeWindow* window) {
     LOGI("ImGui initialized successfully");
 }
 
-static void Render() {
-    if (!g_Initialized) return;
+// Frame steps shared by both renderers, around the renderer's own NewFrame/RenderDrawData
+static void BeginOverlayFrame() {
+    WaitPanels();
     static int lastW = 0, lastH = 0;
     ImGuiIO& io = ImGui::GetIO();
     if (g_Width != lastW || g_Height != lastH) {
@@ -465,15 +955,71 @@ static void Render() {
         lastW = g_Width;
         lastH = g_Height;
     }
-    GLState gl;
-    SaveGL(gl);
-    ImGui_ImplOpenGL3_NewFrame();
+    g_allocLast = OverlayAllocNextFrame();
+    DrainInput();
+}
+
+// framebufferSize: size of the image drawn on when it isn't the window's (the game renders at a lower
+// resolution and lets the compositor scale it up)
+static ImDrawData* BuildOverlayFrame(ImVec2 framebufferSize = ImVec2(0.0f, 0.0f)) {
     ImGui_ImplAndroid_NewFrame();
+    ImGuiIO& io = ImGui::GetIO();
+    if (framebufferSize.x > 0.0f && io.DisplaySize.x > 0.0f && io.DisplaySize.y > 0.0f)
+        io.DisplayFramebufferScale = ImVec2(framebufferSize.x / io.DisplaySize.x, framebufferSize.y / io.DisplaySize.y);
     ImGui::NewFrame();
-    DrawMenu();
+    MenuStats stats = { g_inputLatency.lastMs, g_inputLatency.avgMs, g_inputLatency.maxMs, g_allocLast.calls, g_allocLast.bytes, g_allocLast.mallocs };
+    DrawMenu(stats, &g_showStats);
+    PreparePanels();
     ImGui::Render();
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    SubmitPanels(ImGui::GetDrawData());
+    return ImGui::GetDrawData();
+}
+
+// Capture build (DRAW_TRACE_FRAMES in CMakeLists.txt): the first frames go to a draw trace in the game's
+// external files directory, for tools/draw_replay.cpp. Call before the renderer honors the texture requests.
+static void TraceFrame(ImDrawData* drawData) {
+#ifdef DRAW_TRACE_FRAMES
+    static DrawTraceWriter trace;
+    static bool started = false;
+    if (!started) {
+        started = true;
+        char package[256] = {};
+        if (FILE* f = fopen("/proc/self/cmdline", "rb")) {
+            fread(package, 1, sizeof(package) - 1, f);
+            fclose(f);
+        }
+        if (char* colon = strchr(package, ':')) *colon = '\0'; // process name suffix
+        std::string path = std::string("/sdcard/Android/data/") + package + "/files/overlay.trace";
+        if (DrawTraceOpen(trace, path.c_str())) LOGI("Recording %d frames to %s", DRAW_TRACE_FRAMES, path.c_str());
+        else LOGW("Can't write %s, not recording", path.c_str());
+    }
+    if (!trace.file) return;
+    DrawTraceWrite(trace, drawData);
+    if (trace.frames == DRAW_TRACE_FRAMES) {
+        DrawTraceClose(trace);
+        LOGI("Draw trace done: %d frames, %zu bytes", trace.frames, trace.bytes);
+    }
+#endif
+}
+
+static void EndOverlayFrame(int64_t start) {
+    RecordInputLatency();
+    RecordFrameStats(start, NowNs());
+    LaunchPanels();
+}
+
+static void Render() {
+    if (!g_Initialized || g_Renderer != Renderer::GL) return;
+    int64_t start = NowNs();
+    BeginOverlayFrame();
+    GLState gl;
+    SaveGL(gl);
+    ImGui_ImplOpenGL3_NewFrame();
+    ImDrawData* drawData = BuildOverlayFrame();
+    TraceFrame(drawData);
+    ImGui_ImplOpenGL3_RenderDrawData(drawData);
     RestoreGL(gl);
+    EndOverlayFrame(start);
 }
 
 static ANativeWindow* hook_ANativeWindow_fromSurface(JNIEnv* env, jobject surface) {
@@ -490,7 +1036,7 @@ static EGLBoolean hook_eglMakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurfac
         eglQuerySurface(dpy, draw, EGL_HEIGHT, &h);
         g_Width = w;
         g_Height = h;
-        Setup(g_Window);
+        Setup(g_Window, Renderer::GL);
     }
     return result;
 }
@@ -508,6 +1054,237 @@ static EGLBoolean hook_eglSwapBuffers(EGLDisplay dpy, EGLSurface surf) {
     return orig_eglSwapBuffers(dpy, surf);
 }
 
+#ifdef VULKAN_OVERLAY
+// Vulkan (VULKAN_OVERLAY builds): the overlay is drawn on the swapchain image in vkQueuePresentKHR, by a submit waiting on the game's
+// semaphores, and the present then waits on ours instead (see vulkan_overlay.h). Games get most of
+// these functions from vkGetDeviceProcAddr, which returns the driver's own entry points, so the ProcAddr
+// functions are hooked too and hand out our hooks.
+static constexpr uint32_t kVkFramesInFlight = 2;
+
+struct VkQueueEntry {
+    VkQueue queue;
+    uint32_t family;
+};
+
+static VkPhysicalDevice g_vkPhysicalDevice = VK_NULL_HANDLE;
+static VkDevice g_vkDevice = VK_NULL_HANDLE;
+static std::vector<VkQueueFamilyProperties> g_vkFamilies;
+static std::vector<VkQueueEntry> g_vkQueues;
+static VkSwapchainKHR g_vkSwapchain = VK_NULL_HANDLE;
+static VkFormat g_vkFormat = VK_FORMAT_UNDEFINED;
+static VkExtent2D g_vkExtent = {};
+static VkSurfaceTransformFlagBitsKHR g_vkTransform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+static std::vector<VkImage> g_vkImages;
+static VulkanOverlay g_vkOverlay;
+static uint32_t g_vkOverlayFamily = 0;
+static VkSwapchainKHR g_vkOverlaySwapchain = VK_NULL_HANDLE; // whose images g_vkOverlay holds
+
+static PFN_vkGetInstanceProcAddr orig_vkGetInstanceProcAddr = nullptr;
+static PFN_vkGetDeviceProcAddr orig_vkGetDeviceProcAddr = nullptr;
+static PFN_vkCreateAndroidSurfaceKHR orig_vkCreateAndroidSurfaceKHR = nullptr;
+static PFN_vkCreateDevice orig_vkCreateDevice = nullptr;
+static PFN_vkDestroyDevice orig_vkDestroyDevice = nullptr;
+static PFN_vkGetDeviceQueue orig_vkGetDeviceQueue = nullptr;
+static PFN_vkGetDeviceQueue2 orig_vkGetDeviceQueue2 = nullptr;
+static PFN_vkCreateSwapchainKHR orig_vkCreateSwapchainKHR = nullptr;
+static PFN_vkDestroySwapchainKHR orig_vkDestroySwapchainKHR = nullptr;
+static PFN_vkQueuePresentKHR orig_vkQueuePresentKHR = nullptr;
+
+static void CheckVkResult(VkResult err) {
+    if (err != VK_SUCCESS) LOGE("Vulkan error %d", (int)err);
+}
+
+// VulkanOverlayDestroy waits for our submits, after which the backend can go
+static void DestroyVulkanOverlay() {
+    if (!g_vkOverlay.device) return;
+    VulkanOverlayDestroy(g_vkOverlay);
+    ImGui_ImplVulkan_Shutdown();
+    g_vkOverlaySwapchain = VK_NULL_HANDLE;
+}
+
+// (Re)creates the overlay for the present queue's family and the current swapchain
+static bool PrepareVulkanOverlay(uint32_t family) {
+    if (g_vkOverlay.device && (g_vkOverlay.device != g_vkDevice || g_vkOverlayFamily != family || g_vkOverlay.format != g_vkFormat))
+        DestroyVulkanOverlay();
+    if (!g_vkOverlay.device) {
+        if (!g_Initialized) Setup(g_Window, Renderer::Vulkan);
+        if (!VulkanOverlayCreate(g_vkOverlay, g_vkDevice, family, g_vkFormat, kVkFramesInFlight)) return false;
+        ImGui_ImplVulkan_InitInfo info = {};
+        info.PhysicalDevice = g_vkPhysicalDevice;
+        info.Device = g_vkDevice;
+        info.RenderPass = g_vkOverlay.renderPass;
+        info.ImageCount = g_vkOverlay.frameCount;
+        info.SrgbColorAttachment = g_vkOverlay.srgb;
+        info.CheckVkResultFn = CheckVkResult;
+        if (!ImGui_ImplVulkan_Init(&info)) {
+            VulkanOverlayDestroy(g_vkOverlay);
+            return false;
+        }
+        g_vkOverlayFamily = family;
+        LOGI("Vulkan overlay created (format %d%s, queue family %u)", (int)g_vkFormat, g_vkOverlay.srgb ? ", sRGB" : "", family);
+    }
+    if (g_vkOverlaySwapchain != g_vkSwapchain) {
+        if (!VulkanOverlaySetImages(g_vkOverlay, g_vkImages.data(), (uint32_t)g_vkImages.size(), g_vkExtent, g_vkTransform)) return false;
+        g_vkOverlaySwapchain = g_vkSwapchain;
+    }
+    return true;
+}
+
+// Returns the semaphore the present must wait on instead of its own, VK_NULL_HANDLE if nothing was drawn
+static VkSemaphore RenderVulkan(VkQueue queue, const VkPresentInfoKHR* info) {
+    if (!g_Window || g_vkSwapchain == VK_NULL_HANDLE) return VK_NULL_HANDLE;
+    if (g_Initialized && g_Renderer != Renderer::Vulkan) return VK_NULL_HANDLE;
+    if (!VulkanOverlaySupportsTransform(g_vkTransform)) return VK_NULL_HANDLE;
+    uint32_t imageIndex = UINT32_MAX;
+    for (uint32_t i = 0; i < info->swapchainCount; i++)
+        if (info->pSwapchains[i] == g_vkSwapchain) imageIndex = info->pImageIndices[i];
+    if (imageIndex == UINT32_MAX) return VK_NULL_HANDLE;
+    // A present-only queue can't run our render pass
+    uint32_t family = UINT32_MAX;
+    for (const VkQueueEntry& q : g_vkQueues)
+        if (q.queue == queue) family = q.family;
+    if (family >= g_vkFamilies.size() || !(g_vkFamilies[family].queueFlags & VK_QUEUE_GRAPHICS_BIT)) return VK_NULL_HANDLE;
+    if (!PrepareVulkanOverlay(family)) return VK_NULL_HANDLE;
+
+    int64_t start = NowNs();
+    BeginOverlayFrame();
+    VulkanOverlayNewFrame(g_vkOverlay);
+    ImDrawData* drawData = BuildOverlayFrame(ImVec2((float)g_Width, (float)g_Height)); // the backend rotates it into the image
+    TraceFrame(drawData);
+    VkSemaphore done = VulkanOverlayRender(g_vkOverlay, queue, imageIndex, drawData, info->pWaitSemaphores, info->waitSemaphoreCount);
+    EndOverlayFrame(start);
+    return done;
+}
+
+static VkResult hook_vkCreateAndroidSurfaceKHR(VkInstance instance, const VkAndroidSurfaceCreateInfoKHR* info, const VkAllocationCallbacks* allocator, VkSurfaceKHR* surface) {
+    VkResult result = orig_vkCreateAndroidSurfaceKHR(instance, info, allocator, surface);
+    if (result == VK_SUCCESS) g_Window = info->window;
+    return result;
+}
+
+static VkResult hook_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* info, const VkAllocationCallbacks* allocator, VkDevice* device) {
+    VkResult result = orig_vkCreateDevice(physicalDevice, info, allocator, device);
+    if (result != VK_SUCCESS) return result;
+    g_vkPhysicalDevice = physicalDevice;
+    g_vkDevice = *device;
+    uint32_t count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &count, nullptr);
+    g_vkFamilies.resize(count);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &count, g_vkFamilies.data());
+    g_vkQueues.clear();
+    return result;
+}
+
+static void hook_vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* allocator) {
+    if (device && device == g_vkOverlay.device) DestroyVulkanOverlay();
+    if (device && device == g_vkDevice) {
+        g_vkDevice = VK_NULL_HANDLE;
+        g_vkSwapchain = VK_NULL_HANDLE;
+        g_vkQueues.clear();
+    }
+    orig_vkDestroyDevice(device, allocator);
+}
+
+static void RememberVkQueue(VkQueue queue, uint32_t family) {
+    if (queue == VK_NULL_HANDLE) return;
+    for (const VkQueueEntry& q : g_vkQueues)
+        if (q.queue == queue) return;
+    g_vkQueues.push_back({ queue, family });
+}
+
+static void hook_vkGetDeviceQueue(VkDevice device, uint32_t family, uint32_t index, VkQueue* queue) {
+    orig_vkGetDeviceQueue(device, family, index, queue);
+    RememberVkQueue(*queue, family);
+}
+
+// Vulkan 1.1: the only way to get queues created with flags (protected queues), some engines use it for all of them
+static void hook_vkGetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2* info, VkQueue* queue) {
+    orig_vkGetDeviceQueue2(device, info, queue);
+    RememberVkQueue(*queue, info->queueFamilyIndex);
+}
+
+static VkResult hook_vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* info, const VkAllocationCallbacks* allocator, VkSwapchainKHR* swapchain) {
+    VkSwapchainCreateInfoKHR ci = *info;
+    ci.imageUsage |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT; // always supported by swapchains
+    VkResult result = orig_vkCreateSwapchainKHR(device, &ci, allocator, swapchain);
+    if (result != VK_SUCCESS || device != g_vkDevice) return result;
+    uint32_t count = 0;
+    vkGetSwapchainImagesKHR(device, *swapchain, &count, nullptr);
+    g_vkImages.resize(count);
+    vkGetSwapchainImagesKHR(device, *swapchain, &count, g_vkImages.data());
+    g_vkSwapchain = *swapchain;
+    g_vkFormat = ci.imageFormat;
+    g_vkExtent = ci.imageExtent;
+    g_vkTransform = ci.preTransform;
+    // The UI is laid out in the display's orientation, the images of a 90/270 degree pre-rotated swapchain are sideways
+    const bool sideways = g_vkTransform == VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR || g_vkTransform == VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR;
+    g_Width = (int)(sideways ? ci.imageExtent.height : ci.imageExtent.width);
+    g_Height = (int)(sideways ? ci.imageExtent.width : ci.imageExtent.height);
+    if (!VulkanOverlaySupportsTransform(g_vkTransform))
+        LOGW("Swapchain transform 0x%x not supported, no Vulkan overlay", (unsigned)g_vkTransform);
+    return result;
+}
+
+static void hook_vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* allocator) {
+    // Our views and framebuffers go first, they refer to its images
+    if (swapchain && swapchain == g_vkOverlaySwapchain) {
+        VulkanOverlaySetImages(g_vkOverlay, nullptr, 0, g_vkExtent, g_vkOverlay.transform);
+        g_vkOverlaySwapchain = VK_NULL_HANDLE;
+    }
+    if (swapchain && swapchain == g_vkSwapchain) g_vkSwapchain = VK_NULL_HANDLE;
+    orig_vkDestroySwapchainKHR(device, swapchain, allocator);
+}
+
+static VkResult hook_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* info) {
+    VkSemaphore done = RenderVulkan(queue, info);
+    if (done == VK_NULL_HANDLE) return orig_vkQueuePresentKHR(queue, info);
+    VkPresentInfoKHR present = *info;
+    present.waitSemaphoreCount = 1;
+    present.pWaitSemaphores = &done;
+    return orig_vkQueuePresentKHR(queue, &present);
+}
+
+static PFN_vkVoidFunction VulkanHookFor(const char* name);
+
+static PFN_vkVoidFunction hook_vkGetInstanceProcAddr(VkInstance instance, const char* name) {
+    PFN_vkVoidFunction f = orig_vkGetInstanceProcAddr(instance, name);
+    PFN_vkVoidFunction hook = f ? VulkanHookFor(name) : nullptr;
+    return hook ? hook : f;
+}
+
+static PFN_vkVoidFunction hook_vkGetDeviceProcAddr(VkDevice device, const char* name) {
+    PFN_vkVoidFunction f = orig_vkGetDeviceProcAddr(device, name);
+    PFN_vkVoidFunction hook = f ? VulkanHookFor(name) : nullptr;
+    return hook ? hook : f;
+}
+
+struct VulkanHook {
+    const char* name;
+    void* hook;
+    void** orig;
+};
+
+static const VulkanHook kVulkanHooks[] = {
+    { "vkGetInstanceProcAddr", (void*)hook_vkGetInstanceProcAddr, (void**)&orig_vkGetInstanceProcAddr },
+    { "vkGetDeviceProcAddr", (void*)hook_vkGetDeviceProcAddr, (void**)&orig_vkGetDeviceProcAddr },
+    { "vkCreateAndroidSurfaceKHR", (void*)hook_vkCreateAndroidSurfaceKHR, (void**)&orig_vkCreateAndroidSurfaceKHR },
+    { "vkCreateDevice", (void*)hook_vkCreateDevice, (void**)&orig_vkCreateDevice },
+    { "vkDestroyDevice", (void*)hook_vkDestroyDevice, (void**)&orig_vkDestroyDevice },
+    { "vkGetDeviceQueue", (void*)hook_vkGetDeviceQueue, (void**)&orig_vkGetDeviceQueue },
+    { "vkGetDeviceQueue2", (void*)hook_vkGetDeviceQueue2, (void**)&orig_vkGetDeviceQueue2 },
+    { "vkCreateSwapchainKHR", (void*)hook_vkCreateSwapchainKHR, (void**)&orig_vkCreateSwapchainKHR },
+    { "vkDestroySwapchainKHR", (void*)hook_vkDestroySwapchainKHR, (void**)&orig_vkDestroySwapchainKHR },
+    { "vkQueuePresentKHR", (void*)hook_vkQueuePresentKHR, (void**)&orig_vkQueuePresentKHR },
+};
+
+// Our hooks call the loader's exports, which dispatch to the driver: only hand out hooks that are installed
+static PFN_vkVoidFunction VulkanHookFor(const char* name) {
+    for (const VulkanHook& h : kVulkanHooks)
+        if (*h.orig && strcmp(h.name, name) == 0) return (PFN_vkVoidFunction)h.hook;
+    return nullptr;
+}
+#endif // VULKAN_OVERLAY
+
 static void* MainThread(void*) {
     GlossInit(true);
     GHandle hEGL = GlossOpen("libEGL.so");
@@ -522,6 +1299,15 @@ static void* MainThread(void*) {
         void* f = (void*)GlossSymbol(hAndroid, "ANativeWindow_fromSurface", nullptr);
         if (f) GlossHook(f, (void*)hook_ANativeWindow_fromSurface, (void**)&orig_ANativeWindow_fromSurface);
     }
+#ifdef VULKAN_OVERLAY
+    GHandle hVulkan = GlossOpen("libvulkan.so");
+    if (hVulkan) {
+        for (const VulkanHook& h : kVulkanHooks) {
+            void* f = (void*)GlossSymbol(hVulkan, h.name, nullptr);
+            if (f) GlossHook(f, h.hook, h.orig);
+        }
+    }
+#endif
     RegisterPreloaderTouch();
     ScanSignatures();
     LOGI("MainThread finished setup");
@@ -540,4 +1326,6 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void* reserved) {
 }
 
 JNIEXPORT void JNICALL JNI_OnUnload(JavaVM* vm, void* reserved) {
+    StopPanels();
+    StopFontJobs();
 }
@@ -0,0 +1,197 @@
+#include <cstdint>
+#include <string>
+
+#include "ImGui/imgui.h"
+#include "menu.h"
+
+static uint32_t EncodeCmpW8Imm_Table(int imm) { // for absorb type
+    if (imm < 0 || imm > 575) return 0;
+    uint32_t instr = 0x7100001F;
+    int block = imm / 64;
+    int offset = imm % 64;
+    uint8_t immByte = 0x01 + (offset * 0x04);
+    uint8_t* p = reinterpret_cast<uint8_t*>(&instr);
+    p[1] = immByte;
+    p[2] = (uint8_t)block;
+    return instr;
+}
+
+void DrawMenu(const MenuStats& stats, bool* showStats) {
+    ImGui::Begin("AnarchyArray", nullptr, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoResize);
+    static bool infinitySpread = false;
+    static bool spongePlus = false;
+    static bool spongePlusPlus = false;
+    static int absorbTypeVal = 5;
+    static int lastAbsorbValue = -1;
+    // InfinitySpread
+    if (ImGui::Checkbox("InfinitySpread", &infinitySpread) && PatchesReady()) {
+        const uint8_t patch[] = {0x03, 0x00, 0x80, 0x52};
+        for (size_t i = 0; i < 4; i++) {
+            if (infinitySpread) {
+                ApplyPatch(i, patch, sizeof(patch));
+            } else {
+                RestorePatch(i);
+            }
+        }
+    }
+    // SpongeRange+
+    if (ImGui::Checkbox("SpongeRange+", &spongePlus) && PatchesReady()) {
+        const uint8_t patchPlus[] = {0x1F, 0x20, 0x03, 0xD5, 0xFB, 0x13, 0x40, 0xF9, 0x7F, 0x07, 0x00, 0xB1};
+        size_t idx = 4;
+        if (spongePlus) {
+            ApplyPatch(idx, patchPlus, sizeof(patchPlus));
+        } else {
+            RestorePatch(idx);
+        }
+    }
+    // SpongeRange++
+    ImGui::BeginDisabled(!spongePlus); // grey out if SpongeRange+ is not active
+    if (ImGui::Checkbox("SpongeRange++", &spongePlusPlus) && PatchesReady()) {
+        const uint8_t patchPlusPlus[] = {0x5F, 0xFD, 0x03, 0xF1, 0x8B, 0x2D, 0x0D, 0x9B};
+        size_t idx = 5;
+        if (spongePlusPlus) {
+            ApplyPatch(idx, patchPlusPlus, sizeof(patchPlusPlus));
+        } else {
+            RestorePatch(idx);
+        }
+    }
+    ImGui::EndDisabled();
+    ImGui::Text("Absorb Type");
+    ImGui::SameLine();
+    // Number display
+    ImGui::SetNextItemWidth(50);
+    ImGui::InputInt("##absorbDisplay", &absorbTypeVal, 0, 0, ImGuiInputTextFlags_ReadOnly);
+    ImGui::SameLine();
+    // K button + square gap + minus/plus arrows
+    ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(6, 6));
+    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4, 4));
+    ImGui::PushStyleVar(ImGuiStyleVar_FrameRounding, 3.0f);
+    // Keypad button
+    if (ImGui::Button("K", ImVec2(ImGui::GetFrameHeight(), ImGui::GetFrameHeight()))) {
+        ImGui::OpenPopup("AbsorbKeypad");
+    }
+    ImGui::SameLine();
+    // i button
+    if (ImGui::Button("i", ImVec2(ImGui::GetFrameHeight(), ImGui::GetFrameHeight()))) {
+        ImGui::OpenPopup("AbsorbTypeInfo");
+    }
+    ImGui::SameLine();
+    // Minus button
+    if (ImGui::Button("-", ImVec2(ImGui::GetFrameHeight(), ImGui::GetFrameHeight()))) {
+        if (absorbTypeVal > 0) absorbTypeVal--;
+    }
+    ImGui::SameLine();
+    // Plus button
+    if (ImGui::Button("+", ImVec2(ImGui::GetFrameHeight(), ImGui::GetFrameHeight()))) {
+        if (absorbTypeVal < 575) absorbTypeVal++;
+    }
+    ImGui::PopStyleVar(3);
+    // Apply patch when value changes
+    if (PatchesReady() && absorbTypeVal >= 0 && absorbTypeVal <= 575 && absorbTypeVal != lastAbsorbValue) {
+        uint32_t instr = EncodeCmpW8Imm_Table(absorbTypeVal);
+        if (instr != 0) {
+            for (size_t idx : {6, 7}) {
+                ApplyPatch(idx, &instr, 4);
+            }
+            lastAbsorbValue = absorbTypeVal;
+        }
+    }
+    // Info popup
+    if (ImGui::BeginPopup("AbsorbTypeInfo", ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) {
+        ImGui::Text("Absorb Type Reference");
+        ImGui::SameLine(ImGui::GetWindowContentRegionMax().x - ImGui::GetFrameHeight());
+        if (ImGui::Button("X", ImVec2(ImGui::GetFrameHeight(), ImGui::GetFrameHeight()))) {
+            ImGui::CloseCurrentPopup();
+        }
+        ImGui::Separator();
+        if (ImGui::BeginTable("AbsorbRefTable", 2, ImGuiTableFlags_NoBordersInBody)) {
+            // First column
+            ImGui::TableNextColumn();
+            ImGui::BulletText("0 = air");
+            ImGui::BulletText("1 = dirt");
+            ImGui::BulletText("2 = wood");
+            ImGui::BulletText("3 = metal");
+            ImGui::BulletText("4 = copper grates");
+            ImGui::BulletText("5 = water");
+            ImGui::BulletText("6 = lava");
+            ImGui::BulletText("7 = leaves");
+            ImGui::BulletText("8 = plants");
+            ImGui::BulletText("9 = azalea, dried kelp, solid plants");
+            ImGui::BulletText("10 = fire, soul fire");
+            ImGui::BulletText("11 = glass");
+            ImGui::BulletText("12 = tnt");
+            // Second column
+            ImGui::TableNextColumn();
+            ImGui::BulletText("13 = ice (not blue/packed)");
+            ImGui::BulletText("14 = powdered snow");
+            ImGui::BulletText("15 = cactus");
+            ImGui::BulletText("16 = portals");
+            ImGui::BulletText("17 = unknown");
+            ImGui::BulletText("18 = bubble column");
+            ImGui::BulletText("19 = unknown");
+            ImGui::BulletText("20 = decorated pot, decoration solids");
+            ImGui::BulletText("21 = n/a");
+            ImGui::BulletText("22 = structure void");
+            ImGui::BulletText("23 = stone, etc, solids");
+            ImGui::BulletText("24 = torches, pot, etc, non-solids");
+            ImGui::BulletText("25 = unknown");
+            ImGui::EndTable();
+        }
+        ImGui::EndPopup();
+    }
+    // Keypad popup window
+    if (ImGui::BeginPopup("AbsorbKeypad", ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) {
+        // Title bar with a close X button at top-right
+        ImGui::Text("Keypad");
+        ImGui::SameLine(ImGui::GetWindowContentRegionMax().x - ImGui::GetFrameHeight());
+        if (ImGui::Button("X", ImVec2(ImGui::GetFrameHeight(), ImGui::GetFrameHeight()))) {
+            ImGui::CloseCurrentPopup();
+        }
+        ImGui::Separator();
+        // Fixed keypad grid size
+        const float cellWidth = 60.0f;
+        const float rowHeight = 50.0f;
+        // 1 2 3
+        for (int i = 1; i <= 3; i++) {
+            if (ImGui::Button(std::to_string(i).c_str(), ImVec2(cellWidth, rowHeight))) {
+                absorbTypeVal = absorbTypeVal * 10 + i;
+            }
+            if (i < 3) ImGui::SameLine();
+        }
+        // 4 5 6
+        for (int i = 4; i <= 6; i++) {
+            if (ImGui::Button(std::to_string(i).c_str(), ImVec2(cellWidth, rowHeight))) {
+                absorbTypeVal = absorbTypeVal * 10 + i;
+            }
+            if (i < 6) ImGui::SameLine();
+        }
+        // 7 8 9
+        for (int i = 7; i <= 9; i++) {
+            if (ImGui::Button(std::to_string(i).c_str(), ImVec2(cellWidth, rowHeight))) {
+                absorbTypeVal = absorbTypeVal * 10 + i;
+            }
+            if (i < 9) ImGui::SameLine();
+        }
+        // blank 0 <-
+        ImGui::Dummy(ImVec2(cellWidth, rowHeight));
+        ImGui::SameLine();
+        if (ImGui::Button("0", ImVec2(cellWidth, rowHeight))) {
+            absorbTypeVal = absorbTypeVal * 10;
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("<-", ImVec2(cellWidth, rowHeight))) { // backspace arrow
+            absorbTypeVal /= 10;
+        }
+        ImGui::EndPopup();
+    }
+    ImGui::Checkbox("Stats HUD", showStats);
+    // Touch-to-frame latency
+    if (stats.touchLastMs > 0.0f) {
+        ImGui::TextDisabled("Touch %.1f ms (avg %.1f, max %.1f)",
+            stats.touchLastMs, stats.touchAvgMs, stats.touchMaxMs);
+    }
+    // ImGui allocator activity in the last frame
+    ImGui::TextDisabled("Alloc %u calls, %u B, %u malloc",
+        stats.allocCalls, stats.allocBytes, stats.allocMallocs);
+    ImGui::End();
+}
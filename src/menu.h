@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Overlay measurements shown at the bottom of the menu
+struct MenuStats {
+    float touchLastMs, touchAvgMs, touchMaxMs;
+    uint32_t allocCalls, allocBytes, allocMallocs;
+};
+
+// Provided by the caller: src/main.cpp patches libminecraftpe.so at the addresses ScanSignatures()
+// found (index = signature), host tools just record the calls.
+bool PatchesReady();
+void ApplyPatch(size_t index, const void* bytes, size_t size);
+void RestorePatch(size_t index);
+
+// The mod's window, between ImGui::NewFrame() and ImGui::Render()
+void DrawMenu(const MenuStats& stats, bool* showStats);
@@ -0,0 +1,114 @@
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+
+#include "overlay_alloc.h"
+
+static constexpr size_t kAllocHeader = 16;      // keeps the 16-byte malloc alignment
+static constexpr int kSizeClasses = 9;          // 16 B .. 4 KB, larger goes to malloc
+static constexpr size_t kSlabSize = 64 * 1024;
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+// Pool block freed by a worker thread, waiting for the render thread to put it back in its free list.
+// The link goes after the size class, which stays in the first 4 bytes of the header.
+struct ForeignBlock {
+    uint32_t sizeClass;
+    uint32_t pad;
+    ForeignBlock* next;
+};
+static_assert(sizeof(ForeignBlock) <= kAllocHeader, "ForeignBlock must fit in the header");
+
+static thread_local bool t_workerThread = false;
+static FreeBlock* g_freeLists[kSizeClasses] = {};
+static std::atomic<ForeignBlock*> g_foreignBlocks{nullptr};
+static AllocStats g_allocFrame = {}; // frame being built
+
+static int SizeClass(size_t size) {
+    int c = 0;
+    while (c < kSizeClasses && ((size_t)16 << c) < size) c++;
+    return c;
+}
+
+static void RefillSizeClass(int c) {
+    size_t stride = kAllocHeader + ((size_t)16 << c);
+    uint8_t* slab = (uint8_t*)malloc(kSlabSize);
+    g_allocFrame.mallocs++;
+    if (!slab) return;
+    for (size_t off = 0; off + stride <= kSlabSize; off += stride) {
+        FreeBlock* f = (FreeBlock*)(slab + off);
+        f->next = g_freeLists[c];
+        g_freeLists[c] = f;
+    }
+}
+
+void* OverlayAlloc(size_t size, void*) {
+    if (t_workerThread) {
+        uint8_t* block = (uint8_t*)malloc(kAllocHeader + size);
+        if (!block) return nullptr;
+        *(uint32_t*)block = (uint32_t)kSizeClasses;
+        return block + kAllocHeader;
+    }
+    g_allocFrame.calls++;
+    g_allocFrame.bytes += (uint32_t)size;
+    int c = SizeClass(size);
+    uint8_t* block;
+    if (c == kSizeClasses) {
+        block = (uint8_t*)malloc(kAllocHeader + size);
+        g_allocFrame.mallocs++;
+    } else {
+        if (!g_freeLists[c]) RefillSizeClass(c);
+        block = (uint8_t*)g_freeLists[c];
+        if (block) g_freeLists[c] = g_freeLists[c]->next;
+    }
+    if (!block) return nullptr;
+    *(uint32_t*)block = (uint32_t)c;
+    return block + kAllocHeader;
+}
+
+static void PushFreeBlock(uint8_t* block, int c) {
+    FreeBlock* f = (FreeBlock*)block;
+    f->next = g_freeLists[c];
+    g_freeLists[c] = f;
+}
+
+void OverlayFree(void* ptr, void*) {
+    if (!ptr) return;
+    uint8_t* block = (uint8_t*)ptr - kAllocHeader;
+    int c = (int)*(uint32_t*)block;
+    if (t_workerThread) {
+        if (c == kSizeClasses) {
+            free(block);
+            return;
+        }
+        // A pool block (e.g. a render thread vector the worker grew): the free lists are the render thread's
+        ForeignBlock* f = (ForeignBlock*)block;
+        f->next = g_foreignBlocks.load(std::memory_order_relaxed);
+        while (!g_foreignBlocks.compare_exchange_weak(f->next, f, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        return;
+    }
+    g_allocFrame.calls++;
+    if (c == kSizeClasses) {
+        free(block);
+        return;
+    }
+    PushFreeBlock(block, c);
+}
+
+void SetOverlayAllocWorkerThread() {
+    t_workerThread = true;
+}
+
+AllocStats OverlayAllocNextFrame() {
+    for (ForeignBlock* f = g_foreignBlocks.exchange(nullptr, std::memory_order_acquire); f;) {
+        ForeignBlock* next = f->next;
+        PushFreeBlock((uint8_t*)f, (int)f->sizeClass);
+        f = next;
+    }
+    AllocStats last = g_allocFrame;
+    g_allocFrame = {};
+    return last;
+}
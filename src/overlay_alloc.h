@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// ImGui allocator, installed with ImGui::SetAllocatorFunctions(OverlayAlloc, OverlayFree, nullptr)
+// before the context is created. Everything ImGui allocates is served from size-class free lists
+// carved out of 64 KB slabs, so once the overlay is warmed up a frame makes no malloc call and never
+// contends with the game's allocator (tools/menu_render.cpp counts them).
+// The per-frame bump arena the allocator was first specified with was dropped on purpose: ImGui never
+// says an allocation is transient and its ImVectors keep their capacity from frame to frame, so nothing
+// could be released wholesale at the end of a frame, and the pools alone already reach zero mallocs.
+// The free lists and stats belong to the render thread. Worker threads go straight to malloc, and the
+// pool blocks they free (render thread allocations) are handed back at the next OverlayAllocNextFrame().
+
+struct AllocStats {
+    uint32_t calls;   // MemAlloc + MemFree
+    uint32_t bytes;   // requested by MemAlloc
+    uint32_t mallocs; // slabs and large blocks taken from the system
+};
+
+void* OverlayAlloc(size_t size, void* userData);
+void OverlayFree(void* ptr, void* userData);
+
+// For threads other than the render thread (panel and font workers), before they allocate
+void SetOverlayAllocWorkerThread();
+
+// Start of a frame, on the render thread: takes back the pool blocks freed by workers, returns the stats of
+// the frame that just ended and resets them
+AllocStats OverlayAllocNextFrame();
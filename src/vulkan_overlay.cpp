@@ -0,0 +1,239 @@
+#include <cstdint>
+#include <vector>
+
+#include "ImGui/imgui.h"
+#include "ImGui/backends/imgui_impl_vulkan.h"
+#include "vulkan_overlay.h"
+
+static bool IsSrgbFormat(VkFormat format) {
+    switch (format) {
+    case VK_FORMAT_R8G8B8A8_SRGB:
+    case VK_FORMAT_B8G8R8A8_SRGB:
+    case VK_FORMAT_A8B8G8R8_SRGB_PACK32:
+    case VK_FORMAT_R8G8B8_SRGB:
+    case VK_FORMAT_B8G8R8_SRGB:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool VulkanOverlaySupportsTransform(VkSurfaceTransformFlagBitsKHR transform) {
+    return transform == VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR || transform == VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR ||
+           transform == VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR || transform == VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR;
+}
+
+static void WaitIdle(VulkanOverlay& ov) {
+    for (VulkanOverlayFrame& f : ov.frames)
+        if (f.fence) vkWaitForFences(ov.device, 1, &f.fence, VK_TRUE, UINT64_MAX);
+}
+
+// Fences are created signaled, as if a previous frame had completed
+static VkResult CreateSignaledFence(VkDevice device, VkFence* fence) {
+    VkFenceCreateInfo info = {};
+    info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+    return vkCreateFence(device, &info, nullptr, fence);
+}
+
+static VkResult CreateRenderPass(VulkanOverlay& ov) {
+    // Keep what was rendered, hand the image back ready for presentation
+    VkAttachmentDescription attachment = {};
+    attachment.format = ov.format;
+    attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    attachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+    attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachment.initialLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    attachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    VkAttachmentReference colorAttachment = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &colorAttachment;
+
+    // Our submit waits on the original semaphores at the color attachment output stage, which the load and layout
+    // transition happen in
+    VkSubpassDependency dependencies[2] = {};
+    dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[0].dstSubpass = 0;
+    dependencies[0].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependencies[0].srcAccessMask = 0;
+    dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    dependencies[1].srcSubpass = 0;
+    dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependencies[1].dstStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+    dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    dependencies[1].dstAccessMask = 0;
+
+    VkRenderPassCreateInfo info = {};
+    info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    info.attachmentCount = 1;
+    info.pAttachments = &attachment;
+    info.subpassCount = 1;
+    info.pSubpasses = &subpass;
+    info.dependencyCount = 2;
+    info.pDependencies = dependencies;
+    return vkCreateRenderPass(ov.device, &info, nullptr, &ov.renderPass);
+}
+
+static VkResult CreateFrame(VulkanOverlay& ov, uint32_t queueFamily, VulkanOverlayFrame& f) {
+    VkCommandPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    poolInfo.queueFamilyIndex = queueFamily;
+    VkResult err = vkCreateCommandPool(ov.device, &poolInfo, nullptr, &f.pool);
+    if (err != VK_SUCCESS) return err;
+    VkCommandBufferAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = f.pool;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = 1;
+    if ((err = vkAllocateCommandBuffers(ov.device, &allocInfo, &f.cmd)) != VK_SUCCESS) return err;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+    if ((err = vkAllocateCommandBuffers(ov.device, &allocInfo, &f.secondaryCmd)) != VK_SUCCESS) return err;
+    return CreateSignaledFence(ov.device, &f.fence);
+}
+
+bool VulkanOverlayCreate(VulkanOverlay& ov, VkDevice device, uint32_t queueFamily, VkFormat format, uint32_t frameCount) {
+    IM_ASSERT(ov.device == VK_NULL_HANDLE && frameCount >= 1);
+    ov.device = device;
+    ov.format = format;
+    ov.srgb = IsSrgbFormat(format);
+    ov.frameIndex = 0;
+    ov.frameCount = frameCount;
+    bool ok = CreateRenderPass(ov) == VK_SUCCESS;
+    ov.frames.assign(frameCount, VulkanOverlayFrame{});
+    for (VulkanOverlayFrame& f : ov.frames)
+        ok = ok && CreateFrame(ov, queueFamily, f) == VK_SUCCESS;
+    if (!ok) VulkanOverlayDestroy(ov);
+    return ok;
+}
+
+void VulkanOverlayDestroy(VulkanOverlay& ov) {
+    if (ov.device == VK_NULL_HANDLE) return;
+    VulkanOverlaySetImages(ov, nullptr, 0, ov.extent, ov.transform);
+    for (VulkanOverlayFrame& f : ov.frames) {
+        if (f.fence) vkDestroyFence(ov.device, f.fence, nullptr);
+        if (f.pool) vkDestroyCommandPool(ov.device, f.pool, nullptr); // frees its command buffers
+    }
+    if (ov.renderPass) vkDestroyRenderPass(ov.device, ov.renderPass, nullptr);
+    ov = VulkanOverlay();
+}
+
+bool VulkanOverlaySetImages(VulkanOverlay& ov, const VkImage* images, uint32_t imageCount, VkExtent2D extent, VkSurfaceTransformFlagBitsKHR transform) {
+    IM_ASSERT(ov.device != VK_NULL_HANDLE && VulkanOverlaySupportsTransform(transform));
+    WaitIdle(ov);
+    for (VulkanOverlayImage& img : ov.images) {
+        if (img.framebuffer) vkDestroyFramebuffer(ov.device, img.framebuffer, nullptr);
+        if (img.view) vkDestroyImageView(ov.device, img.view, nullptr);
+        if (img.renderComplete) vkDestroySemaphore(ov.device, img.renderComplete, nullptr);
+    }
+    ov.images.assign(imageCount, VulkanOverlayImage{});
+    ov.extent = extent;
+    ov.transform = transform;
+
+    for (uint32_t i = 0; i < imageCount; i++) {
+        VulkanOverlayImage& img = ov.images[i];
+        img.image = images[i];
+        VkImageViewCreateInfo viewInfo = {};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = images[i];
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = ov.format;
+        viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+        VkResult err = vkCreateImageView(ov.device, &viewInfo, nullptr, &img.view);
+        if (err == VK_SUCCESS) {
+            VkFramebufferCreateInfo fbInfo = {};
+            fbInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+            fbInfo.renderPass = ov.renderPass;
+            fbInfo.attachmentCount = 1;
+            fbInfo.pAttachments = &img.view;
+            fbInfo.width = extent.width;
+            fbInfo.height = extent.height;
+            fbInfo.layers = 1;
+            err = vkCreateFramebuffer(ov.device, &fbInfo, nullptr, &img.framebuffer);
+        }
+        if (err == VK_SUCCESS) {
+            VkSemaphoreCreateInfo semInfo = {};
+            semInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            err = vkCreateSemaphore(ov.device, &semInfo, nullptr, &img.renderComplete);
+        }
+        if (err != VK_SUCCESS) {
+            VulkanOverlaySetImages(ov, nullptr, 0, extent, transform);
+            return false;
+        }
+    }
+    return true;
+}
+
+void VulkanOverlayNewFrame(VulkanOverlay& ov) {
+    // Also makes the backend's buffers for this frame reusable
+    ov.frameIndex = (ov.frameIndex + 1) % ov.frameCount;
+    VulkanOverlayFrame& f = ov.frames[ov.frameIndex];
+    if (f.fence) vkWaitForFences(ov.device, 1, &f.fence, VK_TRUE, UINT64_MAX);
+    ImGui_ImplVulkan_NewFrame();
+}
+
+VkSemaphore VulkanOverlayRender(VulkanOverlay& ov, VkQueue queue, uint32_t imageIndex, ImDrawData* drawData, const VkSemaphore* waitSemaphores, uint32_t waitCount) {
+    if (imageIndex >= ov.images.size()) return VK_NULL_HANDLE;
+    VulkanOverlayFrame& f = ov.frames[ov.frameIndex];
+    VulkanOverlayImage& img = ov.images[imageIndex];
+    if (vkResetCommandPool(ov.device, f.pool, 0) != VK_SUCCESS) return VK_NULL_HANDLE;
+
+    // Texture uploads go first, in the primary command buffer: RenderDrawData() expects textures to be up to date
+    VkCommandBufferBeginInfo begin = {};
+    begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(f.cmd, &begin);
+    ImGui_ImplVulkan_UpdateTextures(drawData, f.cmd);
+
+    // Draw commands, in the secondary command buffer
+    VkCommandBufferInheritanceInfo inheritance = {};
+    inheritance.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritance.renderPass = ov.renderPass;
+    inheritance.subpass = 0;
+    inheritance.framebuffer = img.framebuffer;
+    VkCommandBufferBeginInfo secondaryBegin = {};
+    secondaryBegin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    secondaryBegin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    secondaryBegin.pInheritanceInfo = &inheritance;
+    vkBeginCommandBuffer(f.secondaryCmd, &secondaryBegin);
+    ImGui_ImplVulkan_SetPreTransform(ov.transform);
+    ImGui_ImplVulkan_RenderDrawData(drawData, f.secondaryCmd);
+    vkEndCommandBuffer(f.secondaryCmd);
+
+    VkRenderPassBeginInfo pass = {};
+    pass.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    pass.renderPass = ov.renderPass;
+    pass.framebuffer = img.framebuffer;
+    pass.renderArea.extent = ov.extent;
+    vkCmdBeginRenderPass(f.cmd, &pass, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+    vkCmdExecuteCommands(f.cmd, 1, &f.secondaryCmd);
+    vkCmdEndRenderPass(f.cmd);
+    if (vkEndCommandBuffer(f.cmd) != VK_SUCCESS) return VK_NULL_HANDLE;
+
+    // Submit, waiting where the original presentation would have
+    ov.waitStages.assign(waitCount, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+    VkSubmitInfo submit = {};
+    submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit.waitSemaphoreCount = waitCount;
+    submit.pWaitSemaphores = waitSemaphores;
+    submit.pWaitDstStageMask = ov.waitStages.data();
+    submit.commandBufferCount = 1;
+    submit.pCommandBuffers = &f.cmd;
+    submit.signalSemaphoreCount = 1;
+    submit.pSignalSemaphores = &img.renderComplete;
+    vkResetFences(ov.device, 1, &f.fence);
+    if (vkQueueSubmit(queue, 1, &submit, f.fence) != VK_SUCCESS) {
+        // Nothing will signal the fence: recreate it signaled so the next wait on it doesn't block forever
+        vkDestroyFence(ov.device, f.fence, nullptr);
+        f.fence = VK_NULL_HANDLE;
+        CreateSignaledFence(ov.device, &f.fence);
+        return VK_NULL_HANDLE;
+    }
+    return img.renderComplete;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+struct ImDrawData;
+
+// Draws the overlay with the Vulkan backend (imgui_impl_vulkan) on presentable images rendered by someone
+// else: the game's swapchain images, from the vkQueuePresentKHR hook in src/main.cpp.
+// - The render pass loads the image and leaves it in VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, so it is presented as
+//   it was going to be.
+// - Each frame is recorded into a secondary command buffer executed by a primary one, which also records the
+//   texture uploads, and is submitted waiting on the semaphores the present was going to wait on.
+// - sRGB images: the backend converts the UI colors to linear (ImGui_ImplVulkan_InitInfo::SrgbColorAttachment,
+//   set it from VulkanOverlay::srgb). Pre-rotated images: the backend rotates the UI into them.
+// Create the overlay once the image format is known, then call ImGui_ImplVulkan_Init() with its renderPass and
+// frameCount. Call VulkanOverlaySetImages() when the images change (the swapchain was recreated). Per frame:
+// VulkanOverlayNewFrame() instead of ImGui_ImplVulkan_NewFrame(), then VulkanOverlayRender().
+
+struct VulkanOverlayImage {
+    VkImage image;
+    VkImageView view;
+    VkFramebuffer framebuffer;
+    VkSemaphore renderComplete; // signaled by our submit, the present waits on it instead of its own semaphores
+};
+
+struct VulkanOverlayFrame {
+    VkCommandPool pool;
+    VkCommandBuffer cmd;          // primary: texture uploads, render pass
+    VkCommandBuffer secondaryCmd; // draw commands
+    VkFence fence;
+};
+
+struct VulkanOverlay {
+    VkDevice device = VK_NULL_HANDLE;
+    VkFormat format = VK_FORMAT_UNDEFINED;
+    bool srgb = false;
+    VkExtent2D extent = {};       // of the images, before rotation
+    VkSurfaceTransformFlagBitsKHR transform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    VkRenderPass renderPass = VK_NULL_HANDLE;
+    uint32_t frameIndex = 0;      // current frame in flight
+    uint32_t frameCount = 0;      // frames in flight, ImGui_ImplVulkan_InitInfo::ImageCount
+    std::vector<VulkanOverlayFrame> frames;
+    std::vector<VulkanOverlayImage> images;
+    std::vector<VkPipelineStageFlags> waitStages; // scratch for vkQueueSubmit()
+};
+
+bool VulkanOverlayCreate(VulkanOverlay& ov, VkDevice device, uint32_t queueFamily, VkFormat format, uint32_t frameCount);
+// Waits for our submits to complete
+void VulkanOverlayDestroy(VulkanOverlay& ov);
+// Waits for our submits to complete. 0 images to only release them. 'transform' is the swapchain's preTransform,
+// only the identity and the 90/180/270 degree rotations are supported.
+bool VulkanOverlaySetImages(VulkanOverlay& ov, const VkImage* images, uint32_t imageCount, VkExtent2D extent, VkSurfaceTransformFlagBitsKHR transform);
+// Waits for the GPU to be done with the frame in flight we're about to reuse
+void VulkanOverlayNewFrame(VulkanOverlay& ov);
+// Returns the semaphore to wait on instead of 'waitSemaphores', VK_NULL_HANDLE if nothing was submitted (the wait
+// semaphores are then left untouched)
+VkSemaphore VulkanOverlayRender(VulkanOverlay& ov, VkQueue queue, uint32_t imageIndex, ImDrawData* drawData, const VkSemaphore* waitSemaphores, uint32_t waitCount);
+
+// Whether the UI can be rotated into images presented with this preTransform
+bool VulkanOverlaySupportsTransform(VkSurfaceTransformFlagBitsKHR transform);
@@ -0,0 +1,188 @@
+// Benchmarks the font atlas packers (stb_rect_pack's skyline vs ImFontAtlasFlags_PackGuillotine) on workloads where
+// glyphs keep being added and discarded, and checks that live rectangles never overlap.
+//
+// Rectangles go through the same internal API as glyphs do (ImFontAtlasPackAddRect/DiscardRect, plus an upload of
+// the glyph's pixels), with a frame ended every kOpsPerFrame operations so textures get created/destroyed like in
+// the app. Reported per packer:
+// - pack: time spent adding and discarding, including repacks and texture growth
+// - tex: final texture size, and how many textures were created (initial one included, each is a full upload)
+// - upload: bytes a renderer would have uploaded, full textures plus update rectangles
+// - occupancy: padded live surface over texture surface, averaged over frames
+//
+// Host build, from the repository root:
+//   g++ -O2 -std=c++17 -Isrc/ImGui tools/atlas_pack_bench.cpp src/ImGui/imgui*.cpp -o atlas_pack_bench
+//   ./atlas_pack_bench
+// Exits with 1 if two live rectangles overlap or a rectangle fails to pack.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+static constexpr int kOpsPerFrame = 95;
+
+struct Stats {
+    double packMs = 0.0;
+    int texCreated = 0;
+    size_t uploadBytes = 0;
+    double occupancySum = 0.0;
+    int frames = 0;
+    int failures = 0;
+    bool overlap = false;
+};
+
+static uint32_t g_rng = 1;
+static int Random(int lo, int hi) { // inclusive
+    g_rng = g_rng * 1664525u + 1013904223u;
+    return lo + (int)((g_rng >> 8) % (uint32_t)(hi - lo + 1));
+}
+
+// Roughly the bounding boxes of Latin glyphs at a given pixel size
+static ImVec2i RandomGlyphSize(int size) {
+    return ImVec2i(ImMax(1, Random(size * 15 / 100, size * 75 / 100)), ImMax(1, Random(size * 20 / 100, size * 105 / 100)));
+}
+
+// Marks every used rectangle (with padding) in a coverage map, returns false if two of them share a pixel
+static bool CheckNoOverlap(ImFontAtlas* atlas) {
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImTextureData* tex = atlas->TexData;
+    const int pad = atlas->TexGlyphPadding;
+    std::vector<uint8_t> coverage((size_t)tex->Width * tex->Height);
+    for (const ImFontAtlasRectEntry& entry : builder->RectsIndex) {
+        if (!entry.IsUsed) continue;
+        const ImTextureRect& r = builder->Rects[entry.TargetIndex];
+        if (r.x + r.w + pad > tex->Width || r.y + r.h + pad > tex->Height) return false;
+        for (int y = r.y; y < r.y + r.h + pad; y++)
+            for (int x = r.x; x < r.x + r.w + pad; x++)
+                if (coverage[(size_t)y * tex->Width + x]++) return false;
+    }
+    return true;
+}
+
+// Plays the renderer's part, then starts a new frame
+static void EndFrame(ImFontAtlas* atlas, int& frame, Stats& st) {
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    int liveSurface = 0;
+    for (const ImFontAtlasRectEntry& entry : builder->RectsIndex)
+        if (entry.IsUsed) {
+            const ImTextureRect& r = builder->Rects[entry.TargetIndex];
+            liveSurface += (r.w + atlas->TexGlyphPadding) * (r.h + atlas->TexGlyphPadding);
+        }
+    st.occupancySum += (double)liveSurface / (atlas->TexData->Width * atlas->TexData->Height);
+    st.frames++;
+    for (ImTextureData* tex : atlas->TexList) {
+        if (tex->Status == ImTextureStatus_WantCreate) {
+            st.texCreated++;
+            st.uploadBytes += (size_t)tex->GetSizeInBytes();
+            tex->SetTexID((ImTextureID)1);
+            tex->SetStatus(ImTextureStatus_OK);
+        } else if (tex->Status == ImTextureStatus_WantUpdates) {
+            for (const ImTextureRect& r : tex->Updates)
+                st.uploadBytes += (size_t)r.w * r.h * tex->BytesPerPixel;
+            tex->SetStatus(ImTextureStatus_OK);
+        } else if (tex->Status == ImTextureStatus_WantDestroy) {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+    }
+    ImFontAtlasUpdateNewFrame(atlas, ++frame, true);
+}
+
+static ImFontAtlasRectId AddGlyph(ImFontAtlas* atlas, ImVec2i size, Stats& st) {
+    ImFontAtlasRectId id = ImFontAtlasPackAddRect(atlas, size.x, size.y);
+    if (id == ImFontAtlasRectId_Invalid) {
+        st.failures++;
+        return id;
+    }
+    ImTextureRect* r = ImFontAtlasPackGetRect(atlas, id);
+    ImFontAtlasTextureBlockQueueUpload(atlas, atlas->TexData, r->x, r->y, r->w, r->h);
+    return id;
+}
+
+typedef void (*WorkloadFunc)(ImFontAtlas* atlas, int& frame, Stats& st);
+
+// Font size keeps changing (e.g. zooming): each size bakes printable ASCII, the 3 most recent sizes stay live
+static void WorkloadSizes(ImFontAtlas* atlas, int& frame, Stats& st) {
+    std::vector<std::vector<ImFontAtlasRectId>> batches;
+    for (int n = 0; n < 400; n++) {
+        auto t0 = std::chrono::steady_clock::now();
+        if (batches.size() == 3) {
+            for (ImFontAtlasRectId id : batches.front())
+                if (id != ImFontAtlasRectId_Invalid) ImFontAtlasPackDiscardRect(atlas, id);
+            batches.erase(batches.begin());
+        }
+        const int size = Random(12, 64);
+        batches.emplace_back();
+        for (int c = 0; c < kOpsPerFrame; c++)
+            batches.back().push_back(AddGlyph(atlas, RandomGlyphSize(size), st));
+        st.packMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        EndFrame(atlas, frame, st);
+        if ((n % 50) == 0 && !CheckNoOverlap(atlas)) st.overlap = true;
+    }
+}
+
+// Large character set at a few sizes (e.g. CJK chat): 1500 glyphs live, one is evicted for every new one
+static void WorkloadGlyphs(ImFontAtlas* atlas, int& frame, Stats& st) {
+    static const int sizes[] = { 13, 16, 18, 24, 32 };
+    std::vector<ImFontAtlasRectId> live;
+    for (int n = 0; n < 2000; n++) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (int c = 0; c < kOpsPerFrame; c++) {
+            if (live.size() == 1500) {
+                const size_t victim = (size_t)Random(0, (int)live.size() - 1);
+                if (live[victim] != ImFontAtlasRectId_Invalid) ImFontAtlasPackDiscardRect(atlas, live[victim]);
+                live[victim] = live.back();
+                live.pop_back();
+            }
+            live.push_back(AddGlyph(atlas, RandomGlyphSize(sizes[Random(0, IM_ARRAYSIZE(sizes) - 1)]), st));
+        }
+        st.packMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        EndFrame(atlas, frame, st);
+        if ((n % 250) == 0 && !CheckNoOverlap(atlas)) st.overlap = true;
+    }
+}
+
+static bool Run(const char* name, WorkloadFunc workload) {
+    bool ok = true;
+    printf("%s\n", name);
+    for (int guillotine = 0; guillotine < 2; guillotine++) {
+        ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+        ImFontAtlas* atlas = io.Fonts;
+        atlas->TexDesiredFormat = ImTextureFormat_Alpha8;
+        if (guillotine) atlas->Flags |= ImFontAtlasFlags_PackGuillotine;
+        atlas->AddFontDefault();
+        ImGui::NewFrame();
+        ImGui::EndFrame();
+
+        Stats st;
+        int frame = ImGui::GetFrameCount() + 1;
+        g_rng = 1;
+        EndFrame(atlas, frame, st);
+        st = Stats();
+        st.texCreated = 1;
+        st.uploadBytes = (size_t)atlas->TexData->GetSizeInBytes();
+        workload(atlas, frame, st);
+        if (!CheckNoOverlap(atlas)) st.overlap = true;
+
+        printf("  %-10s pack %7.2f ms  tex %4dx%-4d (%3d created)  upload %7.2f MB  occupancy %4.1f%%%s%s\n",
+            guillotine ? "guillotine" : "skyline", st.packMs, atlas->TexData->Width, atlas->TexData->Height, st.texCreated,
+            st.uploadBytes / (1024.0 * 1024.0), 100.0 * st.occupancySum / st.frames,
+            st.failures ? "  FAILED TO PACK" : "", st.overlap ? "  OVERLAP" : "");
+        ok &= !st.overlap && st.failures == 0;
+        ImGui::DestroyContext();
+    }
+    return ok;
+}
+
+int main() {
+    bool ok = true;
+    ok &= Run("sizes: 400 size changes, 3 x 95 glyphs live", WorkloadSizes);
+    ok &= Run("glyphs: 190000 glyph replacements, 1500 glyphs live", WorkloadGlyphs);
+    return ok ? 0 : 1;
+}
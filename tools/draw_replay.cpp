@@ -0,0 +1,232 @@
+// Replays a draw trace (src/draw_trace.h) through a renderer backend and times each frame, so renderer changes
+// can be compared on identical frames. Traces come from a device build configured with -DDRAW_TRACE_FRAMES=n
+// (see CMakeLists.txt), or from tools/menu_render.cpp --trace.
+//
+// Backends:
+// - gl: imgui_impl_opengl3 on an offscreen GLES 3 context (EGL surfaceless, e.g. Mesa llvmpipe), timed up to glFinish()
+// - software: imgui_impl_software
+// A frame's time is ImGui_ImplXXX_RenderDrawData() with the frame's texture requests, the target is cleared before.
+// The first frame of a pass creates the textures, it is reported apart.
+//
+// Host build, from the repository root. Add the definitions of the build that recorded the trace (the device
+// build uses IMGUI_IMPL_OPENGL_BATCH_DRAW_CALLS), the ImDrawVert layout must match:
+//   g++ -O2 -std=c++17 -DIMGUI_IMPL_OPENGL_ES3 -Isrc -Isrc/ImGui -Isrc/ImGui/backends tools/draw_replay.cpp src/draw_trace.cpp
+//       src/ImGui/imgui.cpp src/ImGui/imgui_draw.cpp src/ImGui/imgui_tables.cpp src/ImGui/imgui_widgets.cpp
+//       src/ImGui/backends/imgui_impl_opengl3.cpp src/ImGui/backends/imgui_impl_software.cpp -lEGL -lGLESv2 -pthread -o draw_replay
+//   ./draw_replay file.trace [--backend gl|software] [--passes n] [--threads n] [--ppm file]
+// --passes replays the trace n times, --threads is for the software backend, --ppm writes the last frame.
+// Exits with 1 if the trace can't be loaded or a frame can't be rebuilt.
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GLES3/gl3.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "imgui.h"
+#include "imgui_impl_opengl3.h"
+#include "imgui_impl_software.h"
+#include "draw_trace.h"
+
+enum class Backend { GL, Software };
+
+struct Target {
+    int width = 0, height = 0;
+    GLuint fbo = 0, renderbuffer = 0;
+    std::vector<ImU32> pixels;
+};
+
+static bool InitEGL() {
+    auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (!getPlatformDisplay) return false;
+    EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    EGLint major, minor;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) return false;
+    eglBindAPI(EGL_OPENGL_ES_API);
+    const EGLint attribs[] = { EGL_CONTEXT_MAJOR_VERSION, 3, EGL_NONE };
+    EGLContext context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, attribs);
+    return context != EGL_NO_CONTEXT && eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+}
+
+static void ResizeTarget(Target& t, Backend backend, int width, int height) {
+    if (t.width == width && t.height == height) return;
+    t.width = width;
+    t.height = height;
+    if (backend == Backend::Software) {
+        t.pixels.resize((size_t)width * height);
+        return;
+    }
+    if (!t.fbo) {
+        glGenFramebuffers(1, &t.fbo);
+        glGenRenderbuffers(1, &t.renderbuffer);
+    }
+    glBindRenderbuffer(GL_RENDERBUFFER, t.renderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glBindFramebuffer(GL_FRAMEBUFFER, t.fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, t.renderbuffer);
+}
+
+static void ClearTarget(Target& t, Backend backend) {
+    if (backend == Backend::Software) {
+        std::fill(t.pixels.begin(), t.pixels.end(), IM_COL32(0, 0, 0, 255));
+        return;
+    }
+    glViewport(0, 0, t.width, t.height);
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glFinish();
+}
+
+static bool WritePpm(const char* path, Target& t, Backend backend) {
+    if (backend == Backend::GL) {
+        t.pixels.resize((size_t)t.width * t.height);
+        glReadPixels(0, 0, t.width, t.height, GL_RGBA, GL_UNSIGNED_BYTE, t.pixels.data());
+    }
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    fprintf(f, "P6\n%d %d\n255\n", t.width, t.height);
+    for (int y = 0; y < t.height; y++) {
+        const int row = backend == Backend::GL ? t.height - 1 - y : y; // GL rows go up
+        for (int x = 0; x < t.width; x++) {
+            const ImU32 c = t.pixels[(size_t)row * t.width + x];
+            const unsigned char rgb[3] = { (unsigned char)(c >> IM_COL32_R_SHIFT), (unsigned char)(c >> IM_COL32_G_SHIFT), (unsigned char)(c >> IM_COL32_B_SHIFT) };
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+    return fclose(f) == 0;
+}
+
+static double Percentile(std::vector<double> v, double p) {
+    if (v.empty()) return 0.0;
+    std::sort(v.begin(), v.end());
+    return v[std::min(v.size() - 1, (size_t)(p * (v.size() - 1) + 0.5))];
+}
+
+int main(int argc, char** argv) {
+    const char* tracePath = nullptr;
+    const char* ppmPath = nullptr;
+    Backend backend = Backend::GL;
+    int passes = 1, threads = 0;
+    for (int i = 1; i < argc; i++) {
+        const bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--backend") && hasValue) {
+            const char* name = argv[++i];
+            if (!strcmp(name, "gl")) backend = Backend::GL;
+            else if (!strcmp(name, "software")) backend = Backend::Software;
+            else {
+                fprintf(stderr, "draw_replay: unknown backend %s\n", name);
+                return 1;
+            }
+        }
+        else if (!strcmp(argv[i], "--passes") && hasValue) passes = std::max(1, atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--threads") && hasValue) threads = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--ppm") && hasValue) ppmPath = argv[++i];
+        else if (argv[i][0] != '-' && !tracePath) tracePath = argv[i];
+        else {
+            fprintf(stderr, "draw_replay: unknown argument %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (!tracePath) {
+        fprintf(stderr, "usage: draw_replay file.trace [--backend gl|software] [--passes n] [--threads n] [--ppm file]\n");
+        return 1;
+    }
+
+    DrawTraceReader trace;
+    if (!DrawTraceLoad(trace, tracePath)) {
+        fprintf(stderr, "draw_replay: can't load %s (or it was recorded with another ImDrawVert/ImDrawIdx)\n", tracePath);
+        return 1;
+    }
+    printf("%s: %zu frames, %zu bytes\n", tracePath, trace.frameOffsets.size(), trace.data.size());
+
+    // The backends keep their data in the current context's ImGuiIO
+    ImGui::CreateContext();
+    ImGui::GetIO().IniFilename = nullptr;
+    const ImU32 white = IM_COL32_WHITE;
+    GLuint whiteTexture = 0;
+    ImGui_ImplSoftware_Texture* whiteSoftware = nullptr;
+    void (*updateTexture)(ImTextureData*) = nullptr;
+    if (backend == Backend::GL) {
+        if (!InitEGL()) {
+            fprintf(stderr, "draw_replay: no EGL surfaceless GLES 3 context\n");
+            return 1;
+        }
+        ImGui_ImplOpenGL3_Init("#version 300 es");
+        glGenTextures(1, &whiteTexture);
+        glBindTexture(GL_TEXTURE_2D, whiteTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &white);
+        trace.userTexture = (ImTextureID)(intptr_t)whiteTexture;
+        updateTexture = ImGui_ImplOpenGL3_UpdateTexture;
+        printf("backend: gl, %s\n", (const char*)glGetString(GL_RENDERER));
+    } else {
+        ImGui_ImplSoftware_Init(threads);
+        whiteSoftware = ImGui_ImplSoftware_CreateTexture(&white, 1, 1);
+        trace.userTexture = (ImTextureID)(intptr_t)whiteSoftware;
+        updateTexture = ImGui_ImplSoftware_UpdateTexture;
+        printf("backend: software\n");
+    }
+
+    Target target;
+    std::vector<double> firstMs, frameMs;
+    double vertices = 0.0, indices = 0.0;
+    bool ok = true;
+    for (int pass = 0; pass < passes && ok; pass++) {
+        if (pass > 0) DrawTraceRewind(trace, updateTexture);
+        size_t frame = 0;
+        while (ImDrawData* drawData = DrawTraceNextFrame(trace)) {
+            ResizeTarget(target, backend, (int)(drawData->DisplaySize.x * drawData->FramebufferScale.x), (int)(drawData->DisplaySize.y * drawData->FramebufferScale.y));
+            ClearTarget(target, backend);
+            auto t0 = std::chrono::steady_clock::now();
+            if (backend == Backend::GL) {
+                ImGui_ImplOpenGL3_NewFrame();
+                ImGui_ImplOpenGL3_RenderDrawData(drawData);
+                glFinish();
+            } else {
+                ImGui_ImplSoftware_NewFrame();
+                ImGui_ImplSoftware_RenderDrawData(drawData, target.pixels.data(), target.width, target.height, target.width);
+            }
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+            (frame == 0 ? firstMs : frameMs).push_back(ms);
+            vertices += drawData->TotalVtxCount;
+            indices += drawData->TotalIdxCount;
+            frame++;
+        }
+        if (frame != trace.frameOffsets.size()) {
+            fprintf(stderr, "draw_replay: frame %zu can't be rebuilt\n", frame);
+            ok = false;
+        }
+    }
+
+    const size_t frames = firstMs.size() + frameMs.size();
+    if (frames > 0) {
+        double total = 0.0;
+        for (double ms : frameMs) total += ms;
+        printf("per frame: %.0f vertices, %.0f indices\n", vertices / frames, indices / frames);
+        printf("first frame: %.3f ms (median of %zu passes)\n", Percentile(firstMs, 0.5), firstMs.size());
+        if (!frameMs.empty())
+            printf("other frames: avg %.3f ms, median %.3f, p95 %.3f, max %.3f (%zu frames)\n", total / frameMs.size(),
+                   Percentile(frameMs, 0.5), Percentile(frameMs, 0.95), Percentile(frameMs, 1.0), frameMs.size());
+    }
+    if (ok && ppmPath && frames > 0 && !WritePpm(ppmPath, target, backend)) {
+        fprintf(stderr, "draw_replay: can't write %s\n", ppmPath);
+        ok = false;
+    }
+
+    if (backend == Backend::GL) glFinish();
+    DrawTraceRewind(trace, updateTexture);
+    DrawTraceUnload(trace);
+    if (backend == Backend::GL) {
+        glDeleteTextures(1, &whiteTexture);
+        ImGui_ImplOpenGL3_Shutdown();
+    } else {
+        ImGui_ImplSoftware_DestroyTexture(whiteSoftware);
+        ImGui_ImplSoftware_Shutdown();
+    }
+    ImGui::DestroyContext();
+    return ok ? 0 : 1;
+}
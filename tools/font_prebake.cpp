@@ -0,0 +1,183 @@
+// Prebakes the default font for the overlay at every font scale bucket Setup() can pick, and
+// writes the result as a header linked into the library (src/font_prebaked.h).
+//
+// Glyphs are produced by the stock stb_truetype loader with the same ImFontConfig as Setup(),
+// and recorded exactly as that loader returned them, so a prebaked glyph is indistinguishable
+// from one rasterized at runtime. Bitmaps are Alpha8, compressed row by row (see Compress()).
+//
+// Host build, from the repository root:
+//   g++ -O2 -std=c++17 -Isrc/ImGui tools/font_prebake.cpp src/ImGui/imgui*.cpp -o font_prebake
+//   ./font_prebake > src/font_prebaked.h
+// Re-run after changing the font config in Setup(), its buckets, or updating ImGui.
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+static constexpr int kFirstChar = 32;
+static constexpr int kLastChar = 126;
+static constexpr float kBaseSize = 18.0f;     // Setup(): cfg.SizePixels = 18 * font scale
+static constexpr float kScaleMin = 1.5f;
+static constexpr float kScaleMax = 4.0f;
+static constexpr float kScaleStep = 0.25f;
+
+struct Glyph {
+    ImFontGlyph glyph;
+    int w = 0, h = 0;
+    uint32_t offset = 0;
+    bool loaded = false;
+};
+
+static const ImFontLoader* g_stbLoader = nullptr;
+static Glyph g_record[kLastChar - kFirstChar + 1];
+static std::vector<uint8_t> g_pixels;
+
+// PackBits per row: n in 0..127 copies the next n + 1 bytes, n in -127..-1 repeats the next byte
+// 1 - n times. The otherwise unused -128 repeats the previous row: ProggyClean is a pixel font,
+// scaled up it is mostly made of identical rows.
+static void PackBitsRow(const uint8_t* src, int size, std::vector<uint8_t>& out) {
+    int i = 0;
+    while (i < size) {
+        int run = 1;
+        while (i + run < size && run < 128 && src[i + run] == src[i]) run++;
+        if (run >= 3) {
+            out.push_back((uint8_t)(257 - run)); // -(run - 1)
+            out.push_back(src[i]);
+            i += run;
+            continue;
+        }
+        int lit = 0;
+        while (i + lit < size && lit < 128) {
+            if (i + lit + 2 < size && src[i + lit] == src[i + lit + 1] && src[i + lit] == src[i + lit + 2]) break;
+            lit++;
+        }
+        out.push_back((uint8_t)(lit - 1));
+        out.insert(out.end(), src + i, src + i + lit);
+        i += lit;
+    }
+}
+
+static void Compress(const uint8_t* src, int w, int h, std::vector<uint8_t>& out) {
+    for (int y = 0; y < h; y++) {
+        if (y > 0 && memcmp(src + y * w, src + (y - 1) * w, w) == 0)
+            out.push_back(0x80);
+        else
+            PackBitsRow(src + y * w, w, out);
+    }
+}
+
+// Shortest text that reads back as the same float, always with a decimal point
+static const char* FloatLiteral(float v, char* buf, size_t size) {
+    snprintf(buf, size, "%.9g", v);
+    if (!strpbrk(buf, ".e")) strncat(buf, ".0", size - strlen(buf) - 1);
+    strncat(buf, "f", size - strlen(buf) - 1);
+    return buf;
+}
+
+static bool RecordLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x) {
+    if (!g_stbLoader->FontBakedLoadGlyph(atlas, src, baked, loader_data, codepoint, out_glyph, out_advance_x))
+        return false;
+    if (out_glyph == nullptr || codepoint < kFirstChar || codepoint > kLastChar)
+        return true;
+    Glyph& g = g_record[codepoint - kFirstChar];
+    g.glyph = *out_glyph;
+    g.loaded = true;
+    if (out_glyph->Visible) {
+        // The texture is Alpha8, so this is exactly the bitmap the loader produced
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, out_glyph->PackId);
+        ImTextureData* tex = atlas->TexData;
+        g.w = r->w;
+        g.h = r->h;
+        std::vector<uint8_t> bitmap(r->w * r->h);
+        for (int y = 0; y < r->h; y++)
+            memcpy(&bitmap[y * r->w], tex->GetPixelsAt(r->x, r->y + y), r->w);
+        g.offset = (uint32_t)g_pixels.size();
+        Compress(bitmap.data(), r->w, r->h, g_pixels);
+    }
+    return true;
+}
+
+int main() {
+    g_stbLoader = ImFontAtlasGetFontLoaderForStbTruetype();
+    ImFontLoader recorder = *g_stbLoader;
+    recorder.Name = "font_prebake";
+    recorder.FontBakedLoadGlyph = RecordLoadGlyph;
+
+    std::vector<Glyph> glyphs;
+    std::vector<float> sizePixels, bakedSizes;
+    size_t rawBytes = 0;
+    for (float scale = kScaleMin; scale <= kScaleMax + 0.001f; scale += kScaleStep) {
+        ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+        io.Fonts->TexDesiredFormat = ImTextureFormat_Alpha8;
+
+        // Must match Setup()
+        ImFontConfig cfg;
+        cfg.SizePixels = kBaseSize * scale;
+        cfg.FontLoader = &recorder;
+        for (Glyph& g : g_record) g = Glyph();
+        io.Fonts->AddFontDefault(&cfg);
+
+        // Single font at a single size: everything loaded in this context belongs to this bucket
+        ImGui::NewFrame();
+        ImFontBaked* baked = ImGui::GetFontBaked();
+        for (ImWchar c = kFirstChar; c <= kLastChar; c++) {
+            baked->FindGlyph(c);
+            const Glyph& g = g_record[c - kFirstChar];
+            if (!g.loaded) {
+                fprintf(stderr, "font_prebake: U+%04X not in font\n", c);
+                return 1;
+            }
+            rawBytes += g.w * g.h;
+        }
+        sizePixels.push_back(cfg.SizePixels);
+        bakedSizes.push_back(baked->Size);
+        glyphs.insert(glyphs.end(), g_record, g_record + IM_ARRAYSIZE(g_record));
+        ImGui::EndFrame();
+        ImGui::DestroyContext();
+    }
+
+    printf("// Generated by tools/font_prebake.cpp, do not edit.\n");
+    printf("// Default font (ProggyClean) glyphs U+%04X..U+%04X at Setup()'s font scale buckets %.2fx..%.2fx.\n", kFirstChar, kLastChar, kScaleMin, kScaleMax);
+    printf("// %zu bytes of Alpha8 bitmaps, %zu bytes compressed.\n", rawBytes, g_pixels.size());
+    printf("#pragma once\n\n#include <cstdint>\n\n");
+    printf("struct PrebakedGlyph {\n");
+    printf("    float x0, y0, x1, y1; // as returned by the stb_truetype loader\n");
+    printf("    float advanceX;\n");
+    printf("    uint16_t w, h;        // bitmap size, 0 if not visible\n");
+    printf("    uint32_t offset;      // into kPrebakedPixels, see tools/font_prebake.cpp Compress()\n");
+    printf("};\n\n");
+    printf("struct PrebakedFont {\n");
+    printf("    float sizePixels;     // ImFontConfig::SizePixels\n");
+    printf("    float bakedSize;      // ImFontBaked::Size\n");
+    printf("    const PrebakedGlyph* glyphs;\n");
+    printf("};\n\n");
+    printf("static constexpr int kPrebakedFirstChar = %d;\n", kFirstChar);
+    printf("static constexpr int kPrebakedLastChar = %d;\n\n", kLastChar);
+    printf("static const PrebakedGlyph kPrebakedGlyphs[] = {\n");
+    for (const Glyph& g : glyphs) {
+        const ImFontGlyph& f = g.glyph;
+        char x0[32], y0[32], x1[32], y1[32], adv[32];
+        printf("    { %s, %s, %s, %s, %s, %d, %d, %u },\n", FloatLiteral(f.X0, x0, 32), FloatLiteral(f.Y0, y0, 32), FloatLiteral(f.X1, x1, 32),
+            FloatLiteral(f.Y1, y1, 32), FloatLiteral(f.AdvanceX, adv, 32), g.w, g.h, g.offset);
+    }
+    printf("};\n\n");
+    const int perFont = kLastChar - kFirstChar + 1;
+    printf("static const PrebakedFont kPrebakedFonts[] = {\n");
+    for (size_t i = 0; i < sizePixels.size(); i++) {
+        char size[32], baked[32];
+        printf("    { %s, %s, kPrebakedGlyphs + %d },\n", FloatLiteral(sizePixels[i], size, 32), FloatLiteral(bakedSizes[i], baked, 32), (int)i * perFont);
+    }
+    printf("};\n\n");
+    printf("static const uint8_t kPrebakedPixels[%zu] = {", g_pixels.size());
+    for (size_t i = 0; i < g_pixels.size(); i++)
+        printf("%s%u,", (i % 32) == 0 ? "\n    " : "", g_pixels[i]);
+    printf("\n};\n");
+    return 0;
+}
@@ -0,0 +1,133 @@
+// Checks ImHashData()/ImHashStr() against a bit-by-bit CRC32 reference and benchmarks them, to compare the lookup
+// table with the hardware CRC32 instructions (src/ImGui/imgui.cpp, IMGUI_ENABLE_HW_CRC32).
+//
+// The implementation is picked at compile time, build the tool once per configuration:
+// - table: no flag on x86 (or -DIMGUI_DISABLE_ARM_CRC32 on arm64)
+// - hardware: -msse4.2 on x86, -march=armv8-a+crc on arm64
+// - legacy hashes: add -DIMGUI_USE_LEGACY_CRC32_ADLER, the reference switches to the legacy (IEEE) polynomial. The
+//   values must stay those of the pre 1.91.6 table so old .ini data keeps matching: x86 then uses the table, arm64
+//   the IEEE CRC32 instructions.
+// The check covers 200k random strings (with '#' runs, for "###" resets), hashed with an explicit size, zero-terminated
+// and as data, plus the standard "123456789" check values. The benchmark hashes typical labels and PushID(int) keys.
+//
+// Host build, from the repository root:
+//   g++ -O2 -std=c++17 [-msse4.2] [-DIMGUI_USE_LEGACY_CRC32_ADLER] -Isrc/ImGui tools/id_hash_bench.cpp src/ImGui/imgui*.cpp -o id_hash_bench
+//   ./id_hash_bench
+// ARMv8 CRC32 path on an x86 host, through the intrinsics emulation in tools/neon_emu (see arm_neon.h there):
+//   g++ -O2 -std=c++17 -Itools/neon_emu -DIMGUI_DISABLE_SSE -U__SSE2__ -D__aarch64__ -D__ARM_NEON -D__ARM_FEATURE_CRC32 -funsigned-char [-DIMGUI_USE_LEGACY_CRC32_ADLER] -Isrc/ImGui tools/id_hash_bench.cpp src/ImGui/imgui*.cpp -o id_hash_neon
+// Exits with 1 if a hash differs from the reference.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+#ifdef IMGUI_USE_LEGACY_CRC32_ADLER
+static constexpr uint32_t kPolynomial = 0xEDB88320u; // CRC32 (IEEE), reflected
+static constexpr uint32_t kCheckValue = 0xCBF43926u;
+#else
+static constexpr uint32_t kPolynomial = 0x82F63B78u; // CRC32C (Castagnoli), reflected
+static constexpr uint32_t kCheckValue = 0xE3069283u;
+#endif
+
+static uint32_t RefStep(uint32_t crc, unsigned char c) {
+    crc ^= c;
+    for (int k = 0; k < 8; k++) crc = (crc & 1) ? kPolynomial ^ (crc >> 1) : crc >> 1;
+    return crc;
+}
+
+static uint32_t RefHashData(const void* data, size_t size, uint32_t seed) {
+    uint32_t crc = ~seed;
+    for (size_t i = 0; i < size; i++) crc = RefStep(crc, ((const unsigned char*)data)[i]);
+    return ~crc;
+}
+
+// "###" restarts from the seed, like ImHashStr()
+static uint32_t RefHashStr(const char* s, size_t size, uint32_t seed) {
+    if (size == 0) size = strlen(s);
+    uint32_t crc = ~seed;
+    for (size_t i = 0; i < size; i++) {
+        if (s[i] == '#' && i + 2 < size && s[i + 1] == '#' && s[i + 2] == '#') crc = ~seed;
+        crc = RefStep(crc, (unsigned char)s[i]);
+    }
+    return ~crc;
+}
+
+static uint32_t g_rng = 1;
+static uint32_t Random() {
+    g_rng = g_rng * 1664525u + 1013904223u;
+    return g_rng >> 8;
+}
+
+static std::string RandomLabel() {
+    static const char chars[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 _+-.";
+    std::string s(Random() % 65, 'x');
+    for (char& c : s) c = (Random() % 8) == 0 ? '#' : chars[Random() % (sizeof(chars) - 1)];
+    return s;
+}
+
+static bool Check() {
+    int wrong = 0;
+    const char* check = "123456789";
+    wrong += ImHashData(check, 9, 0) != kCheckValue;
+    wrong += ImHashStr(check, 0, 0) != kCheckValue;
+    for (int n = 0; n < 200000; n++) {
+        const std::string s = RandomLabel();
+        const ImGuiID seed = (n & 1) ? Random() : 0;
+        wrong += ImHashData(s.data(), s.size(), seed) != RefHashData(s.data(), s.size(), seed);
+        wrong += ImHashStr(s.c_str(), s.size(), seed) != RefHashStr(s.c_str(), s.size(), seed);
+        wrong += ImHashStr(s.c_str(), 0, seed) != RefHashStr(s.c_str(), 0, seed);
+    }
+    printf("check: %d of 600002 hashes differ from the reference\n", wrong);
+    return wrong == 0;
+}
+
+template <typename Func>
+static double NsPerHash(int count, Func hash) {
+    ImGuiID sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < 200; rep++)
+        for (int i = 0; i < count; i++) sink += hash(i);
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / (200.0 * count);
+    if (sink == 1) printf(" "); // keep the hashes alive
+    return ns;
+}
+
+static void Bench() {
+    static const char* labels[] = { "Menu", "InfinitySpread", "SpongeRange+", "Stats HUD", "##keypad", "Close###menu_close",
+                                    "Frame time (ms)", "##hidden_label_with_a_longer_identifier", "Apply", "i" };
+    const int labelCount = IM_ARRAYSIZE(labels);
+    std::vector<std::string> longLabels;
+    for (int i = 0; i < 256; i++) {
+        std::string s = RandomLabel();
+        for (char& c : s)
+            if (c == '#') c = '_';
+        longLabels.push_back(s + s);
+    }
+    printf("labels:     %6.1f ns\n", NsPerHash(labelCount, [&](int i) { return ImHashStr(labels[i], 0, 0x1234); }));
+    printf("64-128 B:   %6.1f ns\n", NsPerHash(256, [&](int i) { return ImHashStr(longLabels[i].c_str(), longLabels[i].size(), 0x1234); }));
+    printf("PushID(int) %6.1f ns\n", NsPerHash(4096, [&](int i) { return ImHashData(&i, sizeof(i), 0x1234); }));
+}
+
+int main() {
+#if defined(IMGUI_ENABLE_ARM_CRC32)
+    const char* path = "ARMv8 CRC32 instructions";
+#elif defined(IMGUI_ENABLE_HW_CRC32)
+    const char* path = "SSE4.2 CRC32 instructions";
+#else
+    const char* path = "lookup table";
+#endif
+#ifdef IMGUI_USE_LEGACY_CRC32_ADLER
+    printf("%s, legacy CRC32 values\n", path);
+#else
+    printf("%s, CRC32C values\n", path);
+#endif
+    const bool ok = Check();
+    Bench();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,391 @@
+// Renders DrawMenu() (src/menu.cpp) on the host with the software rasterizer backend, for golden image tests and
+// as a GPU independent benchmark of the overlay's CPU work.
+//
+// Each scenario is a fresh ImGui context configured like Setup() at a phone resolution. Buttons are clicked by label,
+// found through the test engine item hooks. Once the menu has settled:
+// - the frame is written to <out>/<scenario>.png (or .ppm)
+// - with --golden, it is compared to <golden>/<scenario>.ppm, and the differing pixels go to <out>/<scenario>_diff.png
+// - --frames more frames are timed: ui = NewFrame() to Render(), raster = ImGui_ImplSoftware_RenderDrawData()
+// - the malloc calls made during the timed ui intervals are counted (ImGui uses src/overlay_alloc.h like Setup())
+// - with --trace, all of its frames are recorded to <trace>/<scenario>.trace for tools/draw_replay.cpp
+// The DrawMenu() state is static, the toggle scenario runs last so it doesn't leak into the others.
+//
+// Host build, from the repository root:
+//   g++ -O2 -std=c++17 -DIMGUI_ENABLE_TEST_ENGINE -Isrc -Isrc/ImGui -Isrc/ImGui/backends tools/menu_render.cpp src/menu.cpp
+//       src/overlay_alloc.cpp src/draw_trace.cpp src/ImGui/imgui*.cpp src/ImGui/backends/imgui_impl_software.cpp -pthread -o menu_render
+//   ./menu_render [--out dir] [--golden dir] [--update] [--tolerance n] [--frames n] [--threads n] [--ppm] [--trace dir]
+// --update writes the goldens instead of comparing. The output doesn't depend on --threads.
+// The goldens are in tools/goldens, checked by .github/workflows/host_tests.yml: after a change to how the menu looks,
+// run with --golden tools/goldens --update and commit them with it.
+// Exits with 1 if an image differs from its golden by more than --tolerance (per channel, default 2), a click misses,
+// or a steady-state ui frame calls malloc. The malloc count relies on glibc's __libc_malloc.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include "imgui_impl_software.h"
+#include "draw_trace.h"
+#include "menu.h"
+#include "overlay_alloc.h"
+
+static constexpr int kSettleFrames = 3;
+
+struct Scenario {
+    const char* name;
+    int width, height;
+    std::vector<const char*> clicks; // item labels, in order
+};
+
+// Phones in landscape: 20:9 at 720p, 1080p and 1440p
+static const Scenario kScenarios[] = {
+    { "menu_720p", 1600, 720, {} },
+    { "menu_1080p", 2400, 1080, {} },
+    { "menu_1440p", 3200, 1440, {} },
+    { "keypad_1080p", 2400, 1080, { "K" } },
+    { "info_1080p", 2400, 1080, { "i" } },
+    { "toggles_1080p", 2400, 1080, { "InfinitySpread", "SpongeRange+", "SpongeRange++", "+", "+", "Stats HUD" } },
+};
+
+// Counts the malloc family calls of the thread that sets t_countMallocs, the others go through uncounted
+extern "C" void* __libc_malloc(size_t);
+extern "C" void* __libc_calloc(size_t, size_t);
+extern "C" void* __libc_realloc(void*, size_t);
+static thread_local bool t_countMallocs = false;
+static int g_mallocs = 0;
+
+extern "C" void* malloc(size_t size) {
+    if (t_countMallocs) g_mallocs++;
+    return __libc_malloc(size);
+}
+extern "C" void* calloc(size_t n, size_t size) {
+    if (t_countMallocs) g_mallocs++;
+    return __libc_calloc(n, size);
+}
+extern "C" void* realloc(void* ptr, size_t size) {
+    if (t_countMallocs) g_mallocs++;
+    return __libc_realloc(ptr, size);
+}
+
+// src/menu.h: nothing to patch here, count the calls
+static int g_patchCalls = 0;
+bool PatchesReady() { return true; }
+void ApplyPatch(size_t, const void*, size_t) { g_patchCalls++; }
+void RestorePatch(size_t) { g_patchCalls++; }
+
+// Test engine hooks: remember where each labeled item was last drawn
+struct LabeledItem {
+    std::string label;
+    ImRect bb;
+};
+static std::vector<LabeledItem> g_items;
+static ImGuiID g_lastItemId = 0;
+static ImRect g_lastItemBB;
+
+void ImGuiTestEngineHook_ItemAdd(ImGuiContext*, ImGuiID id, const ImRect& bb, const ImGuiLastItemData*) {
+    g_lastItemId = id;
+    g_lastItemBB = bb;
+}
+void ImGuiTestEngineHook_ItemInfo(ImGuiContext*, ImGuiID id, const char* label, ImGuiItemStatusFlags) {
+    if (id != g_lastItemId || !label) return;
+    for (LabeledItem& item : g_items)
+        if (item.label == label) {
+            item.bb = g_lastItemBB;
+            return;
+        }
+    g_items.push_back({ label, g_lastItemBB });
+}
+void ImGuiTestEngineHook_Log(ImGuiContext*, const char*, ...) {}
+const char* ImGuiTestEngine_FindItemDebugLabel(ImGuiContext*, ImGuiID) { return nullptr; }
+
+static const ImRect* FindItem(const char* label) {
+    for (const LabeledItem& item : g_items)
+        if (item.label == label) return &item.bb;
+    return nullptr;
+}
+
+// Stand-in for the game's frame: a vertical gradient, so blending mistakes show
+static void ClearTarget(std::vector<ImU32>& px, int w, int h) {
+    for (int y = 0; y < h; y++) {
+        const int t = y * 255 / (h - 1);
+        std::fill(px.begin() + (size_t)y * w, px.begin() + (size_t)(y + 1) * w, IM_COL32(40 + t / 4, 90 + t / 8, 60 + t / 2, 255));
+    }
+}
+
+static uint32_t g_crcTable[256];
+
+static uint32_t Crc32(uint32_t crc, const uint8_t* p, size_t n) {
+    if (g_crcTable[1] == 0)
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            g_crcTable[i] = c;
+        }
+    crc = ~crc;
+    while (n--) crc = g_crcTable[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void PutBE32(std::vector<uint8_t>& out, uint32_t v) {
+    for (int s = 24; s >= 0; s -= 8) out.push_back((uint8_t)(v >> s));
+}
+
+static void PngChunk(FILE* f, const char* type, const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> chunk;
+    PutBE32(chunk, (uint32_t)data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    PutBE32(chunk, Crc32(0, chunk.data() + 4, chunk.size() - 4));
+    fwrite(chunk.data(), 1, chunk.size(), f);
+}
+
+// RGB, zlib stream made of stored (uncompressed) deflate blocks: no dependency, any viewer opens it
+static bool WritePng(const char* path, const ImU32* px, int w, int h) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    fwrite(signature, 1, 8, f);
+    std::vector<uint8_t> ihdr;
+    PutBE32(ihdr, (uint32_t)w);
+    PutBE32(ihdr, (uint32_t)h);
+    ihdr.insert(ihdr.end(), { 8, 2, 0, 0, 0 }); // 8 bits, RGB, deflate, no filter, no interlace
+    PngChunk(f, "IHDR", ihdr);
+
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)(w * 3 + 1) * h);
+    for (int y = 0; y < h; y++) {
+        raw.push_back(0); // filter: none
+        for (int x = 0; x < w; x++) {
+            const ImU32 c = px[(size_t)y * w + x];
+            raw.push_back((uint8_t)(c >> IM_COL32_R_SHIFT));
+            raw.push_back((uint8_t)(c >> IM_COL32_G_SHIFT));
+            raw.push_back((uint8_t)(c >> IM_COL32_B_SHIFT));
+        }
+    }
+    std::vector<uint8_t> z = { 0x78, 0x01 };
+    for (size_t pos = 0; pos < raw.size() || pos == 0; pos += 65535) {
+        const size_t n = std::min<size_t>(65535, raw.size() - pos);
+        z.push_back(pos + n == raw.size() ? 1 : 0);
+        z.insert(z.end(), { (uint8_t)n, (uint8_t)(n >> 8), (uint8_t)~n, (uint8_t)(~n >> 8) });
+        z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + n);
+    }
+    uint32_t a = 1, b = 0;
+    for (uint8_t v : raw) {
+        a = (a + v) % 65521;
+        b = (b + a) % 65521;
+    }
+    PutBE32(z, (b << 16) | a);
+    PngChunk(f, "IDAT", z);
+    PngChunk(f, "IEND", {});
+    return fclose(f) == 0;
+}
+
+static bool WritePpm(const char* path, const ImU32* px, int w, int h) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    fprintf(f, "P6\n%d %d\n255\n", w, h);
+    for (size_t i = 0; i < (size_t)w * h; i++) {
+        const uint8_t rgb[3] = { (uint8_t)(px[i] >> IM_COL32_R_SHIFT), (uint8_t)(px[i] >> IM_COL32_G_SHIFT), (uint8_t)(px[i] >> IM_COL32_B_SHIFT) };
+        fwrite(rgb, 1, 3, f);
+    }
+    return fclose(f) == 0;
+}
+
+static bool ReadPpm(const char* path, std::vector<ImU32>& px, int& w, int& h) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    int maxval = 0;
+    bool ok = fscanf(f, "P6 %d %d %d", &w, &h, &maxval) == 3 && maxval == 255 && fgetc(f) != EOF && w > 0 && h > 0;
+    if (ok) {
+        std::vector<uint8_t> rgb((size_t)w * h * 3);
+        ok = fread(rgb.data(), 1, rgb.size(), f) == rgb.size();
+        px.resize((size_t)w * h);
+        for (size_t i = 0; ok && i < px.size(); i++) px[i] = IM_COL32(rgb[i * 3], rgb[i * 3 + 1], rgb[i * 3 + 2], 255);
+    }
+    fclose(f);
+    return ok;
+}
+
+struct Options {
+    std::string out = ".";
+    std::string golden;
+    std::string trace;
+    bool update = false;
+    bool ppm = false;
+    int tolerance = 2;
+    int frames = 300;
+    int threads = 0;
+};
+
+// Returns false if the image differs from the golden (or there is none)
+static bool CompareGolden(const Options& opt, const Scenario& sc, const std::vector<ImU32>& px) {
+    const std::string goldenPath = opt.golden + "/" + sc.name + ".ppm";
+    if (opt.update) {
+        if (!WritePpm(goldenPath.c_str(), px.data(), sc.width, sc.height)) {
+            fprintf(stderr, "menu_render: can't write %s\n", goldenPath.c_str());
+            return false;
+        }
+        printf("  golden: updated %s\n", goldenPath.c_str());
+        return true;
+    }
+    std::vector<ImU32> golden;
+    int w = 0, h = 0;
+    if (!ReadPpm(goldenPath.c_str(), golden, w, h)) {
+        printf("  golden: can't read %s\n", goldenPath.c_str());
+        return false;
+    }
+    if (w != sc.width || h != sc.height) {
+        printf("  golden: %dx%d, rendered %dx%d\n", w, h, sc.width, sc.height);
+        return false;
+    }
+    // Diff image: golden dimmed, differing pixels in red
+    std::vector<ImU32> diff(golden.size());
+    int differing = 0, overTolerance = 0, maxDelta = 0;
+    for (size_t i = 0; i < px.size(); i++) {
+        int delta = 0;
+        for (int s = 0; s < 24; s += 8) delta = std::max(delta, std::abs((int)((px[i] >> s) & 0xFF) - (int)((golden[i] >> s) & 0xFF)));
+        differing += delta != 0;
+        overTolerance += delta > opt.tolerance;
+        maxDelta = std::max(maxDelta, delta);
+        diff[i] = delta > opt.tolerance ? IM_COL32(255, 0, 0, 255) : (golden[i] >> 2) & 0x3F3F3F3F;
+    }
+    printf("  golden: %d pixels differ (max %d), %d over tolerance\n", differing, maxDelta, overTolerance);
+    if (overTolerance == 0) return true;
+    const std::string diffPath = opt.out + "/" + sc.name + "_diff.png";
+    WritePng(diffPath.c_str(), diff.data(), sc.width, sc.height);
+    return false;
+}
+
+static void Click(const ImRect& bb, bool down) {
+    ImGuiIO& io = ImGui::GetIO();
+    io.AddMousePosEvent(bb.GetCenter().x, bb.GetCenter().y);
+    io.AddMouseButtonEvent(0, down);
+}
+
+static bool RunScenario(const Options& opt, const Scenario& sc) {
+    printf("%s (%dx%d)\n", sc.name, sc.width, sc.height);
+    ImGui::SetAllocatorFunctions(OverlayAlloc, OverlayFree, nullptr);
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2((float)sc.width, (float)sc.height);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui::GetCurrentContext()->TestEngineHookItems = true;
+    g_items.clear();
+
+    // Must match Setup() (the prebaked font loader produces the same glyphs as stb_truetype)
+    io.ConfigFlags |= ImGuiConfigFlags_IsTouchScreen;
+    float scale = ImClamp((float)sc.height / 720.0f, 1.5f, 4.0f);
+    ImFontConfig cfg;
+    cfg.SizePixels = 18.0f * (roundf(scale * 4.0f) / 4.0f);
+    io.Fonts->Flags |= ImFontAtlasFlags_PackGuillotine;
+    io.Fonts->AddFontDefault(&cfg);
+    ImGuiStyle& style = ImGui::GetStyle();
+    style.ScaleAllSizes(scale * 0.65f);
+    style.Alpha = 1.0f;
+    ImGui_ImplSoftware_Init(opt.threads);
+
+    DrawTraceWriter trace;
+    const std::string tracePath = opt.trace + "/" + sc.name + ".trace";
+    if (!opt.trace.empty() && !DrawTraceOpen(trace, tracePath.c_str()))
+        fprintf(stderr, "menu_render: can't write %s\n", tracePath.c_str());
+
+    std::vector<ImU32> px((size_t)sc.width * sc.height);
+    MenuStats stats = {};
+    bool showStats = false;
+    double uiMs = 0.0, rasterMs = 0.0;
+    int triangles = 0;
+    AllocStats alloc = {};
+    auto frame = [&](bool timed) {
+        auto t0 = std::chrono::steady_clock::now();
+        t_countMallocs = timed;
+        ImGui_ImplSoftware_NewFrame();
+        ImGui::NewFrame();
+        DrawMenu(stats, &showStats);
+        ImGui::Render();
+        t_countMallocs = false;
+        auto t1 = std::chrono::steady_clock::now();
+        alloc = OverlayAllocNextFrame();
+        DrawTraceWrite(trace, ImGui::GetDrawData());
+        ClearTarget(px, sc.width, sc.height);
+        auto t2 = std::chrono::steady_clock::now();
+        ImGui_ImplSoftware_RenderDrawData(ImGui::GetDrawData(), px.data(), sc.width, sc.height, sc.width);
+        auto t3 = std::chrono::steady_clock::now();
+        if (timed) {
+            uiMs += std::chrono::duration<double, std::milli>(t1 - t0).count();
+            rasterMs += std::chrono::duration<double, std::milli>(t3 - t2).count();
+        }
+        triangles = ImGui::GetDrawData()->TotalIdxCount / 3;
+    };
+
+    bool ok = true;
+    for (int i = 0; i < kSettleFrames; i++) frame(false);
+    for (const char* label : sc.clicks) {
+        const ImRect* bb = FindItem(label);
+        if (!bb) {
+            printf("  click: no item labeled \"%s\"\n", label);
+            ok = false;
+            continue;
+        }
+        Click(*bb, true);
+        frame(false);
+        Click(*bb, false);
+        for (int i = 0; i < kSettleFrames; i++) frame(false);
+    }
+
+    const std::string path = opt.out + "/" + sc.name + (opt.ppm ? ".ppm" : ".png");
+    if (!(opt.ppm ? WritePpm : WritePng)(path.c_str(), px.data(), sc.width, sc.height)) {
+        fprintf(stderr, "menu_render: can't write %s\n", path.c_str());
+        ok = false;
+    }
+    if (!opt.golden.empty()) ok &= CompareGolden(opt, sc, px);
+
+    g_mallocs = 0;
+    for (int i = 0; i < opt.frames; i++) frame(true);
+    if (opt.frames > 0) {
+        printf("  %d triangles  ui %.3f ms  raster %.3f ms  (per frame, %d frames)\n", triangles, uiMs / opt.frames, rasterMs / opt.frames, opt.frames);
+        printf("  ui: %u allocator calls per frame, %d mallocs in %d frames\n", alloc.calls, g_mallocs, opt.frames);
+        ok &= g_mallocs == 0;
+    }
+
+    if (trace.file) printf("  trace: %d frames, %zu bytes\n", trace.frames, trace.bytes);
+    DrawTraceClose(trace);
+
+    ImGui_ImplSoftware_Shutdown();
+    ImGui::DestroyContext();
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    for (int i = 1; i < argc; i++) {
+        const bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--out") && hasValue) opt.out = argv[++i];
+        else if (!strcmp(argv[i], "--golden") && hasValue) opt.golden = argv[++i];
+        else if (!strcmp(argv[i], "--trace") && hasValue) opt.trace = argv[++i];
+        else if (!strcmp(argv[i], "--update")) opt.update = true;
+        else if (!strcmp(argv[i], "--ppm")) opt.ppm = true;
+        else if (!strcmp(argv[i], "--tolerance") && hasValue) opt.tolerance = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--frames") && hasValue) opt.frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--threads") && hasValue) opt.threads = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "menu_render: unknown argument %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (opt.update && opt.golden.empty()) {
+        fprintf(stderr, "menu_render: --update needs --golden\n");
+        return 1;
+    }
+    bool ok = true;
+    for (const Scenario& sc : kScenarios) ok &= RunScenario(opt, sc);
+    printf("%d patch calls\n", g_patchCalls);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,13 @@
+// Host stand-in for <arm_acle.h>: the CRC32 intrinsics used by imgui.cpp, emulated bit by bit (reflected polynomials,
+// no pre/post inversion, like the CRC32B/CRC32X and CRC32CB/CRC32CX instructions). See arm_neon.h next to it.
+#pragma once
+#include <stdint.h>
+static inline uint32_t ne_crc(uint32_t crc, uint64_t v, int bytes, uint32_t poly)
+{
+    for (int i = 0; i < bytes; i++) { crc ^= (uint32_t)(v >> (i * 8)) & 0xFF; for (int b = 0; b < 8; b++) crc = (crc >> 1) ^ (poly & (0u - (crc & 1))); }
+    return crc;
+}
+static inline uint32_t __crc32b(uint32_t c, uint8_t v)  { return ne_crc(c, v, 1, 0xEDB88320u); }
+static inline uint32_t __crc32d(uint32_t c, uint64_t v) { return ne_crc(c, v, 8, 0xEDB88320u); }
+static inline uint32_t __crc32cb(uint32_t c, uint8_t v) { return ne_crc(c, v, 1, 0x82F63B78u); }
+static inline uint32_t __crc32cd(uint32_t c, uint64_t v) { return ne_crc(c, v, 8, 0x82F63B78u); }
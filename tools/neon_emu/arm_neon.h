@@ -0,0 +1,94 @@
+// Host stand-in for <arm_neon.h>: the AArch64 NEON intrinsics used in this tree, emulated lane by lane with the semantics
+// of the Arm C Language Extensions (FMAXNM/FMINNM NaN rules, FCVTZS saturation, SQXTUN/UQXTN narrowing...).
+// It lets the SIMD vs scalar checks in tools/ run the NEON code paths on an x86 host. It checks the logic of those paths
+// (lane order, masks, shuffles, tails), not code generation: that still needs an arm64 build.
+// Build the tools with, from the repository root:
+//   g++ -O2 -std=c++17 -Itools/neon_emu -DIMGUI_DISABLE_SSE -U__SSE2__ -D__aarch64__ -D__ARM_NEON -D__ARM_FEATURE_CRC32 -funsigned-char ...
+// (-funsigned-char: char is unsigned on AArch64). Add intrinsics here as the NEON paths start using them.
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+typedef float    float32x4_t __attribute__((vector_size(16)));
+typedef float    float32x2_t __attribute__((vector_size(8)));
+typedef uint32_t uint32x4_t  __attribute__((vector_size(16)));
+typedef uint32_t uint32x2_t  __attribute__((vector_size(8)));
+typedef int32_t  int32x4_t   __attribute__((vector_size(16)));
+typedef uint16_t uint16x8_t  __attribute__((vector_size(16)));
+typedef uint16_t uint16x4_t  __attribute__((vector_size(8)));
+typedef uint8_t  uint8x16_t  __attribute__((vector_size(16)));
+typedef uint8_t  uint8x8_t   __attribute__((vector_size(8)));
+typedef int8_t   int8x16_t   __attribute__((vector_size(16)));
+typedef uint64_t uint64x1_t  __attribute__((vector_size(8)));
+struct float32x4x2_t { float32x4_t val[2]; };
+#define NE static inline
+template<class D, class S> NE D ne_bits(S s) { static_assert(sizeof(D) == sizeof(S), ""); D d; memcpy(&d, &s, sizeof(d)); return d; }
+NE uint32_t ne_mask(bool b) { return b ? 0xFFFFFFFFu : 0u; }
+// FMAXNM/FMINNM: a quiet NaN loses against a number; -0 < +0
+NE float ne_maxnm(float a, float b) { if (isnan(a)) return isnan(b) ? a : b; if (isnan(b)) return a; if (a == b) return signbit(a) ? b : a; return a > b ? a : b; }
+NE float ne_minnm(float a, float b) { if (isnan(a)) return isnan(b) ? a : b; if (isnan(b)) return a; if (a == b) return signbit(a) ? a : b; return a < b ? a : b; }
+// FMAX/FMIN: NaN propagates
+NE float ne_max(float a, float b) { if (isnan(a) || isnan(b)) return NAN; if (a == b) return signbit(a) ? b : a; return a > b ? a : b; }
+NE float ne_min(float a, float b) { if (isnan(a) || isnan(b)) return NAN; if (a == b) return signbit(a) ? a : b; return a < b ? a : b; }
+
+NE float32x4_t vabsq_f32(float32x4_t a) { for (int i = 0; i < 4; i++) a[i] = fabsf(a[i]); return a; }
+NE uint32x2_t vadd_u32(uint32x2_t a, uint32x2_t b) { return a + b; }
+NE float32x4_t vaddq_f32(float32x4_t a, float32x4_t b) { return a + b; }
+NE uint16x8_t vaddq_u16(uint16x8_t a, uint16x8_t b) { return a + b; }
+NE float32x4_t vsubq_f32(float32x4_t a, float32x4_t b) { return a - b; }
+NE float32x4_t vmulq_f32(float32x4_t a, float32x4_t b) { return a * b; }
+NE float32x4_t vmulq_n_f32(float32x4_t a, float b) { return a * b; }
+NE float32x4_t vdivq_f32(float32x4_t a, float32x4_t b) { return a / b; }
+NE float32x4_t vnegq_f32(float32x4_t a) { return -a; }
+NE float32x4_t vsqrtq_f32(float32x4_t a) { for (int i = 0; i < 4; i++) a[i] = sqrtf(a[i]); return a; }
+NE float32x4_t vfmaq_f32(float32x4_t a, float32x4_t b, float32x4_t c) { for (int i = 0; i < 4; i++) a[i] = fmaf(b[i], c[i], a[i]); return a; }
+NE uint32x4_t vandq_u32(uint32x4_t a, uint32x4_t b) { return a & b; }
+NE uint32x4_t vmvnq_u32(uint32x4_t a) { return ~a; }
+NE float32x4_t vbslq_f32(uint32x4_t m, float32x4_t a, float32x4_t b) { return ne_bits<float32x4_t>((m & ne_bits<uint32x4_t>(a)) | (~m & ne_bits<uint32x4_t>(b))); }
+NE uint32x4_t vceqq_f32(float32x4_t a, float32x4_t b) { uint32x4_t r; for (int i = 0; i < 4; i++) r[i] = ne_mask(a[i] == b[i]); return r; }
+NE uint32x4_t vcgeq_f32(float32x4_t a, float32x4_t b) { uint32x4_t r; for (int i = 0; i < 4; i++) r[i] = ne_mask(a[i] >= b[i]); return r; }
+NE uint32x4_t vcgtq_f32(float32x4_t a, float32x4_t b) { uint32x4_t r; for (int i = 0; i < 4; i++) r[i] = ne_mask(a[i] > b[i]); return r; }
+NE uint32x4_t vcleq_f32(float32x4_t a, float32x4_t b) { uint32x4_t r; for (int i = 0; i < 4; i++) r[i] = ne_mask(a[i] <= b[i]); return r; }
+NE uint8x16_t vcgtq_s8(int8x16_t a, int8x16_t b) { uint8x16_t r; for (int i = 0; i < 16; i++) r[i] = a[i] > b[i] ? 0xFF : 0; return r; }
+NE float32x4_t vcombine_f32(float32x2_t lo, float32x2_t hi) { float32x4_t r = { lo[0], lo[1], hi[0], hi[1] }; return r; }
+NE uint16x8_t vcombine_u16(uint16x4_t lo, uint16x4_t hi) { uint16x8_t r; for (int i = 0; i < 4; i++) { r[i] = lo[i]; r[i + 4] = hi[i]; } return r; }
+// FCVTZS: round toward zero, saturate, NaN -> 0
+NE int32x4_t vcvtq_s32_f32(float32x4_t a) { int32x4_t r; for (int i = 0; i < 4; i++) r[i] = isnan(a[i]) ? 0 : a[i] >= 2147483648.0f ? INT32_MAX : a[i] < -2147483648.0f ? INT32_MIN : (int32_t)a[i]; return r; }
+NE float32x2_t vdup_n_f32(float v) { float32x2_t r = { v, v }; return r; }
+NE float32x4_t vdupq_n_f32(float v) { float32x4_t r = { v, v, v, v }; return r; }
+NE int8x16_t vdupq_n_s8(int8_t v) { int8x16_t r; for (int i = 0; i < 16; i++) r[i] = v; return r; }
+NE uint16x8_t vdupq_n_u16(uint16_t v) { uint16x8_t r; for (int i = 0; i < 8; i++) r[i] = v; return r; }
+NE float32x2_t vext_f32(float32x2_t a, float32x2_t b, int n) { float t[4] = { a[0], a[1], b[0], b[1] }; float32x2_t r = { t[n], t[n + 1] }; return r; }
+NE float32x4_t vextq_f32(float32x4_t a, float32x4_t b, int n) { float t[8]; memcpy(t, &a, 16); memcpy(t + 4, &b, 16); float32x4_t r; for (int i = 0; i < 4; i++) r[i] = t[i + n]; return r; }
+NE float32x2_t vget_low_f32(float32x4_t a) { float32x2_t r = { a[0], a[1] }; return r; }
+NE float32x2_t vget_high_f32(float32x4_t a) { float32x2_t r = { a[2], a[3] }; return r; }
+NE uint32x2_t vget_low_u32(uint32x4_t a) { uint32x2_t r = { a[0], a[1] }; return r; }
+NE uint32x2_t vget_high_u32(uint32x4_t a) { uint32x2_t r = { a[2], a[3] }; return r; }
+NE uint32_t vget_lane_u32(uint32x2_t a, int n) { return a[n]; }
+NE uint64_t vget_lane_u64(uint64x1_t a, int n) { return a[n]; }
+NE float vgetq_lane_f32(float32x4_t a, int n) { return a[n]; }
+NE float32x2_t vset_lane_f32(float v, float32x2_t a, int n) { a[n] = v; return a; }
+NE float32x4_t vld1q_f32(const float* p) { float32x4_t r; memcpy(&r, p, 16); return r; }
+NE int8x16_t vld1q_s8(const int8_t* p) { int8x16_t r; memcpy(&r, p, 16); return r; }
+NE uint16x8_t vld1q_u16(const uint16_t* p) { uint16x8_t r; memcpy(&r, p, 16); return r; }
+NE void vst1q_f32(float* p, float32x4_t a) { memcpy(p, &a, 16); }
+NE void vst1q_u16(uint16_t* p, uint16x8_t a) { memcpy(p, &a, 16); }
+NE float32x4x2_t vld2q_f32(const float* p) { float32x4x2_t r; for (int i = 0; i < 4; i++) { r.val[0][i] = p[i * 2]; r.val[1][i] = p[i * 2 + 1]; } return r; }
+NE void vst2q_f32(float* p, float32x4x2_t a) { for (int i = 0; i < 4; i++) { p[i * 2] = a.val[0][i]; p[i * 2 + 1] = a.val[1][i]; } }
+NE float32x4_t vmaxnmq_f32(float32x4_t a, float32x4_t b) { for (int i = 0; i < 4; i++) a[i] = ne_maxnm(a[i], b[i]); return a; }
+NE float32x4_t vminnmq_f32(float32x4_t a, float32x4_t b) { for (int i = 0; i < 4; i++) a[i] = ne_minnm(a[i], b[i]); return a; }
+NE float32x4_t vminq_f32(float32x4_t a, float32x4_t b) { for (int i = 0; i < 4; i++) a[i] = ne_min(a[i], b[i]); return a; }
+NE float vmaxvq_f32(float32x4_t a) { return ne_max(ne_max(a[0], a[1]), ne_max(a[2], a[3])); }
+NE float vminvq_f32(float32x4_t a) { return ne_min(ne_min(a[0], a[1]), ne_min(a[2], a[3])); }
+NE uint32_t vmaxvq_u32(uint32x4_t a) { uint32_t m = a[0]; for (int i = 1; i < 4; i++) m = a[i] > m ? a[i] : m; return m; }
+NE uint8_t vminvq_u8(uint8x16_t a) { uint8_t m = a[0]; for (int i = 1; i < 16; i++) m = a[i] < m ? a[i] : m; return m; }
+NE uint32x2_t vpadd_u32(uint32x2_t a, uint32x2_t b) { uint32x2_t r = { a[0] + a[1], b[0] + b[1] }; return r; }
+NE uint8x8_t vqmovn_u16(uint16x8_t a) { uint8x8_t r; for (int i = 0; i < 8; i++) r[i] = a[i] > 255 ? 255 : (uint8_t)a[i]; return r; }
+NE uint16x4_t vqmovun_s32(int32x4_t a) { uint16x4_t r; for (int i = 0; i < 4; i++) r[i] = a[i] < 0 ? 0 : a[i] > 65535 ? 65535 : (uint16_t)a[i]; return r; }
+NE uint8x8_t vshrn_n_u16(uint16x8_t a, int n) { uint8x8_t r; for (int i = 0; i < 8; i++) r[i] = (uint8_t)(a[i] >> n); return r; }
+NE uint32x4_t vshrq_n_u32(uint32x4_t a, int n) { return a >> n; }
+NE uint32x2_t vreinterpret_u32_u8(uint8x8_t a) { return ne_bits<uint32x2_t>(a); }
+NE uint64x1_t vreinterpret_u64_u8(uint8x8_t a) { return ne_bits<uint64x1_t>(a); }
+NE uint16x8_t vreinterpretq_u16_u8(uint8x16_t a) { return ne_bits<uint16x8_t>(a); }
+NE float32x2_t vrev64_f32(float32x2_t a) { float32x2_t r = { a[1], a[0] }; return r; }
+#undef NE
@@ -0,0 +1,134 @@
+// Checks the min/max decimation of ImGui::PlotLines() (PlotScanMinMax() in imgui_widgets.cpp): a contiguous float array,
+// which is scanned 4 values at a time with SSE or NEON, must draw exactly what the same values draw through a getter
+// callback, which takes the scalar loop. Also benchmarks PlotLines() on a long series.
+//
+// Each case plots a random series (with NaN, infinities and signed zeros), at a random width, values_offset and
+// scale (auto or fixed), once from the array and once from the getter, in two frames with the same layout. The
+// vertex and index buffers of both frames must be identical. Lengths go from a handful of values to 20x the plot
+// width, so both the decimated and the per-sample paths are covered.
+//
+// Host build, from the repository root (-DIMGUI_DISABLE_SSE checks the scalar loop against itself):
+//   g++ -O2 -std=c++17 -Isrc/ImGui tools/plot_lines_check.cpp src/ImGui/imgui*.cpp -o plot_lines_check
+//   ./plot_lines_check
+// NEON path on an x86 host, through the intrinsics emulation in tools/neon_emu (see arm_neon.h there):
+//   g++ -O2 -std=c++17 -Itools/neon_emu -DIMGUI_DISABLE_SSE -U__SSE2__ -D__aarch64__ -D__ARM_NEON -funsigned-char -Isrc/ImGui tools/plot_lines_check.cpp src/ImGui/imgui*.cpp -o plot_lines_neon
+// Exits with 1 if the two draws of a case differ.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+static constexpr int kCases = 2000;
+
+static uint32_t g_rng = 3;
+static uint32_t Random() {
+    g_rng = g_rng * 1664525u + 1013904223u;
+    return g_rng >> 8;
+}
+
+static float RandomValue() {
+    switch (Random() % 40) {
+    case 0: return NAN;
+    case 1: return INFINITY;
+    case 2: return -INFINITY;
+    case 3: return -0.0f;
+    case 4: return 0.0f;
+    default: return ((int)(Random() % 200001) - 100000) / 1000.0f;
+    }
+}
+
+static float Getter(void* data, int idx) {
+    return ((const float*)data)[idx];
+}
+
+struct Case {
+    std::vector<float> values;
+    int offset;
+    float width;
+    float scaleMin, scaleMax;
+};
+
+// Vertices and indices of one frame with a single PlotLines() window
+static std::vector<uint8_t> Draw(const Case& c, bool useGetter) {
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1280, 720));
+    ImGui::Begin("plot", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings);
+    const int count = (int)c.values.size();
+    if (useGetter) ImGui::PlotLines("##plot", Getter, (void*)c.values.data(), count, c.offset, nullptr, c.scaleMin, c.scaleMax, ImVec2(c.width, 100));
+    else ImGui::PlotLines("##plot", c.values.data(), count, c.offset, nullptr, c.scaleMin, c.scaleMax, ImVec2(c.width, 100));
+    ImGui::End();
+    ImGui::Render();
+
+    std::vector<uint8_t> out;
+    for (const ImDrawList* dl : ImGui::GetDrawData()->CmdLists) {
+        out.insert(out.end(), (const uint8_t*)dl->VtxBuffer.Data, (const uint8_t*)(dl->VtxBuffer.Data + dl->VtxBuffer.Size));
+        out.insert(out.end(), (const uint8_t*)dl->IdxBuffer.Data, (const uint8_t*)(dl->IdxBuffer.Data + dl->IdxBuffer.Size));
+    }
+    return out;
+}
+
+int main() {
+#if defined(IMGUI_ENABLE_SSE)
+    printf("PlotScanMinMax: SSE\n");
+#elif defined(IMGUI_ENABLE_NEON)
+    printf("PlotScanMinMax: NEON\n");
+#else
+    printf("PlotScanMinMax: scalar\n");
+#endif
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(1280, 720);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasVtxOffset;
+    io.Fonts->AddFontDefault();
+
+    int differ = 0, decimated = 0;
+    for (int n = 0; n < kCases; n++) {
+        Case c;
+        c.width = (float)(20 + Random() % 600);
+        const int count = 2 + (int)(Random() % (uint32_t)(c.width * 20));
+        c.values.resize((size_t)count);
+        for (float& v : c.values) v = RandomValue();
+        if (Random() % 50 == 0) std::fill(c.values.begin(), c.values.end(), NAN);
+        c.offset = (int)(Random() % (uint32_t)count);
+        c.scaleMin = c.scaleMax = FLT_MAX;
+        if (Random() % 2) {
+            c.scaleMin = -(float)(Random() % 100);
+            c.scaleMax = (float)(Random() % 100) + 1.0f;
+        }
+        decimated += count > (int)c.width * 2;
+        if (Draw(c, false) != Draw(c, true)) {
+            if (differ < 5) printf("case %d: %d values, offset %d, width %g: array and getter draws differ\n", n, count, c.offset, c.width);
+            differ++;
+        }
+    }
+    printf("check: %d of %d cases differ (%d decimated)\n", differ, kCases, decimated);
+
+    Case bench;
+    bench.width = 600;
+    bench.offset = 12345;
+    bench.scaleMin = bench.scaleMax = FLT_MAX;
+    for (int i = 0; i < 100000; i++) bench.values.push_back(sinf(i * 0.01f) + (i % 997 == 0 ? 3.0f : 0.0f));
+    for (int useGetter = 0; useGetter < 2; useGetter++) {
+        double best = 1e9;
+        for (int k = 0; k < 20; k++) {
+            auto t0 = std::chrono::steady_clock::now();
+            Draw(bench, useGetter != 0);
+            best = std::min(best, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count());
+        }
+        printf("PlotLines, 100k values, %s: best %.1f us per frame\n", useGetter ? "getter" : "array ", best);
+    }
+
+    ImGui::DestroyContext();
+    return differ == 0 ? 0 : 1;
+}
@@ -0,0 +1,171 @@
+// Benchmarks ImDrawList::AddPolyline() and AddConvexPolyFilled() at 1k, 10k and 100k points, and checks that the
+// SIMD normal kernels (ImDrawListComputeEdgeNormals/MiterNormals in imgui_draw.cpp) match the scalar code.
+//
+// The path is picked at compile time: build the tool once with -DIMGUI_DISABLE_SSE (scalar) and once without (SSE2,
+// or NEON on arm64), write the buffers with the first and compare them with the second. Builds differ in ImRsqrt()
+// too (rsqrtss/rsqrtps approximate to 12 bits, the scalar build uses 1/sqrtf), and IM_FIXNORMAL2F scales the miter
+// normals of sharp joins up to 100x, so positions and UVs are compared within a tolerance, indices and colors exactly.
+// The default tolerance is the bound documented above ImDrawListComputeEdgeNormals(): 100 * 1.5*2^-12 * w pixels,
+// w = thickness/2 + 1, the furthest a vertex is offset along a normal. It is 0.055 px for 1 px lines, 0.082 px for
+// 3.5 px. --tolerance t overrides it (in pixels and in texels). NEON and scalar builds both use 1/sqrtf: they match with
+// --tolerance 0 through the host emulation below, an arm64 compiler fusing multiply-adds may still change the last bits.
+// Shapes: a wavy open line with a degenerate segment, a closed one, and a convex fill of a circle, with each of the
+// anti-aliasing paths (textured lines, AA lines, thick AA lines, non-AA, AA fill).
+//
+// Host build, from the repository root:
+//   g++ -O2 -std=c++17 -DIMGUI_DISABLE_SSE -Isrc/ImGui tools/polyline_bench.cpp src/ImGui/imgui*.cpp -o polyline_scalar
+//   g++ -O2 -std=c++17 -Isrc/ImGui tools/polyline_bench.cpp src/ImGui/imgui*.cpp -o polyline_simd
+//   ./polyline_scalar --write poly.bin && ./polyline_simd --compare poly.bin [--tolerance t]
+// NEON path on an x86 host, through the intrinsics emulation in tools/neon_emu (see arm_neon.h there), compared the same way:
+//   g++ -O2 -std=c++17 -Itools/neon_emu -DIMGUI_DISABLE_SSE -U__SSE2__ -D__aarch64__ -D__ARM_NEON -funsigned-char -Isrc/ImGui tools/polyline_bench.cpp src/ImGui/imgui*.cpp -o polyline_neon
+// Exits with 1 if a buffer differs beyond the tolerance, or the file can't be read or written.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+struct Mode {
+    const char* name;
+    ImDrawListFlags flags;
+    float thickness;
+    bool closed;
+    bool fill;
+};
+
+static const Mode kModes[] = {
+    { "AA textured 1px", ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex, 1.0f, false, false },
+    { "AA 1px", ImDrawListFlags_AntiAliasedLines, 1.0f, false, false },
+    { "AA 3.5px closed", ImDrawListFlags_AntiAliasedLines, 3.5f, true, false },
+    { "no AA 2px", 0, 2.0f, false, false },
+    { "AA convex fill", ImDrawListFlags_AntiAliasedFill, 0.0f, true, true },
+};
+static const int kSizes[] = { 1000, 10000, 100000 };
+
+static std::vector<ImVec2> MakePoints(const Mode& mode, int count) {
+    std::vector<ImVec2> points((size_t)count);
+    for (int i = 0; i < count; i++) {
+        if (mode.fill) {
+            const float a = i * 6.2831853f / count;
+            points[(size_t)i] = ImVec2(500 + 400 * cosf(a), 500 + 400 * sinf(a));
+        } else {
+            points[(size_t)i] = ImVec2(i * 1900.0f / count, 500 + 200 * sinf(i * 0.05f) + (i % 7 == 0 ? 30.0f : 0.0f));
+        }
+    }
+    if (!mode.fill) points[10] = points[11]; // degenerate segment
+    return points;
+}
+
+static void Draw(ImDrawList& dl, const Mode& mode, const std::vector<ImVec2>& points) {
+    dl._ResetForNewFrame();
+    dl.Flags = mode.flags;
+    dl.PushTexture(ImGui::GetIO().Fonts->TexRef);
+    dl.PushClipRectFullScreen();
+    if (mode.fill) dl.AddConvexPolyFilled(points.data(), (int)points.size(), IM_COL32(255, 255, 0, 200));
+    else dl.AddPolyline(points.data(), (int)points.size(), IM_COL32(255, 255, 0, 200), mode.closed ? ImDrawFlags_Closed : 0, mode.thickness);
+}
+
+// Returns false if counts, indices or colors differ, or a position/UV is further than 'tolerance'
+static bool Compare(const ImDrawList& dl, FILE* f, float tolerance, float& maxDelta) {
+    const ImTextureData* tex = ImGui::GetIO().Fonts->TexData;
+    int counts[2] = {};
+    if (fread(counts, sizeof(counts), 1, f) != 1 || counts[0] != dl.VtxBuffer.Size || counts[1] != dl.IdxBuffer.Size) return false;
+    std::vector<ImDrawVert> vtx((size_t)counts[0]);
+    std::vector<ImDrawIdx> idx((size_t)counts[1]);
+    if (fread(vtx.data(), sizeof(ImDrawVert), vtx.size(), f) != vtx.size() || fread(idx.data(), sizeof(ImDrawIdx), idx.size(), f) != idx.size())
+        return false;
+    if (memcmp(idx.data(), dl.IdxBuffer.Data, idx.size() * sizeof(ImDrawIdx)) != 0) return false;
+    bool ok = true;
+    for (size_t i = 0; i < vtx.size(); i++) {
+        const ImDrawVert& a = vtx[i];
+        const ImDrawVert& b = dl.VtxBuffer[(int)i];
+        const float delta = ImMax(ImMax(ImFabs(a.pos.x - b.pos.x), ImFabs(a.pos.y - b.pos.y)), ImMax(ImFabs(a.uv.x - b.uv.x) * tex->Width, ImFabs(a.uv.y - b.uv.y) * tex->Height));
+        maxDelta = ImMax(maxDelta, delta);
+        ok &= delta <= tolerance && a.col == b.col;
+    }
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    const char* writePath = nullptr;
+    const char* comparePath = nullptr;
+    float tolerance = -1.0f;
+    for (int i = 1; i < argc; i++) {
+        const bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--write") && hasValue) writePath = argv[++i];
+        else if (!strcmp(argv[i], "--compare") && hasValue) comparePath = argv[++i];
+        else if (!strcmp(argv[i], "--tolerance") && hasValue) tolerance = (float)atof(argv[++i]);
+        else {
+            fprintf(stderr, "usage: polyline_bench [--write file | --compare file] [--tolerance t]\n");
+            return 1;
+        }
+    }
+#if defined(IMGUI_ENABLE_SSE)
+    printf("normals: SSE2\n");
+#elif defined(IMGUI_ENABLE_NEON)
+    printf("normals: NEON\n");
+#else
+    printf("normals: scalar\n");
+#endif
+    FILE* out = writePath ? fopen(writePath, "wb") : nullptr;
+    FILE* ref = comparePath ? fopen(comparePath, "rb") : nullptr;
+    if ((writePath && !out) || (comparePath && !ref)) {
+        fprintf(stderr, "polyline_bench: can't open %s\n", out ? comparePath : writePath);
+        return 1;
+    }
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasVtxOffset;
+    io.Fonts->AddFontDefault();
+    ImGui::NewFrame();
+    ImDrawList* dl = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+
+    bool ok = true;
+    for (const Mode& mode : kModes) {
+        printf("%s\n", mode.name);
+        for (int count : kSizes) {
+            const std::vector<ImVec2> points = MakePoints(mode, count);
+            double best = 1e9;
+            const int reps = 2000000 / count;
+            for (int k = 0; k < 8; k++) {
+                auto t0 = std::chrono::steady_clock::now();
+                for (int r = 0; r < reps; r++) Draw(*dl, mode, points);
+                best = std::min(best, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / reps);
+            }
+            printf("  %6d points  %9.1f us  (%.2f ns/point)", count, best, best * 1000.0 / count);
+            if (out) {
+                const int counts[2] = { dl->VtxBuffer.Size, dl->IdxBuffer.Size };
+                fwrite(counts, sizeof(counts), 1, out);
+                fwrite(dl->VtxBuffer.Data, sizeof(ImDrawVert), (size_t)counts[0], out);
+                fwrite(dl->IdxBuffer.Data, sizeof(ImDrawIdx), (size_t)counts[1], out);
+            }
+            if (ref) {
+                float maxDelta = 0.0f;
+                const float bound = 100.0f * 1.5f / 4096.0f * (mode.thickness * 0.5f + 1.0f);
+                const bool same = Compare(*dl, ref, tolerance >= 0.0f ? tolerance : bound, maxDelta);
+                printf("  max delta %g%s", maxDelta, same ? "" : "  DIFFERS");
+                ok &= same;
+            }
+            printf("\n");
+        }
+    }
+    if (out && fclose(out) != 0) {
+        fprintf(stderr, "polyline_bench: can't write %s\n", writePath);
+        ok = false;
+    }
+    if (ref) fclose(ref);
+
+    IM_DELETE(dl);
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return ok ? 0 : 1;
+}
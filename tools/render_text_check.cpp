@@ -0,0 +1,156 @@
+// Checks that the SIMD glyph emission of ImFont::RenderText() (IMGUI_ENABLE_SIMD_TEXT_VERTICES in imgui_draw.cpp)
+// produces the same vertex, index and command buffers as the scalar code, and benchmarks RenderText().
+//
+// The path is picked at compile time: build the tool once with -DIMGUI_DISABLE_SSE (scalar) and once without (SSE2,
+// or NEON on arm64), write the buffers with the first and compare them with the second. Each case renders a random
+// string (ASCII, Latin-1, CJK, newlines, spaces) at a random size and position, with random clip rectangles, wrap
+// widths and ImDrawTextFlags_CpuFineClip, into a fresh draw list.
+//
+// Host build, from the repository root (add -DImDrawIdx="unsigned int" to both builds for 32-bit indices):
+//   g++ -O2 -std=c++17 -DIMGUI_DISABLE_SSE -Isrc/ImGui tools/render_text_check.cpp src/ImGui/imgui*.cpp -o render_text_scalar
+//   g++ -O2 -std=c++17 -Isrc/ImGui tools/render_text_check.cpp src/ImGui/imgui*.cpp -o render_text_simd
+//   ./render_text_scalar --write text.bin && ./render_text_simd --compare text.bin
+// NEON path on an x86 host, through the intrinsics emulation in tools/neon_emu (see arm_neon.h there), compared the same way:
+//   g++ -O2 -std=c++17 -Itools/neon_emu -DIMGUI_DISABLE_SSE -U__SSE2__ -D__aarch64__ -D__ARM_NEON -funsigned-char -Isrc/ImGui tools/render_text_check.cpp src/ImGui/imgui*.cpp -o render_text_neon
+// Exits with 1 if a buffer differs, or the file can't be read or written.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+static constexpr int kCases = 3000;
+
+static uint32_t g_rng = 7;
+static uint32_t Random() {
+    g_rng = g_rng * 1664525u + 1013904223u;
+    return g_rng >> 8;
+}
+
+static std::string RandomText() {
+    static const char* multiByte[] = { "\xC3\xA9", "\xC3\x9F", "\xD0\x96", "\xE4\xB8\xAD", "\xE6\x96\x87" }; // é ß Ж 中 文
+    std::string s;
+    for (int n = (int)(Random() % 300); n > 0; n--) {
+        const uint32_t r = Random() % 30;
+        if (r == 0) s += '\n';
+        else if (r == 1) s += ' ';
+        else if (r == 2) s += multiByte[Random() % IM_ARRAYSIZE(multiByte)];
+        else s += (char)(33 + Random() % 94);
+    }
+    return s;
+}
+
+// Buffers of one case, as written to the file
+static void Serialize(const ImDrawList& dl, std::vector<uint8_t>& out) {
+    auto put = [&](const void* p, size_t n) { out.insert(out.end(), (const uint8_t*)p, (const uint8_t*)p + n); };
+    const int counts[3] = { dl.VtxBuffer.Size, dl.IdxBuffer.Size, dl.CmdBuffer.Size };
+    put(counts, sizeof(counts));
+    put(dl.VtxBuffer.Data, sizeof(ImDrawVert) * dl.VtxBuffer.Size);
+    put(dl.IdxBuffer.Data, sizeof(ImDrawIdx) * dl.IdxBuffer.Size);
+    for (const ImDrawCmd& cmd : dl.CmdBuffer) {
+        put(&cmd.ClipRect, sizeof(cmd.ClipRect));
+        put(&cmd.IdxOffset, sizeof(cmd.IdxOffset));
+        put(&cmd.ElemCount, sizeof(cmd.ElemCount));
+    }
+}
+
+static void Bench(ImDrawList& dl, ImFont* font) {
+    std::string lines;
+    for (int i = 0; i < 40; i++) lines += "[12:00:01] Hooked eglSwapBuffers, frame time 16.6 ms\n";
+    double best = 1e9;
+    int vertices = 0;
+    for (int k = 0; k < 40; k++) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < 250; r++) {
+            dl._ResetForNewFrame();
+            dl.PushTexture(ImGui::GetIO().Fonts->TexRef);
+            dl.PushClipRectFullScreen();
+            font->RenderText(&dl, 13.0f, ImVec2(0, 0), IM_COL32_WHITE, ImVec4(0, 0, 1920, 1080), lines.c_str(), lines.c_str() + lines.size(), 0.0f, 0);
+        }
+        best = std::min(best, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / 250);
+        vertices = dl.VtxBuffer.Size;
+    }
+    printf("RenderText, 40 log lines (%d vertices): best %.2f us\n", vertices, best);
+}
+
+int main(int argc, char** argv) {
+    const char* writePath = nullptr;
+    const char* comparePath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--write") && i + 1 < argc) writePath = argv[++i];
+        else if (!strcmp(argv[i], "--compare") && i + 1 < argc) comparePath = argv[++i];
+        else {
+            fprintf(stderr, "usage: render_text_check [--write file | --compare file]\n");
+            return 1;
+        }
+    }
+#if (defined(IMGUI_ENABLE_SSE) || defined(IMGUI_ENABLE_NEON)) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) // see IMGUI_ENABLE_SIMD_TEXT_VERTICES
+    printf("glyph emission: SIMD, %zu-bit indices\n", sizeof(ImDrawIdx) * 8);
+#else
+    printf("glyph emission: scalar, %zu-bit indices\n", sizeof(ImDrawIdx) * 8);
+#endif
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+    io.Fonts->AddFontDefault();
+    ImGui::NewFrame();
+    ImFont* font = ImGui::GetFont();
+    ImDrawList* dl = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+
+    std::vector<uint8_t> data;
+    std::vector<size_t> caseEnds;
+    for (int n = 0; n < kCases; n++) {
+        const std::string text = RandomText();
+        const float size = 8.0f + Random() % 30 + (Random() % 4) * 0.25f;
+        const ImVec2 pos(Random() % 400 - 100.0f + (Random() % 7) * 0.3f, Random() % 300 - 100.0f);
+        const ImVec4 clip((float)(Random() % 200), (float)(Random() % 200), 200.0f + Random() % 600, 200.0f + Random() % 600);
+        const float wrap = (Random() % 3) == 0 ? 50.0f + Random() % 300 : 0.0f;
+        const ImDrawTextFlags flags = (Random() % 4) == 0 ? ImDrawTextFlags_CpuFineClip : 0;
+        const ImU32 col = (Random() % 2) ? IM_COL32(255, 0, 0, 128) : IM_COL32_WHITE;
+        dl->_ResetForNewFrame();
+        dl->PushTexture(io.Fonts->TexRef);
+        dl->PushClipRectFullScreen();
+        font->RenderText(dl, size, pos, col, clip, text.c_str(), text.c_str() + text.size(), wrap, flags);
+        Serialize(*dl, data);
+        caseEnds.push_back(data.size());
+    }
+
+    bool ok = true;
+    if (writePath) {
+        FILE* f = fopen(writePath, "wb");
+        ok = f && fwrite(data.data(), 1, data.size(), f) == data.size();
+        if (f) ok &= fclose(f) == 0;
+        printf("%s %s: %d cases, %zu bytes\n", ok ? "wrote" : "can't write", writePath, kCases, data.size());
+    }
+    if (comparePath) {
+        std::vector<uint8_t> ref;
+        if (FILE* f = fopen(comparePath, "rb")) {
+            uint8_t buf[65536];
+            for (size_t n; (n = fread(buf, 1, sizeof(buf), f)) > 0;) ref.insert(ref.end(), buf, buf + n);
+            fclose(f);
+        }
+        const size_t mismatch = std::mismatch(data.begin(), data.end(), ref.begin(), ref.end()).first - data.begin();
+        if (mismatch == data.size() && ref.size() == data.size()) {
+            printf("%s: all %d cases identical\n", comparePath, kCases);
+        } else {
+            const size_t failedCase = std::upper_bound(caseEnds.begin(), caseEnds.end(), mismatch) - caseEnds.begin();
+            printf("%s: first difference in case %zu (byte %zu of %zu, reference has %zu)\n", comparePath, failedCase, mismatch, data.size(), ref.size());
+            ok = false;
+        }
+    }
+    Bench(*dl, font);
+
+    IM_DELETE(dl);
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return ok ? 0 : 1;
+}
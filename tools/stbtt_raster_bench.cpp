@@ -0,0 +1,107 @@
+// Benchmarks the stb_truetype rasterizer with and without STBTT_RASTERIZER_SIMD, and checks that both
+// produce the same pixels. Rasterizes printable ASCII (U+0020..U+007E) at every pixel height from 8 to 96.
+//
+// stb_truetype declares its API extern "C", so each configuration is built in its own translation unit:
+// this file is the scalar one, stbtt_raster_bench_simd.cpp compiles it again with STBTT_RASTERIZER_SIMD.
+// Host build, from the repository root:
+//   g++ -O2 -std=c++17 tools/stbtt_raster_bench.cpp tools/stbtt_raster_bench_simd.cpp -o stbtt_raster_bench
+//   ./stbtt_raster_bench path/to/font.ttf
+// NEON path on an x86 host, through the intrinsics emulation in tools/neon_emu (see arm_neon.h there; timings meaningless):
+//   g++ -O2 -std=c++17 -Itools/neon_emu -U__SSE2__ -D__aarch64__ -D__ARM_NEON -funsigned-char tools/stbtt_raster_bench.cpp tools/stbtt_raster_bench_simd.cpp -o stbtt_raster_neon
+// Exits with 1 if any pixel differs.
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "../src/ImGui/imstb_truetype.h"
+
+struct Bitmap {
+    int w, h;
+    size_t offset;
+};
+
+static constexpr int kFirstChar = 32;
+static constexpr int kLastChar = 126;
+static constexpr int kMinSize = 8;
+static constexpr int kMaxSize = 96;
+static constexpr int kRuns = 5;
+
+#ifdef STBTT_RASTERIZER_SIMD
+#define RASTERIZE_ALL RasterizeAllSimd
+#else
+#define RASTERIZE_ALL RasterizeAllScalar
+#endif
+
+// Rasterizes the whole set, returns the best time out of kRuns, or a negative value if the font can't be read
+double RASTERIZE_ALL(const unsigned char* ttf, std::vector<Bitmap>& bitmaps, std::vector<unsigned char>& pixels) {
+    stbtt_fontinfo info;
+    if (!stbtt_InitFont(&info, ttf, stbtt_GetFontOffsetForIndex(ttf, 0))) return -1.0;
+    double best = 1e30;
+    for (int run = 0; run < kRuns; run++) {
+        bitmaps.clear();
+        pixels.clear();
+        auto start = std::chrono::steady_clock::now();
+        for (int size = kMinSize; size <= kMaxSize; size++) {
+            float scale = stbtt_ScaleForPixelHeight(&info, (float)size);
+            for (int c = kFirstChar; c <= kLastChar; c++) {
+                int x0, y0, x1, y1;
+                stbtt_GetCodepointBitmapBox(&info, c, scale, scale, &x0, &y0, &x1, &y1);
+                Bitmap b = { x1 - x0, y1 - y0, pixels.size() };
+                pixels.resize(pixels.size() + (size_t)b.w * b.h);
+                stbtt_MakeCodepointBitmap(&info, pixels.data() + b.offset, b.w, b.h, b.w, scale, scale, c);
+                bitmaps.push_back(b);
+            }
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+#ifndef STBTT_RASTERIZER_SIMD
+double RasterizeAllSimd(const unsigned char* ttf, std::vector<Bitmap>& bitmaps, std::vector<unsigned char>& pixels);
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s font.ttf\n", argv[0]);
+        return 2;
+    }
+    FILE* f = fopen(argv[1], "rb");
+    if (!f) {
+        fprintf(stderr, "stbtt_raster_bench: can't open %s\n", argv[1]);
+        return 2;
+    }
+    std::vector<unsigned char> ttf;
+    unsigned char chunk[65536];
+    for (size_t n; (n = fread(chunk, 1, sizeof(chunk), f)) > 0;) ttf.insert(ttf.end(), chunk, chunk + n);
+    fclose(f);
+
+    std::vector<Bitmap> scalarBitmaps, simdBitmaps;
+    std::vector<unsigned char> scalarPixels, simdPixels;
+    double scalarMs = RasterizeAllScalar(ttf.data(), scalarBitmaps, scalarPixels);
+    double simdMs = RasterizeAllSimd(ttf.data(), simdBitmaps, simdPixels);
+    if (scalarMs < 0.0 || simdMs < 0.0) {
+        fprintf(stderr, "stbtt_raster_bench: %s is not a font\n", argv[1]);
+        return 2;
+    }
+
+    int mismatches = 0;
+    for (size_t i = 0; i < scalarBitmaps.size(); i++) {
+        const Bitmap& a = scalarBitmaps[i];
+        const Bitmap& b = simdBitmaps[i];
+        if (a.w == b.w && a.h == b.h && memcmp(&scalarPixels[a.offset], &simdPixels[b.offset], (size_t)a.w * a.h) == 0)
+            continue;
+        if (mismatches++ < 10) {
+            int perSize = kLastChar - kFirstChar + 1;
+            fprintf(stderr, "mismatch: '%c' at %d px\n", kFirstChar + (int)i % perSize, kMinSize + (int)i / perSize);
+        }
+    }
+    printf("%zu glyphs, %zu pixels, %d mismatches\n", scalarBitmaps.size(), scalarPixels.size(), mismatches);
+    printf("scalar %.2f ms, simd %.2f ms (%.2fx)\n", scalarMs, simdMs, scalarMs / simdMs);
+    return mismatches ? 1 : 0;
+}
+#endif
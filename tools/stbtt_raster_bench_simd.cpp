@@ -0,0 +1,3 @@
+// SIMD half of tools/stbtt_raster_bench.cpp, see there.
+#define STBTT_RASTERIZER_SIMD
+#include "stbtt_raster_bench.cpp"
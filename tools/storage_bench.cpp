@@ -0,0 +1,117 @@
+// Benchmarks ImGuiStorage lookups and insertions at 100, 10k and 1M keys, and checks that every stored value reads back.
+//
+// ImGuiStorage is either the sorted vector (default) or the open-addressing index (IMGUI_STORAGE_HASHED, see
+// imconfig.h), which is picked at compile time: build the tool once per layout and compare the two outputs.
+// Keys are ImGuiIDs (ImHashData() of a counter, like PushID(int)), in random order. Reported per size:
+// - lookup hit / miss: GetInt() of stored keys / of keys that aren't stored
+// - insert: SetInt() of kInsertBatch new keys into a storage that already holds that many keys
+// - build: SetInt() of every key into an empty storage, skipped for the sorted vector at 1M keys (O(N^2) moves)
+//
+// Host build, from the repository root:
+//   g++ -O2 -std=c++17 -Isrc/ImGui tools/storage_bench.cpp src/ImGui/imgui*.cpp -o storage_bench
+//   g++ -O2 -std=c++17 -DIMGUI_STORAGE_HASHED -Isrc/ImGui tools/storage_bench.cpp src/ImGui/imgui*.cpp -o storage_bench_hashed
+//   ./storage_bench && ./storage_bench_hashed
+// Exits with 1 if a lookup returns the wrong value.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+static constexpr int kLookups = 1000000;
+static constexpr int kInsertBatch = 1000;
+
+static uint32_t g_rng = 1;
+static uint32_t Random() {
+    g_rng = g_rng * 1664525u + 1013904223u;
+    return g_rng >> 8;
+}
+
+// Keys not in 'exclude' (sorted), which another seed could produce
+static std::vector<ImGuiID> MakeKeys(int count, ImGuiID seed, const std::vector<ImGuiID>& exclude = {}) {
+    std::vector<ImGuiID> keys;
+    keys.reserve((size_t)count);
+    for (int i = 0; (int)keys.size() < count; i++) {
+        const ImGuiID key = ImHashData(&i, sizeof(i), seed);
+        if (!std::binary_search(exclude.begin(), exclude.end(), key)) keys.push_back(key);
+    }
+    for (size_t i = keys.size(); i > 1; i--) std::swap(keys[i - 1], keys[Random() % i]);
+    return keys;
+}
+
+static double NsPerOp(std::chrono::steady_clock::time_point t0, int ops) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / ops;
+}
+
+// Values are derived from the key so a wrong pair shows
+static int ValueOf(ImGuiID key) { return (int)(key ^ 0x5A5A5A5Au); }
+
+static bool Run(int count) {
+    g_rng = 1;
+    const std::vector<ImGuiID> keys = MakeKeys(count, 1);
+    std::vector<ImGuiID> sorted = keys;
+    std::sort(sorted.begin(), sorted.end());
+    const std::vector<ImGuiID> missing = MakeKeys(kLookups, 2, sorted);
+    const std::vector<ImGuiID> extra = MakeKeys(kInsertBatch, 3, sorted);
+    std::vector<ImGuiID> probes((size_t)kLookups);
+    for (ImGuiID& key : probes) key = keys[Random() % keys.size()];
+
+    // Bulk fill, then the first lookup pays for sorting/indexing outside of the timings
+    ImGuiStorage storage;
+    storage.Data.reserve(count + kInsertBatch);
+    for (ImGuiID key : keys) storage.Data.push_back(ImGuiStoragePair(key, ValueOf(key)));
+    storage.BuildSortByKey();
+    bool ok = storage.GetInt(keys[0], 0) == ValueOf(keys[0]);
+
+    auto t0 = std::chrono::steady_clock::now();
+    int wrong = 0;
+    for (ImGuiID key : probes) wrong += storage.GetInt(key, 0) != ValueOf(key);
+    const double hitNs = NsPerOp(t0, kLookups);
+
+    t0 = std::chrono::steady_clock::now();
+    int found = 0;
+    for (ImGuiID key : missing) found += storage.GetInt(key, -1) != -1;
+    const double missNs = NsPerOp(t0, kLookups);
+
+    t0 = std::chrono::steady_clock::now();
+    for (ImGuiID key : extra) storage.SetInt(key, ValueOf(key));
+    const double insertNs = NsPerOp(t0, kInsertBatch);
+    for (ImGuiID key : extra) wrong += storage.GetInt(key, 0) != ValueOf(key);
+    for (int i = 0; i < count; i += 97) wrong += storage.GetInt(keys[(size_t)i], 0) != ValueOf(keys[(size_t)i]);
+
+#ifdef IMGUI_STORAGE_HASHED
+    const bool build = true;
+#else
+    const bool build = count <= 100000;
+#endif
+    double buildMs = 0.0;
+    if (build) {
+        ImGuiStorage built;
+        t0 = std::chrono::steady_clock::now();
+        for (ImGuiID key : keys) built.SetInt(key, ValueOf(key));
+        buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        for (int i = 0; i < count; i += 97) wrong += built.GetInt(keys[(size_t)i], 0) != ValueOf(keys[(size_t)i]);
+    }
+
+    ok &= wrong == 0 && found == 0;
+    printf("  %7d keys  lookup hit %6.1f ns  miss %6.1f ns  insert %8.1f ns", count, hitNs, missNs, insertNs);
+    if (build) printf("  build %9.3f ms", buildMs);
+    else printf("  build   skipped");
+    printf("%s\n", ok ? "" : "  WRONG VALUES");
+    return ok;
+}
+
+int main() {
+#ifdef IMGUI_STORAGE_HASHED
+    printf("ImGuiStorage: hashed index (IMGUI_STORAGE_HASHED)\n");
+#else
+    printf("ImGuiStorage: sorted vector\n");
+#endif
+    bool ok = true;
+    for (int count : { 100, 10000, 1000000 }) ok &= Run(count);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,175 @@
+// Times texture updates in imgui_impl_opengl3 (ImGui_ImplOpenGL3_UpdateTexture(), which merges the update rectangles
+// before uploading them), and checks the texture read back from the GPU.
+//
+// Each frame packs new glyph-sized rectangles into a 1024x1024 RGBA texture, shelf by shelf like the atlas packer,
+// fills them with new pixels and uploads them, then draws the texture so the next upload follows pending rendering:
+// - upload = ImGui_ImplOpenGL3_UpdateTexture(), the time the render thread spends on the update
+// - frame = upload + ImGui_ImplOpenGL3_RenderDrawData() + glFinish(), the total work
+// Runs on an offscreen GLES 3 context (EGL surfaceless, e.g. Mesa llvmpipe).
+//
+// Host build, from the repository root:
+//   g++ -O2 -std=c++17 -DIMGUI_IMPL_OPENGL_ES3 -Isrc/ImGui -Isrc/ImGui/backends
+//       tools/texture_upload_bench.cpp src/ImGui/imgui*.cpp src/ImGui/backends/imgui_impl_opengl3.cpp -lEGL -lGLESv2 -o texture_upload_bench
+//   ./texture_upload_bench [--frames n]
+// Exits with 1 if the texture read back from the GPU differs from its pixels.
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GLES3/gl3.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "imgui.h"
+#include "imgui_impl_opengl3.h"
+
+struct Scenario {
+    const char* name;
+    int rectsPerFrame;
+    int minSize, maxSize;
+};
+
+static const Scenario kScenarios[] = {
+    { "a few glyphs", 8, 10, 24 },
+    { "new text", 128, 10, 40 },
+    { "new font size", 600, 10, 60 },
+};
+static constexpr int kTextureSize = 1024;
+
+static uint32_t g_rng = 1;
+static uint32_t Random() {
+    g_rng = g_rng * 1664525u + 1013904223u;
+    return g_rng >> 8;
+}
+
+static bool InitEGL() {
+    auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (!getPlatformDisplay) return false;
+    EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    EGLint major, minor;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) return false;
+    eglBindAPI(EGL_OPENGL_ES_API);
+    const EGLint attribs[] = { EGL_CONTEXT_MAJOR_VERSION, 3, EGL_NONE };
+    EGLContext context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, attribs);
+    return context != EGL_NO_CONTEXT && eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+}
+
+// Shelf packing: rectangles go left to right, a new shelf starts when the row is full, back to the top when the texture is
+struct Shelf {
+    int x = 0, y = 0, h = 0;
+    ImTextureRect Next(int w, int h) {
+        if (x + w > kTextureSize) { x = 0; y += this->h; this->h = 0; }
+        if (y + h > kTextureSize) { x = 0; y = 0; this->h = 0; }
+        ImTextureRect r = { (unsigned short)x, (unsigned short)y, (unsigned short)w, (unsigned short)h };
+        x += w;
+        this->h = std::max(this->h, h);
+        return r;
+    }
+};
+
+static double Median(std::vector<double> v) {
+    std::sort(v.begin(), v.end());
+    return v.empty() ? 0.0 : v[v.size() / 2];
+}
+
+// Rows of the GL texture that differ from the CPU pixels
+static int CompareWithGPU(ImTextureData* tex) {
+    GLuint fbo;
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, (GLuint)(intptr_t)tex->TexID, 0);
+    std::vector<unsigned char> gpu((size_t)tex->Width * tex->Height * 4);
+    glReadPixels(0, 0, tex->Width, tex->Height, GL_RGBA, GL_UNSIGNED_BYTE, gpu.data());
+    glDeleteFramebuffers(1, &fbo);
+    int rows = 0;
+    for (int y = 0; y < tex->Height; y++)
+        rows += memcmp(gpu.data() + (size_t)y * tex->GetPitch(), tex->GetPixelsAt(0, y), (size_t)tex->GetPitch()) != 0;
+    return rows;
+}
+
+int main(int argc, char** argv) {
+    int frames = 200;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--frames") && i + 1 < argc) frames = std::max(1, atoi(argv[++i]));
+        else {
+            fprintf(stderr, "usage: texture_upload_bench [--frames n]\n");
+            return 1;
+        }
+    }
+    if (!InitEGL()) {
+        fprintf(stderr, "texture_upload_bench: no EGL surfaceless GLES 3 context\n");
+        return 1;
+    }
+    GLuint fbo, renderbuffer;
+    glGenFramebuffers(1, &fbo);
+    glGenRenderbuffers(1, &renderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, 1280, 720);
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(1280, 720);
+    ImGui_ImplOpenGL3_Init("#version 300 es");
+    printf("%s\n", (const char*)glGetString(GL_RENDERER));
+
+    bool ok = true;
+    for (const Scenario& sc : kScenarios) {
+        ImTextureData* tex = IM_NEW(ImTextureData)();
+        tex->Create(ImTextureFormat_RGBA32, kTextureSize, kTextureSize);
+        memset(tex->GetPixels(), 0, (size_t)tex->GetSizeInBytes());
+        ImGui_ImplOpenGL3_UpdateTexture(tex); // WantCreate
+        Shelf shelf;
+        std::vector<double> uploadMs, frameMs;
+        double bytes = 0.0;
+        for (int frame = 0; frame < frames; frame++) {
+            tex->Updates.resize(0);
+            for (int n = 0; n < sc.rectsPerFrame; n++) {
+                const int span = sc.maxSize - sc.minSize + 1;
+                const ImTextureRect r = shelf.Next(sc.minSize + (int)(Random() % span), sc.minSize + (int)(Random() % span));
+                for (int y = r.y; y < r.y + r.h; y++) {
+                    ImU32* row = (ImU32*)tex->GetPixelsAt(r.x, y);
+                    for (int x = 0; x < r.w; x++) row[x] = Random() | IM_COL32_A_MASK;
+                }
+                tex->Updates.push_back(r);
+                bytes += r.w * r.h * 4;
+            }
+            tex->SetStatus(ImTextureStatus_WantUpdates);
+
+            ImGui_ImplOpenGL3_NewFrame();
+            ImGui::NewFrame();
+            ImGui::GetBackgroundDrawList()->AddImage(ImTextureRef(tex->TexID), ImVec2(0, 0), ImVec2(720, 720));
+            ImGui::Render();
+            glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+            glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffer);
+            glViewport(0, 0, 1280, 720);
+            glClear(GL_COLOR_BUFFER_BIT);
+
+            auto t0 = std::chrono::steady_clock::now();
+            ImGui_ImplOpenGL3_UpdateTexture(tex);
+            auto t1 = std::chrono::steady_clock::now();
+            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+            glFinish();
+            auto t2 = std::chrono::steady_clock::now();
+            uploadMs.push_back(std::chrono::duration<double, std::milli>(t1 - t0).count());
+            frameMs.push_back(std::chrono::duration<double, std::milli>(t2 - t0).count());
+        }
+        const int badRows = CompareWithGPU(tex);
+        printf("%-14s %4d rects/frame (%6.1f KB)  upload %7.3f ms  frame %7.3f ms  (median of %d)%s\n", sc.name, sc.rectsPerFrame,
+               bytes / frames / 1024.0, Median(uploadMs), Median(frameMs), frames, badRows ? "  GPU TEXTURE DIFFERS" : "");
+        ok &= badRows == 0;
+        tex->SetStatus(ImTextureStatus_WantDestroy);
+        tex->UnusedFrames = 1;
+        ImGui_ImplOpenGL3_UpdateTexture(tex);
+        IM_DELETE(tex);
+    }
+
+    ImGui_ImplOpenGL3_Shutdown();
+    ImGui::DestroyContext();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,171 @@
+// Checks the UTF-8 ASCII fast path (ImTextCountAsciiPrefix(), SSE2/NEON) against the byte-at-a-time decoder it
+// replaced, and benchmarks both.
+//
+// The scalar reference is the previous ImTextStrFromUtf8()/ImTextCountCharsFromUtf8(): one ImTextCharFromUtf8() call
+// per codepoint. The check compares, on random inputs:
+// - ImTextCountAsciiPrefix() with a plain byte loop, at every start offset and every end
+// - ImTextStrFromUtf8() (output, count and remaining pointer, including short output buffers) and
+//   ImTextCountCharsFromUtf8() with the reference
+// Inputs mix ASCII runs, 2/3/4 byte sequences, stray continuation bytes and zeros, and some are cut in the middle
+// of a multi-byte sequence.
+// The benchmark decodes (StrFromUtf8 then CountChars) a 100 KB log-like buffer at several ASCII ratios.
+//
+// Host build, from the repository root (-DIMGUI_DISABLE_SSE checks the scalar fallback of the kernel):
+//   g++ -O2 -std=c++17 -Isrc/ImGui tools/utf8_decode_bench.cpp src/ImGui/imgui*.cpp -o utf8_decode_bench
+//   ./utf8_decode_bench
+// NEON path on an x86 host, through the intrinsics emulation in tools/neon_emu (see arm_neon.h there):
+//   g++ -O2 -std=c++17 -Itools/neon_emu -DIMGUI_DISABLE_SSE -U__SSE2__ -D__aarch64__ -D__ARM_NEON -funsigned-char -Isrc/ImGui tools/utf8_decode_bench.cpp src/ImGui/imgui*.cpp -o utf8_decode_neon
+// Exits with 1 if a result differs from the reference.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+static int RefStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_text_remaining) {
+    ImWchar* buf_out = buf;
+    ImWchar* buf_end = buf + buf_size;
+    while (buf_out < buf_end - 1 && in_text < in_text_end && *in_text) {
+        unsigned int c;
+        in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
+        *buf_out++ = (ImWchar)c;
+    }
+    *buf_out = 0;
+    *in_text_remaining = in_text;
+    return (int)(buf_out - buf);
+}
+
+static int RefCountCharsFromUtf8(const char* in_text, const char* in_text_end) {
+    int char_count = 0;
+    while (in_text < in_text_end && *in_text) {
+        unsigned int c;
+        in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
+        char_count++;
+    }
+    return char_count;
+}
+
+static uint32_t g_rng = 1;
+static uint32_t Random() {
+    g_rng = g_rng * 1664525u + 1013904223u;
+    return g_rng >> 8;
+}
+
+static void AppendCodepoint(std::string& s, unsigned int c) {
+    char buf[5];
+    s.append(buf, (size_t)ImTextCharToUtf8(buf, c));
+}
+
+static unsigned int RandomMultiByte() {
+    switch (Random() % 3) {
+    case 0: return 0x80 + Random() % 0x780;             // 2 bytes, Latin-1/Cyrillic
+    case 1: return 0x4E00 + Random() % 0x5200;          // 3 bytes, CJK
+    default: return 0x1F300 + Random() % 0x300;         // 4 bytes, emoji
+    }
+}
+
+// 'asciiPercent' of the codepoints are ASCII, in runs of varying length
+static std::string RandomText(size_t bytes, int asciiPercent, bool garbage) {
+    std::string s;
+    while (s.size() < bytes) {
+        if ((int)(Random() % 100) < asciiPercent) {
+            for (uint32_t n = 1 + Random() % 40; n > 0; n--) s += (char)(' ' + Random() % 95);
+        } else {
+            AppendCodepoint(s, RandomMultiByte());
+        }
+        if (garbage && (Random() % 16) == 0) s += (Random() % 4) == 0 ? '\0' : (char)(0x80 + Random() % 0x80);
+    }
+    return s;
+}
+
+static bool Check() {
+    int cases = 0, wrong = 0;
+    std::vector<ImWchar> out, ref;
+    for (int n = 0; n < 20000; n++) {
+        std::string s = RandomText(1 + Random() % 200, (int)(Random() % 101), (n & 1) != 0);
+        // Cut some inputs inside their last multi-byte sequence
+        if ((n % 3) == 0)
+            for (size_t i = s.size(); i-- > 1;)
+                if ((unsigned char)s[i] >= 0xC0) {
+                    s.resize(i + 1 + Random() % 2);
+                    if ((unsigned char)s.back() < 0x80) s.pop_back();
+                    break;
+                }
+        const char* begin = s.data();
+        const char* end = begin + s.size();
+
+        for (const char* p = begin; p <= end; p++) {
+            const char* q = p;
+            while (q < end && (signed char)*q > 0) q++;
+            wrong += ImTextCountAsciiPrefix(p, end) != (int)(q - p);
+            cases++;
+        }
+        for (const char* e = begin + s.size() / 2; e <= end; e++) {
+            wrong += ImTextCountAsciiPrefix(begin, e) != std::min(ImTextCountAsciiPrefix(begin, end), (int)(e - begin));
+            cases++;
+        }
+
+        for (int bufSize : { (int)s.size() + 1, 1 + (int)(Random() % 24) }) {
+            out.assign((size_t)bufSize, 0xFFFF);
+            ref.assign((size_t)bufSize, 0xFFFF);
+            const char* outRemaining = nullptr;
+            const char* refRemaining = nullptr;
+            const int outCount = ImTextStrFromUtf8(out.data(), bufSize, begin, end, &outRemaining);
+            const int refCount = RefStrFromUtf8(ref.data(), bufSize, begin, end, &refRemaining);
+            wrong += outCount != refCount || outRemaining != refRemaining || out != ref;
+            cases++;
+        }
+        wrong += ImTextCountCharsFromUtf8(begin, end) != RefCountCharsFromUtf8(begin, end);
+        // Zero-terminated: same as passing the end of the C string
+        const char* cend = begin + strlen(begin);
+        wrong += ImTextCountCharsFromUtf8(begin, nullptr) != RefCountCharsFromUtf8(begin, cend);
+        cases += 2;
+    }
+    printf("check: %d of %d cases differ from the reference\n", wrong, cases);
+    return wrong == 0;
+}
+
+static void Bench() {
+    printf("decode 100 KB, StrFromUtf8 + CountChars:\n");
+    std::vector<ImWchar> buf(100 * 1024 + 1);
+    for (int asciiPercent : { 100, 95, 50, 0 }) {
+        const std::string s = RandomText(100 * 1024, asciiPercent, false);
+        const char* end = s.data() + s.size();
+        const char* remaining = nullptr;
+        int sink = 0;
+        double ms[2] = {};
+        for (int simd = 0; simd < 2; simd++) {
+            auto t0 = std::chrono::steady_clock::now();
+            for (int rep = 0; rep < 50; rep++) {
+                if (simd) {
+                    sink += ImTextStrFromUtf8(buf.data(), (int)buf.size(), s.data(), end, &remaining);
+                    sink += ImTextCountCharsFromUtf8(s.data(), end);
+                } else {
+                    sink += RefStrFromUtf8(buf.data(), (int)buf.size(), s.data(), end, &remaining);
+                    sink += RefCountCharsFromUtf8(s.data(), end);
+                }
+            }
+            ms[simd] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / 50;
+        }
+        printf("  %3d%% ASCII  reference %7.3f ms  fast path %7.3f ms  (%.1fx)%s\n", asciiPercent, ms[0], ms[1], ms[0] / ms[1], sink == 1 ? " " : "");
+    }
+}
+
+int main() {
+#if defined(IMGUI_ENABLE_SSE)
+    printf("ImTextCountAsciiPrefix: SSE2\n");
+#elif defined(IMGUI_ENABLE_NEON)
+    printf("ImTextCountAsciiPrefix: NEON\n");
+#else
+    printf("ImTextCountAsciiPrefix: scalar\n");
+#endif
+    const bool ok = Check();
+    Bench();
+    return ok ? 0 : 1;
+}
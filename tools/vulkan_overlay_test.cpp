@@ -0,0 +1,471 @@
+// Renders the overlay with the Vulkan backend over images it doesn't own, the way the vkQueuePresentKHR hook
+// does with the game's swapchain, and checks the result.
+//
+// Offscreen images stand in for the swapchain: each frame the "game" clears one to a background color and
+// leaves it in VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, signaling a semaphore. The overlay goes through the same
+// VulkanOverlayNewFrame()/VulkanOverlayRender() calls as src/main.cpp, waiting on that semaphore, and the
+// "present" waits on the semaphore it returns. Fonts change size every few frames so textures get created,
+// updated and destroyed while frames are in flight. Every 20th frame is read back, turned back to the display's
+// orientation, and checked:
+// - the background is untouched outside of the ImGui window
+// - the window was drawn
+// This runs once per scenario: a UNORM swapchain (the reference), an sRGB one, and ones pre-rotated by 90, 180 and
+// 270 degrees (with sideways images for 90/270). The last frame of each must match the reference's within --tolerance
+// levels (default 2): all of it for the rotations, the opaque title bar for sRGB, where translucent colors blend in
+// linear space and come out different (lighter over the light background).
+//
+// Host build, from the repository root:
+//   g++ -O2 -std=c++17 -Isrc -Isrc/ImGui -Isrc/ImGui/backends tools/vulkan_overlay_test.cpp src/vulkan_overlay.cpp
+//       src/ImGui/imgui*.cpp src/ImGui/backends/imgui_impl_vulkan.cpp -lvulkan -o vulkan_overlay_test
+//   ./vulkan_overlay_test [--tolerance t] [last_frame.ppm]
+// Runs on whichever implementation the loader picks: set VK_ICD_FILENAMES to use a software one (lavapipe, SwiftShader)
+// on a machine without a GPU. The device needs VK_KHR_swapchain, no surface is created.
+// Exits with 1 if a check fails.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "imgui.h"
+#include "imgui_impl_vulkan.h"
+#include "vulkan_overlay.h"
+
+static constexpr uint32_t kWidth = 1280;          // display size, the images are kHeight x kWidth when sideways
+static constexpr uint32_t kHeight = 720;
+static constexpr uint32_t kImageCount = 3;        // "swapchain" images
+static constexpr uint32_t kFramesInFlight = 2;
+static constexpr int kFrames = 200;
+static constexpr int kCheckEvery = 20;
+static const float kBackground[4] = { 0.25f, 0.5f, 0.75f, 1.0f };
+
+struct Scenario {
+    const char* name;
+    VkFormat format;
+    VkSurfaceTransformFlagBitsKHR transform;
+};
+
+static const Scenario kScenarios[] = {
+    { "UNORM", VK_FORMAT_R8G8B8A8_UNORM, VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR }, // reference
+    { "sRGB", VK_FORMAT_R8G8B8A8_SRGB, VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR },
+    { "rotated 90", VK_FORMAT_R8G8B8A8_UNORM, VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR },
+    { "rotated 180", VK_FORMAT_R8G8B8A8_UNORM, VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR },
+    { "rotated 270", VK_FORMAT_R8G8B8A8_UNORM, VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR },
+};
+
+static VkPhysicalDevice g_physicalDevice = VK_NULL_HANDLE;
+static VkDevice g_device = VK_NULL_HANDLE;
+static VkQueue g_queue = VK_NULL_HANDLE;
+static uint32_t g_queueFamily = 0;
+static bool g_vkError = false;
+
+static void CheckVkResult(VkResult err) {
+    if (err == VK_SUCCESS) return;
+    fprintf(stderr, "vulkan_overlay_test: VkResult = %d\n", (int)err);
+    g_vkError = true;
+}
+
+static uint32_t FindMemoryType(uint32_t typeBits, VkMemoryPropertyFlags flags) {
+    VkPhysicalDeviceMemoryProperties props;
+    vkGetPhysicalDeviceMemoryProperties(g_physicalDevice, &props);
+    for (uint32_t i = 0; i < props.memoryTypeCount; i++)
+        if ((typeBits & (1u << i)) && (props.memoryTypes[i].propertyFlags & flags) == flags) return i;
+    return 0;
+}
+
+static bool CreateDevice(VkInstance* outInstance) {
+    VkApplicationInfo app = {};
+    app.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    app.apiVersion = VK_API_VERSION_1_0;
+    VkInstanceCreateInfo instanceInfo = {};
+    instanceInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceInfo.pApplicationInfo = &app;
+    if (vkCreateInstance(&instanceInfo, nullptr, outInstance) != VK_SUCCESS) return false;
+    uint32_t count = 1;
+    vkEnumeratePhysicalDevices(*outInstance, &count, &g_physicalDevice);
+    if (count == 0) return false;
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(g_physicalDevice, &props);
+    printf("device: %s\n", props.deviceName);
+
+    // VK_KHR_swapchain is what defines VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+    uint32_t extCount = 0;
+    vkEnumerateDeviceExtensionProperties(g_physicalDevice, nullptr, &extCount, nullptr);
+    std::vector<VkExtensionProperties> exts(extCount);
+    vkEnumerateDeviceExtensionProperties(g_physicalDevice, nullptr, &extCount, exts.data());
+    bool hasSwapchain = false;
+    for (const VkExtensionProperties& e : exts)
+        hasSwapchain |= strcmp(e.extensionName, VK_KHR_SWAPCHAIN_EXTENSION_NAME) == 0;
+    if (!hasSwapchain) {
+        fprintf(stderr, "vulkan_overlay_test: device lacks %s\n", VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+        return false;
+    }
+
+    uint32_t familyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(g_physicalDevice, &familyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> families(familyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(g_physicalDevice, &familyCount, families.data());
+    g_queueFamily = familyCount;
+    for (uint32_t i = 0; i < familyCount && g_queueFamily == familyCount; i++)
+        if (families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) g_queueFamily = i;
+    if (g_queueFamily == familyCount) return false;
+
+    const float priority = 1.0f;
+    VkDeviceQueueCreateInfo queueInfo = {};
+    queueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueInfo.queueFamilyIndex = g_queueFamily;
+    queueInfo.queueCount = 1;
+    queueInfo.pQueuePriorities = &priority;
+    const char* extName = VK_KHR_SWAPCHAIN_EXTENSION_NAME;
+    VkDeviceCreateInfo deviceInfo = {};
+    deviceInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceInfo.queueCreateInfoCount = 1;
+    deviceInfo.pQueueCreateInfos = &queueInfo;
+    deviceInfo.enabledExtensionCount = 1;
+    deviceInfo.ppEnabledExtensionNames = &extName;
+    if (vkCreateDevice(g_physicalDevice, &deviceInfo, nullptr, &g_device) != VK_SUCCESS) return false;
+    vkGetDeviceQueue(g_device, g_queueFamily, 0, &g_queue);
+    return true;
+}
+
+// What the game does to one of its images before presenting it
+struct GameImage {
+    VkImage image;
+    VkDeviceMemory memory;
+    VkCommandBuffer clearCmd;
+    VkSemaphore rendered;
+};
+
+static void ImageBarrier(VkCommandBuffer cmd, VkImage image, VkImageLayout from, VkImageLayout to, VkAccessFlags srcAccess, VkAccessFlags dstAccess,
+                         VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage) {
+    VkImageMemoryBarrier b = {};
+    b.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    b.srcAccessMask = srcAccess;
+    b.dstAccessMask = dstAccess;
+    b.oldLayout = from;
+    b.newLayout = to;
+    b.srcQueueFamilyIndex = b.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    b.image = image;
+    b.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    b.subresourceRange.levelCount = 1;
+    b.subresourceRange.layerCount = 1;
+    vkCmdPipelineBarrier(cmd, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &b);
+}
+
+static void CreateGameImage(GameImage& g, VkCommandPool pool, VkFormat format, VkExtent2D extent) {
+    VkImageCreateInfo info = {};
+    info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    info.imageType = VK_IMAGE_TYPE_2D;
+    info.format = format;
+    info.extent = { extent.width, extent.height, 1 };
+    info.mipLevels = 1;
+    info.arrayLayers = 1;
+    info.samples = VK_SAMPLE_COUNT_1_BIT;
+    info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    info.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    CheckVkResult(vkCreateImage(g_device, &info, nullptr, &g.image));
+    VkMemoryRequirements req;
+    vkGetImageMemoryRequirements(g_device, g.image, &req);
+    VkMemoryAllocateInfo alloc = {};
+    alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc.allocationSize = req.size;
+    alloc.memoryTypeIndex = FindMemoryType(req.memoryTypeBits, 0);
+    CheckVkResult(vkAllocateMemory(g_device, &alloc, nullptr, &g.memory));
+    CheckVkResult(vkBindImageMemory(g_device, g.image, g.memory, 0));
+
+    VkCommandBufferAllocateInfo cmdInfo = {};
+    cmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cmdInfo.commandPool = pool;
+    cmdInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    cmdInfo.commandBufferCount = 1;
+    CheckVkResult(vkAllocateCommandBuffers(g_device, &cmdInfo, &g.clearCmd));
+    VkCommandBufferBeginInfo begin = {};
+    begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    vkBeginCommandBuffer(g.clearCmd, &begin);
+    // Previous contents are discarded, the barrier orders the clear after the overlay and readback of the previous use
+    ImageBarrier(g.clearCmd, g.image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                 VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                 VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    // Same stored color in an sRGB image: the clear color is linear
+    VkClearColorValue color;
+    memcpy(color.float32, kBackground, sizeof(kBackground));
+    if (format == VK_FORMAT_R8G8B8A8_SRGB)
+        for (int c = 0; c < 3; c++) color.float32[c] = color.float32[c] <= 0.04045f ? color.float32[c] / 12.92f : powf((color.float32[c] + 0.055f) / 1.055f, 2.4f);
+    VkImageSubresourceRange range = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+    vkCmdClearColorImage(g.clearCmd, g.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &color, 1, &range);
+    ImageBarrier(g.clearCmd, g.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+                 VK_ACCESS_TRANSFER_WRITE_BIT, 0, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+    CheckVkResult(vkEndCommandBuffer(g.clearCmd));
+
+    VkSemaphoreCreateInfo semInfo = {};
+    semInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    CheckVkResult(vkCreateSemaphore(g_device, &semInfo, nullptr, &g.rendered));
+}
+
+// Stands in for vkQueuePresentKHR(): waits on the overlay's semaphore, and optionally copies the image to 'readback'
+static void Present(VkCommandPool pool, const GameImage& g, VkExtent2D extent, VkSemaphore wait, VkBuffer readback) {
+    VkCommandBuffer cmd = VK_NULL_HANDLE;
+    if (readback) {
+        VkCommandBufferAllocateInfo cmdInfo = {};
+        cmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        cmdInfo.commandPool = pool;
+        cmdInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        cmdInfo.commandBufferCount = 1;
+        CheckVkResult(vkAllocateCommandBuffers(g_device, &cmdInfo, &cmd));
+        VkCommandBufferBeginInfo begin = {};
+        begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(cmd, &begin);
+        ImageBarrier(cmd, g.image, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                     0, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+        VkBufferImageCopy region = {};
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.layerCount = 1;
+        region.imageExtent = { extent.width, extent.height, 1 };
+        vkCmdCopyImageToBuffer(cmd, g.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, readback, 1, &region);
+        VkMemoryBarrier toHost = {};
+        toHost.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        toHost.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        toHost.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &toHost, 0, nullptr, 0, nullptr);
+        CheckVkResult(vkEndCommandBuffer(cmd));
+    }
+    VkPipelineStageFlags stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    VkSubmitInfo submit = {};
+    submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit.waitSemaphoreCount = 1;
+    submit.pWaitSemaphores = &wait;
+    submit.pWaitDstStageMask = &stage;
+    submit.commandBufferCount = cmd ? 1 : 0;
+    submit.pCommandBuffers = &cmd;
+    CheckVkResult(vkQueueSubmit(g_queue, 1, &submit, VK_NULL_HANDLE));
+    if (readback) CheckVkResult(vkQueueWaitIdle(g_queue));
+}
+
+static void BuildUi(int frame, ImFont* font) {
+    ImGui::SetNextWindowPos(ImVec2(100, 80));
+    ImGui::SetNextWindowSize(ImVec2(520, 400));
+    ImGui::Begin("Overlay", nullptr, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize);
+    ImGui::Text("Frame %d", frame);
+    ImGui::PushFont(font, 14.0f + (frame / 10) % 12 * 3.0f); // new glyphs every 10 frames
+    ImGui::TextUnformatted("The quick brown fox jumps over the lazy dog 0123456789");
+    ImGui::PopFont();
+    static bool check = true;
+    static float slider = 0.5f;
+    ImGui::Checkbox("Checkbox", &check);
+    ImGui::SliderFloat("Slider", &slider, 0.0f, 1.0f);
+    ImGui::Button("Button", ImVec2(200, 60));
+    ImGui::GetWindowDrawList()->AddCircleFilled(ImVec2(450, 380), 40.0f, IM_COL32(255, 64, 64, 160));
+    ImGui::End();
+}
+
+// The image read back, in the display's orientation: undoes the pre-rotation (see ImGui_ImplVulkan_SetPreTransform())
+static void Unrotate(const uint8_t* image, VkSurfaceTransformFlagBitsKHR transform, std::vector<uint8_t>& out) {
+    out.resize((size_t)kWidth * kHeight * 4);
+    for (uint32_t y = 0; y < kHeight; y++)
+        for (uint32_t x = 0; x < kWidth; x++) {
+            size_t src = (size_t)y * kWidth + x;
+            if (transform == VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR) src = (size_t)x * kHeight + (kHeight - 1 - y);
+            else if (transform == VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR) src = (size_t)(kHeight - 1 - y) * kWidth + (kWidth - 1 - x);
+            else if (transform == VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR) src = (size_t)(kWidth - 1 - x) * kHeight + y;
+            memcpy(&out[((size_t)y * kWidth + x) * 4], image + src * 4, 4);
+        }
+}
+
+// Returns the number of failed checks
+static int CheckImage(const uint8_t* px, int frame) {
+    uint8_t bg[4];
+    for (int c = 0; c < 4; c++) bg[c] = (uint8_t)(kBackground[c] * 255.0f + 0.5f);
+    // Window rect plus a margin for the shadow and antialiasing
+    const uint32_t x0 = 100 - 4, y0 = 80 - 4, x1 = 100 + 520 + 12, y1 = 80 + 400 + 12;
+    int outsideChanged = 0, insideChanged = 0;
+    for (uint32_t y = 0; y < kHeight; y++)
+        for (uint32_t x = 0; x < kWidth; x++) {
+            const bool changed = memcmp(px + (y * kWidth + x) * 4, bg, 4) != 0;
+            const bool inside = x >= x0 && x < x1 && y >= y0 && y < y1;
+            (inside ? insideChanged : outsideChanged) += changed;
+        }
+    printf("  frame %3d: %6d pixels drawn, %d changed outside of the window\n", frame, insideChanged, outsideChanged);
+    return (outsideChanged != 0) + (insideChanged < 20000);
+}
+
+static void WritePpm(const char* path, const uint8_t* px) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return;
+    fprintf(f, "P6\n%u %u\n255\n", kWidth, kHeight);
+    for (uint32_t i = 0; i < kWidth * kHeight; i++) fwrite(px + i * 4, 1, 3, f);
+    fclose(f);
+}
+
+// Pixels of 'a' in [x0,x1)x[y0,y1) with a channel further than 'tolerance' from 'b'
+static int CountDifferences(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1,
+                            int tolerance, int& maxDelta) {
+    int count = 0;
+    for (uint32_t y = y0; y < y1; y++)
+        for (uint32_t x = x0; x < x1; x++) {
+            const size_t i = ((size_t)y * kWidth + x) * 4;
+            int delta = 0;
+            for (int c = 0; c < 3; c++) delta = std::max(delta, abs((int)a[i + c] - (int)b[i + c]));
+            maxDelta = std::max(maxDelta, delta);
+            count += delta > tolerance;
+        }
+    return count;
+}
+
+// Runs kFrames frames on a new "swapchain", returns the number of failed checks and the last frame in 'lastFrame'
+static int RunScenario(const Scenario& sc, std::vector<uint8_t>& lastFrame) {
+    const bool sideways = sc.transform == VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR || sc.transform == VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR;
+    const VkExtent2D extent = sideways ? VkExtent2D{ kHeight, kWidth } : VkExtent2D{ kWidth, kHeight };
+    printf("%s (%ux%u images)\n", sc.name, extent.width, extent.height);
+
+    VkCommandPool gamePool;
+    VkCommandPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.queueFamilyIndex = g_queueFamily;
+    CheckVkResult(vkCreateCommandPool(g_device, &poolInfo, nullptr, &gamePool));
+    GameImage images[kImageCount];
+    VkImage handles[kImageCount];
+    for (uint32_t i = 0; i < kImageCount; i++) {
+        CreateGameImage(images[i], gamePool, sc.format, extent);
+        handles[i] = images[i].image;
+    }
+
+    // Host readable buffer for the checks
+    VkBuffer readback;
+    VkDeviceMemory readbackMemory;
+    void* readbackPixels = nullptr;
+    {
+        VkBufferCreateInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        info.size = (VkDeviceSize)kWidth * kHeight * 4;
+        info.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        CheckVkResult(vkCreateBuffer(g_device, &info, nullptr, &readback));
+        VkMemoryRequirements req;
+        vkGetBufferMemoryRequirements(g_device, readback, &req);
+        VkMemoryAllocateInfo alloc = {};
+        alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        alloc.allocationSize = req.size;
+        alloc.memoryTypeIndex = FindMemoryType(req.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        CheckVkResult(vkAllocateMemory(g_device, &alloc, nullptr, &readbackMemory));
+        CheckVkResult(vkBindBufferMemory(g_device, readback, readbackMemory, 0));
+        CheckVkResult(vkMapMemory(g_device, readbackMemory, 0, VK_WHOLE_SIZE, 0, &readbackPixels));
+    }
+
+    // Same setup as src/main.cpp, in a new context so every scenario draws the same frames
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2((float)kWidth, (float)kHeight);
+    ImFont* font = io.Fonts->AddFontDefault();
+    VulkanOverlay overlay;
+    if (!VulkanOverlayCreate(overlay, g_device, g_queueFamily, sc.format, kFramesInFlight)) return 1;
+    ImGui_ImplVulkan_InitInfo initInfo = {};
+    initInfo.PhysicalDevice = g_physicalDevice;
+    initInfo.Device = g_device;
+    initInfo.RenderPass = overlay.renderPass;
+    initInfo.ImageCount = overlay.frameCount;
+    initInfo.SrgbColorAttachment = overlay.srgb;
+    initInfo.CheckVkResultFn = CheckVkResult;
+    if (!ImGui_ImplVulkan_Init(&initInfo)) return 1;
+    if (!VulkanOverlaySetImages(overlay, handles, kImageCount, extent, sc.transform)) return 1;
+
+    int failures = 0, texCreated = 0, texUpdated = 0;
+    double overlayMs = 0.0;
+    for (int frame = 0; frame < kFrames; frame++) {
+        GameImage& g = images[frame % kImageCount];
+        VkSubmitInfo submit = {};
+        submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit.commandBufferCount = 1;
+        submit.pCommandBuffers = &g.clearCmd;
+        submit.signalSemaphoreCount = 1;
+        submit.pSignalSemaphores = &g.rendered;
+        CheckVkResult(vkQueueSubmit(g_queue, 1, &submit, VK_NULL_HANDLE));
+
+        auto t0 = std::chrono::steady_clock::now();
+        io.DeltaTime = 1.0f / 60.0f;
+        VulkanOverlayNewFrame(overlay);
+        ImGui::NewFrame();
+        BuildUi(frame, font);
+        ImGui::Render();
+        for (ImTextureData* tex : *ImGui::GetDrawData()->Textures) {
+            texCreated += tex->Status == ImTextureStatus_WantCreate;
+            texUpdated += tex->Status == ImTextureStatus_WantUpdates;
+        }
+        VkSemaphore done = VulkanOverlayRender(overlay, g_queue, frame % kImageCount, ImGui::GetDrawData(), &g.rendered, 1);
+        overlayMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        if (done == VK_NULL_HANDLE) {
+            fprintf(stderr, "vulkan_overlay_test: frame %d not submitted\n", frame);
+            failures++;
+            break;
+        }
+
+        const bool check = (frame % kCheckEvery) == kCheckEvery - 1;
+        Present(gamePool, g, extent, done, check ? readback : VK_NULL_HANDLE);
+        if (check) {
+            Unrotate((const uint8_t*)readbackPixels, sc.transform, lastFrame);
+            failures += CheckImage(lastFrame.data(), frame);
+        }
+    }
+    printf("  %d frames, %d texture creations, %d texture updates, overlay %.3f ms/frame (fence waits included)\n",
+        kFrames, texCreated, texUpdated, overlayMs / kFrames);
+
+    vkDeviceWaitIdle(g_device);
+    ImGui_ImplVulkan_Shutdown();
+    VulkanOverlayDestroy(overlay);
+    ImGui::DestroyContext();
+    for (GameImage& g : images) {
+        vkDestroySemaphore(g_device, g.rendered, nullptr);
+        vkDestroyImage(g_device, g.image, nullptr);
+        vkFreeMemory(g_device, g.memory, nullptr);
+    }
+    vkDestroyBuffer(g_device, readback, nullptr);
+    vkFreeMemory(g_device, readbackMemory, nullptr);
+    vkDestroyCommandPool(g_device, gamePool, nullptr);
+    return failures;
+}
+
+int main(int argc, char** argv) {
+    int tolerance = 2;
+    const char* ppmPath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--tolerance") && i + 1 < argc) tolerance = atoi(argv[++i]);
+        else if (argv[i][0] != '-' && !ppmPath) ppmPath = argv[i];
+        else {
+            fprintf(stderr, "usage: vulkan_overlay_test [--tolerance t] [last_frame.ppm]\n");
+            return 1;
+        }
+    }
+    VkInstance instance = VK_NULL_HANDLE;
+    if (!CreateDevice(&instance)) {
+        fprintf(stderr, "vulkan_overlay_test: no usable Vulkan device\n");
+        return 1;
+    }
+
+    int failures = 0;
+    std::vector<uint8_t> reference, lastFrame;
+    for (const Scenario& sc : kScenarios) {
+        failures += RunScenario(sc, lastFrame);
+        if (&sc == &kScenarios[0]) {
+            reference = lastFrame;
+            if (ppmPath) WritePpm(ppmPath, reference.data());
+            continue;
+        }
+        // Title bar: below the window's top border, right of the title text
+        int maxDelta = 0;
+        const bool srgb = sc.format == VK_FORMAT_R8G8B8A8_SRGB;
+        const int differences = srgb ? CountDifferences(lastFrame, reference, 200, 82, 600, 97, tolerance, maxDelta)
+                                     : CountDifferences(lastFrame, reference, 0, 0, kWidth, kHeight, tolerance, maxDelta);
+        printf("  last frame vs %s%s: %d pixels differ, max delta %d%s\n", kScenarios[0].name, srgb ? ", title bar" : "", differences, maxDelta,
+               differences ? "  DIFFERS" : "");
+        failures += differences != 0;
+    }
+
+    vkDestroyDevice(g_device, nullptr);
+    vkDestroyInstance(instance, nullptr);
+    if (g_vkError) failures++;
+    return failures ? 1 : 0;
+}